@@ -108,8 +108,8 @@ void ControlEditorPanel::CreateMenuButton(const ImVec2 ButtonSize, ImFont* IconF
 
             if (ImGui::MenuItem("Load Level"))
             {
-                char const* lFilterPatterns[1] = { "*.scene" };
-                const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 1, lFilterPatterns, "Scene(.scene) file", 0);
+                char const* lFilterPatterns[2] = { "*.scene", "*.bscene" };
+                const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 2, lFilterPatterns, "Scene(.scene, .bscene) file", 0);
 
                 if (FileName == nullptr)
                 {
@@ -120,7 +120,7 @@ void ControlEditorPanel::CreateMenuButton(const ImVec2 ButtonSize, ImFont* IconF
                 if (UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine))
                 {
                     EditorEngine->NewLevel();
-                    EditorEngine->LoadLevel(FileName);
+                    EditorEngine->StreamLevel(FileName);
                 }
             }
 
@@ -128,8 +128,8 @@ void ControlEditorPanel::CreateMenuButton(const ImVec2 ButtonSize, ImFont* IconF
 
             if (ImGui::MenuItem("Save Level"))
             {
-                char const* lFilterPatterns[1] = { "*.scene" };
-                const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 1, lFilterPatterns, "Scene(.scene) file");
+                char const* lFilterPatterns[2] = { "*.scene", "*.bscene" };
+                const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 2, lFilterPatterns, "Scene(.scene, .bscene) file");
 
                 if (FileName == nullptr)
                 {
@@ -78,6 +78,11 @@ void PropertyEditorPanel::Render()
     if (SelectedActor)
     {
         RenderForActor(SelectedActor, TargetComponent);
+        RenderForReflectedProperties(SelectedActor);
+    }
+    if (TargetComponent != nullptr)
+    {
+        RenderForReflectedProperties(TargetComponent);
     }
 
     if (ULightComponentBase* LightComponent = GetTargetComponent<ULightComponentBase>(SelectedActor, SelectedComponent))
@@ -135,11 +140,6 @@ void PropertyEditorPanel::Render()
         RenderForExponentialHeightFogComponent(FogComponent);
     }
 
-    if (UShapeComponent* ShapeComponent = GetTargetComponent<UShapeComponent>(SelectedActor, SelectedComponent))
-    {
-        RenderForShapeComponent(ShapeComponent);
-    }
-
     if (USpringArmComponent* SpringArmComponent = GetTargetComponent<USpringArmComponent>(SelectedActor, SelectedComponent))
     {
         RenderForSpringArmComponent(SpringArmComponent);
@@ -150,6 +150,13 @@ void PropertyEditorPanel::Render()
         RenderForCameraComponent(CameraComponent);
     }
 
+    // 패널의 위젯 중에는 setter를 거치지 않고 값을 바로 바꾸는 것이 많으므로, 편집 중이면 대상 액터를 자동 저장 대상으로 표시
+    AActor* EditedActor = SelectedActor ? SelectedActor : (TargetComponent ? TargetComponent->GetOwner() : nullptr);
+    if (EditedActor && ImGui::IsAnyItemActive() && ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows))
+    {
+        EditedActor->MarkDirty();
+    }
+
     ImGui::End();
 }
 
@@ -1252,63 +1259,108 @@ void PropertyEditorPanel::RenderForExponentialHeightFogComponent(UHeightFogCompo
     ImGui::PopStyleColor();
 }
 
-void PropertyEditorPanel::RenderForShapeComponent(UShapeComponent* ShapeComponent) const
+void PropertyEditorPanel::RenderForReflectedProperties(UObject* Object) const
 {
-    ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
-    if (USphereComponent* Component = Cast<USphereComponent>(ShapeComponent))
+    constexpr EPropertyFlags VisibleFlags = EPropertyFlags::EditAnywhere | EPropertyFlags::VisibleAnywhere;
+
+    const UClass* Class = Object->GetClass();
+    bool bHasVisibleProperty = false;
+    Class->ForEachProperty([&bHasVisibleProperty, VisibleFlags](const FProperty& Prop)
     {
-        if (ImGui::TreeNodeEx("Sphere Collision", ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen)) // 트리 노드 생성
-        {
-            float Radius = Component->GetRadius();
-            ImGui::Text("Radius");
-            ImGui::SameLine();
-            if (ImGui::DragFloat("##Radius", &Radius))
-            {
-                Component->SetRadius(Radius);
-            }
-            ImGui::TreePop();
-        }
+        bHasVisibleProperty |= Prop.HasAnyFlags(VisibleFlags);
+    });
+    if (!bHasVisibleProperty)
+    {
+        return;
     }
 
-    if (UBoxComponent* Component = Cast<UBoxComponent>(ShapeComponent))
+    ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
+    if (ImGui::TreeNodeEx(GetData(Class->GetName()), ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen)) // 트리 노드 생성
     {
-        if (ImGui::TreeNodeEx("Box Collision", ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen)) // 트리 노드 생성
+        Class->ForEachProperty([Object, VisibleFlags](const FProperty& Prop)
         {
-            FVector Extent = Component->GetBoxExtent();
+            if (!Prop.HasAnyFlags(VisibleFlags))
+            {
+                return;
+            }
 
-            float Extents[3] = { Extent.X, Extent.Y, Extent.Z };
+            ImGui::PushID(Prop.Name);
+            ImGui::BeginDisabled(!Prop.HasAnyFlags(EPropertyFlags::EditAnywhere));
 
-            ImGui::Text("Extent");
-            ImGui::SameLine();
-            if (ImGui::DragFloat3("##Extent", Extents)) {
-                Component->SetBoxExtent(FVector(Extents[0], Extents[1], Extents[2]));
-            }
-            ImGui::TreePop();
-        }
-    }
+            bool bChanged = false;
+            Prop.VisitValue(Object, [&Prop, &bChanged]<typename T>(T& Value)
+            {
+                if constexpr (std::is_same_v<T, FVector>)
+                {
+                    bChanged = FImGuiWidget::DrawVec3Control(Prop.Name, Value, 0, 85);
+                    return;
+                }
+                else if constexpr (std::is_same_v<T, FRotator>)
+                {
+                    bChanged = FImGuiWidget::DrawRot3Control(Prop.Name, Value, 0, 85);
+                    return;
+                }
 
-    if (UCapsuleComponent* Component = Cast<UCapsuleComponent>(ShapeComponent))
-    {
-        if (ImGui::TreeNodeEx("Box Collision", ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen)) // 트리 노드 생성
-        {
-            float HalfHeight = Component->GetHalfHeight();
-            float Radius = Component->GetRadius();
+                ImGui::Text("%s", Prop.Name);
+                ImGui::SameLine();
+                if constexpr (std::is_same_v<T, bool>)
+                {
+                    bChanged = ImGui::Checkbox("##Value", &Value);
+                }
+                else if constexpr (std::is_same_v<T, int32>)
+                {
+                    bChanged = ImGui::DragInt("##Value", &Value);
+                }
+                else if constexpr (std::is_same_v<T, float>)
+                {
+                    bChanged = ImGui::DragFloat("##Value", &Value, 0.1f);
+                }
+                else if constexpr (std::is_same_v<T, FVector2D>)
+                {
+                    bChanged = ImGui::DragFloat2("##Value", &Value.X, 0.1f);
+                }
+                else if constexpr (std::is_same_v<T, FVector4>)
+                {
+                    bChanged = ImGui::DragFloat4("##Value", &Value.X, 0.1f);
+                }
+                else if constexpr (std::is_same_v<T, FLinearColor>)
+                {
+                    bChanged = ImGui::ColorEdit4("##Value", &Value.R, ImGuiColorEditFlags_Float);
+                }
+                else if constexpr (std::is_same_v<T, FString>)
+                {
+                    char Buffer[256];
+                    strncpy_s(Buffer, GetData(Value), _TRUNCATE);
+                    if (ImGui::InputText("##Value", Buffer, IM_ARRAYSIZE(Buffer), ImGuiInputTextFlags_EnterReturnsTrue))
+                    {
+                        Value = Buffer;
+                        bChanged = true;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, FName>)
+                {
+                    ImGui::Text("%s", GetData(Value.ToString()));
+                }
+                else if constexpr (std::is_same_v<T, UObject*>)
+                {
+                    ImGui::Text("%s", Value ? GetData(Value->GetName()) : "None");
+                }
+                else if constexpr (std::is_same_v<T, TArray<UObject*>>)
+                {
+                    ImGui::Text("%d Objects", Value.Num());
+                }
+            });
 
-            ImGui::Text("HalfHeight");
-            ImGui::SameLine();
-            if (ImGui::DragFloat("##HalfHeight", &HalfHeight, 0.1f)) {
-                Component->SetHalfHeight(HalfHeight);
+            if (bChanged)
+            {
+                Object->PostEditChangeProperty(Prop);
             }
 
-            ImGui::Text("Radius");
-            ImGui::SameLine();
-            if (ImGui::DragFloat("##Radius", &Radius, 0.1f)) {
-                Component->SetRadius(Radius);
-            }
-            ImGui::TreePop();
-        }
+            ImGui::EndDisabled();
+            ImGui::PopID();
+        });
+        ImGui::TreePop();
     }
-    
     ImGui::PopStyleColor();
 }
 
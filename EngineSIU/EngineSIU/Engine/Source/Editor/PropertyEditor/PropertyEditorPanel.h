@@ -63,7 +63,8 @@ private:
     
     void RenderForExponentialHeightFogComponent(UHeightFogComponent* ExponentialHeightFogComp) const;
 
-    void RenderForShapeComponent(UShapeComponent* ShapeComponent) const;
+    /** EditAnywhere / VisibleAnywhere Property를 타입에 맞는 위젯으로 그립니다. */
+    void RenderForReflectedProperties(UObject* Object) const;
 
     void RenderForSpringArmComponent(USpringArmComponent* SpringArmComp) const;
 
@@ -5,6 +5,7 @@
 #include "PrimitiveDrawBatch.h"
 #include "EngineLoop.h"
 #include "D3D11RHI/GraphicDevice.h"
+#include "Math/MathBatch.h"
 #include "UnrealEd/EditorViewportClient.h"
 
 
@@ -15,10 +16,7 @@ UPrimitiveDrawBatch::~UPrimitiveDrawBatch()
         VertexBuffer->Release();
         VertexBuffer = nullptr;
     }
-    ReleaseOBBBuffers();
-    ReleaseBoundingBoxBuffers();
-    ReleaseConeBuffers();
-    ReleaseBoneBuffers();
+    ReleasePrimitiveBuffer();
 
     // Primitive 버퍼들 릴리즈
     if (GridConstantBuffer)
@@ -36,6 +34,8 @@ UPrimitiveDrawBatch::~UPrimitiveDrawBatch()
 // 2. 초기화 및 릴리즈 함수
 void UPrimitiveDrawBatch::Initialize(FGraphicsDevice* graphics)
 {
+    MEMORY_TAG_SCOPE(RenderData);
+
     Graphics = graphics;
     InitializeGrid(5, 5000);
     CreatePrimitiveBuffers();
@@ -49,10 +49,7 @@ void UPrimitiveDrawBatch::ReleaseResources()
         VertexBuffer->Release();
         VertexBuffer = nullptr;
     }
-    ReleaseOBBBuffers();
-    ReleaseBoundingBoxBuffers();
-    ReleaseConeBuffers();
-    ReleaseBoneBuffers();
+    ReleasePrimitiveBuffer();
 
     if (GridConstantBuffer)
     {
@@ -78,33 +75,24 @@ void UPrimitiveDrawBatch::PrepareBatch(FLinePrimitiveBatchArgs& OutLinePrimitive
 {
     InitializeVertexBuffer();
     UpdateGridConstantBuffer(GridParameters);
-    UpdateBoundingBoxBuffers();
-    UpdateConeBuffers();
-    UpdateOBBBuffers();
-    UpdateBoneBuffers();
-
-    int BoundingBoxSize = BoundingBoxes.Num();
-    int ConeSize = Cones.Num();
-    int OBBSize = OrientedBoundingBoxes.Num();
-    int BoneSize = BoneGizmos.Num();
 
-    UpdateLinePrimitiveCountBuffer(BoundingBoxSize, ConeSize, BoneSize);
+    const FDebugPrimitiveLayout Layout = PrimitiveStream.ComputeLayout();
+    UpdatePrimitiveBuffer(Layout);
+    UpdateLinePrimitiveCountBuffer(Layout);
+    Stats.Layout = Layout;
 
     OutLinePrimitiveBatchArgs.GridParam = GridParameters;
     OutLinePrimitiveBatchArgs.VertexBuffer = VertexBuffer;
-    OutLinePrimitiveBatchArgs.BoundingBoxCount = BoundingBoxSize;
-    OutLinePrimitiveBatchArgs.ConeCount = ConeSize;
+    OutLinePrimitiveBatchArgs.BoundingBoxCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::AABB)]);
+    OutLinePrimitiveBatchArgs.ConeCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Cone)]);
     OutLinePrimitiveBatchArgs.ConeSegmentCount = ConeSegmentCount;
-    OutLinePrimitiveBatchArgs.OBBCount = OBBSize;
-    OutLinePrimitiveBatchArgs.BoneCount = BoneSize;
+    OutLinePrimitiveBatchArgs.OBBCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::OBB)]);
+    OutLinePrimitiveBatchArgs.BoneCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Bone)]);
 }
 
 void UPrimitiveDrawBatch::RemoveArr()
 {
-    BoundingBoxes.Empty();
-    Cones.Empty();
-    OrientedBoundingBoxes.Empty();
-    BoneGizmos.Empty();
+    PrimitiveStream.Reset();
 }
 
 // 4. 버퍼 초기화 및 업데이트
@@ -129,171 +117,84 @@ void UPrimitiveDrawBatch::UpdateGridConstantBuffer(const FGridParameters& GridPa
     }
 }
 
-void UPrimitiveDrawBatch::UpdateBoundingBoxBuffers()
-{
-    if (BoundingBoxes.Num() > AllocatedBoundingBoxCapacity)
-    {
-        AllocatedBoundingBoxCapacity = BoundingBoxes.Num();
-        ReleaseBoundingBoxBuffers();
-        BoundingBoxBuffer = CreateBoundingBoxBuffer(static_cast<UINT>(AllocatedBoundingBoxCapacity));
-        BoundingBoxSRV = CreateBoundingBoxSRV(BoundingBoxBuffer, static_cast<UINT>(AllocatedBoundingBoxCapacity));
-    }
-    if (BoundingBoxBuffer && BoundingBoxSRV)
-    {
-        int BoundingBoxCount = BoundingBoxes.Num();
-        UpdateBoundingBoxBuffer(BoundingBoxBuffer, BoundingBoxes, BoundingBoxCount);
-    }
-}
-
-void UPrimitiveDrawBatch::UpdateConeBuffers()
+void UPrimitiveDrawBatch::UpdatePrimitiveBuffer(const FDebugPrimitiveLayout& Layout)
 {
-    if (Cones.Num() > AllocatedConeCapacity)
+    if (Layout.NumWords == 0)
     {
-        AllocatedConeCapacity = Cones.Num();
-        ReleaseConeBuffers();
-        ConesBuffer = CreateConeBuffer(static_cast<UINT>(AllocatedConeCapacity));
-        ConeSRV = CreateConeSRV(ConesBuffer, static_cast<UINT>(AllocatedConeCapacity));
-    }
-    if (ConesBuffer && ConeSRV)
-    {
-        int ConeCount = Cones.Num();
-        UpdateConesBuffer(ConesBuffer, Cones, ConeCount);
+        return;
     }
-}
 
-void UPrimitiveDrawBatch::UpdateOBBBuffers()
-{
-    if (OrientedBoundingBoxes.Num() > AllocatedOBBCapacity)
+    // 버퍼는 프레임마다 다시 만들지 않고, 모자랄 때만 2배씩 키움
+    const uint32 Capacity = FDebugPrimitiveStream::ComputeGrownCapacity(Stats.BufferCapacityWords, Layout.NumWords);
+    if (!PrimitiveBuffer || Capacity != Stats.BufferCapacityWords)
     {
-        AllocatedOBBCapacity = OrientedBoundingBoxes.Num();
-        ReleaseOBBBuffers();
-        OBBBuffer = CreateOBBBuffer(static_cast<UINT>(AllocatedOBBCapacity));
-        OBBSRV = CreateOBBSRV(OBBBuffer, static_cast<UINT>(AllocatedOBBCapacity));
+        if (!CreatePrimitiveBuffer(Capacity))
+        {
+            return;
+        }
     }
-    if (OBBBuffer && OBBSRV)
-    {
-        int OBBCount = OrientedBoundingBoxes.Num();
-        UpdateOBBBuffer(OBBBuffer, OrientedBoundingBoxes, OBBCount);
-    }
-}
 
-void UPrimitiveDrawBatch::UpdateBoneBuffers()
-{
-    if (BoneGizmos.Num() > AllocatedBoneCapacity)
-    {
-        AllocatedBoneCapacity = BoneGizmos.Num();
-        ReleaseBoneBuffers();
-        BoneBuffer = CreateBoneBuffer(static_cast<UINT>(AllocatedBoneCapacity));
-        BoneSRV = CreateBoneSRV(BoneBuffer, static_cast<UINT>(AllocatedBoneCapacity));
-    }
-    if (BoneBuffer && BoneSRV)
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    if (SUCCEEDED(Graphics->DeviceContext->Map(PrimitiveBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource)))
     {
-        int BoneCount = BoneGizmos.Num();
-        UpdateBonesBuffer(BoneBuffer, BoneGizmos, BoneCount);
+        PrimitiveStream.Pack(MappedResource.pData, Layout);
+        Graphics->DeviceContext->Unmap(PrimitiveBuffer, 0);
     }
 }
 
-void UPrimitiveDrawBatch::UpdateLinePrimitiveCountBuffer(int NumBoundingBoxes, int NumCones, int NumBones) const
+void UPrimitiveDrawBatch::UpdateLinePrimitiveCountBuffer(const FDebugPrimitiveLayout& Layout) const
 {
     D3D11_MAPPED_SUBRESOURCE MappedResource;
     HRESULT HR = Graphics->DeviceContext->Map(LinePrimitiveBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
+    if (FAILED(HR))
+    {
+        return;
+    }
     auto Data = static_cast<FPrimitiveCounts*>(MappedResource.pData);
-    Data->BoundingBoxCount = NumBoundingBoxes;
-    Data->ConeCount = NumCones;
-    Data->BoneCount = NumBones;
+    Data->BoundingBoxCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::AABB)]);
+    Data->ConeCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Cone)]);
+    Data->OBBCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::OBB)]);
+    Data->BoneCount = static_cast<int>(Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Bone)]);
+    Data->BoundingBoxOffset = Layout.Offsets[static_cast<uint32>(EDebugPrimitiveType::AABB)];
+    Data->ConeOffset = Layout.Offsets[static_cast<uint32>(EDebugPrimitiveType::Cone)];
+    Data->OBBOffset = Layout.Offsets[static_cast<uint32>(EDebugPrimitiveType::OBB)];
+    Data->BoneOffset = Layout.Offsets[static_cast<uint32>(EDebugPrimitiveType::Bone)];
+    Data->ConeSegmentCount = ConeSegmentCount;
     Graphics->DeviceContext->Unmap(LinePrimitiveBuffer, 0);
 }
 
 // 5. 릴리즈 함수들
-void UPrimitiveDrawBatch::ReleaseBoundingBoxBuffers()
-{
-    if (BoundingBoxBuffer)
-    {
-        BoundingBoxBuffer->Release();
-        BoundingBoxBuffer = nullptr;
-    }
-    if (BoundingBoxSRV)
-    {
-        BoundingBoxSRV->Release();
-        BoundingBoxSRV = nullptr;
-    }
-}
-
-void UPrimitiveDrawBatch::ReleaseConeBuffers()
-{
-    if (ConesBuffer)
-    {
-        ConesBuffer->Release();
-        ConesBuffer = nullptr;
-    }
-    if (ConeSRV)
-    {
-        ConeSRV->Release();
-        ConeSRV = nullptr;
-    }
-}
-
-void UPrimitiveDrawBatch::ReleaseOBBBuffers()
-{
-    if (OBBBuffer)
-    {
-        OBBBuffer->Release();
-        OBBBuffer = nullptr;
-    }
-    if (OBBSRV)
-    {
-        OBBSRV->Release();
-        OBBSRV = nullptr;
-    }
-}
-
-void UPrimitiveDrawBatch::ReleaseBoneBuffers()
+void UPrimitiveDrawBatch::ReleasePrimitiveBuffer()
 {
-    if (BoneBuffer)
+    if (PrimitiveBuffer)
     {
-        BoneBuffer->Release();
-        BoneBuffer = nullptr;
+        PrimitiveBuffer->Release();
+        PrimitiveBuffer = nullptr;
     }
-    if (BoneSRV)
+    if (PrimitiveSRV)
     {
-        BoneSRV->Release();
-        BoneSRV = nullptr;
+        PrimitiveSRV->Release();
+        PrimitiveSRV = nullptr;
     }
+    Stats.BufferCapacityWords = 0;
 }
 
 // 6. 프리미티브 렌더링 관련 함수
 void UPrimitiveDrawBatch::AddAABBToBatch(const FBoundingBox& LocalAABB, const FVector& Center, const FMatrix& ModelMatrix)
 {
-    FVector LocalVertices[8] = {
-        { LocalAABB.min.X, LocalAABB.min.Y, LocalAABB.min.Z },
-        { LocalAABB.max.X, LocalAABB.min.Y, LocalAABB.min.Z },
-        { LocalAABB.min.X, LocalAABB.max.Y, LocalAABB.min.Z },
-        { LocalAABB.max.X, LocalAABB.max.Y, LocalAABB.min.Z },
-        { LocalAABB.min.X, LocalAABB.min.Y, LocalAABB.max.Z },
-        { LocalAABB.max.X, LocalAABB.min.Y, LocalAABB.max.Z },
-        { LocalAABB.min.X, LocalAABB.max.Y, LocalAABB.max.Z },
-        { LocalAABB.max.X, LocalAABB.max.Y, LocalAABB.max.Z }
-    };
-
-    FVector WorldVertices[8];
-    WorldVertices[0] = Center + FMatrix::TransformVector(LocalVertices[0], ModelMatrix);
+    // ModelMatrix의 회전 / 스케일에 이동 대신 Center를 더한 것과 같음
+    FMatrix CenteredMatrix = ModelMatrix;
+    CenteredMatrix.M[3][0] = Center.X;
+    CenteredMatrix.M[3][1] = Center.Y;
+    CenteredMatrix.M[3][2] = Center.Z;
+    CenteredMatrix.M[3][3] = 1.0f;
 
-    FVector Min = WorldVertices[0], Max = WorldVertices[0];
+    FVector Min, Max;
+    FMathBatch::TransformAABB(CenteredMatrix, LocalAABB.min, LocalAABB.max, Min, Max);
 
-    for (int i = 1; i < 8; ++i)
-    {
-        WorldVertices[i] = Center + FMatrix::TransformVector(LocalVertices[i], ModelMatrix);
-        Min.X = (WorldVertices[i].X < Min.X) ? WorldVertices[i].X : Min.X;
-        Min.Y = (WorldVertices[i].Y < Min.Y) ? WorldVertices[i].Y : Min.Y;
-        Min.Z = (WorldVertices[i].Z < Min.Z) ? WorldVertices[i].Z : Min.Z;
-        Max.X = (WorldVertices[i].X > Max.X) ? WorldVertices[i].X : Max.X;
-        Max.Y = (WorldVertices[i].Y > Max.Y) ? WorldVertices[i].Y : Max.Y;
-        Max.Z = (WorldVertices[i].Z > Max.Z) ? WorldVertices[i].Z : Max.Z;
-    }
-    FBoundingBox BoundingBox;
-    BoundingBox.min = Min;
-    BoundingBox.max = Max;
-    BoundingBoxes.Add(BoundingBox);
+    FDebugAABBRecord* Record = PrimitiveStream.Reserve<FDebugAABBRecord>(1);
+    Record->Box.min = Min;
+    Record->Box.max = Max;
 }
 
 void UPrimitiveDrawBatch::AddOBBToBatch(const FBoundingBox& LocalAABB, const FVector& Center, const FMatrix& ModelMatrix)
@@ -309,19 +210,18 @@ void UPrimitiveDrawBatch::AddOBBToBatch(const FBoundingBox& LocalAABB, const FVe
         { LocalAABB.max.X, LocalAABB.max.Y, LocalAABB.max.Z }
     };
 
-    FOBB OBB;
+    FDebugOBBRecord* Record = PrimitiveStream.Reserve<FDebugOBBRecord>(1);
     for (int i = 0; i < 8; ++i)
     {
-        OBB.corners[i] = Center + FMatrix::TransformVector(LocalVertices[i], ModelMatrix);
+        Record->OBB.corners[i] = Center + FMatrix::TransformVector(LocalVertices[i], ModelMatrix);
     }
-    OrientedBoundingBoxes.Add(OBB);
 }
 
 void UPrimitiveDrawBatch::AddConeToBatch(const FVector& Center, float Radius, float Height, int Segments, const FVector4& Color, const FMatrix& ModelMatrix)
 {
     ConeSegmentCount = Segments;
     FVector LocalApex = FVector(0, 0, 0);
-    FCone Cone;
+    FCone& Cone = PrimitiveStream.Reserve<FDebugConeRecord>(1)->Cone;
     Cone.ConeApex = Center + FMatrix::TransformVector(LocalApex, ModelMatrix);
     FVector LocalBaseCenter = FVector(Height, 0, 0);
     Cone.ConeBaseCenter = Center + FMatrix::TransformVector(LocalBaseCenter, ModelMatrix);
@@ -329,17 +229,14 @@ void UPrimitiveDrawBatch::AddConeToBatch(const FVector& Center, float Radius, fl
     Cone.ConeHeight = Height / 1000;
     Cone.Color = Color;
     Cone.ConeSegmentCount = ConeSegmentCount;
-    Cones.Add(Cone);
 }
 
 // FIX-ME
 void UPrimitiveDrawBatch::AddJointSphereToBatch(const FVector& JointWorldPosition, float Radius, const FVector4& Color, const FMatrix& ModelMatrix)
 {
-    FBoneGizmo Gizmo;
+    FBoneGizmo& Gizmo = PrimitiveStream.Reserve<FDebugBoneRecord>(1)->Bone;
     Gizmo.Center = JointWorldPosition;
     Gizmo.Color = Color;
-
-    BoneGizmos.Add(Gizmo);
 }
 
 // 7. 버퍼 생성 함수들
@@ -375,170 +272,40 @@ ID3D11Buffer* UPrimitiveDrawBatch::CreateStaticVertexBuffer() const
     return Buffer;
 }
 
-ID3D11Buffer* UPrimitiveDrawBatch::CreateBoundingBoxBuffer(UINT NumBoundingBoxes) const
-{
-    D3D11_BUFFER_DESC BufferDesc;
-    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    BufferDesc.ByteWidth = sizeof(FBoundingBox) * NumBoundingBoxes;
-    BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    BufferDesc.StructureByteStride = sizeof(FBoundingBox);
-
-    ID3D11Buffer* Buffer = nullptr;
-    Graphics->Device->CreateBuffer(&BufferDesc, nullptr, &Buffer);
-    return Buffer;
-}
-
-ID3D11Buffer* UPrimitiveDrawBatch::CreateOBBBuffer(UINT NumBoundingBoxes) const
-{
-    D3D11_BUFFER_DESC BufferDesc;
-    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    BufferDesc.ByteWidth = sizeof(FOBB) * NumBoundingBoxes;
-    BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    BufferDesc.StructureByteStride = sizeof(FOBB);
-
-    ID3D11Buffer* Buffer = nullptr;
-    Graphics->Device->CreateBuffer(&BufferDesc, nullptr, &Buffer);
-    return Buffer;
-}
-
-ID3D11Buffer* UPrimitiveDrawBatch::CreateConeBuffer(UINT NumCones) const
+bool UPrimitiveDrawBatch::CreatePrimitiveBuffer(uint32 NumWords)
 {
-    D3D11_BUFFER_DESC BufferDesc;
-    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    BufferDesc.ByteWidth = sizeof(FCone) * NumCones;
-    BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    BufferDesc.StructureByteStride = sizeof(FCone);
+    ReleasePrimitiveBuffer();
 
-    ID3D11Buffer* Buffer = nullptr;
-    Graphics->Device->CreateBuffer(&BufferDesc, nullptr, &Buffer);
-    return Buffer;
-}
-
-ID3D11Buffer* UPrimitiveDrawBatch::CreateBoneBuffer(UINT NumBones) const
-{
-    D3D11_BUFFER_DESC BufferDesc;
+    D3D11_BUFFER_DESC BufferDesc = {};
     BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    BufferDesc.ByteWidth = sizeof(FBoneGizmo) * NumBones;
+    BufferDesc.ByteWidth = NumWords * FDebugPrimitiveStream::WordSize;
     BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
     BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
-    BufferDesc.StructureByteStride = sizeof(FBoneGizmo);
-
-    ID3D11Buffer* Buffer = nullptr;
-    Graphics->Device->CreateBuffer(&BufferDesc, nullptr, &Buffer);
-    return Buffer;
-}
-
-// 8. SRV 생성 함수들
-ID3D11ShaderResourceView* UPrimitiveDrawBatch::CreateBoundingBoxSRV(ID3D11Buffer* Buffer, UINT NumBoundingBoxes)
-{
-    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc;
-    SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
-    SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-    SRVDesc.Buffer.ElementOffset = 0;
-    SRVDesc.Buffer.NumElements = NumBoundingBoxes;
-
-    Graphics->Device->CreateShaderResourceView(Buffer, &SRVDesc, &BoundingBoxSRV);
-    return BoundingBoxSRV;
-}
-
-ID3D11ShaderResourceView* UPrimitiveDrawBatch::CreateOBBSRV(ID3D11Buffer* Buffer, UINT NumBoundingBoxes)
-{
-    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc;
-    SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
-    SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-    SRVDesc.Buffer.ElementOffset = 0;
-    SRVDesc.Buffer.NumElements = NumBoundingBoxes;
-
-    Graphics->Device->CreateShaderResourceView(Buffer, &SRVDesc, &OBBSRV);
-    return OBBSRV;
-}
+    BufferDesc.StructureByteStride = FDebugPrimitiveStream::WordSize;
 
-ID3D11ShaderResourceView* UPrimitiveDrawBatch::CreateConeSRV(ID3D11Buffer* Buffer, UINT NumCones)
-{
-    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc;
-    SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
-    SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-    SRVDesc.Buffer.ElementOffset = 0;
-    SRVDesc.Buffer.NumElements = NumCones;
-
-    Graphics->Device->CreateShaderResourceView(Buffer, &SRVDesc, &ConeSRV);
-    return ConeSRV;
-}
+    if (FAILED(Graphics->Device->CreateBuffer(&BufferDesc, nullptr, &PrimitiveBuffer)))
+    {
+        UE_LOG(LogLevel::Error, "Failed to create debug primitive buffer (%u words)", NumWords);
+        return false;
+    }
 
-ID3D11ShaderResourceView* UPrimitiveDrawBatch::CreateBoneSRV(ID3D11Buffer* Buffer, UINT NumBones)
-{
-    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc;
+    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
     SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
     SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
     SRVDesc.Buffer.ElementOffset = 0;
-    SRVDesc.Buffer.NumElements = NumBones;
-
-    Graphics->Device->CreateShaderResourceView(Buffer, &SRVDesc, &BoneSRV);
-    return BoneSRV;
-}
+    SRVDesc.Buffer.NumElements = NumWords;
 
-// 9. 버퍼 업데이트 (데이터 복사) 함수들
-void UPrimitiveDrawBatch::UpdateBoundingBoxBuffer(ID3D11Buffer* Buffer, const TArray<FBoundingBox>& BoundingBoxes, int NumBoundingBoxes) const
-{
-    if (!Buffer)
-        return;
-    D3D11_MAPPED_SUBRESOURCE MappedResource;
-    Graphics->DeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-    auto Data = static_cast<FBoundingBox*>(MappedResource.pData);
-    for (int i = 0; i < BoundingBoxes.Num(); ++i)
+    if (FAILED(Graphics->Device->CreateShaderResourceView(PrimitiveBuffer, &SRVDesc, &PrimitiveSRV)))
     {
-        Data[i] = BoundingBoxes[i];
+        UE_LOG(LogLevel::Error, "Failed to create debug primitive SRV (%u words)", NumWords);
+        ReleasePrimitiveBuffer();
+        return false;
     }
-    Graphics->DeviceContext->Unmap(Buffer, 0);
-}
 
-void UPrimitiveDrawBatch::UpdateOBBBuffer(ID3D11Buffer* Buffer, const TArray<FOBB>& OBBs, int NumOBBs) const
-{
-    if (!Buffer)
-        return;
-    D3D11_MAPPED_SUBRESOURCE MappedResource;
-    Graphics->DeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-    auto Data = static_cast<FOBB*>(MappedResource.pData);
-    for (int i = 0; i < OBBs.Num(); ++i)
-    {
-        Data[i] = OBBs[i];
-    }
-    Graphics->DeviceContext->Unmap(Buffer, 0);
-}
-
-void UPrimitiveDrawBatch::UpdateConesBuffer(ID3D11Buffer* Buffer, const TArray<FCone>& Cones, int NumCones) const
-{
-    if (!Buffer)
-        return;
-    D3D11_MAPPED_SUBRESOURCE MappedResource;
-    Graphics->DeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-    auto Data = static_cast<FCone*>(MappedResource.pData);
-    for (int i = 0; i < Cones.Num(); ++i)
-    {
-        Data[i] = Cones[i];
-    }
-    Graphics->DeviceContext->Unmap(Buffer, 0);
-}
-
-void UPrimitiveDrawBatch::UpdateBonesBuffer(ID3D11Buffer* Buffer, const TArray<FBoneGizmo>& Bones, int NumBones) const
-{
-    if (!Buffer)
-        return;
-    D3D11_MAPPED_SUBRESOURCE MappedResource;
-    Graphics->DeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-    auto Data = static_cast<FBoneGizmo*>(MappedResource.pData);
-    for (int i = 0; i < BoneGizmos.Num(); ++i)
-    {
-        Data[i] = BoneGizmos[i];
-    }
-    Graphics->DeviceContext->Unmap(Buffer, 0);
+    Stats.BufferCapacityWords = NumWords;
+    ++Stats.NumBufferCreations;
+    return true;
 }
 
 void UPrimitiveDrawBatch::PrepareLineResources() const
@@ -552,10 +319,7 @@ void UPrimitiveDrawBatch::PrepareLineResources() const
         // 선 프리미티브 버퍼를 Vertex 셰이더에 바인딩 (register b3)
         Graphics->DeviceContext->VSSetConstantBuffers(3, 1, &LinePrimitiveBuffer);
 
-        // BoundingBox, Cone, OBB 데이터 SRV를 각각 등록 (registers 2, 3, 4)
-        Graphics->DeviceContext->VSSetShaderResources(2, 1, &BoundingBoxSRV);
-        Graphics->DeviceContext->VSSetShaderResources(3, 1, &ConeSRV);
-        Graphics->DeviceContext->VSSetShaderResources(4, 1, &OBBSRV);
-        Graphics->DeviceContext->VSSetShaderResources(5, 1, &BoneSRV); // Begin Test
+        // 모든 프리미티브 레코드를 담은 스트림 (register t2)
+        Graphics->DeviceContext->VSSetShaderResources(2, 1, &PrimitiveSRV);
     }
 }
@@ -6,8 +6,23 @@
 #include "Define.h"
 #include <d3d11.h>
 
+#include "Renderer/DebugPrimitiveStream.h"
+
 class FGraphicsDevice;
 
+struct FPrimitiveDrawBatchStats
+{
+    FDebugPrimitiveLayout Layout;       // 마지막으로 그린 프레임
+    uint32 BufferCapacityWords = 0;     // float4 단위
+    int32 NumBufferCreations = 0;
+};
+
+/**
+ * 그리드, 축과 디버그 라인(AABB, Cone, OBB, Bone)을 한 번의 DrawInstanced로 그립니다.
+ *
+ * 프리미티브는 FDebugPrimitiveStream에 모았다가 구조적 버퍼 하나(t2)에 올립니다.
+ * 버퍼는 계속 유지하고, 모자랄 때만 2배씩 키워서 다시 만듭니다.
+ */
 class UPrimitiveDrawBatch
 {
 public:
@@ -28,17 +43,11 @@ public:
 
     // 업데이트 함수들
     void UpdateGridConstantBuffer(const FGridParameters& GridParams) const;
-    void UpdateBoundingBoxBuffers();
-    void UpdateConeBuffers();
-    void UpdateOBBBuffers();
-    void UpdateBoneBuffers();
-    void UpdateLinePrimitiveCountBuffer(int NumBoundingBoxes, int NumCones, int NumBones) const;
+    void UpdatePrimitiveBuffer(const FDebugPrimitiveLayout& Layout);
+    void UpdateLinePrimitiveCountBuffer(const FDebugPrimitiveLayout& Layout) const;
 
     // 릴리즈 함수들
-    void ReleaseBoundingBoxBuffers();
-    void ReleaseConeBuffers();
-    void ReleaseOBBBuffers();
-    void ReleaseBoneBuffers();
+    void ReleasePrimitiveBuffer();
 
     // 프리미티브 렌더링 관련
     void AddAABBToBatch(const FBoundingBox& LocalAABB, const FVector& Center, const FMatrix& ModelMatrix);
@@ -46,29 +55,21 @@ public:
     void AddConeToBatch(const FVector& Center, float Radius, float Height, int Segments, const FVector4& Color, const FMatrix& ModelMatrix);
 
     void AddJointSphereToBatch(const FVector& JointWorldPosition, float Radius, const FVector4& Color, const FMatrix& ModelMatrix);
+
+    /** 여러 개를 한 번에 넣을 때 자리를 받아 직접 채웁니다. 머리말은 채워져 있습니다. */
+    template <typename RecordType>
+    RecordType* ReservePrimitives(int32 Count) { return PrimitiveStream.Reserve<RecordType>(Count); }
+
     // 프리미티브 버퍼 생성 함수들
     void CreatePrimitiveBuffers();
     ID3D11Buffer* CreateStaticVertexBuffer() const;
-    ID3D11Buffer* CreateBoundingBoxBuffer(UINT NumBoundingBoxes) const;
-    ID3D11Buffer* CreateOBBBuffer(UINT NumBoundingBoxes) const;
-    ID3D11Buffer* CreateConeBuffer(UINT NumCones) const;
-    ID3D11Buffer* CreateBoneBuffer(UINT NumBones) const;
-
-    // SRV 생성 함수들
-    ID3D11ShaderResourceView* CreateBoundingBoxSRV(ID3D11Buffer* Buffer, UINT NumBoundingBoxes);
-    ID3D11ShaderResourceView* CreateOBBSRV(ID3D11Buffer* Buffer, UINT NumBoundingBoxes);
-    ID3D11ShaderResourceView* CreateConeSRV(ID3D11Buffer* Buffer, UINT NumCones);
-    ID3D11ShaderResourceView* CreateBoneSRV(ID3D11Buffer* Buffer, UINT NumBones);
-
-    // 버퍼 업데이트 (데이터 복사) 함수들
-    void UpdateBoundingBoxBuffer(ID3D11Buffer* Buffer, const TArray<FBoundingBox>& BoundingBoxes, int NumBoundingBoxes) const;
-    void UpdateOBBBuffer(ID3D11Buffer* Buffer, const TArray<FOBB>& OBBs, int NumOBBs) const;
-    void UpdateConesBuffer(ID3D11Buffer* Buffer, const TArray<FCone>& Cones, int NumCones) const;
-    void UpdateBonesBuffer(ID3D11Buffer* Buffer, const TArray<FBoneGizmo>& Bones, int NumBones) const;
+    bool CreatePrimitiveBuffer(uint32 NumWords);
 
     // 파이프라인 관련 (렌더러에서 호출하는 "prepare" 함수)
     void PrepareLineResources() const;
 
+    const FPrimitiveDrawBatchStats& GetStats() const { return Stats; }
+
 private:
     // Graphics 디바이스 (초기화 시 전달받음)
     FGraphicsDevice* Graphics = nullptr;
@@ -77,32 +78,19 @@ private:
     ID3D11Buffer* GridConstantBuffer = nullptr;
     ID3D11Buffer* LinePrimitiveBuffer = nullptr;
 
-    // 쉐이더 리소스 뷰 (SRV)
-    ID3D11ShaderResourceView* BoundingBoxSRV = nullptr;
-    ID3D11ShaderResourceView* ConeSRV = nullptr;
-    ID3D11ShaderResourceView* OBBSRV = nullptr;
-    ID3D11ShaderResourceView* BoneSRV = nullptr;
-
     // 버퍼들
     ID3D11Buffer* VertexBuffer = nullptr;
-    ID3D11Buffer* BoundingBoxBuffer = nullptr;
-    ID3D11Buffer* ConesBuffer = nullptr;
-    ID3D11Buffer* OBBBuffer = nullptr;
-    ID3D11Buffer* BoneBuffer = nullptr;
 
-    // 할당된 용량 추적
-    size_t AllocatedBoundingBoxCapacity = 0;
-    size_t AllocatedConeCapacity = 0;
-    size_t AllocatedOBBCapacity = 0;
-    size_t AllocatedBoneCapacity = 0;
+    // 모든 프리미티브 레코드를 담는 StructuredBuffer<float4> (t2)
+    ID3D11Buffer* PrimitiveBuffer = nullptr;
+    ID3D11ShaderResourceView* PrimitiveSRV = nullptr;
 
     // 프리미티브 데이터 컨테이너
-    TArray<FBoundingBox> BoundingBoxes;
-    TArray<FOBB> OrientedBoundingBoxes;
-    TArray<FCone> Cones;
-    TArray<FBoneGizmo> BoneGizmos;
+    FDebugPrimitiveStream PrimitiveStream;
 
     // 그리드 파라미터 및 추가 데이터
     FGridParameters GridParameters;
     int ConeSegmentCount = 0;
+
+    FPrimitiveDrawBatchStats Stats;
 };
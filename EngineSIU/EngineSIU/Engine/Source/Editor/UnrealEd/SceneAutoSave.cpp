@@ -0,0 +1,583 @@
+#include "SceneAutoSave.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include "Level.h"
+#include "SceneBinary.h"
+#include "WindowsPlatformTime.h"
+#include "Container/Map.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryArchive.h"
+#include "Stats/Stats.h"
+#include "World/World.h"
+
+
+namespace
+{
+    const std::filesystem::path AutoSaveDirectory = "Saved/AutoSaves";
+
+    /** 쓰기 Job이 실패했을 때의 WriteResultJournalBytes. Worker에서는 로그를 남기지 않고 게임 스레드에서 알립니다. */
+    constexpr int64 WriteFailed = -1;
+
+    void WriteJournalHeader(TArray<uint8>& OutBytes, const FString& LevelPath)
+    {
+        FMemoryWriter Ar(OutBytes);
+        uint32 FileMagic = SceneJournal::Magic;
+        uint32 FileVersion = SceneJournal::Version;
+        FString Path = LevelPath;
+        Ar << FileMagic << FileVersion << Path;
+    }
+
+    void WriteEntry(TArray<uint8>& OutBytes, SceneJournal::EEntryKind Kind, const FString& ActorID, const TArray<uint8>* ActorScene)
+    {
+        // FMemoryWriter는 항상 버퍼 끝에 덧붙이므로, 크기 자리만 먼저 쓰고 Entry가 끝난 뒤 버퍼에 직접 채움
+        FMemoryWriter Ar(OutBytes);
+        const int32 EntryStart = OutBytes.Num();
+
+        uint32 EntrySize = 0;
+        uint8 KindValue = static_cast<uint8>(Kind);
+        FString ID = ActorID;
+        Ar << EntrySize << KindValue << ID;
+        if (ActorScene)
+        {
+            Ar.SaveData(ActorScene->GetData(), ActorScene->Num());
+        }
+
+        EntrySize = static_cast<uint32>(OutBytes.Num() - EntryStart - sizeof(uint32));
+        FPlatformMemory::Memcpy(OutBytes.GetData() + EntryStart, &EntrySize, sizeof(uint32));
+    }
+
+    bool WriteFile(const std::filesystem::path& FilePath, const TArray<uint8>& Bytes, bool bTruncate)
+    {
+        std::ofstream File(FilePath, std::ios::binary | (bTruncate ? std::ios::trunc : std::ios::app));
+        if (!File)
+        {
+            return false;
+        }
+        File.write(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num());
+        return File.good();
+    }
+
+    /**
+     * 저널을 액터마다 최신 Entry 하나만 남기도록 다시 씁니다.
+     * 임시 파일에 모두 쓴 뒤 바꿔치기하므로, 중간에 실패해도 원래 저널은 그대로 남습니다.
+     */
+    bool CompactJournal(const std::filesystem::path& JournalPath, int64& OutJournalBytes)
+    {
+        SceneJournal::FContents Contents;
+        if (!SceneJournal::ReadJournal(JournalPath, Contents))
+        {
+            return false;
+        }
+
+        TArray<uint8> Bytes;
+        WriteJournalHeader(Bytes, Contents.LevelPath);
+        for (int32 Index = 0; Index < Contents.ActorIDs.Num(); ++Index)
+        {
+            WriteEntry(Bytes, SceneJournal::EEntryKind::Upsert, Contents.ActorIDs[Index], &Contents.ActorScenes[Index]);
+        }
+
+        std::filesystem::path TempPath = JournalPath;
+        TempPath += ".tmp";
+        if (!WriteFile(TempPath, Bytes, true))
+        {
+            return false;
+        }
+
+        std::error_code Error;
+        std::filesystem::rename(TempPath, JournalPath, Error);
+        if (Error)
+        {
+            return false;
+        }
+
+        OutJournalBytes = Bytes.Num();
+        return true;
+    }
+
+    std::filesystem::path GetRecoveryPath(const std::filesystem::path& JournalPath)
+    {
+        std::filesystem::path RecoveryPath = JournalPath;
+        RecoveryPath.replace_extension(".recovery.journal");
+        return RecoveryPath;
+    }
+
+    /** 이미 복구 저널이 있을 때 덮어쓰지 않도록 시각을 붙인 경로. <Level>_<Hash>.<초>.recovery.journal */
+    std::filesystem::path GetTimestampedRecoveryPath(const std::filesystem::path& JournalPath)
+    {
+        const int64 Seconds = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count();
+
+        std::filesystem::path RecoveryPath = JournalPath;
+        RecoveryPath.replace_extension("." + std::to_string(Seconds) + ".recovery.journal");
+        return RecoveryPath;
+    }
+
+    /** 이름이 같은 Level이라도 경로가 다르면 다른 저널을 쓰도록 경로를 해시합니다. (FNV-1a, 실행마다 같은 값) */
+    uint32 HashLevelPath(const FString& LevelPath)
+    {
+        uint32 Hash = 2166136261u;
+        const uint8* Bytes = reinterpret_cast<const uint8*>(GetData(LevelPath));
+        const int32 NumBytes = LevelPath.Len() * static_cast<int32>(sizeof(*GetData(LevelPath)));
+        for (int32 Index = 0; Index < NumBytes; ++Index)
+        {
+            Hash = (Hash ^ Bytes[Index]) * 16777619u;
+        }
+        return Hash;
+    }
+}
+
+bool SceneJournal::ReadJournal(const std::filesystem::path& FilePath, FContents& OutContents)
+{
+    OutContents = FContents();
+
+    std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    TArray<uint8> Data;
+    const int64 Size = File.tellg();
+    Data.SetNum(static_cast<int32>(Size));
+    File.seekg(0, std::ios::beg);
+    File.read(reinterpret_cast<char*>(Data.GetData()), Size);
+    File.close();
+
+    struct FLatestEntry
+    {
+        int64 SceneOffset = 0;
+        int64 SceneSize = 0;
+    };
+    TMap<FString, FLatestEntry> LatestEntries;
+    TArray<FString> Order;
+    TSet<FString> Ordered;
+
+    FMemoryReader Reader(Data);
+    FArchive& Ar = Reader;
+    try
+    {
+        uint32 FileMagic = 0;
+        uint32 FileVersion = 0;
+        Ar << FileMagic << FileVersion;
+        if (FileMagic != Magic || FileVersion > Version)
+        {
+            return false;
+        }
+        Ar << OutContents.LevelPath;
+
+        while (Ar.Tell() + static_cast<int64>(sizeof(uint32)) <= Data.Num())
+        {
+            uint32 EntrySize = 0;
+            Ar << EntrySize;
+            const int64 EntryEnd = Ar.Tell() + EntrySize;
+            if (EntryEnd > Data.Num())
+            {
+                // 쓰는 도중에 종료되어 잘린 Entry
+                break;
+            }
+
+            uint8 Kind = 0;
+            FString ActorID;
+            Ar << Kind << ActorID;
+
+            if (static_cast<EEntryKind>(Kind) == EEntryKind::Upsert)
+            {
+                LatestEntries.Add(ActorID, { Ar.Tell(), EntryEnd - Ar.Tell() });
+                if (!Ordered.Contains(ActorID))
+                {
+                    Ordered.Add(ActorID);
+                    Order.Add(ActorID);
+                }
+            }
+            else
+            {
+                LatestEntries.Remove(ActorID);
+            }
+
+            ++OutContents.NumEntries;
+            Ar.Seek(EntryEnd);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // 헤더가 잘렸거나 마지막 Entry 중간에서 잘림. 읽은 데까지만 사용
+        if (OutContents.NumEntries == 0 && LatestEntries.Num() == 0)
+        {
+            return false;
+        }
+    }
+
+    OutContents.ActorIDs.Reserve(LatestEntries.Num());
+    OutContents.ActorScenes.Reserve(LatestEntries.Num());
+    for (const FString& ActorID : Order)
+    {
+        const FLatestEntry* Entry = LatestEntries.Find(ActorID);
+        if (Entry == nullptr)
+        {
+            continue;
+        }
+
+        TArray<uint8>& Scene = OutContents.ActorScenes[OutContents.ActorScenes.Emplace()];
+        Scene.SetNum(static_cast<int32>(Entry->SceneSize));
+        FPlatformMemory::Memcpy(Scene.GetData(), Data.GetData() + Entry->SceneOffset, Entry->SceneSize);
+        OutContents.ActorIDs.Add(ActorID);
+    }
+    return true;
+}
+
+FSceneAutoSave::~FSceneAutoSave()
+{
+    Shutdown(false);
+}
+
+void FSceneAutoSave::Tick(UWorld* InWorld, float DeltaTime)
+{
+    ULevel* Level = InWorld ? InWorld->GetActiveLevel() : nullptr;
+    if (Level == nullptr)
+    {
+        UpdateWriteJob();
+        return;
+    }
+
+    if (JournalPath.empty() || !(Level->GetLevelPath() == LevelPath))
+    {
+        BeginJournal(Level);
+    }
+    else if (bJournalWriteFailed)
+    {
+        // 일부만 쓰였을 수 있으므로 저널을 처음부터 다시 씀
+        ResetJournal(Level);
+    }
+
+    if (!bCapturing)
+    {
+        TimeSinceLastPass += DeltaTime;
+        if (!bPassRequested && TimeSinceLastPass < IntervalSeconds)
+        {
+            UpdateWriteJob();
+            return;
+        }
+
+        bPassRequested = false;
+        bCapturing = true;
+        Cursor = 0;
+        PassFrames = 0;
+        PassCaptureMs = 0.0;
+    }
+
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(SceneAutoSave_Capture)
+
+        const uint64 FrameStartCycles = FPlatformTime::Cycles64();
+        const bool bPassComplete = CaptureDirtyActors(Level, FrameStartCycles);
+        if (bPassComplete)
+        {
+            CaptureRemovedActors(Level);
+        }
+
+        const double FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStartCycles);
+        ++PassFrames;
+        PassCaptureMs += FrameMs;
+        Stats.MaxFrameCaptureMs = FMath::Max(Stats.MaxFrameCaptureMs, FrameMs);
+
+        if (bPassComplete)
+        {
+            bCapturing = false;
+            TimeSinceLastPass = 0.0f;
+            ++Stats.NumPasses;
+            Stats.LastPassFrames = PassFrames;
+            Stats.LastPassCaptureMs = PassCaptureMs;
+        }
+    }
+
+    UpdateWriteJob();
+}
+
+void FSceneAutoSave::Shutdown(bool bDeleteJournal)
+{
+    // 남은 Entry까지 모두 쓴 뒤 종료
+    FlushWrites();
+
+    if (bDeleteJournal && !JournalPath.empty())
+    {
+        std::error_code Error;
+        std::filesystem::remove(JournalPath, Error);
+    }
+}
+
+bool FSceneAutoSave::BuildRecoveryScene(TArray<uint8>& OutSceneData, FString& OutLevelPath)
+{
+    // 현재 저널을 읽는 경우를 위해 쓰기를 먼저 마침
+    FlushWrites();
+
+    std::filesystem::path SourcePath = GetRecoveryPath(JournalPath);
+    if (JournalPath.empty() || !std::filesystem::exists(SourcePath))
+    {
+        SourcePath = JournalPath;
+    }
+
+    SceneJournal::FContents Contents;
+    if (SourcePath.empty() || !SceneJournal::ReadJournal(SourcePath, Contents))
+    {
+        UE_LOG(LogLevel::Warning, "AutoSave: no journal to restore");
+        return false;
+    }
+
+    if (!SceneBinary::MergeScenes(Contents.ActorScenes, OutSceneData))
+    {
+        UE_LOG(LogLevel::Error, "AutoSave: journal is corrupted: %s", SourcePath.string().c_str());
+        return false;
+    }
+
+    OutLevelPath = Contents.LevelPath;
+    UE_LOG(
+        LogLevel::Display, "AutoSave: restoring %d actors from %d journal entries: %s",
+        Contents.ActorIDs.Num(), Contents.NumEntries, SourcePath.string().c_str()
+    );
+    return true;
+}
+
+void FSceneAutoSave::BeginJournal(ULevel* Level)
+{
+    // 이전 Level의 남은 Entry는 이전 저널에 써야 하므로 먼저 마침
+    FlushWrites();
+
+    LevelPath = Level->GetLevelPath();
+
+    char HashText[16];
+    std::snprintf(HashText, sizeof(HashText), "_%08x", HashLevelPath(LevelPath));
+    JournalPath = AutoSaveDirectory / (GetData(Level->GetLevelName()) + std::string(HashText) + ".journal");
+
+    std::error_code Error;
+    std::filesystem::create_directories(AutoSaveDirectory, Error);
+
+    // 정상 종료라면 저널이 지워져 있으므로, 남아 있는 저널은 저장되지 않은 변경일 수 있음
+    if (std::filesystem::exists(JournalPath))
+    {
+        // 아직 복구하지 않은 이전 복구 저널이 있으면 덮어쓰지 않고 시각을 붙여 따로 보관
+        std::filesystem::path RecoveryPath = GetRecoveryPath(JournalPath);
+        if (std::filesystem::exists(RecoveryPath))
+        {
+            RecoveryPath = GetTimestampedRecoveryPath(JournalPath);
+        }
+
+        Error.clear();
+        if (!std::filesystem::exists(RecoveryPath))
+        {
+            std::filesystem::rename(JournalPath, RecoveryPath, Error);
+        }
+        else
+        {
+            Error = std::make_error_code(std::errc::file_exists);
+        }
+
+        if (Error)
+        {
+            // 옮기지 못한 저널은 지우지 않고, 이번 세션은 다른 이름의 저널에 기록
+            UE_LOG(
+                LogLevel::Error, "AutoSave: could not keep the previous journal %s (%s), it is left untouched",
+                JournalPath.string().c_str(), Error.message().c_str()
+            );
+            const int64 Seconds = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()
+            ).count();
+            JournalPath.replace_extension("." + std::to_string(Seconds) + ".journal");
+        }
+        else
+        {
+            UE_LOG(
+                LogLevel::Warning, "AutoSave: found a journal from a previous session, kept as %s (\"autosave restore\" to load it)",
+                RecoveryPath.string().c_str()
+            );
+        }
+    }
+
+    ResetJournal(Level);
+    bPassRequested = true;
+}
+
+void FSceneAutoSave::ResetJournal(ULevel* Level)
+{
+    // 새 저널은 Level 전체로 시작
+    for (AActor* Actor : Level->Actors)
+    {
+        Actor->MarkDirty();
+    }
+    JournaledActors.Empty();
+
+    bCapturing = false;
+    Cursor = 0;
+
+    // 헤더와 잘라내기 표시는 쓰기가 성공한 뒤에만 지움 (UpdateWriteJob)
+    PendingBytes.Empty();
+    WriteJournalHeader(PendingBytes, LevelPath);
+    bTruncateOnNextWrite = true;
+    bJournalWriteFailed = false;
+    LastCompactedBytes = 0;
+    Stats.JournalBytes = 0;
+}
+
+bool FSceneAutoSave::CaptureDirtyActors(ULevel* Level, uint64 FrameStartCycles)
+{
+    TArray<AActor*> ActorToWrite;
+    ActorToWrite.Add(nullptr);
+    TArray<uint8> ActorScene;
+
+    const TArray<AActor*>& Actors = Level->Actors;
+    while (Cursor < Actors.Num())
+    {
+        AActor* Actor = Actors[Cursor++];
+
+        bool bWrote = false;
+        if (Actor && Actor->IsDirty() && !Actor->IsActorBeingDestroyed())
+        {
+            ActorToWrite[0] = Actor;
+            FSceneBinaryWriter::WriteActors(ActorToWrite, ActorScene);
+            AppendEntry(SceneJournal::EEntryKind::Upsert, Actor->GetName(), &ActorScene);
+
+            JournaledActors.Add(Actor->GetFName());
+            Actor->ClearDirty();
+            ++Stats.NumUpserts;
+            bWrote = true;
+        }
+
+        // 바뀌지 않은 액터는 거의 비용이 없으므로 시간은 가끔만 확인
+        if ((bWrote || (Cursor % 256) == 0)
+            && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStartCycles) >= CaptureBudgetMs)
+        {
+            break;
+        }
+    }
+
+    // 검사 도중 액터가 지워져 인덱스가 당겨지면 한두 개를 건너뛸 수 있지만, Dirty가 남아 있으므로 다음 검사에서 기록됨
+    return Cursor >= Actors.Num();
+}
+
+void FSceneAutoSave::CaptureRemovedActors(ULevel* Level)
+{
+    if (JournaledActors.Num() == 0)
+    {
+        return;
+    }
+
+    // 검사 중에 인덱스가 바뀔 수 있으므로, 검사에서 본 액터가 아니라 지금 Level에 있는 액터와 비교
+    TSet<FName> LevelActors;
+    LevelActors.Reserve(Level->Actors.Num());
+    for (AActor* Actor : Level->Actors)
+    {
+        if (Actor && !Actor->IsActorBeingDestroyed())
+        {
+            LevelActors.Add(Actor->GetFName());
+        }
+    }
+
+    for (const FName& ActorName : JournaledActors.Array())
+    {
+        if (!LevelActors.Contains(ActorName))
+        {
+            AppendEntry(SceneJournal::EEntryKind::Remove, ActorName.ToString(), nullptr);
+            JournaledActors.Remove(ActorName);
+            ++Stats.NumRemoves;
+        }
+    }
+}
+
+void FSceneAutoSave::AppendEntry(SceneJournal::EEntryKind Kind, const FString& ActorID, const TArray<uint8>* ActorScene)
+{
+    WriteEntry(PendingBytes, Kind, ActorID, ActorScene);
+}
+
+void FSceneAutoSave::UpdateWriteJob()
+{
+    if (bWriteInFlight)
+    {
+        if (!WriteCounter.IsDone())
+        {
+            return;
+        }
+        bWriteInFlight = false;
+
+        if (WriteResultJournalBytes == WriteFailed)
+        {
+            // 헤더가 빠졌거나 Entry가 잘렸을 수 있으므로, 다음 Tick에 ResetJournal로 다시 시작
+            UE_LOG(LogLevel::Error, "AutoSave: failed to write %s", JournalPath.string().c_str());
+            bJournalWriteFailed = true;
+        }
+        else
+        {
+            Stats.JournalBytes = WriteResultJournalBytes;
+            if (bTruncateInFlight)
+            {
+                bTruncateOnNextWrite = false;
+            }
+        }
+        bTruncateInFlight = false;
+
+        if (bCompactionInFlight && WriteResultCompactionMs >= 0.0)
+        {
+            ++Stats.NumCompactions;
+            Stats.LastCompactionMs = WriteResultCompactionMs;
+            LastCompactedBytes = Stats.JournalBytes;
+        }
+        bCompactionInFlight = false;
+    }
+
+    if (PendingBytes.Num() == 0 || JournalPath.empty() || bJournalWriteFailed)
+    {
+        return;
+    }
+
+    const bool bTruncate = bTruncateOnNextWrite;
+    const int64 StartJournalBytes = bTruncate ? 0 : Stats.JournalBytes;
+    const int64 CompactionThreshold = FMath::Max(MinCompactionBytes, LastCompactedBytes * CompactionGrowthFactor);
+    const bool bCompact = StartJournalBytes + PendingBytes.Num() > CompactionThreshold;
+
+    bTruncateInFlight = bTruncate;
+    bWriteInFlight = true;
+    bCompactionInFlight = bCompact;
+
+    static TStatId StatId(TEXT("SceneAutoSave_Write"));
+
+    TArray<uint8> Bytes = std::move(PendingBytes);
+    PendingBytes.Empty();
+
+    FJobSystem::Get().Dispatch(StatId, [this, Bytes = std::move(Bytes), Path = JournalPath, bTruncate, bCompact, StartJournalBytes]()
+    {
+        if (!WriteFile(Path, Bytes, bTruncate))
+        {
+            WriteResultJournalBytes = WriteFailed;
+            WriteResultCompactionMs = -1.0;
+            return;
+        }
+
+        int64 JournalBytes = StartJournalBytes + Bytes.Num();
+        double CompactionMs = -1.0;
+        if (bCompact)
+        {
+            const uint64 CompactionStartCycles = FPlatformTime::Cycles64();
+            if (CompactJournal(Path, JournalBytes))
+            {
+                CompactionMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CompactionStartCycles);
+            }
+        }
+
+        WriteResultJournalBytes = JournalBytes;
+        WriteResultCompactionMs = CompactionMs;
+    }, &WriteCounter);
+}
+
+void FSceneAutoSave::FlushWrites()
+{
+    while (bWriteInFlight || PendingBytes.Num() > 0)
+    {
+        UpdateWriteJob();
+        if (bWriteInFlight)
+        {
+            FJobSystem::Get().Wait(WriteCounter);
+        }
+    }
+}
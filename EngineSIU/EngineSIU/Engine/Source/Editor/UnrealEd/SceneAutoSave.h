@@ -0,0 +1,168 @@
+#pragma once
+#include <filesystem>
+
+#include "Async/JobSystem.h"
+#include "Container/Array.h"
+#include "Container/Set.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "UObject/NameTypes.h"
+
+class ULevel;
+class UWorld;
+
+
+/**
+ * 자동 저장 저널 파일 구조 (Version 1)
+ *
+ *   uint32 Magic, uint32 Version, FString LevelPath
+ *   Entry[...]      파일 끝까지. 마지막 Entry가 잘려 있으면 무시
+ *
+ *   Entry = uint32 EntrySize, uint8 EEntryKind, FString ActorID, (Upsert만) 액터 하나짜리 바이너리 씬
+ *
+ * 같은 ActorID의 Entry는 뒤에 있는 것이 최신입니다.
+ */
+namespace SceneJournal
+{
+    constexpr uint32 Magic = 0x4A554953; // "SIUJ"
+    constexpr uint32 Version = 1;
+
+    enum class EEntryKind : uint8
+    {
+        Upsert,     // 액터가 추가되었거나 바뀜
+        Remove,     // 액터가 지워짐
+    };
+
+    /** 저널을 끝까지 읽어 액터마다 최신 상태만 남긴 결과 */
+    struct FContents
+    {
+        FString LevelPath;
+
+        // 처음 기록된 순서. 지워진 액터는 들어 있지 않음
+        TArray<FString> ActorIDs;
+        TArray<TArray<uint8>> ActorScenes;
+
+        int32 NumEntries = 0;
+    };
+
+    bool ReadJournal(const std::filesystem::path& FilePath, FContents& OutContents);
+}
+
+struct FSceneAutoSaveStats
+{
+    int32 NumPasses = 0;
+    int32 LastPassFrames = 0;           // 마지막 검사가 나눠 실행된 프레임 수
+    double LastPassCaptureMs = 0.0;     // 마지막 검사의 게임 스레드 시간 합
+    double MaxFrameCaptureMs = 0.0;     // 한 프레임에 게임 스레드에서 쓴 가장 긴 시간
+
+    int32 NumUpserts = 0;
+    int32 NumRemoves = 0;
+
+    int64 JournalBytes = 0;
+    int32 NumCompactions = 0;
+    double LastCompactionMs = 0.0;      // Worker 스레드 시간
+};
+
+/**
+ * 에디터 World의 증분 자동 저장
+ *
+ * 일정 간격마다 Level의 액터를 훑어 IsDirty인 액터만 바이너리 씬으로 만들어 저널(Saved/AutoSaves/<Level>_<경로 해시>.journal)에 덧붙입니다.
+ *   - 게임 스레드에서는 CaptureBudgetMs 안에서만 액터를 직렬화하고, 남은 액터는 다음 프레임에 이어서 훑습니다.
+ *   - 파일 쓰기는 Job System의 Worker에서 하며, 쓰기 Job은 한 번에 하나만 실행됩니다. 그동안 만든 Entry는 모아 두었다가 다음 Job에 넘깁니다.
+ *   - 저널이 커지면 쓰기 Job이 이어서 액터마다 최신 Entry만 남기도록 저널을 다시 씁니다. (Compaction)
+ *
+ * 시작할 때 남아 있던 저널(비정상 종료 등)은 .recovery.journal로 옮겨 두며, UEditorEngine::RestoreAutoSave로 불러올 수 있습니다.
+ * 복구 저널이 이미 있으면 덮어쓰지 않고 시각을 붙인 이름으로 보관합니다.
+ */
+class FSceneAutoSave
+{
+public:
+    FSceneAutoSave() = default;
+    ~FSceneAutoSave();
+
+    FSceneAutoSave(const FSceneAutoSave&) = delete;
+    FSceneAutoSave& operator=(const FSceneAutoSave&) = delete;
+
+    /** 게임 스레드에서 매 프레임 호출합니다. */
+    void Tick(UWorld* InWorld, float DeltaTime);
+
+    /** 다음 Tick에 간격과 상관없이 검사를 시작합니다. */
+    void RequestPass() { bPassRequested = true; }
+
+    /**
+     * 진행 중인 쓰기를 기다립니다.
+     * @param bDeleteJournal 정상 종료처럼 저널이 더 이상 필요 없으면 true
+     */
+    void Shutdown(bool bDeleteJournal);
+
+    /**
+     * 복구 저널(없으면 현재 저널)을 액터 전체가 들어 있는 바이너리 씬 하나로 합칩니다.
+     * @param OutLevelPath 저널을 기록할 때의 Level 경로
+     */
+    bool BuildRecoveryScene(TArray<uint8>& OutSceneData, FString& OutLevelPath);
+
+    const FSceneAutoSaveStats& GetStats() const { return Stats; }
+    bool IsCapturing() const { return bCapturing; }
+
+    float IntervalSeconds = 10.0f;
+    double CaptureBudgetMs = 1.0;
+
+    /** 저널이 마지막 Compaction 결과의 이 배수보다 커지면 다시 Compaction */
+    int64 CompactionGrowthFactor = 2;
+    int64 MinCompactionBytes = 1 << 20;
+
+private:
+    /** Level이 바뀌면 새 저널을 시작합니다. */
+    void BeginJournal(ULevel* Level);
+
+    /** Level 전체를 Dirty로 표시하고 헤더부터 저널을 다시 씁니다. */
+    void ResetJournal(ULevel* Level);
+
+    /** Cursor부터 시간 예산 안에서 Dirty 액터를 직렬화합니다. 한 바퀴를 다 돌았으면 true */
+    bool CaptureDirtyActors(ULevel* Level, uint64 FrameStartCycles);
+
+    /** 검사를 마칠 때 저널에는 있지만 Level에는 없는 액터의 Remove Entry를 씁니다. */
+    void CaptureRemovedActors(ULevel* Level);
+
+    void AppendEntry(SceneJournal::EEntryKind Kind, const FString& ActorID, const TArray<uint8>* ActorScene);
+
+    /** 쓰기 Job이 끝났으면 결과를 반영하고, 모아 둔 Entry가 있으면 새 쓰기 Job을 띄웁니다. */
+    void UpdateWriteJob();
+
+    /** 쓰기 Job과 모아 둔 Entry를 모두 파일에 쓸 때까지 기다립니다. */
+    void FlushWrites();
+
+private:
+    std::filesystem::path JournalPath;
+    FString LevelPath;
+
+    // 저널에 살아 있는 것으로 기록된 액터
+    TSet<FName> JournaledActors;
+
+    // 검사 진행 상태
+    bool bCapturing = false;
+    bool bPassRequested = false;
+    float TimeSinceLastPass = 0.0f;
+    int32 Cursor = 0;
+    int32 PassFrames = 0;
+    double PassCaptureMs = 0.0;
+
+    // 아직 쓰기 Job에 넘기지 않은 Entry
+    TArray<uint8> PendingBytes;
+    bool bTruncateOnNextWrite = false;
+
+    // 쓰기가 실패하면 다음 Tick에 ResetJournal할 때까지 새 쓰기를 띄우지 않음
+    bool bJournalWriteFailed = false;
+
+    // 쓰기 Job. Counter가 끝난 뒤에만 게임 스레드에서 아래 결과를 읽음
+    FJobCounter WriteCounter;
+    bool bWriteInFlight = false;
+    bool bCompactionInFlight = false;
+    bool bTruncateInFlight = false;
+    int64 WriteResultJournalBytes = 0;
+    double WriteResultCompactionMs = 0.0;
+
+    int64 LastCompactedBytes = 0;
+
+    FSceneAutoSaveStats Stats;
+};
@@ -0,0 +1,579 @@
+#include "SceneBinary.h"
+
+#include <fstream>
+
+#include "Level.h"
+#include "WindowsPlatformTime.h"
+#include "Components/SceneComponent.h"
+#include "Container/Map.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryArchive.h"
+#include "UObject/Casts.h"
+#include "UObject/Class.h"
+#include "World/World.h"
+
+
+namespace
+{
+    // FMemoryWriter는 항상 버퍼 끝에 덧붙이므로, 크기 자리만 먼저 쓰고 블록이 끝난 뒤 버퍼에 직접 채움
+    int32 BeginSizedBlock(FArchive& Ar, const TArray<uint8>& Data)
+    {
+        uint32 Placeholder = 0;
+        Ar << Placeholder;
+        return Data.Num();
+    }
+
+    void EndSizedBlock(TArray<uint8>& Data, int32 BlockStart)
+    {
+        const uint32 Size = static_cast<uint32>(Data.Num() - BlockStart);
+        FPlatformMemory::Memcpy(Data.GetData() + BlockStart - sizeof(uint32), &Size, sizeof(uint32));
+    }
+
+    struct FClassTable
+    {
+        struct FEntry
+        {
+            UClass* Class;
+            TArray<FFieldDesc> Schema;
+        };
+
+        TArray<FEntry> Entries;
+        TMap<UClass*, int32> Indices;
+
+        /** 처음 보는 클래스면 새 항목을 만들고 bOutIsNew를 true로 설정합니다. */
+        int32 FindOrAdd(UClass* Class, bool& bOutIsNew)
+        {
+            if (const int32* Found = Indices.Find(Class))
+            {
+                bOutIsNew = false;
+                return *Found;
+            }
+            bOutIsNew = true;
+            const int32 Index = Entries.Add({ Class, {} });
+            Indices.Add(Class, Index);
+            return Index;
+        }
+    };
+
+    void WriteObject(FArchive& Ar, TArray<uint8>& Data, FClassTable& ClassTable, UObject* Object, int32 ClassIndex, bool bIsNewClass)
+    {
+        // 클래스를 처음 쓸 때만 필드 이름/타입을 기록해서 스키마로 사용
+        TArray<FFieldDesc>* OutSchema = bIsNewClass ? &ClassTable.Entries[ClassIndex].Schema : nullptr;
+
+        const int32 BlockStart = BeginSizedBlock(Ar, Data);
+        FFieldArchive FieldAr(Ar, OutSchema);
+        Object->SerializeFields(FieldAr);
+        EndSizedBlock(Data, BlockStart);
+    }
+
+    void WriteHeader(FArchive& Ar)
+    {
+        uint32 FileMagic = SceneBinary::Magic;
+        uint32 FileVersion = SceneBinary::Version;
+        Ar << FileMagic << FileVersion;
+    }
+
+    void WriteClassEntry(FArchive& Ar, FString ClassName, TArray<FFieldDesc>& Schema)
+    {
+        int32 NumFields = Schema.Num();
+        Ar << ClassName << NumFields;
+        for (FFieldDesc& Field : Schema)
+        {
+            uint8 Type = static_cast<uint8>(Field.Type);
+            Ar << Field.Name << Type;
+        }
+    }
+
+    bool IsSameSchema(const TArray<FFieldDesc>& A, const TArray<FFieldDesc>& B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < A.Num(); ++Index)
+        {
+            if (A[Index].Type != B[Index].Type || !(A[Index].Name == B[Index].Name))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** 크기가 붙은 필드 블록을 해석하지 않고 SourceAr에서 DestAr로 복사합니다. */
+    void CopyFieldsBlock(FArchive& SourceAr, const TArray<uint8>& SourceData, FArchive& DestAr)
+    {
+        uint32 FieldsSize = 0;
+        SourceAr << FieldsSize;
+
+        const int64 FieldsStart = SourceAr.Tell();
+        if (FieldsStart + FieldsSize > SourceData.Num())
+        {
+            throw std::runtime_error("Fields block exceeds the end of the scene.");
+        }
+
+        DestAr << FieldsSize;
+        DestAr.SaveData(SourceData.GetData() + FieldsStart, FieldsSize);
+        SourceAr.Seek(FieldsStart + FieldsSize);
+    }
+}
+
+bool SceneBinary::IsBinarySceneFile(const std::filesystem::path& FilePath)
+{
+    std::ifstream File(FilePath, std::ios::binary);
+    uint32 FileMagic = 0;
+    if (!File.read(reinterpret_cast<char*>(&FileMagic), sizeof(FileMagic)))
+    {
+        return false;
+    }
+    return FileMagic == Magic;
+}
+
+void FSceneBinaryWriter::WriteWorld(const UWorld& InWorld, TArray<uint8>& OutData)
+{
+    WriteActors(InWorld.GetActiveLevel()->Actors, OutData);
+}
+
+void FSceneBinaryWriter::WriteActors(const TArray<AActor*>& InActors, TArray<uint8>& OutData)
+{
+    // 클래스 테이블은 액터를 모두 쓴 뒤에야 완성되므로, 본문을 먼저 따로 씀
+    TArray<uint8> Body;
+    FMemoryWriter BodyAr(Body);
+    FClassTable ClassTable;
+
+    for (AActor* Actor : InActors)
+    {
+        const int32 RecordStart = BeginSizedBlock(BodyAr, Body);
+
+        bool bIsNewClass = false;
+        int32 ActorClassIndex = ClassTable.FindOrAdd(Actor->GetClass(), bIsNewClass);
+        FString ActorID = Actor->GetName();
+        FString ActorLabel = Actor->GetActorLabel();
+
+        // 부착 관계는 이름 대신 액터 안의 컴포넌트 인덱스로 저장
+        TArray<UActorComponent*> Components = Actor->GetComponents().Array();
+        TMap<UActorComponent*, int32> ComponentIndices;
+        for (int32 Index = 0; Index < Components.Num(); ++Index)
+        {
+            ComponentIndices.Add(Components[Index], Index);
+        }
+
+        int32 RootComponentIndex = INDEX_NONE;
+        if (const int32* Found = ComponentIndices.Find(Actor->GetRootComponent()))
+        {
+            RootComponentIndex = *Found;
+        }
+
+        BodyAr << ActorClassIndex << ActorID << ActorLabel << RootComponentIndex;
+        WriteObject(BodyAr, Body, ClassTable, Actor, ActorClassIndex, bIsNewClass);
+
+        int32 NumComponents = Components.Num();
+        BodyAr << NumComponents;
+        for (UActorComponent* Component : Components)
+        {
+            int32 ComponentClassIndex = ClassTable.FindOrAdd(Component->GetClass(), bIsNewClass);
+            FString ComponentID = Component->GetName();
+
+            int32 AttachParentIndex = INDEX_NONE;
+            if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+            {
+                if (const int32* Found = ComponentIndices.Find(SceneComponent->GetAttachParent()))
+                {
+                    AttachParentIndex = *Found;
+                }
+            }
+
+            BodyAr << ComponentClassIndex << ComponentID << AttachParentIndex;
+            WriteObject(BodyAr, Body, ClassTable, Component, ComponentClassIndex, bIsNewClass);
+        }
+
+        EndSizedBlock(Body, RecordStart);
+    }
+
+    // 헤더 + 클래스 테이블 + 액터 수 + 본문
+    OutData.Empty();
+    FMemoryWriter Ar(OutData);
+    WriteHeader(Ar);
+
+    int32 NumClasses = ClassTable.Entries.Num();
+    Ar << NumClasses;
+    for (FClassTable::FEntry& Entry : ClassTable.Entries)
+    {
+        WriteClassEntry(Ar, Entry.Class->GetName(), Entry.Schema);
+    }
+
+    int32 NumActors = InActors.Num();
+    Ar << NumActors;
+    Ar.SaveData(Body.GetData(), Body.Num());
+}
+
+bool SceneBinary::MergeScenes(const TArray<TArray<uint8>>& InScenes, TArray<uint8>& OutData)
+{
+    struct FMergedClass
+    {
+        FString ClassName;
+        TArray<FFieldDesc> Schema;
+    };
+    TArray<FMergedClass> MergedClasses;
+
+    TArray<uint8> Body;
+    FMemoryWriter BodyAr(Body);
+    int32 NumMergedActors = 0;
+
+    try
+    {
+        for (const TArray<uint8>& Scene : InScenes)
+        {
+            FMemoryReader Reader(Scene);
+            FArchive& Ar = Reader;
+
+            uint32 FileMagic = 0;
+            uint32 FileVersion = 0;
+            Ar << FileMagic << FileVersion;
+            if (FileMagic != Magic || FileVersion > Version)
+            {
+                return false;
+            }
+
+            // 이 씬의 클래스 인덱스 -> 합친 테이블의 인덱스
+            int32 NumClasses = 0;
+            Ar << NumClasses;
+            TArray<int32> ClassRemap;
+            ClassRemap.SetNum(NumClasses);
+            for (int32& MergedIndex : ClassRemap)
+            {
+                FMergedClass Class;
+                int32 NumFields = 0;
+                Ar << Class.ClassName << NumFields;
+                Class.Schema.SetNum(NumFields);
+                for (FFieldDesc& Field : Class.Schema)
+                {
+                    uint8 Type = 0;
+                    Ar << Field.Name << Type;
+                    Field.Type = static_cast<EFieldType>(Type);
+                }
+
+                MergedIndex = INDEX_NONE;
+                for (int32 Index = 0; Index < MergedClasses.Num() && MergedIndex == INDEX_NONE; ++Index)
+                {
+                    if (MergedClasses[Index].ClassName == Class.ClassName && IsSameSchema(MergedClasses[Index].Schema, Class.Schema))
+                    {
+                        MergedIndex = Index;
+                    }
+                }
+                if (MergedIndex == INDEX_NONE)
+                {
+                    MergedIndex = MergedClasses.Add(std::move(Class));
+                }
+            }
+
+            auto RemapClassIndex = [&ClassRemap](int32 ClassIndex)
+            {
+                return (ClassIndex >= 0 && ClassIndex < ClassRemap.Num()) ? ClassRemap[ClassIndex] : INDEX_NONE;
+            };
+
+            int32 NumActors = 0;
+            Ar << NumActors;
+            for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+            {
+                uint32 RecordSize = 0;
+                Ar << RecordSize;
+                const int64 RecordEnd = Ar.Tell() + RecordSize;
+
+                const int32 RecordStart = BeginSizedBlock(BodyAr, Body);
+
+                int32 ActorClassIndex = INDEX_NONE;
+                FString ActorID;
+                FString ActorLabel;
+                int32 RootComponentIndex = INDEX_NONE;
+                Ar << ActorClassIndex << ActorID << ActorLabel << RootComponentIndex;
+                ActorClassIndex = RemapClassIndex(ActorClassIndex);
+                BodyAr << ActorClassIndex << ActorID << ActorLabel << RootComponentIndex;
+                CopyFieldsBlock(Ar, Scene, BodyAr);
+
+                int32 NumComponents = 0;
+                Ar << NumComponents;
+                BodyAr << NumComponents;
+                for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+                {
+                    int32 ComponentClassIndex = INDEX_NONE;
+                    FString ComponentID;
+                    int32 AttachParentIndex = INDEX_NONE;
+                    Ar << ComponentClassIndex << ComponentID << AttachParentIndex;
+                    ComponentClassIndex = RemapClassIndex(ComponentClassIndex);
+                    BodyAr << ComponentClassIndex << ComponentID << AttachParentIndex;
+                    CopyFieldsBlock(Ar, Scene, BodyAr);
+                }
+
+                EndSizedBlock(Body, RecordStart);
+                Ar.Seek(RecordEnd);
+                ++NumMergedActors;
+            }
+        }
+    }
+    catch (const std::exception& Exception)
+    {
+        UE_LOG(LogLevel::Error, "Binary scene merge failed (%s)", Exception.what());
+        return false;
+    }
+
+    OutData.Empty();
+    FMemoryWriter Ar(OutData);
+    WriteHeader(Ar);
+
+    int32 NumClasses = MergedClasses.Num();
+    Ar << NumClasses;
+    for (FMergedClass& Class : MergedClasses)
+    {
+        WriteClassEntry(Ar, Class.ClassName, Class.Schema);
+    }
+
+    Ar << NumMergedActors;
+    Ar.SaveData(Body.GetData(), Body.Num());
+    return true;
+}
+
+bool FSceneStreamingLoad::Open(const std::filesystem::path& FilePath, UWorld* InWorld)
+{
+    std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+    if (!File.is_open() || InWorld == nullptr)
+    {
+        UE_LOG(LogLevel::Error, "Failed to open binary scene: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    TArray<uint8> Data;
+    const int64 Size = File.tellg();
+    Data.SetNum(static_cast<int32>(Size));
+    File.seekg(0, std::ios::beg);
+    File.read(reinterpret_cast<char*>(Data.GetData()), Size);
+    File.close();
+
+    if (!OpenFromMemory(std::move(Data), InWorld))
+    {
+        UE_LOG(LogLevel::Error, "Failed to open binary scene: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    World->GetActiveLevel()->SetLevelPath(FilePath);
+    return true;
+}
+
+bool FSceneStreamingLoad::OpenFromMemory(TArray<uint8>&& InData, UWorld* InWorld)
+{
+    World = InWorld;
+    FileData = std::move(InData);
+    Classes.Empty();
+    NumActors = 0;
+    NextActorIndex = 0;
+    NumTicks = 0;
+
+    if (World == nullptr)
+    {
+        return false;
+    }
+
+    try
+    {
+        FMemoryReader Reader(FileData);
+        FArchive& Ar = Reader;
+
+        uint32 FileMagic = 0;
+        uint32 FileVersion = 0;
+        Ar << FileMagic << FileVersion;
+        if (FileMagic != SceneBinary::Magic || FileVersion > SceneBinary::Version)
+        {
+            UE_LOG(LogLevel::Error, "Not a supported binary scene (version %u)", FileVersion);
+            return false;
+        }
+
+        int32 NumClasses = 0;
+        Ar << NumClasses;
+        Classes.SetNum(NumClasses);
+        for (FLoadedClass& LoadedClass : Classes)
+        {
+            int32 NumFields = 0;
+            Ar << LoadedClass.ClassName << NumFields;
+            LoadedClass.Class = UClass::FindClass(FName(LoadedClass.ClassName));
+            if (LoadedClass.Class == nullptr)
+            {
+                UE_LOG(LogLevel::Warning, "Binary scene: class '%s' no longer exists, its objects will be skipped.", *LoadedClass.ClassName);
+            }
+
+            LoadedClass.Schema.SetNum(NumFields);
+            for (FFieldDesc& Field : LoadedClass.Schema)
+            {
+                uint8 Type = 0;
+                Ar << Field.Name << Type;
+                Field.Type = static_cast<EFieldType>(Type);
+            }
+        }
+
+        Ar << NumActors;
+        NextActorOffset = Ar.Tell();
+    }
+    catch (const std::exception& Exception)
+    {
+        UE_LOG(LogLevel::Error, "Corrupted binary scene header (%s)", Exception.what());
+        NumActors = 0;
+        return false;
+    }
+
+    StartCycles = FPlatformTime::Cycles64();
+    return true;
+}
+
+bool FSceneStreamingLoad::Tick(int32 MaxActors, double TimeBudgetMs)
+{
+    if (IsComplete())
+    {
+        return true;
+    }
+
+    const uint64 TickStartCycles = FPlatformTime::Cycles64();
+    ++NumTicks;
+
+    try
+    {
+        FMemoryReader Ar(FileData);
+        for (int32 Count = 0; Count < MaxActors && !IsComplete(); ++Count)
+        {
+            Ar.Seek(NextActorOffset);
+            LoadNextActor(Ar);
+            ++NextActorIndex;
+
+            if (TimeBudgetMs > 0.0 && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TickStartCycles) >= TimeBudgetMs)
+            {
+                break;
+            }
+        }
+    }
+    catch (const std::exception& Exception)
+    {
+        // 파일이 잘린 경우. 이미 만든 액터는 그대로 두고 중단
+        UE_LOG(LogLevel::Error, "Binary scene is corrupted at actor %d (%s), loading stopped.", NextActorIndex, Exception.what());
+        NextActorIndex = NumActors;
+    }
+
+    if (IsComplete())
+    {
+        UE_LOG(
+            LogLevel::Display, "Binary scene loaded: %d actors in %.2f ms over %d frame(s)",
+            NumActors, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles), NumTicks
+        );
+        FileData.Empty();
+        Classes.Empty();
+    }
+    return IsComplete();
+}
+
+void FSceneStreamingLoad::LoadNextActor(FArchive& Ar)
+{
+    uint32 RecordSize = 0;
+    Ar << RecordSize;
+    NextActorOffset = Ar.Tell() + RecordSize;
+
+    int32 ActorClassIndex = INDEX_NONE;
+    FString ActorID;
+    FString ActorLabel;
+    int32 RootComponentIndex = INDEX_NONE;
+    Ar << ActorClassIndex << ActorID << ActorLabel << RootComponentIndex;
+
+    const FLoadedClass* ActorClass = GetLoadedClass(ActorClassIndex);
+    if (ActorClass == nullptr || ActorClass->Class == nullptr)
+    {
+        // 레코드 크기를 알고 있으므로 액터 통째로 건너뜀
+        return;
+    }
+
+    AActor* Actor = World->SpawnActor(ActorClass->Class, FName(ActorID));
+    if (Actor == nullptr)
+    {
+        return;
+    }
+    Actor->SetActorLabel(ActorLabel, false);
+    LoadFields(Ar, Actor, ActorClassIndex);
+
+    int32 NumComponents = 0;
+    Ar << NumComponents;
+
+    TArray<UActorComponent*> Components;
+    TArray<int32> AttachParentIndices;
+    Components.Reserve(NumComponents);
+    AttachParentIndices.Reserve(NumComponents);
+
+    for (int32 Index = 0; Index < NumComponents; ++Index)
+    {
+        int32 ComponentClassIndex = INDEX_NONE;
+        FString ComponentID;
+        int32 AttachParentIndex = INDEX_NONE;
+        Ar << ComponentClassIndex << ComponentID << AttachParentIndex;
+
+        UActorComponent* Component = nullptr;
+        const FLoadedClass* ComponentClass = GetLoadedClass(ComponentClassIndex);
+        if (ComponentClass && ComponentClass->Class)
+        {
+            const FName ComponentName(ComponentID);
+
+            // 생성자에서 만든 기본 컴포넌트는 재사용. 전역 검색(FindObject) 대신 이 액터의 컴포넌트만 확인
+            for (UActorComponent* Existing : Actor->GetComponents())
+            {
+                if (Existing->GetFName() == ComponentName && Existing->GetClass() == ComponentClass->Class)
+                {
+                    Component = Existing;
+                    break;
+                }
+            }
+            if (Component == nullptr)
+            {
+                Component = Actor->AddComponent(ComponentClass->Class, ComponentName, false);
+            }
+        }
+
+        LoadFields(Ar, Component, ComponentClassIndex);
+        Components.Add(Component);
+        AttachParentIndices.Add(AttachParentIndex);
+    }
+
+    if (Components.IsValidIndex(RootComponentIndex))
+    {
+        if (USceneComponent* RootComponent = Cast<USceneComponent>(Components[RootComponentIndex]))
+        {
+            Actor->SetRootComponent(RootComponent);
+        }
+    }
+
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        USceneComponent* SceneComponent = Cast<USceneComponent>(Components[Index]);
+        if (SceneComponent && Components.IsValidIndex(AttachParentIndices[Index]))
+        {
+            if (USceneComponent* Parent = Cast<USceneComponent>(Components[AttachParentIndices[Index]]))
+            {
+                SceneComponent->SetupAttachment(Parent);
+            }
+        }
+    }
+}
+
+void FSceneStreamingLoad::LoadFields(FArchive& Ar, UObject* Object, int32 ClassIndex) const
+{
+    uint32 FieldsSize = 0;
+    Ar << FieldsSize;
+    const int64 FieldsEnd = Ar.Tell() + FieldsSize;
+
+    const FLoadedClass* LoadedClass = GetLoadedClass(ClassIndex);
+    if (Object && LoadedClass)
+    {
+        FFieldArchive FieldAr(Ar, LoadedClass->Schema);
+        Object->SerializeFields(FieldAr);
+    }
+
+    // 읽지 않은 필드가 있어도 다음 블록 시작으로 맞춤
+    Ar.Seek(FieldsEnd);
+}
+
+const FSceneStreamingLoad::FLoadedClass* FSceneStreamingLoad::GetLoadedClass(int32 ClassIndex) const
+{
+    return Classes.IsValidIndex(ClassIndex) ? &Classes[ClassIndex] : nullptr;
+}
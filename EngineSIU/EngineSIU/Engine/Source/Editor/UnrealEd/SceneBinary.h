@@ -0,0 +1,124 @@
+#pragma once
+#include <filesystem>
+
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Serialization/FieldArchive.h"
+
+class AActor;
+class FArchive;
+class UClass;
+class UObject;
+class UWorld;
+
+
+/**
+ * 바이너리 씬 파일 구조 (Version 1)
+ *
+ *   uint32 Magic, uint32 Version
+ *   int32  NumClasses,  Class[NumClasses]
+ *   int32  NumActors,   Actor[NumActors]
+ *
+ *   Class     = FString ClassName, int32 NumFields, { FString FieldName, uint8 EFieldType }[NumFields]
+ *   Actor     = uint32 RecordSize, int32 ClassIndex, FString ActorID, FString ActorLabel, int32 RootComponentIndex,
+ *               Fields, int32 NumComponents, Component[NumComponents]
+ *   Component = int32 ClassIndex, FString ComponentID, int32 AttachParentIndex, Fields
+ *   Fields    = uint32 FieldsSize, SerializeFields가 클래스 스키마 순서대로 쓴 값
+ *
+ * 필드 이름과 타입은 클래스 테이블에 한 번만 저장되고, 객체마다 값만 저장됩니다.
+ * 액터 레코드와 필드 블록에는 크기가 있으므로, 지금 없는 클래스는 통째로 건너뛸 수 있습니다.
+ */
+namespace SceneBinary
+{
+    constexpr uint32 Magic = 0x42554953; // "SIUB"
+    constexpr uint32 Version = 1;
+
+    /** 바이너리 씬 파일의 확장자. SceneManager가 저장 형식을 고를 때 사용합니다. */
+    constexpr const char* Extension = ".bscene";
+
+    /** 파일의 앞부분이 바이너리 씬 Magic인지 확인합니다. */
+    bool IsBinarySceneFile(const std::filesystem::path& FilePath);
+
+    /**
+     * 여러 바이너리 씬의 액터를 순서대로 이어 붙여 씬 하나로 합칩니다.
+     * 클래스 테이블은 클래스 이름과 스키마가 모두 같은 항목끼리 합치고, 레코드의 클래스 인덱스를 새 테이블에 맞게 바꿉니다.
+     * 필드 블록은 해석하지 않고 그대로 복사합니다.
+     * @return 잘렸거나 형식이 맞지 않는 씬이 있으면 false
+     */
+    bool MergeScenes(const TArray<TArray<uint8>>& InScenes, TArray<uint8>& OutData);
+}
+
+struct FSceneBinaryWriter
+{
+    /** InWorld의 Active Level을 바이너리 씬 형식으로 OutData에 씁니다. */
+    static void WriteWorld(const UWorld& InWorld, TArray<uint8>& OutData);
+
+    /** InActors만 바이너리 씬 형식으로 OutData에 씁니다. 자동 저장은 바뀐 액터를 하나씩 이 형식으로 기록합니다. */
+    static void WriteActors(const TArray<AActor*>& InActors, TArray<uint8>& OutData);
+};
+
+/**
+ * 바이너리 씬 파일을 여러 프레임에 나눠 World에 불러옵니다.
+ *
+ * Open에서 파일 전체를 메모리로 읽고 클래스 테이블만 해석해 둔 뒤,
+ * Tick을 호출할 때마다 정해진 개수 / 시간 안에서 다음 액터들을 만듭니다.
+ * 한 번에 모두 불러오려면 IsComplete가 될 때까지 Tick을 반복하면 됩니다.
+ */
+class FSceneStreamingLoad
+{
+public:
+    /**
+     * 파일을 읽고 헤더와 클래스 테이블을 해석합니다.
+     * @return 바이너리 씬 파일이 아니거나 읽을 수 없으면 false
+     */
+    bool Open(const std::filesystem::path& FilePath, UWorld* InWorld);
+
+    /**
+     * 메모리에 있는 바이너리 씬을 불러옵니다. Level 경로는 바꾸지 않습니다.
+     * @return 바이너리 씬 형식이 아니면 false
+     */
+    bool OpenFromMemory(TArray<uint8>&& InData, UWorld* InWorld);
+
+    /**
+     * 다음 액터들을 만듭니다. MaxActors개를 만들었거나 TimeBudgetMs가 지나면 멈춥니다.
+     * @param TimeBudgetMs 0 이하이면 시간 제한 없음
+     * @return 모든 액터를 불러왔으면 true
+     */
+    bool Tick(int32 MaxActors, double TimeBudgetMs);
+
+    bool IsComplete() const { return NextActorIndex >= NumActors; }
+
+    int32 GetNumActors() const { return NumActors; }
+    int32 GetNumLoadedActors() const { return NextActorIndex; }
+    UWorld* GetWorld() const { return World; }
+
+private:
+    struct FLoadedClass
+    {
+        FString ClassName;
+        UClass* Class = nullptr;            // 지금 없는 클래스면 nullptr
+        TArray<FFieldDesc> Schema;
+    };
+
+    void LoadNextActor(FArchive& Ar);
+
+    /** 필드 블록을 Object에 읽어 들이고, Object가 없으면 블록을 건너뜁니다. */
+    void LoadFields(FArchive& Ar, UObject* Object, int32 ClassIndex) const;
+
+    const FLoadedClass* GetLoadedClass(int32 ClassIndex) const;
+
+private:
+    TArray<uint8> FileData;
+    TArray<FLoadedClass> Classes;
+
+    UWorld* World = nullptr;
+
+    int32 NumActors = 0;
+    int32 NextActorIndex = 0;
+    int64 NextActorOffset = 0;
+
+    // 통계
+    uint64 StartCycles = 0;
+    int32 NumTicks = 0;
+};
@@ -1,5 +1,6 @@
 #include "SceneManager.h"
 #include <fstream>
+#include "SceneBinary.h"
 #include "EditorViewportClient.h"
 #include "Engine/ObjLoader.h"
 #include "Engine/StaticMeshActor.h"
@@ -7,6 +8,7 @@
 #include "UObject/Object.h"
 #include "UObject/ObjectFactory.h"
 #include "UObject/ObjectGlobals.h"
+#include "UObject/UObjectArray.h"
 
 #include "JSON/json.hpp"
 #include "World/World.h"
@@ -108,6 +110,8 @@ struct FSceneData
 
 void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
 {
+    MEMORY_TAG_SCOPE(World);
+
     std::ifstream JsonFile(FilePath);
     if (!JsonFile.is_open())
     {
@@ -163,6 +167,94 @@ bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, co
     return true;
 }
 
+void SceneManager::LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
+{
+    MEMORY_TAG_SCOPE(World);
+
+    FSceneStreamingLoad StreamingLoad;
+    if (!StreamingLoad.Open(FilePath, &OutWorld))
+    {
+        MessageBox(nullptr, (FString(FilePath) + FString("(으)로부터 Scene을 읽어오는데 실패했습니다!")).ToWideString().c_str(), L"Scene Load Error", MB_ICONWARNING | MB_OK);
+        return;
+    }
+
+    // 시간 제한 없이 한 번에 모두 불러옴
+    StreamingLoad.Tick(StreamingLoad.GetNumActors(), 0.0);
+}
+
+bool SceneManager::SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
+{
+    TArray<uint8> Data;
+    FSceneBinaryWriter::WriteWorld(InWorld, Data);
+
+    const std::filesystem::path Dir = std::filesystem::path(FilePath).parent_path();
+    if (!Dir.empty() && !std::filesystem::exists(Dir))
+    {
+        std::filesystem::create_directories(Dir);
+    }
+
+    std::ofstream OutFile(FilePath, std::ios::binary);
+    if (!OutFile)
+    {
+        UE_LOG(LogLevel::Error, "Failed to open file for writing: %s", FilePath.string().c_str());
+        return false;
+    }
+    OutFile.write(reinterpret_cast<const char*>(Data.GetData()), Data.Num());
+    OutFile.close();
+
+    InWorld.GetActiveLevel()->SetLevelPath(FilePath);
+    return true;
+}
+
+void SceneManager::LoadSceneFromFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
+{
+    if (SceneBinary::IsBinarySceneFile(FilePath))
+    {
+        LoadSceneFromBinaryFile(FilePath, OutWorld);
+    }
+    else
+    {
+        LoadSceneFromJsonFile(FilePath, OutWorld);
+    }
+}
+
+bool SceneManager::SaveSceneToFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
+{
+    if (FilePath.extension() == SceneBinary::Extension)
+    {
+        return SaveSceneToBinaryFile(FilePath, InWorld);
+    }
+    return SaveSceneToJsonFile(FilePath, InWorld);
+}
+
+bool SceneManager::ConvertSceneFile(const std::filesystem::path& InPath, const std::filesystem::path& OutPath)
+{
+    if (!std::filesystem::exists(InPath))
+    {
+        UE_LOG(LogLevel::Error, "Scene convert: file not found: %s", InPath.string().c_str());
+        return false;
+    }
+
+    // WorldList에 등록하지 않으므로 Tick되거나 렌더링되지 않음
+    UWorld* TempWorld = UWorld::CreateWorld(nullptr, EWorldType::Inactive, FString("SceneConvert"));
+
+    bool bResult;
+    if (SceneBinary::IsBinarySceneFile(InPath))
+    {
+        LoadSceneFromBinaryFile(InPath, *TempWorld);
+        bResult = SaveSceneToJsonFile(OutPath, *TempWorld);
+    }
+    else
+    {
+        LoadSceneFromJsonFile(InPath, *TempWorld);
+        bResult = SaveSceneToBinaryFile(OutPath, *TempWorld);
+    }
+
+    TempWorld->Release();
+    GUObjectArray.MarkRemoveObject(TempWorld);
+    return bResult;
+}
+
 bool SceneManager::JsonToSceneData(const FString& InJsonString, FSceneData& OutSceneData)
 {
     try
@@ -30,6 +30,28 @@ public:
      */
     static bool SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
 
+    /**
+     * 바이너리 씬 파일을 한 번에 모두 불러옵니다.
+     * 여러 프레임에 나눠 불러오려면 FSceneStreamingLoad를 직접 사용하세요.
+     */
+    static void LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld);
+
+    /** World를 바이너리 씬 형식(SceneBinary.h)으로 저장합니다. */
+    static bool SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
+
+    /** 파일 앞부분을 보고 Json / 바이너리 중 맞는 형식으로 불러옵니다. */
+    static void LoadSceneFromFile(const std::filesystem::path& FilePath, UWorld& OutWorld);
+
+    /** 확장자가 SceneBinary::Extension이면 바이너리, 아니면 Json 형식으로 저장합니다. */
+    static bool SaveSceneToFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
+
+    /**
+     * Json 씬은 바이너리로, 바이너리 씬은 Json으로 변환합니다.
+     * 임시 World에 불러온 뒤 반대 형식으로 저장하므로, 현재 에디터 World에는 영향이 없습니다.
+     * @return 변환에 성공했는지 여부
+     */
+    static bool ConvertSceneFile(const std::filesystem::path& InPath, const std::filesystem::path& OutPath);
+
 private:
     /**
      * JSON 문자열을 역직렬화하여 FSceneData를 생성합니다.
@@ -52,14 +74,4 @@ private:
 
     
     static bool LoadWorldFromData(const NS_SceneManagerData::FSceneData& sceneData, const std::filesystem::path& ScenePath, UWorld* targetWorld);
-
-private:
-    // TODO: IFileManager::Get().CreateFileReader() & Writer() 만들면 여기에 추가
-    // static void DeserializeFromBinary(const void* Data, int64 Size, NS_SceneManagerData::FSceneData& OutSceneData);
-    // or 중간 구조체 사용 안할경우
-    // static UWorld* DeserializeFromBinary(const void* Data, int64 Size);
-
-    // static TArray<uint8> SerializeToBinary(const NS_SceneManagerData::FSceneData& SceneData);
-    // or 중간 구조체 사용 안할경우
-    // static TArray<uint8> SerializeToBinary(UWorld* World);
 };
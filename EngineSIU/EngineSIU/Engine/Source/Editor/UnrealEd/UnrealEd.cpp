@@ -7,6 +7,8 @@
 
 void UnrealEd::Initialize()
 {
+    MEMORY_TAG_SCOPE(UI);
+
     auto ControlPanel = std::make_shared<ControlEditorPanel>();
     Panels["ControlPanel"] = ControlPanel;
     
@@ -29,35 +29,6 @@ void AEnemyCharacter::Tick(float DeltaTime)
     Super::Tick(DeltaTime);
 }
 
-void AEnemyCharacter::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("Health"), std::to_string(Health));
-    OutProperties.Add(TEXT("Speed"), std::to_string(Speed));
-    OutProperties.Add(TEXT("Damage"), std::to_string(Damage));
-}
-
-void AEnemyCharacter::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Health"));
-    if (TempStr)
-    {
-        Health = std::stof(GetData(*TempStr));
-    }
-    TempStr = InProperties.Find(TEXT("Speed"));
-    if (TempStr)
-    {
-        Speed = std::stof(GetData(*TempStr));
-    }
-    TempStr = InProperties.Find(TEXT("Damage"));
-    if (TempStr)
-    {
-        Damage = std::stof(GetData(*TempStr));
-    }
-}
-
 void AEnemyCharacter::OnBeginOverlap(AActor* OtherActor)
 {
     if (OtherActor == this)
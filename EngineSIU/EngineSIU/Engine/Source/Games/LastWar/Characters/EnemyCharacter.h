@@ -10,14 +10,6 @@ public:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
 
-    /**
-        * 해당 액터의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-        * 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
-        */
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
-
-    /** 저장된 Properties 맵에서 액터의 상태를 복원합니다. */
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
     void OnBeginOverlap(AActor* OtherActor);
 
     // === Lua 관련 ===
@@ -67,35 +67,6 @@ void APlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
     PlayerInputComponent->BindAxis("MoveRight", [this](float Value) { MoveRight(Value); });
 }
 
-void APlayerCharacter::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("Health"), std::to_string(Health));
-    OutProperties.Add(TEXT("Speed"), std::to_string(Speed));
-    OutProperties.Add(TEXT("AttackDamage"), std::to_string(AttackDamage));
-}
-
-void APlayerCharacter::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Health"));
-    if (TempStr)
-    {
-        Health = std::stof(GetData(*TempStr));
-    }
-    TempStr = InProperties.Find(TEXT("Speed"));
-    if (TempStr)
-    {
-        Speed = std::stof(GetData(*TempStr));
-    }
-    TempStr = InProperties.Find(TEXT("AttackDamage"));
-    if (TempStr)
-    {
-        AttackDamage = std::stof(GetData(*TempStr));
-    }
-}
-
 void APlayerCharacter::MoveForward(float Value)
 {
     if (Value != 0.0f)
@@ -197,14 +168,14 @@ AActor* APlayerCharacter::SpawnActorLua(const std::string& ClassName, const FVec
     UClass* SpawnClass = UClass::FindClass(ClassName.c_str());
     if (!SpawnClass)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName.c_str());
         return nullptr;
     }
 
     AActor* NewActor = World->SpawnActor(SpawnClass);
     if (!NewActor)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName.c_str());
         return nullptr;
     }
 
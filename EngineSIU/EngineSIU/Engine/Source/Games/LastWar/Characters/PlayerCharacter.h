@@ -17,15 +17,6 @@ public:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
     virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
-    
-    /**
-    * 해당 액터의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-    * 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
-    */
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
-
-    /** 저장된 Properties 맵에서 액터의 상태를 복원합니다. */
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
 
     // === 이동 관련 ===
     void MoveForward(float Value);
@@ -70,8 +61,9 @@ private:
     UPROPERTY
     (UCameraComponent*, FollowCamera, = nullptr);
     
-    UPROPERTY
-    (int32, CharacterMeshCount, = 0)
+    // StaticMeshComponents 수와 함께 SetCharacterMeshCount로만 바뀌므로 씬 파일에 저장하지 않음
+    UPROPERTY_WITH_FLAGS
+    (Transient, int32, CharacterMeshCount, = 0)
     
     UPROPERTY
     (float, Health, = 100.0f)
@@ -51,23 +51,6 @@ void AWall::Tick(float DeltaTime)
     Super::Tick(DeltaTime);
 }
 
-void AWall::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("Speed"), std::to_string(Speed));
-}
-
-void AWall::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Speed"));
-    if (TempStr)
-    {
-        Speed = std::stof(GetData(*TempStr));
-    }
-}
-
 void AWall::HandleOverlap(AActor* OtherActor)
 {
     if (IsActorBeingDestroyed())  
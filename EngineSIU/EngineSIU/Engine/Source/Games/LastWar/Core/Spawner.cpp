@@ -43,7 +43,7 @@ AActor* ASpawnerActor::SpawnActorLua(const std::string& ClassName, const FVector
 
     if (!SpawnClass)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName.c_str());
         return nullptr;
     }
 
@@ -52,7 +52,7 @@ AActor* ASpawnerActor::SpawnActorLua(const std::string& ClassName, const FVector
 
     if (!NewActor)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName.c_str());
         return nullptr;
     }
 
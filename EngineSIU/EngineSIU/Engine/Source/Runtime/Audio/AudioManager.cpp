@@ -12,6 +12,8 @@ std::unordered_map<EAudioType, FString> AudioManager::AudioMap = {
 
 void AudioManager::Initialize()
 {
+    MEMORY_TAG_SCOPE(Audio);
+
     unsigned int Version;
     FMOD_RESULT result = FMOD::System_Create(&System);
 
@@ -0,0 +1,517 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <immintrin.h>
+
+#include "Container/String.h"
+#include "Stats/CpuProfiler.h"
+#include "Stats/Stats.h"
+
+struct FJob
+{
+    TFunction<void()> Function;
+    FJobCounter* Counter = nullptr;
+    TStatId StatId;
+    EJobAffinity Affinity = EJobAffinity::AnyThread;
+
+    // 꺼내 온 FJobPool의 번호. -1이면 Pool 없이 new로 만든 Job
+    int32 PoolIndex = -1;
+    FJob* NextFree = nullptr;
+};
+
+namespace
+{
+    // 현재 스레드가 소유한 Deque 번호. 게임 스레드 = 0, Worker = 1..N, 그 외 = -1
+    thread_local int32 GQueueIndex = -1;
+
+    // 잠들기 전에 Job을 다시 찾아볼 횟수
+    constexpr int32 NumSpinsBeforeSleep = 64;
+}
+
+//------------------------------------------------------------------------------
+// FJobCounter
+//------------------------------------------------------------------------------
+void FJobCounter::Decrement()
+{
+    NumDecrementing.fetch_add(1, std::memory_order_acquire);
+
+    TArray<FJob*> ReadyJobs;
+    if (Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::scoped_lock Lock(WaitersMutex);
+        std::swap(ReadyJobs, Waiters);
+    }
+
+    // 여기부터 카운터는 소멸되었을 수 있음
+    NumDecrementing.fetch_sub(1, std::memory_order_release);
+
+    for (FJob* Job : ReadyJobs)
+    {
+        FJobSystem::Get().QueueJob(Job);
+    }
+}
+
+bool FJobCounter::AddWaiter(FJob* Job)
+{
+    std::scoped_lock Lock(WaitersMutex);
+    if (Count.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+    Waiters.Add(Job);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// FWorkStealingQueue (Chase-Lev)
+//------------------------------------------------------------------------------
+bool FJobSystem::FWorkStealingQueue::Push(FJob* Job)
+{
+    const int64 B = Bottom.load(std::memory_order_relaxed);
+    const int64 T = Top.load(std::memory_order_acquire);
+    if (B - T >= Capacity)
+    {
+        return false;
+    }
+
+    Jobs[B & (Capacity - 1)].store(Job, std::memory_order_relaxed);
+    Bottom.store(B + 1, std::memory_order_release);
+    return true;
+}
+
+FJob* FJobSystem::FWorkStealingQueue::Pop()
+{
+    const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+    Bottom.store(B, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64 T = Top.load(std::memory_order_relaxed);
+
+    if (T > B)
+    {
+        // 비어 있음
+        Bottom.store(B + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    FJob* Job = Jobs[B & (Capacity - 1)].load(std::memory_order_relaxed);
+    if (T == B)
+    {
+        // 마지막 하나는 Steal과 경쟁
+        if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            Job = nullptr;
+        }
+        Bottom.store(B + 1, std::memory_order_relaxed);
+    }
+    return Job;
+}
+
+FJob* FJobSystem::FWorkStealingQueue::Steal()
+{
+    int64 T = Top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64 B = Bottom.load(std::memory_order_acquire);
+    if (T >= B)
+    {
+        return nullptr;
+    }
+
+    FJob* Job = Jobs[T & (Capacity - 1)].load(std::memory_order_relaxed);
+    if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+    return Job;
+}
+
+//------------------------------------------------------------------------------
+// FJobPool
+//------------------------------------------------------------------------------
+FJobSystem::FJobPool::~FJobPool()
+{
+    for (FJob* List : { FreeJobs, ReturnedJobs.exchange(nullptr) })
+    {
+        while (List)
+        {
+            FJob* Next = List->NextFree;
+            delete List;
+            List = Next;
+        }
+    }
+    FreeJobs = nullptr;
+}
+
+FJob* FJobSystem::FJobPool::Allocate()
+{
+    if (!FreeJobs)
+    {
+        FreeJobs = ReturnedJobs.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    if (!FreeJobs)
+    {
+        return new FJob;
+    }
+
+    FJob* Job = FreeJobs;
+    FreeJobs = Job->NextFree;
+    Job->NextFree = nullptr;
+    return Job;
+}
+
+void FJobSystem::FJobPool::Release(FJob* Job, bool bOwnerThread)
+{
+    if (bOwnerThread)
+    {
+        Job->NextFree = FreeJobs;
+        FreeJobs = Job;
+        return;
+    }
+
+    // 여러 스레드가 넣고 소유 스레드만 통째로 꺼내므로, Push만 CAS로 하면 ABA 문제가 없음
+    FJob* Head = ReturnedJobs.load(std::memory_order_relaxed);
+    do
+    {
+        Job->NextFree = Head;
+    } while (!ReturnedJobs.compare_exchange_weak(Head, Job, std::memory_order_release, std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+// FJobSystem
+//------------------------------------------------------------------------------
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+const TStatId& FJobSystem::GetParallelForStatId()
+{
+    static TStatId StatId(TEXT("ParallelFor"));
+    return StatId;
+}
+
+void FJobSystem::Initialize(int32 InNumWorkers)
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (InNumWorkers < 0)
+    {
+        InNumWorkers = std::max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+    }
+
+    GameThreadId = std::this_thread::get_id();
+    GQueueIndex = 0;
+    bShuttingDown.store(false);
+
+    Queues.Empty();
+    JobPools.Empty();
+    for (int32 Index = 0; Index < InNumWorkers + 1; ++Index)
+    {
+        Queues.Emplace(std::make_unique<FWorkStealingQueue>());
+        JobPools.Emplace(std::make_unique<FJobPool>());
+    }
+
+    NumActiveWorkers.store(InNumWorkers);
+    Workers.reserve(InNumWorkers);
+    for (int32 WorkerIndex = 0; WorkerIndex < InNumWorkers; ++WorkerIndex)
+    {
+        Workers.emplace_back(&FJobSystem::WorkerMain, this, WorkerIndex);
+    }
+
+    bInitialized = true;
+}
+
+void FJobSystem::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // 아직 남은 Job을 게임 스레드에서 마저 처리해서, 기다리는 카운터가 없게 함
+    while (FJob* Job = FindJob(GQueueIndex))
+    {
+        ExecuteJob(Job);
+    }
+    ProcessGameThreadJobs();
+
+    bShuttingDown.store(true);
+    WakeWorkers(true);
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    // Worker가 마지막으로 넣은 Job
+    while (FJob* Job = FindJob(GQueueIndex))
+    {
+        ExecuteJob(Job);
+    }
+    ProcessGameThreadJobs();
+
+    Queues.Empty();
+    JobPools.Empty();
+    NumActiveWorkers.store(0);
+    bInitialized = false;
+}
+
+void FJobSystem::SetNumActiveWorkers(int32 InNumActiveWorkers)
+{
+    NumActiveWorkers.store(std::clamp(InNumActiveWorkers, 0, GetNumWorkers()));
+    WakeWorkers(true);
+}
+
+void FJobSystem::Dispatch(
+    const TStatId& StatId, TFunction<void()> Function, FJobCounter* Counter,
+    FJobCounter* Prerequisite, EJobAffinity Affinity
+)
+{
+    FJob* Job = AllocateJob();
+    Job->Function = std::move(Function);
+    Job->Counter = Counter;
+    Job->StatId = StatId;
+    Job->Affinity = Affinity;
+
+    if (Counter)
+    {
+        Counter->Increment();
+    }
+
+    if (Prerequisite && Prerequisite->AddWaiter(Job))
+    {
+        return;
+    }
+    QueueJob(Job);
+}
+
+FJob* FJobSystem::AllocateJob()
+{
+    // Deque가 없는 스레드이거나 초기화 전이면 Pool 없이 만듦
+    const int32 PoolIndex = GQueueIndex;
+    if (PoolIndex < 0 || PoolIndex >= JobPools.Num())
+    {
+        return new FJob;
+    }
+
+    FJob* Job = JobPools[PoolIndex]->Allocate();
+    Job->PoolIndex = PoolIndex;
+    return Job;
+}
+
+void FJobSystem::ReleaseJob(FJob* Job)
+{
+    Job->Function.Reset();
+    Job->Counter = nullptr;
+
+    // Shutdown으로 Pool이 사라진 뒤에 끝난 Job은 그냥 지움
+    const int32 PoolIndex = Job->PoolIndex;
+    if (PoolIndex < 0 || PoolIndex >= JobPools.Num())
+    {
+        delete Job;
+        return;
+    }
+    JobPools[PoolIndex]->Release(Job, PoolIndex == GQueueIndex);
+}
+
+void FJobSystem::QueueJob(FJob* Job)
+{
+    if (Job->Affinity == EJobAffinity::GameThread)
+    {
+        std::scoped_lock Lock(GameThreadQueueMutex);
+        GameThreadQueue.push_back(Job);
+        return;
+    }
+
+    // 초기화 전이거나 종료 중이면 Worker가 없으므로 바로 실행
+    if (!bInitialized)
+    {
+        ExecuteJob(Job);
+        return;
+    }
+
+    const int32 QueueIndex = GQueueIndex;
+    if (QueueIndex < 0 || QueueIndex >= Queues.Num() || !Queues[QueueIndex]->Push(Job))
+    {
+        std::scoped_lock Lock(SharedQueueMutex);
+        SharedQueue.push_back(Job);
+    }
+
+    NumQueuedJobs.fetch_add(1);
+    if (NumSleepingWorkers.load() > 0)
+    {
+        // 일부 Worker가 쉬는 중이면 notify_one이 쉬는 Worker를 깨울 수 있으므로 모두 깨움
+        WakeWorkers(GetNumActiveWorkers() < GetNumWorkers());
+    }
+}
+
+void FJobSystem::ExecuteJob(FJob* Job)
+{
+    {
+        FScopeCycleCounter CycleCounter(Job->StatId);
+        Job->Function();
+    }
+
+    if (Job->Counter)
+    {
+        Job->Counter->Decrement();
+    }
+    ReleaseJob(Job);
+}
+
+FJob* FJobSystem::FindJob(int32 QueueIndex)
+{
+    const int32 NumQueues = Queues.Num();
+    if (NumQueues == 0)
+    {
+        return nullptr;
+    }
+
+    FJob* Job = nullptr;
+    if (QueueIndex >= 0 && QueueIndex < NumQueues)
+    {
+        Job = Queues[QueueIndex]->Pop();
+    }
+
+    if (!Job)
+    {
+        std::scoped_lock Lock(SharedQueueMutex);
+        if (!SharedQueue.empty())
+        {
+            Job = SharedQueue.front();
+            SharedQueue.pop_front();
+        }
+    }
+
+    if (!Job)
+    {
+        // 매번 같은 Deque부터 훔치지 않도록 자기 다음 번호부터 순회
+        const int32 StartIndex = QueueIndex >= 0 ? QueueIndex + 1 : 0;
+        for (int32 Offset = 0; Offset < NumQueues && !Job; ++Offset)
+        {
+            const int32 VictimIndex = (StartIndex + Offset) % NumQueues;
+            if (VictimIndex != QueueIndex)
+            {
+                Job = Queues[VictimIndex]->Steal();
+            }
+        }
+    }
+
+    if (Job)
+    {
+        NumQueuedJobs.fetch_sub(1);
+    }
+    return Job;
+}
+
+FJob* FJobSystem::PopGameThreadJob()
+{
+    std::scoped_lock Lock(GameThreadQueueMutex);
+    if (GameThreadQueue.empty())
+    {
+        return nullptr;
+    }
+
+    FJob* Job = GameThreadQueue.front();
+    GameThreadQueue.pop_front();
+    return Job;
+}
+
+void FJobSystem::Wait(FJobCounter& Counter)
+{
+    const bool bGameThread = IsInGameThread();
+    while (!Counter.IsDone())
+    {
+        FJob* Job = bGameThread ? PopGameThreadJob() : nullptr;
+        if (!Job)
+        {
+            Job = FindJob(GQueueIndex);
+        }
+
+        if (Job)
+        {
+            ExecuteJob(Job);
+        }
+        else
+        {
+            // 남은 Job이 다른 스레드에서 실행 중
+            _mm_pause();
+        }
+    }
+}
+
+void FJobSystem::ProcessGameThreadJobs()
+{
+    while (FJob* Job = PopGameThreadJob())
+    {
+        ExecuteJob(Job);
+    }
+}
+
+void FJobSystem::WakeWorkers(bool bAll)
+{
+    // Worker가 Predicate를 확인한 뒤 잠들기 직전에 Notify가 사라지지 않도록 Lock을 한 번 거침
+    {
+        std::scoped_lock Lock(SleepMutex);
+    }
+
+    if (bAll)
+    {
+        WakeCondition.notify_all();
+    }
+    else
+    {
+        WakeCondition.notify_one();
+    }
+}
+
+void FJobSystem::WorkerMain(int32 WorkerIndex)
+{
+    GQueueIndex = WorkerIndex + 1;
+    FCpuProfiler::Get().SetCurrentThreadName(FString::Printf(TEXT("Worker %d"), WorkerIndex));
+
+    auto CanRun = [this, WorkerIndex]()
+    {
+        return WorkerIndex < NumActiveWorkers.load(std::memory_order_relaxed);
+    };
+
+    while (!bShuttingDown.load(std::memory_order_relaxed))
+    {
+        if (CanRun())
+        {
+            bool bFoundJob = false;
+            for (int32 Spin = 0; Spin < NumSpinsBeforeSleep; ++Spin)
+            {
+                if (FJob* Job = FindJob(GQueueIndex))
+                {
+                    ExecuteJob(Job);
+                    bFoundJob = true;
+                    break;
+                }
+                _mm_pause();
+            }
+
+            if (bFoundJob)
+            {
+                continue;
+            }
+        }
+
+        std::unique_lock Lock(SleepMutex);
+        NumSleepingWorkers.fetch_add(1);
+        WakeCondition.wait(Lock, [this, &CanRun]()
+        {
+            return bShuttingDown.load() || (CanRun() && NumQueuedJobs.load() > 0);
+        });
+        NumSleepingWorkers.fetch_sub(1);
+    }
+}
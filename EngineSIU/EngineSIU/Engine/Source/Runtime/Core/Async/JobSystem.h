@@ -0,0 +1,203 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Stats/StatDefine.h"
+#include "Templates/Function.h"
+
+enum class EJobAffinity : uint8
+{
+    /** Worker 스레드든 게임 스레드든 먼저 가져가는 쪽이 실행 */
+    AnyThread,
+    /** 게임 스레드에서만 실행. ProcessGameThreadJobs 또는 게임 스레드의 Wait 안에서 처리됩니다. */
+    GameThread,
+};
+
+struct FJob;
+
+/**
+ * Job 완료를 기다리기 위한 카운터 (Fence)
+ *
+ * Dispatch할 때 1 올라가고 Job이 끝나면 1 내려갑니다. 0이면 연결된 Job이 모두 끝난 상태입니다.
+ * 다른 Job의 Prerequisite로 넘기면, 카운터가 0이 되는 순간 그 Job이 큐에 들어갑니다.
+ * Prerequisite로 쓰이는 동안에는 새 Job을 연결해서 재사용하면 안 됩니다.
+ */
+class FJobCounter
+{
+public:
+    FJobCounter() = default;
+    ~FJobCounter() = default;
+
+    FJobCounter(const FJobCounter&) = delete;
+    FJobCounter& operator=(const FJobCounter&) = delete;
+    FJobCounter(FJobCounter&&) = delete;
+    FJobCounter& operator=(FJobCounter&&) = delete;
+
+    /** true가 되면 더 이상 이 카운터를 건드리는 스레드가 없으므로 소멸시켜도 됩니다. */
+    bool IsDone() const
+    {
+        return Count.load(std::memory_order_acquire) == 0 && NumDecrementing.load(std::memory_order_acquire) == 0;
+    }
+    int32 GetCount() const { return Count.load(std::memory_order_acquire); }
+
+private:
+    friend class FJobSystem;
+
+    void Increment() { Count.fetch_add(1, std::memory_order_relaxed); }
+    void Decrement();
+
+    /** 아직 끝나지 않았으면 Job을 대기 목록에 넣고 true, 이미 끝났으면 false */
+    bool AddWaiter(FJob* Job);
+
+private:
+    std::atomic<int32> Count = 0;
+
+    // Decrement 중인 스레드 수. 0이 된 직후 Waiters를 꺼내는 동안 기다리던 쪽이 카운터를 소멸시키지 않게 함
+    std::atomic<int32> NumDecrementing = 0;
+
+    std::mutex WaitersMutex;
+    TArray<FJob*> Waiters;
+};
+
+/**
+ * 고정 크기 Worker Pool 위의 Work-Stealing Job System
+ *
+ * 게임 스레드(0번)와 Worker마다 Chase-Lev Deque를 하나씩 가지고,
+ * 자기 Deque에는 LIFO로 넣고 빼며, 비어 있으면 공용 큐와 다른 스레드의 Deque를 FIFO 쪽에서 훔쳐옵니다.
+ * Job을 기다리는 스레드(Wait)는 잠들지 않고 다른 Job을 대신 실행하므로, Job 안에서 Job을 기다려도 교착되지 않습니다.
+ * 실행되는 Job은 StatId로 CPU 프로파일러 타임라인에 기록됩니다.
+ * Job 객체는 스레드별 Pool에서 재사용하므로, 캡처가 TFunction 내부 버퍼에 들어가면 Dispatch는 힙 할당을 하지 않습니다.
+ */
+class FJobSystem
+{
+public:
+    static FJobSystem& Get();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+    FJobSystem(FJobSystem&&) = delete;
+    FJobSystem& operator=(FJobSystem&&) = delete;
+
+    /**
+     * Worker 스레드를 만듭니다. 게임 스레드에서 호출해야 합니다.
+     * @param InNumWorkers 음수면 (논리 코어 수 - 1)
+     */
+    void Initialize(int32 InNumWorkers = -1);
+
+    /** 남은 Job을 모두 실행한 뒤 Worker 스레드를 종료합니다. */
+    void Shutdown();
+
+    bool IsInitialized() const { return bInitialized; }
+    int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+    /** Job을 가져갈 수 있는 Worker 수를 제한합니다. 나머지 Worker는 잠듭니다. (스케일링 측정용) */
+    void SetNumActiveWorkers(int32 InNumActiveWorkers);
+    int32 GetNumActiveWorkers() const { return NumActiveWorkers.load(std::memory_order_relaxed); }
+
+    /**
+     * Job을 예약합니다. 어느 스레드에서든 호출할 수 있습니다.
+     * @param Counter 완료를 기다릴 카운터. nullptr이면 완료를 추적하지 않습니다.
+     * @param Prerequisite 이 카운터가 0이 된 뒤에 실행
+     */
+    void Dispatch(
+        const TStatId& StatId, TFunction<void()> Function, FJobCounter* Counter = nullptr,
+        FJobCounter* Prerequisite = nullptr, EJobAffinity Affinity = EJobAffinity::AnyThread
+    );
+
+    /** Counter가 0이 될 때까지 다른 Job을 대신 실행하며 기다립니다. */
+    void Wait(FJobCounter& Counter);
+
+    /** GameThread Affinity Job을 모두 실행합니다. 게임 스레드에서 프레임마다 호출합니다. */
+    void ProcessGameThreadJobs();
+
+    bool IsInGameThread() const { return std::this_thread::get_id() == GameThreadId; }
+
+    /** ParallelFor가 띄우는 Job의 Stat 이름 */
+    static const TStatId& GetParallelForStatId();
+
+private:
+    friend class FJobCounter;
+
+    FJobSystem() = default;
+    ~FJobSystem();
+
+    // 소유 스레드만 Push / Pop 하고, 다른 스레드는 Steal만 하는 고정 크기 Deque
+    class FWorkStealingQueue
+    {
+    public:
+        static constexpr int64 Capacity = 4096;    // 2의 거듭제곱이어야 함
+
+        /** 가득 차면 false */
+        bool Push(FJob* Job);
+        FJob* Pop();
+        FJob* Steal();
+
+    private:
+        alignas(64) std::atomic<int64> Top = 0;
+        alignas(64) std::atomic<int64> Bottom = 0;
+        std::atomic<FJob*> Jobs[Capacity] = {};
+    };
+
+    /**
+     * 다 쓴 FJob을 모아 두는 스레드별 Free List
+     * 소유 스레드만 Allocate하고, 다른 스레드가 반납한 Job은 ReturnedJobs에 쌓였다가 소유 스레드가 한꺼번에 가져갑니다.
+     * 줄어들지 않으므로 크기는 그 스레드가 동시에 띄운 Job 수의 최댓값까지 커집니다.
+     */
+    class FJobPool
+    {
+    public:
+        FJobPool() = default;
+        ~FJobPool();
+
+        FJob* Allocate();
+        void Release(FJob* Job, bool bOwnerThread);
+
+    private:
+        FJob* FreeJobs = nullptr;
+        std::atomic<FJob*> ReturnedJobs = nullptr;
+    };
+
+    void WorkerMain(int32 WorkerIndex);
+
+    FJob* AllocateJob();
+    void ReleaseJob(FJob* Job);
+
+    void QueueJob(FJob* Job);
+    void ExecuteJob(FJob* Job);
+
+    /** 자기 Deque → 공용 큐 → 다른 Deque 순서로 실행할 Job을 찾습니다. */
+    FJob* FindJob(int32 QueueIndex);
+    FJob* PopGameThreadJob();
+
+    void WakeWorkers(bool bAll);
+
+private:
+    bool bInitialized = false;
+    std::thread::id GameThreadId;
+
+    TArray<std::unique_ptr<FWorkStealingQueue>> Queues;     // 0 = 게임 스레드, 1.. = Worker
+    TArray<std::unique_ptr<FJobPool>> JobPools;             // Queues와 같은 번호
+    std::vector<std::thread> Workers;
+    std::atomic<int32> NumActiveWorkers = 0;
+
+    // Deque가 없는 스레드에서 넣은 Job, Deque가 가득 찼을 때 넘친 Job
+    std::mutex SharedQueueMutex;
+    std::deque<FJob*> SharedQueue;
+
+    std::mutex GameThreadQueueMutex;
+    std::deque<FJob*> GameThreadQueue;
+
+    // 큐에 들어 있지만 아직 아무도 가져가지 않은 AnyThread Job 수
+    std::atomic<int32> NumQueuedJobs = 0;
+
+    std::mutex SleepMutex;
+    std::condition_variable WakeCondition;
+    std::atomic<int32> NumSleepingWorkers = 0;
+    std::atomic<bool> bShuttingDown = false;
+};
@@ -0,0 +1,216 @@
+#include "JobSystemBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#include "JobSystem.h"
+#include "ParallelFor.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    // 원소 하나에 대한 계산. 최적화로 사라지지 않도록 결과를 누적해서 씀
+    float ComputeElement(int32 Index, int32 NumSteps)
+    {
+        float Value = static_cast<float>(Index & 1023) * 0.001f;
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            Value = std::sin(Value) * 0.5f + std::sqrt(Value + 1.0f);
+        }
+        return Value;
+    }
+
+    double MeasureMedianMs(int32 NumRepeats, const TFunction<void()>& Work)
+    {
+        TArray<double> Samples;
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Work();
+            Samples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+        }
+        Samples.Sort();
+        return Samples.Num() > 0 ? Samples[Samples.Num() / 2] : 0.0;
+    }
+
+    bool TestManySmallJobs(TArray<FString>& OutFailures)
+    {
+        static TStatId StatId(TEXT("JobStress_Small"));
+
+        constexpr int32 NumJobs = 20000;
+        std::atomic<int32> Sum = 0;
+
+        FJobCounter Counter;
+        for (int32 Index = 0; Index < NumJobs; ++Index)
+        {
+            FJobSystem::Get().Dispatch(StatId, [&Sum]() { Sum.fetch_add(1, std::memory_order_relaxed); }, &Counter);
+        }
+        FJobSystem::Get().Wait(Counter);
+
+        if (Sum.load() != NumJobs)
+        {
+            OutFailures.Add(FString::Printf(TEXT("ManySmallJobs: expected %d, got %d"), NumJobs, Sum.load()));
+            return false;
+        }
+        return true;
+    }
+
+    bool TestPrerequisiteChain(TArray<FString>& OutFailures)
+    {
+        static TStatId StatId(TEXT("JobStress_Chain"));
+
+        // Stage마다 여러 Job이 있고, 다음 Stage는 이전 Stage 카운터를 Prerequisite로 가짐
+        constexpr int32 NumStages = 8;
+        constexpr int32 JobsPerStage = 16;
+
+        FJobCounter StageCounters[NumStages];
+        std::atomic<int32> CompletedStages[NumStages] = {};
+        std::atomic<bool> bOrderViolated = false;
+
+        for (int32 Stage = 0; Stage < NumStages; ++Stage)
+        {
+            FJobCounter* Prerequisite = Stage > 0 ? &StageCounters[Stage - 1] : nullptr;
+            for (int32 Job = 0; Job < JobsPerStage; ++Job)
+            {
+                FJobSystem::Get().Dispatch(StatId, [Stage, &CompletedStages, &bOrderViolated]()
+                {
+                    if (Stage > 0 && CompletedStages[Stage - 1].load() != JobsPerStage)
+                    {
+                        bOrderViolated.store(true);
+                    }
+                    CompletedStages[Stage].fetch_add(1);
+                }, &StageCounters[Stage], Prerequisite);
+            }
+        }
+
+        // 마지막 Stage가 끝나도 앞 Stage 카운터는 Decrement를 마무리 중일 수 있으므로 전부 기다림
+        for (FJobCounter& Counter : StageCounters)
+        {
+            FJobSystem::Get().Wait(Counter);
+        }
+
+        if (bOrderViolated.load())
+        {
+            OutFailures.Add(TEXT("PrerequisiteChain: a stage started before its prerequisite finished"));
+            return false;
+        }
+        return true;
+    }
+
+    bool TestNestedParallelFor(TArray<FString>& OutFailures)
+    {
+        constexpr int32 NumOuter = 64;
+        constexpr int32 NumInner = 1000;
+
+        std::atomic<int64> Sum = 0;
+        ParallelFor(NumOuter, [&Sum](int32 Outer)
+        {
+            std::atomic<int64> InnerSum = 0;
+            ParallelForRange(NumInner, [&InnerSum, Outer](int32 Begin, int32 End)
+            {
+                int64 LocalSum = 0;
+                for (int32 Inner = Begin; Inner < End; ++Inner)
+                {
+                    LocalSum += Outer * NumInner + Inner;
+                }
+                InnerSum.fetch_add(LocalSum, std::memory_order_relaxed);
+            }, 64);
+            Sum.fetch_add(InnerSum.load(), std::memory_order_relaxed);
+        });
+
+        constexpr int64 Count = static_cast<int64>(NumOuter) * NumInner;
+        constexpr int64 Expected = Count * (Count - 1) / 2;
+        if (Sum.load() != Expected)
+        {
+            OutFailures.Add(FString::Printf(TEXT("NestedParallelFor: expected %lld, got %lld"), Expected, Sum.load()));
+            return false;
+        }
+        return true;
+    }
+
+    bool TestGameThreadAffinity(TArray<FString>& OutFailures)
+    {
+        static TStatId StatId(TEXT("JobStress_Affinity"));
+
+        constexpr int32 NumJobs = 256;
+        std::atomic<int32> NumWrongThread = 0;
+
+        // Worker에서 게임 스레드 전용 Job을 예약하고, 게임 스레드가 Wait 안에서 처리
+        FJobCounter GameThreadCounter;
+        FJobCounter WorkerCounter;
+        for (int32 Index = 0; Index < NumJobs; ++Index)
+        {
+            FJobSystem::Get().Dispatch(StatId, [&NumWrongThread, &GameThreadCounter]()
+            {
+                FJobSystem::Get().Dispatch(StatId, [&NumWrongThread]()
+                {
+                    if (!FJobSystem::Get().IsInGameThread())
+                    {
+                        NumWrongThread.fetch_add(1);
+                    }
+                }, &GameThreadCounter, nullptr, EJobAffinity::GameThread);
+            }, &WorkerCounter);
+        }
+        FJobSystem::Get().Wait(WorkerCounter);
+        FJobSystem::Get().Wait(GameThreadCounter);
+
+        if (NumWrongThread.load() != 0)
+        {
+            OutFailures.Add(FString::Printf(TEXT("GameThreadAffinity: %d jobs ran off the game thread"), NumWrongThread.load()));
+            return false;
+        }
+        return true;
+    }
+}
+
+bool FJobSystemBenchmark::RunStressTest(int32 NumIterations, TArray<FString>& OutFailures)
+{
+    bool bPassed = true;
+    for (int32 Iteration = 0; Iteration < NumIterations && bPassed; ++Iteration)
+    {
+        bPassed &= TestManySmallJobs(OutFailures);
+        bPassed &= TestPrerequisiteChain(OutFailures);
+        bPassed &= TestNestedParallelFor(OutFailures);
+        bPassed &= TestGameThreadAffinity(OutFailures);
+    }
+    return bPassed;
+}
+
+void FJobSystemBenchmark::RunScalingBenchmark(int32 NumElements, int32 NumRepeats, TArray<FJobScalingResult>& OutResults)
+{
+    OutResults.Empty();
+
+    FJobSystem& JobSystem = FJobSystem::Get();
+    const int32 PrevActiveWorkers = JobSystem.GetNumActiveWorkers();
+
+    TArray<float> Output;
+    Output.SetNum(NumElements);
+
+    for (int32 NumActive = 0; NumActive <= JobSystem.GetNumWorkers(); ++NumActive)
+    {
+        JobSystem.SetNumActiveWorkers(NumActive);
+
+        FJobScalingResult Result;
+        Result.NumThreads = NumActive + 1;
+        Result.BalancedMs = MeasureMedianMs(NumRepeats, [&Output, NumElements]()
+        {
+            ParallelFor(NumElements, [&Output](int32 Index)
+            {
+                Output[Index] = ComputeElement(Index, 16);
+            }, 256);
+        });
+        // 뒤로 갈수록 원소당 비용이 커지는 작업. 고정 분할이면 마지막 Chunk를 맡은 스레드만 오래 걸림
+        Result.UnbalancedMs = MeasureMedianMs(NumRepeats, [&Output, NumElements]()
+        {
+            ParallelFor(NumElements, [&Output, NumElements](int32 Index)
+            {
+                Output[Index] = ComputeElement(Index, 1 + 48 * Index / NumElements);
+            }, 64);
+        });
+        OutResults.Add(Result);
+    }
+
+    JobSystem.SetNumActiveWorkers(PrevActiveWorkers);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FJobScalingResult
+{
+    int32 NumThreads = 0;           // 게임 스레드 포함
+    double BalancedMs = 0.0;        // 원소당 비용이 같은 작업 (중앙값)
+    double UnbalancedMs = 0.0;      // 원소당 비용이 제각각인 작업 (중앙값)
+};
+
+/**
+ * FJobSystem 검증 / 측정용 함수 모음. 콘솔의 "jobs stress", "jobs bench"에서 호출합니다.
+ * 게임 스레드에서 호출해야 합니다.
+ */
+struct FJobSystemBenchmark
+{
+    /** 작은 Job 대량 투입, Prerequisite 순서, 중첩 ParallelFor, GameThread Affinity를 반복해서 확인합니다. */
+    static bool RunStressTest(int32 NumIterations, TArray<FString>& OutFailures);
+
+    /**
+     * 활성 Worker 수를 0부터 전체까지 바꿔가며 같은 ParallelFor 작업의 시간을 잽니다.
+     * 측정이 끝나면 활성 Worker 수를 원래대로 돌려놓습니다.
+     */
+    static void RunScalingBenchmark(int32 NumElements, int32 NumRepeats, TArray<FJobScalingResult>& OutResults);
+};
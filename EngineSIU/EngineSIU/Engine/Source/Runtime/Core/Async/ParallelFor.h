@@ -0,0 +1,85 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+
+#include "JobSystem.h"
+
+enum class EParallelForFlags : uint8
+{
+    None = 0,
+    /** 디버깅용. 호출한 스레드에서 순서대로 실행 */
+    ForceSingleThread = 1 << 0,
+};
+
+/**
+ * [0, Num) 범위를 나눠서 Body(Begin, End)를 Worker들과 호출한 스레드가 함께 실행합니다. 모두 끝나야 반환합니다.
+ *
+ * 범위를 미리 고정 크기로 자르지 않고, 참여한 스레드가 (남은 수 / (참여 스레드 수 * 2))만큼씩 가져갑니다.
+ * 앞쪽 Chunk는 커서 분배 비용이 적고, 뒤쪽 Chunk는 작아서 원소별 비용이 고르지 않아도 마지막에 한 스레드만 남지 않습니다.
+ * @param MinBatchSize 한 번에 가져가는 최소 원소 수. 원소당 작업이 가벼울수록 크게 잡습니다.
+ */
+template <typename FuncType>
+void ParallelForRange(int32 Num, const FuncType& Body, int32 MinBatchSize = 1, EParallelForFlags Flags = EParallelForFlags::None)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    MinBatchSize = std::max(MinBatchSize, 1);
+
+    FJobSystem& JobSystem = FJobSystem::Get();
+    const int32 NumParticipants = std::min(JobSystem.GetNumActiveWorkers() + 1, (Num + MinBatchSize - 1) / MinBatchSize);
+    if (NumParticipants <= 1 || Flags == EParallelForFlags::ForceSingleThread)
+    {
+        Body(0, Num);
+        return;
+    }
+
+    std::atomic<int32> NextIndex = 0;
+    auto RunChunks = [&NextIndex, &Body, Num, MinBatchSize, NumParticipants]()
+    {
+        int32 Begin = NextIndex.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const int32 Remaining = Num - Begin;
+            if (Remaining <= 0)
+            {
+                return;
+            }
+
+            const int32 ChunkSize = std::min(std::max(Remaining / (NumParticipants * 2), MinBatchSize), Remaining);
+            if (NextIndex.compare_exchange_weak(Begin, Begin + ChunkSize, std::memory_order_relaxed))
+            {
+                Body(Begin, Begin + ChunkSize);
+                Begin = NextIndex.load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+    FJobCounter Counter;
+    for (int32 Index = 1; Index < NumParticipants; ++Index)
+    {
+        JobSystem.Dispatch(FJobSystem::GetParallelForStatId(), RunChunks, &Counter);
+    }
+    RunChunks();
+    JobSystem.Wait(Counter);
+}
+
+/** [0, Num)의 각 Index에 대해 Body(Index)를 병렬로 호출합니다. */
+template <typename FuncType>
+void ParallelFor(int32 Num, const FuncType& Body, int32 MinBatchSize = 1, EParallelForFlags Flags = EParallelForFlags::None)
+{
+    ParallelForRange(
+        Num,
+        [&Body](int32 Begin, int32 End)
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                Body(Index);
+            }
+        },
+        MinBatchSize,
+        Flags
+    );
+}
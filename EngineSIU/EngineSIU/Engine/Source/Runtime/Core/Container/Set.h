@@ -48,6 +48,16 @@ public:
     	return std::distance(ContainerPrivate.begin(), iter.first);
     }
 
+    /**
+     * Index를 계산하지 않고 추가합니다.
+     * Add / Emplace는 반환할 Index를 구하느라 원소 수에 비례하는 비용이 들기 때문에, 반환값이 필요 없는 대량 추가에 사용합니다.
+     * @return 새로 추가되었으면 true
+     */
+    bool Insert(const T& Item) { return ContainerPrivate.insert(Item).second; }
+
+    // Reserve
+    void Reserve(SizeType Number) { ContainerPrivate.reserve(Number); }
+
     // Num (개수)
     SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
 
@@ -1,6 +1,9 @@
 #pragma once
+#include <atomic>
 #include <functional>
+#include "Core/Container/Array.h"
 #include "Core/Container/Map.h"
+#include "Core/Templates/Function.h"
 
 #define FUNC_DECLARE_DELEGATE(DelegateName, ReturnType, ...) \
 	using DelegateName = TDelegate<ReturnType(__VA_ARGS__)>;
@@ -69,8 +72,7 @@ class TDelegate;
 template <typename ReturnType, typename... ParamTypes>
 class TDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
+	using FuncType = TFunction<ReturnType(ParamTypes...)>;
 	FuncType Func;
 
 public:
@@ -112,12 +114,38 @@ public:
 template <typename Signature>
 class TMulticastDelegate;
 
+/**
+ * 바인딩을 배열에 저장하는 Multicast Delegate
+ *
+ * 처음 NumInlineBindings개는 객체 안에, 나머지는 ExtraBindings에 저장하고, 함수 객체도 TFunction의 내부 버퍼에 들어가므로
+ * 바인딩이 적으면 Add 이후로 힙 할당이 없습니다. Broadcast는 복사 없이 배열을 그대로 순회합니다.
+ *
+ * Broadcast 중에 호출된 Add / Remove는 바로 배열을 바꾸지 않고 가장 바깥 Broadcast가 끝날 때 반영합니다.
+ *   - Add: PendingBindings에 넣어둠. 이번 Broadcast에서는 호출되지 않음
+ *   - Remove: Handle만 무효화해서 이후 호출을 건너뜀. 실행 중인 함수 객체가 파괴되지 않도록 정리는 나중에 함
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TMulticastDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-	TMap<FDelegateHandle, FuncType> DelegateHandles;
+	using FuncType = TFunction<void(ParamTypes...)>;
+
+    struct FBinding
+    {
+        FDelegateHandle Handle;
+        FuncType Func;
+    };
+
+    static constexpr int32 NumInlineBindings = 2;
+
+    FBinding InlineBindings[NumInlineBindings];
+    TArray<FBinding> ExtraBindings;
+    int32 NumBindings = 0;
+
+    TArray<FBinding> PendingBindings;
+
+    // 중첩된 Broadcast 깊이. 0이 아니면 배열 변경을 미룸
+    mutable int32 BroadcastDepth = 0;
+    bool bHasRemovedBindings = false;
 
 public:
 	template <typename FunctorType>
@@ -125,33 +153,81 @@ public:
 	{
 		FDelegateHandle DelegateHandle = FDelegateHandle::CreateHandle();
 
-        DelegateHandles.Add(
-            DelegateHandle,
-            [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
-            {
-                Func(std::forward<ParamTypes>(Params)...);
-            }
-        );
+        FBinding Binding{ DelegateHandle, FuncType(std::forward<FunctorType>(InFunctor)) };
+        if (BroadcastDepth > 0)
+        {
+            PendingBindings.Add(std::move(Binding));
+        }
+        else
+        {
+            AddBinding(std::move(Binding));
+        }
 		return DelegateHandle;
 	}
 
 	bool Remove(FDelegateHandle Handle)
 	{
-		if (Handle.IsValid())
+		if (!Handle.IsValid())
 		{
-			DelegateHandles.Remove(Handle);
-			return true;
+			return false;
 		}
+
+        for (int32 Index = 0; Index < PendingBindings.Num(); ++Index)
+        {
+            if (PendingBindings[Index].Handle == Handle)
+            {
+                PendingBindings.RemoveAt(Index);
+                return true;
+            }
+        }
+
+        for (int32 Index = 0; Index < NumBindings; ++Index)
+        {
+            FBinding& Binding = GetBinding(Index);
+            if (Binding.Handle == Handle)
+            {
+                if (BroadcastDepth > 0)
+                {
+                    Binding.Handle.Invalidate();
+                    bHasRemovedBindings = true;
+                }
+                else
+                {
+                    RemoveBindingAt(Index);
+                }
+                return true;
+            }
+        }
 		return false;
 	}
 
+    bool IsBound() const
+    {
+        return NumBindings > 0 || !PendingBindings.IsEmpty();
+    }
+
 	void Broadcast(ParamTypes... Params) const
 	{
-		auto CopyDelegates = DelegateHandles;
-		for (const auto& [Handle, Delegate] : CopyDelegates)
-		{
-			Delegate(std::forward<ParamTypes>(Params)...);  // NOLINT(bugprone-use-after-move)
-		}
+        if (NumBindings == 0)
+        {
+            return;
+        }
+
+        ++BroadcastDepth;
+        for (int32 Index = 0; Index < NumBindings; ++Index)
+        {
+            const FBinding& Binding = GetBinding(Index);
+            if (Binding.Handle.IsValid())
+            {
+                Binding.Func(std::forward<ParamTypes>(Params)...);  // NOLINT(bugprone-use-after-move)
+            }
+        }
+
+        if (--BroadcastDepth == 0 && (bHasRemovedBindings || !PendingBindings.IsEmpty()))
+        {
+            // 미뤄둔 변경 반영. 바인딩 목록은 Broadcast의 const와 무관한 내부 상태
+            const_cast<TMulticastDelegate*>(this)->ApplyDeferredChanges();
+        }
 	}
 
     template<typename T>
@@ -162,4 +238,68 @@ public:
                 return (InObject->*InFunc)(std::forward<ParamTypes>(Params)...);
             });
     }
+
+private:
+    FBinding& GetBinding(int32 Index)
+    {
+        return Index < NumInlineBindings ? InlineBindings[Index] : ExtraBindings[Index - NumInlineBindings];
+    }
+
+    const FBinding& GetBinding(int32 Index) const
+    {
+        return Index < NumInlineBindings ? InlineBindings[Index] : ExtraBindings[Index - NumInlineBindings];
+    }
+
+    void AddBinding(FBinding&& Binding)
+    {
+        if (NumBindings < NumInlineBindings)
+        {
+            InlineBindings[NumBindings] = std::move(Binding);
+        }
+        else
+        {
+            ExtraBindings.Add(std::move(Binding));
+        }
+        ++NumBindings;
+    }
+
+    /** 뒤의 바인딩을 한 칸씩 당겨서 추가된 순서를 유지합니다. */
+    void RemoveBindingAt(int32 Index)
+    {
+        for (int32 Next = Index + 1; Next < NumBindings; ++Next)
+        {
+            GetBinding(Next - 1) = std::move(GetBinding(Next));
+        }
+
+        --NumBindings;
+        if (NumBindings >= NumInlineBindings)
+        {
+            ExtraBindings.RemoveAt(NumBindings - NumInlineBindings);
+        }
+        else
+        {
+            InlineBindings[NumBindings] = FBinding();
+        }
+    }
+
+    void ApplyDeferredChanges()
+    {
+        if (bHasRemovedBindings)
+        {
+            for (int32 Index = NumBindings - 1; Index >= 0; --Index)
+            {
+                if (!GetBinding(Index).Handle.IsValid())
+                {
+                    RemoveBindingAt(Index);
+                }
+            }
+            bHasRemovedBindings = false;
+        }
+
+        for (FBinding& Binding : PendingBindings)
+        {
+            AddBinding(std::move(Binding));
+        }
+        PendingBindings.Empty();
+    }
 };
@@ -0,0 +1,70 @@
+#include "DelegateBenchmark.h"
+
+#include <functional>
+
+#include "Delegate.h"
+#include "Container/Map.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    // 이전 TMulticastDelegate와 같은 저장 / Broadcast 방식
+    class FMapCopyMulticastDelegate
+    {
+        TMap<FDelegateHandle, std::function<void(int32)>> DelegateHandles;
+
+    public:
+        template <typename FunctorType>
+        void AddLambda(FunctorType&& InFunctor)
+        {
+            DelegateHandles.Add(FDelegateHandle::CreateHandle(), std::forward<FunctorType>(InFunctor));
+        }
+
+        void Broadcast(int32 Value) const
+        {
+            auto CopyDelegates = DelegateHandles;
+            for (const auto& [Handle, Delegate] : CopyDelegates)
+            {
+                Delegate(Value);
+            }
+        }
+    };
+
+    template <typename DelegateType>
+    double MeasureBroadcastNs(const DelegateType& Delegate, int32 NumBroadcasts)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+        {
+            Delegate.Broadcast(Index);
+        }
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.0e6 / NumBroadcasts;
+    }
+}
+
+void FDelegateBenchmark::RunBroadcastBenchmark(int32 NumBroadcasts, TArray<FDelegateBroadcastResult>& OutResults)
+{
+    OutResults.Empty();
+
+    // 바인딩이 최적화로 사라지지 않도록 결과를 누적
+    volatile int64 Sink = 0;
+
+    for (const int32 NumBindings : { 1, 4, 32 })
+    {
+        FMapCopyMulticastDelegate MapCopyDelegate;
+        TMulticastDelegate<void(int32)> MulticastDelegate;
+
+        // OnActorOverlap에 바인딩되는 람다처럼 포인터 하나를 캡처
+        for (int32 Binding = 0; Binding < NumBindings; ++Binding)
+        {
+            MapCopyDelegate.AddLambda([&Sink](int32 Value) { Sink = Sink + Value; });
+            MulticastDelegate.AddLambda([&Sink](int32 Value) { Sink = Sink + Value; });
+        }
+
+        FDelegateBroadcastResult Result;
+        Result.NumBindings = NumBindings;
+        Result.MapCopyNs = MeasureBroadcastNs(MapCopyDelegate, NumBroadcasts);
+        Result.MulticastNs = MeasureBroadcastNs(MulticastDelegate, NumBroadcasts);
+        OutResults.Add(Result);
+    }
+}
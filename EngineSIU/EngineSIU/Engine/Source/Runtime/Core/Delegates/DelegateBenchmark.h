@@ -0,0 +1,17 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FDelegateBroadcastResult
+{
+    int32 NumBindings = 0;
+    double MapCopyNs = 0.0;         // Broadcast마다 TMap<FDelegateHandle, std::function>을 복사하는 이전 방식 (1회당)
+    double MulticastNs = 0.0;       // TMulticastDelegate (1회당)
+};
+
+/** TMulticastDelegate::Broadcast 비용 측정. 콘솔의 "delegate bench"에서 호출합니다. */
+struct FDelegateBenchmark
+{
+    /** 바인딩 수 1, 4, 32개에 대해 NumBroadcasts번 Broadcast한 평균 시간을 잽니다. */
+    static void RunBroadcastBenchmark(int32 NumBroadcasts, TArray<FDelegateBroadcastResult>& OutResults);
+};
@@ -0,0 +1,199 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "Math/MathUtility.h"
+
+
+double FGenericFrameClock::NowSeconds()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+void FGenericFrameClock::SleepSeconds(double Seconds)
+{
+    std::this_thread::sleep_for(std::chrono::duration<double>(Seconds));
+}
+
+void FGenericFrameClock::SpinPause()
+{
+    std::this_thread::yield();
+}
+
+
+FFramePacer::FFramePacer(IFrameClock& InClock)
+    : Clock(InClock)
+{
+    FrameSeconds.Reserve(StatsWindow);
+}
+
+void FFramePacer::SetSettings(const FFramePacerSettings& InSettings)
+{
+    Settings = InSettings;
+
+    // 프레임 간격이 바뀌었으므로 목표 시각과 고정 스텝을 처음부터 다시 잡음
+    bHasTarget = false;
+    FixedStepAccumulator = 0.0;
+}
+
+FFrameTiming FFramePacer::BeginFrame()
+{
+    const double Now = Clock.NowSeconds();
+
+    FFrameTiming Timing;
+    if (bHasFrame)
+    {
+        Timing.DeltaSeconds = Now - FrameStartSeconds;
+
+        if (FrameSeconds.Num() < StatsWindow)
+        {
+            FrameSeconds.Add(Timing.DeltaSeconds);
+        }
+        else
+        {
+            FrameSeconds[NextStatsIndex] = Timing.DeltaSeconds;
+        }
+        NextStatsIndex = (NextStatsIndex + 1) % StatsWindow;
+        TotalFrameSeconds += Timing.DeltaSeconds;
+    }
+    bHasFrame = true;
+    FrameStartSeconds = Now;
+
+    if (Settings.FixedStepSeconds <= 0.0)
+    {
+        Timing.NumSimulationSteps = 1;
+        Timing.SimulationDeltaSeconds = Timing.DeltaSeconds;
+        Timing.InterpolationAlpha = 1.0f;
+        return Timing;
+    }
+
+    const double Step = Settings.FixedStepSeconds;
+    FixedStepAccumulator += Timing.DeltaSeconds;
+
+    int32 NumSteps = static_cast<int32>(FixedStepAccumulator / Step);
+    NumSteps = FMath::Min(NumSteps, FMath::Max(Settings.MaxStepsPerFrame, 1));
+    FixedStepAccumulator -= NumSteps * Step;
+
+    // 최대 스텝 수를 넘어 남은 시간은 버림
+    if (FixedStepAccumulator >= Step)
+    {
+        FixedStepAccumulator = std::fmod(FixedStepAccumulator, Step);
+    }
+
+    Timing.NumSimulationSteps = NumSteps;
+    Timing.SimulationDeltaSeconds = Step;
+    Timing.InterpolationAlpha = static_cast<float>(FixedStepAccumulator / Step);
+    return Timing;
+}
+
+void FFramePacer::WaitForNextFrame()
+{
+    if (Settings.TargetFPS <= 0.0)
+    {
+        return;
+    }
+
+    const double FrameInterval = 1.0 / Settings.TargetFPS;
+    double Now = Clock.NowSeconds();
+
+    NextFrameSeconds += FrameInterval;
+    if (!bHasTarget || NextFrameSeconds < Now - FrameInterval)
+    {
+        NextFrameSeconds = FrameStartSeconds + FrameInterval;
+        bHasTarget = true;
+    }
+
+    // Sleep이 평소보다 늦게 깨어나는 환경이면 Spin 구간을 그만큼 늘림
+    const double SpinThreshold = FMath::Min(FMath::Max(Settings.SpinThresholdSeconds, SleepOvershootSeconds * 2.0), FrameInterval);
+
+    double SleptSeconds = 0.0;
+    double SpunSeconds = 0.0;
+    while (Now < NextFrameSeconds)
+    {
+        const double Remaining = NextFrameSeconds - Now;
+        if (Remaining > SpinThreshold)
+        {
+            const double Requested = Remaining - SpinThreshold;
+            Clock.SleepSeconds(Requested);
+
+            const double AfterSleep = Clock.NowSeconds();
+            const double Overshoot = FMath::Max(AfterSleep - Now - Requested, 0.0);
+            SleepOvershootSeconds += (Overshoot - SleepOvershootSeconds) * 0.1;
+            SleptSeconds += AfterSleep - Now;
+            Now = AfterSleep;
+        }
+        else
+        {
+            Clock.SpinPause();
+
+            const double AfterSpin = Clock.NowSeconds();
+            SpunSeconds += AfterSpin - Now;
+            Now = AfterSpin;
+        }
+    }
+
+    ++NumWaitedFrames;
+    TotalSleepSeconds += SleptSeconds;
+    TotalSpinSeconds += SpunSeconds;
+    TotalWakeErrorSeconds += FMath::Max(Now - NextFrameSeconds, 0.0);
+}
+
+FFramePacerStats FFramePacer::GetStats() const
+{
+    FFramePacerStats Stats;
+    Stats.NumFrames = FrameSeconds.Num();
+    if (Stats.NumFrames == 0)
+    {
+        return Stats;
+    }
+
+    TArray<double> Sorted = FrameSeconds;
+    std::sort(Sorted.begin(), Sorted.end());
+
+    double Sum = 0.0;
+    for (const double Seconds : Sorted)
+    {
+        Sum += Seconds;
+    }
+    const double Average = Sum / Stats.NumFrames;
+
+    double SquaredSum = 0.0;
+    for (const double Seconds : Sorted)
+    {
+        SquaredSum += (Seconds - Average) * (Seconds - Average);
+    }
+
+    const int32 P99Index = FMath::Min(static_cast<int32>(std::ceil(Stats.NumFrames * 0.99)) - 1, Stats.NumFrames - 1);
+
+    Stats.AverageFrameMs = Average * 1000.0;
+    Stats.MinFrameMs = Sorted[0] * 1000.0;
+    Stats.MaxFrameMs = Sorted[Stats.NumFrames - 1] * 1000.0;
+    Stats.P99FrameMs = Sorted[FMath::Max(P99Index, 0)] * 1000.0;
+    Stats.JitterMs = std::sqrt(SquaredSum / Stats.NumFrames) * 1000.0;
+
+    if (NumWaitedFrames > 0)
+    {
+        Stats.AverageWakeErrorMs = TotalWakeErrorSeconds / NumWaitedFrames * 1000.0;
+    }
+    if (TotalFrameSeconds > 0.0)
+    {
+        Stats.SleepFraction = TotalSleepSeconds / TotalFrameSeconds;
+        Stats.SpinFraction = TotalSpinSeconds / TotalFrameSeconds;
+    }
+    return Stats;
+}
+
+void FFramePacer::ResetStats()
+{
+    FrameSeconds.Empty();
+    NextStatsIndex = 0;
+    NumWaitedFrames = 0;
+    TotalFrameSeconds = 0.0;
+    TotalSleepSeconds = 0.0;
+    TotalSpinSeconds = 0.0;
+    TotalWakeErrorSeconds = 0.0;
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+
+/**
+ * FFramePacer가 사용하는 시계와 대기 함수
+ *
+ * 플랫폼마다 가장 정밀한 Sleep을 구현하고, 테스트에서는 시간을 직접 진행시키는 가짜 시계로 바꿔 끼웁니다.
+ */
+class IFrameClock
+{
+public:
+    virtual ~IFrameClock() = default;
+
+    /** 단조 증가하는 현재 시각 (초) */
+    virtual double NowSeconds() = 0;
+
+    /** 최소 Seconds만큼 스레드를 재웁니다. OS 타이머 정밀도만큼 더 늦게 깨어날 수 있습니다. */
+    virtual void SleepSeconds(double Seconds) = 0;
+
+    /** Spin 대기 중 한 번 호출됩니다. */
+    virtual void SpinPause() {}
+};
+
+/** std::chrono 기반 시계. 어느 플랫폼에서나 동작하지만 Sleep 정밀도는 OS 기본 타이머를 따릅니다. */
+class FGenericFrameClock : public IFrameClock
+{
+public:
+    virtual double NowSeconds() override;
+    virtual void SleepSeconds(double Seconds) override;
+    virtual void SpinPause() override;
+};
+
+struct FFramePacerSettings
+{
+    /** 목표 프레임 레이트. 0 이하이면 기다리지 않음 (벤치마크용 Uncapped) */
+    double TargetFPS = 0.0;
+
+    /** 0보다 크면 시뮬레이션을 이 간격의 고정 스텝으로 나눠 진행 */
+    double FixedStepSeconds = 0.0;
+
+    /** 한 프레임에 실행할 최대 고정 스텝 수. 넘치는 시간은 버려서 느려진 프레임이 계속 느려지는 것을 막음 */
+    int32 MaxStepsPerFrame = 5;
+
+    /**
+     * 목표 시각까지 이 시간보다 적게 남으면 Sleep 대신 Spin으로 기다립니다.
+     * 실제 Sleep이 요청보다 늦게 깨어나면 그만큼 자동으로 늘어납니다.
+     */
+    double SpinThresholdSeconds = 0.001;
+};
+
+/** BeginFrame이 돌려주는 이번 프레임의 시간 정보 */
+struct FFrameTiming
+{
+    /** 지난 BeginFrame부터 흐른 실제 시간 (초). 첫 프레임은 0 */
+    double DeltaSeconds = 0.0;
+
+    /** 이번 프레임에 실행할 시뮬레이션 스텝 수와 한 스텝의 시간. 가변 스텝이면 1과 DeltaSeconds */
+    int32 NumSimulationSteps = 1;
+    double SimulationDeltaSeconds = 0.0;
+
+    /** 고정 스텝에서 아직 시뮬레이션하지 않고 남은 시간 / 스텝 간격. 렌더링할 때 이전 스텝과 현재 스텝 사이를 보간하는 비율 */
+    float InterpolationAlpha = 1.0f;
+};
+
+struct FFramePacerStats
+{
+    int32 NumFrames = 0;
+
+    double AverageFrameMs = 0.0;
+    double MinFrameMs = 0.0;
+    double MaxFrameMs = 0.0;
+    double P99FrameMs = 0.0;
+
+    /** 프레임 시간의 표준 편차 */
+    double JitterMs = 0.0;
+
+    /** 목표 시각보다 늦게 깨어난 평균 시간 */
+    double AverageWakeErrorMs = 0.0;
+
+    /** 프레임 시간 중 Sleep / Spin으로 기다린 비율 */
+    double SleepFraction = 0.0;
+    double SpinFraction = 0.0;
+};
+
+/**
+ * 프레임 레이트 제한과 고정 스텝 시뮬레이션을 담당합니다.
+ *
+ * 기다릴 때는 목표 시각 직전까지 IFrameClock::SleepSeconds로 재우고, 마지막 SpinThreshold만 Spin으로 맞춥니다.
+ * 목표 시각은 이전 목표에서 한 프레임씩 더해 정하므로 오차가 쌓이지 않고, 한 프레임 넘게 늦어지면 현재 시각에서 다시 시작합니다.
+ * 최근 StatsWindow 프레임의 시간을 모아 지터 통계를 냅니다.
+ */
+class FFramePacer
+{
+public:
+    static constexpr int32 StatsWindow = 240;
+
+    explicit FFramePacer(IFrameClock& InClock);
+
+    void SetSettings(const FFramePacerSettings& InSettings);
+    const FFramePacerSettings& GetSettings() const { return Settings; }
+
+    /** 프레임 시작에 호출합니다. */
+    FFrameTiming BeginFrame();
+
+    /** 프레임 끝에 호출합니다. 목표 프레임 레이트가 있으면 다음 프레임 시각까지 기다립니다. */
+    void WaitForNextFrame();
+
+    FFramePacerStats GetStats() const;
+    void ResetStats();
+
+private:
+    IFrameClock& Clock;
+    FFramePacerSettings Settings;
+
+    bool bHasFrame = false;
+    bool bHasTarget = false;
+    double FrameStartSeconds = 0.0;
+    double NextFrameSeconds = 0.0;
+    double FixedStepAccumulator = 0.0;
+
+    // Sleep이 요청보다 늦게 깨어난 시간의 이동 평균
+    double SleepOvershootSeconds = 0.0;
+
+    // 통계 (링 버퍼)
+    TArray<double> FrameSeconds;
+    int32 NextStatsIndex = 0;
+    int32 NumWaitedFrames = 0;
+    double TotalFrameSeconds = 0.0;
+    double TotalSleepSeconds = 0.0;
+    double TotalSpinSeconds = 0.0;
+    double TotalWakeErrorSeconds = 0.0;
+};
@@ -0,0 +1,165 @@
+#include "FramePacerTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "FramePacer.h"
+
+
+namespace
+{
+    /** Sleep / Spin을 부르면 그만큼 시간이 흐르는 시계. 실제로 기다리지 않습니다. */
+    class FFakeFrameClock : public IFrameClock
+    {
+    public:
+        virtual double NowSeconds() override { return Now; }
+
+        virtual void SleepSeconds(double Seconds) override
+        {
+            // 실제 Sleep처럼 아주 짧게 요청해도 시간이 흐름
+            Now += std::max(Seconds, MinSleepSeconds) + SleepOvershootSeconds;
+            ++NumSleeps;
+        }
+
+        virtual void SpinPause() override
+        {
+            Now += SpinStepSeconds;
+            ++NumSpins;
+        }
+
+        void Advance(double Seconds) { Now += Seconds; }
+
+        double Now = 100.0;
+        double SleepOvershootSeconds = 0.0;
+        double MinSleepSeconds = 0.000001;
+        double SpinStepSeconds = 0.00001;
+        int32 NumSleeps = 0;
+        int32 NumSpins = 0;
+    };
+
+    void Check(TArray<FString>& OutFailures, bool bCondition, const TCHAR* Case, const TCHAR* Format, double Actual, double Expected)
+    {
+        if (!bCondition)
+        {
+            OutFailures.Add(FString(Case) + TEXT(": ") + FString::Printf(Format, Actual, Expected));
+        }
+    }
+
+    /** 프레임마다 WorkSeconds만큼 일한 뒤 기다리고, 두 번째 프레임부터의 간격을 돌려줍니다. */
+    TArray<double> RunFrames(FFramePacer& Pacer, FFakeFrameClock& Clock, int32 NumFrames, double WorkSeconds)
+    {
+        TArray<double> Deltas;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const FFrameTiming Timing = Pacer.BeginFrame();
+            if (Frame > 0)
+            {
+                Deltas.Add(Timing.DeltaSeconds);
+            }
+            Clock.Advance(WorkSeconds);
+            Pacer.WaitForNextFrame();
+        }
+        return Deltas;
+    }
+
+    void TestUncapped(TArray<FString>& OutFailures)
+    {
+        FFakeFrameClock Clock;
+        FFramePacer Pacer(Clock);
+
+        RunFrames(Pacer, Clock, 10, 0.003);
+        Check(OutFailures, Clock.NumSleeps == 0 && Clock.NumSpins == 0, TEXT("Uncapped"), TEXT("waited %g times, expected %g"), Clock.NumSleeps + Clock.NumSpins, 0.0);
+    }
+
+    void TestFrameCap(TArray<FString>& OutFailures, const TCHAR* Case, double SleepOvershootSeconds)
+    {
+        FFakeFrameClock Clock;
+        Clock.SleepOvershootSeconds = SleepOvershootSeconds;
+
+        FFramePacer Pacer(Clock);
+        FFramePacerSettings Settings;
+        Settings.TargetFPS = 100.0;
+        Pacer.SetSettings(Settings);
+
+        // 처음 몇 프레임은 늦게 깨어나는 시간을 배우는 동안이므로 빼고 잼
+        const TArray<double> Deltas = RunFrames(Pacer, Clock, 200, 0.003);
+        double MaxError = 0.0;
+        for (int32 Index = 20; Index < Deltas.Num(); ++Index)
+        {
+            MaxError = std::max(MaxError, std::abs(Deltas[Index] - 0.01));
+        }
+        Check(OutFailures, MaxError <= 0.0001, Case, TEXT("max frame time error %gs, expected at most %gs"), MaxError, 0.0001);
+        Check(OutFailures, Clock.NumSleeps > 0, Case, TEXT("slept %g times, expected more than %g"), Clock.NumSleeps, 0.0);
+    }
+
+    void TestFallBehind(TArray<FString>& OutFailures)
+    {
+        FFakeFrameClock Clock;
+        FFramePacer Pacer(Clock);
+        FFramePacerSettings Settings;
+        Settings.TargetFPS = 100.0;
+        Pacer.SetSettings(Settings);
+
+        RunFrames(Pacer, Clock, 5, 0.003);
+
+        // 한 프레임이 50ms 걸린 뒤에도 밀린 프레임을 몰아서 돌리지 않고 10ms 간격으로 돌아와야 함
+        Pacer.BeginFrame();
+        Clock.Advance(0.05);
+        Pacer.WaitForNextFrame();
+
+        const TArray<double> Deltas = RunFrames(Pacer, Clock, 4, 0.003);
+        for (const double Delta : Deltas)
+        {
+            Check(OutFailures, std::abs(Delta - 0.01) <= 0.0001, TEXT("FallBehind"), TEXT("frame time %gs after a hitch, expected %gs"), Delta, 0.01);
+        }
+    }
+
+    void TestFixedStep(TArray<FString>& OutFailures)
+    {
+        FFakeFrameClock Clock;
+        FFramePacer Pacer(Clock);
+        FFramePacerSettings Settings;
+        Settings.FixedStepSeconds = 0.01;
+        Settings.MaxStepsPerFrame = 4;
+        Pacer.SetSettings(Settings);
+
+        // 25ms 프레임이면 스텝이 2, 3번 번갈아 나오고, 합은 흐른 시간을 따라가야 함
+        Pacer.BeginFrame();
+        int32 TotalSteps = 0;
+        for (int32 Frame = 0; Frame < 8; ++Frame)
+        {
+            Clock.Advance(0.025);
+            const FFrameTiming Timing = Pacer.BeginFrame();
+            TotalSteps += Timing.NumSimulationSteps;
+
+            Check(OutFailures, Timing.SimulationDeltaSeconds == 0.01, TEXT("FixedStep"), TEXT("step %gs, expected %gs"), Timing.SimulationDeltaSeconds, 0.01);
+            Check(OutFailures, Timing.InterpolationAlpha >= 0.0f && Timing.InterpolationAlpha < 1.0f, TEXT("FixedStep"), TEXT("alpha %g outside [0, %g)"), Timing.InterpolationAlpha, 1.0);
+        }
+        Check(OutFailures, TotalSteps == 20, TEXT("FixedStep"), TEXT("%g steps over 200ms, expected %g"), TotalSteps, 20.0);
+
+        // 5ms 프레임은 스텝이 없는 프레임이 생기지만, 남은 시간은 보간 비율로 나와야 함
+        Clock.Advance(0.005);
+        const FFrameTiming ShortFrame = Pacer.BeginFrame();
+        Check(OutFailures, ShortFrame.NumSimulationSteps == 0, TEXT("FixedStep"), TEXT("%g steps in a 5ms frame, expected %g"), ShortFrame.NumSimulationSteps, 0.0);
+        Check(OutFailures, std::abs(ShortFrame.InterpolationAlpha - 0.5f) < 0.001f, TEXT("FixedStep"), TEXT("alpha %g, expected %g"), ShortFrame.InterpolationAlpha, 0.5);
+
+        // 1초 멈춘 뒤에는 최대 스텝 수만 실행하고 나머지는 버림
+        Clock.Advance(1.0);
+        const FFrameTiming Hitch = Pacer.BeginFrame();
+        Check(OutFailures, Hitch.NumSimulationSteps == 4, TEXT("FixedStep"), TEXT("%g steps after a 1s hitch, expected %g"), Hitch.NumSimulationSteps, 4.0);
+        Check(OutFailures, Hitch.InterpolationAlpha < 1.0f, TEXT("FixedStep"), TEXT("alpha %g after a hitch, expected below %g"), Hitch.InterpolationAlpha, 1.0);
+    }
+}
+
+bool FFramePacerTest::Run(TArray<FString>& OutFailures)
+{
+    const int32 NumFailuresBefore = OutFailures.Num();
+
+    TestUncapped(OutFailures);
+    TestFrameCap(OutFailures, TEXT("FrameCap"), 0.0);
+    TestFrameCap(OutFailures, TEXT("FrameCapLateWake"), 0.0015);
+    TestFallBehind(OutFailures);
+    TestFixedStep(OutFailures);
+
+    return OutFailures.Num() == NumFailuresBefore;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+
+/**
+ * FFramePacer 검증. 콘솔의 "framepace test"에서 호출합니다.
+ * 시간을 직접 진행시키는 가짜 IFrameClock으로 프레임 레이트 제한, Sleep이 늦게 깨어날 때의 보정,
+ * 한 프레임 넘게 밀렸을 때의 재시작, 고정 스텝 수와 보간 비율을 확인합니다.
+ */
+struct FFramePacerTest
+{
+    static bool Run(TArray<FString>& OutFailures);
+};
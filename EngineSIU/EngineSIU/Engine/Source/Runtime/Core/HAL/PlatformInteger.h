@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+// Windows.h 없이 정수 타입만 필요한 헤더(FMathBatch 등)에서 사용합니다.
+// 그 외에는 이 파일을 포함하는 HAL/PlatformType.h를 사용합니다.
+
+// unsigned int type
+typedef std::uint8_t uint8;
+typedef std::uint16_t uint16;
+typedef std::uint32_t uint32;
+typedef std::uint64_t uint64;
+
+// signed int
+typedef std::int8_t int8;
+typedef std::int16_t int16;
+typedef std::int32_t int32;
+typedef std::int64_t int64;
@@ -1,6 +1,631 @@
 ﻿#include "PlatformMemory.h"
 
-std::atomic<uint64> FPlatformMemory::ObjectAllocationBytes = 0;
-std::atomic<uint64> FPlatformMemory::ObjectAllocationCount = 0;
-std::atomic<uint64> FPlatformMemory::ContainerAllocationBytes = 0;
-std::atomic<uint64> FPlatformMemory::ContainerAllocationCount = 0;
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <Windows.h>
+#include <DbgHelp.h>
+#pragma comment(lib, "dbghelp")
+
+namespace
+{
+    // 사용자 포인터 바로 앞에 위치. malloc의 16바이트 정렬을 유지하기 위해 크기는 16으로 고정
+    struct FAllocationHeader
+    {
+        uint64 Size;
+        uint16 SiteIndex;           // 샘플링된 지점 슬롯 + 1 (0이면 샘플링되지 않음)
+        uint8 SiteGeneration;       // ResetAllocationSites 이전에 샘플링된 할당을 구분
+        uint8 bAligned;
+        uint16 BaseOffset;          // 사용자 포인터에서 실제 할당 시작까지의 거리
+        EMemoryTag Tag;
+        EAllocationType AllocType;
+    };
+    static_assert(sizeof(FAllocationHeader) == 16, "Allocation header must keep 16-byte alignment");
+
+    constexpr size_t HeaderSize = sizeof(FAllocationHeader);
+    constexpr uint32 MaxTagDepth = 32;
+
+    thread_local EMemoryTag GTagStack[MaxTagDepth];
+    thread_local uint32 GTagDepth = 0;
+
+    constexpr uint32 NumTags = static_cast<uint32>(EMemoryTag::Count);
+
+    /**
+     * 스레드별 통계. 소유 스레드만 쓰므로 relaxed load / store로 갱신하고, 읽을 때 모든 스레드의 값을 더합니다.
+     * 다른 스레드에서 해제한 할당은 해제한 스레드의 값에서 빠지므로 스레드 하나의 값은 음수일 수 있지만 합은 맞습니다.
+     */
+    struct FThreadMemoryCounters
+    {
+        std::atomic<int64> AllocationBytes[EAT_Count];
+        std::atomic<int64> AllocationCount[EAT_Count];
+        std::atomic<int64> TagBytes[NumTags];
+        std::atomic<int64> TagCount[NumTags];
+        std::atomic<int64> TagTotalAllocations[NumTags];
+        FThreadMemoryCounters* Next;
+    };
+
+    // 한 번 등록된 카운터는 스레드가 끝나도 합계에 남아야 하므로 해제하지 않음
+    std::atomic<FThreadMemoryCounters*> GThreadCounters = nullptr;
+    thread_local FThreadMemoryCounters* GLocalCounters = nullptr;
+
+    // 카운터를 못 만든 스레드가 같이 쓰는 예비 카운터. 이 경우에만 값이 부정확할 수 있음
+    FThreadMemoryCounters GFallbackCounters = {};
+
+    std::atomic<int64> GTagPeakBytes[NumTags] = {};
+
+    const char* const GTagNames[NumTags] = {
+        "Untagged",
+        "Names",
+        "StaticMesh",
+        "SkeletalMesh",
+        "Texture",
+        "Lua",
+        "RenderData",
+        "World",
+        "UI",
+        "Audio",
+    };
+
+    /**
+     * 샘플링된 Call Stack을 모아두는 고정 크기 Open Addressing 테이블.
+     * 할당 경로 안에서 쓰이므로 자체적으로는 절대 Heap을 쓰지 않습니다.
+     * 조회는 Lock 없이 Hash만 비교하고, 새 슬롯을 채울 때만 Spin Lock을 잡습니다.
+     */
+    constexpr uint32 MaxSites = 4096;       // 2의 거듭제곱
+    constexpr uint32 MaxProbe = 64;
+
+    struct FSiteSlot
+    {
+        std::atomic<uint64> Hash;           // 0이면 빈 슬롯. 나머지 필드를 다 쓴 뒤에 공개
+        void* Frames[FAllocationSiteInfo::MaxFrames];
+        uint32 NumFrames;
+        EMemoryTag Tag;
+
+        std::atomic<int64> Bytes;
+        std::atomic<int64> Count;
+        std::atomic<uint64> TotalSampled;
+    };
+
+    FSiteSlot GSites[MaxSites];
+    std::atomic_flag GSiteLock;
+    std::atomic<uint8> GSiteGeneration = 1;
+    std::atomic<uint32> GSampleInterval = 0;
+    thread_local uint32 GSampleCounter = 0;
+
+    FThreadMemoryCounters& GetLocalCounters()
+    {
+        if (GLocalCounters == nullptr)
+        {
+            // 할당 경로 안이므로 추적되지 않는 calloc으로 만듦
+            void* Memory = std::calloc(1, sizeof(FThreadMemoryCounters));
+            if (Memory == nullptr)
+            {
+                return GFallbackCounters;
+            }
+
+            FThreadMemoryCounters* Counters = new (Memory) FThreadMemoryCounters{};
+            Counters->Next = GThreadCounters.load(std::memory_order_relaxed);
+            while (!GThreadCounters.compare_exchange_weak(Counters->Next, Counters, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            GLocalCounters = Counters;
+        }
+        return *GLocalCounters;
+    }
+
+    FORCEINLINE void AddCounter(std::atomic<int64>& Counter, int64 Delta)
+    {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+    }
+
+    template <typename FuncType>
+    int64 SumCounters(const FuncType& GetCounter)
+    {
+        int64 Sum = GetCounter(GFallbackCounters).load(std::memory_order_relaxed);
+        for (FThreadMemoryCounters* Counters = GThreadCounters.load(std::memory_order_acquire); Counters; Counters = Counters->Next)
+        {
+            Sum += GetCounter(*Counters).load(std::memory_order_relaxed);
+        }
+        return Sum;
+    }
+
+    void AddAllocationStats(EAllocationType AllocType, EMemoryTag Tag, int64 Size)
+    {
+        FThreadMemoryCounters& Counters = GetLocalCounters();
+        const uint32 TagIndex = static_cast<uint32>(Tag);
+        AddCounter(Counters.AllocationBytes[AllocType], Size);
+        AddCounter(Counters.AllocationCount[AllocType], 1);
+        AddCounter(Counters.TagBytes[TagIndex], Size);
+        AddCounter(Counters.TagCount[TagIndex], 1);
+        AddCounter(Counters.TagTotalAllocations[TagIndex], 1);
+    }
+
+    void RemoveAllocationStats(EAllocationType AllocType, EMemoryTag Tag, int64 Size)
+    {
+        FThreadMemoryCounters& Counters = GetLocalCounters();
+        const uint32 TagIndex = static_cast<uint32>(Tag);
+        AddCounter(Counters.AllocationBytes[AllocType], -Size);
+        AddCounter(Counters.AllocationCount[AllocType], -1);
+        AddCounter(Counters.TagBytes[TagIndex], -Size);
+        AddCounter(Counters.TagCount[TagIndex], -1);
+    }
+
+    int64 UpdatePeak(uint32 TagIndex)
+    {
+        const int64 Bytes = SumCounters([TagIndex](FThreadMemoryCounters& Counters) -> std::atomic<int64>& { return Counters.TagBytes[TagIndex]; });
+
+        int64 Peak = GTagPeakBytes[TagIndex].load(std::memory_order_relaxed);
+        while (Bytes > Peak && !GTagPeakBytes[TagIndex].compare_exchange_weak(Peak, Bytes, std::memory_order_relaxed))
+        {
+        }
+        return Bytes;
+    }
+
+    uint64 HashFrames(void* const* Frames, uint32 NumFrames, EMemoryTag Tag)
+    {
+        // FNV-1a
+        uint64 Hash = 14695981039346656037ull ^ static_cast<uint64>(Tag);
+        for (uint32 Index = 0; Index < NumFrames; ++Index)
+        {
+            Hash = (Hash ^ reinterpret_cast<uint64>(Frames[Index])) * 1099511628211ull;
+        }
+        return Hash != 0 ? Hash : 1;
+    }
+
+    // 현재 Call Stack에 해당하는 슬롯을 찾거나 만듭니다. 테이블이 가득 차면 0
+    uint16 FindOrAddSite(EMemoryTag Tag)
+    {
+        void* Frames[FAllocationSiteInfo::MaxFrames];
+        // FindOrAddSite / SampleAllocation / TrackedMalloc는 건너뜀
+        const uint32 NumFrames = RtlCaptureStackBackTrace(3, FAllocationSiteInfo::MaxFrames, Frames, nullptr);
+        const uint64 Hash = HashFrames(Frames, NumFrames, Tag);
+
+        uint32 Slot = static_cast<uint32>(Hash) & (MaxSites - 1);
+        for (uint32 Probe = 0; Probe < MaxProbe; ++Probe, Slot = (Slot + 1) & (MaxSites - 1))
+        {
+            FSiteSlot& Site = GSites[Slot];
+            uint64 SlotHash = Site.Hash.load(std::memory_order_acquire);
+            if (SlotHash == 0)
+            {
+                while (GSiteLock.test_and_set(std::memory_order_acquire))
+                {
+                }
+
+                SlotHash = Site.Hash.load(std::memory_order_relaxed);
+                if (SlotHash == 0)
+                {
+                    std::memcpy(Site.Frames, Frames, sizeof(void*) * NumFrames);
+                    Site.NumFrames = NumFrames;
+                    Site.Tag = Tag;
+                    Site.Hash.store(Hash, std::memory_order_release);
+                    SlotHash = Hash;
+                }
+
+                GSiteLock.clear(std::memory_order_release);
+            }
+
+            if (SlotHash == Hash)
+            {
+                return static_cast<uint16>(Slot + 1);
+            }
+        }
+        return 0;
+    }
+
+    void SampleAllocation(FAllocationHeader& Header)
+    {
+        const uint16 SiteIndex = FindOrAddSite(Header.Tag);
+        if (SiteIndex == 0)
+        {
+            return;
+        }
+
+        FSiteSlot& Site = GSites[SiteIndex - 1];
+        Site.Bytes.fetch_add(static_cast<int64>(Header.Size), std::memory_order_relaxed);
+        Site.Count.fetch_add(1, std::memory_order_relaxed);
+        Site.TotalSampled.fetch_add(1, std::memory_order_relaxed);
+
+        Header.SiteIndex = SiteIndex;
+        Header.SiteGeneration = GSiteGeneration.load(std::memory_order_relaxed);
+    }
+
+    void UnsampleAllocation(const FAllocationHeader& Header)
+    {
+        if (Header.SiteIndex == 0 || Header.SiteGeneration != GSiteGeneration.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        FSiteSlot& Site = GSites[Header.SiteIndex - 1];
+        Site.Bytes.fetch_sub(static_cast<int64>(Header.Size), std::memory_order_relaxed);
+        Site.Count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    FAllocationHeader* GetHeader(void* Address)
+    {
+        return static_cast<FAllocationHeader*>(Address) - 1;
+    }
+}
+
+void* FPlatformMemory::TrackedMalloc(size_t Size, size_t Alignment, EAllocationType AllocType)
+{
+    const bool bAligned = Alignment != 0;
+    const size_t BaseOffset = Alignment > HeaderSize ? Alignment : HeaderSize;
+
+    uint8* Base = bAligned
+        ? static_cast<uint8*>(_aligned_malloc(Size + BaseOffset, BaseOffset))
+        : static_cast<uint8*>(std::malloc(Size + HeaderSize));
+    if (!Base)
+    {
+        return nullptr;
+    }
+
+    uint8* Address = Base + BaseOffset;
+    FAllocationHeader& Header = *GetHeader(Address);
+    Header.Size = Size;
+    Header.SiteIndex = 0;
+    Header.SiteGeneration = 0;
+    Header.bAligned = bAligned;
+    Header.BaseOffset = static_cast<uint16>(BaseOffset);
+    Header.Tag = GetCurrentTag();
+    Header.AllocType = AllocType;
+
+    AddAllocationStats(AllocType, Header.Tag, static_cast<int64>(Size));
+
+    const uint32 Interval = GSampleInterval.load(std::memory_order_relaxed);
+    if (Interval != 0 && ++GSampleCounter >= Interval)
+    {
+        GSampleCounter = 0;
+        SampleAllocation(Header);
+    }
+
+    return Address;
+}
+
+void* FPlatformMemory::TrackedRealloc(void* Address, size_t NewSize, EAllocationType AllocType)
+{
+    if (!Address)
+    {
+        return TrackedMalloc(NewSize, 0, AllocType);
+    }
+
+    FAllocationHeader* Header = GetHeader(Address);
+    if (Header->bAligned)
+    {
+        // 정렬 할당은 제자리 Realloc을 지원하지 않으므로 복사
+        void* NewAddress = TrackedMalloc(NewSize, Header->BaseOffset, AllocType);
+        if (NewAddress)
+        {
+            std::memcpy(NewAddress, Address, Header->Size < NewSize ? Header->Size : NewSize);
+            TrackedFree(Address);
+        }
+        return NewAddress;
+    }
+
+    const FAllocationHeader OldHeader = *Header;
+    uint8* NewBase = static_cast<uint8*>(std::realloc(Header, NewSize + HeaderSize));
+    if (!NewBase)
+    {
+        return nullptr;
+    }
+
+    RemoveAllocationStats(OldHeader.AllocType, OldHeader.Tag, static_cast<int64>(OldHeader.Size));
+    UnsampleAllocation(OldHeader);
+
+    // 크기가 바뀐 새 할당으로 취급. 태그는 최초 할당의 것을 유지
+    FAllocationHeader& NewHeader = *reinterpret_cast<FAllocationHeader*>(NewBase);
+    NewHeader.Size = NewSize;
+    NewHeader.SiteIndex = 0;
+    NewHeader.SiteGeneration = 0;
+
+    AddAllocationStats(NewHeader.AllocType, NewHeader.Tag, static_cast<int64>(NewSize));
+
+    const uint32 Interval = GSampleInterval.load(std::memory_order_relaxed);
+    if (Interval != 0 && ++GSampleCounter >= Interval)
+    {
+        GSampleCounter = 0;
+        SampleAllocation(NewHeader);
+    }
+
+    return NewBase + HeaderSize;
+}
+
+void FPlatformMemory::TrackedFree(void* Address)
+{
+    if (!Address)
+    {
+        return;
+    }
+
+    const FAllocationHeader& Header = *GetHeader(Address);
+    RemoveAllocationStats(Header.AllocType, Header.Tag, static_cast<int64>(Header.Size));
+    UnsampleAllocation(Header);
+
+    uint8* Base = static_cast<uint8*>(Address) - Header.BaseOffset;
+    if (Header.bAligned)
+    {
+        _aligned_free(Base);
+    }
+    else
+    {
+        std::free(Base);
+    }
+}
+
+void FPlatformMemory::PushTag(EMemoryTag Tag)
+{
+    // 최대 깊이를 넘으면 깊이만 세고, 맨 위 태그는 마지막으로 기록된 것을 유지
+    if (GTagDepth < MaxTagDepth)
+    {
+        GTagStack[GTagDepth] = Tag;
+    }
+    ++GTagDepth;
+}
+
+void FPlatformMemory::PopTag()
+{
+    if (GTagDepth > 0)
+    {
+        --GTagDepth;
+    }
+}
+
+EMemoryTag FPlatformMemory::GetCurrentTag()
+{
+    if (GTagDepth == 0)
+    {
+        return EMemoryTag::Untagged;
+    }
+    return GTagStack[(GTagDepth < MaxTagDepth ? GTagDepth : MaxTagDepth) - 1];
+}
+
+const char* FPlatformMemory::GetTagName(EMemoryTag Tag)
+{
+    return Tag < EMemoryTag::Count ? GTagNames[static_cast<uint32>(Tag)] : "Unknown";
+}
+
+int64 FPlatformMemory::SumAllocationBytes(EAllocationType AllocType)
+{
+    return SumCounters([AllocType](FThreadMemoryCounters& Counters) -> std::atomic<int64>& { return Counters.AllocationBytes[AllocType]; });
+}
+
+int64 FPlatformMemory::SumAllocationCount(EAllocationType AllocType)
+{
+    return SumCounters([AllocType](FThreadMemoryCounters& Counters) -> std::atomic<int64>& { return Counters.AllocationCount[AllocType]; });
+}
+
+FMemoryTagStats FPlatformMemory::GetTagStats(EMemoryTag Tag)
+{
+    const uint32 TagIndex = static_cast<uint32>(Tag);
+
+    FMemoryTagStats Stats;
+    if (TagIndex < NumTags)
+    {
+        Stats.Bytes = UpdatePeak(TagIndex);
+        Stats.Count = SumCounters([TagIndex](FThreadMemoryCounters& Counters) -> std::atomic<int64>& { return Counters.TagCount[TagIndex]; });
+        Stats.PeakBytes = GTagPeakBytes[TagIndex].load(std::memory_order_relaxed);
+        Stats.TotalAllocations = static_cast<uint64>(
+            SumCounters([TagIndex](FThreadMemoryCounters& Counters) -> std::atomic<int64>& { return Counters.TagTotalAllocations[TagIndex]; })
+        );
+    }
+    return Stats;
+}
+
+void FPlatformMemory::UpdatePeakStats()
+{
+    for (uint32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+    {
+        UpdatePeak(TagIndex);
+    }
+}
+
+void FPlatformMemory::SetSampleInterval(uint32 Interval)
+{
+    GSampleInterval.store(Interval, std::memory_order_relaxed);
+}
+
+uint32 FPlatformMemory::GetSampleInterval()
+{
+    return GSampleInterval.load(std::memory_order_relaxed);
+}
+
+void FPlatformMemory::ResetAllocationSites()
+{
+    while (GSiteLock.test_and_set(std::memory_order_acquire))
+    {
+    }
+
+    // 세대를 바꿔서, 이전에 샘플링된 할당이 해제될 때 새 슬롯을 건드리지 않게 함 (0은 "샘플링 안 됨"용으로 건너뜀)
+    uint8 Generation = GSiteGeneration.load(std::memory_order_relaxed) + 1;
+    GSiteGeneration.store(Generation != 0 ? Generation : 1, std::memory_order_relaxed);
+
+    for (FSiteSlot& Site : GSites)
+    {
+        Site.Hash.store(0, std::memory_order_relaxed);
+        Site.Bytes.store(0, std::memory_order_relaxed);
+        Site.Count.store(0, std::memory_order_relaxed);
+        Site.TotalSampled.store(0, std::memory_order_relaxed);
+    }
+
+    GSiteLock.clear(std::memory_order_release);
+}
+
+uint32 FPlatformMemory::GetNumAllocationSites()
+{
+    return MaxSites;
+}
+
+bool FPlatformMemory::GetAllocationSite(uint32 SiteIndex, FAllocationSiteInfo& OutSite)
+{
+    if (SiteIndex >= MaxSites)
+    {
+        return false;
+    }
+
+    const FSiteSlot& Site = GSites[SiteIndex];
+    if (Site.Hash.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+
+    std::memcpy(OutSite.Frames, Site.Frames, sizeof(void*) * Site.NumFrames);
+    OutSite.NumFrames = Site.NumFrames;
+    OutSite.Tag = Site.Tag;
+    OutSite.Bytes = Site.Bytes.load(std::memory_order_relaxed);
+    OutSite.Count = Site.Count.load(std::memory_order_relaxed);
+    OutSite.TotalSampled = Site.TotalSampled.load(std::memory_order_relaxed);
+    return true;
+}
+
+void FPlatformMemory::DescribeAddress(void* Address, char* OutBuffer, uint32 BufferSize)
+{
+    // DbgHelp는 스레드 안전하지 않으므로 리포트를 출력하는 메인 스레드에서만 호출
+    const HANDLE Process = GetCurrentProcess();
+    static const bool bSymbolsReady = [Process]()
+    {
+        SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+        return SymInitialize(Process, nullptr, TRUE) != FALSE;
+    }();
+
+    const DWORD64 SymbolAddress = reinterpret_cast<DWORD64>(Address);
+    alignas(SYMBOL_INFO) char SymbolBuffer[sizeof(SYMBOL_INFO) + 256];
+    SYMBOL_INFO* Symbol = reinterpret_cast<SYMBOL_INFO*>(SymbolBuffer);
+    Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    Symbol->MaxNameLen = 255;
+
+    DWORD64 Displacement = 0;
+    if (!bSymbolsReady || !SymFromAddr(Process, SymbolAddress, &Displacement, Symbol))
+    {
+        std::snprintf(OutBuffer, BufferSize, "0x%p", Address);
+        return;
+    }
+
+    IMAGEHLP_LINE64 Line = {};
+    Line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+    DWORD LineDisplacement = 0;
+    if (SymGetLineFromAddr64(Process, SymbolAddress, &LineDisplacement, &Line))
+    {
+        const char* FileName = std::strrchr(Line.FileName, '\\');
+        std::snprintf(OutBuffer, BufferSize, "%s (%s:%lu)", Symbol->Name, FileName ? FileName + 1 : Line.FileName, Line.LineNumber);
+    }
+    else
+    {
+        std::snprintf(OutBuffer, BufferSize, "%s+0x%llx", Symbol->Name, Displacement);
+    }
+}
+
+#if MEMORY_TRACK_GLOBAL_NEW
+/**
+ * 전역 operator new / delete 교체.
+ * 엔진 코드와 정적 링크된 라이브러리의 new가 모두 EAT_Global로 집계되고, 현재 태그 스코프를 따릅니다.
+ */
+void* operator new(size_t Size)
+{
+    if (void* Address = FPlatformMemory::Malloc<EAT_Global>(Size))
+    {
+        return Address;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t Size)
+{
+    return operator new(Size);
+}
+
+void* operator new(size_t Size, const std::nothrow_t&) noexcept
+{
+    return FPlatformMemory::Malloc<EAT_Global>(Size);
+}
+
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept
+{
+    return FPlatformMemory::Malloc<EAT_Global>(Size);
+}
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+    if (void* Address = FPlatformMemory::AlignedMalloc<EAT_Global>(Size, static_cast<size_t>(Alignment)))
+    {
+        return Address;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t Size, std::align_val_t Alignment)
+{
+    return operator new(Size, Alignment);
+}
+
+void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+    return FPlatformMemory::AlignedMalloc<EAT_Global>(Size, static_cast<size_t>(Alignment));
+}
+
+void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept
+{
+    return FPlatformMemory::AlignedMalloc<EAT_Global>(Size, static_cast<size_t>(Alignment));
+}
+
+void operator delete(void* Address) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, 0);
+}
+
+void operator delete[](void* Address) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, 0);
+}
+
+void operator delete(void* Address, size_t Size) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, Size);
+}
+
+void operator delete[](void* Address, size_t Size) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, Size);
+}
+
+void operator delete(void* Address, const std::nothrow_t&) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, 0);
+}
+
+void operator delete[](void* Address, const std::nothrow_t&) noexcept
+{
+    FPlatformMemory::Free<EAT_Global>(Address, 0);
+}
+
+void operator delete(void* Address, std::align_val_t) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, 0);
+}
+
+void operator delete[](void* Address, std::align_val_t) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, 0);
+}
+
+void operator delete(void* Address, size_t Size, std::align_val_t) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, Size);
+}
+
+void operator delete[](void* Address, size_t Size, std::align_val_t) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, Size);
+}
+
+void operator delete(void* Address, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, 0);
+}
+
+void operator delete[](void* Address, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FPlatformMemory::AlignedFree<EAT_Global>(Address, 0);
+}
+#endif
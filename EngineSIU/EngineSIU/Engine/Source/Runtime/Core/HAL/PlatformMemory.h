@@ -4,30 +4,87 @@
 
 #include "Core/HAL/PlatformType.h"
 
+/**
+ * 1이면 전역 operator new / delete를 교체해서 모든 new를 EAT_Global로 집계합니다. (PlatformMemory.cpp)
+ * 모든 할당에 헤더와 통계 갱신이 붙고, DLL이 자기 CRT로 할당한 메모리를 엔진의 delete로 해제하면 헤더가 맞지 않으므로 Release에서는 기본으로 끕니다.
+ * 끄면 EAT_Global에는 Lua처럼 Malloc<EAT_Global>을 직접 쓰는 할당만 들어갑니다.
+ */
+#ifndef MEMORY_TRACK_GLOBAL_NEW
+    #ifdef _DEBUG
+        #define MEMORY_TRACK_GLOBAL_NEW 1
+    #else
+        #define MEMORY_TRACK_GLOBAL_NEW 0
+    #endif
+#endif
+
 enum EAllocationType : uint8
 {
     EAT_Object,
-    EAT_Container
+    EAT_Container,
+    EAT_Global,         // 전역 operator new / delete, Lua 등 나머지 Raw 할당
+
+    EAT_Count
+};
+
+/**
+ * 할당을 어느 시스템에 귀속시킬지 나타내는 태그.
+ * 할당 시점에 현재 스레드의 태그 스택 맨 위 값이 기록되고, 해제는 기록된 태그로 차감되므로
+ * 어느 스코프에서 해제하든 통계가 맞습니다.
+ */
+enum class EMemoryTag : uint8
+{
+    Untagged,
+    Names,
+    StaticMesh,
+    SkeletalMesh,
+    Texture,
+    Lua,
+    RenderData,
+    World,
+    UI,
+    Audio,
+
+    Count
+};
+
+struct FMemoryTagStats
+{
+    int64 Bytes = 0;                // 현재 살아있는 할당 크기
+    int64 Count = 0;                // 현재 살아있는 할당 수
+    int64 PeakBytes = 0;            // UpdatePeakStats / GetTagStats 시점에 관찰한 최대값
+    uint64 TotalAllocations = 0;    // 누적 할당 횟수
+};
+
+// 샘플링된 할당 지점 하나의 통계. Bytes / Count는 샘플링된 할당 중 아직 살아있는 것만 셉니다.
+struct FAllocationSiteInfo
+{
+    static constexpr uint32 MaxFrames = 8;
+
+    void* Frames[MaxFrames] = {};
+    uint32 NumFrames = 0;
+    EMemoryTag Tag = EMemoryTag::Untagged;
+
+    int64 Bytes = 0;
+    int64 Count = 0;
+    uint64 TotalSampled = 0;
 };
 
 /**
  * 엔진의 Heap 메모리의 할당량을 추적하는 클래스
  *
- * @note new로 생성한 객체는 추적하지 않습니다.
+ * 모든 할당 앞에 16바이트 헤더(크기, 태그, 샘플링 지점)를 붙여서, 해제할 때 크기와 태그를 다시 알 수 있게 합니다.
+ * 통계는 스레드별 카운터에 Lock / RMW 없이 쌓고, 읽을 때 모든 스레드의 값을 더합니다.
+ * MEMORY_TRACK_GLOBAL_NEW가 1이면 전역 operator new / delete도 EAT_Global로 이 경로를 탑니다.
  */
 struct FPlatformMemory
 {
 private:
-    static std::atomic<uint64> ObjectAllocationBytes;
-    static std::atomic<uint64> ObjectAllocationCount;
-    static std::atomic<uint64> ContainerAllocationBytes;
-    static std::atomic<uint64> ContainerAllocationCount;
+    static int64 SumAllocationBytes(EAllocationType AllocType);
+    static int64 SumAllocationCount(EAllocationType AllocType);
 
-    template <EAllocationType AllocType>
-    static void IncrementStats(size_t Size);
-
-    template <EAllocationType AllocType>
-    static void DecrementStats(size_t Size);
+    static void* TrackedMalloc(size_t Size, size_t Alignment, EAllocationType AllocType);
+    static void* TrackedRealloc(void* Address, size_t NewSize, EAllocationType AllocType);
+    static void TrackedFree(void* Address);
 
 public:
     static void* Memcpy(void* Dest, const void* Src, uint64 Length)
@@ -44,6 +101,11 @@ public:
     template <EAllocationType AllocType>
     static void* AlignedMalloc(size_t Size, size_t Alignment);
 
+    /** Malloc으로 할당한 메모리의 크기를 바꿉니다. Address가 nullptr이면 Malloc과 같습니다. */
+    template <EAllocationType AllocType>
+    static void* Realloc(void* Address, size_t NewSize);
+
+    /** @param Size 할당 시의 크기. 실제 통계는 헤더에 기록된 크기를 사용합니다. */
     template <EAllocationType AllocType>
     static void Free(void* Address, size_t Size);
 
@@ -55,53 +117,62 @@ public:
 
     template <EAllocationType AllocType>
     static uint64 GetAllocationCount();
-};
 
+public:
+    /** 현재 스레드의 태그 스택. FMemoryTagScope / MEMORY_TAG_SCOPE로 사용합니다. */
+    static void PushTag(EMemoryTag Tag);
+    static void PopTag();
+    static EMemoryTag GetCurrentTag();
 
-template <EAllocationType AllocType>
-void FPlatformMemory::IncrementStats(size_t Size)
-{
-    // TotalAllocationBytes += Size;
-    // ++TotalAllocationCount;
+    static const char* GetTagName(EMemoryTag Tag);
+    static FMemoryTagStats GetTagStats(EMemoryTag Tag);
 
-    if constexpr (AllocType == EAT_Container)
-    {
-        ContainerAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
-        ContainerAllocationCount.fetch_add(1, std::memory_order_relaxed);
-    }
-    else if constexpr (AllocType == EAT_Object)
-    {
-        ObjectAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
-        ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
-    }
-    else
-    {
-        //static_assert(false, "Unknown allocation type");
-    }
-}
+    /** 현재 태그별 크기로 최대값을 갱신합니다. 메인 스레드에서 프레임마다 호출합니다. */
+    static void UpdatePeakStats();
 
-template <EAllocationType AllocType>
-void FPlatformMemory::DecrementStats(size_t Size)
-{
-    // TotalAllocationBytes -= Size;
-    // --TotalAllocationCount;
+    /**
+     * 할당 지점 샘플링 간격을 설정합니다. 각 스레드에서 Interval번째 할당마다 Call Stack을 기록합니다.
+     * 0이면 샘플링하지 않습니다.
+     */
+    static void SetSampleInterval(uint32 Interval);
+    static uint32 GetSampleInterval();
 
-    // 멀티스레드 대비
-    if constexpr (AllocType == EAT_Container)
-    {
-        ContainerAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
-        ContainerAllocationCount.fetch_sub(1, std::memory_order_relaxed);
-    }
-    else if constexpr (AllocType == EAT_Object)
+    /** 샘플링된 할당 지점을 살아있는 크기 내림차순으로 가져옵니다. */
+    template <typename ArrayType>
+    static void GatherAllocationSites(ArrayType& OutSites);
+
+    /** 지점 테이블을 비웁니다. 이미 샘플링된 할당은 해제되어도 더 이상 집계되지 않습니다. */
+    static void ResetAllocationSites();
+
+    /** 주소를 "Function (File:Line)" 형식으로 씁니다. 심볼이 없으면 주소만 씁니다. */
+    static void DescribeAddress(void* Address, char* OutBuffer, uint32 BufferSize);
+
+private:
+    static uint32 GetNumAllocationSites();
+    static bool GetAllocationSite(uint32 SiteIndex, FAllocationSiteInfo& OutSite);
+};
+
+/** 스코프 동안 현재 스레드의 할당을 Tag로 귀속시킵니다. */
+struct FMemoryTagScope
+{
+    explicit FMemoryTagScope(EMemoryTag Tag)
     {
-        ObjectAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
-        ObjectAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+        FPlatformMemory::PushTag(Tag);
     }
-    else
+
+    ~FMemoryTagScope()
     {
-        //static_assert(false, "Unknown allocation type");
+        FPlatformMemory::PopTag();
     }
-}
+
+    FMemoryTagScope(const FMemoryTagScope&) = delete;
+    FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+};
+
+#define MEMORY_TAG_SCOPE_CONCAT_INNER(A, B) A##B
+#define MEMORY_TAG_SCOPE_CONCAT(A, B) MEMORY_TAG_SCOPE_CONCAT_INNER(A, B)
+#define MEMORY_TAG_SCOPE(Tag) const FMemoryTagScope MEMORY_TAG_SCOPE_CONCAT(MemoryTagScope_, __LINE__)(EMemoryTag::Tag)
+
 
 template <typename T>
 void FPlatformMemory::Memcpy(T& Dest, const T& Src)
@@ -112,78 +183,64 @@ void FPlatformMemory::Memcpy(T& Dest, const T& Src)
 template <EAllocationType AllocType>
 void* FPlatformMemory::Malloc(size_t Size)
 {
-    void* Ptr = std::malloc(Size);
-    if (Ptr)
-    {
-        IncrementStats<AllocType>(Size);
-    }
-    return Ptr;
+    return TrackedMalloc(Size, 0, AllocType);
 }
 
 template <EAllocationType AllocType>
 void* FPlatformMemory::AlignedMalloc(size_t Size, size_t Alignment)
 {
-    void* Ptr = _aligned_malloc(Size, Alignment);
-    if (Ptr)
-    {
-        IncrementStats<AllocType>(Size);
-    }
-    return Ptr;
+    return TrackedMalloc(Size, Alignment, AllocType);
+}
+
+template <EAllocationType AllocType>
+void* FPlatformMemory::Realloc(void* Address, size_t NewSize)
+{
+    return TrackedRealloc(Address, NewSize, AllocType);
 }
 
 template <EAllocationType AllocType>
 void FPlatformMemory::Free(void* Address, size_t Size)
 {
-    if (Address)
-    {
-        DecrementStats<AllocType>(Size);
-        std::free(Address);
-    }
+    TrackedFree(Address);
 }
 
 template <EAllocationType AllocType>
 void FPlatformMemory::AlignedFree(void* Address, size_t Size)
 {
-    if (Address)
-    {
-        DecrementStats<AllocType>(Size);
-        _aligned_free(Address);
-    }
+    TrackedFree(Address);
 }
 
 template <EAllocationType AllocType>
 uint64 FPlatformMemory::GetAllocationBytes()
 {
-    if constexpr (AllocType == EAT_Container)
-    {
-        return ContainerAllocationBytes;
-    }
-    else if constexpr (AllocType == EAT_Object)
-    {
-        return ObjectAllocationBytes;
-    }
-    else
-    {
-        //static_assert(false, "Unknown AllocationType");
-        return -1;
-    }
+    static_assert(AllocType < EAT_Count, "Unknown AllocationType");
+    return static_cast<uint64>(SumAllocationBytes(AllocType));
 }
 
 template <EAllocationType AllocType>
 uint64 FPlatformMemory::GetAllocationCount()
 {
-    if constexpr (AllocType == EAT_Container)
-    {
-        return ContainerAllocationCount;
-    }
-    else if constexpr (AllocType == EAT_Object)
+    static_assert(AllocType < EAT_Count, "Unknown AllocationType");
+    return static_cast<uint64>(SumAllocationCount(AllocType));
+}
+
+template <typename ArrayType>
+void FPlatformMemory::GatherAllocationSites(ArrayType& OutSites)
+{
+    OutSites.Empty();
+
+    const uint32 NumSites = GetNumAllocationSites();
+    for (uint32 SiteIndex = 0; SiteIndex < NumSites; ++SiteIndex)
     {
-        return ObjectAllocationCount;
+        FAllocationSiteInfo Site;
+        if (GetAllocationSite(SiteIndex, Site))
+        {
+            OutSites.Add(Site);
+        }
     }
-    else
+
+    OutSites.Sort([](const FAllocationSiteInfo& A, const FAllocationSiteInfo& B)
     {
-        //static_assert(false, "Unknown AllocationType");
-        return -1;
-    }
+        return A.Bytes > B.Bytes;
+    });
 }
-
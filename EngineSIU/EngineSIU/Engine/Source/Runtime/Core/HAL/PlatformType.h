@@ -31,17 +31,7 @@
 #endif
 
 
-// unsigned int type
-typedef std::uint8_t uint8;
-typedef std::uint16_t uint16;
-typedef std::uint32_t uint32;
-typedef std::uint64_t uint64;
-
-// signed int
-typedef std::int8_t int8;
-typedef std::int16_t int16;
-typedef std::int32_t int32;
-typedef std::int64_t int64;
+#include "PlatformInteger.h"
 
 typedef char ANSICHAR;
 typedef wchar_t WIDECHAR;
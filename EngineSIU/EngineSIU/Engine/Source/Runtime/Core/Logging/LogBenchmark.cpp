@@ -0,0 +1,121 @@
+#include "LogBenchmark.h"
+
+#include <barrier>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LogMacros.h"
+#include "Container/String.h"
+#include "Math/MathUtility.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    FLogCategory LogBenchmarkDisabled("LogBenchmarkDisabled", LogLevel::Error);
+
+    // 이전 UE_LOG(Console::AddLog)와 같은 방식. 여러 스레드에서 부르므로 배열은 잠금
+    struct FSyncLog
+    {
+        std::mutex Mutex;
+        TArray<FString> Items;
+
+        void AddLog(const char* Format, ...)
+        {
+            char Buf[1024];
+            va_list Args;
+            va_start(Args, Format);
+            vsnprintf(Buf, sizeof(Buf), Format, Args);
+            va_end(Args);
+
+            std::scoped_lock Lock(Mutex);
+            Items.Add(std::string(Buf));
+        }
+    };
+
+    /**
+     * NumThreads개 스레드가 동시에 Function(Index)을 NumLogs번 부른 시간의 스레드 평균 (1회당 ns)
+     * 한 프레임에 몰아서 남기는 로그를 흉내 내기 위해 큐의 절반씩 끊어서 부르고, 사이사이 Drain으로 비웁니다. Drain 시간은 빼고 잽니다.
+     */
+    template <typename FunctionType, typename DrainFunctionType>
+    double MeasurePerLogNs(int32 NumThreads, int32 NumLogs, const FunctionType& Function, const DrainFunctionType& Drain)
+    {
+        const int32 BatchSize = static_cast<int32>(FLogger::QueueCapacity / 2) / NumThreads;
+        std::barrier BatchBarrier(NumThreads, [&Drain]() noexcept { Drain(); });
+
+        std::atomic<int64> TotalCycles = 0;
+        std::vector<std::thread> Threads;
+        Threads.reserve(NumThreads);
+        for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+        {
+            Threads.emplace_back([&]
+            {
+                uint64 Cycles = 0;
+                for (int32 BatchStart = 0; BatchStart < NumLogs; BatchStart += BatchSize)
+                {
+                    const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, NumLogs);
+                    const uint64 StartCycles = FPlatformTime::Cycles64();
+                    for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+                    {
+                        Function(Index);
+                    }
+                    Cycles += FPlatformTime::Cycles64() - StartCycles;
+                    BatchBarrier.arrive_and_wait();
+                }
+                TotalCycles.fetch_add(static_cast<int64>(Cycles));
+            });
+        }
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+        return FPlatformTime::ToMilliseconds(static_cast<uint64>(TotalCycles.load())) * 1.0e6 / (static_cast<double>(NumLogs) * NumThreads);
+    }
+}
+
+void FLogBenchmark::Run(int32 NumLogs, TArray<FLogBenchmarkResult>& OutResults)
+{
+    OutResults.Empty();
+
+    for (const int32 NumThreads : { 1, 2, 4 })
+    {
+        FLogBenchmarkResult Result;
+        Result.NumThreads = NumThreads;
+
+        {
+            FSyncLog SyncLog;
+            Result.SyncNs = MeasurePerLogNs(NumThreads, NumLogs, [&SyncLog](int32 Index)
+            {
+                SyncLog.AddLog("Actor %d moved to (%.2f, %.2f, %.2f) by %s", Index, Index * 0.5f, 1.0f, -2.0f, "BenchmarkThread");
+            }, [] {});
+        }
+
+        // 파일 경로가 없으면 콘솔 링 버퍼에만 쓰므로, 전역 로그를 어지럽히지 않도록 따로 만듦
+        FLogger Logger;
+        Logger.Start({});
+        uint64 DrainCycles = 0;
+        Result.AsyncNs = MeasurePerLogNs(NumThreads, NumLogs, [&Logger](int32 Index)
+        {
+            Logger.Log(LogTemp, LogLevel::Display, "Actor %d moved to (%.2f, %.2f, %.2f) by %s", Index, Index * 0.5f, 1.0f, -2.0f, "BenchmarkThread");
+        }, [&Logger, &DrainCycles]
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Logger.Flush();
+            DrainCycles += FPlatformTime::Cycles64() - StartCycles;
+        });
+        Result.DrainMs = FPlatformTime::ToMilliseconds(DrainCycles);
+        Logger.Shutdown();
+
+        OutResults.Add(Result);
+    }
+}
+
+double FLogBenchmark::MeasureDisabledNs(int32 NumLogs)
+{
+    return MeasurePerLogNs(1, NumLogs, [](int32 Index)
+    {
+        UE_LOG_CATEGORY(LogBenchmarkDisabled, LogLevel::Display, "Actor %d moved to (%.2f, %.2f, %.2f)", Index, Index * 0.5f, 1.0f, -2.0f);
+    }, [] {});
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FLogBenchmarkResult
+{
+    int32 NumThreads = 0;
+    double SyncNs = 0.0;            // 이전 Console::AddLog처럼 호출한 스레드에서 vsnprintf 후 배열에 추가 (1회당)
+    double AsyncNs = 0.0;           // FLogger::Log로 큐에 넣기만 함 (1회당)
+    double DrainMs = 0.0;           // 측정 사이사이 로그 스레드가 큐를 비우기를 기다린 시간의 합
+};
+
+/** UE_LOG를 부르는 스레드가 쓰는 시간 측정. 콘솔의 "log bench"에서 호출합니다. */
+struct FLogBenchmark
+{
+    /** 스레드 1, 2, 4개가 각각 NumLogs번 로그를 남긴 평균 시간을 잽니다. 파일과 콘솔에는 남기지 않습니다. */
+    static void Run(int32 NumLogs, TArray<FLogBenchmarkResult>& OutResults);
+
+    /** 꺼진 카테고리의 UE_LOG 1회 비용 */
+    static double MeasureDisabledNs(int32 NumLogs);
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+
+#include "HAL/PlatformType.h"
+
+
+enum class LogLevel : uint8
+{
+    Display,
+    Warning,
+    Error
+};
+
+/**
+ * 로그 카테고리
+ *
+ * 카테고리마다 출력할 최소 LogLevel을 런타임에 바꿀 수 있고, 꺼진 레벨의 UE_LOG는 인자를 평가하지 않습니다.
+ * 다른 전역 객체의 생성자에서 로그를 남겨도 되도록 constinit으로 만들고, 이름 목록 등록은 따로 합니다.
+ */
+class FLogCategory
+{
+public:
+    /** MinLevel을 이 값으로 두면 모든 로그를 끔 */
+    static constexpr uint8 Off = static_cast<uint8>(LogLevel::Error) + 1;
+
+    constexpr FLogCategory(const char* InName, LogLevel InDefaultLevel)
+        : Name(InName)
+        , MinLevel(static_cast<uint8>(InDefaultLevel))
+    {
+    }
+
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+
+    const char* GetName() const { return Name; }
+
+    FORCEINLINE bool IsActive(LogLevel Level) const
+    {
+        return static_cast<uint8>(Level) >= MinLevel.load(std::memory_order_relaxed);
+    }
+
+    uint8 GetMinLevel() const { return MinLevel.load(std::memory_order_relaxed); }
+    void SetMinLevel(uint8 InMinLevel) { MinLevel.store(InMinLevel, std::memory_order_relaxed); }
+
+    /** 등록된 카테고리를 이름으로 찾습니다. (대소문자 무시) */
+    static FLogCategory* Find(const char* InName);
+
+    static FLogCategory* GetFirst() { return First; }
+    FLogCategory* GetNext() const { return Next; }
+
+    /** DEFINE_LOG_CATEGORY가 카테고리를 이름 목록에 넣을 때 사용 */
+    struct FRegistrar
+    {
+        explicit FRegistrar(FLogCategory& Category)
+        {
+            Category.Next = First;
+            First = &Category;
+        }
+    };
+
+private:
+    const char* Name;
+    std::atomic<uint8> MinLevel;
+    FLogCategory* Next = nullptr;
+
+    static inline FLogCategory* First = nullptr;
+};
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName) \
+    extern FLogCategory CategoryName;
+
+#define DEFINE_LOG_CATEGORY(CategoryName, DefaultLevel) \
+    constinit FLogCategory CategoryName(#CategoryName, LogLevel::DefaultLevel); \
+    static FLogCategory::FRegistrar CategoryName##Registrar(CategoryName);
+
+/** 카테고리를 지정하지 않은 UE_LOG */
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp)
@@ -0,0 +1,20 @@
+#pragma once
+#include "LogCategory.h"
+#include "Logger.h"
+
+
+/**
+ * UE_LOG_CATEGORY(LogObject, LogLevel::Warning, "Format %d", Value);
+ * 카테고리에서 꺼진 레벨이면 인자를 평가하지 않고 넘어갑니다.
+ */
+#define UE_LOG_CATEGORY(Category, Level, Format, ...) \
+    do \
+    { \
+        if ((Category).IsActive(Level)) \
+        { \
+            FLogger::Get().Log((Category), (Level), Format, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+/** UE_LOG(LogLevel::Warning, "Format %d", Value); LogTemp 카테고리로 남깁니다. */
+#define UE_LOG(Level, Format, ...) UE_LOG_CATEGORY(LogTemp, Level, Format, ##__VA_ARGS__)
@@ -0,0 +1,651 @@
+#include "Logger.h"
+
+#include <cctype>
+#include <ctime>
+#include <system_error>
+
+#include "Math/MathUtility.h"
+
+
+DEFINE_LOG_CATEGORY(LogTemp, Display)
+
+FLogCategory* FLogCategory::Find(const char* InName)
+{
+    for (FLogCategory* Category = First; Category; Category = Category->Next)
+    {
+        const char* A = Category->Name;
+        const char* B = InName;
+        while (*A && *B && std::tolower(static_cast<unsigned char>(*A)) == std::tolower(static_cast<unsigned char>(*B)))
+        {
+            ++A;
+            ++B;
+        }
+        if (*A == '\0' && *B == '\0')
+        {
+            return Category;
+        }
+    }
+    return nullptr;
+}
+
+
+namespace
+{
+    using LogPrivate::EArgType;
+
+    struct FArg
+    {
+        bool bValid = false;
+        EArgType Type = EArgType::Int;
+        uint64 Bits = 0;
+        const char* String = nullptr;
+        std::wstring WideString;
+
+        int64 AsInt() const
+        {
+            if (Type == EArgType::Double) { return static_cast<int64>(AsDouble()); }
+            return static_cast<int64>(Bits);
+        }
+
+        uint64 AsUInt() const
+        {
+            if (Type == EArgType::Double) { return static_cast<uint64>(AsDouble()); }
+            return Bits;
+        }
+
+        double AsDouble() const
+        {
+            if (Type == EArgType::Int) { return static_cast<double>(static_cast<int64>(Bits)); }
+            if (Type == EArgType::UInt) { return static_cast<double>(Bits); }
+            double Double;
+            std::memcpy(&Double, &Bits, sizeof(Double));
+            return Double;
+        }
+    };
+
+    class FArgReader
+    {
+    public:
+        FArgReader(const uint8* InCursor, const uint8* InEnd)
+            : Cursor(InCursor)
+            , End(InEnd)
+        {
+        }
+
+        FArg Read()
+        {
+            FArg Arg;
+            if (Cursor >= End)
+            {
+                return Arg;
+            }
+
+            Arg.bValid = true;
+            Arg.Type = static_cast<EArgType>(*Cursor++);
+            if (Arg.Type == EArgType::String || Arg.Type == EArgType::WideString)
+            {
+                uint32 Length;
+                std::memcpy(&Length, Cursor, sizeof(Length));
+                Cursor += sizeof(Length);
+                if (Arg.Type == EArgType::String)
+                {
+                    Arg.String = reinterpret_cast<const char*>(Cursor);
+                    Cursor += Length;
+                }
+                else
+                {
+                    // Payload 안에서는 정렬이 맞지 않을 수 있으므로 복사
+                    Arg.WideString.resize(Length - 1);
+                    std::memcpy(Arg.WideString.data(), Cursor, (Length - 1) * sizeof(wchar_t));
+                    Cursor += Length * sizeof(wchar_t);
+                }
+            }
+            else
+            {
+                std::memcpy(&Arg.Bits, Cursor, sizeof(Arg.Bits));
+                Cursor += sizeof(Arg.Bits);
+            }
+            return Arg;
+        }
+
+    private:
+        const uint8* Cursor;
+        const uint8* End;
+    };
+
+    template <typename ValueType>
+    void AppendFormatted(std::string& OutMessage, const char* Spec, ValueType Value)
+    {
+        char Buffer[256];
+        const int Length = std::snprintf(Buffer, sizeof(Buffer), Spec, Value);
+        if (Length < 0)
+        {
+            return;
+        }
+        if (Length < static_cast<int>(sizeof(Buffer)))
+        {
+            OutMessage.append(Buffer, Length);
+            return;
+        }
+
+        const size_t Offset = OutMessage.size();
+        OutMessage.resize(Offset + Length + 1);
+        std::snprintf(OutMessage.data() + Offset, Length + 1, Spec, Value);
+        OutMessage.resize(Offset + Length);
+    }
+
+    void FormatTimestamp(int64 TimeTicks, char (&OutBuffer)[32])
+    {
+        using namespace std::chrono;
+        const system_clock::time_point Time{ system_clock::duration(TimeTicks) };
+        const std::time_t Seconds = system_clock::to_time_t(Time);
+        const int32 Milliseconds = static_cast<int32>(duration_cast<milliseconds>(Time.time_since_epoch()).count() % 1000);
+
+        std::tm LocalTime = {};
+#ifdef _WIN32
+        localtime_s(&LocalTime, &Seconds);
+#else
+        localtime_r(&Seconds, &LocalTime);
+#endif
+        std::snprintf(
+            OutBuffer, sizeof(OutBuffer), "%04d.%02d.%02d-%02d.%02d.%02d:%03d",
+            LocalTime.tm_year + 1900, LocalTime.tm_mon + 1, LocalTime.tm_mday,
+            LocalTime.tm_hour, LocalTime.tm_min, LocalTime.tm_sec, Milliseconds
+        );
+    }
+
+    const char* GetLevelName(LogLevel Level)
+    {
+        switch (Level)
+        {
+        case LogLevel::Display: return "Display";
+        case LogLevel::Warning: return "Warning";
+        case LogLevel::Error:   return "Error";
+        }
+        return "";
+    }
+}
+
+
+void FLogger::FormatMessage(const char* Format, const uint8* Payload, uint32 PayloadSize, std::string& OutMessage)
+{
+    OutMessage.clear();
+    if (Format == nullptr)
+    {
+        return;
+    }
+
+    FArgReader Reader(Payload, Payload + PayloadSize);
+    std::string Spec;
+
+    const char* Cursor = Format;
+    while (*Cursor)
+    {
+        if (*Cursor != '%')
+        {
+            const char* Next = std::strchr(Cursor, '%');
+            const size_t Length = Next ? static_cast<size_t>(Next - Cursor) : std::strlen(Cursor);
+            OutMessage.append(Cursor, Length);
+            Cursor += Length;
+            continue;
+        }
+
+        if (Cursor[1] == '%')
+        {
+            OutMessage.push_back('%');
+            Cursor += 2;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conversion
+        const char* SpecStart = Cursor++;
+        Spec.assign("%");
+        while (*Cursor && std::strchr("-+ #0", *Cursor))
+        {
+            Spec.push_back(*Cursor++);
+        }
+        for (int32 Part = 0; Part < 2; ++Part)
+        {
+            if (Part == 1)
+            {
+                if (*Cursor != '.')
+                {
+                    break;
+                }
+                Spec.push_back(*Cursor++);
+            }
+            if (*Cursor == '*')
+            {
+                Spec += std::to_string(static_cast<int32>(Reader.Read().AsInt()));
+                ++Cursor;
+            }
+            while (std::isdigit(static_cast<unsigned char>(*Cursor)))
+            {
+                Spec.push_back(*Cursor++);
+            }
+        }
+
+        // 길이 지정자는 저장된 타입에 맞춰 다시 붙이므로 버림
+        while (*Cursor && std::strchr("hlLzjtqI0123456789", *Cursor))
+        {
+            ++Cursor;
+        }
+
+        const char Conversion = *Cursor;
+        if (Conversion == '\0')
+        {
+            OutMessage.append(SpecStart);
+            break;
+        }
+        ++Cursor;
+
+        if (Conversion == 'n')
+        {
+            continue;
+        }
+
+        const FArg Arg = Reader.Read();
+        if (!Arg.bValid)
+        {
+            OutMessage.append(SpecStart, Cursor - SpecStart);
+            continue;
+        }
+
+        switch (Conversion)
+        {
+        case 'd':
+        case 'i':
+            Spec += "lld";
+            AppendFormatted(OutMessage, Spec.c_str(), static_cast<long long>(Arg.AsInt()));
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            Spec += "ll";
+            Spec.push_back(Conversion);
+            AppendFormatted(OutMessage, Spec.c_str(), static_cast<unsigned long long>(Arg.AsUInt()));
+            break;
+        case 'c':
+            Spec.push_back('c');
+            AppendFormatted(OutMessage, Spec.c_str(), static_cast<int>(Arg.AsInt()));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            Spec.push_back(Conversion);
+            AppendFormatted(OutMessage, Spec.c_str(), Arg.AsDouble());
+            break;
+        case 'p':
+            Spec.push_back('p');
+            AppendFormatted(OutMessage, Spec.c_str(), reinterpret_cast<const void*>(static_cast<uintptr_t>(Arg.Bits)));
+            break;
+        case 's':
+        case 'S':
+            if (Arg.Type == EArgType::String)
+            {
+                Spec.push_back('s');
+                AppendFormatted(OutMessage, Spec.c_str(), Arg.String);
+            }
+            else if (Arg.Type == EArgType::WideString)
+            {
+                Spec += "ls";
+                AppendFormatted(OutMessage, Spec.c_str(), Arg.WideString.c_str());
+            }
+            else
+            {
+                OutMessage.append("(invalid)");
+            }
+            break;
+        default:
+            OutMessage.append(SpecStart, Cursor - SpecStart);
+            break;
+        }
+    }
+}
+
+
+FLogger& FLogger::Get()
+{
+    static FLogger Instance;
+    return Instance;
+}
+
+FLogger::FLogger()
+{
+    Records = new FRecord[QueueCapacity];
+    for (uint32 Index = 0; Index < QueueCapacity; ++Index)
+    {
+        Records[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+    ConsoleLines.Reserve(ConsoleCapacity);
+}
+
+FLogger::~FLogger()
+{
+    Shutdown();
+    delete[] Records;
+}
+
+void FLogger::Start(const std::filesystem::path& InFilePath)
+{
+    if (bRunning.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock Lock(WriteMutex);
+        FilePath = InFilePath;
+        OpenFile(true);
+    }
+
+    bStopRequested.store(false, std::memory_order_relaxed);
+    LogThread = std::thread(&FLogger::ThreadMain, this);
+    bRunning.store(true, std::memory_order_release);
+}
+
+void FLogger::Shutdown()
+{
+    if (!bRunning.exchange(false, std::memory_order_seq_cst))
+    {
+        return;
+    }
+
+    bStopRequested.store(true, std::memory_order_release);
+    {
+        std::scoped_lock Lock(WakeMutex);
+        WakeCondition.notify_one();
+    }
+    if (LogThread.joinable())
+    {
+        LogThread.join();
+    }
+
+    // bRunning을 내리기 직전에 들어온 로그. 아직 Slot을 채우는 중인 스레드가 있으면 끝날 때까지 비우며 기다림
+    // (큐가 가득 차 AcquireRecord에서 기다리는 스레드도 있을 수 있으므로 기다리는 동안에도 비워야 함)
+    std::scoped_lock Lock(WriteMutex);
+    while (true)
+    {
+        const bool bNoProducers = NumInFlightProducers.load(std::memory_order_seq_cst) == 0;
+
+        bool bProcessed = false;
+        while (ProcessOne())
+        {
+            bProcessed = true;
+        }
+
+        if (bNoProducers)
+        {
+            break;
+        }
+        if (!bProcessed)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (File)
+    {
+        std::fclose(File);
+        File = nullptr;
+    }
+}
+
+void FLogger::Flush()
+{
+    if (!bRunning.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    const uint64 Target = EnqueuePosition.load(std::memory_order_acquire);
+    {
+        std::scoped_lock Lock(WakeMutex);
+        WakeCondition.notify_one();
+    }
+    while (ProcessedPosition.load(std::memory_order_acquire) < Target && bRunning.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+FLogger::FRecord& FLogger::AcquireRecord(uint64& OutPosition)
+{
+    uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        FRecord& Record = Records[Position & (QueueCapacity - 1)];
+        const uint64 Sequence = Record.Sequence.load(std::memory_order_acquire);
+        const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+        if (Difference == 0)
+        {
+            if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                OutPosition = Position;
+                return Record;
+            }
+        }
+        else if (Difference < 0)
+        {
+            // 가득 참. 로그 스레드가 비울 때까지 기다림
+            NumQueueFullWaits.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::scoped_lock Lock(WakeMutex);
+                WakeCondition.notify_one();
+            }
+            std::this_thread::yield();
+            Position = EnqueuePosition.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            Position = EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void FLogger::PublishRecord(FRecord& Record, uint64 Position)
+{
+    Record.Sequence.store(Position + 1, std::memory_order_release);
+
+    // 로그 스레드가 자고 있을 때만 깨움. 놓치더라도 로그 스레드가 잠깐씩 깨어나 확인함
+    if (bConsumerSleeping.load(std::memory_order_relaxed))
+    {
+        std::scoped_lock Lock(WakeMutex);
+        WakeCondition.notify_one();
+    }
+}
+
+bool FLogger::ProcessOne()
+{
+    FRecord& Record = Records[DequeuePosition & (QueueCapacity - 1)];
+    if (Record.Sequence.load(std::memory_order_acquire) != DequeuePosition + 1)
+    {
+        return false;
+    }
+
+    const uint8* Payload = Record.HeapPayload ? Record.HeapPayload : Record.Payload;
+    std::string Message;
+    FormatMessage(Record.Format, Payload, Record.PayloadSize, Message);
+    WriteLine(Record.Category, Record.Level, Record.TimeTicks, Record.ThreadIndex, Message);
+
+    delete[] Record.HeapPayload;
+    Record.HeapPayload = nullptr;
+
+    Record.Sequence.store(DequeuePosition + QueueCapacity, std::memory_order_release);
+    ++DequeuePosition;
+    ProcessedPosition.store(DequeuePosition, std::memory_order_release);
+    return true;
+}
+
+void FLogger::ThreadMain()
+{
+    while (true)
+    {
+        {
+            // Shutdown 직전에 WriteImmediate와 겹칠 수 있으므로 파일은 WriteMutex 안에서만 씀
+            std::scoped_lock Lock(WriteMutex);
+
+            bool bProcessedAny = false;
+            while (ProcessOne())
+            {
+                bProcessedAny = true;
+            }
+
+            if (bProcessedAny && File)
+            {
+                std::fflush(File);
+            }
+        }
+
+        if (bStopRequested.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        std::unique_lock Lock(WakeMutex);
+        bConsumerSleeping.store(true, std::memory_order_relaxed);
+        WakeCondition.wait_for(Lock, std::chrono::milliseconds(10));
+        bConsumerSleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+void FLogger::WriteImmediate(const FLogCategory& Category, LogLevel Level, const char* Format, const uint8* Payload, uint32 PayloadSize)
+{
+    std::string Message;
+    FormatMessage(Format, Payload, PayloadSize, Message);
+
+    std::scoped_lock Lock(WriteMutex);
+    WriteLine(&Category, Level, std::chrono::system_clock::now().time_since_epoch().count(), GetThreadIndex(), Message);
+    if (File)
+    {
+        std::fflush(File);
+    }
+}
+
+void FLogger::WriteLine(const FLogCategory* Category, LogLevel Level, int64 TimeTicks, uint32 ThreadIndex, std::string& Message)
+{
+    if (File)
+    {
+        char Timestamp[32];
+        FormatTimestamp(TimeTicks, Timestamp);
+
+        const int Written = Level == LogLevel::Display
+            ? std::fprintf(File, "[%s][%3u]%s: %s\n", Timestamp, ThreadIndex, Category->GetName(), Message.c_str())
+            : std::fprintf(File, "[%s][%3u]%s: %s: %s\n", Timestamp, ThreadIndex, Category->GetName(), GetLevelName(Level), Message.c_str());
+        FileBytes.fetch_add(FMath::Max(Written, 0), std::memory_order_relaxed);
+
+        if (Level == LogLevel::Error)
+        {
+            std::fflush(File);
+        }
+        if (FileBytes.load(std::memory_order_relaxed) > MaxFileBytes)
+        {
+            OpenFile(true);
+        }
+    }
+
+    {
+        std::scoped_lock Lock(ConsoleMutex);
+        FLogLine Line{ Level, Category, FString(std::move(Message)) };
+        if (ConsoleLines.Num() < ConsoleCapacity)
+        {
+            ConsoleLines.Add(std::move(Line));
+        }
+        else
+        {
+            ConsoleLines[ConsoleHead] = std::move(Line);
+            ConsoleHead = (ConsoleHead + 1) % ConsoleCapacity;
+        }
+    }
+    ConsoleVersion.fetch_add(1, std::memory_order_release);
+}
+
+void FLogger::OpenFile(bool bRotateExisting)
+{
+    if (File)
+    {
+        std::fclose(File);
+        File = nullptr;
+    }
+    if (FilePath.empty())
+    {
+        return;
+    }
+
+    std::error_code Error;
+    std::filesystem::create_directories(FilePath.parent_path(), Error);
+    if (bRotateExisting)
+    {
+        RotateFiles();
+    }
+
+#ifdef _WIN32
+    File = _wfopen(FilePath.c_str(), L"wb");
+#else
+    File = std::fopen(FilePath.c_str(), "wb");
+#endif
+    FileBytes.store(0, std::memory_order_relaxed);
+}
+
+void FLogger::RotateFiles()
+{
+    std::error_code Error;
+    if (!std::filesystem::exists(FilePath, Error))
+    {
+        return;
+    }
+
+    // <Name>.log → <Name>.1.log → <Name>.2.log ... 가장 오래된 파일은 지움
+    const auto MakeBackupPath = [this](int32 Index)
+    {
+        std::filesystem::path BackupPath = FilePath;
+        BackupPath.replace_extension(std::to_string(Index) + FilePath.extension().string());
+        return BackupPath;
+    };
+
+    if (MaxBackupFiles <= 0)
+    {
+        std::filesystem::remove(FilePath, Error);
+        return;
+    }
+
+    std::filesystem::remove(MakeBackupPath(MaxBackupFiles), Error);
+    for (int32 Index = MaxBackupFiles - 1; Index >= 1; --Index)
+    {
+        std::filesystem::rename(MakeBackupPath(Index), MakeBackupPath(Index + 1), Error);
+    }
+    std::filesystem::rename(FilePath, MakeBackupPath(1), Error);
+    ++NumFileRotations;
+}
+
+void FLogger::ClearConsole()
+{
+    std::scoped_lock Lock(ConsoleMutex);
+    ConsoleLines.Empty();
+    ConsoleHead = 0;
+}
+
+FLoggerStats FLogger::GetStats() const
+{
+    FLoggerStats Stats;
+    Stats.NumLogged = EnqueuePosition.load(std::memory_order_relaxed);
+    Stats.NumHeapPayloads = NumHeapPayloads.load(std::memory_order_relaxed);
+    Stats.NumQueueFullWaits = NumQueueFullWaits.load(std::memory_order_relaxed);
+    Stats.NumFileRotations = NumFileRotations.load(std::memory_order_relaxed);
+    Stats.FileBytes = FileBytes.load(std::memory_order_relaxed);
+    Stats.FilePath = FString(FilePath.generic_wstring());
+    return Stats;
+}
+
+uint32 FLogger::GetThreadIndex()
+{
+    static std::atomic<uint32> NextThreadIndex = 0;
+    thread_local const uint32 ThreadIndex = NextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return ThreadIndex;
+}
@@ -0,0 +1,333 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "LogCategory.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+
+
+/** 콘솔 창에 보여줄 로그 한 줄 */
+struct FLogLine
+{
+    LogLevel Level;
+    const FLogCategory* Category;
+    FString Message;
+};
+
+struct FLoggerStats
+{
+    uint64 NumLogged = 0;
+    uint64 NumHeapPayloads = 0;     // 인자가 커서 Slot 밖에 따로 할당한 로그
+    uint64 NumQueueFullWaits = 0;   // 큐가 가득 차서 생산자가 기다린 횟수
+    int32 NumFileRotations = 0;
+    int64 FileBytes = 0;
+    FString FilePath;
+};
+
+namespace LogPrivate
+{
+    /**
+     * 캡처한 인자 하나의 인코딩
+     *   Int / UInt / Double / Pointer: EArgType, 8바이트 값
+     *   String / WideString: EArgType, uint32 길이(종료 문자 포함), 문자들
+     */
+    enum class EArgType : uint8
+    {
+        Int,
+        UInt,
+        Double,
+        Pointer,
+        String,
+        WideString,
+    };
+
+    template <typename T>
+    constexpr EArgType GetArgType()
+    {
+        using DecayedType = std::remove_cv_t<std::decay_t<T>>;
+        if constexpr (std::is_same_v<DecayedType, char*> || std::is_same_v<DecayedType, const char*>)
+        {
+            return EArgType::String;
+        }
+        else if constexpr (std::is_same_v<DecayedType, wchar_t*> || std::is_same_v<DecayedType, const wchar_t*>)
+        {
+            return EArgType::WideString;
+        }
+        else if constexpr (std::is_pointer_v<DecayedType> || std::is_same_v<DecayedType, std::nullptr_t>)
+        {
+            return EArgType::Pointer;
+        }
+        else if constexpr (std::is_enum_v<DecayedType>)
+        {
+            return std::is_signed_v<std::underlying_type_t<DecayedType>> ? EArgType::Int : EArgType::UInt;
+        }
+        else if constexpr (std::is_floating_point_v<DecayedType>)
+        {
+            return EArgType::Double;
+        }
+        else if constexpr (std::is_integral_v<DecayedType>)
+        {
+            return std::is_signed_v<DecayedType> ? EArgType::Int : EArgType::UInt;
+        }
+        else
+        {
+            static_assert(sizeof(T) == 0, "UE_LOG arguments must be printf-compatible. Pass FString as *String.");
+            return EArgType::Int;
+        }
+    }
+
+    template <typename T>
+    size_t GetArgSize(const T& Value)
+    {
+        constexpr EArgType Type = GetArgType<T>();
+        if constexpr (Type == EArgType::String)
+        {
+            const char* String = Value ? Value : "(null)";
+            return 1 + sizeof(uint32) + std::strlen(String) + 1;
+        }
+        else if constexpr (Type == EArgType::WideString)
+        {
+            const wchar_t* String = Value ? Value : L"(null)";
+            return 1 + sizeof(uint32) + (std::wcslen(String) + 1) * sizeof(wchar_t);
+        }
+        else
+        {
+            return 1 + sizeof(uint64);
+        }
+    }
+
+    template <typename T>
+    void WriteArg(uint8*& Cursor, const T& Value)
+    {
+        constexpr EArgType Type = GetArgType<T>();
+        *Cursor++ = static_cast<uint8>(Type);
+
+        if constexpr (Type == EArgType::String || Type == EArgType::WideString)
+        {
+            using CharType = std::conditional_t<Type == EArgType::String, char, wchar_t>;
+            const CharType* String = Value;
+            if (String == nullptr)
+            {
+                if constexpr (Type == EArgType::String) { String = "(null)"; }
+                else { String = L"(null)"; }
+            }
+            const uint32 Length = static_cast<uint32>(std::char_traits<CharType>::length(String) + 1);
+            std::memcpy(Cursor, &Length, sizeof(Length));
+            Cursor += sizeof(Length);
+            std::memcpy(Cursor, String, Length * sizeof(CharType));
+            Cursor += Length * sizeof(CharType);
+        }
+        else
+        {
+            uint64 Bits = 0;
+            if constexpr (Type == EArgType::Double)
+            {
+                const double Double = static_cast<double>(Value);
+                std::memcpy(&Bits, &Double, sizeof(Double));
+            }
+            else if constexpr (Type == EArgType::Pointer)
+            {
+                Bits = reinterpret_cast<uintptr_t>(static_cast<const void*>(Value));
+            }
+            else if constexpr (std::is_enum_v<std::decay_t<T>>)
+            {
+                Bits = static_cast<uint64>(static_cast<std::underlying_type_t<std::decay_t<T>>>(Value));
+            }
+            else
+            {
+                Bits = static_cast<uint64>(Value);
+            }
+            std::memcpy(Cursor, &Bits, sizeof(Bits));
+            Cursor += sizeof(Bits);
+        }
+    }
+}
+
+/**
+ * UE_LOG의 백엔드
+ *
+ * 로그를 남기는 스레드는 형식 문자열 포인터와 인자 값만 고정 크기 Slot에 복사해서 다중 생산자 Lock-free 큐(Vyukov)에 넣습니다.
+ * 문자열 만들기(printf 형식 채우기)와 출력은 로그 스레드가 합니다.
+ *   - 콘솔: 최근 ConsoleCapacity 줄만 남기는 링 버퍼
+ *   - 파일: Saved/Logs/<Name>.log. MaxFileBytes를 넘거나 새로 시작할 때 <Name>.1.log, <Name>.2.log ... 로 밀어냄
+ *
+ * 형식 문자열은 문자열 리터럴이어야 합니다. (포인터만 보관하고 나중에 읽음)
+ * Start 전이나 Shutdown 뒤에는 호출한 스레드에서 바로 콘솔 버퍼에 씁니다.
+ */
+class FLogger
+{
+public:
+    static constexpr uint32 QueueCapacity = 4096;       // 2의 거듭제곱이어야 함
+    static constexpr uint32 InlinePayloadSize = 192;
+    static constexpr int32 ConsoleCapacity = 2048;
+
+    static FLogger& Get();
+
+    FLogger();
+    ~FLogger();
+
+    FLogger(const FLogger&) = delete;
+    FLogger& operator=(const FLogger&) = delete;
+
+    /** 로그 스레드와 파일 출력을 시작합니다. 이전 실행의 로그 파일은 백업으로 밀어냅니다. */
+    void Start(const std::filesystem::path& InFilePath);
+
+    /** 큐에 남은 로그를 모두 쓰고 로그 스레드를 멈춥니다. Log 중이던 스레드가 Slot을 다 채울 때까지 기다렸다가 함께 씁니다. */
+    void Shutdown();
+
+    /** 지금까지 넣은 로그가 모두 출력될 때까지 기다립니다. */
+    void Flush();
+
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    template <typename... ArgTypes>
+    void Log(const FLogCategory& Category, LogLevel Level, const char* Format, const ArgTypes&... Args);
+
+    /** 콘솔 버퍼를 오래된 줄부터 훑습니다. 훑는 동안 로그 스레드는 콘솔에 쓰지 못합니다. */
+    template <typename FunctionType>
+    void ForEachConsoleLine(FunctionType&& Function) const;
+
+    void ClearConsole();
+
+    /** 콘솔에 줄이 추가될 때마다 1씩 증가 */
+    uint64 GetConsoleVersion() const { return ConsoleVersion.load(std::memory_order_acquire); }
+
+    FLoggerStats GetStats() const;
+
+    int64 MaxFileBytes = 8 << 20;
+    int32 MaxBackupFiles = 3;
+
+    /** 캡처한 인자로 printf 형식 문자열을 채웁니다. */
+    static void FormatMessage(const char* Format, const uint8* Payload, uint32 PayloadSize, std::string& OutMessage);
+
+private:
+    struct FRecord
+    {
+        std::atomic<uint64> Sequence;
+
+        const FLogCategory* Category;
+        const char* Format;
+        int64 TimeTicks;            // system_clock
+        uint32 ThreadIndex;
+        LogLevel Level;
+
+        uint32 PayloadSize;
+        uint8* HeapPayload;         // InlinePayloadSize보다 크면 따로 할당
+        uint8 Payload[InlinePayloadSize];
+    };
+
+    /** 빈 Slot을 하나 차지합니다. 큐가 가득 차 있으면 로그 스레드가 비울 때까지 기다립니다. */
+    FRecord& AcquireRecord(uint64& OutPosition);
+    void PublishRecord(FRecord& Record, uint64 Position);
+
+    /** 로그 스레드가 없을 때 호출한 스레드에서 바로 출력 */
+    void WriteImmediate(const FLogCategory& Category, LogLevel Level, const char* Format, const uint8* Payload, uint32 PayloadSize);
+
+    void ThreadMain();
+
+    /** 큐에서 하나를 꺼내 출력합니다. 비어 있으면 false. 로그 스레드(또는 멈춘 뒤의 Shutdown)만 호출 */
+    bool ProcessOne();
+
+    void WriteLine(const FLogCategory* Category, LogLevel Level, int64 TimeTicks, uint32 ThreadIndex, std::string& Message);
+    void OpenFile(bool bRotateExisting);
+    void RotateFiles();
+
+    static uint32 GetThreadIndex();
+
+private:
+    FRecord* Records = nullptr;
+    alignas(64) std::atomic<uint64> EnqueuePosition = 0;
+    alignas(64) std::atomic<uint64> ProcessedPosition = 0;
+    uint64 DequeuePosition = 0;
+
+    std::atomic<bool> bRunning = false;
+    std::atomic<bool> bStopRequested = false;
+
+    // bRunning을 확인한 뒤 PublishRecord까지 마치지 않은 Log 호출 수. Shutdown이 이 호출들의 로그까지 비움
+    alignas(64) std::atomic<int32> NumInFlightProducers = 0;
+    std::atomic<bool> bConsumerSleeping = false;
+    std::thread LogThread;
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+
+    // 파일 출력은 로그 스레드만 (스레드가 없을 때는 WriteMutex를 잡고)
+    std::mutex WriteMutex;
+    std::filesystem::path FilePath;
+    std::FILE* File = nullptr;
+    std::atomic<int64> FileBytes = 0;
+    std::atomic<int32> NumFileRotations = 0;
+
+    // 콘솔 링 버퍼
+    mutable std::mutex ConsoleMutex;
+    TArray<FLogLine> ConsoleLines;
+    int32 ConsoleHead = 0;
+    std::atomic<uint64> ConsoleVersion = 0;
+
+    std::atomic<uint64> NumHeapPayloads = 0;
+    std::atomic<uint64> NumQueueFullWaits = 0;
+};
+
+template <typename... ArgTypes>
+void FLogger::Log(const FLogCategory& Category, LogLevel Level, const char* Format, const ArgTypes&... Args)
+{
+    const size_t PayloadSize = (size_t{ 0 } + ... + LogPrivate::GetArgSize(Args));
+
+    // Shutdown은 bRunning을 내린 뒤 이 값이 0이 되기를 기다리므로, 둘 다 seq_cst로 순서를 맞춤
+    NumInFlightProducers.fetch_add(1, std::memory_order_seq_cst);
+    if (!bRunning.load(std::memory_order_seq_cst))
+    {
+        NumInFlightProducers.fetch_sub(1, std::memory_order_release);
+
+        TArray<uint8> Payload;
+        Payload.SetNum(static_cast<int32>(PayloadSize));
+        uint8* Cursor = Payload.GetData();
+        (LogPrivate::WriteArg(Cursor, Args), ...);
+        WriteImmediate(Category, Level, Format, Payload.GetData(), static_cast<uint32>(PayloadSize));
+        return;
+    }
+
+    uint64 Position;
+    FRecord& Record = AcquireRecord(Position);
+    Record.Category = &Category;
+    Record.Format = Format;
+    Record.TimeTicks = std::chrono::system_clock::now().time_since_epoch().count();
+    Record.ThreadIndex = GetThreadIndex();
+    Record.Level = Level;
+    Record.PayloadSize = static_cast<uint32>(PayloadSize);
+    Record.HeapPayload = nullptr;
+
+    uint8* Cursor = Record.Payload;
+    if (PayloadSize > InlinePayloadSize)
+    {
+        Record.HeapPayload = new uint8[PayloadSize];
+        Cursor = Record.HeapPayload;
+        NumHeapPayloads.fetch_add(1, std::memory_order_relaxed);
+    }
+    (LogPrivate::WriteArg(Cursor, Args), ...);
+
+    PublishRecord(Record, Position);
+    NumInFlightProducers.fetch_sub(1, std::memory_order_release);
+}
+
+template <typename FunctionType>
+void FLogger::ForEachConsoleLine(FunctionType&& Function) const
+{
+    std::scoped_lock Lock(ConsoleMutex);
+
+    const int32 NumLines = ConsoleLines.Num();
+    const int32 Start = NumLines < ConsoleCapacity ? 0 : ConsoleHead;
+    for (int32 Offset = 0; Offset < NumLines; ++Offset)
+    {
+        Function(ConsoleLines[(Start + Offset) % NumLines]);
+    }
+}
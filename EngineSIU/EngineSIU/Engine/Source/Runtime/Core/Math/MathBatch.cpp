@@ -0,0 +1,706 @@
+#include "MathBatch.h"
+
+#include <atomic>
+#include <cmath>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+
+// GCC / Clang은 함수마다 AVX2를 켜야 프로젝트 전체를 -mavx2 없이 빌드할 수 있음 (MSVC는 필요 없음)
+#if defined(_MSC_VER) && !defined(__clang__)
+#define MATH_BATCH_AVX2
+#else
+#define MATH_BATCH_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+
+namespace
+{
+    /**
+     * FVector / FMatrix와 메모리 배치가 같은 커널 전용 타입
+     * Math 헤더는 FString을 거쳐 Windows.h를 포함하므로, 커널은 이 타입만으로 작성합니다.
+     * 배치가 같은지는 Matrix.h에서 확인합니다.
+     */
+    struct FBatchVector
+    {
+        float X, Y, Z;
+
+        float operator[](int32 Index) const { return (&X)[Index]; }
+    };
+
+    struct alignas(16) FBatchMatrix
+    {
+        alignas(16) float M[4][4];
+    };
+
+    inline FBatchVector Cross(const FBatchVector& A, const FBatchVector& B)
+    {
+        return { A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X };
+    }
+
+    inline float Dot(const FBatchVector& A, const FBatchVector& B)
+    {
+        return A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+    }
+
+    inline FBatchVector Scale(const FBatchVector& V, float Scalar)
+    {
+        return { V.X * Scalar, V.Y * Scalar, V.Z * Scalar };
+    }
+
+    inline FBatchMatrix MakeIdentity()
+    {
+        FBatchMatrix Result = {};
+        Result.M[0][0] = Result.M[1][1] = Result.M[2][2] = Result.M[3][3] = 1.0f;
+        return Result;
+    }
+
+    template <int Index>
+    inline __m128 Replicate(const __m128& Vector)
+    {
+        return _mm_shuffle_ps(Vector, Vector, _MM_SHUFFLE(Index, Index, Index, Index));
+    }
+
+    inline __m128 MultiplyAdd(const __m128& A, const __m128& B, const __m128& C)
+    {
+        return _mm_add_ps(_mm_mul_ps(A, B), C);
+    }
+
+    struct FKernelTable
+    {
+        EMathKernel Kernel;
+        void (*TransformPositions)(const FBatchMatrix&, const FBatchVector*, FBatchVector*, int32);
+        void (*TransformDirections)(const FBatchMatrix&, const FBatchVector*, FBatchVector*, int32);
+        void (*TransformAABB)(const FBatchMatrix&, const FBatchVector&, const FBatchVector&, FBatchVector&, FBatchVector&);
+        void (*TransformAABBs)(const FBatchMatrix&, const FBatchVector*, const FBatchVector*, FBatchVector*, FBatchVector*, int32);
+        void (*InverseAffine)(const FBatchMatrix&, FBatchMatrix&);
+        void (*MultiplyMatrices)(const FBatchMatrix*, const FBatchMatrix*, FBatchMatrix*, int32);
+    };
+
+    /////////////////////////////////////////////////////////////////////////
+    // Scalar
+    /////////////////////////////////////////////////////////////////////////
+    template <bool bPosition>
+    void TransformScalar(const FBatchMatrix& M, const FBatchVector* In, FBatchVector* Out, int32 Num)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const FBatchVector V = In[Index];
+            FBatchVector Result{
+                V.X * M.M[0][0] + V.Y * M.M[1][0] + V.Z * M.M[2][0],
+                V.X * M.M[0][1] + V.Y * M.M[1][1] + V.Z * M.M[2][1],
+                V.X * M.M[0][2] + V.Y * M.M[1][2] + V.Z * M.M[2][2]
+            };
+            if constexpr (bPosition)
+            {
+                Result.X += M.M[3][0];
+                Result.Y += M.M[3][1];
+                Result.Z += M.M[3][2];
+            }
+            Out[Index] = Result;
+        }
+    }
+
+    void TransformAABBScalar(const FBatchMatrix& M, const FBatchVector& Min, const FBatchVector& Max, FBatchVector& OutMin, FBatchVector& OutMax)
+    {
+        const float InMin[3] = { Min.X, Min.Y, Min.Z };
+        const float InMax[3] = { Max.X, Max.Y, Max.Z };
+
+        // 출력 축마다, 입력 축의 min / max 중 작은 쪽과 큰 쪽을 골라 더함
+        float NewMin[3];
+        float NewMax[3];
+        for (int32 Column = 0; Column < 3; ++Column)
+        {
+            NewMin[Column] = M.M[3][Column];
+            NewMax[Column] = M.M[3][Column];
+            for (int32 Row = 0; Row < 3; ++Row)
+            {
+                const float A = M.M[Row][Column] * InMin[Row];
+                const float B = M.M[Row][Column] * InMax[Row];
+                NewMin[Column] += A < B ? A : B;
+                NewMax[Column] += A < B ? B : A;
+            }
+        }
+        OutMin = FBatchVector{ NewMin[0], NewMin[1], NewMin[2] };
+        OutMax = FBatchVector{ NewMax[0], NewMax[1], NewMax[2] };
+    }
+
+    void TransformAABBsScalar(const FBatchMatrix& M, const FBatchVector* Mins, const FBatchVector* Maxs, FBatchVector* OutMins, FBatchVector* OutMaxs, int32 Num)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            TransformAABBScalar(M, Mins[Index], Maxs[Index], OutMins[Index], OutMaxs[Index]);
+        }
+    }
+
+    void InverseAffineScalar(const FBatchMatrix& M, FBatchMatrix& OutInverse)
+    {
+        // 3x3 부분의 역행렬의 열은 다른 두 행의 외적 / 행렬식
+        const FBatchVector R0{ M.M[0][0], M.M[0][1], M.M[0][2] };
+        const FBatchVector R1{ M.M[1][0], M.M[1][1], M.M[1][2] };
+        const FBatchVector R2{ M.M[2][0], M.M[2][1], M.M[2][2] };
+
+        const FBatchVector C0 = Cross(R1, R2);
+        const FBatchVector C1 = Cross(R2, R0);
+        const FBatchVector C2 = Cross(R0, R1);
+
+        const float Determinant = Dot(R0, C0);
+        if (Determinant == 0.0f || !std::isfinite(Determinant))
+        {
+            OutInverse = MakeIdentity();
+            return;
+        }
+        const float RDet = 1.0f / Determinant;
+
+        FBatchMatrix Result;
+        const FBatchVector Columns[3] = { Scale(C0, RDet), Scale(C1, RDet), Scale(C2, RDet) };
+        for (int32 Row = 0; Row < 3; ++Row)
+        {
+            Result.M[Row][0] = Columns[0][Row];
+            Result.M[Row][1] = Columns[1][Row];
+            Result.M[Row][2] = Columns[2][Row];
+            Result.M[Row][3] = 0.0f;
+        }
+
+        // 이동: -T * Inverse(A)
+        for (int32 Column = 0; Column < 3; ++Column)
+        {
+            Result.M[3][Column] = -(M.M[3][0] * Result.M[0][Column] + M.M[3][1] * Result.M[1][Column] + M.M[3][2] * Result.M[2][Column]);
+        }
+        Result.M[3][3] = 1.0f;
+        OutInverse = Result;
+    }
+
+    void MultiplyMatricesScalar(const FBatchMatrix* A, const FBatchMatrix* B, FBatchMatrix* Out, int32 Num)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            FBatchMatrix Result;
+            for (int32 Row = 0; Row < 4; ++Row)
+            {
+                for (int32 Column = 0; Column < 4; ++Column)
+                {
+                    Result.M[Row][Column] =
+                        A[Index].M[Row][0] * B[Index].M[0][Column] + A[Index].M[Row][1] * B[Index].M[1][Column] +
+                        A[Index].M[Row][2] * B[Index].M[2][Column] + A[Index].M[Row][3] * B[Index].M[3][Column];
+                }
+            }
+            Out[Index] = Result;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    // SSE
+    /////////////////////////////////////////////////////////////////////////
+
+    /** FBatchVector 4개(float 12개)를 X, Y, Z 레지스터로 풉니다. */
+    inline void LoadSoA(const FBatchVector* In, __m128& X, __m128& Y, __m128& Z)
+    {
+        const float* Floats = &In->X;
+        const __m128 M0 = _mm_loadu_ps(Floats);         // x0 y0 z0 x1
+        const __m128 M1 = _mm_loadu_ps(Floats + 4);     // y1 z1 x2 y2
+        const __m128 M2 = _mm_loadu_ps(Floats + 8);     // z2 x3 y3 z3
+
+        const __m128 XY = _mm_shuffle_ps(M1, M2, _MM_SHUFFLE(2, 1, 3, 2));  // x2 y2 x3 y3
+        const __m128 YZ = _mm_shuffle_ps(M0, M1, _MM_SHUFFLE(1, 0, 2, 1));  // y0 z0 y1 z1
+        X = _mm_shuffle_ps(M0, XY, _MM_SHUFFLE(2, 0, 3, 0));
+        Y = _mm_shuffle_ps(YZ, XY, _MM_SHUFFLE(3, 1, 2, 0));
+        Z = _mm_shuffle_ps(YZ, M2, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    /** LoadSoA의 반대 */
+    inline void StoreSoA(FBatchVector* Out, const __m128& X, const __m128& Y, const __m128& Z)
+    {
+        const __m128 XY = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 0, 2, 0));    // x0 x2 y0 y2
+        const __m128 YZ = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 1, 3, 1));    // y1 y3 z1 z3
+        const __m128 ZX = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 1, 2, 0));    // z0 z2 x1 x3
+
+        float* Floats = &Out->X;
+        _mm_storeu_ps(Floats, _mm_shuffle_ps(XY, ZX, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(Floats + 4, _mm_shuffle_ps(YZ, XY, _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm_storeu_ps(Floats + 8, _mm_shuffle_ps(ZX, YZ, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+    template <bool bPosition>
+    void TransformSSE(const FBatchMatrix& M, const FBatchVector* In, FBatchVector* Out, int32 Num)
+    {
+        const __m128 M00 = _mm_set1_ps(M.M[0][0]), M01 = _mm_set1_ps(M.M[0][1]), M02 = _mm_set1_ps(M.M[0][2]);
+        const __m128 M10 = _mm_set1_ps(M.M[1][0]), M11 = _mm_set1_ps(M.M[1][1]), M12 = _mm_set1_ps(M.M[1][2]);
+        const __m128 M20 = _mm_set1_ps(M.M[2][0]), M21 = _mm_set1_ps(M.M[2][1]), M22 = _mm_set1_ps(M.M[2][2]);
+        const __m128 M30 = _mm_set1_ps(M.M[3][0]), M31 = _mm_set1_ps(M.M[3][1]), M32 = _mm_set1_ps(M.M[3][2]);
+
+        int32 Index = 0;
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            __m128 X, Y, Z;
+            LoadSoA(In + Index, X, Y, Z);
+
+            __m128 OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M00), _mm_mul_ps(Y, M10)), _mm_mul_ps(Z, M20));
+            __m128 OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M01), _mm_mul_ps(Y, M11)), _mm_mul_ps(Z, M21));
+            __m128 OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M02), _mm_mul_ps(Y, M12)), _mm_mul_ps(Z, M22));
+            if constexpr (bPosition)
+            {
+                OutX = _mm_add_ps(OutX, M30);
+                OutY = _mm_add_ps(OutY, M31);
+                OutZ = _mm_add_ps(OutZ, M32);
+            }
+            StoreSoA(Out + Index, OutX, OutY, OutZ);
+        }
+        TransformScalar<bPosition>(M, In + Index, Out + Index, Num - Index);
+    }
+
+    void TransformAABBSSE(const FBatchMatrix& M, const FBatchVector& Min, const FBatchVector& Max, FBatchVector& OutMin, FBatchVector& OutMax)
+    {
+        const __m128 Half = _mm_set1_ps(0.5f);
+        const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+        const __m128 MinVector = _mm_setr_ps(Min.X, Min.Y, Min.Z, 0.0f);
+        const __m128 MaxVector = _mm_setr_ps(Max.X, Max.Y, Max.Z, 0.0f);
+        const __m128 Center = _mm_mul_ps(_mm_add_ps(MaxVector, MinVector), Half);
+        const __m128 Extent = _mm_mul_ps(_mm_sub_ps(MaxVector, MinVector), Half);
+
+        const __m128 Row0 = _mm_load_ps(M.M[0]);
+        const __m128 Row1 = _mm_load_ps(M.M[1]);
+        const __m128 Row2 = _mm_load_ps(M.M[2]);
+        const __m128 Row3 = _mm_load_ps(M.M[3]);
+
+        // 중심은 그대로 변환하고, 반 크기는 행렬 원소의 절댓값으로 변환
+        __m128 NewCenter = MultiplyAdd(Replicate<0>(Center), Row0, Row3);
+        NewCenter = MultiplyAdd(Replicate<1>(Center), Row1, NewCenter);
+        NewCenter = MultiplyAdd(Replicate<2>(Center), Row2, NewCenter);
+
+        __m128 NewExtent = _mm_mul_ps(Replicate<0>(Extent), _mm_and_ps(Row0, AbsMask));
+        NewExtent = MultiplyAdd(Replicate<1>(Extent), _mm_and_ps(Row1, AbsMask), NewExtent);
+        NewExtent = MultiplyAdd(Replicate<2>(Extent), _mm_and_ps(Row2, AbsMask), NewExtent);
+
+        alignas(16) float NewMin[4];
+        alignas(16) float NewMax[4];
+        _mm_store_ps(NewMin, _mm_sub_ps(NewCenter, NewExtent));
+        _mm_store_ps(NewMax, _mm_add_ps(NewCenter, NewExtent));
+        OutMin = FBatchVector{ NewMin[0], NewMin[1], NewMin[2] };
+        OutMax = FBatchVector{ NewMax[0], NewMax[1], NewMax[2] };
+    }
+
+    void TransformAABBsSSE(const FBatchMatrix& M, const FBatchVector* Mins, const FBatchVector* Maxs, FBatchVector* OutMins, FBatchVector* OutMaxs, int32 Num)
+    {
+        const __m128 Half = _mm_set1_ps(0.5f);
+        const __m128 M00 = _mm_set1_ps(M.M[0][0]), M01 = _mm_set1_ps(M.M[0][1]), M02 = _mm_set1_ps(M.M[0][2]);
+        const __m128 M10 = _mm_set1_ps(M.M[1][0]), M11 = _mm_set1_ps(M.M[1][1]), M12 = _mm_set1_ps(M.M[1][2]);
+        const __m128 M20 = _mm_set1_ps(M.M[2][0]), M21 = _mm_set1_ps(M.M[2][1]), M22 = _mm_set1_ps(M.M[2][2]);
+        const __m128 M30 = _mm_set1_ps(M.M[3][0]), M31 = _mm_set1_ps(M.M[3][1]), M32 = _mm_set1_ps(M.M[3][2]);
+        const __m128 A00 = _mm_set1_ps(std::abs(M.M[0][0])), A01 = _mm_set1_ps(std::abs(M.M[0][1])), A02 = _mm_set1_ps(std::abs(M.M[0][2]));
+        const __m128 A10 = _mm_set1_ps(std::abs(M.M[1][0])), A11 = _mm_set1_ps(std::abs(M.M[1][1])), A12 = _mm_set1_ps(std::abs(M.M[1][2]));
+        const __m128 A20 = _mm_set1_ps(std::abs(M.M[2][0])), A21 = _mm_set1_ps(std::abs(M.M[2][1])), A22 = _mm_set1_ps(std::abs(M.M[2][2]));
+
+        int32 Index = 0;
+        for (; Index + 4 <= Num; Index += 4)
+        {
+            __m128 MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+            LoadSoA(Mins + Index, MinX, MinY, MinZ);
+            LoadSoA(Maxs + Index, MaxX, MaxY, MaxZ);
+
+            const __m128 CX = _mm_mul_ps(_mm_add_ps(MaxX, MinX), Half);
+            const __m128 CY = _mm_mul_ps(_mm_add_ps(MaxY, MinY), Half);
+            const __m128 CZ = _mm_mul_ps(_mm_add_ps(MaxZ, MinZ), Half);
+            const __m128 EX = _mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half);
+            const __m128 EY = _mm_mul_ps(_mm_sub_ps(MaxY, MinY), Half);
+            const __m128 EZ = _mm_mul_ps(_mm_sub_ps(MaxZ, MinZ), Half);
+
+            const __m128 NCX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(CX, M00), _mm_mul_ps(CY, M10)), _mm_add_ps(_mm_mul_ps(CZ, M20), M30));
+            const __m128 NCY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(CX, M01), _mm_mul_ps(CY, M11)), _mm_add_ps(_mm_mul_ps(CZ, M21), M31));
+            const __m128 NCZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(CX, M02), _mm_mul_ps(CY, M12)), _mm_add_ps(_mm_mul_ps(CZ, M22), M32));
+            const __m128 NEX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EX, A00), _mm_mul_ps(EY, A10)), _mm_mul_ps(EZ, A20));
+            const __m128 NEY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EX, A01), _mm_mul_ps(EY, A11)), _mm_mul_ps(EZ, A21));
+            const __m128 NEZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EX, A02), _mm_mul_ps(EY, A12)), _mm_mul_ps(EZ, A22));
+
+            StoreSoA(OutMins + Index, _mm_sub_ps(NCX, NEX), _mm_sub_ps(NCY, NEY), _mm_sub_ps(NCZ, NEZ));
+            StoreSoA(OutMaxs + Index, _mm_add_ps(NCX, NEX), _mm_add_ps(NCY, NEY), _mm_add_ps(NCZ, NEZ));
+        }
+        for (; Index < Num; ++Index)
+        {
+            TransformAABBSSE(M, Mins[Index], Maxs[Index], OutMins[Index], OutMaxs[Index]);
+        }
+    }
+
+    /** A x B의 xyz (w는 0) */
+    inline __m128 CrossSSE(const __m128& A, const __m128& B)
+    {
+        const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 Result = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+        return _mm_shuffle_ps(Result, Result, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    void InverseAffineSSE(const FBatchMatrix& M, FBatchMatrix& OutInverse)
+    {
+        const __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const __m128 Row0 = _mm_and_ps(_mm_load_ps(M.M[0]), XYZMask);
+        const __m128 Row1 = _mm_and_ps(_mm_load_ps(M.M[1]), XYZMask);
+        const __m128 Row2 = _mm_and_ps(_mm_load_ps(M.M[2]), XYZMask);
+        const __m128 Row3 = _mm_load_ps(M.M[3]);
+
+        __m128 Column0 = CrossSSE(Row1, Row2);
+        __m128 Column1 = CrossSSE(Row2, Row0);
+        __m128 Column2 = CrossSSE(Row0, Row1);
+
+        // Row0 · Column0
+        __m128 Dot = _mm_mul_ps(Row0, Column0);
+        Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+        Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(1, 0, 3, 2)));
+        const float Determinant = _mm_cvtss_f32(Dot);
+        if (Determinant == 0.0f || !std::isfinite(Determinant))
+        {
+            OutInverse = MakeIdentity();
+            return;
+        }
+
+        const __m128 RDet = _mm_set1_ps(1.0f / Determinant);
+        Column0 = _mm_mul_ps(Column0, RDet);
+        Column1 = _mm_mul_ps(Column1, RDet);
+        Column2 = _mm_mul_ps(Column2, RDet);
+        __m128 Column3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(Column0, Column1, Column2, Column3);
+
+        // 이동: -T * Inverse(A)
+        __m128 Translation = _mm_mul_ps(Replicate<0>(Row3), Column0);
+        Translation = MultiplyAdd(Replicate<1>(Row3), Column1, Translation);
+        Translation = MultiplyAdd(Replicate<2>(Row3), Column2, Translation);
+        Translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), Translation);
+
+        FBatchMatrix Result;
+        _mm_store_ps(Result.M[0], Column0);
+        _mm_store_ps(Result.M[1], Column1);
+        _mm_store_ps(Result.M[2], Column2);
+        _mm_store_ps(Result.M[3], Translation);
+        OutInverse = Result;
+    }
+
+    inline __m128 MultiplyRow(const __m128& ARow, const __m128& B0, const __m128& B1, const __m128& B2, const __m128& B3)
+    {
+        __m128 Result = _mm_mul_ps(Replicate<0>(ARow), B0);
+        Result = MultiplyAdd(Replicate<1>(ARow), B1, Result);
+        Result = MultiplyAdd(Replicate<2>(ARow), B2, Result);
+        return MultiplyAdd(Replicate<3>(ARow), B3, Result);
+    }
+
+    void MultiplyMatricesSSE(const FBatchMatrix* A, const FBatchMatrix* B, FBatchMatrix* Out, int32 Num)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            const __m128 B0 = _mm_load_ps(B[Index].M[0]);
+            const __m128 B1 = _mm_load_ps(B[Index].M[1]);
+            const __m128 B2 = _mm_load_ps(B[Index].M[2]);
+            const __m128 B3 = _mm_load_ps(B[Index].M[3]);
+
+            // 행 루프로 두면 결과가 스택 배열로 빠져 네 행이 순서대로 계산되므로 풀어서 레지스터에 둠
+            const __m128 Row0 = MultiplyRow(_mm_load_ps(A[Index].M[0]), B0, B1, B2, B3);
+            const __m128 Row1 = MultiplyRow(_mm_load_ps(A[Index].M[1]), B0, B1, B2, B3);
+            const __m128 Row2 = MultiplyRow(_mm_load_ps(A[Index].M[2]), B0, B1, B2, B3);
+            const __m128 Row3 = MultiplyRow(_mm_load_ps(A[Index].M[3]), B0, B1, B2, B3);
+            _mm_store_ps(Out[Index].M[0], Row0);
+            _mm_store_ps(Out[Index].M[1], Row1);
+            _mm_store_ps(Out[Index].M[2], Row2);
+            _mm_store_ps(Out[Index].M[3], Row3);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    // AVX2 + FMA
+    /////////////////////////////////////////////////////////////////////////
+
+    /** FBatchVector 8개를 X, Y, Z 레지스터로 풉니다. 앞 4개는 아래 128비트, 뒤 4개는 위 128비트 */
+    MATH_BATCH_AVX2 inline void LoadSoA(const FBatchVector* In, __m256& X, __m256& Y, __m256& Z)
+    {
+        const float* Floats = &In->X;
+        const __m256 M03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Floats)), _mm_loadu_ps(Floats + 12), 1);
+        const __m256 M14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Floats + 4)), _mm_loadu_ps(Floats + 16), 1);
+        const __m256 M25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Floats + 8)), _mm_loadu_ps(Floats + 20), 1);
+
+        const __m256 XY = _mm256_shuffle_ps(M14, M25, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m256 YZ = _mm256_shuffle_ps(M03, M14, _MM_SHUFFLE(1, 0, 2, 1));
+        X = _mm256_shuffle_ps(M03, XY, _MM_SHUFFLE(2, 0, 3, 0));
+        Y = _mm256_shuffle_ps(YZ, XY, _MM_SHUFFLE(3, 1, 2, 0));
+        Z = _mm256_shuffle_ps(YZ, M25, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    MATH_BATCH_AVX2 inline void StoreSoA(FBatchVector* Out, const __m256& X, const __m256& Y, const __m256& Z)
+    {
+        const __m256 XY = _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 YZ = _mm256_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 ZX = _mm256_shuffle_ps(Z, X, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 R03 = _mm256_shuffle_ps(XY, ZX, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 R14 = _mm256_shuffle_ps(YZ, XY, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 R25 = _mm256_shuffle_ps(ZX, YZ, _MM_SHUFFLE(3, 1, 3, 1));
+
+        float* Floats = &Out->X;
+        _mm_storeu_ps(Floats, _mm256_castps256_ps128(R03));
+        _mm_storeu_ps(Floats + 4, _mm256_castps256_ps128(R14));
+        _mm_storeu_ps(Floats + 8, _mm256_castps256_ps128(R25));
+        _mm_storeu_ps(Floats + 12, _mm256_extractf128_ps(R03, 1));
+        _mm_storeu_ps(Floats + 16, _mm256_extractf128_ps(R14, 1));
+        _mm_storeu_ps(Floats + 20, _mm256_extractf128_ps(R25, 1));
+    }
+
+    template <bool bPosition>
+    MATH_BATCH_AVX2 void TransformAVX2(const FBatchMatrix& M, const FBatchVector* In, FBatchVector* Out, int32 Num)
+    {
+        const __m256 M00 = _mm256_set1_ps(M.M[0][0]), M01 = _mm256_set1_ps(M.M[0][1]), M02 = _mm256_set1_ps(M.M[0][2]);
+        const __m256 M10 = _mm256_set1_ps(M.M[1][0]), M11 = _mm256_set1_ps(M.M[1][1]), M12 = _mm256_set1_ps(M.M[1][2]);
+        const __m256 M20 = _mm256_set1_ps(M.M[2][0]), M21 = _mm256_set1_ps(M.M[2][1]), M22 = _mm256_set1_ps(M.M[2][2]);
+        const __m256 M30 = bPosition ? _mm256_set1_ps(M.M[3][0]) : _mm256_setzero_ps();
+        const __m256 M31 = bPosition ? _mm256_set1_ps(M.M[3][1]) : _mm256_setzero_ps();
+        const __m256 M32 = bPosition ? _mm256_set1_ps(M.M[3][2]) : _mm256_setzero_ps();
+
+        int32 Index = 0;
+        for (; Index + 8 <= Num; Index += 8)
+        {
+            __m256 X, Y, Z;
+            LoadSoA(In + Index, X, Y, Z);
+
+            const __m256 OutX = _mm256_fmadd_ps(Z, M20, _mm256_fmadd_ps(Y, M10, _mm256_fmadd_ps(X, M00, M30)));
+            const __m256 OutY = _mm256_fmadd_ps(Z, M21, _mm256_fmadd_ps(Y, M11, _mm256_fmadd_ps(X, M01, M31)));
+            const __m256 OutZ = _mm256_fmadd_ps(Z, M22, _mm256_fmadd_ps(Y, M12, _mm256_fmadd_ps(X, M02, M32)));
+            StoreSoA(Out + Index, OutX, OutY, OutZ);
+        }
+        TransformSSE<bPosition>(M, In + Index, Out + Index, Num - Index);
+    }
+
+    MATH_BATCH_AVX2 void TransformAABBsAVX2(const FBatchMatrix& M, const FBatchVector* Mins, const FBatchVector* Maxs, FBatchVector* OutMins, FBatchVector* OutMaxs, int32 Num)
+    {
+        const __m256 Half = _mm256_set1_ps(0.5f);
+        const __m256 M00 = _mm256_set1_ps(M.M[0][0]), M01 = _mm256_set1_ps(M.M[0][1]), M02 = _mm256_set1_ps(M.M[0][2]);
+        const __m256 M10 = _mm256_set1_ps(M.M[1][0]), M11 = _mm256_set1_ps(M.M[1][1]), M12 = _mm256_set1_ps(M.M[1][2]);
+        const __m256 M20 = _mm256_set1_ps(M.M[2][0]), M21 = _mm256_set1_ps(M.M[2][1]), M22 = _mm256_set1_ps(M.M[2][2]);
+        const __m256 M30 = _mm256_set1_ps(M.M[3][0]), M31 = _mm256_set1_ps(M.M[3][1]), M32 = _mm256_set1_ps(M.M[3][2]);
+        const __m256 A00 = _mm256_set1_ps(std::abs(M.M[0][0])), A01 = _mm256_set1_ps(std::abs(M.M[0][1])), A02 = _mm256_set1_ps(std::abs(M.M[0][2]));
+        const __m256 A10 = _mm256_set1_ps(std::abs(M.M[1][0])), A11 = _mm256_set1_ps(std::abs(M.M[1][1])), A12 = _mm256_set1_ps(std::abs(M.M[1][2]));
+        const __m256 A20 = _mm256_set1_ps(std::abs(M.M[2][0])), A21 = _mm256_set1_ps(std::abs(M.M[2][1])), A22 = _mm256_set1_ps(std::abs(M.M[2][2]));
+
+        int32 Index = 0;
+        for (; Index + 8 <= Num; Index += 8)
+        {
+            __m256 MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+            LoadSoA(Mins + Index, MinX, MinY, MinZ);
+            LoadSoA(Maxs + Index, MaxX, MaxY, MaxZ);
+
+            const __m256 CX = _mm256_mul_ps(_mm256_add_ps(MaxX, MinX), Half);
+            const __m256 CY = _mm256_mul_ps(_mm256_add_ps(MaxY, MinY), Half);
+            const __m256 CZ = _mm256_mul_ps(_mm256_add_ps(MaxZ, MinZ), Half);
+            const __m256 EX = _mm256_mul_ps(_mm256_sub_ps(MaxX, MinX), Half);
+            const __m256 EY = _mm256_mul_ps(_mm256_sub_ps(MaxY, MinY), Half);
+            const __m256 EZ = _mm256_mul_ps(_mm256_sub_ps(MaxZ, MinZ), Half);
+
+            const __m256 NCX = _mm256_fmadd_ps(CZ, M20, _mm256_fmadd_ps(CY, M10, _mm256_fmadd_ps(CX, M00, M30)));
+            const __m256 NCY = _mm256_fmadd_ps(CZ, M21, _mm256_fmadd_ps(CY, M11, _mm256_fmadd_ps(CX, M01, M31)));
+            const __m256 NCZ = _mm256_fmadd_ps(CZ, M22, _mm256_fmadd_ps(CY, M12, _mm256_fmadd_ps(CX, M02, M32)));
+            const __m256 NEX = _mm256_fmadd_ps(EZ, A20, _mm256_fmadd_ps(EY, A10, _mm256_mul_ps(EX, A00)));
+            const __m256 NEY = _mm256_fmadd_ps(EZ, A21, _mm256_fmadd_ps(EY, A11, _mm256_mul_ps(EX, A01)));
+            const __m256 NEZ = _mm256_fmadd_ps(EZ, A22, _mm256_fmadd_ps(EY, A12, _mm256_mul_ps(EX, A02)));
+
+            StoreSoA(OutMins + Index, _mm256_sub_ps(NCX, NEX), _mm256_sub_ps(NCY, NEY), _mm256_sub_ps(NCZ, NEZ));
+            StoreSoA(OutMaxs + Index, _mm256_add_ps(NCX, NEX), _mm256_add_ps(NCY, NEY), _mm256_add_ps(NCZ, NEZ));
+        }
+        TransformAABBsSSE(M, Mins + Index, Maxs + Index, OutMins + Index, OutMaxs + Index, Num - Index);
+    }
+
+    MATH_BATCH_AVX2 void MultiplyMatricesAVX2(const FBatchMatrix* A, const FBatchMatrix* B, FBatchMatrix* Out, int32 Num)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            // B의 각 행을 양쪽 128비트에 복제하고, A의 두 행을 한 레지스터로 계산
+            const float* BFloats = &B[Index].M[0][0];
+            const __m256 B0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(BFloats));
+            const __m256 B1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(BFloats + 4));
+            const __m256 B2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(BFloats + 8));
+            const __m256 B3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(BFloats + 12));
+
+            const float* AFloats = &A[Index].M[0][0];
+            const __m256 A01 = _mm256_loadu_ps(AFloats);
+            const __m256 A23 = _mm256_loadu_ps(AFloats + 8);
+
+            __m256 R01 = _mm256_mul_ps(_mm256_permute_ps(A01, 0x00), B0);
+            R01 = _mm256_fmadd_ps(_mm256_permute_ps(A01, 0x55), B1, R01);
+            R01 = _mm256_fmadd_ps(_mm256_permute_ps(A01, 0xAA), B2, R01);
+            R01 = _mm256_fmadd_ps(_mm256_permute_ps(A01, 0xFF), B3, R01);
+
+            __m256 R23 = _mm256_mul_ps(_mm256_permute_ps(A23, 0x00), B0);
+            R23 = _mm256_fmadd_ps(_mm256_permute_ps(A23, 0x55), B1, R23);
+            R23 = _mm256_fmadd_ps(_mm256_permute_ps(A23, 0xAA), B2, R23);
+            R23 = _mm256_fmadd_ps(_mm256_permute_ps(A23, 0xFF), B3, R23);
+
+            float* OutFloats = &Out[Index].M[0][0];
+            _mm256_storeu_ps(OutFloats, R01);
+            _mm256_storeu_ps(OutFloats + 8, R23);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    // Dispatch
+    /////////////////////////////////////////////////////////////////////////
+    constexpr FKernelTable ScalarKernel = {
+        EMathKernel::Scalar,
+        TransformScalar<true>, TransformScalar<false>, TransformAABBScalar, TransformAABBsScalar, InverseAffineScalar, MultiplyMatricesScalar,
+    };
+
+    constexpr FKernelTable SSEKernel = {
+        EMathKernel::SSE,
+        TransformSSE<true>, TransformSSE<false>, TransformAABBSSE, TransformAABBsSSE, InverseAffineSSE, MultiplyMatricesSSE,
+    };
+
+    // 상자 하나와 역행렬은 128비트로 충분하므로 SSE를 그대로 사용
+    constexpr FKernelTable AVX2Kernel = {
+        EMathKernel::AVX2,
+        TransformAVX2<true>, TransformAVX2<false>, TransformAABBSSE, TransformAABBsAVX2, InverseAffineSSE, MultiplyMatricesAVX2,
+    };
+
+    bool DetectAVX2()
+    {
+#if defined(_MSC_VER)
+        int Info[4];
+        __cpuid(Info, 0);
+        if (Info[0] < 7)
+        {
+            return false;
+        }
+        __cpuid(Info, 1);
+        const uint32 Features = static_cast<uint32>(Info[2]);
+        __cpuidex(Info, 7, 0);
+        const uint32 ExtendedFeatures = static_cast<uint32>(Info[1]);
+#else
+        uint32 Eax = 0, Ebx = 0, Ecx = 0, Edx = 0;
+        if (__get_cpuid_max(0, nullptr) < 7 || !__get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx))
+        {
+            return false;
+        }
+        const uint32 Features = Ecx;
+        if (!__get_cpuid_count(7, 0, &Eax, &Ebx, &Ecx, &Edx))
+        {
+            return false;
+        }
+        const uint32 ExtendedFeatures = Ebx;
+#endif
+        const bool bFMA = (Features & (1u << 12)) != 0;
+        const bool bOSXSave = (Features & (1u << 27)) != 0;
+        const bool bAVX = (Features & (1u << 28)) != 0;
+        const bool bAVX2 = (ExtendedFeatures & (1u << 5)) != 0;
+        if (!bFMA || !bOSXSave || !bAVX || !bAVX2)
+        {
+            return false;
+        }
+
+        // OS가 YMM 레지스터를 저장해 주는지 확인
+#if defined(_MSC_VER)
+        const uint64 XCR0 = _xgetbv(0);
+#else
+        uint32 XCR0Low, XCR0High;
+        __asm__ volatile("xgetbv" : "=a"(XCR0Low), "=d"(XCR0High) : "c"(0));
+        const uint64 XCR0 = (static_cast<uint64>(XCR0High) << 32) | XCR0Low;
+#endif
+        return (XCR0 & 0x6) == 0x6;
+    }
+
+    std::atomic<const FKernelTable*> ActiveKernel = nullptr;
+
+    const FKernelTable& GetKernelTable()
+    {
+        const FKernelTable* Kernel = ActiveKernel.load(std::memory_order_acquire);
+        if (Kernel == nullptr)
+        {
+            Kernel = FMathBatch::IsKernelSupported(EMathKernel::AVX2) ? &AVX2Kernel : &SSEKernel;
+            ActiveKernel.store(Kernel, std::memory_order_release);
+        }
+        return *Kernel;
+    }
+
+    // FMatrix / FVector는 선언만 보이므로 같은 배치의 커널 타입으로 바꿔 넘깁니다.
+    const FBatchMatrix& AsBatch(const FMatrix& M) { return reinterpret_cast<const FBatchMatrix&>(M); }
+    FBatchMatrix& AsBatch(FMatrix& M) { return reinterpret_cast<FBatchMatrix&>(M); }
+    const FBatchMatrix* AsBatch(const FMatrix* M) { return reinterpret_cast<const FBatchMatrix*>(M); }
+    FBatchMatrix* AsBatch(FMatrix* M) { return reinterpret_cast<FBatchMatrix*>(M); }
+    const FBatchVector& AsBatch(const FVector& V) { return reinterpret_cast<const FBatchVector&>(V); }
+    FBatchVector& AsBatch(FVector& V) { return reinterpret_cast<FBatchVector&>(V); }
+    const FBatchVector* AsBatch(const FVector* V) { return reinterpret_cast<const FBatchVector*>(V); }
+    FBatchVector* AsBatch(FVector* V) { return reinterpret_cast<FBatchVector*>(V); }
+}
+
+
+void FMathBatch::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Num)
+{
+    GetKernelTable().TransformPositions(AsBatch(M), AsBatch(In), AsBatch(Out), Num);
+}
+
+void FMathBatch::TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Num)
+{
+    GetKernelTable().TransformDirections(AsBatch(M), AsBatch(In), AsBatch(Out), Num);
+}
+
+void FMathBatch::TransformAABB(const FMatrix& M, const FVector& Min, const FVector& Max, FVector& OutMin, FVector& OutMax)
+{
+    GetKernelTable().TransformAABB(AsBatch(M), AsBatch(Min), AsBatch(Max), AsBatch(OutMin), AsBatch(OutMax));
+}
+
+void FMathBatch::TransformAABBs(const FMatrix& M, const FVector* Mins, const FVector* Maxs, FVector* OutMins, FVector* OutMaxs, int32 Num)
+{
+    GetKernelTable().TransformAABBs(AsBatch(M), AsBatch(Mins), AsBatch(Maxs), AsBatch(OutMins), AsBatch(OutMaxs), Num);
+}
+
+void FMathBatch::InverseAffine(const FMatrix& M, FMatrix& OutInverse)
+{
+    GetKernelTable().InverseAffine(AsBatch(M), AsBatch(OutInverse));
+}
+
+void FMathBatch::MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Num)
+{
+    GetKernelTable().MultiplyMatrices(AsBatch(A), AsBatch(B), AsBatch(Out), Num);
+}
+
+EMathKernel FMathBatch::GetKernel()
+{
+    return GetKernelTable().Kernel;
+}
+
+bool FMathBatch::SetKernel(EMathKernel Kernel)
+{
+    if (!IsKernelSupported(Kernel))
+    {
+        return false;
+    }
+
+    const FKernelTable* Table = &ScalarKernel;
+    if (Kernel == EMathKernel::SSE)
+    {
+        Table = &SSEKernel;
+    }
+    else if (Kernel == EMathKernel::AVX2)
+    {
+        Table = &AVX2Kernel;
+    }
+    ActiveKernel.store(Table, std::memory_order_release);
+    return true;
+}
+
+bool FMathBatch::IsKernelSupported(EMathKernel Kernel)
+{
+    // x64는 SSE2가 기본
+    static const bool bAVX2Supported = DetectAVX2();
+    return Kernel != EMathKernel::AVX2 || bAVX2Supported;
+}
+
+const char* FMathBatch::GetKernelName(EMathKernel Kernel)
+{
+    switch (Kernel)
+    {
+    case EMathKernel::Scalar:
+        return "Scalar";
+    case EMathKernel::SSE:
+        return "SSE";
+    case EMathKernel::AVX2:
+        return "AVX2";
+    }
+    return "Unknown";
+}
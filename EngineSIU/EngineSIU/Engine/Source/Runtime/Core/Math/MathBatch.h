@@ -0,0 +1,54 @@
+#pragma once
+#include "HAL/PlatformInteger.h"
+
+struct FMatrix;
+struct FVector;
+
+
+/** FMathBatch가 사용하는 구현 */
+enum class EMathKernel : uint8
+{
+    Scalar,
+    SSE,
+    AVX2,       // AVX2 + FMA
+};
+
+/**
+ * 같은 행렬로 많은 값을 한 번에 변환하는 SIMD 함수 모음
+ *
+ * 처음 호출할 때 CPU가 지원하는 가장 빠른 구현(AVX2 → SSE)을 골라 함수 포인터로 호출합니다.
+ * 행렬은 FMatrix와 같은 행 벡터 규약(v * M)이고, 입력과 출력이 같은 배열이어도 됩니다.
+ */
+struct FMathBatch
+{
+    /** Out[i] = In[i] * M. 아핀 행렬로 보고 w로 나누지 않습니다. */
+    static void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Num);
+
+    /** Out[i] = In[i] * M (이동 제외) */
+    static void TransformDirections(const FMatrix& M, const FVector* In, FVector* Out, int32 Num);
+
+    /**
+     * 변환한 상자를 감싸는 AABB (Arvo)
+     * 꼭짓점 8개를 변환하지 않고 중심과 반 크기로 계산합니다.
+     */
+    static void TransformAABB(const FMatrix& M, const FVector& Min, const FVector& Max, FVector& OutMin, FVector& OutMax);
+    static void TransformAABBs(const FMatrix& M, const FVector* Mins, const FVector* Maxs, FVector* OutMins, FVector* OutMaxs, int32 Num);
+
+    /**
+     * 마지막 열이 (0, 0, 0, 1)인 행렬의 역행렬
+     * 3x3 부분만 뒤집으므로 FMatrix::Inverse보다 빠릅니다. 뒤집을 수 없으면 Identity를 씁니다.
+     * M과 OutInverse가 같은 행렬이어도 됩니다.
+     */
+    static void InverseAffine(const FMatrix& M, FMatrix& OutInverse);
+
+    /** Out[i] = A[i] * B[i] */
+    static void MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Num);
+
+    static EMathKernel GetKernel();
+
+    /** 테스트와 벤치마크용. 지원하지 않는 구현이면 false */
+    static bool SetKernel(EMathKernel Kernel);
+
+    static bool IsKernelSupported(EMathKernel Kernel);
+    static const char* GetKernelName(EMathKernel Kernel);
+};
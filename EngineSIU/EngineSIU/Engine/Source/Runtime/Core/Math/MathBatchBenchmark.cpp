@@ -0,0 +1,317 @@
+#include "MathBatchBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace
+{
+    // FVector / FMatrix와 같은 배치. 배치가 같은지는 Matrix.h에서 확인합니다.
+    struct FBenchVector
+    {
+        float X, Y, Z;
+    };
+
+    struct alignas(16) FBenchMatrix
+    {
+        alignas(16) float M[4][4];
+    };
+
+    FVector* AsVectors(std::vector<FBenchVector>& Vectors) { return reinterpret_cast<FVector*>(Vectors.data()); }
+    FMatrix* AsMatrices(std::vector<FBenchMatrix>& Matrices) { return reinterpret_cast<FMatrix*>(Matrices.data()); }
+    FMatrix& AsMatrix(FBenchMatrix& Matrix) { return reinterpret_cast<FMatrix&>(Matrix); }
+
+    // 값이 클수록 절대 오차도 커지므로 1보다 큰 값은 상대 오차로 봄
+    float RelativeError(float Value, double Expected)
+    {
+        return static_cast<float>(std::abs(Value - Expected) / std::max(1.0, std::abs(Expected)));
+    }
+
+    float VectorError(const FBenchVector& Value, const double Expected[3])
+    {
+        return std::max(RelativeError(Value.X, Expected[0]), std::max(RelativeError(Value.Y, Expected[1]), RelativeError(Value.Z, Expected[2])));
+    }
+
+    float MatrixError(const FBenchMatrix& Value, const double Expected[4][4])
+    {
+        float Error = 0.0f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Error = std::max(Error, RelativeError(Value.M[Row][Column], Expected[Row][Column]));
+            }
+        }
+        return Error;
+    }
+
+    void Multiply(const FBenchMatrix& A, const FBenchMatrix& B, double Out[4][4])
+    {
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                double Sum = 0.0;
+                for (int32 K = 0; K < 4; ++K)
+                {
+                    Sum += static_cast<double>(A.M[Row][K]) * B.M[K][Column];
+                }
+                Out[Row][Column] = Sum;
+            }
+        }
+    }
+
+    FBenchMatrix MultiplyFloat(const FBenchMatrix& A, const FBenchMatrix& B)
+    {
+        double Product[4][4];
+        Multiply(A, B, Product);
+
+        FBenchMatrix Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = static_cast<float>(Product[Row][Column]);
+            }
+        }
+        return Result;
+    }
+
+    /** 부분 피벗 가우스-조던 소거로 구한 일반 역행렬. 뒤집을 수 없으면 false */
+    bool Inverse(const FBenchMatrix& M, double Out[4][4])
+    {
+        double Work[4][8];
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Work[Row][Column] = M.M[Row][Column];
+                Work[Row][Column + 4] = Row == Column ? 1.0 : 0.0;
+            }
+        }
+
+        for (int32 Column = 0; Column < 4; ++Column)
+        {
+            int32 Pivot = Column;
+            for (int32 Row = Column + 1; Row < 4; ++Row)
+            {
+                if (std::abs(Work[Row][Column]) > std::abs(Work[Pivot][Column]))
+                {
+                    Pivot = Row;
+                }
+            }
+            if (Work[Pivot][Column] == 0.0)
+            {
+                return false;
+            }
+            std::swap(Work[Pivot], Work[Column]);
+
+            const double RPivot = 1.0 / Work[Column][Column];
+            for (int32 K = 0; K < 8; ++K)
+            {
+                Work[Column][K] *= RPivot;
+            }
+            for (int32 Row = 0; Row < 4; ++Row)
+            {
+                if (Row != Column)
+                {
+                    const double Factor = Work[Row][Column];
+                    for (int32 K = 0; K < 8; ++K)
+                    {
+                        Work[Row][K] -= Factor * Work[Column][K];
+                    }
+                }
+            }
+        }
+
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Out[Row][Column] = Work[Row][Column + 4];
+            }
+        }
+        return true;
+    }
+
+    // 행 벡터 규약(v * M). bPosition이면 이동을 더함
+    void Transform(const FBenchMatrix& M, const FBenchVector& V, bool bPosition, double Out[3])
+    {
+        for (int32 Column = 0; Column < 3; ++Column)
+        {
+            Out[Column] = static_cast<double>(V.X) * M.M[0][Column] + static_cast<double>(V.Y) * M.M[1][Column] + static_cast<double>(V.Z) * M.M[2][Column];
+            if (bPosition)
+            {
+                Out[Column] += M.M[3][Column];
+            }
+        }
+    }
+
+    FBenchMatrix MakeIdentity()
+    {
+        FBenchMatrix Result = {};
+        Result.M[0][0] = Result.M[1][1] = Result.M[2][2] = Result.M[3][3] = 1.0f;
+        return Result;
+    }
+
+    /** Axis 축을 기준으로 Radians만큼 회전하는 행렬 */
+    FBenchMatrix MakeRotation(int32 Axis, float Radians)
+    {
+        const int32 A = (Axis + 1) % 3;
+        const int32 B = (Axis + 2) % 3;
+        const float Cos = std::cos(Radians);
+        const float Sin = std::sin(Radians);
+
+        FBenchMatrix Result = MakeIdentity();
+        Result.M[A][A] = Cos;
+        Result.M[A][B] = Sin;
+        Result.M[B][A] = -Sin;
+        Result.M[B][B] = Cos;
+        return Result;
+    }
+
+    // 회전, 0.1 ~ 10배 비균등 스케일, 이동을 합친 월드 행렬
+    FBenchMatrix MakeRandomAffine(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float> Angle(-3.14159265f, 3.14159265f);
+        std::uniform_real_distribution<float> Scale(0.1f, 10.0f);
+        std::uniform_real_distribution<float> Position(-1000.0f, 1000.0f);
+
+        FBenchMatrix Result = MakeIdentity();
+        Result.M[0][0] = Scale(Random);
+        Result.M[1][1] = Scale(Random);
+        Result.M[2][2] = Scale(Random);
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Result = MultiplyFloat(Result, MakeRotation(Axis, Angle(Random)));
+        }
+        Result.M[3][0] = Position(Random);
+        Result.M[3][1] = Position(Random);
+        Result.M[3][2] = Position(Random);
+        return Result;
+    }
+
+    // 이전 방식: 꼭짓점 8개를 변환해 감싸는 상자
+    void TransformAABBCorners(const FBenchMatrix& M, const FBenchVector& Min, const FBenchVector& Max, double OutMin[3], double OutMax[3])
+    {
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FBenchVector Local = { (Corner & 1) ? Max.X : Min.X, (Corner & 2) ? Max.Y : Min.Y, (Corner & 4) ? Max.Z : Min.Z };
+            double World[3];
+            Transform(M, Local, true, World);
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                OutMin[Axis] = Corner == 0 ? World[Axis] : std::min(OutMin[Axis], World[Axis]);
+                OutMax[Axis] = Corner == 0 ? World[Axis] : std::max(OutMax[Axis], World[Axis]);
+            }
+        }
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    }
+}
+
+void FMathBatchBenchmark::Run(int32 NumElements, std::vector<FMathBatchBenchmarkResult>& OutResults)
+{
+    OutResults.clear();
+    NumElements = std::max(NumElements, 1);
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Coordinate(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> Size(0.0f, 50.0f);
+
+    FBenchMatrix World = MakeRandomAffine(Random);
+    const FMatrix& WorldMatrix = AsMatrix(World);
+
+    std::vector<FBenchVector> Points(NumElements);
+    std::vector<FBenchVector> Mins(NumElements);
+    std::vector<FBenchVector> Maxs(NumElements);
+    std::vector<FBenchMatrix> Matrices(NumElements);
+    for (int32 Index = 0; Index < NumElements; ++Index)
+    {
+        Points[Index] = { Coordinate(Random), Coordinate(Random), Coordinate(Random) };
+        Mins[Index] = { Coordinate(Random), Coordinate(Random), Coordinate(Random) };
+        Maxs[Index] = { Mins[Index].X + Size(Random), Mins[Index].Y + Size(Random), Mins[Index].Z + Size(Random) };
+        Matrices[Index] = MakeRandomAffine(Random);
+    }
+
+    std::vector<FBenchVector> OutPoints(NumElements);
+    std::vector<FBenchVector> OutMins(NumElements);
+    std::vector<FBenchVector> OutMaxs(NumElements);
+    std::vector<FBenchMatrix> Inverses(NumElements);
+    std::vector<FBenchMatrix> OutMatrices(NumElements);
+
+    const EMathKernel OriginalKernel = FMathBatch::GetKernel();
+    for (const EMathKernel Kernel : { EMathKernel::Scalar, EMathKernel::SSE, EMathKernel::AVX2 })
+    {
+        if (!FMathBatch::SetKernel(Kernel))
+        {
+            continue;
+        }
+
+        FMathBatchBenchmarkResult Result;
+        Result.Kernel = Kernel;
+        Result.NumElements = NumElements;
+
+        auto Start = std::chrono::steady_clock::now();
+        FMathBatch::TransformPositions(WorldMatrix, AsVectors(Points), AsVectors(OutPoints), NumElements);
+        Result.PositionsMs = ElapsedMs(Start);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            double Expected[3];
+            Transform(World, Points[Index], true, Expected);
+            Result.MaxPositionError = std::max(Result.MaxPositionError, VectorError(OutPoints[Index], Expected));
+        }
+
+        Start = std::chrono::steady_clock::now();
+        FMathBatch::TransformDirections(WorldMatrix, AsVectors(Points), AsVectors(OutPoints), NumElements);
+        Result.DirectionsMs = ElapsedMs(Start);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            double Expected[3];
+            Transform(World, Points[Index], false, Expected);
+            Result.MaxDirectionError = std::max(Result.MaxDirectionError, VectorError(OutPoints[Index], Expected));
+        }
+
+        Start = std::chrono::steady_clock::now();
+        FMathBatch::TransformAABBs(WorldMatrix, AsVectors(Mins), AsVectors(Maxs), AsVectors(OutMins), AsVectors(OutMaxs), NumElements);
+        Result.AABBsMs = ElapsedMs(Start);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            double ExpectedMin[3], ExpectedMax[3];
+            TransformAABBCorners(World, Mins[Index], Maxs[Index], ExpectedMin, ExpectedMax);
+            Result.MaxAABBError = std::max(Result.MaxAABBError, std::max(VectorError(OutMins[Index], ExpectedMin), VectorError(OutMaxs[Index], ExpectedMax)));
+        }
+
+        Start = std::chrono::steady_clock::now();
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            FMathBatch::InverseAffine(AsMatrix(Matrices[Index]), AsMatrix(Inverses[Index]));
+        }
+        Result.InverseMs = ElapsedMs(Start);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            double Expected[4][4];
+            if (Inverse(Matrices[Index], Expected))
+            {
+                Result.MaxInverseError = std::max(Result.MaxInverseError, MatrixError(Inverses[Index], Expected));
+            }
+        }
+
+        Start = std::chrono::steady_clock::now();
+        FMathBatch::MultiplyMatrices(AsMatrices(Matrices), AsMatrices(Inverses), AsMatrices(OutMatrices), NumElements);
+        Result.MultiplyMs = ElapsedMs(Start);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            double Expected[4][4];
+            Multiply(Matrices[Index], Inverses[Index], Expected);
+            Result.MaxMultiplyError = std::max(Result.MaxMultiplyError, MatrixError(OutMatrices[Index], Expected));
+        }
+
+        OutResults.push_back(Result);
+    }
+    FMathBatch::SetKernel(OriginalKernel);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+
+#include "HAL/PlatformInteger.h"
+#include "MathBatch.h"
+
+struct FMathBatchBenchmarkResult
+{
+    EMathKernel Kernel = EMathKernel::Scalar;
+    int32 NumElements = 0;
+
+    // 전체 배열 한 번 처리하는 데 걸린 시간
+    double PositionsMs = 0.0;
+    double DirectionsMs = 0.0;
+    double AABBsMs = 0.0;
+    double InverseMs = 0.0;
+    double MultiplyMs = 0.0;
+
+    // double로 계산한 기준값(꼭짓점 8개 AABB, 일반 역행렬 등)과의 최대 오차
+    float MaxPositionError = 0.0f;
+    float MaxDirectionError = 0.0f;
+    float MaxAABBError = 0.0f;
+    float MaxInverseError = 0.0f;
+    float MaxMultiplyError = 0.0f;
+};
+
+/**
+ * FMathBatch의 구현별 속도와 정확도 측정. 콘솔의 "mathbench"에서 호출합니다.
+ * Windows나 엔진 Math 헤더 없이 빌드되도록 기준값은 이 파일 안에서 직접 계산합니다.
+ */
+struct FMathBatchBenchmark
+{
+    /**
+     * 지원하는 구현마다 NumElements개의 무작위 아핀 변환 데이터를 처리합니다.
+     * 행렬 곱은 행렬 세 개를 한 번씩만 읽고 쓰므로, 캐시보다 큰 NumElements에서는 메모리 대역폭이 시간을 정합니다.
+     * 끝나면 원래 구현으로 되돌립니다.
+     */
+    static void Run(int32 NumElements, std::vector<FMathBatchBenchmarkResult>& OutResults);
+};
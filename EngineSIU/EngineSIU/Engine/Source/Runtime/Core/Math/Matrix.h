@@ -62,6 +62,10 @@ public:
     float Determinant3x3() const;
 };
 
+// FMathBatch는 FMatrix / FVector를 같은 배치의 float 배열로 다룹니다.
+static_assert(sizeof(FMatrix) == sizeof(float) * 16 && alignof(FMatrix) == 16, "FMathBatch expects FMatrix to be 16 aligned floats");
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FMathBatch expects FVector to be 3 floats");
+
 inline FArchive& operator<<(FArchive& Ar, FMatrix& M)
 {
     Ar << M.M[0][0] << M.M[0][1] << M.M[0][2] << M.M[0][3];
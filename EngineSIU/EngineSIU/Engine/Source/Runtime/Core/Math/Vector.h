@@ -431,4 +431,9 @@ inline FArchive& operator<<(FArchive& Ar, FVector& V)
     return Ar << V.X << V.Y << V.Z;
 }
 
+inline FArchive& operator<<(FArchive& Ar, FRotator& R)
+{
+    return Ar << R.Pitch << R.Yaw << R.Roll;
+}
+
 
@@ -0,0 +1,93 @@
+#include "FieldArchive.h"
+
+#include "Container/CString.h"
+
+
+FFieldArchive::FFieldArchive(FArchive& InAr, TArray<FFieldDesc>* OutSchema)
+    : Ar(InAr)
+    , RecordedSchema(OutSchema)
+{
+}
+
+FFieldArchive::FFieldArchive(FArchive& InAr, const TArray<FFieldDesc>& InSavedSchema)
+    : Ar(InAr)
+    , SavedSchema(&InSavedSchema)
+    , RecordStart(InAr.Tell())
+{
+}
+
+FFieldArchive::FFieldArchive(FArchive& InAr)
+    : Ar(InAr)
+    , bDuplicating(true)
+{
+}
+
+FFieldArchive FFieldArchive::ForDuplication(FArchive& InAr)
+{
+    return FFieldArchive(InAr);
+}
+
+void FFieldArchive::SkipValue(FArchive& Ar, EFieldType Type)
+{
+    int64 Size = 0;
+    switch (Type)
+    {
+    case EFieldType::Bool:        Size = sizeof(uint8); break;
+    case EFieldType::Int32:       Size = sizeof(int32); break;
+    case EFieldType::Float:       Size = sizeof(float); break;
+    case EFieldType::Vector2D:    Size = sizeof(float) * 2; break;
+    case EFieldType::Vector:      Size = sizeof(float) * 3; break;
+    case EFieldType::Vector4:     Size = sizeof(float) * 4; break;
+    case EFieldType::Rotator:     Size = sizeof(float) * 3; break;
+    case EFieldType::LinearColor: Size = sizeof(float) * 4; break;
+    case EFieldType::String:
+    case EFieldType::Name:
+    {
+        // FString, FName 모두 길이 + 문자 배열로 저장됨
+        int32 Length = 0;
+        Ar << Length;
+        Size = static_cast<int64>(Length) * sizeof(TCHAR);
+        break;
+    }
+    }
+    Ar.Seek(Ar.Tell() + Size);
+}
+
+bool FFieldArchive::SeekToField(const TCHAR* Name, EFieldType Type)
+{
+    const TArray<FFieldDesc>& Schema = *SavedSchema;
+
+    if (FieldOffsets.IsEmpty())
+    {
+        // 빠른 경로: 저장된 스키마와 같은 순서로 호출되는 중
+        if (Cursor < Schema.Num() && Schema[Cursor].Type == Type && FCString::Strcmp(*Schema[Cursor].Name, Name) == 0)
+        {
+            ++Cursor;
+            return true;
+        }
+
+        // 필드가 추가/삭제되어 순서가 어긋남. 이 객체의 필드 위치를 한 번 훑어서 기록
+        FieldOffsets.SetNum(Schema.Num());
+        Ar.Seek(RecordStart);
+        for (int32 Index = 0; Index < Schema.Num(); ++Index)
+        {
+            FieldOffsets[Index] = Ar.Tell();
+            SkipValue(Ar, Schema[Index].Type);
+        }
+    }
+
+    for (int32 Index = 0; Index < Schema.Num(); ++Index)
+    {
+        if (FCString::Strcmp(*Schema[Index].Name, Name) == 0)
+        {
+            // 타입이 바뀐 필드는 읽지 않고 기본값을 유지
+            if (Schema[Index].Type != Type)
+            {
+                return false;
+            }
+            Ar.Seek(FieldOffsets[Index]);
+            return true;
+        }
+    }
+    return false;
+}
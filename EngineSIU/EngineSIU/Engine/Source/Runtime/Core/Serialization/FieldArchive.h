@@ -0,0 +1,186 @@
+#pragma once
+#include "Archive.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Math/Color.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+#include "UObject/NameTypes.h"
+
+
+/** SerializeFields로 기록할 수 있는 값의 타입. 파일에 그대로 저장되므로 순서를 바꾸면 안 됩니다. */
+enum class EFieldType : uint8
+{
+    Bool,
+    Int32,
+    Float,
+    Vector2D,
+    Vector,
+    Vector4,
+    Rotator,
+    LinearColor,
+    String,
+    Name,
+};
+
+template <typename T>
+struct TFieldType;
+
+template <> struct TFieldType<bool>         { static constexpr EFieldType Value = EFieldType::Bool; };
+template <> struct TFieldType<int32>        { static constexpr EFieldType Value = EFieldType::Int32; };
+template <> struct TFieldType<float>        { static constexpr EFieldType Value = EFieldType::Float; };
+template <> struct TFieldType<FVector2D>    { static constexpr EFieldType Value = EFieldType::Vector2D; };
+template <> struct TFieldType<FVector>      { static constexpr EFieldType Value = EFieldType::Vector; };
+template <> struct TFieldType<FVector4>     { static constexpr EFieldType Value = EFieldType::Vector4; };
+template <> struct TFieldType<FRotator>     { static constexpr EFieldType Value = EFieldType::Rotator; };
+template <> struct TFieldType<FLinearColor> { static constexpr EFieldType Value = EFieldType::LinearColor; };
+template <> struct TFieldType<FString>      { static constexpr EFieldType Value = EFieldType::String; };
+template <> struct TFieldType<FName>        { static constexpr EFieldType Value = EFieldType::Name; };
+
+/** 클래스 스키마의 필드 하나 */
+struct FFieldDesc
+{
+    FString Name;
+    EFieldType Type = EFieldType::Bool;
+};
+
+/**
+ * UObject::SerializeFields에 넘겨지는 타입 있는 필드 직렬화기
+ *
+ * 값은 FArchive에 이름 없이 순서대로 기록되고, 필드 이름과 타입은 클래스마다 한 번만 스키마로 따로 저장합니다.
+ * 로드할 때 저장된 스키마와 호출 순서가 같으면 그대로 이어서 읽고,
+ * 필드가 추가/삭제되어 어긋나면 그 객체에 한해 이름으로 찾아 읽습니다. 저장 파일에 없는 필드는 기본값을 유지합니다.
+ *
+ * 복제 모드는 같은 프로세스 안에서 객체를 복제할 때 사용합니다. 스키마 없이 호출 순서대로 읽고 쓰며,
+ * 파일에 남기지 않는 런타임 상태와 객체 참조(Reference)도 함께 옮길 수 있습니다.
+ *
+ * SerializeFields는 객체 상태와 관계없이 항상 같은 필드를 같은 순서로 호출해야 합니다. (복제 모드 여부에 따라 달라지는 것은 괜찮음)
+ */
+class FFieldArchive
+{
+public:
+    /**
+     * 저장용으로 만듭니다.
+     * @param InAr 값을 쓸 Archive
+     * @param OutSchema nullptr가 아니면 호출된 필드의 이름과 타입을 순서대로 기록합니다.
+     */
+    FFieldArchive(FArchive& InAr, TArray<FFieldDesc>* OutSchema);
+
+    /**
+     * 로드용으로 만듭니다. 값은 InAr의 현재 위치부터 읽습니다.
+     * @param InSavedSchema 값을 저장할 때 기록된 클래스 스키마
+     */
+    FFieldArchive(FArchive& InAr, const TArray<FFieldDesc>& InSavedSchema);
+
+    /**
+     * 복제 모드로 만듭니다. 저장/로드는 InAr의 방향을 따릅니다.
+     * 객체 참조를 옮기려면 InAr이 UObject* 직렬화를 지원해야 합니다. (FDuplicateDataWriter / FDuplicateDataReader)
+     */
+    static FFieldArchive ForDuplication(FArchive& InAr);
+
+    bool IsLoading() const { return Ar.IsLoading(); }
+    bool IsSaving() const { return Ar.IsSaving(); }
+    bool IsDuplicating() const { return bDuplicating; }
+
+    /**
+     * 필드 하나를 저장하거나 읽습니다.
+     * @return 저장할 때는 항상 true, 로드할 때는 값을 읽었으면 true
+     */
+    template <typename T>
+    bool Field(const TCHAR* Name, T& Value)
+    {
+        constexpr EFieldType Type = TFieldType<T>::Value;
+        if (IsSaving())
+        {
+            if (RecordedSchema)
+            {
+                RecordedSchema->Add({ Name, Type });
+            }
+            Ar << Value;
+            return true;
+        }
+
+        if (!bDuplicating && !SeekToField(Name, Type))
+        {
+            return false;
+        }
+        Ar << Value;
+        return true;
+    }
+
+    /**
+     * 다른 UObject를 가리키는 포인터를 옮깁니다. 복제 모드에서만 동작하며, 파일에는 저장하지 않습니다. (에셋은 경로 필드로 저장)
+     * 함께 복제된 객체를 가리키면 복제본으로 바뀌고, 그 외의 객체는 원본을 그대로 가리킵니다.
+     * @return 값을 옮겼으면 true
+     */
+    template <typename T>
+    bool Reference(T*& Object)
+    {
+        if (!bDuplicating)
+        {
+            return false;
+        }
+        UObject* Ref = Object;
+        Ar << Ref;
+        Object = static_cast<T*>(Ref);
+        return true;
+    }
+
+    template <typename T>
+    bool ReferenceArray(TArray<T*>& Objects)
+    {
+        if (!bDuplicating)
+        {
+            return false;
+        }
+        int32 Num = Objects.Num();
+        Ar << Num;
+        if (IsLoading())
+        {
+            Objects.SetNum(Num);
+        }
+        for (T*& Object : Objects)
+        {
+            Reference(Object);
+        }
+        return true;
+    }
+
+    /** 포인터가 없는 구조체를 통째로 옮깁니다. 복제 모드에서만 동작합니다. */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool Raw(T& Value)
+    {
+        if (!bDuplicating)
+        {
+            return false;
+        }
+        Ar.Serialize(&Value, sizeof(T));
+        return true;
+    }
+
+    /** 저장된 값 하나가 차지하는 바이트를 건너뜁니다. */
+    static void SkipValue(FArchive& Ar, EFieldType Type);
+
+private:
+    explicit FFieldArchive(FArchive& InAr);
+
+    bool SeekToField(const TCHAR* Name, EFieldType Type);
+
+    FArchive& Ar;
+
+    TArray<FFieldDesc>* RecordedSchema = nullptr;
+    const TArray<FFieldDesc>* SavedSchema = nullptr;
+
+    bool bDuplicating = false;
+
+    // 스키마 순서대로 읽는 동안 다음에 올 필드
+    int32 Cursor = 0;
+
+    int64 RecordStart = 0;
+
+    // 순서가 어긋났을 때만 채우는 필드별 시작 위치
+    TArray<int64> FieldOffsets;
+};
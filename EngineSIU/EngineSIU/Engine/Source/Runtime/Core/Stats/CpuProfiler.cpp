@@ -0,0 +1,296 @@
+#include "CpuProfiler.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "Container/Map.h"
+#include "Math/MathUtility.h"
+#include "ProfilerStatsManager.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    thread_local uint32 GScopeDepth = 0;
+
+    double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+    {
+        if (SortedValues.Num() == 0)
+        {
+            return 0.0;
+        }
+
+        // Nearest-rank 방식
+        const int32 Rank = static_cast<int32>(Percentile / 100.0 * SortedValues.Num() + 0.5);
+        return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+    }
+
+    // Stat 이름은 식별자지만, 사용자 문자열이 섞여도 JSON이 깨지지 않도록 이스케이프
+    void WriteJsonString(std::ofstream& Out, const FString& Value)
+    {
+        Out << '"';
+        for (const char Char : Value.GetContainerPrivate())
+        {
+            if (Char == '"' || Char == '\\')
+            {
+                Out << '\\' << Char;
+            }
+            else if (static_cast<unsigned char>(Char) < 0x20)
+            {
+                Out << ' ';
+            }
+            else
+            {
+                Out << Char;
+            }
+        }
+        Out << '"';
+    }
+}
+
+FCpuProfiler& FCpuProfiler::Get()
+{
+    static FCpuProfiler Instance;
+    return Instance;
+}
+
+FCpuProfiler::FCpuProfiler()
+    : BaseCycles(FPlatformTime::Cycles64())
+{
+    CurrentFrameStartCycles = BaseCycles;
+    Frames.SetNum(DefaultFrameHistoryCount);
+}
+
+uint32 FCpuProfiler::PushScope()
+{
+    return GScopeDepth++;
+}
+
+void FCpuProfiler::PopScope()
+{
+    --GScopeDepth;
+}
+
+FCpuProfiler::FThreadEventBuffer& FCpuProfiler::GetThreadBuffer()
+{
+    thread_local FThreadEventBuffer* ThreadBuffer = nullptr;
+    if (ThreadBuffer == nullptr)
+    {
+        std::scoped_lock Lock(ThreadBuffersMutex);
+        auto NewBuffer = std::make_unique<FThreadEventBuffer>();
+        NewBuffer->ThreadIndex = ThreadBuffers.Num();
+        NewBuffer->ThreadName = FString::Printf(TEXT("Thread %d"), NewBuffer->ThreadIndex);
+        ThreadBuffer = NewBuffer.get();
+        ThreadBuffers.Emplace(std::move(NewBuffer));
+    }
+    return *ThreadBuffer;
+}
+
+void FCpuProfiler::RecordEvent(const FName& StatName, uint64 StartCycles, uint64 EndCycles, uint32 Depth)
+{
+    FThreadEventBuffer& Buffer = GetThreadBuffer();
+
+    const uint64 Head = Buffer.Head.load(std::memory_order_relaxed);
+    if (Head - Buffer.Tail.load(std::memory_order_acquire) >= ThreadEventCapacity)
+    {
+        Buffer.DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    FCpuProfileEvent& Event = Buffer.Events[Head & (ThreadEventCapacity - 1)];
+    Event.StatName = StatName;
+    Event.StartCycles = StartCycles;
+    Event.EndCycles = EndCycles;
+    Event.ThreadIndex = Buffer.ThreadIndex;
+    Event.Depth = Depth;
+
+    // 이벤트 내용을 다 쓴 뒤에 Head를 공개
+    Buffer.Head.store(Head + 1, std::memory_order_release);
+}
+
+void FCpuProfiler::SetCurrentThreadName(const FString& InName)
+{
+    FThreadEventBuffer& Buffer = GetThreadBuffer();
+    std::scoped_lock Lock(ThreadBuffersMutex);
+    Buffer.ThreadName = InName;
+}
+
+uint64 FCpuProfiler::DrainThreadBuffers(TArray<FCpuProfileEvent>& OutEvents)
+{
+    std::scoped_lock Lock(ThreadBuffersMutex);
+
+    uint64 Dropped = 0;
+    for (const std::unique_ptr<FThreadEventBuffer>& Buffer : ThreadBuffers)
+    {
+        const uint64 Tail = Buffer->Tail.load(std::memory_order_relaxed);
+        const uint64 Head = Buffer->Head.load(std::memory_order_acquire);
+        for (uint64 Cursor = Tail; Cursor < Head; ++Cursor)
+        {
+            OutEvents.Add(Buffer->Events[Cursor & (ThreadEventCapacity - 1)]);
+        }
+
+        // 다 읽은 뒤에 슬롯을 생산자에게 돌려줌
+        Buffer->Tail.store(Head, std::memory_order_release);
+        Dropped += Buffer->DroppedCount.load(std::memory_order_relaxed);
+    }
+    return Dropped;
+}
+
+void FCpuProfiler::BeginFrame()
+{
+    ++FrameNumber;
+    CurrentFrameStartCycles = FPlatformTime::Cycles64();
+}
+
+void FCpuProfiler::EndFrame()
+{
+    const bool bRecord = IsEnabled() && Frames.Num() > 0;
+
+    FCpuProfileFrame& Frame = bRecord ? Frames[NextFrameSlot] : UnrecordedFrame;
+    Frame.FrameNumber = FrameNumber;
+    Frame.StartCycles = CurrentFrameStartCycles;
+    Frame.EndCycles = FPlatformTime::Cycles64();
+    Frame.Events.Reset();
+
+    const uint64 TotalDropped = DrainThreadBuffers(Frame.Events);
+    Frame.NumDroppedEvents = TotalDropped - LastDroppedEventCount;
+    LastDroppedEventCount = TotalDropped;
+
+    for (const FCpuProfileEvent& Event : Frame.Events)
+    {
+        FProfilerStatsManager::AddCpuStat(Event.StatName, FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles));
+    }
+    FProfilerStatsManager::SetDroppedEventCount(Frame.NumDroppedEvents, TotalDropped);
+
+    if (bRecord)
+    {
+        NextFrameSlot = (NextFrameSlot + 1) % Frames.Num();
+        NumValidFrames = FMath::Min<uint32>(NumValidFrames + 1, Frames.Num());
+    }
+}
+
+void FCpuProfiler::SetFrameHistoryCount(uint32 InCount)
+{
+    Frames.Empty();
+    Frames.SetNum(FMath::Max<uint32>(InCount, 1));
+    NextFrameSlot = 0;
+    NumValidFrames = 0;
+}
+
+void FCpuProfiler::GatherScopeAggregates(TArray<FCpuScopeAggregate>& OutAggregates) const
+{
+    OutAggregates.Empty();
+
+    TMap<FName, TArray<double>> DurationsByStat;
+    ForEachFrame([&DurationsByStat](const FCpuProfileFrame& Frame)
+    {
+        for (const FCpuProfileEvent& Event : Frame.Events)
+        {
+            DurationsByStat.FindOrAdd(Event.StatName).Add(FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles));
+        }
+    });
+
+    for (auto& [StatName, Durations] : DurationsByStat)
+    {
+        Durations.Sort();
+
+        FCpuScopeAggregate Aggregate;
+        Aggregate.StatName = StatName;
+        Aggregate.Count = Durations.Num();
+        for (const double Duration : Durations)
+        {
+            Aggregate.TotalMs += Duration;
+        }
+        Aggregate.MinMs = Durations[0];
+        Aggregate.MaxMs = Durations[Durations.Num() - 1];
+        Aggregate.P50Ms = GetPercentile(Durations, 50.0);
+        Aggregate.P95Ms = GetPercentile(Durations, 95.0);
+        Aggregate.P99Ms = GetPercentile(Durations, 99.0);
+        OutAggregates.Add(Aggregate);
+    }
+
+    OutAggregates.Sort([](const FCpuScopeAggregate& A, const FCpuScopeAggregate& B)
+    {
+        return A.TotalMs > B.TotalMs;
+    });
+}
+
+bool FCpuProfiler::ExportChromeTrace(const FString& FilePath) const
+{
+    const std::filesystem::path Path(FilePath.ToWideString());
+    if (Path.has_parent_path() && !std::filesystem::exists(Path.parent_path()))
+    {
+        std::filesystem::create_directories(Path.parent_path());
+    }
+
+    std::ofstream Out(Path, std::ios::out | std::ios::trunc);
+    if (!Out)
+    {
+        return false;
+    }
+
+    // Chrome Trace Event 형식: ts / dur은 마이크로초, "X"는 Complete Event
+    auto ToMicroseconds = [this](uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds(Cycles - BaseCycles) * 1000.0;
+    };
+
+    Out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool bFirst = true;
+    auto BeginEntry = [&Out, &bFirst]()
+    {
+        if (!bFirst)
+        {
+            Out << ",\n";
+        }
+        bFirst = false;
+    };
+
+    {
+        std::scoped_lock Lock(ThreadBuffersMutex);
+        for (const std::unique_ptr<FThreadEventBuffer>& Buffer : ThreadBuffers)
+        {
+            BeginEntry();
+            Out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << Buffer->ThreadIndex << ",\"args\":{\"name\":";
+            WriteJsonString(Out, Buffer->ThreadName);
+            Out << "}}";
+        }
+    }
+
+    Out.setf(std::ios::fixed);
+    Out.precision(3);
+
+    ForEachFrame([&](const FCpuProfileFrame& Frame)
+    {
+        // 프레임 경계는 Instant Event로 표시
+        BeginEntry();
+        Out << "{\"name\":\"Frame " << Frame.FrameNumber << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":"
+            << ToMicroseconds(Frame.StartCycles) << "}";
+
+        for (const FCpuProfileEvent& Event : Frame.Events)
+        {
+            BeginEntry();
+            Out << "{\"name\":";
+            WriteJsonString(Out, Event.StatName.ToString());
+            Out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << Event.ThreadIndex
+                << ",\"ts\":" << ToMicroseconds(Event.StartCycles)
+                << ",\"dur\":" << FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles) * 1000.0
+                << ",\"args\":{\"depth\":" << Event.Depth << "}}";
+        }
+    });
+
+    Out << "\n]}\n";
+    return Out.good();
+}
+
+uint64 FCpuProfiler::GetDroppedEventCount() const
+{
+    std::scoped_lock Lock(ThreadBuffersMutex);
+
+    uint64 Dropped = 0;
+    for (const std::unique_ptr<FThreadEventBuffer>& Buffer : ThreadBuffers)
+    {
+        Dropped += Buffer->DroppedCount.load(std::memory_order_relaxed);
+    }
+    return Dropped;
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "UObject/NameTypes.h"
+
+/**
+ * 계층형 / 스레드별 CPU 프로파일러
+ *
+ * FScopeCycleCounter가 끝날 때마다 (Stat 이름, 시작/끝 Cycle, 중첩 깊이)를 호출한 스레드의 이벤트 버퍼에 기록합니다.
+ * 이벤트 버퍼는 스레드당 하나의 SPSC 링 버퍼라서 기록 경로에는 Lock이 없습니다.
+ * 메인 스레드가 EndFrame에서 모든 버퍼를 비워 방금 끝난 프레임으로 묶고, 최근 N 프레임을 링으로 보관합니다.
+ */
+
+struct FCpuProfileEvent
+{
+    FName StatName;
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+    uint32 ThreadIndex = 0;
+    uint32 Depth = 0;           // 같은 스레드 안에서의 Scope 중첩 깊이 (최상위 = 0)
+};
+
+struct FCpuProfileFrame
+{
+    uint64 FrameNumber = 0;
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+    uint64 NumDroppedEvents = 0;    // 스레드 버퍼가 가득 차서 기록하지 못한 이벤트 수
+    TArray<FCpuProfileEvent> Events;
+};
+
+// 보관 중인 프레임 전체에 대한 Scope 단위 통계 (모든 값은 호출 1회 기준 ms, Inclusive)
+struct FCpuScopeAggregate
+{
+    FName StatName;
+    uint32 Count = 0;
+    double TotalMs = 0.0;
+    double MinMs = 0.0;
+    double MaxMs = 0.0;
+    double P50Ms = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+};
+
+class FCpuProfiler
+{
+public:
+    static constexpr uint32 DefaultFrameHistoryCount = 120;
+    static constexpr uint32 ThreadEventCapacity = 1 << 14;      // 2의 거듭제곱이어야 함
+
+    static FCpuProfiler& Get();
+
+    FCpuProfiler(const FCpuProfiler&) = delete;
+    FCpuProfiler& operator=(const FCpuProfiler&) = delete;
+    FCpuProfiler(FCpuProfiler&&) = delete;
+    FCpuProfiler& operator=(FCpuProfiler&&) = delete;
+
+    /** 현재 스레드의 Scope 중첩 깊이를 하나 올리고, 올리기 전 깊이를 반환합니다. */
+    static uint32 PushScope();
+    static void PopScope();
+
+    /** 현재 스레드의 이벤트 버퍼에 완료된 Scope를 기록합니다. 버퍼가 가득 차면 버리고 Drop 카운트만 올립니다. */
+    void RecordEvent(const FName& StatName, uint64 StartCycles, uint64 EndCycles, uint32 Depth);
+
+    /** Trace에 표시할 현재 스레드 이름을 지정합니다. */
+    void SetCurrentThreadName(const FString& InName);
+
+    /** 새 프레임의 시작 시각을 기록합니다. 메인 스레드에서 프레임 처음에 호출합니다. */
+    void BeginFrame();
+
+    /**
+     * 현재 프레임을 마감합니다. 메인 스레드에서 프레임 끝에 한 번 호출해야 합니다.
+     * 모든 스레드 버퍼의 이벤트를 프레임 링에 옮기고, Stat별 합계를 FProfilerStatsManager에 넘깁니다.
+     */
+    void EndFrame();
+
+    /**
+     * 프레임 링에 이벤트를 보관할지 정합니다. 꺼도 Stat별 합계는 계속 FProfilerStatsManager에 넘기므로
+     * 프로파일러 창(오버레이)은 그대로 갱신되고, Trace / 집계만 멈춥니다.
+     */
+    void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+    /** 보관할 프레임 수를 바꿉니다. 기존 기록은 지워집니다. */
+    void SetFrameHistoryCount(uint32 InCount);
+    uint32 GetFrameHistoryCount() const { return Frames.Num(); }
+
+    /** 보관 중인 프레임을 오래된 순서대로 순회합니다. */
+    template <typename FuncType>
+    void ForEachFrame(const FuncType& Func) const;
+
+    /** 보관 중인 모든 프레임에 대해 Scope별 통계를 계산합니다. Total 내림차순으로 정렬됩니다. */
+    void GatherScopeAggregates(TArray<FCpuScopeAggregate>& OutAggregates) const;
+
+    /**
+     * 보관 중인 프레임을 Chrome Trace Event JSON으로 저장합니다. chrome://tracing 또는 Perfetto에서 열 수 있습니다.
+     * @return 파일을 쓰지 못하면 false
+     */
+    bool ExportChromeTrace(const FString& FilePath) const;
+
+    uint64 GetDroppedEventCount() const;
+
+private:
+    FCpuProfiler();
+    ~FCpuProfiler() = default;
+
+    // 소유 스레드만 쓰고(Head), 메인 스레드만 읽는(Tail) 고정 크기 링 버퍼
+    struct FThreadEventBuffer
+    {
+        FCpuProfileEvent Events[ThreadEventCapacity];
+        std::atomic<uint64> Head = 0;
+        std::atomic<uint64> Tail = 0;
+        std::atomic<uint64> DroppedCount = 0;
+
+        uint32 ThreadIndex = 0;
+        FString ThreadName;
+    };
+
+    FThreadEventBuffer& GetThreadBuffer();
+    /** @return 버퍼가 생긴 뒤로 버린 이벤트의 누적 수 */
+    uint64 DrainThreadBuffers(TArray<FCpuProfileEvent>& OutEvents);
+
+private:
+    std::atomic<bool> bEnabled = true;
+
+    // 스레드 버퍼 등록은 스레드마다 한 번이므로 Mutex로 보호. 버퍼는 종료 시까지 해제하지 않음
+    mutable std::mutex ThreadBuffersMutex;
+    TArray<std::unique_ptr<FThreadEventBuffer>> ThreadBuffers;
+
+    TArray<FCpuProfileFrame> Frames;
+    uint32 NextFrameSlot = 0;
+    uint32 NumValidFrames = 0;
+
+    // 기록을 끈 동안 합계만 내고 버릴 프레임
+    FCpuProfileFrame UnrecordedFrame;
+    uint64 LastDroppedEventCount = 0;
+
+    uint64 FrameNumber = 0;
+    uint64 CurrentFrameStartCycles = 0;
+    uint64 BaseCycles = 0;          // Trace Timestamp의 기준점
+};
+
+template <typename FuncType>
+void FCpuProfiler::ForEachFrame(const FuncType& Func) const
+{
+    const uint32 Capacity = Frames.Num();
+    if (Capacity == 0)
+    {
+        return;
+    }
+
+    const uint32 FirstSlot = (NextFrameSlot + Capacity - NumValidFrames) % Capacity;
+    for (uint32 Offset = 0; Offset < NumValidFrames; ++Offset)
+    {
+        Func(Frames[(FirstSlot + Offset) % Capacity]);
+    }
+}
@@ -1,4 +1,22 @@
 #include "ProfilerStatsManager.h"
+#include "CpuProfiler.h"
 
 // Initialize static members
 TMap<FName, double> FProfilerStatsManager::CPUStatsMS;
+TMap<FName, uint32> FProfilerStatsManager::CPUStatCallCounts;
+uint64 FProfilerStatsManager::FrameDroppedEventCount = 0;
+uint64 FProfilerStatsManager::TotalDroppedEventCount = 0;
+
+void FProfilerStatsManager::BeginFrame()
+{
+    FCpuProfiler::Get().BeginFrame();
+}
+
+void FProfilerStatsManager::EndFrame()
+{
+    CPUStatsMS.Empty();
+    CPUStatCallCounts.Empty();
+
+    // Scope 이벤트는 각 스레드 버퍼에 쌓여 있다가 여기서 방금 끝난 프레임의 통계로 합산됨
+    FCpuProfiler::Get().EndFrame();
+}
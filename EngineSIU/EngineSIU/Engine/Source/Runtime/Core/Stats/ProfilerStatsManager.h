@@ -8,16 +8,17 @@
 class FProfilerStatsManager
 {
 public:
-    // Call at the beginning of each frame to clear previous results
-    static void BeginFrame()
-    {
-        CPUStatsMS.Empty();
-    }
+    // Call at the beginning of each frame. Marks the frame start in FCpuProfiler
+    static void BeginFrame();
+
+    // Call at the end of each frame. Closes the frame in FCpuProfiler, which refills the stats below
+    static void EndFrame();
 
-    // Called by FScopeCycleCounter to record CPU time
+    // Accumulates CPU time, so scopes entered several times per frame (or on several threads) report their sum
     static void AddCpuStat(const TStatId& StatId, const double TimeMs)
     {
-        CPUStatsMS.FindOrAdd(StatId.GetName()) = TimeMs;
+        CPUStatsMS.FindOrAdd(StatId.GetName()) += TimeMs;
+        ++CPUStatCallCounts.FindOrAdd(StatId.GetName());
     }
 
     // Retrieve CPU time for a given StatId
@@ -27,7 +28,26 @@ public:
         return FoundMs ? *FoundMs : -1.0; // Return -1 if not found
     }
 
+    // Number of times the scope finished during the last completed frame
+    static uint32 GetCpuStatCallCount(const FName& StatName)
+    {
+        const uint32* FoundCount = CPUStatCallCounts.Find(StatName);
+        return FoundCount ? *FoundCount : 0;
+    }
+
+    // Profiler events lost because a thread buffer was full (last completed frame / since startup)
+    static void SetDroppedEventCount(uint64 InFrameCount, uint64 InTotalCount)
+    {
+        FrameDroppedEventCount = InFrameCount;
+        TotalDroppedEventCount = InTotalCount;
+    }
+    static uint64 GetFrameDroppedEventCount() { return FrameDroppedEventCount; }
+    static uint64 GetTotalDroppedEventCount() { return TotalDroppedEventCount; }
+
 private:
-    // Map from Stat Name to elapsed time in milliseconds for the current frame
+    // Map from Stat Name to total elapsed time in milliseconds for the last completed frame
     static TMap<FName, double> CPUStatsMS;
+    static TMap<FName, uint32> CPUStatCallCounts;
+    static uint64 FrameDroppedEventCount;
+    static uint64 TotalDroppedEventCount;
 };
@@ -1,10 +1,11 @@
 #include "Stats.h"
 #include "WindowsPlatformTime.h"
 #include "GpuTimingManager.h"
-#include "ProfilerStatsManager.h"
+#include "CpuProfiler.h"
 
 FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
     : StartCycles(FPlatformTime::Cycles64())
+    , Depth(FCpuProfiler::PushScope())
     , UsedStatId(StatId)
 {
 }
@@ -12,6 +13,7 @@ FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
 FScopeCycleCounter::~FScopeCycleCounter()
 {
     Finish();
+    FCpuProfiler::PopScope();
 }
 
 uint64 FScopeCycleCounter::Finish()
@@ -19,8 +21,8 @@ uint64 FScopeCycleCounter::Finish()
     const uint64 EndCycles = FPlatformTime::Cycles64();
     const uint64 CycleDiff = EndCycles - StartCycles;
 
-    // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-    FProfilerStatsManager::AddCpuStat(UsedStatId, FPlatformTime::ToMilliseconds(CycleDiff));
+    // 프레임 합계는 FProfilerStatsManager::EndFrame에서 이벤트 버퍼를 비울 때 계산됨
+    FCpuProfiler::Get().RecordEvent(UsedStatId.GetName(), StartCycles, EndCycles, Depth);
 
     return CycleDiff;
 }
@@ -22,8 +22,8 @@ public:
 
 private:
     uint64 StartCycles;
+    uint32 Depth;       // 같은 스레드에서 바깥 Scope의 수
 
-    [[maybe_unused]]
     TStatId UsedStatId;
 };
 
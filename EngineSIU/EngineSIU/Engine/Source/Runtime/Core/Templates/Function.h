@@ -0,0 +1,203 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "HAL/PlatformType.h"
+
+
+template <typename Signature>
+class TFunction;
+
+/**
+ * std::function 대신 쓰는 호출 가능 객체 래퍼
+ *
+ * InlineSize 이하이고 이동할 때 예외를 던지지 않는 함수 객체(this나 포인터 몇 개를 캡처한 람다 등)는
+ * 내부 버퍼에 그대로 저장해서 힙 할당을 하지 않습니다. 더 큰 함수 객체만 힙에 저장합니다.
+ */
+template <typename ReturnType, typename... ParamTypes>
+class TFunction<ReturnType(ParamTypes...)>
+{
+public:
+    static constexpr size_t InlineSize = sizeof(void*) * 4;
+
+    TFunction() = default;
+    TFunction(std::nullptr_t) {}
+
+    template <
+        typename FunctorType,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<FunctorType>, TFunction> &&
+            std::is_invocable_r_v<ReturnType, std::decay_t<FunctorType>&, ParamTypes...>
+        >
+    >
+    TFunction(FunctorType&& InFunctor)
+    {
+        using StoredType = std::decay_t<FunctorType>;
+
+        if constexpr (bIsInline<StoredType>)
+        {
+            new (Storage) StoredType(std::forward<FunctorType>(InFunctor));
+        }
+        else
+        {
+            *reinterpret_cast<StoredType**>(Storage) = new StoredType(std::forward<FunctorType>(InFunctor));
+        }
+        Ops = &TOps<StoredType>::Table;
+    }
+
+    TFunction(const TFunction& Other)
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->Copy(Storage, Other.Storage);
+            Ops = Other.Ops;
+        }
+    }
+
+    TFunction(TFunction&& Other) noexcept
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->Move(Storage, Other.Storage);
+            Ops = Other.Ops;
+            Other.Ops = nullptr;
+        }
+    }
+
+    ~TFunction()
+    {
+        Reset();
+    }
+
+    TFunction& operator=(const TFunction& Other)
+    {
+        if (this != &Other)
+        {
+            TFunction Temp(Other);
+            *this = std::move(Temp);
+        }
+        return *this;
+    }
+
+    TFunction& operator=(TFunction&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            if (Other.Ops)
+            {
+                Other.Ops->Move(Storage, Other.Storage);
+                Ops = Other.Ops;
+                Other.Ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    TFunction& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    void Reset()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
+    }
+
+    bool IsSet() const { return Ops != nullptr; }
+    explicit operator bool() const { return IsSet(); }
+
+    ReturnType operator()(ParamTypes... Params) const
+    {
+        return Ops->Invoke(const_cast<uint8*>(Storage), std::forward<ParamTypes>(Params)...);
+    }
+
+private:
+    template <typename StoredType>
+    static constexpr bool bIsInline =
+        sizeof(StoredType) <= InlineSize &&
+        alignof(StoredType) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<StoredType>;
+
+    struct FOps
+    {
+        ReturnType (*Invoke)(void* Storage, ParamTypes&&... Params);
+        void (*Copy)(void* Dest, const void* Src);
+        void (*Move)(void* Dest, void* Src);        // Src는 이동 후 파괴됨
+        void (*Destroy)(void* Storage);
+    };
+
+    template <typename StoredType>
+    struct TOps
+    {
+        static StoredType& Get(void* InStorage)
+        {
+            if constexpr (bIsInline<StoredType>)
+            {
+                return *std::launder(reinterpret_cast<StoredType*>(InStorage));
+            }
+            else
+            {
+                return **reinterpret_cast<StoredType**>(InStorage);
+            }
+        }
+
+        static ReturnType Invoke(void* InStorage, ParamTypes&&... Params)
+        {
+            return static_cast<ReturnType>(Get(InStorage)(std::forward<ParamTypes>(Params)...));
+        }
+
+        static void Copy(void* Dest, const void* Src)
+        {
+            const StoredType& Source = Get(const_cast<void*>(Src));
+            if constexpr (bIsInline<StoredType>)
+            {
+                new (Dest) StoredType(Source);
+            }
+            else
+            {
+                *reinterpret_cast<StoredType**>(Dest) = new StoredType(Source);
+            }
+        }
+
+        static void Move(void* Dest, void* Src)
+        {
+            if constexpr (bIsInline<StoredType>)
+            {
+                StoredType& Source = Get(Src);
+                new (Dest) StoredType(std::move(Source));
+                Source.~StoredType();
+            }
+            else
+            {
+                // 힙에 있으면 포인터만 옮김
+                *reinterpret_cast<StoredType**>(Dest) = *reinterpret_cast<StoredType**>(Src);
+            }
+        }
+
+        static void Destroy(void* InStorage)
+        {
+            if constexpr (bIsInline<StoredType>)
+            {
+                Get(InStorage).~StoredType();
+            }
+            else
+            {
+                delete *reinterpret_cast<StoredType**>(InStorage);
+            }
+        }
+
+        static constexpr FOps Table = { &Invoke, &Copy, &Move, &Destroy };
+    };
+
+private:
+    alignas(std::max_align_t) uint8 Storage[InlineSize];
+    const FOps* Ops = nullptr;
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "Container/Map.h"
+#include "Serialization/MemoryArchive.h"
+
+class UObject;
+
+
+/**
+ * 객체 복제용 메모리 Writer
+ *
+ * UObject 포인터를 주소 그대로 기록합니다. 같은 프로세스 안에서 FDuplicateDataReader로 바로 읽을 때만 사용해야 합니다.
+ */
+class FDuplicateDataWriter : public FMemoryWriter
+{
+public:
+    FDuplicateDataWriter(TArray<uint8>& InData)
+        : FMemoryWriter(InData)
+    {
+    }
+
+    virtual FArchive& operator<<(UObject*& Object) override
+    {
+        uint64 Address = reinterpret_cast<uint64>(Object);
+        Serialize(Address);
+        return *this;
+    }
+};
+
+/**
+ * 객체 복제용 메모리 Reader
+ *
+ * FDuplicateDataWriter가 기록한 UObject 포인터를 읽을 때 DuplicatedObjects(원본 -> 복제본)로 바꿉니다.
+ * 표에 없는 객체(에셋 등 복제 대상이 아닌 객체)는 원본을 그대로 가리킵니다.
+ */
+class FDuplicateDataReader : public FMemoryReader
+{
+public:
+    FDuplicateDataReader(const TArray<uint8>& InData, const TMap<UObject*, UObject*>& InDuplicatedObjects)
+        : FMemoryReader(InData)
+        , DuplicatedObjects(InDuplicatedObjects)
+    {
+    }
+
+    virtual FArchive& operator<<(UObject*& Object) override
+    {
+        uint64 Address = 0;
+        Serialize(Address);
+
+        UObject* Source = reinterpret_cast<UObject*>(Address);
+        UObject* const* Duplicated = DuplicatedObjects.Find(Source);
+        Object = Duplicated ? *Duplicated : Source;
+        return *this;
+    }
+
+private:
+    const TMap<UObject*, UObject*>& DuplicatedObjects;
+};
@@ -1,9 +1,11 @@
 #include "Class.h"
 #include <cassert>
+#include <cstring>
 
 #include "EngineStatics.h"
 #include "UObjectArray.h"
 #include "Serialization/Archive.h"
+#include "Serialization/FieldArchive.h"
 
 
 UClass::UClass(
@@ -51,20 +53,90 @@ void UClass::RegisterProperty(const FProperty& Prop)
     Properties.Add(Prop);
 }
 
-void UClass::SerializeBin(FArchive& Ar, void* Data)
+const FProperty* UClass::FindProperty(const char* PropertyName) const
 {
-    // 상속받은 클래스의 프로퍼티들도 직렬화
-    if (SuperClass)
+    for (const UClass* TempClass = this; TempClass; TempClass = TempClass->GetSuperClass())
     {
-        SuperClass->SerializeBin(Ar, Data);
+        for (const FProperty& Prop : TempClass->Properties)
+        {
+            if (std::strcmp(Prop.Name, PropertyName) == 0)
+            {
+                return &Prop;
+            }
+        }
     }
+    return nullptr;
+}
 
-    // 이 클래스의 프로퍼티들 직렬화
-    for (const FProperty& Prop : Properties)
+void UClass::SerializeProperties(FFieldArchive& Ar, UObject* Object) const
+{
+    const EPropertyFlags SkipFlags = Ar.IsDuplicating() ? EPropertyFlags::DuplicateTransient : EPropertyFlags::Transient;
+    ForEachProperty([&Ar, Object, SkipFlags](const FProperty& Prop)
     {
-        void* PropData = static_cast<uint8*>(Data) + Prop.Offset;
-        Ar.Serialize(PropData, Prop.Size);
-    }
+        if (Prop.HasAnyFlags(SkipFlags))
+        {
+            return;
+        }
+
+        Prop.VisitValue(Object, [&Ar, &Prop]<typename T>(T& Value)
+        {
+            // 객체 참조는 복제 모드에서만 옮겨짐
+            if constexpr (std::is_same_v<T, UObject*>)
+            {
+                Ar.Reference(Value);
+            }
+            else if constexpr (std::is_same_v<T, TArray<UObject*>>)
+            {
+                Ar.ReferenceArray(Value);
+            }
+            else
+            {
+                Ar.Field(Prop.Name, Value);
+            }
+        });
+    });
+}
+
+void UClass::ExportProperties(const UObject* Object, TMap<FString, FString>& OutProperties) const
+{
+    ForEachProperty([Object, &OutProperties](const FProperty& Prop)
+    {
+        FString Text;
+        if (!Prop.HasAnyFlags(EPropertyFlags::Transient) && Prop.ExportText(Object, Text))
+        {
+            OutProperties.Add(Prop.Name, Text);
+        }
+    });
+}
+
+void UClass::ImportProperties(UObject* Object, const TMap<FString, FString>& InProperties) const
+{
+    ForEachProperty([Object, &InProperties](const FProperty& Prop)
+    {
+        if (Prop.HasAnyFlags(EPropertyFlags::Transient))
+        {
+            return;
+        }
+        if (const FString* Text = InProperties.Find(Prop.Name))
+        {
+            Prop.ImportText(Object, *Text);
+        }
+    });
+}
+
+void UClass::SerializeBin(FArchive& Ar, void* Data)
+{
+    // 부모 클래스의 Property부터 값 타입만 직렬화. 포인터와 Unknown 타입은 메모리를 그대로 쓸 수 없으므로 건너뜀
+    ForEachProperty([&Ar, Data](const FProperty& Prop)
+    {
+        Prop.VisitValue(Data, [&Ar]<typename T>(T& Value)
+        {
+            if constexpr (!std::is_same_v<T, UObject*> && !std::is_same_v<T, TArray<UObject*>>)
+            {
+                Ar << Value;
+            }
+        });
+    });
 }
 
 UObject* UClass::CreateDefaultObject()
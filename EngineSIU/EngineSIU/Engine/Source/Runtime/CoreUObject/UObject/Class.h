@@ -5,6 +5,8 @@
 
 
 class FArchive;
+class FFieldArchive;
+
 /**
  * UObject의 RTTI를 가지고 있는 클래스
  */
@@ -63,6 +65,7 @@ public:
         requires std::derived_from<T, UObject>
     T* GetDefaultObject() const;
 
+    /** 이 클래스에서 선언된 Property. 부모 클래스의 Property는 포함하지 않습니다. */
     const TArray<FProperty>& GetProperties() const { return Properties; }
 
     /**
@@ -71,6 +74,25 @@ public:
      */
     void RegisterProperty(const FProperty& Prop);
 
+    /** 부모 클래스의 Property부터 선언 순서대로 Func(const FProperty&)를 호출합니다. */
+    template <typename FuncType>
+    void ForEachProperty(FuncType&& Func) const;
+
+    /** 이 클래스와 부모 클래스에서 이름이 같은 Property를 찾습니다. */
+    const FProperty* FindProperty(const char* PropertyName) const;
+
+    /**
+     * Object의 Property를 필드로 직렬화합니다. UObject::SerializeFields에서 호출됩니다.
+     * 파일에는 Transient가 아닌 값 타입만, 복제 모드에서는 DuplicateTransient가 아닌 모든 Property를 옮깁니다.
+     */
+    void SerializeProperties(FFieldArchive& Ar, UObject* Object) const;
+
+    /** Transient가 아닌 값 타입 Property를 문자열로 OutProperties에 추가합니다. 텍스트 씬 파일에 사용합니다. */
+    void ExportProperties(const UObject* Object, TMap<FString, FString>& OutProperties) const;
+
+    /** ExportProperties로 만든 문자열 중 이름이 같은 Property를 읽습니다. */
+    void ImportProperties(UObject* Object, const TMap<FString, FString>& InProperties) const;
+
     /** 바이너리 직렬화 함수 */
     void SerializeBin(FArchive& Ar, void* Data);
 
@@ -98,6 +120,20 @@ bool UClass::IsChildOf() const
     return IsChildOf(T::StaticClass());
 }
 
+template <typename FuncType>
+void UClass::ForEachProperty(FuncType&& Func) const
+{
+    if (SuperClass)
+    {
+        SuperClass->ForEachProperty(Func);
+    }
+
+    for (const FProperty& Prop : Properties)
+    {
+        Func(Prop);
+    }
+}
+
 template <typename T>
     requires std::derived_from<T, UObject>
 T* UClass::GetDefaultObject() const
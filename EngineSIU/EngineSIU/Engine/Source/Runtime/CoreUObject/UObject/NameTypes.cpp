@@ -348,6 +348,8 @@ public:
 			return {DisplayValue.Hash};
 		}
 
+		MEMORY_TAG_SCOPE(Names);
+
 		const FNameComparisonValue ComparisonValue{Name};
 		if (!ComparisonPool.Find(ComparisonValue.Hash))
 		{
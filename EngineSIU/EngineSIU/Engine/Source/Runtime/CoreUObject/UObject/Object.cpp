@@ -4,6 +4,8 @@
 #include "Class.h"
 #include "Engine/Engine.h"
 
+DEFINE_LOG_CATEGORY(LogObject, Display)
+
 
 UClass* UObject::StaticClass()
 {
@@ -41,6 +43,11 @@ void UObject::Serialize(FArchive& Ar)
     // GetClass()->SerializeBin(Ar, this);
 }
 
+void UObject::SerializeFields(FFieldArchive& Ar)
+{
+    GetClass()->SerializeProperties(Ar, this);
+}
+
 UWorld* UObject::GetWorld() const
 {
     if (UObject* Outer = GetOuter())
@@ -1,12 +1,18 @@
 #pragma once
 #include "EngineLoop.h"
 #include "NameTypes.h"
+#include "Logging/LogMacros.h"
 
 extern FEngineLoop GEngineLoop;
 
+/** UObject 생성 로그 */
+DECLARE_LOG_CATEGORY_EXTERN(LogObject)
+
 class UClass;
 class UWorld;
 class AActor;
+class FFieldArchive;
+struct FProperty;
 
 class UObject
 {
@@ -49,6 +55,16 @@ public:
     virtual UWorld* GetWorld() const;
     virtual void Serialize(FArchive& Ar);
 
+    /**
+     * 저장할 필드를 타입과 함께 Ar에 넘깁니다. 씬 바이너리 저장/로드와 PIE 복제에 사용됩니다.
+     * UPROPERTY로 선언한 멤버는 여기서 모두 처리되므로, 하위 클래스는 UPROPERTY가 아닌 값만
+     * Super::SerializeFields를 먼저 호출한 뒤 추가합니다.
+     */
+    virtual void SerializeFields(FFieldArchive& Ar);
+
+    /** 에디터에서 Property 값을 바꾼 직후 호출됩니다. 값의 범위 보정 등을 합니다. */
+    virtual void PostEditChangeProperty(const FProperty& Property) {}
+
     FName GetFName() const { return NamePrivate; }
     FString GetName() const { return NamePrivate.ToString(); }
 
@@ -74,14 +90,8 @@ public:
     {
         //UE_LOG(LogLevel::Display, "UObject Created : %d", size);
 
-        void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
-            LogLevel::Display,
-            "TotalAllocationBytes : %d, TotalAllocationCount : %d",
-            FPlatformMemory::GetAllocationBytes<EAT_Object>(),
-            FPlatformMemory::GetAllocationCount<EAT_Object>()
-        );
-        return RawMemory;
+        // 할당마다 로그를 남기면 스레드별 카운터를 모두 합산하고 큐를 채우므로 남기지 않음. 합계는 "stat memory"로 확인
+        return FPlatformMemory::Malloc<EAT_Object>(size);
     }
 
     void operator delete(void* ptr, size_t size)
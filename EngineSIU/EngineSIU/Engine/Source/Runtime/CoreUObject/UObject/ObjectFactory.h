@@ -9,24 +9,29 @@
 class FObjectFactory
 {
 public:
+    /** 범위 안에서 만들어지는 객체의 생성 로그를 생략합니다. 월드 복제처럼 객체를 한 번에 많이 만들 때 사용합니다. */
+    struct FScopedSilentConstruction
+    {
+        FScopedSilentConstruction() { ++SilentConstructionDepth; }
+        ~FScopedSilentConstruction() { --SilentConstructionDepth; }
+    };
+
     static UObject* ConstructObject(UClass* InClass, UObject* InOuter, FName InName = NAME_None)
     {
         const uint32 Id = UEngineStatics::GenUUID();
-        FString Name = InClass->GetName() + "_" + std::to_string(Id);
-        if (InName != NAME_None)
-        {
-            Name = InName.ToString();
-        }
 
         UObject* Obj = InClass->ClassCTOR();
         Obj->ClassPrivate = InClass;
-        Obj->NamePrivate = Name;
+        Obj->NamePrivate = InName != NAME_None ? InName : FName(InClass->GetName() + "_" + std::to_string(Id));
         Obj->UUID = Id;
         Obj->OuterPrivate = InOuter;
 
         GUObjectArray.AddObject(Obj);
 
-        UE_LOG(LogLevel::Display, "Created New Object : %s", *Name);
+        if (SilentConstructionDepth == 0)
+        {
+            UE_LOG_CATEGORY(LogObject, LogLevel::Display, "Created New Object : %s", *Obj->GetName());
+        }
         return Obj;
     }
 
@@ -36,4 +41,7 @@ public:
     {
         return static_cast<T*>(ConstructObject(T::StaticClass(), InOuter));
     }
+
+private:
+    static inline thread_local int32 SilentConstructionDepth = 0;
 };
@@ -19,6 +19,7 @@ private: \
         TClass##_StaticClassRegistrar_() \
         { \
             UClass::GetClassMap().Add(#TClass, ThisClass::StaticClass()); \
+            FProperty::RegisterObjectPointerType(typeid(TClass*)); \
         } \
     } TClass##_StaticClassRegistrar_{}; \
 public: \
@@ -74,14 +75,28 @@ public: \
  * ```
  */
 #define UPROPERTY(Type, VarName, ...) \
+    UPROPERTY_WITH_FLAGS(None, Type, VarName, __VA_ARGS__)
+
+/**
+ * EPropertyFlags와 함께 UClass에 Property를 등록합니다.
+ * @param Flags EPropertyFlags. 열거자 이름만 적고 | 로 묶을 수 있습니다.
+ *
+ * Example Code
+ * ```
+ * UPROPERTY_WITH_FLAGS
+ * (EditAnywhere | Transient, float, Radius, = 1.0f)
+ * ```
+ */
+#define UPROPERTY_WITH_FLAGS(Flags, Type, VarName, ...) \
     Type VarName FIRST_ARG(__VA_ARGS__); \
     inline static struct VarName##_PropRegistrar \
     { \
         VarName##_PropRegistrar() \
         { \
+            using enum EPropertyFlags; \
             constexpr int64 Offset = offsetof(ThisClass, VarName); \
             ThisClass::StaticClass()->RegisterProperty( \
-                { #VarName, sizeof(Type), Offset } \
+                FProperty::Make<Type>(#VarName, Offset, Flags) \
             ); \
         } \
     } VarName##_PropRegistrar_{};
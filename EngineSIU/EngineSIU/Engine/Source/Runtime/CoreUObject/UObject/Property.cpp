@@ -1,2 +1,103 @@
 ﻿#include "Property.h"
+#include <typeindex>
+#include "Container/Set.h"
 
+namespace
+{
+    TSet<std::type_index>& GetObjectPointerTypes()
+    {
+        static TSet<std::type_index> ObjectPointerTypes;
+        return ObjectPointerTypes;
+    }
+}
+
+void FProperty::RegisterObjectPointerType(const std::type_info& InPointerType)
+{
+    GetObjectPointerTypes().Add(std::type_index(InPointerType));
+}
+
+bool FProperty::IsObjectProperty() const
+{
+    if (Type != EPropertyType::Object && Type != EPropertyType::ObjectArray)
+    {
+        return false;
+    }
+    // Property 등록은 정적 초기화 중에 일어나므로 가리키는 클래스의 등록 여부는 사용 시점에 확인
+    return PointerType && (*PointerType == typeid(UObject*) || GetObjectPointerTypes().Contains(std::type_index(*PointerType)));
+}
+
+
+bool FProperty::ExportText(const void* Container, FString& OutText) const
+{
+    if (Type == EPropertyType::Object || Type == EPropertyType::ObjectArray)
+    {
+        return false;
+    }
+
+    // Export는 값을 바꾸지 않음
+    return VisitValue(const_cast<void*>(Container), [&OutText]<typename T>(T& Value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            OutText = Value ? TEXT("true") : TEXT("false");
+        }
+        else if constexpr (std::is_same_v<T, int32>)
+        {
+            OutText = FString::FromInt(Value);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            OutText = FString::SanitizeFloat(Value);
+        }
+        else if constexpr (std::is_same_v<T, FString>)
+        {
+            OutText = Value;
+        }
+        else if constexpr (std::is_same_v<T, FName>)
+        {
+            OutText = Value.ToString();
+        }
+        else if constexpr (requires { Value.ToString(); })
+        {
+            OutText = Value.ToString();
+        }
+    });
+}
+
+bool FProperty::ImportText(void* Container, const FString& InText) const
+{
+    if (Type == EPropertyType::Object || Type == EPropertyType::ObjectArray)
+    {
+        return false;
+    }
+
+    bool bImported = true;
+    const bool bVisited = VisitValue(Container, [&InText, &bImported]<typename T>(T& Value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            Value = InText.ToBool();
+        }
+        else if constexpr (std::is_same_v<T, int32>)
+        {
+            Value = FString::ToInt(InText);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            Value = FString::ToFloat(InText);
+        }
+        else if constexpr (std::is_same_v<T, FString>)
+        {
+            Value = InText;
+        }
+        else if constexpr (std::is_same_v<T, FName>)
+        {
+            Value = FName(InText);
+        }
+        else if constexpr (requires { Value.InitFromString(InText); })
+        {
+            bImported = Value.InitFromString(InText);
+        }
+    });
+    return bVisited && bImported;
+}
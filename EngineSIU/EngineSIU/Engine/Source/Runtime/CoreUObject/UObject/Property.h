@@ -1,38 +1,184 @@
 ﻿#pragma once
-#include "Object.h"
+#include <type_traits>
+#include <typeinfo>
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Math/Color.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+#include "UObject/NameTypes.h"
 
+class UObject;
 
+
+/** 리플렉션 Property 값의 타입 */
+enum class EPropertyType : uint8
+{
+    Unknown,        // 이름과 위치만 등록되고, 직렬화 / 복제 / 에디터에서는 건너뜀
+    Bool,
+    Int32,
+    Float,
+    Vector2D,
+    Vector,
+    Vector4,
+    Rotator,
+    LinearColor,
+    String,
+    Name,
+    Object,         // 포인터. 가리키는 타입이 UObject 자식 클래스로 등록된 경우에만 방문
+    ObjectArray,    // 포인터의 TArray. 가리키는 타입이 UObject 자식 클래스로 등록된 경우에만 방문
+};
+
+enum class EPropertyFlags : uint32
+{
+    None = 0,
+    /** 에디터 Property 패널에서 편집할 수 있음 */
+    EditAnywhere = 1 << 0,
+    /** 에디터 Property 패널에 읽기 전용으로 표시 */
+    VisibleAnywhere = 1 << 1,
+    /** 씬 파일에 저장하지 않음 */
+    Transient = 1 << 2,
+    /** PIE 진입 등 객체를 복제할 때 복사하지 않음 */
+    DuplicateTransient = 1 << 3,
+};
+
+constexpr EPropertyFlags operator|(EPropertyFlags A, EPropertyFlags B)
+{
+    return static_cast<EPropertyFlags>(static_cast<uint32>(A) | static_cast<uint32>(B));
+}
+
+constexpr EPropertyFlags operator&(EPropertyFlags A, EPropertyFlags B)
+{
+    return static_cast<EPropertyFlags>(static_cast<uint32>(A) & static_cast<uint32>(B));
+}
+
+template <typename T>
+struct TPropertyType                        { static constexpr EPropertyType Value = EPropertyType::Unknown; };
+
+template <> struct TPropertyType<bool>         { static constexpr EPropertyType Value = EPropertyType::Bool; };
+template <> struct TPropertyType<int32>        { static constexpr EPropertyType Value = EPropertyType::Int32; };
+template <> struct TPropertyType<float>        { static constexpr EPropertyType Value = EPropertyType::Float; };
+template <> struct TPropertyType<FVector2D>    { static constexpr EPropertyType Value = EPropertyType::Vector2D; };
+template <> struct TPropertyType<FVector>      { static constexpr EPropertyType Value = EPropertyType::Vector; };
+template <> struct TPropertyType<FVector4>     { static constexpr EPropertyType Value = EPropertyType::Vector4; };
+template <> struct TPropertyType<FRotator>     { static constexpr EPropertyType Value = EPropertyType::Rotator; };
+template <> struct TPropertyType<FLinearColor> { static constexpr EPropertyType Value = EPropertyType::LinearColor; };
+template <> struct TPropertyType<FString>      { static constexpr EPropertyType Value = EPropertyType::String; };
+template <> struct TPropertyType<FName>        { static constexpr EPropertyType Value = EPropertyType::Name; };
+
+// UPROPERTY 선언 시점에는 가리키는 클래스가 전방 선언만 되어 있을 수 있으므로 상속 관계를 컴파일 타임에 확인할 수 없습니다.
+// 가리키는 타입(PointerType)을 함께 저장하고, DECLARE_CLASS로 등록된 클래스인지는 VisitValue에서 확인합니다.
+template <typename T> struct TPropertyType<T*>
+{
+    static constexpr EPropertyType Value = EPropertyType::Object;
+    static const std::type_info* PointerType() { return &typeid(T*); }
+};
+template <typename T> struct TPropertyType<TArray<T*>>
+{
+    static constexpr EPropertyType Value = EPropertyType::ObjectArray;
+    static const std::type_info* PointerType() { return &typeid(T*); }
+};
+
+
+/**
+ * UPROPERTY로 등록된 멤버 변수 하나의 정보
+ *
+ * 값은 VisitValue로 실제 타입을 꺼내 다룹니다. 씬 저장(SerializeFields), PIE 복제, 에디터 Property 패널이 모두 같은 방법을 사용합니다.
+ */
 struct FProperty
 {
-    FProperty(const char* InName, int32 InSize, int32 InOffset)
+    FProperty(const char* InName, EPropertyType InType, int64 InSize, int64 InOffset, EPropertyFlags InFlags = EPropertyFlags::None)
         : Name(InName)
+        , Type(InType)
+        , Flags(InFlags)
         , Size(InSize)
         , Offset(InOffset)
     {}
 
-    virtual ~FProperty() = default;
+    template <typename T>
+    static FProperty Make(const char* InName, int64 InOffset, EPropertyFlags InFlags)
+    {
+        FProperty Prop(InName, TPropertyType<T>::Value, sizeof(T), InOffset, InFlags);
+        if constexpr (requires { TPropertyType<T>::PointerType(); })
+        {
+            Prop.PointerType = TPropertyType<T>::PointerType();
+        }
+        return Prop;
+    }
+
+    /**
+     * TClass*를 UObject 포인터로 다뤄도 되는 타입으로 등록합니다. DECLARE_CLASS에서 호출됩니다.
+     * UObject가 첫 번째 부모인 클래스만 등록되어야 합니다.
+     */
+    static void RegisterObjectPointerType(const std::type_info& InPointerType);
 
     const char* Name;
+    EPropertyType Type;
+    EPropertyFlags Flags;
     int64 Size;
     int64 Offset;
-};
 
+    /** Object, ObjectArray 타입이 가리키는 포인터 타입. 그 외에는 nullptr */
+    const std::type_info* PointerType = nullptr;
+
+    bool HasAnyFlags(EPropertyFlags InFlags) const { return (Flags & InFlags) != EPropertyFlags::None; }
 
-// struct FNumericProperty : public FProperty
-// {
-//     FNumericProperty(const char* InName, int32 InSize, int32 InOffset)
-//         : FProperty(InName, InSize, InOffset)
-//     {}
-// };
-//
-// struct FInt8Property : public FNumericProperty
-// {
-//     FInt8Property(const char* InName, int32 InSize, int32 InOffset)
-//         : FNumericProperty(InName, InSize, InOffset)
-//     {}
-//
-//     virtual void Serialize(void* Data) const override
-//     {
-//         
-//     }
-// };
\ No newline at end of file
+    /** Object, ObjectArray 타입이고 가리키는 타입이 RegisterObjectPointerType으로 등록된 UObject 클래스인지 확인합니다. */
+    bool IsObjectProperty() const;
+
+    void* ContainerPtrToValuePtr(void* Container) const { return static_cast<uint8*>(Container) + Offset; }
+    const void* ContainerPtrToValuePtr(const void* Container) const { return static_cast<const uint8*>(Container) + Offset; }
+
+    /**
+     * Container에 있는 값을 실제 타입의 참조로 Visitor에 넘깁니다.
+     * Visitor는 EPropertyType의 모든 타입을 받을 수 있어야 합니다. (auto& 인자의 람다)
+     * Object는 UObject*&, ObjectArray는 TArray<UObject*>&로 넘어갑니다.
+     * @return Unknown 타입이거나, 가리키는 타입이 UObject 클래스로 등록되지 않은 포인터면 Visitor를 호출하지 않고 false
+     */
+    template <typename VisitorType>
+    bool VisitValue(void* Container, VisitorType&& Visitor) const;
+
+    /** 값을 문자열로 바꿉니다. 텍스트 씬 파일에 사용합니다. Object, ObjectArray, Unknown 타입은 false */
+    bool ExportText(const void* Container, FString& OutText) const;
+
+    /** ExportText로 만든 문자열을 값으로 읽습니다. */
+    bool ImportText(void* Container, const FString& InText) const;
+};
+
+template <typename VisitorType>
+bool FProperty::VisitValue(void* Container, VisitorType&& Visitor) const
+{
+    void* Value = ContainerPtrToValuePtr(Container);
+    switch (Type)
+    {
+    case EPropertyType::Bool:        Visitor(*static_cast<bool*>(Value)); return true;
+    case EPropertyType::Int32:       Visitor(*static_cast<int32*>(Value)); return true;
+    case EPropertyType::Float:       Visitor(*static_cast<float*>(Value)); return true;
+    case EPropertyType::Vector2D:    Visitor(*static_cast<FVector2D*>(Value)); return true;
+    case EPropertyType::Vector:      Visitor(*static_cast<FVector*>(Value)); return true;
+    case EPropertyType::Vector4:     Visitor(*static_cast<FVector4*>(Value)); return true;
+    case EPropertyType::Rotator:     Visitor(*static_cast<FRotator*>(Value)); return true;
+    case EPropertyType::LinearColor: Visitor(*static_cast<FLinearColor*>(Value)); return true;
+    case EPropertyType::String:      Visitor(*static_cast<FString*>(Value)); return true;
+    case EPropertyType::Name:        Visitor(*static_cast<FName*>(Value)); return true;
+    case EPropertyType::Object:
+        if (!IsObjectProperty())
+        {
+            return false;
+        }
+        Visitor(*static_cast<UObject**>(Value));
+        return true;
+    case EPropertyType::ObjectArray:
+        if (!IsObjectProperty())
+        {
+            return false;
+        }
+        Visitor(*static_cast<TArray<UObject*>*>(Value));
+        return true;
+    case EPropertyType::Unknown:
+    default:
+        return false;
+    }
+}
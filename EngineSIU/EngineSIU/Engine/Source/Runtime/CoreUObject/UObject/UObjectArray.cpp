@@ -5,10 +5,15 @@
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
+    ObjObjects.Insert(Object);
     AddToClassMap(Object);
 }
 
+void FUObjectArray::Reserve(int32 NumObjects)
+{
+    ObjObjects.Reserve(ObjObjects.Num() + NumObjects);
+}
+
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
     ObjObjects.Remove(Object);
@@ -12,6 +12,9 @@ public:
     void AddObject(UObject* Object);
     void MarkRemoveObject(UObject* Object);
 
+    /** 객체를 한 번에 많이 만들기 전에 NumObjects개가 더 들어갈 공간을 미리 확보합니다. */
+    void Reserve(int32 NumObjects);
+
     void ProcessPendingDestroyObjects();
 
     TSet<UObject*>& GetObjectItemArrayUnsafe()
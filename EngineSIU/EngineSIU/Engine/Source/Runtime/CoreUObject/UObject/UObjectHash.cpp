@@ -59,11 +59,11 @@ void AddToClassMap(UObject* Object)
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
     UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
+    HashTable.ClassToObjectListMap.FindOrAdd(Class).Insert(Object);
 
     for (UClass* SuperClass = Class->GetSuperClass(); SuperClass;)
     {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(Class);
+        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Insert(Class);
     
         Class = SuperClass;
         SuperClass = SuperClass->GetSuperClass();
@@ -39,6 +39,7 @@ void AActor::SetActorLabel(const FString& NewActorLabel, bool bUUID)
         {
             ActorLabel = NewActorLabel;
         }
+        MarkDirty();
     }
     
 }
@@ -1,4 +1,5 @@
 #include "CameraComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "ImGUI/imgui.h"
 #include "Engine/CurveManager.h"
 #include "GameFramework/Pawn.h"
@@ -85,6 +86,26 @@ void UCameraComponent::SetProperties(const TMap<FString, FString>& InProperties)
     }
 }
 
+void UCameraComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("FieldOfView"), FieldOfView);
+    Ar.Field(TEXT("AspectRatio"), AspectRatio);
+    Ar.Field(TEXT("NearClip"), NearClip);
+    Ar.Field(TEXT("FarClip"), FarClip);
+    Ar.Field(TEXT("OrthoZoom"), OrthoZoom);
+    Ar.Field(TEXT("OrthoWidth"), OrthoWidth);
+    Ar.Field(TEXT("OrthoNearClipPlane"), OrthoNearClipPlane);
+    Ar.Field(TEXT("OrthoFarClipPlane"), OrthoFarClipPlane);
+
+    int32 Mode = static_cast<int32>(ProjectionMode);
+    if (Ar.Field(TEXT("ProjectionMode"), Mode))
+    {
+        ProjectionMode = static_cast<ECameraProjectionMode>(Mode);
+    }
+    Ar.Field(TEXT("CurvePath"), CurvePath);
+}
+
 float UCameraComponent::GetCameraCurveValue(float t)
 {
     ImVec2 Curves[100];
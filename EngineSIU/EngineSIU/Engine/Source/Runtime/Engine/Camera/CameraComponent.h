@@ -14,6 +14,7 @@ public:
 
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
 
     // 카메라의 위치와 회전 설정
     float GetFieldOfView() const { return FieldOfView; }
@@ -1,6 +1,8 @@
 #include "ActorComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "GameFramework/Actor.h"
+#include "World/World.h"
 
 
 UObject* UActorComponent::Duplicate(UObject* InOuter)
@@ -10,6 +12,8 @@ UObject* UActorComponent::Duplicate(UObject* InOuter)
     NewComponent->OwnerPrivate = OwnerPrivate;
     NewComponent->bIsActive = bIsActive;
     NewComponent->bAutoActive = bAutoActive;
+    NewComponent->PrimaryComponentTick.TickInterval = PrimaryComponentTick.TickInterval;
+    NewComponent->PrimaryComponentTick.SetTickFunctionEnable(PrimaryComponentTick.IsTickFunctionEnabled());
 
     return NewComponent;
 }
@@ -29,12 +33,13 @@ void UActorComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     //Properties.Add(TEXT("bWantsInitializeComponent"), bWantsInitializeComponent ? TEXT("true") : TEXT("false"));
     Properties.Add(TEXT("bIsActive"), bIsActive ? TEXT("true") : TEXT("false"));
     Properties.Add(TEXT("bAutoActive"), bAutoActive ? TEXT("true") : TEXT("false"));
-    
+
+    GetClass()->ExportProperties(this, Properties);
 }
 
 void UActorComponent::SetProperties(const TMap<FString, FString>& Properties)
 {
-    // Super::ApplyProperties(Properties); // 만약 UObject 레벨에 있다면
+    GetClass()->ImportProperties(this, Properties);
 
     const FString* TempStr = nullptr;
 
@@ -65,6 +70,31 @@ void UActorComponent::SetProperties(const TMap<FString, FString>& Properties)
     }
 }
 
+void UActorComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 비트필드는 참조로 넘길 수 없으므로 복사본으로 주고받음
+    bool bActive = bIsActive;
+    if (Ar.Field(TEXT("bIsActive"), bActive))
+    {
+        bIsActive = bActive;
+    }
+    bool bAuto = bAutoActive;
+    if (Ar.Field(TEXT("bAutoActive"), bAuto))
+    {
+        bAutoActive = bAuto;
+    }
+
+    if (Ar.IsDuplicating())
+    {
+        bool bTickEnabled = PrimaryComponentTick.IsTickFunctionEnabled();
+        Ar.Field(TEXT("TickInterval"), PrimaryComponentTick.TickInterval);
+        Ar.Field(TEXT("bTickEnabled"), bTickEnabled);
+        PrimaryComponentTick.SetTickFunctionEnable(bTickEnabled);
+    }
+}
+
 void UActorComponent::InitializeComponent()
 {
     assert(!bHasBeenInitialized);
@@ -108,6 +138,8 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
 
     bIsBeingDestroyed = true;
 
+    RegisterComponentTickFunctions(false);
+
     // Owner에서 Component 제거하기
     if (AActor* MyOwner = GetOwner())
     {
@@ -134,14 +166,56 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
     GUObjectArray.MarkRemoveObject(this);
 }
 
+void UActorComponent::MarkDirty() const
+{
+    if (OwnerPrivate)
+    {
+        OwnerPrivate->MarkDirty();
+    }
+}
+
 void UActorComponent::Activate()
 {
-    // TODO: Tick 다시 재생
+    SetComponentTickEnabled(true);
     bIsActive = true;
 }
 
 void UActorComponent::Deactivate()
 {
-    // TODO: Tick 멈추기
+    SetComponentTickEnabled(false);
     bIsActive = false;
 }
+
+void UActorComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+    if (!bRegister)
+    {
+        PrimaryComponentTick.UnRegisterTickFunction();
+        return;
+    }
+
+    if (!PrimaryComponentTick.bCanEverTick || PrimaryComponentTick.IsTickFunctionRegistered() || bIsBeingDestroyed)
+    {
+        return;
+    }
+
+    AActor* Owner = GetOwner();
+    UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+    if (!World)
+    {
+        return;
+    }
+
+    PrimaryComponentTick.Target = this;
+    if (Owner->PrimaryActorTick.bCanEverTick)
+    {
+        // 같은 Group이면 Owner Actor의 Tick이 끝난 뒤에 실행
+        PrimaryComponentTick.AddPrerequisite(Owner->PrimaryActorTick);
+    }
+    PrimaryComponentTick.RegisterTickFunction(World->GetTickTaskManager());
+}
+
+void UActorComponent::SetComponentTickEnabled(bool bEnabled)
+{
+    PrimaryComponentTick.SetTickFunctionEnable(bEnabled);
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "Engine/EngineBaseTypes.h"
 #include "Engine/EngineTypes.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
@@ -19,13 +20,16 @@ public:
 
     /**
 * 이 컴포넌트의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-* 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
+* UPROPERTY는 여기서 모두 추가되므로, 하위 클래스는 UPROPERTY가 아닌 속성만 재정의하여 추가합니다.
 */
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const;
 
     /** 저장된 Properties 맵에서 컴포넌트의 상태를 복원합니다. */
     virtual void SetProperties(const TMap<FString, FString>& Properties);
 
+    /** 씬 바이너리 저장/로드와 PIE 복제용 필드 직렬화. 필드 이름은 GetProperties의 키와 같습니다. */
+    virtual void SerializeFields(FFieldArchive& Ar) override;
+
 
     /** AActor가 World에 Spawn되어 BeginPlay이전에 호출됩니다. */
     virtual void InitializeComponent();
@@ -52,6 +56,9 @@ public:
     /** 이 컴포넌트를 소유하고 있는 Actor를 반환합니다. */
     AActor* GetOwner() const { return OwnerPrivate; }
 
+    /** 값이 바뀌었음을 Owner에 알려 다음 자동 저장에 포함되게 합니다. */
+    void MarkDirty() const;
+
     /** 이 컴포넌트를 제거합니다. */
     virtual void DestroyComponent(bool bPromoteChildren = false);
 
@@ -67,8 +74,22 @@ public:
     void Activate();
     void Deactivate();
 
+public:
+    /**
+     * Owner Actor가 속한 World의 Tick Manager에 이 컴포넌트의 Tick 함수를 등록 / 해제합니다.
+     * Owner가 아직 World에 없으면 등록하지 않고, Actor가 World에 들어갈 때 다시 호출됩니다.
+     */
+    void RegisterComponentTickFunctions(bool bRegister);
+
+    void SetComponentTickEnabled(bool bEnabled);
+    bool IsComponentTickEnabled() const { return PrimaryComponentTick.IsTickFunctionEnabled(); }
+    void SetComponentTickInterval(float TickInterval) { PrimaryComponentTick.TickInterval = TickInterval; }
+
+    /** Tick 작업이 있는 컴포넌트만 생성자에서 bCanEverTick을 켭니다. */
+    FActorComponentTickFunction PrimaryComponentTick;
+
 private:
-    AActor* OwnerPrivate;
+    AActor* OwnerPrivate = nullptr;
 
     /** InitializeComponent가 호출 되었는지 여부 */
     uint8 bHasBeenInitialized : 1 = false;
@@ -1,4 +1,5 @@
 #include "BillboardComponent.h"
+#include "Serialization/FieldArchive.h"
 #include <DirectXMath.h>
 #include "Define.h"
 #include "World/World.h"
@@ -68,6 +69,23 @@ void UBillboardComponent::SetProperties(const TMap<FString, FString>& InProperti
     }
 }
 
+void UBillboardComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("FinalIndexU"), finalIndexU);
+    Ar.Field(TEXT("FinalIndexV"), finalIndexV);
+    if (Ar.Field(TEXT("BufferKey"), TexturePath) && Ar.IsLoading())
+    {
+        Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
+    }
+
+    if (Ar.IsDuplicating())
+    {
+        Ar.Reference(UUIDParent);
+        Ar.Field(TEXT("bIsEditorBillboard"), bIsEditorBillboard);
+    }
+}
+
 void UBillboardComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -15,6 +15,7 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(const FVector& InRayOrigin, const FVector& InRayDirection, float& OutHitDistance) const override;
 
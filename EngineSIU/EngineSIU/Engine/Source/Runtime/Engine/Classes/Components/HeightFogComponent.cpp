@@ -1,4 +1,5 @@
 #include "HeightFogComponent.h"
+#include "Serialization/FieldArchive.h"
 #include <UObject/Casts.h>
 
 UHeightFogComponent::UHeightFogComponent(float Density, float HeightFalloff, float StartDist, float EndDist, float DistanceWeight)
@@ -101,3 +102,15 @@ void UHeightFogComponent::SetProperties(const TMap<FString, FString>& InProperti
         FogInscatteringColor = FLinearColor(*TempStr);
     }
 }
+
+void UHeightFogComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("FogDensity"), FogDensity);
+    Ar.Field(TEXT("FogHeightFalloff"), FogHeightFalloff);
+    Ar.Field(TEXT("StartDistance"), StartDistance);
+    // 키 이름은 GetProperties와 맞춤
+    Ar.Field(TEXT("FogCutoffDistance"), FogDistanceWeight);
+    Ar.Field(TEXT("FogMaxOpacity"), EndDistance);
+    Ar.Field(TEXT("FogInscatteringColor"), FogInscatteringColor);
+}
@@ -1,4 +1,5 @@
 ﻿#include "AmbientLightComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "UObject/Casts.h"
 
@@ -37,6 +38,12 @@ void UAmbientLightComponent::SetProperties(const TMap<FString, FString>& InPrope
     }
 }
 
+void UAmbientLightComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("AmbientColor"), AmbientLightInfo.AmbientColor);
+}
+
 const FAmbientLightInfo& UAmbientLightComponent::GetAmbientLightInfo() const
 {
     return AmbientLightInfo;
@@ -13,6 +13,7 @@ public:
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
 
     const FAmbientLightInfo& GetAmbientLightInfo() const;
     void SetAmbientLightInfo(const FAmbientLightInfo& InAmbient);
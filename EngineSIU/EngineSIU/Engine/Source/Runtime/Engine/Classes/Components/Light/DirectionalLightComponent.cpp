@@ -1,4 +1,5 @@
 #include "DirectionalLightComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "Components/SceneComponent.h"
 #include "Math/JungleMath.h"
 #include "Math/Rotator.h"
@@ -58,6 +59,20 @@ void UDirectionalLightComponent::SetProperties(const TMap<FString, FString>& InP
     }
 }
 
+void UDirectionalLightComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 복제할 때는 그림자 정보까지 구조체째로 복사
+    if (Ar.Raw(DirectionalLightInfo))
+    {
+        return;
+    }
+    Ar.Field(TEXT("LightColor"), DirectionalLightInfo.LightColor);
+    Ar.Field(TEXT("Intensity"), DirectionalLightInfo.Intensity);
+    Ar.Field(TEXT("Direction"), DirectionalLightInfo.Direction);
+}
+
 
 FVector UDirectionalLightComponent::GetDirection()  
 {
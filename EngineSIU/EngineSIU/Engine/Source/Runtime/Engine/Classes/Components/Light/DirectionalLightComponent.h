@@ -14,6 +14,7 @@ public:
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
     FVector GetDirection();
     float GetShadowNearPlane() const;
 
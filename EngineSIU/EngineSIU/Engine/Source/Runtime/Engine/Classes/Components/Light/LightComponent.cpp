@@ -1,4 +1,5 @@
 #include "LightComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "UObject/Casts.h"
 
 ULightComponentBase::ULightComponentBase()
@@ -49,6 +50,13 @@ void ULightComponentBase::SetProperties(const TMap<FString, FString>& InProperti
     }
 }
 
+void ULightComponentBase::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("AABB_Min"), AABB.min);
+    Ar.Field(TEXT("AABB_Max"), AABB.max);
+}
+
 void ULightComponentBase::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -1,4 +1,5 @@
 #include "PointLightComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
@@ -283,6 +284,23 @@ void UPointLightComponent::SetProperties(const TMap<FString, FString>& InPropert
     
 }
 
+void UPointLightComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 복제할 때는 그림자 정보까지 구조체째로 복사
+    if (Ar.Raw(PointLightInfo))
+    {
+        return;
+    }
+    Ar.Field(TEXT("Radius"), PointLightInfo.Radius);
+    Ar.Field(TEXT("LightColor"), PointLightInfo.LightColor);
+    Ar.Field(TEXT("Intensity"), PointLightInfo.Intensity);
+    Ar.Field(TEXT("Type"), PointLightInfo.Type);
+    Ar.Field(TEXT("Attenuation"), PointLightInfo.Attenuation);
+    Ar.Field(TEXT("Position"), PointLightInfo.Position);
+}
+
 FPointLightInfo& UPointLightComponent::GetPointLightInfo()
 {
     return PointLightInfo;
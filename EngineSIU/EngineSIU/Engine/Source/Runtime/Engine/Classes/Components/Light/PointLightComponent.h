@@ -16,6 +16,7 @@ public:
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
 
     FPointLightInfo& GetPointLightInfo();
     void SetPointLightInfo(const FPointLightInfo& InPointLightInfo);
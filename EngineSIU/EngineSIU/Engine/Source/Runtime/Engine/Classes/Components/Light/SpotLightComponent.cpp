@@ -1,4 +1,5 @@
 #include "SpotLightComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "Math/JungleMath.h"
 #include "Math/Rotator.h"
@@ -100,6 +101,26 @@ void USpotLightComponent::SetProperties(const TMap<FString, FString>& InProperti
     }
 }
 
+void USpotLightComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 복제할 때는 그림자 정보까지 구조체째로 복사
+    if (Ar.Raw(SpotLightInfo))
+    {
+        return;
+    }
+    Ar.Field(TEXT("Position"), SpotLightInfo.Position);
+    Ar.Field(TEXT("Radius"), SpotLightInfo.Radius);
+    Ar.Field(TEXT("Direction"), SpotLightInfo.Direction);
+    Ar.Field(TEXT("LightColor"), SpotLightInfo.LightColor);
+    Ar.Field(TEXT("Intensity"), SpotLightInfo.Intensity);
+    Ar.Field(TEXT("Type"), SpotLightInfo.Type);
+    Ar.Field(TEXT("InnerRad"), SpotLightInfo.InnerRad);
+    Ar.Field(TEXT("OuterRad"), SpotLightInfo.OuterRad);
+    Ar.Field(TEXT("Attenuation"), SpotLightInfo.Attenuation);
+}
+
 FVector USpotLightComponent::GetDirection()
 {
     return GetForwardVector();
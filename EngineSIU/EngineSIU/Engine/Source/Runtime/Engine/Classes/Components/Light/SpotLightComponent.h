@@ -12,6 +12,7 @@ public:
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
     FVector GetDirection();
 
     FSpotLightInfo& GetSpotLightInfo();
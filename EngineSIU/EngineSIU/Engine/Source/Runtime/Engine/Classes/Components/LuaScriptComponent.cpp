@@ -5,10 +5,12 @@
 
 #include "World/World.h"
 #include "Level.h"
+#include "Serialization/FieldArchive.h"
 
 
 ULuaScriptComponent::ULuaScriptComponent()
 {
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UObject* ULuaScriptComponent::Duplicate(UObject* InOuter)
@@ -20,10 +22,24 @@ UObject* ULuaScriptComponent::Duplicate(UObject* InOuter)
 
     NewComponent->ScriptName = ScriptName;
     NewComponent->SelfTable = SelfTable;
+    NewComponent->LuaBeginPlay = LuaBeginPlay;
+    NewComponent->LuaTick = LuaTick;
+    NewComponent->LuaEndPlay = LuaEndPlay;
  
     return NewComponent;
 }
 
+void ULuaScriptComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // Lua Table은 BeginPlay에서 새로 만들어지므로 스크립트 경로만 복제
+    if (Ar.IsDuplicating())
+    {
+        Ar.Field(TEXT("ScriptName"), ScriptName);
+    }
+}
+
 void ULuaScriptComponent::InitializeComponent()
 {
     if (HasBeenInitialized())
@@ -53,31 +69,33 @@ void ULuaScriptComponent::BeginPlay()
         ScriptName = FString::Printf(TEXT("Scripts/%s/%s.lua"), *SceneName, *GetOwner()->GetClass()->GetName());
     }
 
-    if (SelfTable.valid() && SelfTable["BeginPlay"].valid())
-    {
-        ActivateFunction("BeginPlay", SelfTable);
-    }
+    CallLuaFunction(LuaBeginPlay);
 }
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
-    if (SelfTable.valid() && SelfTable["Tick"].valid())
-    {
-        ActivateFunction("Tick", DeltaTime);
-    }
+    CallLuaFunction(LuaTick, DeltaTime);
 }
 
 void ULuaScriptComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    if (SelfTable.valid() && SelfTable["EndPlay"].valid())
+    CallLuaFunction(LuaEndPlay, EndPlayReason);
+
+    if (bInTickBatch)
     {
-        ActivateFunction("EndPlay", EndPlayReason);
+        FLuaScriptManager::Get().RemoveFromTickBatch(this);
+        bInTickBatch = false;
     }
 }
 
 void ULuaScriptComponent::DestroyComponent(bool bPromoteChildren)
 {
+    if (bInTickBatch)
+    {
+        FLuaScriptManager::Get().RemoveFromTickBatch(this);
+        bInTickBatch = false;
+    }
     FLuaScriptManager::Get().UnRigisterActiveLuaComponent(this);
     Super::DestroyComponent(bPromoteChildren);
 }
@@ -90,7 +108,20 @@ bool ULuaScriptComponent::LoadScript()
         ScriptName = FString::Printf(TEXT("Scripts/%s/%s.lua"), *SceneName, *GetOwner()->GetClass()->GetName());
     }
 
+    // 핫 리로드 대상 역색인에 등록. 이미 등록되어 있으면 무시됨
+    FLuaScriptManager::Get().RegisterActiveLuaComponent(this);
+
+    // 리로드라면 이전 Table로 묶여 있던 Batch에서 먼저 빠짐.
+    // Tick이 켜져 있던 컴포넌트만 Batch에 들어가므로(CacheLifecycleFunctions) 켜는 것이 묶이기 전 상태로 되돌리는 것
+    if (bInTickBatch)
+    {
+        FLuaScriptManager::Get().RemoveFromTickBatch(this);
+        bInTickBatch = false;
+        SetComponentTickEnabled(true);
+    }
+
     SelfTable = FLuaScriptManager::Get().CreateLuaTable(ScriptName);
+    CacheLifecycleFunctions();
 
     if (!SelfTable.valid())
     {
@@ -99,3 +130,35 @@ bool ULuaScriptComponent::LoadScript()
 
     return true;
 }
+
+void ULuaScriptComponent::CacheLifecycleFunctions()
+{
+    auto FindFunction = [this](const char* FunctionName)
+    {
+        const sol::object Object = SelfTable[FunctionName];
+        return Object.get_type() == sol::type::function ? Object.as<sol::protected_function>() : sol::protected_function();
+    };
+
+    if (!SelfTable.valid())
+    {
+        LuaBeginPlay = LuaTick = LuaEndPlay = sol::protected_function();
+        return;
+    }
+
+    LuaBeginPlay = FindFunction("BeginPlay");
+    LuaTick = FindFunction("Tick");
+    LuaEndPlay = FindFunction("EndPlay");
+
+    // TickBatch가 있으면 개별 Tick 대신 스크립트 단위로 묶어서 Tick.
+    // Batch는 켜진 컴포넌트를 모두 Tick하므로 Tick이 꺼진 컴포넌트는 묶지 않고, Editor World는 Tick하지 않으므로 Game / PIE만 묶음
+    const sol::protected_function TickBatch = FindFunction("TickBatch");
+    const UWorld* World = GetWorld();
+    if (TickBatch.valid() && World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE)
+        && PrimaryComponentTick.IsTickFunctionEnabled())
+    {
+        FLuaScriptManager::Get().AddToTickBatch(this, TickBatch);
+        bInTickBatch = true;
+        LuaTick = sol::protected_function();
+        SetComponentTickEnabled(false);
+    }
+}
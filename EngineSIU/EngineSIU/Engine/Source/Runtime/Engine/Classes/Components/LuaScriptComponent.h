@@ -16,6 +16,7 @@ public:
     ULuaScriptComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
 
     virtual void InitializeComponent() override;
 
@@ -36,9 +37,25 @@ public:
 
     sol::table& GetLuaSelfTable() { return SelfTable; }
 
+    /** 스크립트의 TickBatch로 다른 인스턴스와 함께 Tick되는 중인지 여부 */
+    bool IsInTickBatch() const { return bInTickBatch; }
+
+private:
+    /** 로드 / 리로드 때 생명주기 함수를 찾아서 캐시합니다. 매 프레임 Table 조회를 하지 않기 위해 사용 */
+    void CacheLifecycleFunctions();
+
+    template<typename... Args>
+    void CallLuaFunction(const sol::protected_function& Function, Args&&... args);
+
 private:
     FString ScriptName;
     sol::table SelfTable;
+
+    sol::protected_function LuaBeginPlay;
+    sol::protected_function LuaTick;
+    sol::protected_function LuaEndPlay;
+
+    bool bInTickBatch = false;
 };
 
 template<typename ...Args>
@@ -54,3 +71,17 @@ inline void ULuaScriptComponent::ActivateFunction(const FString& FunctionName, A
         }
     }
 }
+
+template<typename ...Args>
+inline void ULuaScriptComponent::CallLuaFunction(const sol::protected_function& Function, Args && ...args)
+{
+    if (Function.valid())
+    {
+        sol::protected_function_result Result = Function(SelfTable, std::forward<Args>(args)...);
+        if (!Result.valid())
+        {
+            sol::error err = Result;
+            UE_LOG(LogLevel::Error, TEXT("Lua Error: %s"), *FString(err.what()));
+        }
+    }
+}
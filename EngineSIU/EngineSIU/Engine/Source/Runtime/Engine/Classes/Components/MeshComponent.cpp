@@ -2,6 +2,7 @@
 
 #include "CoreMiscDefines.h"
 #include "UObject/Casts.h"
+#include "Serialization/FieldArchive.h"
 
 
 UObject* UMeshComponent::Duplicate(UObject* InOuter)
@@ -23,6 +24,17 @@ void UMeshComponent::SetProperties(const TMap<FString, FString>& InProperties)
     Super::SetProperties(InProperties);
 }
 
+void UMeshComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 머티리얼 오버라이드는 아직 씬 파일에 저장하지 않으므로 복제할 때만 옮김
+    if (Ar.ReferenceArray(OverrideMaterials))
+    {
+        Ar.Field(TEXT("SelectedSubMeshIndex"), selectedSubMeshIndex);
+    }
+}
+
 UMaterial* UMeshComponent::GetMaterial(uint32 ElementIndex) const
 {
     if (OverrideMaterials.IsValidIndex(ElementIndex))
@@ -1,4 +1,5 @@
 #include "ParticleSubUVComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "EngineLoop.h"
 #include "UObject/Casts.h"
 #include "D3D11RHI/DXDBufferManager.h"
@@ -8,6 +9,7 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 {
     SetType(StaticClass()->GetName());
     bIsLoop = true;
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 // Duplicate: 버퍼 포인터는 복사하지 않고 애니메이션 상태만 복제
@@ -96,6 +98,20 @@ void UParticleSubUVComponent::SetProperties(const TMap<FString, FString>& InProp
     }
 }
 
+void UParticleSubUVComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("bIsLoop"), bIsLoop);
+    Ar.Field(TEXT("CellsPerRow"), CellsPerRow);
+    Ar.Field(TEXT("CellsPerColumn"), CellsPerColumn);
+    Ar.Field(TEXT("IndexU"), indexU);
+    Ar.Field(TEXT("IndexV"), indexV);
+    Ar.Field(TEXT("ElapsedTime"), elapsedTime);
+    Ar.Field(TEXT("FrameDuration"), FrameDuration);
+    Ar.Field(TEXT("UVScale"), UVScale);
+    Ar.Field(TEXT("UVOffset"), UVOffset);
+}
+
 // InitializeComponent: 초기화 시 버텍스 버퍼 생성
 void UParticleSubUVComponent::InitializeComponent()
 {
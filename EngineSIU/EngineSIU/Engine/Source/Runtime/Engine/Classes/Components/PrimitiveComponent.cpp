@@ -1,4 +1,5 @@
 #include "PrimitiveComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "UObject/Casts.h"
 #include "UObject/UObjectIterator.h"
 #include "Shapes/ShapeComponent.h"
@@ -108,6 +109,14 @@ void UPrimitiveComponent::SetProperties(const TMap<FString, FString>& InProperti
     if (AABBmaxStr) AABB.max.InitFromString(*AABBmaxStr);
 }
 
+void UPrimitiveComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("m_Type"), m_Type);
+    Ar.Field(TEXT("AABB_min"), AABB.min);
+    Ar.Field(TEXT("AABB_max"), AABB.max);
+}
+
 // PrimitiveComponent.cpp
 void UPrimitiveComponent::ProcessOverlaps()
 {
@@ -16,6 +16,7 @@ public:
 
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
     void ProcessOverlaps();
 
     FBoundingBox AABB;
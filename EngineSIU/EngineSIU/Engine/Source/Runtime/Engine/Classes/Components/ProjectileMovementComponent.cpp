@@ -1,4 +1,5 @@
 #include "ProjectileMovementComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "GameFramework/Actor.h"
 
 UProjectileMovementComponent::UProjectileMovementComponent()
@@ -9,6 +10,9 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = FVector(0.f, 0.f, 0.f);
     ProjectileLifetime = 10.0f; // 기본 생명주기 설정
     AccumulatedTime = 0;
+
+    // Owner의 Transform을 바꾸고 Actor를 제거하므로 게임 스레드에서만 Tick
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -113,3 +117,14 @@ void UProjectileMovementComponent::SetProperties(const TMap<FString, FString>& I
     }
     
 }
+
+void UProjectileMovementComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("ProjectileLifetime"), ProjectileLifetime);
+    Ar.Field(TEXT("AccumulatedTime"), AccumulatedTime);
+    Ar.Field(TEXT("InitialSpeed"), InitialSpeed);
+    Ar.Field(TEXT("MaxSpeed"), MaxSpeed);
+    Ar.Field(TEXT("Gravity"), Gravity);
+    Ar.Field(TEXT("Velocity"), Velocity);
+}
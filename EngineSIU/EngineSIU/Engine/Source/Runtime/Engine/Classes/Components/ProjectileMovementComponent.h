@@ -38,6 +38,7 @@ public:
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
 
 private:
     float ProjectileLifetime; // 생명주기
@@ -3,6 +3,7 @@
 #include "GameFramework/Actor.h"
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
+#include "Math/MathBatch.h"
 #include "Math/Quat.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
@@ -28,9 +29,6 @@ UObject* USceneComponent::Duplicate(UObject* InOuter)
 void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
     Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("RelativeLocation"), *RelativeLocation.ToString());
-    OutProperties.Add(TEXT("RelativeRotation"), *RelativeRotation.ToString());
-    OutProperties.Add(TEXT("RelativeScale3D"), *RelativeScale3D.ToString());
 
     USceneComponent* ParentComp = GetAttachParent();
     if (ParentComp != nullptr) {
@@ -42,27 +40,6 @@ void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     }
 }
 
-void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("RelativeLocation"));
-    if (TempStr)
-    {
-        RelativeLocation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeRotation"));
-    if (TempStr)
-    {
-        RelativeRotation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeScale3D"));
-    if (TempStr)
-    {
-        RelativeScale3D.InitFromString(*TempStr);
-    }
-}
-
 void USceneComponent::TickComponent(float DeltaTime)
 {
 	Super::TickComponent(DeltaTime);
@@ -148,22 +125,26 @@ FVector USceneComponent::GetUpVector() const
 void USceneComponent::AddLocation(const FVector& InAddValue)
 {
 	RelativeLocation = RelativeLocation + InAddValue;
-
+    MarkDirty();
 }
 
 void USceneComponent::AddRotation(const FRotator& InAddValue)
 {
 	RelativeRotation = RelativeRotation + InAddValue;
     RelativeRotation.Normalize();
+    MarkDirty();
 }
 
 void USceneComponent::AddScale(const FVector& InAddValue)
 {
 	RelativeScale3D = RelativeScale3D + InAddValue;
+    MarkDirty();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
 {
+    MarkDirty();
+
     // 기존 부모와 연결을 끊기
     if (AttachParent)
     {
@@ -210,6 +191,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& InQuat)
     FQuat NormalizedQuat = InQuat.GetSafeNormal();
     RelativeRotation = NormalizedQuat.Rotator();
     RelativeRotation.Normalize();
+    MarkDirty();
 }
 
 void USceneComponent::SetWorldLocation(const FVector& InLocation)
@@ -219,10 +201,13 @@ void USceneComponent::SetWorldLocation(const FVector& InLocation)
     if (AttachParent)
     {
         FMatrix ParentMatrix = AttachParent->GetWorldMatrix().GetMatrixWithoutScale();
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        FMatrix InverseParentMatrix;
+        FMathBatch::InverseAffine(ParentMatrix, InverseParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * InverseParentMatrix;
     }
     FVector NewRelativeLocation = NewRelativeMatrix.GetTranslationVector();
     RelativeLocation = NewRelativeLocation;
+    MarkDirty();
 }
 
 void USceneComponent::SetWorldRotation(const FRotator& InRotation)
@@ -237,11 +222,14 @@ void USceneComponent::SetWorldRotation(const FQuat& InQuat)
     if (AttachParent)
     {
         FMatrix ParentMatrix = AttachParent->GetWorldMatrix().GetMatrixWithoutScale();
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        FMatrix InverseParentMatrix;
+        FMathBatch::InverseAffine(ParentMatrix, InverseParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * InverseParentMatrix;
     }
     FQuat NewRelativeRotation = FQuat(NewRelativeMatrix);
     RelativeRotation = FRotator(NewRelativeRotation);
-    RelativeRotation.Normalize();   
+    RelativeRotation.Normalize();
+    MarkDirty();
 }
 
 void USceneComponent::SetWorldScale3D(const FVector& InScale)
@@ -251,10 +239,13 @@ void USceneComponent::SetWorldScale3D(const FVector& InScale)
     if (AttachParent)
     {
         FMatrix ParentMatrix = FMatrix::GetScaleMatrix(AttachParent->RelativeScale3D);
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        FMatrix InverseParentMatrix;
+        FMathBatch::InverseAffine(ParentMatrix, InverseParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * InverseParentMatrix;
     }
     FVector NewRelativeScale = NewRelativeMatrix.GetScaleVector();
     RelativeScale3D = NewRelativeScale;
+    MarkDirty();
 }
 
 FVector USceneComponent::GetWorldLocation() const
@@ -344,6 +335,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
         )
     {
         AttachParent = InParent;
+        MarkDirty();
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
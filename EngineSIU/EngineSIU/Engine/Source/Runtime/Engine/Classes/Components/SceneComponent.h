@@ -14,7 +14,6 @@ public:
 
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
 
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(const FVector& InRayOrigin, const FVector& InRayDirection, float& OutHitDistance) const;
@@ -36,10 +35,10 @@ public:
     void DetachFromComponent(USceneComponent* Target);
 
 public:
-    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; }
+    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; MarkDirty(); }
     void SetRelativeRotation(const FRotator& InRotation);
     void SetRelativeRotation(const FQuat& InQuat);
-    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; }
+    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; MarkDirty(); }
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
     FRotator GetRelativeRotation() const { return RelativeRotation; }
@@ -75,9 +74,10 @@ protected:
     (FVector, RelativeScale3D);
 
 
-    UPROPERTY
-    (USceneComponent*, AttachParent, = nullptr);
+    // 부착 관계는 씬 파일의 컴포넌트 레코드와 FLevelDuplicator가 따로 연결함
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, USceneComponent*, AttachParent, = nullptr);
 
-    UPROPERTY
-    (TArray<USceneComponent*>, AttachChildren);
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, TArray<USceneComponent*>, AttachChildren);
 };
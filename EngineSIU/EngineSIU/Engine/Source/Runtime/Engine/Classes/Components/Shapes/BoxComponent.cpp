@@ -20,23 +20,6 @@ UObject* UBoxComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
-void UBoxComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("BoxExtent"), BoxExtent.ToString());
-}
-
-void UBoxComponent::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("BoxExtent"));
-    if (TempStr)
-    {
-        BoxExtent.InitFromString(*TempStr);
-    }
-}
-
 bool UBoxComponent::CheckOverlap(const UPrimitiveComponent* Other) const
 {
     if (const UBoxComponent* Box = Cast<UBoxComponent>(Other))
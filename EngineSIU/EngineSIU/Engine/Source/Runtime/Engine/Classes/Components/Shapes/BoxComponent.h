@@ -13,9 +13,6 @@ public:
     
     virtual UObject* Duplicate(UObject* InOuter) override;
 
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
-
     FVector GetBoxExtent() const { return BoxExtent; }
     void SetBoxExtent(FVector InExtent) { BoxExtent = InExtent; }
     
@@ -26,6 +23,7 @@ public:
     FBox GetWorldBox() const;
   
 private:
-    FVector BoxExtent = FVector::ZeroVector;
+    UPROPERTY_WITH_FLAGS
+    (EditAnywhere, FVector, BoxExtent, = FVector::ZeroVector)
 };
 
@@ -21,27 +21,13 @@ UObject* UCapsuleComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
-void UCapsuleComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UCapsuleComponent::PostEditChangeProperty(const FProperty& Property)
 {
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("CapsuleHalfHeight"));
-    if (TempStr)
-    {
-        CapsuleHalfHeight = FCString::Atof(**TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("CapsuleRadius"));
-    if (TempStr)
-    {
-        CapsuleRadius = FCString::Atof(**TempStr);
-    }
-}
+    Super::PostEditChangeProperty(Property);
 
-void UCapsuleComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("CapsuleHalfHeight"), FString::SanitizeFloat(CapsuleHalfHeight));
-    OutProperties.Add(TEXT("CapsuleRadius"), FString::SanitizeFloat(CapsuleRadius));
+    // Setter와 같은 범위로 보정
+    SetHalfHeight(CapsuleHalfHeight);
+    SetRadius(CapsuleRadius);
 }
 
 bool UCapsuleComponent::CheckOverlap(const UPrimitiveComponent* Other) const
@@ -14,8 +14,7 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
+    virtual void PostEditChangeProperty(const FProperty& Property) override;
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override;
 
@@ -51,8 +50,11 @@ public:
 
 
 private:
-    float CapsuleHalfHeight = 1;
-    float CapsuleRadius = 1;
+    UPROPERTY_WITH_FLAGS
+    (EditAnywhere, float, CapsuleHalfHeight, = 1)
+
+    UPROPERTY_WITH_FLAGS
+    (EditAnywhere, float, CapsuleRadius, = 1)
 
 
 };
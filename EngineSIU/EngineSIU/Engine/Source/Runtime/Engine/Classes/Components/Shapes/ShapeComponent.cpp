@@ -1,4 +1,5 @@
 #include "ShapeComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "UObject/Casts.h"
 
@@ -42,3 +43,15 @@ void UShapeComponent::SetProperties(const TMap<FString, FString>& InProperties)
     }
 }
 
+void UShapeComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    FLinearColor Color = FLinearColor(ShapeColor);
+    if (Ar.Field(TEXT("Color"), Color) && Ar.IsLoading())
+    {
+        ShapeColor = Color.ToColorSRGB();
+    }
+    Ar.Field(TEXT("DrawOnlySelected"), bDrawOnlyIfSelected);
+}
+
@@ -13,6 +13,7 @@ public:
 
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
 
 public:
     FColor GetShapeColor() const { return ShapeColor; }
@@ -52,20 +52,3 @@ bool USphereComponent::CheckOverlap(const UPrimitiveComponent* Other) const
     return false;
 }
 
-
-void USphereComponent::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("SphereRadius"));
-    if (TempStr)
-    {
-        SphereRadius = FCString::Atof(**TempStr);
-    }
-}
-
-void USphereComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("SphereRadius"), FString::SanitizeFloat(SphereRadius));
-}
@@ -15,15 +15,13 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-
     void SetRadius(float InRadius) { SphereRadius = InRadius; }
     float GetRadius() const { return SphereRadius; }
 
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override;
 private:
-    float SphereRadius = 0;
+    UPROPERTY_WITH_FLAGS
+    (EditAnywhere, float, SphereRadius, = 0)
 };
 
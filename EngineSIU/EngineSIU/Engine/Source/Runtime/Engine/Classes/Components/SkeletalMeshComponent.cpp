@@ -1,10 +1,12 @@
 #include "SkeletalMeshComponent.h"
+#include "Serialization/FieldArchive.h"
 #include "Engine/Resource/FBXManager.h"
 #include "UObject/Casts.h"
 
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
     //SkeletalMeshAsset = FFBXManager::Get().LoadSkeletalMesh("C:\\Users\\Jungle\\Desktop\\character.fbx");
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UObject* USkeletalMeshComponent::Duplicate(UObject* InOuter)
@@ -66,6 +68,37 @@ void USkeletalMeshComponent::SetProperties(const TMap<FString, FString>& InPrope
     }
 }
 
+void USkeletalMeshComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 복제할 때는 에셋을 다시 찾지 않고 같은 에셋을 가리키게 함
+    if (Ar.Reference(SkeletalMeshAsset))
+    {
+        return;
+    }
+
+    FString SkeletalMeshPath = TEXT("None");
+    if (Ar.IsSaving() && GetSkeletalMesh())
+    {
+        SkeletalMeshPath = GetSkeletalMesh()->GetRenderData()->FilePath;
+    }
+
+    if (Ar.Field(TEXT("SkeletalMeshPath"), SkeletalMeshPath) && Ar.IsLoading())
+    {
+        USkeletalMesh* MeshToSet = nullptr;
+        if (SkeletalMeshPath != TEXT("None"))
+        {
+            MeshToSet = FFBXManager::Get().LoadFbx(SkeletalMeshPath);
+            if (MeshToSet == nullptr)
+            {
+                UE_LOG(LogLevel::Warning, TEXT("Could not load SkeletalMesh '%s' for %s"), *SkeletalMeshPath, *GetName());
+            }
+        }
+        SetSkeletalMesh(MeshToSet);
+    }
+}
+
 void USkeletalMeshComponent::BeginPlay()
 {
     USkinnedMeshComponent::BeginPlay();
@@ -1,10 +1,14 @@
 #include "SkySphereComponent.h"
 #include "UObject/Casts.h"
+#include "Serialization/FieldArchive.h"
 
 
 USkySphereComponent::USkySphereComponent()
 {
     SetType(StaticClass()->GetName());
+    PrimaryComponentTick.bCanEverTick = true;
+    // Tick은 자신의 UV 오프셋만 바꾸므로 Worker 스레드에서 실행해도 됨
+    PrimaryComponentTick.bRunOnAnyThread = true;
 }
 
 UObject* USkySphereComponent::Duplicate(UObject* InOuter)
@@ -17,6 +21,18 @@ UObject* USkySphereComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
+void USkySphereComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 흐르는 중인 UV 오프셋은 복제할 때만 이어받음
+    if (Ar.IsDuplicating())
+    {
+        Ar.Field(TEXT("UOffset"), UOffset);
+        Ar.Field(TEXT("VOffset"), VOffset);
+    }
+}
+
 void USkySphereComponent::TickComponent(float DeltaTime)
 {
     UOffset += 0.005f;
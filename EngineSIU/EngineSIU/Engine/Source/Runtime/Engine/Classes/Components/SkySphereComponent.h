@@ -10,6 +10,7 @@ public:
     USkySphereComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void SerializeFields(FFieldArchive& Ar) override;
 
     virtual void TickComponent(float DeltaTime) override;
     float UOffset = 0;
@@ -1,4 +1,5 @@
 #include "SpringArmComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "GameFramework/Pawn.h"
 #include "Math/JungleMath.h"
@@ -33,6 +34,10 @@ USpringArmComponent::USpringArmComponent() : Super()
     // bClampToMaxPhysicsDeltaTime = false;
 
     UnfixedCameraPosition = FVector::ZeroVector;
+
+    PrimaryComponentTick.bCanEverTick = true;
+    // 카메라 위치를 정하므로 Actor 이동이 끝난 뒤에 갱신
+    PrimaryComponentTick.SetTickGroup(TG_PostPhysics);
 }
 
 void USpringArmComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -119,6 +124,51 @@ void USpringArmComponent::SetProperties(const TMap<FString, FString>& InProperti
     }
 }
 
+void USpringArmComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("TargetArmLength"), TargetArmLength);
+    Ar.Field(TEXT("SocketOffset"), SocketOffset);
+    Ar.Field(TEXT("TargetOffset"), TargetOffset);
+
+    // 비트필드는 참조로 넘길 수 없으므로 복사본으로 주고받음
+    bool Flag = false;
+    Flag = bUsePawnControlRotation;
+    if (Ar.Field(TEXT("bUsePawnControlRotation"), Flag))
+    {
+        bUsePawnControlRotation = Flag;
+    }
+    Flag = bInheritPitch;
+    if (Ar.Field(TEXT("bInheritPitch"), Flag))
+    {
+        bInheritPitch = Flag;
+    }
+    Flag = bInheritYaw;
+    if (Ar.Field(TEXT("bInheritYaw"), Flag))
+    {
+        bInheritYaw = Flag;
+    }
+    Flag = bInheritRoll;
+    if (Ar.Field(TEXT("bInheritRoll"), Flag))
+    {
+        bInheritRoll = Flag;
+    }
+    Flag = bEnableCameraLag;
+    if (Ar.Field(TEXT("bEnableCameraLag"), Flag))
+    {
+        bEnableCameraLag = Flag;
+    }
+    Flag = bEnableCameraRotationLag;
+    if (Ar.Field(TEXT("bEnableCameraRotationLag"), Flag))
+    {
+        bEnableCameraRotationLag = Flag;
+    }
+
+    Ar.Field(TEXT("CameraLagSpeed"), CameraLagSpeed);
+    Ar.Field(TEXT("CameraRotationLagSpeed"), CameraRotationLagSpeed);
+    Ar.Field(TEXT("CameraLagMaxDistance"), CameraLagMaxDistance);
+}
+
 FRotator USpringArmComponent::GetTargetRotation() const
 {
     FRotator DesiredRot = GetDesiredRotation();
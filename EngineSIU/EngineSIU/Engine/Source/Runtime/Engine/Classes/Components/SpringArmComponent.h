@@ -11,6 +11,7 @@ public:
 public:
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& Properties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
 
 
 private:
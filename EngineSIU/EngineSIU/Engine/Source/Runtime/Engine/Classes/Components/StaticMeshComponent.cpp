@@ -1,7 +1,9 @@
 #include "Components/StaticMeshComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "Engine/ObjLoader.h"
 #include "Launch/EngineLoop.h"
+#include "Rendering/Mesh/StaticMeshLOD.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
 
@@ -83,6 +85,37 @@ void UStaticMeshComponent::SetProperties(const TMap<FString, FString>& InPropert
     }
 }
 
+void UStaticMeshComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    // 복제할 때는 에셋을 다시 찾지 않고 같은 에셋을 가리키게 함
+    if (Ar.Reference(StaticMesh))
+    {
+        return;
+    }
+
+    FString StaticMeshPath = TEXT("None");
+    if (Ar.IsSaving() && GetStaticMesh())
+    {
+        StaticMeshPath = FString(GetStaticMesh()->GetOjbectName().c_str());
+    }
+
+    if (Ar.Field(TEXT("StaticMeshPath"), StaticMeshPath) && Ar.IsLoading())
+    {
+        UStaticMesh* MeshToSet = nullptr;
+        if (StaticMeshPath != TEXT("None"))
+        {
+            MeshToSet = FObjManager::CreateStaticMesh(StaticMeshPath);
+            if (MeshToSet == nullptr)
+            {
+                UE_LOG(LogLevel::Warning, TEXT("Could not load StaticMesh '%s' for %s"), *StaticMeshPath, *GetName());
+            }
+        }
+        SetStaticMesh(MeshToSet);
+    }
+}
+
 uint32 UStaticMeshComponent::GetNumMaterials() const
 {
     if (StaticMesh == nullptr) return 0;
@@ -140,6 +173,34 @@ void UStaticMeshComponent::GetUsedMaterials(TArray<UMaterial*>& Out) const
     }
 }
 
+int32 UStaticMeshComponent::UpdateLOD(uint32 ViewportIndex, const FVector& ViewLocation, const FMatrix& Projection, bool bPerspective)
+{
+    int32& LODIndex = LODIndices[FMath::Min<uint32>(ViewportIndex, MaxLODViewports - 1)];
+    if (StaticMesh == nullptr || StaticMesh->GetRenderData() == nullptr)
+    {
+        LODIndex = 0;
+        return LODIndex;
+    }
+
+    const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+    if (RenderData->LODs.Num() == 0)
+    {
+        LODIndex = 0;
+        return LODIndex;
+    }
+
+    const FMatrix WorldMatrix = GetWorldMatrix();
+    const FVector Scale = WorldMatrix.GetScaleVector();
+    const float MaxScale = FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z)));
+
+    const FVector Center = WorldMatrix.TransformPosition((RenderData->BoundingBoxMin + RenderData->BoundingBoxMax) * 0.5f);
+    const float Radius = (RenderData->BoundingBoxMax - RenderData->BoundingBoxMin).Length() * 0.5f * MaxScale;
+
+    const float ScreenSize = FStaticMeshLOD::ComputeScreenSize(Center, Radius, ViewLocation, Projection, bPerspective);
+    LODIndex = FStaticMeshLOD::SelectLOD(*RenderData, ScreenSize, FMath::Min(LODIndex, RenderData->GetNumLODs() - 1));
+    return LODIndex;
+}
+
 int UStaticMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, const FVector& InRayDirection, float& OutHitDistance) const
 {
     if (!AABB.Intersect(InRayOrigin, InRayDirection, OutHitDistance))
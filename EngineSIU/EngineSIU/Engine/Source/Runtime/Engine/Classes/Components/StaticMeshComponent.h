@@ -15,6 +15,7 @@ public:
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SerializeFields(FFieldArchive& Ar) override;
 
 
 
@@ -40,8 +41,23 @@ public:
             OverrideMaterials.SetNum(value->GetMaterials().Num());
             AABB = FBoundingBox(StaticMesh->GetRenderData()->BoundingBoxMin, StaticMesh->GetRenderData()->BoundingBoxMax);
         }
+
+        for (int32& LODIndex : LODIndices)
+        {
+            LODIndex = 0;
+        }
     }
 
+    /** 이 뷰포트에서 그릴 LOD. 그림자 패스도 같은 값을 씁니다. */
+    int32 GetLODIndex(uint32 ViewportIndex) const { return LODIndices[FMath::Min<uint32>(ViewportIndex, MaxLODViewports - 1)]; }
+
+    /** 바운딩 구의 화면 크기로 이 뷰포트의 LOD를 다시 고릅니다. FMeshRenderPass::PrepareRenderArr에서 매 프레임 호출합니다. */
+    int32 UpdateLOD(uint32 ViewportIndex, const FVector& ViewLocation, const FMatrix& Projection, bool bPerspective);
+
 protected:
     UStaticMesh* StaticMesh = nullptr;
+
+    // 에디터의 뷰포트 수. 뷰포트마다 화면 크기가 달라서 LOD도 따로 기억해야 히스테리시스가 동작함
+    static constexpr uint32 MaxLODViewports = 4;
+    int32 LODIndices[MaxLODViewports] = {};
 };
@@ -1,4 +1,5 @@
 #include "TextComponent.h"
+#include "Serialization/FieldArchive.h"
 
 #include "ShowFlag.h"
 #include "World/World.h"
@@ -74,6 +75,22 @@ void UTextComponent::SetProperties(const TMap<FString, FString>& InProperties)
     
 }
 
+void UTextComponent::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+
+    FString TextString = Ar.IsSaving() ? FString(Text.c_str()) : FString();
+    if (Ar.Field(TEXT("Text"), TextString) && Ar.IsLoading())
+    {
+        Text = TextString.ToWideString();
+    }
+    Ar.Field(TEXT("RowCount"), RowCount);
+    Ar.Field(TEXT("ColumnCount"), ColumnCount);
+    Ar.Field(TEXT("QuadWidth"), QuadWidth);
+    Ar.Field(TEXT("QuadHeight"), QuadHeight);
+    Ar.Field(TEXT("QuadSize"), QuadSize);
+}
+
 void UTextComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -10,6 +10,8 @@
 #include "GameFramework/Character.h"
 #include "tinyfiledialogs/tinyfiledialogs.h"
 #include "UnrealEd/SceneManager.h"
+#include "UnrealEd/SceneAutoSave.h"
+#include "UnrealEd/SceneBinary.h"
 #include "Games/LastWar/Characters/PlayerCharacter.h"
 #include "Games/LastWar/Characters/EnemyCharacter.h"
 #include "Games/LastWar/Characters/Wall.h"
@@ -19,6 +21,8 @@
 
 #include "LevelEditor/SLevelEditor.h"
 #include "Rendering/Mesh/SkeletalMesh.h"
+#include "Stats/Stats.h"
+#include "WindowsPlatformTime.h"
 
 namespace PrivateEditorSelection
 {
@@ -57,6 +61,8 @@ void UEditorEngine::Init()
     FString ScenePath = FEditorConfigManager::GetValueFromConfig<std::string>(Config, "ScenePath", "Saved/DefaultLevel.scene");
 
     LoadLevel(ScenePath);
+
+    AutoSave = new FSceneAutoSave();
 }
 
 bool UEditorEngine::TryQuit(bool& OutbIsSave)
@@ -94,15 +100,86 @@ bool UEditorEngine::TryQuit(bool& OutbIsSave)
 
 void UEditorEngine::Release()
 {
+    FinishLevelStreaming(true);
+
+    // 정상 종료이므로 저널은 필요 없음
+    if (AutoSave)
+    {
+        AutoSave->Shutdown(true);
+        delete AutoSave;
+        AutoSave = nullptr;
+    }
 }
 
 void UEditorEngine::LoadLevel(const FString& FilePath) const
 {
-    SceneManager::LoadSceneFromJsonFile(GetData(FilePath), *ActiveWorld);
+    SceneManager::LoadSceneFromFile(GetData(FilePath), *ActiveWorld);
+}
+
+void UEditorEngine::StreamLevel(const FString& FilePath)
+{
+    FinishLevelStreaming(true);
+
+    const std::filesystem::path ScenePath(GetData(FilePath));
+    if (!SceneBinary::IsBinarySceneFile(ScenePath))
+    {
+        LoadLevel(FilePath);
+        return;
+    }
+
+    LevelStreamingLoad = new FSceneStreamingLoad();
+    if (!LevelStreamingLoad->Open(ScenePath, ActiveWorld))
+    {
+        FinishLevelStreaming(true);
+    }
+}
+
+bool UEditorEngine::RestoreAutoSave()
+{
+    if (AutoSave == nullptr || PIEWorld)
+    {
+        return false;
+    }
+
+    TArray<uint8> SceneData;
+    FString LevelPath;
+    if (!AutoSave->BuildRecoveryScene(SceneData, LevelPath))
+    {
+        return false;
+    }
+
+    NewLevel();
+
+    LevelStreamingLoad = new FSceneStreamingLoad();
+    if (!LevelStreamingLoad->OpenFromMemory(std::move(SceneData), EditorWorld))
+    {
+        FinishLevelStreaming(true);
+        return false;
+    }
+    EditorWorld->GetActiveLevel()->SetLevelPath(GetData(LevelPath));
+    return true;
+}
+
+void UEditorEngine::FinishLevelStreaming(bool bCancel)
+{
+    if (LevelStreamingLoad == nullptr)
+    {
+        return;
+    }
+
+    if (!bCancel)
+    {
+        LevelStreamingLoad->Tick(LevelStreamingLoad->GetNumActors(), 0.0);
+    }
+    delete LevelStreamingLoad;
+    LevelStreamingLoad = nullptr;
 }
 
-void UEditorEngine::SaveLevel(const FString& FilePath) const
+void UEditorEngine::SaveLevel(const FString& FilePath)
 {
+    // 스트리밍 도중에 저장하면 아직 불러오지 않은 액터가 빠진 채로 파일을 덮어씀
+    FinishLevelStreaming(false);
+
     FString ScenePath;
     if (FilePath.IsEmpty())
     {
@@ -112,7 +189,7 @@ void UEditorEngine::SaveLevel(const FString& FilePath) const
     {
         ScenePath = FilePath;
     }
-    SceneManager::SaveSceneToJsonFile(GetData(ScenePath), *ActiveWorld);
+    SceneManager::SaveSceneToFile(GetData(ScenePath), *ActiveWorld);
 }
 
 void UEditorEngine::SaveConfig() const
@@ -122,46 +199,30 @@ void UEditorEngine::SaveConfig() const
 }
 
 void UEditorEngine::Tick(float DeltaTime)
+{
+    if (LevelStreamingLoad && LevelStreamingLoad->Tick(LevelStreamingActorsPerFrame, LevelStreamingBudgetMs))
+    {
+        FinishLevelStreaming(false);
+    }
+
+    // 불러오는 도중의 Level은 기록하지 않음
+    if (AutoSave && LevelStreamingLoad == nullptr)
+    {
+        AutoSave->Tick(EditorWorld, DeltaTime);
+    }
+}
+
+void UEditorEngine::TickWorlds(float DeltaTime)
 {
     for (FWorldContext* WorldContext : WorldList)
     {
-        if (WorldContext->WorldType == EWorldType::Editor)
-        {
-            if (UWorld* World = WorldContext->World())
-            {
-                // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
-                World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
-            }
-        }
-        else if (WorldContext->WorldType == EWorldType::PIE)
+        // Actor / Component의 Tick은 각 World의 Tick Manager가 실행합니다.
+        // Editor World에서는 bTickInEditor인 Actor와 그 컴포넌트만 Tick 합니다.
+        if (WorldContext->WorldType == EWorldType::Editor || WorldContext->WorldType == EWorldType::PIE)
         {
             if (UWorld* World = WorldContext->World())
             {
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
             }
         }
     }
@@ -175,10 +236,19 @@ void UEditorEngine::StartPIE()
         return;
     }
 
+    QUICK_SCOPE_CYCLE_COUNTER(StartPIE)
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // 불러오던 레벨이 있으면 남은 액터를 모두 만든 뒤 복제
+    FinishLevelStreaming(false);
+
     FWorldContext& PIEWorldContext = CreateNewWorldContext(EWorldType::PIE);
 
+    const uint64 DuplicateStartCycles = FPlatformTime::Cycles64();
     PIEWorld = Cast<UWorld>(EditorWorld->Duplicate(this));
     PIEWorld->WorldType = EWorldType::PIE;
+    LastPIEStartStats.DuplicateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DuplicateStartCycles);
+    LastPIEStartStats.Duplication = FLevelDuplicator::GetLastStats();
 
     PIEWorldContext.SetCurrentWorld(PIEWorld);
     ActiveWorld = PIEWorld;
@@ -195,9 +265,17 @@ void UEditorEngine::StartPIE()
     // 3) 월드에 컨트롤러 등록
     //AudioManager::Get().PlayBgm(EAudioType::MainTheme);
 
+    const uint64 BeginPlayStartCycles = FPlatformTime::Cycles64();
     PIEWorld->BeginPlay();
+    LastPIEStartStats.BeginPlayMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BeginPlayStartCycles);
 
     OnStartPIE.Broadcast(PIEWorld);
+
+    LastPIEStartStats.TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    UE_LOG(
+        LogLevel::Display, "PIE started in %.2f ms (duplicate %.2f ms for %d actors, begin play %.2f ms)",
+        LastPIEStartStats.TotalMs, LastPIEStartStats.DuplicateMs, LastPIEStartStats.Duplication.NumActors, LastPIEStartStats.BeginPlayMs
+    );
     // 나중에 제거하기
 }
 
@@ -310,6 +388,7 @@ void UEditorEngine::NewLevel()
 {
     ClearActorSelection();
     ClearComponentSelection();
+    FinishLevelStreaming(true);
 
     if (ActiveWorld->GetActiveLevel())
     {
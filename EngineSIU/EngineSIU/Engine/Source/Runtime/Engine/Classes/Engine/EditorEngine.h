@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine.h"
 #include "Actors/Player.h"
+#include "World/LevelDuplicator.h"
 
 /*
     Editor 모드에서 사용될 엔진.
@@ -10,6 +11,18 @@
 
 class AActor;
 class USceneComponent;
+class FSceneStreamingLoad;
+class FSceneAutoSave;
+
+/** 마지막 PIE 진입에 걸린 시간 */
+struct FPIEStartStats
+{
+    double DuplicateMs = 0.0;       // EditorWorld 복제
+    double BeginPlayMs = 0.0;
+    double TotalMs = 0.0;
+
+    FLevelDuplicationStats Duplication;
+};
 
 DECLARE_MULTICAST_DELEGATE_OneParam(OnStartPIEDelegate, UWorld*)
 DECLARE_MULTICAST_DELEGATE_OneParam(OnEndPIEDelegate, UWorld*)
@@ -23,12 +36,28 @@ public:
 
     virtual void Init() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void TickWorlds(float DeltaTime) override;
     bool TryQuit(bool& OutbIsSave) override;
     void Release() override;
 
     void LoadLevel(const FString& FilePath) const;
-    // 현재 Level을 저장하는 경우 빈 FString을 넣으세요.
-    void SaveLevel(const FString& FilePath = FString("")) const;
+
+    /**
+     * 바이너리 씬은 Tick마다 조금씩 나눠 불러오고, Json 씬은 LoadLevel과 같이 한 번에 불러옵니다.
+     * 진행 중인 로드는 NewLevel이나 다른 StreamLevel 호출 시 취소됩니다.
+     */
+    void StreamLevel(const FString& FilePath);
+    bool IsStreamingLevel() const { return LevelStreamingLoad != nullptr; }
+
+    /**
+     * 자동 저장 저널에 남은 액터로 Level을 다시 만듭니다. 이전 세션의 복구 저널이 있으면 그것을 사용합니다.
+     * 불러오기는 StreamLevel과 같이 Tick마다 나눠 진행됩니다.
+     */
+    bool RestoreAutoSave();
+    FSceneAutoSave* GetAutoSave() const { return AutoSave; }
+
+    // 현재 Level을 저장하는 경우 빈 FString을 넣으세요. 불러오는 중인 Level은 남은 액터를 모두 불러온 뒤에 저장합니다.
+    void SaveLevel(const FString& FilePath = FString(""));
     void SaveConfig() const;
     
     UWorld* PIEWorld = nullptr;
@@ -37,6 +66,9 @@ public:
     void StartPIE();
     void EndPIE();
 
+    /** "piestats" 콘솔 명령으로 출력됩니다. */
+    const FPIEStartStats& GetLastPIEStartStats() const { return LastPIEStartStats; }
+
     void CreateSkeletalPreviewViewport(class USkeletalMesh* TargetSkeletalMesh);
 
     // 주석은 UE에서 사용하던 매개변수.
@@ -75,9 +107,23 @@ public:
 public:
     UEditorPlayer* GetEditorPlayer() const;
     
+private:
+    void FinishLevelStreaming(bool bCancel);
+
 private:
     UEditorPlayer* EditorPlayer = nullptr;
 
+    FSceneStreamingLoad* LevelStreamingLoad = nullptr;
+
+    // Editor World의 증분 자동 저장
+    FSceneAutoSave* AutoSave = nullptr;
+
+    FPIEStartStats LastPIEStartStats;
+
+    // 한 프레임에 레벨 스트리밍에 쓰는 최대 시간과 액터 수
+    static constexpr double LevelStreamingBudgetMs = 4.0;
+    static constexpr int32 LevelStreamingActorsPerFrame = 256;
+
 };
 
 
@@ -26,7 +26,11 @@ protected:
 
 public:
     virtual void Init();
+    /** 프레임마다 한 번 호출됩니다. 레벨 스트리밍, 자동 저장처럼 시뮬레이션 스텝과 상관없는 일을 합니다. */
     virtual void Tick(float DeltaTime) = 0;
+
+    /** 시뮬레이션 스텝마다 호출됩니다. 고정 스텝이면 한 프레임에 여러 번, 또는 한 번도 호출되지 않을 수 있습니다. */
+    virtual void TickWorlds(float DeltaTime) = 0;
     virtual void Release() = 0;
     virtual bool TryQuit(bool& OutbIsSave);
 
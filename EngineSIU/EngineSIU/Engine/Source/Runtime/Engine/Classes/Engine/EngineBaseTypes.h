@@ -0,0 +1,112 @@
+#pragma once
+#include "Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+class AActor;
+class UActorComponent;
+class FTickTaskManager;
+
+/** Tick 함수가 실행되는 단계. UWorld::Tick에서 위에서부터 순서대로 실행됩니다. */
+enum ETickingGroup : uint8
+{
+    /** Overlap 갱신 전. 기본값 */
+    TG_PrePhysics,
+    /** Overlap 갱신 후, Overlap 이벤트 처리 전 */
+    TG_DuringPhysics,
+    /** Overlap 이벤트와 Actor 제거 처리 후 */
+    TG_PostPhysics,
+    /** 카메라 갱신까지 끝난 뒤 */
+    TG_PostUpdateWork,
+
+    TG_MAX
+};
+
+/**
+ * World의 FTickTaskManager에 등록되어 매 프레임 실행되는 Tick 함수
+ *
+ * 같은 TickGroup 안에서는 Prerequisite가 먼저 실행됩니다.
+ * 다른 TickGroup의 Prerequisite는 Group 순서로만 보장되며, 더 늦은 Group에 있는 Prerequisite는 무시됩니다.
+ */
+struct FTickFunction
+{
+    friend class FTickTaskManager;
+
+public:
+    FTickFunction() = default;
+    virtual ~FTickFunction();
+
+    FTickFunction(const FTickFunction&) = delete;
+    FTickFunction& operator=(const FTickFunction&) = delete;
+    FTickFunction(FTickFunction&&) = delete;
+    FTickFunction& operator=(FTickFunction&&) = delete;
+
+    /** 실제 Tick 작업. bRunOnAnyThread면 Worker 스레드에서 호출될 수 있습니다. */
+    virtual void ExecuteTick(float DeltaTime) = 0;
+
+    /** Editor World에서도 Tick할지 여부 */
+    virtual bool CanTickInEditor() const { return false; }
+
+    /** bCanEverTick이 false면 등록하지 않습니다. 이미 등록되어 있으면 아무것도 하지 않습니다. */
+    void RegisterTickFunction(FTickTaskManager& InTickTaskManager);
+    void UnRegisterTickFunction();
+    bool IsTickFunctionRegistered() const { return TickTaskManager != nullptr; }
+
+    /** 등록 전에 호출하면 bStartWithTickEnabled를 바꿉니다. */
+    void SetTickFunctionEnable(bool bInEnabled);
+    bool IsTickFunctionEnabled() const { return bTickEnabled; }
+
+    /** 등록된 상태에서 바꾸면 다음 프레임부터 새 Group에서 실행됩니다. */
+    void SetTickGroup(ETickingGroup InTickGroup);
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    void AddPrerequisite(FTickFunction& Prerequisite);
+    void RemovePrerequisite(FTickFunction& Prerequisite);
+
+public:
+    /** false면 등록 자체를 하지 않습니다. Tick 작업이 있는 클래스만 생성자에서 켭니다. */
+    uint8 bCanEverTick : 1 = false;
+
+    uint8 bStartWithTickEnabled : 1 = true;
+
+    /**
+     * ExecuteTick이 자신의 대상 외에 공유 상태(World, Actor 목록, Lua 등)를 건드리지 않으면 true.
+     * 같은 단계의 다른 bRunOnAnyThread Tick과 병렬로 실행됩니다.
+     * Actor 제거처럼 World를 바꾸는 작업은 FTickTaskManager::EnqueueGameThreadTask로 넘겨야 합니다.
+     */
+    uint8 bRunOnAnyThread : 1 = false;
+
+    /** 0이면 매 프레임, 아니면 최소 이 간격(초)마다 실행. 실행될 때는 누적된 시간이 DeltaTime으로 전달됩니다. */
+    float TickInterval = 0.0f;
+
+private:
+    ETickingGroup TickGroup = TG_PrePhysics;
+    bool bTickEnabled = true;
+
+    FTickTaskManager* TickTaskManager = nullptr;
+    int32 RegisteredIndex = -1;         // FTickTaskManager의 Group 배열 안의 위치
+
+    float TimeSinceLastTick = 0.0f;
+
+    TArray<FTickFunction*> Prerequisites;
+    TArray<FTickFunction*> Dependents;  // 이 함수를 Prerequisite로 가진 함수들 (소멸 시 연결 해제용)
+
+    // FTickTaskManager가 실행 순서를 계산할 때 쓰는 임시 값
+    int32 SortIndex = -1;
+    int32 SortLevel = 0;
+};
+
+struct FActorTickFunction : public FTickFunction
+{
+    AActor* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+    virtual bool CanTickInEditor() const override;
+};
+
+struct FActorComponentTickFunction : public FTickFunction
+{
+    UActorComponent* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+    virtual bool CanTickInEditor() const override;
+};
@@ -0,0 +1,116 @@
+#include "LuaScriptBenchmark.h"
+
+#include "LuaScriptManager.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "WindowsPlatformTime.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    // Tick과 TickBatch가 같은 일을 하는 벤치마크용 스크립트
+    constexpr const char* BenchmarkScript = R"(
+        local M = {}
+
+        function M:Tick(DeltaTime)
+            self.Value = self.Value + DeltaTime
+        end
+
+        function M.TickBatch(Instances, DeltaTime)
+            for i = 1, #Instances do
+                local Self = Instances[i]
+                Self.Value = Self.Value + DeltaTime
+            end
+        end
+
+        return M
+    )";
+
+    template <typename FuncType>
+    double MeasureMedianFrameMs(int32 NumFrames, const FuncType& Frame)
+    {
+        TArray<double> Samples;
+        for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Frame();
+            Samples.Add(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+        }
+        Samples.Sort();
+        return Samples.Num() > 0 ? Samples[Samples.Num() / 2] : 0.0;
+    }
+}
+
+FLuaTickBenchmarkResult FLuaScriptBenchmark::RunTickBenchmark(int32 NumInstances, int32 NumFrames)
+{
+    FLuaTickBenchmarkResult Result;
+    Result.NumInstances = NumInstances;
+
+    sol::state& Lua = FLuaScriptManager::Get().GetLua();
+
+    sol::protected_function_result LoadResult = Lua.safe_script(BenchmarkScript, sol::script_pass_on_error);
+    if (!LoadResult.valid())
+    {
+        sol::error err = LoadResult;
+        UE_LOG(LogLevel::Error, TEXT("Lua Error: %s"), *FString(err.what()));
+        return Result;
+    }
+    sol::table ScriptClass = LoadResult.get<sol::table>();
+
+    // CreateLuaTable과 같은 방식으로 인스턴스 Table을 만듦
+    TArray<sol::table> Instances;
+    TArray<sol::protected_function> CachedTicks;
+    sol::table BatchInstances = Lua.create_table(NumInstances, 0);
+    for (int32 Index = 0; Index < NumInstances; ++Index)
+    {
+        sol::table Instance = Lua.create_table();
+        for (auto& Pair : ScriptClass)
+        {
+            Instance.set(Pair.first, Pair.second);
+        }
+        Instance["Value"] = 0.0f;
+
+        Instances.Add(Instance);
+        CachedTicks.Add(Instance.get<sol::protected_function>("Tick"));
+        BatchInstances[Index + 1] = Instance;
+    }
+
+    constexpr float DeltaTime = 1.0f / 60.0f;
+
+    // 기존 ULuaScriptComponent::TickComponent와 같은 경로
+    const FString TickName = TEXT("Tick");
+    Result.LookupMs = MeasureMedianFrameMs(NumFrames, [&]()
+    {
+        for (sol::table& Instance : Instances)
+        {
+            if (Instance.valid() && Instance[*TickName].valid())
+            {
+                auto CallResult = Instance[*TickName](Instance, DeltaTime);
+                if (!CallResult.valid())
+                {
+                    return;
+                }
+            }
+        }
+    });
+
+    Result.CachedMs = MeasureMedianFrameMs(NumFrames, [&]()
+    {
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            sol::protected_function_result CallResult = CachedTicks[Index](Instances[Index], DeltaTime);
+            if (!CallResult.valid())
+            {
+                return;
+            }
+        }
+    });
+
+    const sol::protected_function TickBatch = ScriptClass.get<sol::protected_function>("TickBatch");
+    Result.BatchedMs = MeasureMedianFrameMs(NumFrames, [&]()
+    {
+        TickBatch(BatchInstances, DeltaTime);
+    });
+
+    return Result;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+struct FLuaTickBenchmarkResult
+{
+    int32 NumInstances = 0;
+    double LookupMs = 0.0;          // 기존 방식: 매 프레임 이름으로 Table 조회 후 호출 (프레임당 중앙값)
+    double CachedMs = 0.0;          // 로드 때 캐시한 protected_function으로 인스턴스마다 호출
+    double BatchedMs = 0.0;         // TickBatch 한 번에 모든 인스턴스 전달
+};
+
+/**
+ * Lua 스크립트 Tick 호출 방식별 프레임당 비용을 비교합니다. 콘솔의 "lua bench"에서 호출합니다.
+ * 같은 Tick 내용을 가진 스크립트 인스턴스를 NumInstances개 만들어서, World 없이 Lua 호출 비용만 잽니다.
+ */
+struct FLuaScriptBenchmark
+{
+    static FLuaTickBenchmarkResult RunTickBenchmark(int32 NumInstances, int32 NumFrames);
+};
@@ -5,12 +5,34 @@
 #include "Engine/Lua/LuaTypes/LuaUserTypes.h"
 #include "Components/LuaScriptComponent.h"
 #include "GameFramework/Actor.h"
+#include "World/World.h"
 
 TMap<FString, FLuaTableScriptInfo> FLuaScriptManager::ScriptCacheMap;
-TSet<ULuaScriptComponent*> FLuaScriptManager::ActiveLuaComponents;
+TMap<FString, TSet<ULuaScriptComponent*>> FLuaScriptManager::ActiveLuaComponents;
+FFileWatcher FLuaScriptManager::ScriptWatcher;
+TArray<FLuaScriptTickBatch*> FLuaScriptManager::TickBatches;
+
+namespace
+{
+    // Lua VM의 모든 할당을 Lua 태그로 집계하는 lua_Alloc
+    void* LuaAllocate(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+    {
+        if (NewSize == 0)
+        {
+            FPlatformMemory::Free<EAT_Global>(Ptr, OldSize);
+            return nullptr;
+        }
+
+        MEMORY_TAG_SCOPE(Lua);
+        return FPlatformMemory::Realloc<EAT_Global>(Ptr, NewSize);
+    }
+}
 
 FLuaScriptManager::FLuaScriptManager()
+    : LuaState(sol::default_at_panic, &LuaAllocate)
 {
+    MEMORY_TAG_SCOPE(Lua);
+
     LuaState.open_libraries(
         sol::lib::base,       // Lua를 사용하기 위한 기본 라이브러리 (print, type, pcall 등)
         // sol::lib::package,    // 모듈 로딩(require) 및 패키지 관리 기능
@@ -58,6 +80,8 @@ sol::state& FLuaScriptManager::GetLua()
 
 sol::table FLuaScriptManager::CreateLuaTable(const FString& ScriptName)
 {   
+    MEMORY_TAG_SCOPE(Lua);
+
     if (!std::filesystem::exists(*ScriptName))
     {
         UE_LOG(LogLevel::Error, TEXT("InValid Lua File name."));
@@ -84,8 +108,10 @@ sol::table FLuaScriptManager::CreateLuaTable(const FString& ScriptName)
         
         FLuaTableScriptInfo NewInfo;
         NewInfo.ScriptTable = ReturnValue.as<sol::table>();
-        NewInfo.LastWriteTime = std::filesystem::last_write_time(ScriptName.ToWideString());
         ScriptCacheMap.Add(ScriptName, NewInfo);
+
+        // 리로드 때 다시 들어와도 이미 감시 중이면 무시됨
+        ScriptWatcher.AddFile(ScriptName);
     }
 
     //return ScriptCacheMap[ScriptName];
@@ -103,44 +129,143 @@ sol::table FLuaScriptManager::CreateLuaTable(const FString& ScriptName)
 
 void FLuaScriptManager::RegisterActiveLuaComponent(ULuaScriptComponent* LuaComponent)
 {
-    ActiveLuaComponents.Add(LuaComponent);
+    const FString ScriptName = LuaComponent->GetScriptName();
+    if (ScriptName.IsEmpty())
+    {
+        return;
+    }
+    ActiveLuaComponents.FindOrAdd(ScriptName).Add(LuaComponent);
 }
 
 void FLuaScriptManager::UnRigisterActiveLuaComponent(ULuaScriptComponent* LuaComponent)
 {
-    if (ActiveLuaComponents.Contains(LuaComponent))
-        ActiveLuaComponents.Remove(LuaComponent);
+    if (TSet<ULuaScriptComponent*>* Components = ActiveLuaComponents.Find(LuaComponent->GetScriptName()))
+    {
+        Components->Remove(LuaComponent);
+        if (Components->IsEmpty())
+        {
+            ActiveLuaComponents.Remove(LuaComponent->GetScriptName());
+        }
+    }
 }
 
 void FLuaScriptManager::HotReloadLuaScript()
 {
-    TSet<FString> ChangedScriptName;
-    TMap<FString, FLuaTableScriptInfo> CopiedScriptCacheMap = ScriptCacheMap;
-    for (const TMap<FString, FLuaTableScriptInfo>::PairType& ScriptCached : CopiedScriptCacheMap)
+    TArray<FString> ChangedScripts;
+    ScriptWatcher.DrainChanges(ChangedScripts);
+
+    for (const FString& ChangedScript : ChangedScripts)
     {
-        FString ScriptName = ScriptCached.Key;
-        FLuaTableScriptInfo LuaScriptInfo = ScriptCached.Value;
-        auto depTime = std::filesystem::last_write_time(GetData(ScriptName));
-        if (LuaScriptInfo.LastWriteTime != depTime)
+        ScriptCacheMap.Remove(ChangedScript);
+
+        const TSet<ULuaScriptComponent*>* Components = ActiveLuaComponents.Find(ChangedScript);
+        if (!Components)
         {
-            if (ScriptCacheMap.Contains(ScriptName))
-            {
-                ScriptCacheMap.Remove(ScriptName);
-            }
+            continue;
+        }
 
-            ChangedScriptName.Add(ScriptName);
+        // BindSelfLuaProperties 안에서 등록이 바뀔 수 있으므로 복사해서 순회
+        const TArray<ULuaScriptComponent*> ComponentsToReload = Components->Array();
+        for (const ULuaScriptComponent* LuaComponent : ComponentsToReload)
+        {
+            LuaComponent->GetOwner()->BindSelfLuaProperties();
         }
+        UE_LOG(LogLevel::Display, TEXT("Lua Script Reloaded: %s (%d components)"), *ChangedScript, ComponentsToReload.Num());
+    }
+}
+
+void FLuaScriptManager::AddToTickBatch(ULuaScriptComponent* LuaComponent, const sol::protected_function& TickBatchFunction)
+{
+    UWorld* World = LuaComponent->GetWorld();
+    if (!World)
+    {
+        return;
     }
 
-    for (const FString& ChangedScript : ChangedScriptName)
+    FTickTaskManager* TickTaskManager = &World->GetTickTaskManager();
+    const FString& ScriptName = LuaComponent->GetScriptName();
+
+    FLuaScriptTickBatch* Batch = nullptr;
+    for (FLuaScriptTickBatch* Existing : TickBatches)
     {
-        for (const ULuaScriptComponent* LuaComponent : ActiveLuaComponents)
+        if (Existing->TickTaskManager == TickTaskManager && Existing->ScriptName == ScriptName)
         {
-            if (LuaComponent->GetScriptName() == ChangedScript)
-            {
-                LuaComponent->GetOwner()->BindSelfLuaProperties();
-                UE_LOG(LogLevel::Display, TEXT("Lua Script Reloaded: %s"), *ChangedScript);
-            } 
+            Batch = Existing;
+            break;
         }
     }
+
+    if (!Batch)
+    {
+        Batch = new FLuaScriptTickBatch;
+        Batch->ScriptName = ScriptName;
+        Batch->TickTaskManager = TickTaskManager;
+        Batch->Instances = LuaState.create_table();
+        Batch->TickFunction.Batch = Batch;
+        Batch->TickFunction.bCanEverTick = true;
+        Batch->TickFunction.RegisterTickFunction(*TickTaskManager);
+        TickBatches.Add(Batch);
+    }
+
+    // 리로드된 스크립트로 들어오면 함수도 새 것으로 바뀜
+    Batch->TickBatchFunction = TickBatchFunction;
+    Batch->Components.Add(LuaComponent);
+    Batch->Instances[Batch->Components.Num()] = LuaComponent->GetLuaSelfTable();
+}
+
+void FLuaScriptManager::RemoveFromTickBatch(ULuaScriptComponent* LuaComponent)
+{
+    for (int32 BatchIndex = 0; BatchIndex < TickBatches.Num(); ++BatchIndex)
+    {
+        FLuaScriptTickBatch* Batch = TickBatches[BatchIndex];
+
+        const int32 Index = Batch->Components.Find(LuaComponent);
+        if (Index == INDEX_NONE)
+        {
+            continue;
+        }
+
+        // 마지막 원소를 빈자리로 옮겨서 Lua 배열에 구멍이 생기지 않게 함
+        const int32 LastIndex = Batch->Components.Num() - 1;
+        Batch->Components[Index] = Batch->Components[LastIndex];
+        Batch->Instances[Index + 1] = Batch->Components[Index]->GetLuaSelfTable();
+        Batch->Instances[LastIndex + 1] = sol::lua_nil;
+        Batch->Components.RemoveAt(LastIndex);
+
+        if (Batch->Components.IsEmpty())
+        {
+            Batch->TickFunction.UnRegisterTickFunction();
+            TickBatches.RemoveAt(BatchIndex);
+            delete Batch;
+        }
+        return;
+    }
+}
+
+void FLuaTickBatchFunction::ExecuteTick(float DeltaTime)
+{
+    if (!Batch || !Batch->TickBatchFunction.valid())
+    {
+        return;
+    }
+
+    sol::protected_function_result Result = Batch->TickBatchFunction(Batch->Instances, DeltaTime);
+    if (!Result.valid())
+    {
+        sol::error err = Result;
+        UE_LOG(LogLevel::Error, TEXT("Lua Error: %s"), *FString(err.what()));
+    }
+}
+
+void FLuaScriptManager::Release()
+{
+    // Tick 함수가 TickTaskManager에 남아 있으면 해제된 Batch를 가리키게 되므로 먼저 등록 해제
+    for (FLuaScriptTickBatch* Batch : TickBatches)
+    {
+        Batch->TickFunction.UnRegisterTickFunction();
+        delete Batch;
+    }
+    TickBatches.Empty();
+
+    ScriptWatcher.Shutdown();
 }
@@ -1,18 +1,44 @@
 #pragma once
 
+#include "Container/Array.h"
 #include "Container/Set.h"
 #include "Container/Map.h"
 #include "Container/String.h"
 #include "sol/sol.hpp"
-
-#include <filesystem>
+#include "WindowsFileWatcher.h"
+#include "Engine/EngineBaseTypes.h"
 
 class ULuaScriptComponent;
+class FTickTaskManager;
+struct FLuaScriptTickBatch;
 
 struct FLuaTableScriptInfo
 {
     sol::table ScriptTable;
-    std::filesystem::file_time_type LastWriteTime;
+};
+
+/** 같은 스크립트를 쓰는 컴포넌트들을 한 번의 TickBatch 호출로 Tick하는 Tick 함수 */
+struct FLuaTickBatchFunction : public FTickFunction
+{
+    FLuaScriptTickBatch* Batch = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+};
+
+/**
+ * World(TickTaskManager) 하나에서 같은 스크립트의 TickBatch를 쓰는 컴포넌트 묶음.
+ * Instances는 Lua 배열이고, i번째 원소는 Components[i - 1]의 Self Table입니다.
+ */
+struct FLuaScriptTickBatch
+{
+    FString ScriptName;
+    FTickTaskManager* TickTaskManager = nullptr;
+
+    TArray<ULuaScriptComponent*> Components;
+    sol::table Instances;
+    sol::protected_function TickBatchFunction;
+
+    FLuaTickBatchFunction TickFunction;
 };
 
 class FLuaScriptManager
@@ -21,7 +47,14 @@ class FLuaScriptManager
 private:
     sol::state LuaState;
     static TMap<FString, FLuaTableScriptInfo> ScriptCacheMap;
-    static TSet<ULuaScriptComponent*> ActiveLuaComponents;
+
+    // 스크립트 경로 → 그 스크립트를 쓰는 컴포넌트. 리로드할 때 바뀐 스크립트의 사용자만 찾기 위한 역색인
+    static TMap<FString, TSet<ULuaScriptComponent*>> ActiveLuaComponents;
+
+    // 캐시된 스크립트 파일의 변경 감시. 매 프레임 파일 시스템을 확인하지 않기 위해 사용
+    static FFileWatcher ScriptWatcher;
+
+    static TArray<FLuaScriptTickBatch*> TickBatches;
 
 public:
     FLuaScriptManager();
@@ -36,10 +69,21 @@ public:
     sol::state& GetLua();
     sol::table CreateLuaTable(const FString& ScriptName);
 
+    /** LuaComponent의 현재 ScriptName으로 등록합니다. ScriptName이 비어 있으면 무시합니다. */
     void RegisterActiveLuaComponent(ULuaScriptComponent* LuaComponent);
     void UnRigisterActiveLuaComponent(ULuaScriptComponent* LuaComponent);
 
+    /** 감시 스레드가 알려준 변경 스크립트만 다시 로드합니다. 변경이 없으면 큐 확인만 하고 끝납니다. */
     void HotReloadLuaScript();
 
+    /**
+     * 스크립트가 TickBatch(Instances, DeltaTime)를 정의했을 때, 컴포넌트를 개별 Tick 대신 스크립트 단위 묶음 Tick에 넣습니다.
+     * 같은 World에서 같은 스크립트를 쓰는 컴포넌트는 프레임마다 Lua 호출 한 번으로 함께 Tick됩니다.
+     */
+    void AddToTickBatch(ULuaScriptComponent* LuaComponent, const sol::protected_function& TickBatchFunction);
+    void RemoveFromTickBatch(ULuaScriptComponent* LuaComponent);
+
+    void Release();
+
 };
 
@@ -2,11 +2,25 @@
 
 #include "UObject/ObjectFactory.h"
 #include "Rendering/Material/Material.h"
+#include "Rendering/Mesh/MeshOptimizer.h"
 #include "Rendering/Mesh/StaticMesh.h"
+#include "Rendering/Mesh/MeshCluster.h"
+#include "Rendering/Mesh/StaticMeshLOD.h"
+#include "Rendering/Mesh/StaticMeshVertexPacking.h"
 
 #include <fstream>
 #include <sstream>
 
+namespace
+{
+    // .bin 캐시 헤더. 정점 형식이나 임포트 결과가 바뀌면 Version을 올림
+    // 2: FMeshOptimizer로 정렬한 인덱스 / 정점 순서
+    // 3: FStaticMeshLOD로 만든 LOD1 이상의 인덱스 / 서브셋
+    // 4: FMeshCluster로 나눈 LOD0 클러스터와 클러스터 순서의 인덱스
+    constexpr uint32 StaticMeshBinaryMagic = 0x4853454D; // "MESH"
+    constexpr uint32 StaticMeshBinaryVersion = 4;
+}
+
 bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
     std::ifstream OBJ(ObjFilePath.ToWideString());
@@ -341,7 +355,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
     return true;
 }
 
-bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderData& OutStaticMesh)
+bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderData& OutStaticMesh, bool bOptimizeMesh)
 {
     OutStaticMesh.ObjectName = RawData.ObjectName;
     // OutStaticMesh.PathName = RawData.PathName;
@@ -418,6 +432,12 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
         CalculateTangent(Vertex2, Vertex0, Vertex1);
     }
 
+    // 탄젠트는 삼각형 순서에 따라 달라지므로 다 구한 뒤에 순서를 바꿈
+    if (bOptimizeMesh)
+    {
+        FMeshOptimizer::OptimizeMesh(OutStaticMesh.Vertices, OutStaticMesh.Indices, OutStaticMesh.MaterialSubsets);
+    }
+
     // Calculate StaticMesh BoundingBox
     ComputeBoundingBox(OutStaticMesh.Vertices, OutStaticMesh.BoundingBoxMin, OutStaticMesh.BoundingBoxMax);
 
@@ -426,6 +446,8 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
 
 bool FObjLoader::CreateTextureFromFile(const FWString& Filename)
 {
+    MEMORY_TAG_SCOPE(Texture);
+
     if (FEngineLoop::ResourceManager.GetTexture(Filename))
     {
         return true;
@@ -511,6 +533,8 @@ void FObjLoader::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticM
 
 FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
+    MEMORY_TAG_SCOPE(StaticMesh);
+
     FStaticMeshRenderData* NewStaticMesh = new FStaticMeshRenderData();
 
     if ( const auto It = ObjStaticMeshMap.Find(PathFileName))
@@ -518,6 +542,10 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
         return *It;
     }
 
+    // 기즈모 같은 에디터 메시는 다른 패스에서 Float stride로 그리므로 압축하지 않음
+    const bool bEditorMesh = PathFileName.Find(TEXT("Assets/")) == 0;
+    NewStaticMesh->VertexFormat = bEditorMesh ? EStaticMeshVertexFormat::Float : ContentVertexFormat;
+
     FWString BinaryPath = (PathFileName + ".bin").ToWideString();
     if (std::ifstream(BinaryPath).good())
     {
@@ -564,6 +592,15 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
         return nullptr;
     }
 
+    // 에디터 메시는 LOD 선택을 하는 패스에서 그리지 않음
+    if (!bEditorMesh)
+    {
+        FStaticMeshLOD::BuildLODs(*NewStaticMesh);
+
+        // LOD0의 삼각형 순서를 바꾸므로 LOD를 만든 뒤에 나눔
+        FMeshCluster::BuildClusters(*NewStaticMesh);
+    }
+
     SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); 
     ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
     return NewStaticMesh;
@@ -594,6 +631,12 @@ bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStatic
         return false;
     }
 
+    // Header
+    const uint32 VertexFormat = static_cast<uint32>(StaticMesh.VertexFormat);
+    File.write(reinterpret_cast<const char*>(&StaticMeshBinaryMagic), sizeof(StaticMeshBinaryMagic));
+    File.write(reinterpret_cast<const char*>(&StaticMeshBinaryVersion), sizeof(StaticMeshBinaryVersion));
+    File.write(reinterpret_cast<const char*>(&VertexFormat), sizeof(VertexFormat));
+
     // Object Name
     Serializer::WriteFWString(File, StaticMesh.ObjectName);
 
@@ -603,7 +646,16 @@ bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStatic
     // Vertices
     uint32 VertexCount = StaticMesh.Vertices.Num();
     File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+    if (StaticMesh.VertexFormat == EStaticMeshVertexFormat::Packed)
+    {
+        TArray<FPackedStaticMeshVertex> PackedVertices;
+        FStaticMeshVertexPacking::PackVertices(StaticMesh, PackedVertices);
+        File.write(reinterpret_cast<const char*>(PackedVertices.GetData()), VertexCount * sizeof(FPackedStaticMeshVertex));
+    }
+    else
+    {
+        File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+    }
 
     // Indices
     uint32 IndexCount = StaticMesh.Indices.Num();
@@ -661,6 +713,32 @@ bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStatic
     File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
     File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
 
+    // LODs. 서브셋의 이름과 MaterialIndex는 LOD0와 같으므로 범위만 저장
+    uint32 LODCount = StaticMesh.LODs.Num();
+    File.write(reinterpret_cast<const char*>(&LODCount), sizeof(LODCount));
+    for (const FStaticMeshLODResource& LOD : StaticMesh.LODs)
+    {
+        File.write(reinterpret_cast<const char*>(&LOD.ScreenSize), sizeof(LOD.ScreenSize));
+        File.write(reinterpret_cast<const char*>(&LOD.Error), sizeof(LOD.Error));
+
+        uint32 LODIndexCount = LOD.Indices.Num();
+        File.write(reinterpret_cast<const char*>(&LODIndexCount), sizeof(LODIndexCount));
+        File.write(reinterpret_cast<const char*>(LOD.Indices.GetData()), LODIndexCount * sizeof(UINT));
+
+        uint32 LODSubsetCount = LOD.MaterialSubsets.Num();
+        File.write(reinterpret_cast<const char*>(&LODSubsetCount), sizeof(LODSubsetCount));
+        for (const FMaterialSubset& Subset : LOD.MaterialSubsets)
+        {
+            File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+        }
+    }
+
+    // Clusters
+    uint32 ClusterCount = StaticMesh.Clusters.Num();
+    File.write(reinterpret_cast<const char*>(&ClusterCount), sizeof(ClusterCount));
+    File.write(reinterpret_cast<const char*>(StaticMesh.Clusters.GetData()), ClusterCount * sizeof(FStaticMeshCluster));
+
     File.close();
     return true;
 }
@@ -674,6 +752,18 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
         return false;
     }
 
+    // Header. 예전 캐시이거나 형식이 다르면 OBJ에서 다시 만듦
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    uint32 VertexFormat = 0;
+    File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic));
+    File.read(reinterpret_cast<char*>(&Version), sizeof(Version));
+    File.read(reinterpret_cast<char*>(&VertexFormat), sizeof(VertexFormat));
+    if (!File || Magic != StaticMeshBinaryMagic || Version != StaticMeshBinaryVersion || VertexFormat != static_cast<uint32>(OutStaticMesh.VertexFormat))
+    {
+        return false;
+    }
+
     TArray<FWString> Textures;
 
     // Object Name
@@ -688,8 +778,18 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
     // Vertices
     uint32 VertexCount = 0;
     File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
-    OutStaticMesh.Vertices.SetNum(VertexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+    TArray<FPackedStaticMeshVertex> PackedVertices;
+    if (OutStaticMesh.VertexFormat == EStaticMeshVertexFormat::Packed)
+    {
+        // 바운드와 서브셋을 읽은 뒤에 풂
+        PackedVertices.SetNum(VertexCount);
+        File.read(reinterpret_cast<char*>(PackedVertices.GetData()), VertexCount * sizeof(FPackedStaticMeshVertex));
+    }
+    else
+    {
+        OutStaticMesh.Vertices.SetNum(VertexCount);
+        File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+    }
 
     // Indices
     uint32 IndexCount = 0;
@@ -772,8 +872,106 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
 
+    // LODs. 개수와 범위를 SetNum 전에 확인
+    uint32 LODCount = 0;
+    File.read(reinterpret_cast<char*>(&LODCount), sizeof(LODCount));
+    if (!File || LODCount >= static_cast<uint32>(FStaticMeshLOD::MaxLODCount))
+    {
+        File.setstate(std::ios::failbit);
+        LODCount = 0;
+    }
+    OutStaticMesh.LODs.SetNum(LODCount);
+    for (FStaticMeshLODResource& LOD : OutStaticMesh.LODs)
+    {
+        File.read(reinterpret_cast<char*>(&LOD.ScreenSize), sizeof(LOD.ScreenSize));
+        File.read(reinterpret_cast<char*>(&LOD.Error), sizeof(LOD.Error));
+
+        // LOD는 LOD0보다 삼각형이 많을 수 없음
+        uint32 LODIndexCount = 0;
+        File.read(reinterpret_cast<char*>(&LODIndexCount), sizeof(LODIndexCount));
+        if (!File || LODIndexCount > IndexCount || LODIndexCount % 3 != 0)
+        {
+            File.setstate(std::ios::failbit);
+            break;
+        }
+        LOD.Indices.SetNum(LODIndexCount);
+        File.read(reinterpret_cast<char*>(LOD.Indices.GetData()), LODIndexCount * sizeof(UINT));
+        for (const UINT Index : LOD.Indices)
+        {
+            if (Index >= VertexCount)
+            {
+                File.setstate(std::ios::failbit);
+                break;
+            }
+        }
+
+        uint32 LODSubsetCount = 0;
+        File.read(reinterpret_cast<char*>(&LODSubsetCount), sizeof(LODSubsetCount));
+        if (!File || LODSubsetCount != SubsetCount)
+        {
+            File.setstate(std::ios::failbit);
+            break;
+        }
+
+        LOD.MaterialSubsets = OutStaticMesh.MaterialSubsets;
+        for (FMaterialSubset& Subset : LOD.MaterialSubsets)
+        {
+            File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+            if (static_cast<uint64>(Subset.IndexStart) + Subset.IndexCount > static_cast<uint64>(LOD.Indices.Num()))
+            {
+                File.setstate(std::ios::failbit);
+                break;
+            }
+        }
+        if (!File)
+        {
+            break;
+        }
+    }
+
+    // Clusters
+    uint32 ClusterCount = 0;
+    if (File)
+    {
+        File.read(reinterpret_cast<char*>(&ClusterCount), sizeof(ClusterCount));
+    }
+    if (File && static_cast<uint64>(ClusterCount) * 3 <= static_cast<uint64>(OutStaticMesh.Indices.Num()))
+    {
+        OutStaticMesh.Clusters.SetNum(ClusterCount);
+        File.read(reinterpret_cast<char*>(OutStaticMesh.Clusters.GetData()), ClusterCount * sizeof(FStaticMeshCluster));
+
+        const uint32 NumClusterSubsets = FMath::Max(SubsetCount, 1u);
+        for (const FStaticMeshCluster& Cluster : OutStaticMesh.Clusters)
+        {
+            if (Cluster.SubsetIndex >= NumClusterSubsets || static_cast<uint64>(Cluster.IndexStart) + Cluster.IndexCount > static_cast<uint64>(OutStaticMesh.Indices.Num()))
+            {
+                File.setstate(std::ios::failbit);
+                break;
+            }
+        }
+    }
+    else
+    {
+        File.setstate(std::ios::failbit);
+    }
+
+    // 캐시가 깨져 있으면 읽은 것을 버리고 OBJ에서 다시 임포트
+    if (!File)
+    {
+        const EStaticMeshVertexFormat Format = OutStaticMesh.VertexFormat;
+        OutStaticMesh = FStaticMeshRenderData();
+        OutStaticMesh.VertexFormat = Format;
+        return false;
+    }
+
     File.close();
 
+    if (OutStaticMesh.VertexFormat == EStaticMeshVertexFormat::Packed)
+    {
+        FStaticMeshVertexPacking::UnpackVertices(PackedVertices, OutStaticMesh);
+    }
+
     // Texture Load
     if (Textures.Num() > 0)
     {
@@ -792,6 +990,8 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
 
 UStaticMesh* FObjManager::CreateStaticMesh(const FString& filePath)
 {
+    MEMORY_TAG_SCOPE(StaticMesh);
+
     FStaticMeshRenderData* StaticMeshRenderData = FObjManager::LoadObjStaticMeshAsset(filePath);
 
     if (StaticMeshRenderData == nullptr) return nullptr;
@@ -18,7 +18,8 @@ struct FObjLoader
     static bool ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutFStaticMesh);
 
     // Convert the Raw data to Cooked data (FStaticMeshRenderData)
-    static bool ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderData& OutStaticMesh);
+    // bOptimizeMesh: 서브셋마다 FMeshOptimizer로 삼각형 / 정점 순서를 정렬
+    static bool ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderData& OutStaticMesh, bool bOptimizeMesh = true);
 
     static bool CreateTextureFromFile(const FWString& Filename);
 
@@ -35,8 +36,10 @@ public:
 
     static void CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh);
 
+    /** StaticMesh.VertexFormat 형식으로 정점을 저장합니다. */
     static bool SaveStaticMeshToBinary(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh);
 
+    /** 헤더가 다르거나 저장된 정점 형식이 OutStaticMesh.VertexFormat과 다르면 false를 반환하고 OutStaticMesh를 건드리지 않습니다. */
     static bool LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh);
 
     static UStaticMesh* CreateStaticMesh(const FString& filePath);
@@ -47,7 +50,15 @@ public:
 
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
+    /**
+     * 이후에 로드하는 메시의 정점 형식. 이미 로드된 메시는 바뀌지 않습니다.
+     * 에디터 메시(Assets/)는 항상 Float입니다.
+     */
+    static EStaticMeshVertexFormat GetContentVertexFormat() { return ContentVertexFormat; }
+    static void SetContentVertexFormat(EStaticMeshVertexFormat InVertexFormat) { ContentVertexFormat = InVertexFormat; }
+
 private:
     inline static TMap<FString, FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
+    inline static EStaticMeshVertexFormat ContentVertexFormat = EStaticMeshVertexFormat::Float;
 };
@@ -7,6 +7,7 @@
 #include "UObject/ObjectFactory.h"
 #include "UserInterface/Console.h"
 
+#include "Rendering/Mesh/MeshOptimizer.h"
 #include "Rendering/Mesh/SkeletalMesh.h"
 #include "Engine/AssetManager.h"
 #include "Math/Quat.h"
@@ -21,6 +22,8 @@ FFBXManager* GFBXManager = nullptr;
 
 USkeletalMesh* FFBXManager::LoadFbx(const FString& FbxFilePath)
 {
+    MEMORY_TAG_SCOPE(SkeletalMesh);
+
     // SkeletalMesh가 이미 로드되어 있는지 확인
     if (SkeletalMeshMap.Contains(FbxFilePath))
     {
@@ -61,6 +64,8 @@ USkeletalMesh* FFBXManager::LoadFbx(const FString& FbxFilePath)
 
 TArray<USkeletalMesh*> FFBXManager::LoadFbxAll(const FString& FbxFilePath)
 {
+    MEMORY_TAG_SCOPE(SkeletalMesh);
+
     TArray<USkeletalMesh*> SkeletalMeshes;
     LoadAllMeshesFromFbx(FbxFilePath, SkeletalMeshes);
 
@@ -162,13 +167,16 @@ void FFBXManager::ExtractSkeletalMeshData(FbxNode* node, FSkeletalMeshRenderData
     
     // Global Bind Pose를 기반으로 Local Bind Pose를 생성합니다.
     CreateLocalbindPose(outData);
-    
-    outData.OrigineVertices          = outData.Vertices;
-    outData.OrigineReferencePose     = outData.ReferencePose;
 
     // 머터리얼 정보를 추출합니다. 
     ExtractMaterial(outData, mesh, polyCount);
 
+    // 서브셋이 정해진 뒤에 삼각형 / 정점 순서를 정렬합니다. 원본 정점도 같은 순서여야 하므로 복사보다 먼저 합니다.
+    FMeshOptimizer::OptimizeMesh(outData.Vertices, outData.Indices, outData.MaterialSubsets, offsetof(FSkeletalMeshVertex, Position));
+
+    outData.OrigineVertices          = outData.Vertices;
+    outData.OrigineReferencePose     = outData.ReferencePose;
+
     outData.ComputeBounds();
 }
 
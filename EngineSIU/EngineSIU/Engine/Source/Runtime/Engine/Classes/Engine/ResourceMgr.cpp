@@ -1,4 +1,5 @@
 #include "ResourceMgr.h"
+#include <filesystem>
 #include <fstream>
 #include <ranges>
 #include <wincodec.h>
@@ -49,12 +50,12 @@ void FResourceMgr::Initialize(FRenderer* renderer, FGraphicsDevice* device)
 }
 
 void FResourceMgr::Release(FRenderer* renderer) {
-    for (const auto& Pair : textureMap)
+    for (const std::shared_ptr<FTexture>& Texture : TextureTable)
     {
-        FTexture* texture = Pair.Value.get();
-        texture->Release();
+        Texture->Release();
     }
-    textureMap.Empty();
+    TextureTable.Empty();
+    TextureHandleMap.Empty();
 }
 
 #include <unordered_map>
@@ -78,12 +79,59 @@ struct TupleHash {
 
 std::shared_ptr<FTexture> FResourceMgr::GetTexture(const FWString& name) const
 {
-    auto* TempValue = textureMap.Find(name);
-    return TempValue ? *TempValue : nullptr;
+    const uint32* Index = TextureHandleMap.Find(name);
+    return Index ? TextureTable[*Index] : nullptr;
+}
+
+FTextureHandle FResourceMgr::GetTextureHandle(const FWString& name) const
+{
+    FTextureHandle Handle;
+    if (const uint32* Index = TextureHandleMap.Find(name))
+    {
+        Handle.Index = *Index;
+    }
+    return Handle;
+}
+
+HRESULT FResourceMgr::ReloadTexture(ID3D11Device* device, ID3D11DeviceContext* context, const FWString& name)
+{
+    if (TextureHandleMap.Find(name) == nullptr)
+    {
+        return E_INVALIDARG;
+    }
+
+    const std::wstring Extension = std::filesystem::path(name).extension().wstring();
+    if (Extension == L".dds" || Extension == L".DDS")
+    {
+        return LoadTextureFromDDS(device, context, name.c_str());
+    }
+    return LoadTextureFromFile(device, context, name.c_str());
+}
+
+FTextureHandle FResourceMgr::RegisterTexture(
+    const FWString& name, ID3D11ShaderResourceView* SRV, ID3D11Texture2D* Texture2D, ID3D11SamplerState* Sampler, uint32 Width, uint32 Height
+)
+{
+    FTextureHandle Handle;
+    if (const uint32* Index = TextureHandleMap.Find(name))
+    {
+        // Hot-swap: 같은 FTexture 객체의 내용을 교체하므로 핸들과 shared_ptr 보유자 모두 새 리소스를 보게 됨
+        FTexture* Existing = TextureTable[*Index].get();
+        Existing->Release();
+        *Existing = FTexture(SRV, Texture2D, Sampler, name, Width, Height);
+        Handle.Index = *Index;
+        return Handle;
+    }
+
+    Handle.Index = static_cast<uint32>(TextureTable.Add(std::make_shared<FTexture>(SRV, Texture2D, Sampler, name, Width, Height)));
+    TextureHandleMap.Add(name, Handle.Index);
+    return Handle;
 }
 
 HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename)
 {
+    MEMORY_TAG_SCOPE(Texture);
+
     IWICImagingFactory* wicFactory = nullptr;
     IWICBitmapDecoder* decoder = nullptr;
     IWICBitmapFrameDecode* frame = nullptr;
@@ -172,7 +220,7 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceCont
     device->CreateSamplerState(&samplerDesc, &SamplerState);
     FWString name = FWString(filename);
 
-    textureMap[name] = std::make_shared<FTexture>(TextureSRV, Texture2D, SamplerState, name, width, height);
+    RegisterTexture(name, TextureSRV, Texture2D, SamplerState, width, height);
 
     Console::GetInstance().AddLog(LogLevel::Warning, "Texture File Load Successs");
     return hr;
@@ -180,6 +228,8 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceCont
 
 HRESULT FResourceMgr::LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename)
 {
+    MEMORY_TAG_SCOPE(Texture);
+
 
     ID3D11Resource* texture = nullptr;
     ID3D11ShaderResourceView* textureView = nullptr;
@@ -226,7 +276,7 @@ HRESULT FResourceMgr::LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceConte
 
     FWString name = FWString(filename);
 
-    textureMap[name] = std::make_shared<FTexture>(textureView, texture2D, SamplerState, name, width, height);
+    RegisterTexture(name, textureView, texture2D, SamplerState, width, height);
 
     Console::GetInstance().AddLog(LogLevel::Warning, "Texture File Load Successs");
 
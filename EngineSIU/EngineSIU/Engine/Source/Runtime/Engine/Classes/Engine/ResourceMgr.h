@@ -15,6 +15,23 @@ public:
     HRESULT LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename);
 
     std::shared_ptr<FTexture> GetTexture(const FWString& name) const;
+
+    /** 경로를 텍스처 핸들로 변환합니다. 로드 시점에만 호출하고, Draw에서는 핸들을 사용합니다. */
+    FTextureHandle GetTextureHandle(const FWString& name) const;
+
+    /** 핸들로 텍스처에 접근합니다. 문자열 해싱이나 shared_ptr 복사가 없습니다. */
+    FTexture* GetTexture(FTextureHandle Handle) const
+    {
+        return TextureTable.IsValidIndex(Handle.Index) ? TextureTable[Handle.Index].get() : nullptr;
+    }
+
+    /** 이미 로드된 텍스처를 파일에서 다시 읽어 같은 슬롯에 교체합니다. 기존 핸들과 포인터는 그대로 유효합니다. */
+    HRESULT ReloadTexture(ID3D11Device* device, ID3D11DeviceContext* context, const FWString& name);
+
 private:
-    TMap<FWString, std::shared_ptr<FTexture>> textureMap;
+    FTextureHandle RegisterTexture(const FWString& name, ID3D11ShaderResourceView* SRV, ID3D11Texture2D* Texture2D, ID3D11SamplerState* Sampler, uint32 Width, uint32 Height);
+
+    // 슬롯은 한 번 할당되면 제거되지 않으므로 핸들 인덱스가 안정적으로 유지됨
+    TArray<std::shared_ptr<FTexture>> TextureTable;
+    TMap<FWString, uint32> TextureHandleMap;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Actor.h"
+#include "Serialization/FieldArchive.h"
 #include "Components/PrimitiveComponent.h"
 #include "Delegates/DelegateCombination.h"
 #include "World/World.h"
@@ -6,20 +7,46 @@
 #include "Components/InputComponent.h"
 #include "Components/LuaScriptComponent.h"
 #include "Engine/Lua/LuaScriptManager.h"
+#include "Async/JobSystem.h"
 
 #include "Engine/Lua/LuaUtils/LuaTypeMacros.h"
 
+AActor::AActor()
+{
+    // 게임 코드의 Actor들은 대부분 Tick을 재정의하므로 Actor는 기본으로 Tick 합니다.
+    PrimaryActorTick.bCanEverTick = true;
+}
+
 void AActor::PostSpawnInitialize()
 {
     InitLuaScriptComponent();
 }
 
+void AActor::MarkDirty()
+{
+    if (!FJobSystem::Get().IsInGameThread())
+    {
+        return;
+    }
+
+    // 월드에 들어가기 전이면 에디터 월드로 복사될 수 있으므로 기록
+    const UWorld* World = GetWorld();
+    if (World && World->WorldType != EWorldType::Editor)
+    {
+        return;
+    }
+    bDirty = true;
+}
+
 UObject* AActor::Duplicate(UObject* InOuter)
 {
     ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
 
     NewActor->Owner = Owner;
     NewActor->bTickInEditor = bTickInEditor;
+    NewActor->PrimaryActorTick.bCanEverTick = PrimaryActorTick.bCanEverTick;
+    NewActor->PrimaryActorTick.TickInterval = PrimaryActorTick.TickInterval;
+    NewActor->PrimaryActorTick.SetTickFunctionEnable(PrimaryActorTick.IsTickFunctionEnabled());
     // 기본적으로 있던 컴포넌트 제거
     TSet CopiedComponents = NewActor->OwnedComponents;
 
@@ -100,10 +127,14 @@ void AActor::GetProperties(TMap<FString, FString>& OutProperties) const
     
     Properties.Add(TEXT("bTickInEditor"), bTickInEditor ? TEXT("true") : TEXT("false"));
     Properties.Add(TEXT("bUseScript"), bUseScript ? TEXT("true") : TEXT("false"));
+
+    GetClass()->ExportProperties(this, Properties);
 }
 
 void AActor::SetProperties(const TMap<FString, FString>& InProperties)
 {
+    GetClass()->ImportProperties(this, InProperties);
+
     const FString* TempStr = nullptr;
     TempStr = InProperties.Find(TEXT("bTickInEditor"));
     if (TempStr)
@@ -117,6 +148,24 @@ void AActor::SetProperties(const TMap<FString, FString>& InProperties)
     }
 }
 
+void AActor::SerializeFields(FFieldArchive& Ar)
+{
+    Super::SerializeFields(Ar);
+    Ar.Field(TEXT("bTickInEditor"), bTickInEditor);
+    Ar.Field(TEXT("bUseScript"), bUseScript);
+
+    if (Ar.IsDuplicating())
+    {
+        bool bCanEverTick = PrimaryActorTick.bCanEverTick;
+        bool bTickEnabled = PrimaryActorTick.IsTickFunctionEnabled();
+        Ar.Field(TEXT("bCanEverTick"), bCanEverTick);
+        Ar.Field(TEXT("TickInterval"), PrimaryActorTick.TickInterval);
+        Ar.Field(TEXT("bTickEnabled"), bTickEnabled);
+        PrimaryActorTick.bCanEverTick = bCanEverTick;
+        PrimaryActorTick.SetTickFunctionEnable(bTickEnabled);
+    }
+}
+
 void AActor::BeginPlay()
 {
     if (bUseScript)
@@ -135,18 +184,13 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaTime)
 {
-    // TODO: 임시로 Actor에서 Tick 돌리기
-    // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
-    const auto CopyComponents = OwnedComponents;
-
-    for (UActorComponent* Comp : CopyComponents)
-    {
-        Comp->TickComponent(DeltaTime);
-    }
+    // 컴포넌트의 Tick은 각자의 PrimaryComponentTick으로 World의 Tick Manager에서 실행됩니다.
 }
 
 void AActor::Destroyed()
 {
+    RegisterAllActorTickFunctions(false);
+
     // Actor가 제거되었을 때 호출하는 EndPlay
     EndPlay(EEndPlayReason::Destroyed);
     
@@ -224,6 +268,7 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
         
         OwnedComponents.Add(Component);
         Component->OwnerPrivate = this;
+        MarkDirty();
 
         // 만약 SceneComponent를 상속 받았다면
 
@@ -246,6 +291,12 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
         // TODO: RegisterComponent() 생기면 제거
         Component->InitializeComponent();
 
+        // 이미 World에 있는 Actor라면 바로 Tick 등록. 아니면 Actor가 World에 들어갈 때 함께 등록됩니다.
+        if (GetWorld())
+        {
+            Component->RegisterComponentTickFunctions(true);
+        }
+
         return Component;
     }
     
@@ -256,6 +307,7 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
 void AActor::RemoveOwnedComponent(UActorComponent* Component)
 {
     OwnedComponents.Remove(Component);
+    MarkDirty();
 }
 
 void AActor::InitializeComponents()
@@ -292,6 +344,7 @@ bool AActor::SetRootComponent(USceneComponent* NewRootComponent)
         {
             USceneComponent* OldRootComponent = RootComponent;
             RootComponent = NewRootComponent;
+            MarkDirty();
 
             if (OldRootComponent)
             {
@@ -406,6 +459,30 @@ void AActor::SetActorTickInEditor(bool InbInTickInEditor)
     bTickInEditor = InbInTickInEditor;
 }
 
+void AActor::RegisterAllActorTickFunctions(bool bRegister)
+{
+    if (bRegister)
+    {
+        UWorld* World = GetWorld();
+        if (!World || IsActorBeingDestroyed())
+        {
+            return;
+        }
+
+        PrimaryActorTick.Target = this;
+        PrimaryActorTick.RegisterTickFunction(World->GetTickTaskManager());
+    }
+    else
+    {
+        PrimaryActorTick.UnRegisterTickFunction();
+    }
+
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        Component->RegisterComponentTickFunctions(bRegister);
+    }
+}
+
 void AActor::InitLuaScriptComponent()
 {
     if (LuaScriptComponent == nullptr)
@@ -1,6 +1,7 @@
 #pragma once
 #include "Components/SceneComponent.h"
 #include "Container/Set.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Engine/EngineTypes.h"
 #include "UObject/Casts.h"
 #include "UObject/Object.h"
@@ -29,7 +30,7 @@ class AActor : public UObject
     DECLARE_CLASS(AActor, UObject)
 
 public:
-    AActor() = default;
+    AActor();
 
     // SpawnActor 내부에서 Actor 생성 이후 호출될 함수.
     // 생성 로직 단계에서 계층 구조에 종속되는 초기화를 대신 해주는 초기화 함수.
@@ -38,13 +39,16 @@ public:
 
     /**
     * 해당 액터의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-    * 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
+    * UPROPERTY는 여기서 모두 추가되므로, 하위 클래스는 UPROPERTY가 아닌 속성만 재정의하여 추가합니다.
     */
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const;
 
     /** 저장된 Properties 맵에서 액터의 상태를 복원합니다. */
     virtual void SetProperties(const TMap<FString, FString>& InProperties);
 
+    /** 씬 바이너리 저장/로드와 PIE 복제용 필드 직렬화. 필드 이름은 GetProperties의 키와 같습니다. */
+    virtual void SerializeFields(FFieldArchive& Ar) override;
+
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
@@ -137,15 +141,32 @@ public:
 
     void ProcessOverlaps();
 
+public:
+    /**
+     * 마지막 자동 저장 이후 이 Actor나 소유한 컴포넌트가 바뀌었는지 여부
+     * 새로 만든 Actor는 바뀐 상태로 시작하고, FSceneAutoSave가 기록한 뒤 ClearDirty합니다.
+     */
+    bool IsDirty() const { return bDirty; }
+
+    /**
+     * 자동 저장 대상으로 표시합니다. 에디터 월드의 Actor를 게임 스레드에서 바꿀 때만 기록합니다.
+     * PIE / 게임 월드는 저장되지 않고, 워커 스레드 Tick에서 바뀐 값은 FSceneAutoSave의 읽기와 겹칠 수 있으므로 무시합니다.
+     */
+    void MarkDirty();
+    void ClearDirty() { bDirty = false; }
+
+public:
     virtual void EnableInput(APlayerController* PlayerController);
     virtual void DisableInput(APlayerController* PlayerController);
 
 protected:
-    UPROPERTY
-    (USceneComponent*, RootComponent, = nullptr)
+    // 복제 시 FLevelDuplicator가 따로 연결함
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, USceneComponent*, RootComponent, = nullptr)
 
-    UPROPERTY
-    (UInputComponent*, InputComponent, = nullptr)
+    // 플레이 중 EnableInput에서 만들어짐
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, UInputComponent*, InputComponent, = nullptr)
 
 private:
     /** 이 Actor를 소유하고 있는 다른 Actor의 정보 */
@@ -159,6 +180,9 @@ private:
     /** 현재 Actor가 삭제 처리중인지 여부 */
     uint8 bActorIsBeingDestroyed : 1 = false;
 
+    /** 마지막 자동 저장 이후 바뀌었는지 여부. 옆의 비트필드와 같은 바이트를 쓰지 않도록 bool로 둠 */
+    bool bDirty = true;
+
     TArray<AActor*> PendingDestroyActors;
 
 
@@ -184,6 +208,15 @@ public:
     bool IsActorTickInEditor() const { return bTickInEditor; }
     void SetActorTickInEditor(bool InbInTickInEditor);
 
+    /** Actor와 소유한 컴포넌트들의 Tick 함수를 World의 Tick Manager에 등록 / 해제합니다. */
+    void RegisterAllActorTickFunctions(bool bRegister);
+
+    void SetActorTickEnabled(bool bEnabled) { PrimaryActorTick.SetTickFunctionEnable(bEnabled); }
+    bool IsActorTickEnabled() const { return PrimaryActorTick.IsTickFunctionEnabled(); }
+    void SetActorTickInterval(float TickInterval) { PrimaryActorTick.TickInterval = TickInterval; }
+
+    FActorTickFunction PrimaryActorTick;
+
 private:
     bool bTickInEditor = false;
 
@@ -31,8 +31,8 @@ public:
     virtual void SetControlRotation(const FRotator& NewRotation);
 
 protected:
-    UPROPERTY
-    (APawn*, Pawn, = nullptr)
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, APawn*, Pawn, = nullptr)
     
 };
 
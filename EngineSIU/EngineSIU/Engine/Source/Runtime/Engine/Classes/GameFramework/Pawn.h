@@ -15,16 +15,6 @@ public:
     virtual void Tick(float DeltaTime) override;
     virtual void Destroyed() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    // TODO Check Duplicate Controller
-
-    /**
-* 해당 액터의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-* 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
-*/
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
-
-    /** 저장된 Properties 맵에서 액터의 상태를 복원합니다. */
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
 
 public:
     /** Pawn을 Controller에 의해 점유(Possess)될 때 호출 */
@@ -58,11 +48,13 @@ public:
     AController* GetController() const { return Controller; }
 
 protected:
-    UPROPERTY
-    (AController*, Controller, = nullptr) // 현재 조종 중인 컨트롤러
+    // 빙의 관계는 PossessedBy로만 맺어지므로 복제하지 않음
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, AController*, Controller, = nullptr) // 현재 조종 중인 컨트롤러
 
 protected:
-    FVector PendingMovement;
+    UPROPERTY
+    (FVector, PendingMovement)
 
     UPROPERTY
     (float, MoveSpeed, = 6.0f)
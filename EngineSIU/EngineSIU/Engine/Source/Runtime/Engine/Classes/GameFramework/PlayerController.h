@@ -37,16 +37,16 @@ public:
     void InputAxis(EKeys::Type Key, EInputEvent EventType);
     void MouseInput(float DeltaX, float DeltaY);
 
-    UPROPERTY
-    (APlayerCameraManager*, PlayerCameraManager, = nullptr)
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, APlayerCameraManager*, PlayerCameraManager, = nullptr)
 
-    UPROPERTY
-    (TArray<UInputComponent*>, InputComponentStack, = {})
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, TArray<UInputComponent*>, InputComponentStack, = {})
 
 protected:
     void SetupInputBindings();
 
-    UPROPERTY
-    (UPlayerInput*, PlayerInput, = nullptr)
+    UPROPERTY_WITH_FLAGS
+    (DuplicateTransient, UPlayerInput*, PlayerInput, = nullptr)
 };
 
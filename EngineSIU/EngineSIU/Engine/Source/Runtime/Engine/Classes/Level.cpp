@@ -2,6 +2,7 @@
 #include "GameFramework/Actor.h"
 #include "UObject/Casts.h"
 #include "World/World.h"
+#include "World/LevelDuplicator.h"
 
 
 void ULevel::InitLevel(UWorld* InOwningWorld)
@@ -28,10 +29,8 @@ UObject* ULevel::Duplicate(UObject* InOuter)
     NewLevel->OwningWorld = OwningWorld;
     NewLevel->LevelName = LevelName;
 
-    for (AActor* Actor : Actors)
-    {
-        NewLevel->Actors.Emplace(static_cast<AActor*>(Actor->Duplicate(InOuter)));
-    }
+    // 액터마다 Duplicate를 호출하지 않고 한 번에 복제
+    FLevelDuplicator::DuplicateActors(*this, *NewLevel, Cast<UWorld>(InOuter));
 
     return NewLevel;
 }
@@ -13,6 +13,12 @@ UObject* UMaterial::Duplicate(UObject* InOuter)
 }
 
 
+void UMaterial::ResolveTextureHandles()
+{
+    materialInfo.DiffuseTextureHandle = GEngineLoop.ResourceManager.GetTextureHandle(materialInfo.DiffuseTexturePath);
+    materialInfo.BumpTextureHandle = GEngineLoop.ResourceManager.GetTextureHandle(materialInfo.BumpTexturePath);
+}
+
 UMaterial* UMaterial::CreateMaterial(const FObjMaterialInfo& materialInfo)
 {
     if (materialMap[materialInfo.MaterialName] != nullptr)
@@ -23,11 +29,22 @@ UMaterial* UMaterial::CreateMaterial(const FObjMaterialInfo& materialInfo)
     materialMap.Add(materialInfo.MaterialName, newMaterial);
 
     // !TODO : 텍스쳐 로드 로직 나중에 변경
-    GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, materialInfo.DiffuseTexturePath.c_str());
-    GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, materialInfo.BumpTexturePath.c_str());
-    GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, materialInfo.SpecularTexturePath.c_str());
-    GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, materialInfo.AmbientTexturePath.c_str());
-    GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, materialInfo.AlphaTexturePath.c_str());
+    // 이미 로드된 텍스처는 다시 읽지 않음 (다시 로드하면 같은 슬롯이 Hot-swap 됨)
+    const FWString TexturePaths[] = {
+        materialInfo.DiffuseTexturePath,
+        materialInfo.BumpTexturePath,
+        materialInfo.SpecularTexturePath,
+        materialInfo.AmbientTexturePath,
+        materialInfo.AlphaTexturePath,
+    };
+    for (const FWString& TexturePath : TexturePaths)
+    {
+        if (!GEngineLoop.ResourceManager.GetTextureHandle(TexturePath).IsValid())
+        {
+            GEngineLoop.ResourceManager.LoadTextureFromFile(GEngineLoop.GraphicDevice.Device, GEngineLoop.GraphicDevice.DeviceContext, TexturePath.c_str());
+        }
+    }
+    newMaterial->ResolveTextureHandles();
 
 
     return newMaterial;
@@ -11,7 +11,14 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
 
     FObjMaterialInfo& GetMaterialInfo() { return materialInfo; }
-    void SetMaterialInfo(const FObjMaterialInfo& value) { materialInfo = value; }
+    void SetMaterialInfo(const FObjMaterialInfo& value)
+    {
+        materialInfo = value;
+        ResolveTextureHandles();
+    }
+
+    // 텍스처 경로를 FResourceMgr 핸들로 변환해서 캐싱. 렌더링 시에는 핸들만 사용함
+    void ResolveTextureHandles();
 
     // 색상 및 재질 속성 설정자
     void SetDiffuse(const FVector& DiffuseIn) { materialInfo.Diffuse = DiffuseIn; }
@@ -0,0 +1,593 @@
+#include "MeshCluster.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Math/MathUtility.h"
+#include "Math/Plane.h"
+
+bool FMeshCluster::bCullingEnabled = true;
+FClusterCullStats FMeshCluster::MainViewStats;
+FClusterCullStats FMeshCluster::ShadowViewStats;
+
+void FClusterCullStats::Accumulate(const FClusterCullStats& Other)
+{
+    NumClusters += Other.NumClusters;
+    NumVisibleClusters += Other.NumVisibleClusters;
+    NumTriangles += Other.NumTriangles;
+    NumFrustumCulledTriangles += Other.NumFrustumCulledTriangles;
+    NumBackfaceCulledTriangles += Other.NumBackfaceCulledTriangles;
+    NumOcclusionCulledTriangles += Other.NumOcclusionCulledTriangles;
+    NumDrawRanges += Other.NumDrawRanges;
+}
+
+namespace
+{
+    // 이어진 삼각형이 없을 때(떨어진 조각) 다음 삼각형을 찾아볼 범위. 인덱스가 캐시 순서라 가까운 삼각형이 근처에 있음
+    constexpr int32 FallbackSearchWindow = 256;
+
+    // 압축 정점 형식은 위치를 양자화하므로 바운딩 구를 메시 크기의 이 비율만큼 키움
+    constexpr float ClusterRadiusPadding = 1e-4f;
+
+    // 깊이 클리핑을 끈 래스터라이저(DepthClipEnable = FALSE)는 근 / 원 평면 밖도 그리므로 옆 네 평면만 검사
+    constexpr int32 NumCullPlanes = 4;
+
+    FVector GetPosition(const TArray<FStaticMeshVertex>& Vertices, uint32 Index)
+    {
+        const FStaticMeshVertex& Vertex = Vertices[Index];
+        return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+    }
+
+    // 앞면의 노멀. 래스터라이저에서 시계 방향인 삼각형은 이 방향이 시점을 향함
+    FVector GetFaceNormal(const TArray<FStaticMeshVertex>& Vertices, const uint32* Triangle)
+    {
+        const FVector A = GetPosition(Vertices, Triangle[0]);
+        const FVector B = GetPosition(Vertices, Triangle[1]);
+        const FVector C = GetPosition(Vertices, Triangle[2]);
+        return (B - A) ^ (C - A);
+    }
+
+    bool GetSubsets(const FStaticMeshRenderData& RenderData, TArray<FMaterialSubset>& OutSubsets)
+    {
+        const int32 NumIndices = RenderData.Indices.Num();
+
+        OutSubsets = RenderData.MaterialSubsets;
+        if (OutSubsets.Num() == 0)
+        {
+            FMaterialSubset Subset;
+            Subset.IndexStart = 0;
+            Subset.IndexCount = NumIndices;
+            Subset.MaterialIndex = 0;
+            OutSubsets.Add(Subset);
+        }
+
+        // 서브셋 안에서만 순서를 바꾸므로 범위가 겹치면 안 됨
+        TArray<FMaterialSubset> Sorted = OutSubsets;
+        Sorted.Sort([](const FMaterialSubset& A, const FMaterialSubset& B) { return A.IndexStart < B.IndexStart; });
+
+        uint64 PreviousEnd = 0;
+        for (const FMaterialSubset& Subset : Sorted)
+        {
+            const uint64 End = static_cast<uint64>(Subset.IndexStart) + Subset.IndexCount;
+            if (Subset.IndexCount % 3 != 0 || Subset.IndexStart < PreviousEnd || End > static_cast<uint64>(NumIndices))
+            {
+                return false;
+            }
+            PreviousEnd = End;
+        }
+        return true;
+    }
+
+    void ComputeClusterBounds(const TArray<FStaticMeshVertex>& Vertices, const uint32* Indices, int32 NumIndices, float Padding, FStaticMeshCluster& OutCluster)
+    {
+        FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Index = 0; Index < NumIndices; ++Index)
+        {
+            const FVector Position = GetPosition(Vertices, Indices[Index]);
+            Min = FVector(FMath::Min(Min.X, Position.X), FMath::Min(Min.Y, Position.Y), FMath::Min(Min.Z, Position.Z));
+            Max = FVector(FMath::Max(Max.X, Position.X), FMath::Max(Max.Y, Position.Y), FMath::Max(Max.Z, Position.Z));
+        }
+
+        OutCluster.Center = (Min + Max) * 0.5f;
+        float RadiusSquared = 0.0f;
+        for (int32 Index = 0; Index < NumIndices; ++Index)
+        {
+            RadiusSquared = FMath::Max(RadiusSquared, (GetPosition(Vertices, Indices[Index]) - OutCluster.Center).SquaredLength());
+        }
+        OutCluster.Radius = std::sqrt(RadiusSquared) + Padding;
+
+        // 넓이가 0인 삼각형은 그려지지 않으므로 원뿔에서 뺌
+        FVector NormalSum = FVector::ZeroVector;
+        for (int32 Index = 0; Index < NumIndices; Index += 3)
+        {
+            const FVector Normal = GetFaceNormal(Vertices, &Indices[Index]);
+            const float Length = Normal.Length();
+            if (Length > 0.0f)
+            {
+                NormalSum += Normal / Length;
+            }
+        }
+
+        OutCluster.ConeAxis = FVector(0.0f, 0.0f, 1.0f);
+        OutCluster.ConeCutoff = 1.0f;
+
+        const float SumLength = NormalSum.Length();
+        if (SumLength <= KINDA_SMALL_NUMBER)
+        {
+            return;
+        }
+        const FVector Axis = NormalSum / SumLength;
+
+        float MinDot = 1.0f;
+        for (int32 Index = 0; Index < NumIndices; Index += 3)
+        {
+            const FVector Normal = GetFaceNormal(Vertices, &Indices[Index]);
+            const float Length = Normal.Length();
+            if (Length > 0.0f)
+            {
+                MinDot = FMath::Min(MinDot, (Normal / Length) | Axis);
+            }
+        }
+
+        // 반각이 90도 이상이면 어느 방향에서든 앞면이 있을 수 있음
+        OutCluster.ConeAxis = Axis;
+        if (MinDot > 0.0f)
+        {
+            OutCluster.ConeCutoff = std::sqrt(FMath::Max(0.0f, 1.0f - MinDot * MinDot));
+        }
+    }
+
+    /**
+     * 서브셋 하나를 클러스터로 나눕니다.
+     * 클러스터에 정점이 이미 들어 있는 삼각형 중 새 정점이 적은 것, 그다음 중심에 가깝고 노멀이 비슷한 것부터 붙입니다.
+     */
+    void BuildSubsetClusters(
+        FStaticMeshRenderData& RenderData, const FMaterialSubset& Subset, uint32 SubsetIndex, const FMeshClusterSettings& Settings, float Padding,
+        TArray<int32>& VertexStamp, int32& ClusterStamp
+    )
+    {
+        const TArray<FStaticMeshVertex>& Vertices = RenderData.Vertices;
+        const int32 NumVertices = Vertices.Num();
+        const int32 NumTriangles = static_cast<int32>(Subset.IndexCount / 3);
+        if (NumTriangles == 0)
+        {
+            return;
+        }
+
+        const uint32* Indices = &RenderData.Indices[Subset.IndexStart];
+
+        TArray<FVector> Centroids;
+        TArray<FVector> Normals;
+        Centroids.SetNum(NumTriangles);
+        Normals.SetNum(NumTriangles);
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            const uint32* Corners = &Indices[Triangle * 3];
+            Centroids[Triangle] = (GetPosition(Vertices, Corners[0]) + GetPosition(Vertices, Corners[1]) + GetPosition(Vertices, Corners[2])) / 3.0f;
+
+            const FVector Normal = GetFaceNormal(Vertices, Corners);
+            const float Length = Normal.Length();
+            Normals[Triangle] = Length > 0.0f ? Normal / Length : FVector::ZeroVector;
+        }
+
+        // 정점 → 삼각형 인접 목록
+        TArray<int32> AdjacencyOffsets;
+        AdjacencyOffsets.Init(0, NumVertices + 1);
+        for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+        {
+            ++AdjacencyOffsets[Indices[Index] + 1];
+        }
+        for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+        {
+            AdjacencyOffsets[Vertex + 1] += AdjacencyOffsets[Vertex];
+        }
+
+        TArray<int32> Adjacency;
+        Adjacency.SetNum(NumTriangles * 3);
+        {
+            TArray<int32> Cursor = AdjacencyOffsets;
+            for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+            {
+                Adjacency[Cursor[Indices[Index]]++] = Index / 3;
+            }
+        }
+
+        TArray<uint8> Emitted;
+        Emitted.Init(0, NumTriangles);
+        TArray<int32> CandidateStamp;
+        CandidateStamp.Init(-1, NumTriangles);
+
+        TArray<uint32> NewIndices;
+        NewIndices.Reserve(NumTriangles * 3);
+
+        TArray<int32> ClusterTriangles;
+        TArray<uint32> ClusterVertices;
+        TArray<int32> Candidates;
+
+        int32 SeedCursor = 0;
+        int32 NumEmitted = 0;
+        while (NumEmitted < NumTriangles)
+        {
+            ++ClusterStamp;
+            ClusterTriangles.Empty();
+            ClusterVertices.Empty();
+            Candidates.Empty();
+
+            FVector CentroidSum = FVector::ZeroVector;
+            FVector NormalSum = FVector::ZeroVector;
+
+            auto CountNewVertices = [&](int32 Triangle)
+            {
+                int32 Count = 0;
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Count += VertexStamp[Indices[Triangle * 3 + Corner]] != ClusterStamp ? 1 : 0;
+                }
+                return Count;
+            };
+
+            auto AddTriangle = [&](int32 Triangle)
+            {
+                Emitted[Triangle] = 1;
+                ++NumEmitted;
+                ClusterTriangles.Add(Triangle);
+                CentroidSum += Centroids[Triangle];
+                NormalSum += Normals[Triangle];
+
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const uint32 Vertex = Indices[Triangle * 3 + Corner];
+                    if (VertexStamp[Vertex] == ClusterStamp)
+                    {
+                        continue;
+                    }
+                    VertexStamp[Vertex] = ClusterStamp;
+                    ClusterVertices.Add(Vertex);
+
+                    for (int32 Adjacent = AdjacencyOffsets[Vertex]; Adjacent < AdjacencyOffsets[Vertex + 1]; ++Adjacent)
+                    {
+                        const int32 Neighbor = Adjacency[Adjacent];
+                        if (!Emitted[Neighbor] && CandidateStamp[Neighbor] != ClusterStamp)
+                        {
+                            CandidateStamp[Neighbor] = ClusterStamp;
+                            Candidates.Add(Neighbor);
+                        }
+                    }
+                }
+            };
+
+            while (Emitted[SeedCursor])
+            {
+                ++SeedCursor;
+            }
+            AddTriangle(SeedCursor);
+
+            while (ClusterTriangles.Num() < Settings.MaxTriangles)
+            {
+                const FVector Center = CentroidSum / static_cast<float>(ClusterTriangles.Num());
+                const float NormalLength = NormalSum.Length();
+                const FVector Axis = NormalLength > 0.0f ? NormalSum / NormalLength : FVector::ZeroVector;
+
+                auto GetCost = [&](int32 Triangle)
+                {
+                    return (Centroids[Triangle] - Center).SquaredLength() * (2.0f - (Normals[Triangle] | Axis));
+                };
+
+                int32 Best = INDEX_NONE;
+                int32 BestNewVertices = 4;
+                float BestCost = FLT_MAX;
+
+                int32 NumCandidates = 0;
+                for (int32 Candidate : Candidates)
+                {
+                    if (Emitted[Candidate])
+                    {
+                        continue;
+                    }
+                    Candidates[NumCandidates++] = Candidate;
+
+                    const int32 NewVertices = CountNewVertices(Candidate);
+                    if (ClusterVertices.Num() + NewVertices > Settings.MaxVertices)
+                    {
+                        continue;
+                    }
+
+                    const float Cost = GetCost(Candidate);
+                    if (NewVertices < BestNewVertices || (NewVertices == BestNewVertices && Cost < BestCost))
+                    {
+                        Best = Candidate;
+                        BestNewVertices = NewVertices;
+                        BestCost = Cost;
+                    }
+                }
+                Candidates.SetNum(NumCandidates);
+
+                // 이웃은 있지만 정점 한도를 넘으면 여기서 끊음
+                if (Best == INDEX_NONE && NumCandidates > 0)
+                {
+                    break;
+                }
+
+                if (Best == INDEX_NONE)
+                {
+                    while (SeedCursor < NumTriangles && Emitted[SeedCursor])
+                    {
+                        ++SeedCursor;
+                    }
+
+                    const int32 SearchEnd = FMath::Min(SeedCursor + FallbackSearchWindow, NumTriangles);
+                    for (int32 Triangle = SeedCursor; Triangle < SearchEnd; ++Triangle)
+                    {
+                        if (Emitted[Triangle] || ClusterVertices.Num() + CountNewVertices(Triangle) > Settings.MaxVertices)
+                        {
+                            continue;
+                        }
+
+                        const float Cost = (Centroids[Triangle] - Center).SquaredLength();
+                        if (Cost < BestCost)
+                        {
+                            Best = Triangle;
+                            BestCost = Cost;
+                        }
+                    }
+                }
+
+                if (Best == INDEX_NONE)
+                {
+                    break;
+                }
+                AddTriangle(Best);
+            }
+
+            // 클러스터 안에서는 원래 순서를 지켜 정점 캐시 효율을 유지
+            ClusterTriangles.Sort();
+
+            FStaticMeshCluster Cluster;
+            Cluster.IndexStart = Subset.IndexStart + NewIndices.Num();
+            Cluster.IndexCount = ClusterTriangles.Num() * 3;
+            Cluster.SubsetIndex = SubsetIndex;
+            Cluster.NumVertices = ClusterVertices.Num();
+
+            for (int32 Triangle : ClusterTriangles)
+            {
+                NewIndices.Add(Indices[Triangle * 3 + 0]);
+                NewIndices.Add(Indices[Triangle * 3 + 1]);
+                NewIndices.Add(Indices[Triangle * 3 + 2]);
+            }
+
+            ComputeClusterBounds(Vertices, &NewIndices[Cluster.IndexStart - Subset.IndexStart], Cluster.IndexCount, Padding, Cluster);
+            RenderData.Clusters.Add(Cluster);
+        }
+
+        std::copy_n(NewIndices.GetData(), NewIndices.Num(), &RenderData.Indices[Subset.IndexStart]);
+    }
+
+    // 행렬의 열을 (S0, S1, S2, S3)로 섞은 평면. clip = [P, 1] * M 이므로 S · clip >= 0인 쪽이 안
+    FPlane MakeClipPlane(const FMatrix& M, float S0, float S1, float S2, float S3)
+    {
+        FPlane Plane(
+            S0 * M.M[0][0] + S1 * M.M[0][1] + S2 * M.M[0][2] + S3 * M.M[0][3],
+            S0 * M.M[1][0] + S1 * M.M[1][1] + S2 * M.M[1][2] + S3 * M.M[1][3],
+            S0 * M.M[2][0] + S1 * M.M[2][1] + S2 * M.M[2][2] + S3 * M.M[2][3],
+            S0 * M.M[3][0] + S1 * M.M[3][1] + S2 * M.M[3][2] + S3 * M.M[3][3]
+        );
+
+        // 쓸 수 없는 평면은 항상 통과
+        if (!Plane.Normalize())
+        {
+            Plane = FPlane(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        return Plane;
+    }
+
+    FVector GetColumn(const FMatrix& M, int32 Column)
+    {
+        return FVector(M.M[0][Column], M.M[1][Column], M.M[2][Column]);
+    }
+}
+
+void FMeshCluster::BuildClusters(FStaticMeshRenderData& RenderData, const FMeshClusterSettings& Settings)
+{
+    RenderData.Clusters.Empty();
+
+    const int32 NumVertices = RenderData.Vertices.Num();
+    const int32 NumIndices = RenderData.Indices.Num();
+    if (NumVertices == 0 || NumIndices % 3 != 0 || Settings.MaxVertices < 3 || Settings.MaxTriangles < 1)
+    {
+        return;
+    }
+
+    if (NumIndices / 3 < Settings.MaxTriangles * Settings.MinClustersPerMesh)
+    {
+        return;
+    }
+
+    for (UINT Index : RenderData.Indices)
+    {
+        if (Index >= static_cast<UINT>(NumVertices))
+        {
+            return;
+        }
+    }
+
+    TArray<FMaterialSubset> Subsets;
+    if (!GetSubsets(RenderData, Subsets))
+    {
+        return;
+    }
+
+    const float Padding = (RenderData.BoundingBoxMax - RenderData.BoundingBoxMin).Length() * ClusterRadiusPadding;
+
+    TArray<int32> VertexStamp;
+    VertexStamp.Init(-1, NumVertices);
+    int32 ClusterStamp = -1;
+
+    for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+    {
+        BuildSubsetClusters(RenderData, Subsets[SubsetIndex], SubsetIndex, Settings, Padding, VertexStamp, ClusterStamp);
+    }
+
+    // 서브셋 순서대로 모아 둠 (MaterialSubsets가 IndexStart 순이 아니어도 SubsetIndex 순)
+    std::stable_sort(
+        RenderData.Clusters.begin(), RenderData.Clusters.end(),
+        [](const FStaticMeshCluster& A, const FStaticMeshCluster& B) { return A.SubsetIndex < B.SubsetIndex; }
+    );
+}
+
+bool FMeshCluster::CullClusters(
+    const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, const FClusterCullView& View,
+    TArray<FClusterDrawRange>& OutRanges, FClusterCullStats* OutStats
+)
+{
+    OutRanges.Empty();
+    if (RenderData.Clusters.Num() == 0)
+    {
+        return false;
+    }
+
+    // 월드 → 클립에 월드 행렬을 곱해 로컬 공간에서 검사. 평면 변환은 비균등 스케일에서도 정확함
+    const int32 NumFrustums = FMath::Min(View.ViewProjections.Num(), FClusterCullView::MaxViewProjections);
+    FPlane Planes[FClusterCullView::MaxViewProjections][NumCullPlanes];
+    for (int32 FrustumIndex = 0; FrustumIndex < NumFrustums; ++FrustumIndex)
+    {
+        const FMatrix LocalToClip = WorldMatrix * View.ViewProjections[FrustumIndex];
+        Planes[FrustumIndex][0] = MakeClipPlane(LocalToClip, 1.0f, 0.0f, 0.0f, 1.0f);     // Left
+        Planes[FrustumIndex][1] = MakeClipPlane(LocalToClip, -1.0f, 0.0f, 0.0f, 1.0f);    // Right
+        Planes[FrustumIndex][2] = MakeClipPlane(LocalToClip, 0.0f, 1.0f, 0.0f, 1.0f);     // Bottom
+        Planes[FrustumIndex][3] = MakeClipPlane(LocalToClip, 0.0f, -1.0f, 0.0f, 1.0f);    // Top
+    }
+
+    // 뒷면 판정의 시점(원근) 또는 시선 방향(직교)도 로컬 공간에서 구함
+    bool bBackfaceCulling = View.bBackfaceCulling && NumFrustums > 0;
+    bool bPerspective = false;
+    FVector ViewOrigin = FVector::ZeroVector;
+    FVector ViewDirection = FVector::ZeroVector;
+    if (bBackfaceCulling)
+    {
+        const FMatrix LocalToClip = WorldMatrix * View.ViewProjections[0];
+        const FVector C0 = GetColumn(LocalToClip, 0);
+        const FVector C1 = GetColumn(LocalToClip, 1);
+        const FVector C2 = GetColumn(LocalToClip, 2);
+        const FVector C3 = GetColumn(LocalToClip, 3);
+
+        bPerspective = C3.SquaredLength() > SMALL_NUMBER * SMALL_NUMBER;
+        if (bPerspective)
+        {
+            // 시점은 clip.x = clip.y = clip.w = 0인 점
+            const FVector C1xC3 = C1 ^ C3;
+            const float Determinant = C0 | C1xC3;
+            if (FMath::Abs(Determinant) > SMALL_NUMBER)
+            {
+                ViewOrigin = (C1xC3 * -LocalToClip.M[3][0] + (C3 ^ C0) * -LocalToClip.M[3][1] + (C0 ^ C1) * -LocalToClip.M[3][3]) / Determinant;
+            }
+            else
+            {
+                bBackfaceCulling = false;
+            }
+        }
+        else
+        {
+            // 투영 방향은 clip.x와 clip.y가 변하지 않는 방향, 부호는 깊이가 커지는 쪽
+            ViewDirection = C0 ^ C1;
+            if ((ViewDirection | C2) < 0.0f)
+            {
+                ViewDirection = -ViewDirection;
+            }
+            bBackfaceCulling = ViewDirection.Normalize();
+        }
+    }
+
+    // 월드 행렬이 뒤집혀 있으면 화면에서의 감김 방향도 뒤집힘
+    const float AxisSign = WorldMatrix.Determinant3x3() < 0.0f ? -1.0f : 1.0f;
+
+    // 오클루전 검사는 바운딩 구를 감싼 로컬 상자로 함
+    const FMatrix OcclusionLocalToClip = View.OcclusionTester ? WorldMatrix * View.OcclusionTester->GetViewProjection() : FMatrix::Identity;
+
+    FClusterCullStats Stats;
+    for (const FStaticMeshCluster& Cluster : RenderData.Clusters)
+    {
+        const int64 NumTriangles = Cluster.IndexCount / 3;
+        ++Stats.NumClusters;
+        Stats.NumTriangles += NumTriangles;
+
+        bool bInside = NumFrustums == 0;
+        for (int32 FrustumIndex = 0; FrustumIndex < NumFrustums && !bInside; ++FrustumIndex)
+        {
+            bInside = true;
+            for (int32 PlaneIndex = 0; PlaneIndex < NumCullPlanes; ++PlaneIndex)
+            {
+                if (Planes[FrustumIndex][PlaneIndex].PlaneDot(Cluster.Center) < -Cluster.Radius)
+                {
+                    bInside = false;
+                    break;
+                }
+            }
+        }
+
+        if (!bInside)
+        {
+            Stats.NumFrustumCulledTriangles += NumTriangles;
+            continue;
+        }
+
+        // 구 안의 모든 점에서 원뿔 안의 모든 노멀이 시점 반대쪽을 보면 컬링.
+        // 시선과 축의 각이 90도 - 반각 이하여야 하며, 구의 크기만큼 시선이 흔들리는 것까지 넣어 보수적으로 판정
+        if (bBackfaceCulling && Cluster.ConeCutoff < 1.0f)
+        {
+            const FVector Axis = Cluster.ConeAxis * AxisSign;
+            bool bBackfacing;
+            if (bPerspective)
+            {
+                const FVector ToCluster = Cluster.Center - ViewOrigin;
+                bBackfacing = (ToCluster | Axis) >= Cluster.ConeCutoff * (ToCluster.Length() + Cluster.Radius) + Cluster.Radius;
+            }
+            else
+            {
+                bBackfacing = (ViewDirection | Axis) >= Cluster.ConeCutoff;
+            }
+
+            if (bBackfacing)
+            {
+                Stats.NumBackfaceCulledTriangles += NumTriangles;
+                continue;
+            }
+        }
+
+        if (View.OcclusionTester)
+        {
+            const FVector Extent(Cluster.Radius, Cluster.Radius, Cluster.Radius);
+            if (View.OcclusionTester->IsBoxOccluded(OcclusionLocalToClip, Cluster.Center - Extent, Cluster.Center + Extent))
+            {
+                Stats.NumOcclusionCulledTriangles += NumTriangles;
+                continue;
+            }
+        }
+
+        ++Stats.NumVisibleClusters;
+
+        if (OutRanges.Num() > 0)
+        {
+            FClusterDrawRange& Last = OutRanges[OutRanges.Num() - 1];
+            if (Last.SubsetIndex == Cluster.SubsetIndex && Last.IndexStart + Last.IndexCount == Cluster.IndexStart)
+            {
+                Last.IndexCount += Cluster.IndexCount;
+                continue;
+            }
+        }
+
+        FClusterDrawRange Range;
+        Range.SubsetIndex = Cluster.SubsetIndex;
+        Range.IndexStart = Cluster.IndexStart;
+        Range.IndexCount = Cluster.IndexCount;
+        OutRanges.Add(Range);
+    }
+
+    Stats.NumDrawRanges = OutRanges.Num();
+    if (OutStats)
+    {
+        OutStats->Accumulate(Stats);
+    }
+    return true;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "Define.h"
+
+struct FMeshClusterSettings
+{
+    // 메시 셰이더 meshlet의 흔한 크기. 삼각형 124개면 인덱스가 372개라 128 * 3 안쪽
+    int32 MaxVertices = 64;
+    int32 MaxTriangles = 124;
+
+    // 삼각형이 MaxTriangles의 이 배수보다 적은 메시는 나누지 않음. 클러스터가 한두 개면 컬링할 것이 없음
+    int32 MinClustersPerMesh = 2;
+};
+
+/**
+ * 클러스터의 오클루전 검사
+ *
+ * 렌더러의 소프트웨어 오클루전 버퍼(FOcclusionBuffer)가 구현합니다. 메시 쪽은 이 인터페이스만 알고 렌더러 헤더에 의존하지 않습니다.
+ */
+class IClusterOcclusionTester
+{
+public:
+    virtual ~IClusterOcclusionTester() = default;
+
+    /** 월드 → 클립 행렬. 메시마다 로컬 → 클립 행렬을 한 번만 만들 때 씁니다. */
+    virtual const FMatrix& GetViewProjection() const = 0;
+
+    /** LocalToClip으로 옮긴 로컬 공간 상자가 확실히 가려졌으면 true. 여러 스레드에서 동시에 불릴 수 있습니다. */
+    virtual bool IsBoxOccluded(const FMatrix& LocalToClip, const FVector& LocalMin, const FVector& LocalMax) const = 0;
+};
+
+/**
+ * 클러스터 컬링에 쓰는 뷰
+ *
+ * ViewProjections는 월드 → 클립 행렬입니다. 여러 개면(CSM 캐스케이드, 점광원 큐브맵의 면) 하나라도 안에 있는 클러스터를 그립니다.
+ * 뒷면 판정은 첫 행렬의 시점(원근) 또는 방향(직교)을 쓰므로 모든 행렬의 시점 / 방향이 같아야 합니다.
+ */
+struct FClusterCullView
+{
+    static constexpr int32 MaxViewProjections = 8;
+
+    TArray<FMatrix> ViewProjections;
+
+    // 래스터라이저가 CULL_BACK일 때만 켬
+    bool bBackfaceCulling = true;
+
+    // 있으면 절두체와 뒷면 검사를 통과한 클러스터의 바운딩 상자를 검사 (카메라 뷰만, FSoftwareOcclusionCulling의 HiZ)
+    const IClusterOcclusionTester* OcclusionTester = nullptr;
+};
+
+// 서브셋 하나에서 이어서 그릴 인덱스 범위
+struct FClusterDrawRange
+{
+    uint32 SubsetIndex = 0;
+    uint32 IndexStart = 0;
+    uint32 IndexCount = 0;
+};
+
+struct FClusterCullStats
+{
+    int64 NumClusters = 0;
+    int64 NumVisibleClusters = 0;
+    int64 NumTriangles = 0;
+    int64 NumFrustumCulledTriangles = 0;
+    int64 NumBackfaceCulledTriangles = 0;
+    int64 NumOcclusionCulledTriangles = 0;
+    int64 NumDrawRanges = 0;
+
+    int64 GetNumCulledTriangles() const { return NumFrustumCulledTriangles + NumBackfaceCulledTriangles + NumOcclusionCulledTriangles; }
+    float GetCulledTriangleRatio() const { return NumTriangles > 0 ? static_cast<float>(GetNumCulledTriangles()) / static_cast<float>(NumTriangles) : 0.0f; }
+
+    void Accumulate(const FClusterCullStats& Other);
+};
+
+/**
+ * StaticMesh LOD0의 클러스터(meshlet) 생성과 CPU 컬링
+ *
+ * 임포트할 때 서브셋마다 삼각형을 인접한 것끼리 최대 MaxVertices 정점 / MaxTriangles 삼각형의 클러스터로 묶고,
+ * 클러스터의 삼각형이 이어지도록 서브셋 안의 인덱스 순서를 바꿉니다. 클러스터에는 바운딩 구와 면 노멀의 원뿔을 둡니다.
+ * 그릴 때는 뷰마다 절두체 밖이거나 모든 면이 뒷면인 클러스터를 빼고, 남은 범위를 이어 붙여 DrawIndexed로 그립니다.
+ */
+struct FMeshCluster
+{
+    /** 콘솔의 "meshlet on / off" */
+    static bool bCullingEnabled;
+
+    /** 마지막으로 "meshlet"을 실행한 뒤로 쌓인 카메라 / 그림자 뷰의 컬링 결과 */
+    static FClusterCullStats MainViewStats;
+    static FClusterCullStats ShadowViewStats;
+
+    /**
+     * Clusters를 새로 만들고 LOD0 인덱스를 클러스터 순서로 바꿉니다.
+     * 서브셋의 범위와 삼각형의 집합은 그대로이고, 한 클러스터 안에서는 원래 순서(정점 캐시 최적화 결과)를 유지합니다.
+     */
+    static void BuildClusters(FStaticMeshRenderData& RenderData, const FMeshClusterSettings& Settings = FMeshClusterSettings());
+
+    /**
+     * 보이는 클러스터의 인덱스 범위를 OutRanges에 채웁니다. 같은 서브셋에서 이어지는 범위는 합칩니다.
+     * @param WorldMatrix 로컬 → 월드. 클러스터 데이터는 로컬 공간이므로 뷰를 로컬 공간으로 옮겨 검사합니다.
+     * @param OutStats 있으면 결과를 더함
+     * @return 클러스터가 없어 메시 전체를 그려야 하면 false
+     */
+    static bool CullClusters(
+        const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, const FClusterCullView& View,
+        TArray<FClusterDrawRange>& OutRanges, FClusterCullStats* OutStats = nullptr
+    );
+};
@@ -0,0 +1,542 @@
+#include "MeshClusterTest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Math/JungleMath.h"
+#include "Math/MathUtility.h"
+#include "Math/Matrix.h"
+#include "TestMeshFixture.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    // 원뿔과 바운드를 확인할 때 float 오차 허용치
+    constexpr float BoundsTolerance = 1e-4f;
+
+    FVector GetPosition(const FStaticMeshRenderData& RenderData, uint32 Index)
+    {
+        const FStaticMeshVertex& Vertex = RenderData.Vertices[Index];
+        return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+    }
+
+    /** Count x Count 격자 위에 정점을 같이 쓰지 않는 사각형을 흩어 놓음. 방향은 고정된 난수 */
+    FStaticMeshRenderData MakeScatteredQuads(int32 Count)
+    {
+        FStaticMeshRenderData RenderData;
+        uint32 Seed = 12345;
+        auto Random = [&Seed]()
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            return static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+        };
+
+        for (int32 Y = 0; Y < Count; ++Y)
+        {
+            for (int32 X = 0; X < Count; ++X)
+            {
+                const FVector Center(static_cast<float>(X) * 3.0f, static_cast<float>(Y) * 3.0f, Random() * 2.0f);
+                FVector Normal(Random() * 2.0f - 1.0f, Random() * 2.0f - 1.0f, Random() * 2.0f - 1.0f);
+                if (!Normal.Normalize())
+                {
+                    Normal = FVector(0.0f, 0.0f, 1.0f);
+                }
+
+                const FVector Helper = FMath::Abs(Normal.Z) < 0.9f ? FVector(0.0f, 0.0f, 1.0f) : FVector(1.0f, 0.0f, 0.0f);
+                const FVector Tangent = (Helper ^ Normal).GetSafeNormal();
+                const FVector Bitangent = Normal ^ Tangent;
+
+                const uint32 Base = RenderData.Vertices.Num();
+                FTestMeshFixture::AddVertex(RenderData, Center - Tangent - Bitangent, Normal);
+                FTestMeshFixture::AddVertex(RenderData, Center + Tangent - Bitangent, Normal);
+                FTestMeshFixture::AddVertex(RenderData, Center + Tangent + Bitangent, Normal);
+                FTestMeshFixture::AddVertex(RenderData, Center - Tangent + Bitangent, Normal);
+                RenderData.Indices.Add(Base); RenderData.Indices.Add(Base + 1); RenderData.Indices.Add(Base + 2);
+                RenderData.Indices.Add(Base); RenderData.Indices.Add(Base + 2); RenderData.Indices.Add(Base + 3);
+            }
+        }
+
+        FTestMeshFixture::ComputeBounds(RenderData);
+        return RenderData;
+    }
+
+    void SplitSubsets(FStaticMeshRenderData& RenderData, int32 NumSubsets)
+    {
+        const int32 NumTriangles = RenderData.Indices.Num() / 3;
+        for (int32 SubsetIndex = 0; SubsetIndex < NumSubsets; ++SubsetIndex)
+        {
+            const int32 Begin = NumTriangles * SubsetIndex / NumSubsets;
+            const int32 End = NumTriangles * (SubsetIndex + 1) / NumSubsets;
+
+            FMaterialSubset Subset;
+            Subset.IndexStart = Begin * 3;
+            Subset.IndexCount = (End - Begin) * 3;
+            Subset.MaterialIndex = SubsetIndex;
+            RenderData.MaterialSubsets.Add(Subset);
+        }
+    }
+
+    struct FTriangleKey
+    {
+        uint32 A, B, C;
+
+        // 감김 방향을 지키는 회전만 허용
+        FTriangleKey(uint32 InA, uint32 InB, uint32 InC)
+        {
+            if (InB < InA && InB < InC)
+            {
+                A = InB; B = InC; C = InA;
+            }
+            else if (InC < InA && InC < InB)
+            {
+                A = InC; B = InA; C = InB;
+            }
+            else
+            {
+                A = InA; B = InB; C = InC;
+            }
+        }
+
+        bool operator<(const FTriangleKey& Other) const
+        {
+            if (A != Other.A) return A < Other.A;
+            if (B != Other.B) return B < Other.B;
+            return C < Other.C;
+        }
+
+        bool operator==(const FTriangleKey& Other) const
+        {
+            return A == Other.A && B == Other.B && C == Other.C;
+        }
+    };
+
+    void GetSortedTriangles(const TArray<UINT>& Indices, uint32 IndexStart, uint32 IndexCount, TArray<FTriangleKey>& OutTriangles)
+    {
+        OutTriangles.Empty();
+        for (uint32 Index = IndexStart; Index < IndexStart + IndexCount; Index += 3)
+        {
+            OutTriangles.Add(FTriangleKey(Indices[Index], Indices[Index + 1], Indices[Index + 2]));
+        }
+        OutTriangles.Sort();
+    }
+
+    struct FTestView
+    {
+        FMatrix ViewProjection;
+        FVector Origin;             // 원근
+        FVector Direction;          // 직교. 시점에서 장면 쪽
+        bool bPerspective = true;
+    };
+
+    FTestView MakeView(const FVector& Origin, const FVector& Target, float Radius, bool bPerspective)
+    {
+        const FVector Forward = (Target - Origin).GetSafeNormal();
+        const FVector Up = FMath::Abs(Forward.Z) > 0.99f ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 0.0f, 1.0f);
+
+        FTestView View;
+        View.Origin = Origin;
+        View.Direction = Forward;
+        View.bPerspective = bPerspective;
+
+        const FMatrix ViewMatrix = JungleMath::CreateViewMatrix(Origin, Target, Up);
+        const float Far = (Target - Origin).Length() + Radius * 4.0f;
+        const FMatrix Projection = bPerspective
+            ? JungleMath::CreateProjectionMatrix(PI / 3.0f, 1.0f, Radius * 0.01f, Far)
+            : JungleMath::CreateOrthoProjectionMatrix(Radius * 2.0f, Radius * 2.0f, Radius * 0.01f, Far);
+        View.ViewProjection = ViewMatrix * Projection;
+        return View;
+    }
+
+    /** 삼각형이 화면 밖(한 옆 평면의 바깥)이거나 앞면이 아니면 false */
+    bool IsTriangleVisible(const FVector World[3], const FTestView& View)
+    {
+        FVector4 Clip[3];
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            Clip[Corner] = View.ViewProjection.TransformFVector4(FVector4(World[Corner], 1.0f));
+        }
+
+        auto AllOutside = [&Clip](float SX, float SY)
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (SX * Clip[Corner].X + SY * Clip[Corner].Y + Clip[Corner].W >= 0.0f)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        if (AllOutside(1.0f, 0.0f) || AllOutside(-1.0f, 0.0f) || AllOutside(0.0f, 1.0f) || AllOutside(0.0f, -1.0f))
+        {
+            return false;
+        }
+
+        const FVector Normal = (World[1] - World[0]) ^ (World[2] - World[0]);
+        const FVector ToView = View.bPerspective ? View.Origin - World[0] : -View.Direction;
+
+        // 옆으로 선 삼각형은 float 오차로 어느 쪽이든 나올 수 있음
+        return (Normal | ToView) > Normal.Length() * ToView.Length() * 1e-4f;
+    }
+
+    /**
+     * 원점의 반지름 1인 구를 +X 쪽 거리 3에서 볼 때 빠진 삼각형이 모두 먼 쪽 반구(X < 1/3)에 있는지 확인합니다.
+     * 구 전체가 절두체 안이므로 빠진 것은 모두 뒷면입니다. 감기 방향이 뒤집힌 구는 비율은 같지만 가까운 쪽이 빠집니다.
+     */
+    bool CheckSphereFarSideCulled(const FStaticMeshRenderData& Sphere, TArray<FString>& OutFailures)
+    {
+        // 가장자리 근처의 뒷면 삼각형은 중심이 경계를 삼각형 크기 정도 넘을 수 있음
+        constexpr float HorizonX = 1.0f / 3.0f;
+        constexpr float HorizonTolerance = 0.05f;
+
+        const FTestView View = MakeView(FVector(3.0f, 0.0f, 0.0f), FVector::ZeroVector, 1.0f, true);
+        FClusterCullView CullView;
+        CullView.ViewProjections.Add(View.ViewProjection);
+
+        TArray<FClusterDrawRange> Ranges;
+        FMeshCluster::CullClusters(Sphere, FMatrix::Identity, CullView, Ranges);
+
+        TArray<uint8> Drawn;
+        Drawn.Init(0, Sphere.Indices.Num() / 3);
+        for (const FClusterDrawRange& Range : Ranges)
+        {
+            for (uint32 Index = Range.IndexStart; Index < Range.IndexStart + Range.IndexCount; Index += 3)
+            {
+                Drawn[Index / 3] = 1;
+            }
+        }
+
+        int32 NumCulled = 0;
+        for (int32 Triangle = 0; Triangle < Drawn.Num(); ++Triangle)
+        {
+            if (Drawn[Triangle])
+            {
+                continue;
+            }
+
+            ++NumCulled;
+            const float CenterX = (GetPosition(Sphere, Sphere.Indices[Triangle * 3]).X
+                + GetPosition(Sphere, Sphere.Indices[Triangle * 3 + 1]).X
+                + GetPosition(Sphere, Sphere.Indices[Triangle * 3 + 2]).X) / 3.0f;
+            if (CenterX > HorizonX + HorizonTolerance)
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s: triangle %d on the near side culled as backfacing (x %.3f)"), *Sphere.DisplayName, Triangle, CenterX));
+                return false;
+            }
+        }
+
+        if (NumCulled == 0)
+        {
+            OutFailures.Add(Sphere.DisplayName + TEXT(": nothing culled on the far side"));
+            return false;
+        }
+        return true;
+    }
+}
+
+bool FMeshClusterTest::Validate(
+    const FStaticMeshRenderData& RenderData, const TArray<UINT>& OriginalIndices, const FMeshClusterSettings& Settings, TArray<FString>& OutFailures
+)
+{
+    const int32 NumFailuresBefore = OutFailures.Num();
+    const FString& Name = RenderData.DisplayName;
+
+    if (RenderData.Indices.Num() != OriginalIndices.Num())
+    {
+        OutFailures.Add(Name + TEXT(": index count changed"));
+        return false;
+    }
+
+    // 나누지 않은 메시는 인덱스가 그대로여야 함
+    if (RenderData.Clusters.Num() == 0)
+    {
+        if (!std::equal(OriginalIndices.begin(), OriginalIndices.end(), RenderData.Indices.begin(), RenderData.Indices.end()))
+        {
+            OutFailures.Add(Name + TEXT(": indices changed without clusters"));
+            return false;
+        }
+        return true;
+    }
+
+    TArray<FMaterialSubset> Subsets = RenderData.MaterialSubsets;
+    if (Subsets.Num() == 0)
+    {
+        FMaterialSubset Subset;
+        Subset.IndexStart = 0;
+        Subset.IndexCount = RenderData.Indices.Num();
+        Subsets.Add(Subset);
+    }
+
+    // 클러스터가 서브셋 순서로 서브셋 범위를 빈틈없이 나누는지
+    int32 ClusterIndex = 0;
+    for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+    {
+        const FMaterialSubset& Subset = Subsets[SubsetIndex];
+        uint32 Cursor = Subset.IndexStart;
+        for (; ClusterIndex < RenderData.Clusters.Num() && RenderData.Clusters[ClusterIndex].SubsetIndex == static_cast<uint32>(SubsetIndex); ++ClusterIndex)
+        {
+            const FStaticMeshCluster& Cluster = RenderData.Clusters[ClusterIndex];
+            if (Cluster.IndexStart != Cursor || Cluster.IndexCount == 0 || Cluster.IndexCount % 3 != 0)
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s: cluster %d does not continue its subset"), *Name, ClusterIndex));
+                return false;
+            }
+            Cursor += Cluster.IndexCount;
+        }
+
+        if (Cursor != Subset.IndexStart + Subset.IndexCount)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: clusters do not cover subset %d"), *Name, SubsetIndex));
+            return false;
+        }
+
+        // 서브셋의 삼각형 집합과 감김 방향이 그대로인지
+        TArray<FTriangleKey> Before, After;
+        GetSortedTriangles(OriginalIndices, Subset.IndexStart, Subset.IndexCount, Before);
+        GetSortedTriangles(RenderData.Indices, Subset.IndexStart, Subset.IndexCount, After);
+        if (!std::equal(Before.begin(), Before.end(), After.begin(), After.end()))
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: triangles of subset %d changed"), *Name, SubsetIndex));
+        }
+    }
+
+    if (ClusterIndex != RenderData.Clusters.Num())
+    {
+        OutFailures.Add(FString::Printf(TEXT("%s: clusters out of subset order"), *Name));
+        return false;
+    }
+
+    for (int32 Index = 0; Index < RenderData.Clusters.Num(); ++Index)
+    {
+        const FStaticMeshCluster& Cluster = RenderData.Clusters[Index];
+
+        TArray<uint32> UniqueVertices;
+        for (uint32 Offset = 0; Offset < Cluster.IndexCount; ++Offset)
+        {
+            UniqueVertices.Add(RenderData.Indices[Cluster.IndexStart + Offset]);
+        }
+        UniqueVertices.Sort();
+        const int32 NumUniqueVertices = static_cast<int32>(std::unique(UniqueVertices.begin(), UniqueVertices.end()) - UniqueVertices.begin());
+
+        if (static_cast<int32>(Cluster.IndexCount / 3) > Settings.MaxTriangles || NumUniqueVertices > Settings.MaxVertices)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: cluster %d exceeds limits (%u triangles, %d vertices)"), *Name, Index, Cluster.IndexCount / 3, NumUniqueVertices));
+        }
+        if (static_cast<int32>(Cluster.NumVertices) != NumUniqueVertices)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: cluster %d reports %u vertices, has %d"), *Name, Index, Cluster.NumVertices, NumUniqueVertices));
+        }
+
+        const float Tolerance = BoundsTolerance * FMath::Max(Cluster.Radius, 1.0f);
+        const float MinDot = std::sqrt(FMath::Max(0.0f, 1.0f - Cluster.ConeCutoff * Cluster.ConeCutoff));
+        for (uint32 Offset = 0; Offset < Cluster.IndexCount; Offset += 3)
+        {
+            const uint32* Triangle = &RenderData.Indices[Cluster.IndexStart + Offset];
+            const FVector A = GetPosition(RenderData, Triangle[0]);
+            const FVector B = GetPosition(RenderData, Triangle[1]);
+            const FVector C = GetPosition(RenderData, Triangle[2]);
+
+            for (const FVector& Position : { A, B, C })
+            {
+                if ((Position - Cluster.Center).Length() > Cluster.Radius + Tolerance)
+                {
+                    OutFailures.Add(FString::Printf(TEXT("%s: cluster %d bounding sphere misses a vertex"), *Name, Index));
+                    return false;
+                }
+            }
+
+            const FVector Normal = ((B - A) ^ (C - A)).GetSafeNormal();
+            if (Cluster.ConeCutoff < 1.0f && !Normal.IsNearlyZero() && (Normal | Cluster.ConeAxis) < MinDot - BoundsTolerance)
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s: cluster %d normal cone misses a triangle"), *Name, Index));
+                return false;
+            }
+        }
+    }
+
+    return OutFailures.Num() == NumFailuresBefore;
+}
+
+bool FMeshClusterTest::MeasureCulling(const FStaticMeshRenderData& RenderData, FClusterCullStats& OutStats, TArray<FString>& OutFailures)
+{
+    if (RenderData.Clusters.Num() == 0)
+    {
+        return true;
+    }
+
+    const FVector Center = (RenderData.BoundingBoxMin + RenderData.BoundingBoxMax) * 0.5f;
+    const float Radius = FMath::Max((RenderData.BoundingBoxMax - RenderData.BoundingBoxMin).Length() * 0.5f, KINDA_SMALL_NUMBER);
+
+    // 축 6개와 대각선 8개 방향
+    TArray<FVector> Directions;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        for (float Sign : { -1.0f, 1.0f })
+        {
+            FVector Direction = FVector::ZeroVector;
+            (Axis == 0 ? Direction.X : Axis == 1 ? Direction.Y : Direction.Z) = Sign;
+            Directions.Add(Direction);
+        }
+    }
+    for (int32 Corner = 0; Corner < 8; ++Corner)
+    {
+        Directions.Add(FVector(Corner & 1 ? 1.0f : -1.0f, Corner & 2 ? 1.0f : -1.0f, Corner & 4 ? 1.0f : -1.0f).GetSafeNormal());
+    }
+
+    // 비균등 스케일에 뒤집힌 월드 행렬도 확인
+    const FMatrix Worlds[2] = {
+        FMatrix::Identity,
+        FMatrix::CreateScaleMatrix(1.5f, -0.5f, 2.0f) * FMatrix::CreateTranslationMatrix(FVector(10.0f, -20.0f, 5.0f)),
+    };
+    const float WorldScales[2] = { 1.0f, 2.0f };
+
+    TArray<FClusterDrawRange> Ranges;
+    TArray<uint8> Drawn;
+
+    for (int32 WorldIndex = 0; WorldIndex < 2; ++WorldIndex)
+    {
+        const FMatrix& World = Worlds[WorldIndex];
+        const FVector WorldCenter = World.TransformPosition(Center);
+        const float WorldRadius = Radius * WorldScales[WorldIndex];
+
+        TArray<FTestView> Views;
+        for (const FVector& Direction : Directions)
+        {
+            Views.Add(MakeView(WorldCenter + Direction * (WorldRadius * 3.0f), WorldCenter, WorldRadius, true));
+            Views.Add(MakeView(WorldCenter + Direction * (WorldRadius * 1.2f), WorldCenter, WorldRadius, true));
+            Views.Add(MakeView(WorldCenter + Direction * (WorldRadius * 2.0f), WorldCenter, WorldRadius, false));
+
+            // 메시 옆을 보게 해서 절두체 경계에 걸치게 함
+            const FVector Side = (Direction ^ (FMath::Abs(Direction.Z) > 0.99f ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 0.0f, 1.0f))).GetSafeNormal();
+            const FVector Origin = WorldCenter + Direction * (WorldRadius * 1.5f);
+            Views.Add(MakeView(Origin, Origin + Side * WorldRadius - Direction * WorldRadius, WorldRadius, true));
+        }
+
+        for (const FTestView& View : Views)
+        {
+            FClusterCullView CullView;
+            CullView.ViewProjections.Add(View.ViewProjection);
+            FMeshCluster::CullClusters(RenderData, World, CullView, Ranges, &OutStats);
+
+            Drawn.Init(0, RenderData.Indices.Num() / 3);
+            for (const FClusterDrawRange& Range : Ranges)
+            {
+                for (uint32 Index = Range.IndexStart; Index < Range.IndexStart + Range.IndexCount; Index += 3)
+                {
+                    Drawn[Index / 3] = 1;
+                }
+            }
+
+            // 그리지 않은 삼각형 중 보이는 것이 있으면 실패
+            for (int32 Triangle = 0; Triangle < Drawn.Num(); ++Triangle)
+            {
+                if (Drawn[Triangle])
+                {
+                    continue;
+                }
+
+                FVector WorldPositions[3];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    WorldPositions[Corner] = World.TransformPosition(GetPosition(RenderData, RenderData.Indices[Triangle * 3 + Corner]));
+                }
+
+                if (IsTriangleVisible(WorldPositions, View))
+                {
+                    OutFailures.Add(FString::Printf(
+                        TEXT("%s: visible triangle %d culled (%s view, world %d)"), *RenderData.DisplayName, Triangle, View.bPerspective ? TEXT("perspective") : TEXT("orthographic"), WorldIndex
+                    ));
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool FMeshClusterTest::Run(TArray<FMeshClusterTestResult>& OutResults, TArray<FString>& OutFailures)
+{
+    const int32 NumFailuresBefore = OutFailures.Num();
+    const FMeshClusterSettings Settings;
+
+    auto RunCase = [&](FStaticMeshRenderData& RenderData, const FString& Name) -> FMeshClusterTestResult&
+    {
+        RenderData.DisplayName = Name;
+        const TArray<UINT> OriginalIndices = RenderData.Indices;
+
+        FMeshClusterTestResult& Result = OutResults[OutResults.Add(FMeshClusterTestResult())];
+        Result.Name = Name;
+        Result.NumTriangles = RenderData.Indices.Num() / 3;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FMeshCluster::BuildClusters(RenderData, Settings);
+        Result.BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        Result.NumClusters = RenderData.Clusters.Num();
+        for (const FStaticMeshCluster& Cluster : RenderData.Clusters)
+        {
+            Result.AverageTriangles += static_cast<float>(Cluster.IndexCount / 3);
+            Result.AverageVertices += static_cast<float>(Cluster.NumVertices);
+        }
+        if (Result.NumClusters > 0)
+        {
+            Result.AverageTriangles /= static_cast<float>(Result.NumClusters);
+            Result.AverageVertices /= static_cast<float>(Result.NumClusters);
+        }
+
+        if (Validate(RenderData, OriginalIndices, Settings, OutFailures))
+        {
+            MeasureCulling(RenderData, Result.CullStats, OutFailures);
+        }
+        return Result;
+    };
+
+    // 구: 바깥에서 보면 대략 절반이 뒷면이고, 빠지는 쪽은 시점 반대편
+    {
+        FStaticMeshRenderData Sphere = FTestMeshFixture::MakeSphere(96, 48);
+        const FMeshClusterTestResult& Result = RunCase(Sphere, TEXT("Sphere"));
+        CheckSphereFarSideCulled(Sphere, OutFailures);
+
+        const float BackfaceRatio = Result.CullStats.NumTriangles > 0
+            ? static_cast<float>(Result.CullStats.NumBackfaceCulledTriangles) / static_cast<float>(Result.CullStats.NumTriangles)
+            : 0.0f;
+        if (BackfaceRatio < MinSphereBackfaceRatio)
+        {
+            OutFailures.Add(FString::Printf(TEXT("Sphere: only %.1f%% of triangles culled as backfacing"), BackfaceRatio * 100.0f));
+        }
+        if (Result.AverageTriangles < Settings.MaxTriangles * 0.5f)
+        {
+            OutFailures.Add(FString::Printf(TEXT("Sphere: clusters are too small (%.1f triangles on average)"), Result.AverageTriangles));
+        }
+    }
+
+    // 서브셋 경계를 넘지 않는지
+    {
+        FStaticMeshRenderData Sphere = FTestMeshFixture::MakeSphere(96, 48);
+        SplitSubsets(Sphere, 3);
+        RunCase(Sphere, TEXT("Sphere (3 subsets)"));
+    }
+
+    // 이어진 삼각형이 없을 때 가까운 조각을 모으는지
+    {
+        FStaticMeshRenderData Quads = MakeScatteredQuads(40);
+        const FMeshClusterTestResult& Result = RunCase(Quads, TEXT("Scattered quads"));
+        if (Result.AverageVertices < Settings.MaxVertices * 0.5f)
+        {
+            OutFailures.Add(FString::Printf(TEXT("Scattered quads: clusters are too small (%.1f vertices on average)"), Result.AverageVertices));
+        }
+    }
+
+    // 작은 메시는 나누지 않음
+    {
+        FStaticMeshRenderData Small = FTestMeshFixture::MakeSphere(8, 6);
+        const TArray<UINT> OriginalIndices = Small.Indices;
+        const FMeshClusterTestResult& Result = RunCase(Small, TEXT("Small mesh"));
+        if (Result.NumClusters != 0 || !std::equal(OriginalIndices.begin(), OriginalIndices.end(), Small.Indices.begin(), Small.Indices.end()))
+        {
+            OutFailures.Add(TEXT("Small mesh: should not be split into clusters"));
+        }
+    }
+
+    return OutFailures.Num() == NumFailuresBefore;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "MeshCluster.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FMeshClusterTestResult
+{
+    FString Name;
+    int32 NumTriangles = 0;
+    int32 NumClusters = 0;
+    float AverageTriangles = 0.0f;     // 클러스터당
+    float AverageVertices = 0.0f;
+
+    FClusterCullStats CullStats;        // MeasureCulling의 모든 뷰를 더한 값
+    double BuildMs = 0.0;
+};
+
+/**
+ * FMeshCluster 검증. 콘솔의 "meshlet test"에서 호출합니다.
+ * 절차적으로 만든 구 / 서브셋이 나뉜 구 / 떨어진 사각형 조각을 나눠 클러스터의 한도와 범위, 삼각형 보존, 바운드와 원뿔을 확인하고,
+ * 메시를 둘러싼 뷰에서 컬링한 결과가 보수적인지(보이는 삼각형을 버리지 않는지) 확인합니다.
+ */
+struct FMeshClusterTest
+{
+    /** 구를 바깥에서 볼 때 뒷면으로 빠져야 하는 삼각형 비율의 하한 */
+    static constexpr float MinSphereBackfaceRatio = 0.2f;
+
+    static bool Run(TArray<FMeshClusterTestResult>& OutResults, TArray<FString>& OutFailures);
+
+    /**
+     * BuildClusters 결과를 확인합니다.
+     * @param OriginalIndices BuildClusters 전의 LOD0 인덱스
+     */
+    static bool Validate(
+        const FStaticMeshRenderData& RenderData, const TArray<UINT>& OriginalIndices, const FMeshClusterSettings& Settings, TArray<FString>& OutFailures
+    );
+
+    /**
+     * 메시를 둘러싼 원근 / 직교 뷰와 뒤집힌 월드 행렬로 컬링해 OutStats에 더합니다.
+     * 컬링된 클러스터의 삼각형이 모두 화면 밖이거나 뒷면인지 삼각형 단위로 확인하며, -meshopt 리포트에서도 씁니다.
+     */
+    static bool MeasureCulling(const FStaticMeshRenderData& RenderData, FClusterCullStats& OutStats, TArray<FString>& OutFailures);
+};
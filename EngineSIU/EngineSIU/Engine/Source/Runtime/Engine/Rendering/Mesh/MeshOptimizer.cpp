@@ -0,0 +1,476 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr uint32 InvalidIndex = UINT32_MAX;
+
+    /**
+     * 타임스탬프로 구현한 FIFO 캐시
+     * 미스가 날 때만 Timestamp가 늘어나므로, 마지막으로 들어온 시각이 CacheSize 이내면 아직 캐시에 있습니다.
+     */
+    struct FFifoVertexCache
+    {
+        FFifoVertexCache(int32 NumVertices, int32 InCacheSize)
+            : CacheSize(static_cast<uint32>(InCacheSize))
+            , Timestamp(static_cast<uint32>(InCacheSize) + 1)
+        {
+            EntryTimes.Init(0, NumVertices);
+        }
+
+        /** @return 미스면 true */
+        bool Access(uint32 Vertex)
+        {
+            if (Timestamp - EntryTimes[Vertex] > CacheSize)
+            {
+                EntryTimes[Vertex] = Timestamp++;
+                return true;
+            }
+            return false;
+        }
+
+        int32 AccessTriangle(const uint32* Triangle)
+        {
+            return static_cast<int32>(Access(Triangle[0])) + static_cast<int32>(Access(Triangle[1])) + static_cast<int32>(Access(Triangle[2]));
+        }
+
+        void Flush()
+        {
+            Timestamp += CacheSize + 1;
+        }
+
+        uint32 CacheSize;
+        uint32 Timestamp;
+        TArray<uint32> EntryTimes;
+    };
+
+    FVector GetPosition(const float* Positions, uint32 PositionStride, uint32 Vertex)
+    {
+        const float* Position = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Positions) + static_cast<size_t>(Vertex) * PositionStride);
+        return FVector(Position[0], Position[1], Position[2]);
+    }
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeVertexCache(const uint32* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize)
+{
+    FVertexCacheStats Stats;
+    Stats.NumTriangles = NumIndices / 3;
+    if (Stats.NumTriangles == 0 || !IsValidIndexBuffer(Indices, NumIndices, NumVertices))
+    {
+        return Stats;
+    }
+
+    FFifoVertexCache Cache(NumVertices, CacheSize);
+    TArray<uint8> bReferenced;
+    bReferenced.Init(0, NumVertices);
+    for (int32 Index = 0; Index < Stats.NumTriangles * 3; ++Index)
+    {
+        const uint32 Vertex = Indices[Index];
+        Stats.NumCacheMisses += Cache.Access(Vertex) ? 1 : 0;
+        if (!bReferenced[Vertex])
+        {
+            bReferenced[Vertex] = 1;
+            ++Stats.NumVertices;
+        }
+    }
+
+    Stats.ACMR = static_cast<float>(Stats.NumCacheMisses) / static_cast<float>(Stats.NumTriangles);
+    Stats.ATVR = static_cast<float>(Stats.NumCacheMisses) / static_cast<float>(Stats.NumVertices);
+    return Stats;
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize)
+{
+    const int32 NumTriangles = NumIndices / 3;
+    if (NumTriangles == 0)
+    {
+        return;
+    }
+
+    // 정점 → 그 정점을 쓰는 삼각형 목록
+    TArray<uint32> AdjacencyOffsets;
+    AdjacencyOffsets.Init(0, NumVertices + 1);
+    for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+    {
+        ++AdjacencyOffsets[Indices[Index] + 1];
+    }
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        AdjacencyOffsets[Vertex + 1] += AdjacencyOffsets[Vertex];
+    }
+
+    TArray<uint32> Adjacency;
+    Adjacency.SetNum(NumTriangles * 3);
+    TArray<uint32> FillOffsets = AdjacencyOffsets;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            Adjacency[FillOffsets[Indices[Triangle * 3 + Corner]]++] = Triangle;
+        }
+    }
+
+    // 아직 내보내지 않은 삼각형 수
+    TArray<int32> LiveTriangles;
+    LiveTriangles.SetNum(NumVertices);
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        LiveTriangles[Vertex] = static_cast<int32>(AdjacencyOffsets[Vertex + 1] - AdjacencyOffsets[Vertex]);
+    }
+
+    TArray<uint32> CacheTimes;
+    CacheTimes.Init(0, NumVertices);
+    uint32 Timestamp = static_cast<uint32>(CacheSize) + 1;
+
+    TArray<uint8> bEmitted;
+    bEmitted.Init(0, NumTriangles);
+
+    // 최근에 내보낸 정점. 막다른 곳에 이르면 여기서 다음 팬 정점을 찾음
+    TArray<uint32> DeadEndStack;
+    DeadEndStack.SetNum(NumTriangles * 3);
+    int32 DeadEndTop = 0;
+
+    TArray<uint32> Candidates;
+    Candidates.Reserve(64);
+
+    TArray<uint32> Output;
+    Output.SetNum(NumTriangles * 3);
+    int32 NumOutput = 0;
+
+    int32 Cursor = 0;
+    int32 Fanning = static_cast<int32>(Indices[0]);
+    while (Fanning >= 0)
+    {
+        // 팬 정점에 붙은 삼각형을 모두 내보냄
+        Candidates.Empty();
+        for (uint32 Offset = AdjacencyOffsets[Fanning]; Offset < AdjacencyOffsets[Fanning + 1]; ++Offset)
+        {
+            const uint32 Triangle = Adjacency[Offset];
+            if (bEmitted[Triangle])
+            {
+                continue;
+            }
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Vertex = Indices[Triangle * 3 + Corner];
+                Output[NumOutput++] = Vertex;
+                DeadEndStack[DeadEndTop++] = Vertex;
+                Candidates.Add(Vertex);
+                --LiveTriangles[Vertex];
+                if (Timestamp - CacheTimes[Vertex] > static_cast<uint32>(CacheSize))
+                {
+                    CacheTimes[Vertex] = Timestamp++;
+                }
+            }
+            bEmitted[Triangle] = 1;
+        }
+
+        // 남은 삼각형을 모두 그려도 캐시에 남아 있을 정점 중 가장 오래된 것을 고름
+        int32 Next = -1;
+        int32 BestPriority = -1;
+        for (const uint32 Vertex : Candidates)
+        {
+            if (LiveTriangles[Vertex] <= 0)
+            {
+                continue;
+            }
+
+            int32 Priority = 0;
+            const int32 Age = static_cast<int32>(Timestamp - CacheTimes[Vertex]);
+            if (Age + 2 * LiveTriangles[Vertex] <= CacheSize)
+            {
+                Priority = Age;
+            }
+            if (Priority > BestPriority)
+            {
+                BestPriority = Priority;
+                Next = static_cast<int32>(Vertex);
+            }
+        }
+
+        if (Next < 0)
+        {
+            // 막다른 곳: 최근 정점, 그래도 없으면 아직 삼각형이 남은 다음 정점
+            while (DeadEndTop > 0 && Next < 0)
+            {
+                const uint32 Vertex = DeadEndStack[--DeadEndTop];
+                if (LiveTriangles[Vertex] > 0)
+                {
+                    Next = static_cast<int32>(Vertex);
+                }
+            }
+            while (Next < 0 && Cursor < NumVertices)
+            {
+                if (LiveTriangles[Cursor] > 0)
+                {
+                    Next = Cursor;
+                }
+                else
+                {
+                    ++Cursor;
+                }
+            }
+        }
+
+        Fanning = Next;
+    }
+
+    std::copy_n(Output.GetData(), NumOutput, Indices);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(
+    uint32* Indices, int32 NumIndices, const float* Positions, int32 NumVertices, uint32 PositionStride, float Threshold, int32 CacheSize
+)
+{
+    const int32 NumTriangles = NumIndices / 3;
+    if (NumTriangles < 2)
+    {
+        return;
+    }
+
+    FFifoVertexCache Cache(NumVertices, CacheSize);
+
+    // 하드 경계: 세 정점이 모두 미스인 삼각형, 즉 Tipsify가 캐시를 버리고 건너뛴 곳
+    TArray<int32> HardBoundaries;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        if (Cache.AccessTriangle(&Indices[Triangle * 3]) == 3 || Triangle == 0)
+        {
+            HardBoundaries.Add(Triangle);
+        }
+    }
+    HardBoundaries.Add(NumTriangles);
+
+    // 소프트 경계: 빈 캐시로 시작해도 ACMR이 하드 클러스터의 Threshold배 이내가 되는 가장 짧은 구간
+    TArray<int32> Clusters;
+    for (int32 HardIndex = 0; HardIndex + 1 < HardBoundaries.Num(); ++HardIndex)
+    {
+        const int32 Start = HardBoundaries[HardIndex];
+        const int32 End = HardBoundaries[HardIndex + 1];
+
+        Cache.Flush();
+        int32 ClusterMisses = 0;
+        for (int32 Triangle = Start; Triangle < End; ++Triangle)
+        {
+            ClusterMisses += Cache.AccessTriangle(&Indices[Triangle * 3]);
+        }
+        const float MaxMissesPerTriangle = Threshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Start);
+
+        Cache.Flush();
+        Clusters.Add(Start);
+        int32 RunStart = Start;
+        int32 RunMisses = 0;
+        for (int32 Triangle = Start; Triangle < End - 1; ++Triangle)
+        {
+            RunMisses += Cache.AccessTriangle(&Indices[Triangle * 3]);
+            if (static_cast<float>(RunMisses) <= MaxMissesPerTriangle * static_cast<float>(Triangle + 1 - RunStart))
+            {
+                Cache.Flush();
+                Clusters.Add(Triangle + 1);
+                RunStart = Triangle + 1;
+                RunMisses = 0;
+            }
+        }
+    }
+    Clusters.Add(NumTriangles);
+
+    const int32 NumClusters = Clusters.Num() - 1;
+    if (NumClusters < 2)
+    {
+        return;
+    }
+
+    // 클러스터의 면적 가중 중심과 법선
+    TArray<FVector> ClusterCentroids;
+    TArray<FVector> ClusterNormals;
+    ClusterCentroids.Init(FVector::ZeroVector, NumClusters);
+    ClusterNormals.Init(FVector::ZeroVector, NumClusters);
+    TArray<float> ClusterAreas;
+    ClusterAreas.Init(0.0f, NumClusters);
+
+    FVector MeshCentroid = FVector::ZeroVector;
+    float MeshArea = 0.0f;
+    for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+    {
+        for (int32 Triangle = Clusters[ClusterIndex]; Triangle < Clusters[ClusterIndex + 1]; ++Triangle)
+        {
+            const FVector P0 = GetPosition(Positions, PositionStride, Indices[Triangle * 3 + 0]);
+            const FVector P1 = GetPosition(Positions, PositionStride, Indices[Triangle * 3 + 1]);
+            const FVector P2 = GetPosition(Positions, PositionStride, Indices[Triangle * 3 + 2]);
+
+            const FVector Cross = (P1 - P0) ^ (P2 - P0);
+            const float Area = Cross.Length();
+            const FVector Center = (P0 + P1 + P2) / 3.0f;
+
+            ClusterCentroids[ClusterIndex] += Center * Area;
+            ClusterNormals[ClusterIndex] += Cross;
+            ClusterAreas[ClusterIndex] += Area;
+            MeshCentroid += Center * Area;
+            MeshArea += Area;
+        }
+    }
+    if (MeshArea > 0.0f)
+    {
+        MeshCentroid = MeshCentroid / MeshArea;
+    }
+
+    // 중심에서 바깥을 향하는 정도. 바깥을 향한 클러스터가 안쪽 면을 가릴 가능성이 높으므로 먼저 그림
+    TArray<float> SortKeys;
+    SortKeys.SetNum(NumClusters);
+    for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+    {
+        const FVector Centroid = ClusterAreas[ClusterIndex] > 0.0f ? ClusterCentroids[ClusterIndex] / ClusterAreas[ClusterIndex] : MeshCentroid;
+        SortKeys[ClusterIndex] = (Centroid - MeshCentroid) | ClusterNormals[ClusterIndex].GetSafeNormal();
+    }
+
+    TArray<int32> Order;
+    Order.SetNum(NumClusters);
+    for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+    {
+        Order[ClusterIndex] = ClusterIndex;
+    }
+    std::stable_sort(Order.begin(), Order.end(), [&SortKeys](int32 A, int32 B) { return SortKeys[A] > SortKeys[B]; });
+
+    TArray<uint32> Sorted;
+    Sorted.SetNum(NumTriangles * 3);
+    int32 NumSorted = 0;
+    for (const int32 ClusterIndex : Order)
+    {
+        const int32 Begin = Clusters[ClusterIndex] * 3;
+        const int32 End = Clusters[ClusterIndex + 1] * 3;
+        std::copy(Indices + Begin, Indices + End, Sorted.GetData() + NumSorted);
+        NumSorted += End - Begin;
+    }
+    std::copy_n(Sorted.GetData(), NumSorted, Indices);
+}
+
+void FMeshOptimizer::OptimizeTriangleOrder(
+    uint32* Indices, int32 NumIndices, const TArray<FMaterialSubset>& Subsets, const float* Positions, int32 NumVertices, uint32 PositionStride
+)
+{
+    if (!IsValidIndexBuffer(Indices, NumIndices, NumVertices))
+    {
+        return;
+    }
+
+    // 서브셋이 없으면 전체를 하나로 봄
+    TArray<std::pair<uint32, uint32>> Ranges;
+    if (Subsets.Num() == 0)
+    {
+        Ranges.Add({ 0, static_cast<uint32>(NumIndices) });
+    }
+    else
+    {
+        for (const FMaterialSubset& Subset : Subsets)
+        {
+            Ranges.Add({ Subset.IndexStart, Subset.IndexCount });
+        }
+        Ranges.Sort([](const std::pair<uint32, uint32>& A, const std::pair<uint32, uint32>& B) { return A.first < B.first; });
+
+        // 삼각형 단위가 아니거나 겹치는 서브셋이면 순서를 바꿀 수 없음
+        uint32 PreviousEnd = 0;
+        for (const auto& [Start, Count] : Ranges)
+        {
+            if (Start % 3 != 0 || Count % 3 != 0 || Start < PreviousEnd || static_cast<uint64>(Start) + Count > static_cast<uint64>(NumIndices))
+            {
+                return;
+            }
+            PreviousEnd = Start + Count;
+        }
+    }
+
+    // 서브셋마다 정점 번호를 0부터 다시 매겨서 작업 배열을 서브셋 크기로 유지
+    TArray<uint32> GlobalToLocal;
+    GlobalToLocal.Init(InvalidIndex, NumVertices);
+    TArray<uint32> LocalToGlobal;
+    TArray<uint32> LocalIndices;
+    TArray<FVector> LocalPositions;
+
+    for (const auto& [Start, Count] : Ranges)
+    {
+        if (Count < 6)
+        {
+            continue;
+        }
+
+        LocalToGlobal.Empty();
+        LocalIndices.SetNum(Count);
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+            const uint32 Vertex = Indices[Start + Index];
+            if (GlobalToLocal[Vertex] == InvalidIndex)
+            {
+                GlobalToLocal[Vertex] = LocalToGlobal.Num();
+                LocalToGlobal.Add(Vertex);
+            }
+            LocalIndices[Index] = GlobalToLocal[Vertex];
+        }
+
+        const int32 NumLocalVertices = LocalToGlobal.Num();
+        LocalPositions.SetNum(NumLocalVertices);
+        for (int32 Local = 0; Local < NumLocalVertices; ++Local)
+        {
+            LocalPositions[Local] = GetPosition(Positions, PositionStride, LocalToGlobal[Local]);
+        }
+
+        OptimizeVertexCache(LocalIndices.GetData(), Count, NumLocalVertices);
+        OptimizeOverdraw(LocalIndices.GetData(), Count, &LocalPositions[0].X, NumLocalVertices, sizeof(FVector));
+
+        for (uint32 Index = 0; Index < Count; ++Index)
+        {
+            Indices[Start + Index] = LocalToGlobal[LocalIndices[Index]];
+        }
+        for (const uint32 Vertex : LocalToGlobal)
+        {
+            GlobalToLocal[Vertex] = InvalidIndex;
+        }
+    }
+}
+
+void FMeshOptimizer::BuildVertexFetchRemap(const uint32* Indices, int32 NumIndices, int32 NumVertices, TArray<uint32>& OutRemap)
+{
+    OutRemap.Init(InvalidIndex, NumVertices);
+
+    uint32 NextVertex = 0;
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        uint32& Remapped = OutRemap[Indices[Index]];
+        if (Remapped == InvalidIndex)
+        {
+            Remapped = NextVertex++;
+        }
+    }
+    for (uint32& Remapped : OutRemap)
+    {
+        if (Remapped == InvalidIndex)
+        {
+            Remapped = NextVertex++;
+        }
+    }
+}
+
+void FMeshOptimizer::RemapIndices(uint32* Indices, int32 NumIndices, const TArray<uint32>& Remap)
+{
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        Indices[Index] = Remap[Indices[Index]];
+    }
+}
+
+bool FMeshOptimizer::IsValidIndexBuffer(const uint32* Indices, int32 NumIndices, int32 NumVertices)
+{
+    if (NumIndices % 3 != 0)
+    {
+        return false;
+    }
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        if (Indices[Index] >= static_cast<uint32>(NumVertices))
+        {
+            return false;
+        }
+    }
+    return true;
+}
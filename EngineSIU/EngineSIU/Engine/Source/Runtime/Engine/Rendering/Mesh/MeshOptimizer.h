@@ -0,0 +1,99 @@
+#pragma once
+#include "Define.h"
+
+/** FIFO 정점 캐시를 흉내 내서 잰 인덱스 버퍼의 효율 */
+struct FVertexCacheStats
+{
+    int32 NumTriangles = 0;
+    int32 NumVertices = 0;      // 인덱스 버퍼가 참조하는 정점 수
+    int32 NumCacheMisses = 0;
+
+    float ACMR = 0.0f;          // 삼각형당 캐시 미스 (0.5 ~ 3, 낮을수록 좋음)
+    float ATVR = 0.0f;          // 정점당 캐시 미스 (1이 최적)
+};
+
+/**
+ * 임포트할 때 쓰는 인덱스 / 정점 순서 최적화
+ *
+ * 1. 서브셋마다 Tipsify로 삼각형을 정점 캐시에 맞는 순서로 정렬합니다.
+ * 2. 캐시 효율을 Threshold 이상 해치지 않는 선에서 클러스터로 나누고, 바깥을 향한 클러스터부터 그려 오버드로를 줄입니다.
+ * 3. 인덱스 버퍼에서 처음 쓰이는 순서로 정점을 재배치해 정점 fetch의 지역성을 높입니다.
+ *
+ * 서브셋의 IndexStart / IndexCount는 바뀌지 않고, 삼각형은 자기 서브셋 안에서만 움직입니다.
+ */
+struct FMeshOptimizer
+{
+    static constexpr int32 DefaultCacheSize = 16;
+    static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+    static FVertexCacheStats AnalyzeVertexCache(const uint32* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize = DefaultCacheSize);
+
+    /** Tipsify (Sander et al. 2007). 결과는 Indices에 다시 씁니다. */
+    static void OptimizeVertexCache(uint32* Indices, int32 NumIndices, int32 NumVertices, int32 CacheSize = DefaultCacheSize);
+
+    /**
+     * OptimizeVertexCache를 거친 인덱스를 클러스터로 나눠 오버드로가 적은 순서로 정렬합니다.
+     * @param Positions 정점 위치(float3)의 시작 주소
+     * @param PositionStride 정점 사이의 바이트 간격
+     * @param Threshold 클러스터를 나누면서 허용할 ACMR 증가 비율
+     */
+    static void OptimizeOverdraw(
+        uint32* Indices, int32 NumIndices, const float* Positions, int32 NumVertices, uint32 PositionStride,
+        float Threshold = DefaultOverdrawThreshold, int32 CacheSize = DefaultCacheSize
+    );
+
+    /** 서브셋마다 OptimizeVertexCache와 OptimizeOverdraw를 적용합니다. 서브셋 범위가 겹치면 아무것도 하지 않습니다. */
+    static void OptimizeTriangleOrder(
+        uint32* Indices, int32 NumIndices, const TArray<FMaterialSubset>& Subsets, const float* Positions, int32 NumVertices, uint32 PositionStride
+    );
+
+    /** OutRemap[Old] = New. 인덱스 버퍼에서 처음 쓰이는 순서이고, 쓰이지 않는 정점은 뒤에 원래 순서대로 둡니다. */
+    static void BuildVertexFetchRemap(const uint32* Indices, int32 NumIndices, int32 NumVertices, TArray<uint32>& OutRemap);
+
+    static void RemapIndices(uint32* Indices, int32 NumIndices, const TArray<uint32>& Remap);
+
+    template <typename VertexType>
+    static void RemapVertices(TArray<VertexType>& Vertices, const TArray<uint32>& Remap);
+
+    /**
+     * 삼각형 순서와 정점 순서를 모두 최적화합니다.
+     * 인덱스가 삼각형 단위가 아니거나 범위를 벗어나면 건드리지 않습니다.
+     * @param PositionOffset VertexType 안에서 float3 위치의 바이트 오프셋
+     * @return 최적화했으면 true
+     */
+    template <typename VertexType>
+    static bool OptimizeMesh(TArray<VertexType>& Vertices, TArray<uint32>& Indices, const TArray<FMaterialSubset>& Subsets, uint32 PositionOffset = 0);
+
+private:
+    static bool IsValidIndexBuffer(const uint32* Indices, int32 NumIndices, int32 NumVertices);
+};
+
+template <typename VertexType>
+void FMeshOptimizer::RemapVertices(TArray<VertexType>& Vertices, const TArray<uint32>& Remap)
+{
+    TArray<VertexType> Remapped;
+    Remapped.SetNum(Vertices.Num());
+    for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+    {
+        Remapped[Remap[Index]] = Vertices[Index];
+    }
+    Vertices = std::move(Remapped);
+}
+
+template <typename VertexType>
+bool FMeshOptimizer::OptimizeMesh(TArray<VertexType>& Vertices, TArray<uint32>& Indices, const TArray<FMaterialSubset>& Subsets, uint32 PositionOffset)
+{
+    if (!IsValidIndexBuffer(Indices.GetData(), Indices.Num(), Vertices.Num()))
+    {
+        return false;
+    }
+
+    const float* Positions = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Vertices.GetData()) + PositionOffset);
+    OptimizeTriangleOrder(Indices.GetData(), Indices.Num(), Subsets, Positions, Vertices.Num(), sizeof(VertexType));
+
+    TArray<uint32> Remap;
+    BuildVertexFetchRemap(Indices.GetData(), Indices.Num(), Vertices.Num(), Remap);
+    RemapIndices(Indices.GetData(), Indices.Num(), Remap);
+    RemapVertices(Vertices, Remap);
+    return true;
+}
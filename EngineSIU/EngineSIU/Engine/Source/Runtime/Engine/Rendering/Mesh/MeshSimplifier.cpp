@@ -0,0 +1,748 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Math/MathUtility.h"
+#include "Math/Vector.h"
+
+namespace
+{
+    constexpr uint32 InvalidIndex = UINT32_MAX;
+
+    // 열린 경계 / seam 모서리에 수직인 평면을 더해 경계가 안쪽으로 말려 들어가지 않게 함
+    constexpr float BorderEdgeWeight = 10.0f;
+    constexpr float SeamEdgeWeight = 1.0f;
+
+    enum class EVertexKind : uint8
+    {
+        Manifold,   // 위치가 같은 정점이 하나뿐이고 닫힌 면 안쪽
+        Border,     // 위치가 같은 정점이 하나뿐이고 열린 경계 위. 경계를 따라서만 움직임
+        Seam,       // 위치가 같은 정점이 둘이고 속성만 다름. seam을 따라서만 짝과 함께 움직임
+        Locked,     // 나머지. 움직이지 않음
+    };
+
+    bool CanCollapse(EVertexKind From, EVertexKind To)
+    {
+        switch (From)
+        {
+        case EVertexKind::Manifold: return true;
+        case EVertexKind::Border:   return To == EVertexKind::Border;
+        case EVertexKind::Seam:     return To == EVertexKind::Seam;
+        default:                    return false;
+        }
+    }
+
+    // 두 정점 사이의 모서리가 두 삼각형에서 반대 방향으로 한 번씩 나타나는지
+    bool HasOpposite(EVertexKind Kind0, EVertexKind Kind1)
+    {
+        return Kind0 == EVertexKind::Manifold || Kind1 == EVertexKind::Manifold || (Kind0 == EVertexKind::Seam && Kind1 == EVertexKind::Seam);
+    }
+
+    /** Σ w (n·p + d)² 를 p에 대한 이차식으로 모은 것 */
+    struct FQuadric
+    {
+        float A00 = 0.0f, A11 = 0.0f, A22 = 0.0f;
+        float A10 = 0.0f, A20 = 0.0f, A21 = 0.0f;
+        float B0 = 0.0f, B1 = 0.0f, B2 = 0.0f;
+        float C = 0.0f;
+        float W = 0.0f;
+
+        void AddPlane(const FVector& N, float D, float Weight)
+        {
+            A00 += Weight * N.X * N.X;
+            A11 += Weight * N.Y * N.Y;
+            A22 += Weight * N.Z * N.Z;
+            A10 += Weight * N.Y * N.X;
+            A20 += Weight * N.Z * N.X;
+            A21 += Weight * N.Z * N.Y;
+            B0 += Weight * N.X * D;
+            B1 += Weight * N.Y * D;
+            B2 += Weight * N.Z * D;
+            C += Weight * D * D;
+            W += Weight;
+        }
+
+        void Add(const FQuadric& Other)
+        {
+            A00 += Other.A00; A11 += Other.A11; A22 += Other.A22;
+            A10 += Other.A10; A20 += Other.A20; A21 += Other.A21;
+            B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+            C += Other.C;
+            W += Other.W;
+        }
+
+        float Evaluate(const FVector& P) const
+        {
+            const float Quadratic = A00 * P.X * P.X + A11 * P.Y * P.Y + A22 * P.Z * P.Z
+                + 2.0f * (A10 * P.X * P.Y + A20 * P.X * P.Z + A21 * P.Y * P.Z);
+            return Quadratic + 2.0f * (B0 * P.X + B1 * P.Y + B2 * P.Z) + C;
+        }
+    };
+
+    /** 삼각형 위에서 선형인 속성 a(p) = g·p + d 와 정점 속성 s의 차이 Σ w (g·p + d - s)² */
+    struct FAttributeQuadric
+    {
+        FQuadric Gradient;      // Σ w (g·p + d)²
+        FVector G = FVector::ZeroVector;
+        float D = 0.0f;
+
+        void Add(const FAttributeQuadric& Other)
+        {
+            Gradient.Add(Other.Gradient);
+            G += Other.G;
+            D += Other.D;
+        }
+
+        float Evaluate(const FVector& P, float S) const
+        {
+            return Gradient.Evaluate(P) - 2.0f * S * ((G | P) + D) + S * S * Gradient.W;
+        }
+    };
+
+    /** 정점마다 그 정점을 쓰는 삼각형 목록 */
+    struct FTriangleAdjacency
+    {
+        TArray<uint32> Offsets;
+        TArray<uint32> Triangles;
+
+        void Build(const uint32* Indices, int32 NumIndices, int32 NumVertices)
+        {
+            Offsets.Init(0, NumVertices + 1);
+            for (int32 Index = 0; Index < NumIndices; ++Index)
+            {
+                ++Offsets[Indices[Index] + 1];
+            }
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                Offsets[Vertex + 1] += Offsets[Vertex];
+            }
+
+            Triangles.SetNum(NumIndices);
+            TArray<uint32> Fill = Offsets;
+            for (int32 Index = 0; Index < NumIndices; ++Index)
+            {
+                Triangles[Fill[Indices[Index]]++] = static_cast<uint32>(Index / 3);
+            }
+        }
+
+        /** From → To 방향의 half-edge가 있는지 */
+        bool HasEdge(const uint32* Indices, uint32 From, uint32 To) const
+        {
+            for (uint32 Offset = Offsets[From]; Offset < Offsets[From + 1]; ++Offset)
+            {
+                const uint32* Triangle = &Indices[Triangles[Offset] * 3];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    if (Triangle[Corner] == From && Triangle[(Corner + 1) % 3] == To)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
+    struct FCollapse
+    {
+        uint32 From;
+        uint32 To;
+        float Error;
+        bool bBidirectional;
+    };
+
+    class FSimplifier
+    {
+    public:
+        FSimplifier(const float* Positions, int32 InNumVertices, uint32 PositionStride, const FMeshSimplifierAttributes& Attributes, float Scale, const FVector& Origin)
+            : NumVertices(InNumVertices)
+            , NumAttributes(FMath::Min(Attributes.Data ? Attributes.Num : 0, FMeshSimplifierAttributes::MaxAttributes))
+        {
+            // 크기를 1로 맞춰서 오차가 메시 크기 대비 비율이 되게 함
+            const float InvScale = Scale > 0.0f ? 1.0f / Scale : 0.0f;
+            VertexPositions.SetNum(NumVertices);
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                const float* Position = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Positions) + static_cast<size_t>(Vertex) * PositionStride);
+                VertexPositions[Vertex] = (FVector(Position[0], Position[1], Position[2]) - Origin) * InvScale;
+            }
+
+            if (NumAttributes > 0)
+            {
+                VertexAttributes.SetNum(NumVertices * NumAttributes);
+                for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+                {
+                    const float* Attribute = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Attributes.Data) + static_cast<size_t>(Vertex) * Attributes.Stride);
+                    for (int32 Channel = 0; Channel < NumAttributes; ++Channel)
+                    {
+                        VertexAttributes[Vertex * NumAttributes + Channel] = Attribute[Channel] * (Attributes.Weights ? Attributes.Weights[Channel] : 1.0f);
+                    }
+                }
+            }
+        }
+
+        int32 Simplify(uint32* Indices, int32 NumIndices, int32 TargetIndexCount, float TargetError, bool bLockBorders, float& OutError)
+        {
+            BuildPositionRemap(Indices, NumIndices);
+
+            Adjacency.Build(Indices, NumIndices, NumVertices);
+            ClassifyVertices(Indices, NumIndices, bLockBorders);
+            FillQuadrics(Indices, NumIndices);
+
+            const float ErrorLimit = TargetError * TargetError;
+            float ResultError = 0.0f;
+
+            TArray<FCollapse> Collapses;
+            TArray<uint32> CollapseOrder;
+            CollapseRemap.SetNum(NumVertices);
+            CollapseLocked.SetNum(NumVertices);
+
+            while (NumIndices > TargetIndexCount)
+            {
+                Adjacency.Build(Indices, NumIndices, NumVertices);
+
+                PickCollapses(Indices, NumIndices, Collapses);
+                if (Collapses.Num() == 0)
+                {
+                    break;
+                }
+                RankCollapses(Collapses);
+
+                CollapseOrder.SetNum(Collapses.Num());
+                for (int32 Index = 0; Index < Collapses.Num(); ++Index)
+                {
+                    CollapseOrder[Index] = Index;
+                }
+                std::sort(CollapseOrder.begin(), CollapseOrder.end(), [&Collapses](uint32 A, uint32 B) { return Collapses[A].Error < Collapses[B].Error; });
+
+                const int32 TriangleCollapseGoal = (NumIndices - TargetIndexCount) / 3;
+                const int32 NumCollapsed = PerformCollapses(Indices, Collapses, CollapseOrder, TriangleCollapseGoal, ErrorLimit, ResultError);
+                if (NumCollapsed == 0)
+                {
+                    break;
+                }
+
+                RemapEdgeLoops();
+                NumIndices = RemapIndexBuffer(Indices, NumIndices);
+            }
+
+            OutError = std::sqrt(ResultError);
+            return NumIndices;
+        }
+
+    private:
+        /** 위치가 같은 정점을 묶음. Remap은 묶음의 대표, Wedge는 묶음을 도는 원형 목록 */
+        void BuildPositionRemap(const uint32* Indices, int32 NumIndices)
+        {
+            Remap.SetNum(NumVertices);
+            Wedge.SetNum(NumVertices);
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                Remap[Vertex] = Vertex;
+                Wedge[Vertex] = Vertex;
+            }
+
+            // 쓰이지 않는 정점이 묶음에 끼면 seam 판정이 틀어지므로 인덱스가 참조하는 정점만 묶음
+            TArray<uint8> bReferenced;
+            bReferenced.Init(0, NumVertices);
+            TArray<uint32> Sorted;
+            for (int32 Index = 0; Index < NumIndices; ++Index)
+            {
+                if (!bReferenced[Indices[Index]])
+                {
+                    bReferenced[Indices[Index]] = 1;
+                    Sorted.Add(Indices[Index]);
+                }
+            }
+
+            const auto LessPosition = [this](uint32 A, uint32 B)
+            {
+                const FVector& PA = VertexPositions[A];
+                const FVector& PB = VertexPositions[B];
+                if (PA.X != PB.X) return PA.X < PB.X;
+                if (PA.Y != PB.Y) return PA.Y < PB.Y;
+                if (PA.Z != PB.Z) return PA.Z < PB.Z;
+                return A < B;
+            };
+            std::sort(Sorted.begin(), Sorted.end(), LessPosition);
+
+            for (int32 Begin = 0; Begin < Sorted.Num();)
+            {
+                int32 End = Begin + 1;
+                while (End < Sorted.Num() && VertexPositions[Sorted[End]] == VertexPositions[Sorted[Begin]])
+                {
+                    ++End;
+                }
+
+                const uint32 Representative = Sorted[Begin];
+                for (int32 Index = Begin; Index < End; ++Index)
+                {
+                    Remap[Sorted[Index]] = Representative;
+                    Wedge[Sorted[Index]] = Sorted[Index + 1 < End ? Index + 1 : Begin];
+                }
+                Begin = End;
+            }
+        }
+
+        void ClassifyVertices(const uint32* Indices, int32 NumIndices, bool bLockBorders)
+        {
+            // 반대 방향 half-edge가 없는 모서리. 둘 이상이면 자기 자신을 넣어 표시
+            OpenOut.Init(InvalidIndex, NumVertices);
+            OpenIn.Init(InvalidIndex, NumVertices);
+            for (int32 Index = 0; Index < NumIndices; ++Index)
+            {
+                const uint32 From = Indices[Index];
+                const uint32 To = Indices[Index - Index % 3 + (Index + 1) % 3];
+                if (!Adjacency.HasEdge(Indices, To, From))
+                {
+                    OpenOut[From] = OpenOut[From] == InvalidIndex ? To : From;
+                    OpenIn[To] = OpenIn[To] == InvalidIndex ? From : To;
+                }
+            }
+
+            const auto IsSingleOpenEdge = [](uint32 Vertex, uint32 Open) { return Open != InvalidIndex && Open != Vertex; };
+
+            Kinds.Init(EVertexKind::Locked, NumVertices);
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                if (Remap[Vertex] != static_cast<uint32>(Vertex))
+                {
+                    continue;
+                }
+
+                EVertexKind Kind = EVertexKind::Locked;
+                if (Wedge[Vertex] == static_cast<uint32>(Vertex))
+                {
+                    if (OpenOut[Vertex] == InvalidIndex && OpenIn[Vertex] == InvalidIndex)
+                    {
+                        Kind = EVertexKind::Manifold;
+                    }
+                    else if (IsSingleOpenEdge(Vertex, OpenOut[Vertex]) && IsSingleOpenEdge(Vertex, OpenIn[Vertex]))
+                    {
+                        Kind = bLockBorders ? EVertexKind::Locked : EVertexKind::Border;
+                    }
+                }
+                else if (Wedge[Wedge[Vertex]] == static_cast<uint32>(Vertex))
+                {
+                    // 두 정점의 열린 모서리가 서로 마주 보면 seam 한가운데
+                    const uint32 Other = Wedge[Vertex];
+                    if (IsSingleOpenEdge(Vertex, OpenOut[Vertex]) && IsSingleOpenEdge(Vertex, OpenIn[Vertex])
+                        && IsSingleOpenEdge(Other, OpenOut[Other]) && IsSingleOpenEdge(Other, OpenIn[Other])
+                        && Remap[OpenOut[Vertex]] == Remap[OpenIn[Other]] && Remap[OpenIn[Vertex]] == Remap[OpenOut[Other]])
+                    {
+                        Kind = EVertexKind::Seam;
+                    }
+                }
+                Kinds[Vertex] = Kind;
+            }
+
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                Kinds[Vertex] = Kinds[Remap[Vertex]];
+            }
+        }
+
+        void FillQuadrics(const uint32* Indices, int32 NumIndices)
+        {
+            PositionQuadrics.Init(FQuadric(), NumVertices);
+            AttributeQuadrics.Init(FAttributeQuadric(), NumVertices * NumAttributes);
+
+            for (int32 Index = 0; Index < NumIndices; Index += 3)
+            {
+                const uint32 I0 = Indices[Index + 0];
+                const uint32 I1 = Indices[Index + 1];
+                const uint32 I2 = Indices[Index + 2];
+                const FVector& P0 = VertexPositions[I0];
+                const FVector& P1 = VertexPositions[I1];
+                const FVector& P2 = VertexPositions[I2];
+
+                const FVector Edge1 = P1 - P0;
+                const FVector Edge2 = P2 - P0;
+                const FVector Cross = Edge1 ^ Edge2;
+                const float CrossLength = Cross.Length();
+                if (CrossLength <= 0.0f)
+                {
+                    continue;
+                }
+                const FVector Normal = Cross / CrossLength;
+                const float Area = 0.5f * CrossLength;
+
+                // 면 평면
+                FQuadric Plane;
+                Plane.AddPlane(Normal, -(Normal | P0), Area);
+                PositionQuadrics[Remap[I0]].Add(Plane);
+                PositionQuadrics[Remap[I1]].Add(Plane);
+                PositionQuadrics[Remap[I2]].Add(Plane);
+
+                // 열린 모서리에 수직인 평면
+                const uint32 Corners[3] = { I0, I1, I2 };
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const uint32 From = Corners[Corner];
+                    const uint32 To = Corners[(Corner + 1) % 3];
+                    if (Adjacency.HasEdge(Indices, To, From))
+                    {
+                        continue;
+                    }
+
+                    const FVector EdgeVector = VertexPositions[To] - VertexPositions[From];
+                    const float EdgeLengthSquared = EdgeVector.SquaredLength();
+                    const FVector EdgeNormal = (EdgeVector ^ Normal).GetSafeNormal();
+                    const bool bSeam = Kinds[From] == EVertexKind::Seam && Kinds[To] == EVertexKind::Seam;
+
+                    FQuadric EdgePlane;
+                    EdgePlane.AddPlane(EdgeNormal, -(EdgeNormal | VertexPositions[From]), EdgeLengthSquared * (bSeam ? SeamEdgeWeight : BorderEdgeWeight));
+                    PositionQuadrics[Remap[From]].Add(EdgePlane);
+                    PositionQuadrics[Remap[To]].Add(EdgePlane);
+                }
+
+                // 속성 gradient: g·e1 = Δa1, g·e2 = Δa2, g·n = 0
+                if (NumAttributes > 0)
+                {
+                    const FVector Basis1 = Edge2 ^ Cross;
+                    const FVector Basis2 = Cross ^ Edge1;
+                    const float InvCrossSquared = 1.0f / (CrossLength * CrossLength);
+                    for (int32 Channel = 0; Channel < NumAttributes; ++Channel)
+                    {
+                        const float A0 = VertexAttributes[I0 * NumAttributes + Channel];
+                        const float A1 = VertexAttributes[I1 * NumAttributes + Channel];
+                        const float A2 = VertexAttributes[I2 * NumAttributes + Channel];
+
+                        const FVector Gradient = (Basis1 * (A1 - A0) + Basis2 * (A2 - A0)) * InvCrossSquared;
+                        const float Offset = A0 - (Gradient | P0);
+
+                        FAttributeQuadric Quadric;
+                        Quadric.Gradient.AddPlane(Gradient, Offset, Area);
+                        Quadric.G = Gradient * Area;
+                        Quadric.D = Offset * Area;
+
+                        AttributeQuadrics[I0 * NumAttributes + Channel].Add(Quadric);
+                        AttributeQuadrics[I1 * NumAttributes + Channel].Add(Quadric);
+                        AttributeQuadrics[I2 * NumAttributes + Channel].Add(Quadric);
+                    }
+                }
+            }
+        }
+
+        void PickCollapses(const uint32* Indices, int32 NumIndices, TArray<FCollapse>& OutCollapses) const
+        {
+            OutCollapses.Empty();
+            for (int32 Index = 0; Index < NumIndices; ++Index)
+            {
+                const uint32 I0 = Indices[Index];
+                const uint32 I1 = Indices[Index - Index % 3 + (Index + 1) % 3];
+                const EVertexKind Kind0 = Kinds[I0];
+                const EVertexKind Kind1 = Kinds[I1];
+
+                const bool bForward = CanCollapse(Kind0, Kind1);
+                const bool bBackward = CanCollapse(Kind1, Kind0);
+                if (!bForward && !bBackward)
+                {
+                    continue;
+                }
+
+                // 양쪽 삼각형에서 한 번씩 나오는 모서리는 한 번만
+                if (HasOpposite(Kind0, Kind1) && Remap[I1] > Remap[I0])
+                {
+                    continue;
+                }
+
+                // 경계 / seam끼리는 같은 경계 위에서 이웃한 경우만
+                if (Kind0 == Kind1 && (Kind0 == EVertexKind::Border || Kind0 == EVertexKind::Seam) && OpenOut[I0] != I1)
+                {
+                    continue;
+                }
+
+                if (bForward && bBackward)
+                {
+                    OutCollapses.Add({ I0, I1, 0.0f, true });
+                }
+                else
+                {
+                    OutCollapses.Add({ bForward ? I0 : I1, bForward ? I1 : I0, 0.0f, false });
+                }
+            }
+        }
+
+        float GetCollapseError(uint32 From, uint32 To) const
+        {
+            const FVector& Target = VertexPositions[To];
+
+            const FQuadric& Position = PositionQuadrics[Remap[From]];
+            float Error = Position.W > 0.0f ? std::fabs(Position.Evaluate(Target)) / Position.W : 0.0f;
+
+            const auto AddAttributeError = [this, &Target, &Error](uint32 QuadricVertex, uint32 AttributeVertex)
+            {
+                for (int32 Channel = 0; Channel < NumAttributes; ++Channel)
+                {
+                    const FAttributeQuadric& Quadric = AttributeQuadrics[QuadricVertex * NumAttributes + Channel];
+                    if (Quadric.Gradient.W > 0.0f)
+                    {
+                        Error += std::fabs(Quadric.Evaluate(Target, VertexAttributes[AttributeVertex * NumAttributes + Channel])) / Quadric.Gradient.W;
+                    }
+                }
+            };
+            AddAttributeError(From, To);
+            if (Kinds[From] == EVertexKind::Seam)
+            {
+                AddAttributeError(Wedge[From], Wedge[To]);
+            }
+            return Error;
+        }
+
+        void RankCollapses(TArray<FCollapse>& Collapses) const
+        {
+            for (FCollapse& Collapse : Collapses)
+            {
+                Collapse.Error = GetCollapseError(Collapse.From, Collapse.To);
+                if (Collapse.bBidirectional)
+                {
+                    const float ReverseError = GetCollapseError(Collapse.To, Collapse.From);
+                    if (ReverseError < Collapse.Error)
+                    {
+                        std::swap(Collapse.From, Collapse.To);
+                        Collapse.Error = ReverseError;
+                    }
+                }
+            }
+        }
+
+        /** From을 To의 위치로 옮겼을 때 뒤집히는 삼각형이 있는지. 이번 패스에서 이미 모은 정점도 반영합니다. */
+        bool HasTriangleFlips(const uint32* Indices, uint32 From, uint32 To) const
+        {
+            const FVector& Source = VertexPositions[From];
+            const FVector& Target = VertexPositions[To];
+            const uint32 TargetRemap = Remap[To];
+
+            uint32 Vertex = From;
+            do
+            {
+                for (uint32 Offset = Adjacency.Offsets[Vertex]; Offset < Adjacency.Offsets[Vertex + 1]; ++Offset)
+                {
+                    const uint32* Triangle = &Indices[Adjacency.Triangles[Offset] * 3];
+                    const int32 Corner = Triangle[0] == Vertex ? 0 : (Triangle[1] == Vertex ? 1 : 2);
+                    const uint32 Other1 = CollapseRemap[Triangle[(Corner + 1) % 3]];
+                    const uint32 Other2 = CollapseRemap[Triangle[(Corner + 2) % 3]];
+
+                    // 모서리를 공유하는 삼각형은 사라짐
+                    if (Remap[Other1] == TargetRemap || Remap[Other2] == TargetRemap)
+                    {
+                        continue;
+                    }
+
+                    const FVector& P1 = VertexPositions[Other1];
+                    const FVector& P2 = VertexPositions[Other2];
+                    const FVector Before = (P1 - Source) ^ (P2 - Source);
+                    const FVector After = (P1 - Target) ^ (P2 - Target);
+                    if ((Before | After) <= 0.0f)
+                    {
+                        return true;
+                    }
+                }
+                Vertex = Wedge[Vertex];
+            } while (Vertex != From);
+
+            return false;
+        }
+
+        int32 PerformCollapses(
+            const uint32* Indices, const TArray<FCollapse>& Collapses, const TArray<uint32>& CollapseOrder, int32 TriangleCollapseGoal, float ErrorLimit, float& InOutResultError
+        )
+        {
+            for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+            {
+                CollapseRemap[Vertex] = Vertex;
+                CollapseLocked[Vertex] = 0;
+            }
+
+            // 한 패스에 너무 큰 오차까지 한꺼번에 모으지 않도록, 목표 개수째 후보 오차의 1.5배에서 멈춤
+            // 정점을 공유하는 후보는 건너뛰게 되므로 목표보다 조금 더 허용함
+            const int32 EdgeCollapseGoal = TriangleCollapseGoal / 2;
+            const float ErrorGoal = EdgeCollapseGoal < CollapseOrder.Num() ? 1.5f * Collapses[CollapseOrder[EdgeCollapseGoal]].Error : FLT_MAX;
+
+            int32 TriangleCollapses = 0;
+            int32 NumCollapsed = 0;
+            for (const uint32 Order : CollapseOrder)
+            {
+                const FCollapse& Collapse = Collapses[Order];
+                if (Collapse.Error > ErrorLimit || TriangleCollapses >= TriangleCollapseGoal)
+                {
+                    break;
+                }
+                if (Collapse.Error > ErrorGoal && TriangleCollapses > TriangleCollapseGoal / 10)
+                {
+                    break;
+                }
+
+                const uint32 From = Collapse.From;
+                const uint32 To = Collapse.To;
+                const uint32 FromRemap = Remap[From];
+                const uint32 ToRemap = Remap[To];
+
+                // 이번 패스에서 이미 움직인 정점 주변은 다음 패스에서
+                if (CollapseLocked[FromRemap] || CollapseLocked[ToRemap])
+                {
+                    continue;
+                }
+                if (HasTriangleFlips(Indices, From, To))
+                {
+                    continue;
+                }
+
+                CollapseRemap[From] = To;
+                PositionQuadrics[ToRemap].Add(PositionQuadrics[FromRemap]);
+                MergeAttributeQuadrics(From, To);
+                if (Kinds[From] == EVertexKind::Seam)
+                {
+                    CollapseRemap[Wedge[From]] = Wedge[To];
+                    MergeAttributeQuadrics(Wedge[From], Wedge[To]);
+                }
+
+                CollapseLocked[FromRemap] = 1;
+                CollapseLocked[ToRemap] = 1;
+
+                TriangleCollapses += Kinds[From] == EVertexKind::Border ? 1 : 2;
+                ++NumCollapsed;
+                InOutResultError = FMath::Max(InOutResultError, Collapse.Error);
+            }
+
+            return NumCollapsed;
+        }
+
+        void MergeAttributeQuadrics(uint32 From, uint32 To)
+        {
+            for (int32 Channel = 0; Channel < NumAttributes; ++Channel)
+            {
+                AttributeQuadrics[To * NumAttributes + Channel].Add(AttributeQuadrics[From * NumAttributes + Channel]);
+            }
+        }
+
+        /** 모은 정점을 지나던 경계 / seam 모서리를 이어 붙임 */
+        void RemapEdgeLoops()
+        {
+            const auto RemapLoop = [this](TArray<uint32>& Loop)
+            {
+                for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+                {
+                    const uint32 Next = Loop[Vertex];
+                    if (Next == InvalidIndex)
+                    {
+                        continue;
+                    }
+
+                    const uint32 RemappedNext = CollapseRemap[Next];
+                    if (RemappedNext == static_cast<uint32>(Vertex))
+                    {
+                        // Next가 이 정점으로 모였으면 Next의 다음으로 이어짐
+                        Loop[Vertex] = Loop[Next] != InvalidIndex ? CollapseRemap[Loop[Next]] : InvalidIndex;
+                    }
+                    else
+                    {
+                        Loop[Vertex] = RemappedNext;
+                    }
+                }
+            };
+            RemapLoop(OpenOut);
+            RemapLoop(OpenIn);
+        }
+
+        int32 RemapIndexBuffer(uint32* Indices, int32 NumIndices) const
+        {
+            int32 NumWritten = 0;
+            for (int32 Index = 0; Index < NumIndices; Index += 3)
+            {
+                const uint32 V0 = CollapseRemap[Indices[Index + 0]];
+                const uint32 V1 = CollapseRemap[Indices[Index + 1]];
+                const uint32 V2 = CollapseRemap[Indices[Index + 2]];
+
+                if (Remap[V0] != Remap[V1] && Remap[V0] != Remap[V2] && Remap[V1] != Remap[V2])
+                {
+                    Indices[NumWritten++] = V0;
+                    Indices[NumWritten++] = V1;
+                    Indices[NumWritten++] = V2;
+                }
+            }
+            return NumWritten;
+        }
+
+        int32 NumVertices;
+        int32 NumAttributes;
+
+        TArray<FVector> VertexPositions;
+        TArray<float> VertexAttributes;
+
+        TArray<uint32> Remap;
+        TArray<uint32> Wedge;
+        TArray<EVertexKind> Kinds;
+        TArray<uint32> OpenOut;
+        TArray<uint32> OpenIn;
+
+        TArray<FQuadric> PositionQuadrics;              // Remap 대표 정점마다
+        TArray<FAttributeQuadric> AttributeQuadrics;    // 정점 x 속성마다
+
+        FTriangleAdjacency Adjacency;
+        TArray<uint32> CollapseRemap;
+        TArray<uint8> CollapseLocked;
+    };
+
+    void ComputeBounds(const uint32* Indices, int32 NumIndices, const float* Positions, uint32 PositionStride, FVector& OutMin, FVector& OutMax)
+    {
+        OutMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        OutMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Index = 0; Index < NumIndices; ++Index)
+        {
+            const float* Position = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Positions) + static_cast<size_t>(Indices[Index]) * PositionStride);
+            OutMin = FVector(FMath::Min(OutMin.X, Position[0]), FMath::Min(OutMin.Y, Position[1]), FMath::Min(OutMin.Z, Position[2]));
+            OutMax = FVector(FMath::Max(OutMax.X, Position[0]), FMath::Max(OutMax.Y, Position[1]), FMath::Max(OutMax.Z, Position[2]));
+        }
+    }
+}
+
+int32 FMeshSimplifier::Simplify(
+    uint32* Indices, int32 NumIndices, const float* Positions, int32 NumVertices, uint32 PositionStride,
+    const FMeshSimplifierAttributes& Attributes, int32 TargetIndexCount, float TargetError, bool bLockBorders, float* OutError
+)
+{
+    if (OutError)
+    {
+        *OutError = 0.0f;
+    }
+    if (NumIndices % 3 != 0 || NumIndices <= TargetIndexCount)
+    {
+        return NumIndices;
+    }
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        if (Indices[Index] >= static_cast<uint32>(NumVertices))
+        {
+            return NumIndices;
+        }
+    }
+
+    FVector Min, Max;
+    ComputeBounds(Indices, NumIndices, Positions, PositionStride, Min, Max);
+    const float Scale = FMath::Max(Max.X - Min.X, FMath::Max(Max.Y - Min.Y, Max.Z - Min.Z));
+
+    FSimplifier Simplifier(Positions, NumVertices, PositionStride, Attributes, Scale, Min);
+    float Error = 0.0f;
+    const int32 Result = Simplifier.Simplify(Indices, NumIndices, FMath::Max(TargetIndexCount, 0), TargetError, bLockBorders, Error);
+    if (OutError)
+    {
+        *OutError = Error;
+    }
+    return Result;
+}
+
+float FMeshSimplifier::ComputeScale(const uint32* Indices, int32 NumIndices, const float* Positions, uint32 PositionStride)
+{
+    if (NumIndices == 0)
+    {
+        return 0.0f;
+    }
+
+    FVector Min, Max;
+    ComputeBounds(Indices, NumIndices, Positions, PositionStride, Min, Max);
+    return FMath::Max(Max.X - Min.X, FMath::Max(Max.Y - Min.Y, Max.Z - Min.Z));
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+/** 정점마다 같은 간격으로 놓인 float 속성. 노멀, UV 등 */
+struct FMeshSimplifierAttributes
+{
+    const float* Data = nullptr;
+    uint32 Stride = 0;                  // 정점 사이의 바이트 간격
+    int32 Num = 0;                      // 정점당 float 개수 (최대 MaxAttributes)
+    const float* Weights = nullptr;     // 속성별 가중치. nullptr이면 모두 1
+
+    static constexpr int32 MaxAttributes = 8;
+};
+
+/**
+ * Quadric Error Metric 기반 메시 단순화 (Garland & Heckbert 1997, 속성은 Hoppe 1999의 gradient quadric)
+ *
+ * 정점은 만들지 않고 기존 정점으로 모으는 half-edge collapse만 하므로, 결과 인덱스는 원래 정점 버퍼를 그대로 참조합니다.
+ * 위치가 같고 속성이 다른 정점(UV / 노멀 seam)은 seam을 따라서만 함께 움직이고, 열린 경계는 bLockBorders면 고정합니다.
+ * 엔진의 다른 부분에 의존하지 않으므로 에디터 없이도 테스트할 수 있습니다.
+ */
+struct FMeshSimplifier
+{
+    /**
+     * 오차가 TargetError를 넘지 않는 범위에서 인덱스 수가 TargetIndexCount 이하가 될 때까지 단순화합니다.
+     * @param Indices 입력이자 결과. 남은 삼각형은 원래 순서를 유지합니다.
+     * @param TargetError 메시 크기(바운드의 가장 긴 변) 대비 허용 오차
+     * @param OutError 실제로 생긴 오차. 메시 크기 대비
+     * @return 결과 인덱스 수
+     */
+    static int32 Simplify(
+        uint32* Indices, int32 NumIndices, const float* Positions, int32 NumVertices, uint32 PositionStride,
+        const FMeshSimplifierAttributes& Attributes, int32 TargetIndexCount, float TargetError, bool bLockBorders = true, float* OutError = nullptr
+    );
+
+    /** Simplify가 오차를 잴 때 쓰는 메시 크기. 인덱스가 참조하는 정점의 바운드 중 가장 긴 변 */
+    static float ComputeScale(const uint32* Indices, int32 NumIndices, const float* Positions, uint32 PositionStride);
+};
@@ -0,0 +1,398 @@
+#include "MeshSimplifierTest.h"
+
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+#include "MeshSimplifier.h"
+#include "TestMeshFixture.h"
+#include "Math/MathUtility.h"
+#include "Math/Vector.h"
+
+namespace
+{
+    struct FTestVertex
+    {
+        FVector Position;
+        FVector Normal;
+        float U = 0.0f;
+        float V = 0.0f;
+        int32 Chart = 0;
+    };
+
+    struct FTestMesh
+    {
+        TArray<FTestVertex> Vertices;
+        TArray<uint32> Indices;
+    };
+
+    // 노멀 3 + UV 2
+    constexpr float AttributeWeights[5] = { 0.5f, 0.5f, 0.5f, 1.0f, 1.0f };
+
+    FMeshSimplifierAttributes GetAttributes(const FTestMesh& Mesh)
+    {
+        FMeshSimplifierAttributes Attributes;
+        Attributes.Data = &Mesh.Vertices[0].Normal.X;
+        Attributes.Stride = sizeof(FTestVertex);
+        Attributes.Num = 5;
+        Attributes.Weights = AttributeWeights;
+        return Attributes;
+    }
+
+    /** XY 평면의 (Size+1)^2 격자. SeamColumn >= 0이면 그 열의 정점을 복제해 UV가 끊긴 두 차트로 나눔 */
+    FTestMesh MakePlane(int32 Size, int32 SeamColumn = -1)
+    {
+        FTestMesh Mesh;
+        TArray<uint32> LeftIds, RightIds;
+        LeftIds.SetNum((Size + 1) * (Size + 1));
+        RightIds.SetNum((Size + 1) * (Size + 1));
+
+        for (int32 Y = 0; Y <= Size; ++Y)
+        {
+            for (int32 X = 0; X <= Size; ++X)
+            {
+                const int32 Id = Y * (Size + 1) + X;
+                FTestVertex Vertex;
+                Vertex.Position = FVector(static_cast<float>(X), static_cast<float>(Y), 0.0f);
+                Vertex.Normal = FVector(0.0f, 0.0f, 1.0f);
+                Vertex.U = static_cast<float>(X) / Size;
+                Vertex.V = static_cast<float>(Y) / Size;
+
+                const bool bRight = SeamColumn >= 0 && X >= SeamColumn;
+                Vertex.Chart = bRight ? 1 : 0;
+                if (bRight)
+                {
+                    Vertex.U += 10.0f;
+                }
+                LeftIds[Id] = RightIds[Id] = Mesh.Vertices.Add(Vertex);
+
+                if (X == SeamColumn)
+                {
+                    Vertex.U -= 10.0f;
+                    Vertex.Chart = 0;
+                    LeftIds[Id] = Mesh.Vertices.Add(Vertex);
+                }
+            }
+        }
+
+        for (int32 Y = 0; Y < Size; ++Y)
+        {
+            for (int32 X = 0; X < Size; ++X)
+            {
+                const TArray<uint32>& Ids = (SeamColumn >= 0 && X >= SeamColumn) ? RightIds : LeftIds;
+                const uint32 V00 = Ids[Y * (Size + 1) + X];
+                const uint32 V10 = Ids[Y * (Size + 1) + X + 1];
+                const uint32 V01 = Ids[(Y + 1) * (Size + 1) + X];
+                const uint32 V11 = Ids[(Y + 1) * (Size + 1) + X + 1];
+                Mesh.Indices.Add(V00); Mesh.Indices.Add(V10); Mesh.Indices.Add(V11);
+                Mesh.Indices.Add(V00); Mesh.Indices.Add(V11); Mesh.Indices.Add(V01);
+            }
+        }
+        return Mesh;
+    }
+
+    /** FTestMeshFixture::MakeSphere의 정점 / 인덱스. 극점은 정점이 여러 개라 고정됨 */
+    FTestMesh MakeSphere(int32 Slices, int32 Stacks)
+    {
+        const FStaticMeshRenderData Sphere = FTestMeshFixture::MakeSphere(Slices, Stacks);
+
+        FTestMesh Mesh;
+        for (const FStaticMeshVertex& Source : Sphere.Vertices)
+        {
+            FTestVertex Vertex;
+            Vertex.Position = FVector(Source.X, Source.Y, Source.Z);
+            Vertex.Normal = FVector(Source.NormalX, Source.NormalY, Source.NormalZ);
+            Vertex.U = Source.U;
+            Vertex.V = Source.V;
+            Mesh.Vertices.Add(Vertex);
+        }
+        for (const UINT Index : Sphere.Indices)
+        {
+            Mesh.Indices.Add(Index);
+        }
+        return Mesh;
+    }
+
+    /** 얇은 삼각형에서 float 오차가 측정값을 덮지 않도록 double로 계산 */
+    struct FVectorD
+    {
+        double X, Y, Z;
+
+        FVectorD(const FVector& V) : X(V.X), Y(V.Y), Z(V.Z) {}
+        FVectorD(double InX, double InY, double InZ) : X(InX), Y(InY), Z(InZ) {}
+
+        FVectorD operator+(const FVectorD& Other) const { return { X + Other.X, Y + Other.Y, Z + Other.Z }; }
+        FVectorD operator-(const FVectorD& Other) const { return { X - Other.X, Y - Other.Y, Z - Other.Z }; }
+        FVectorD operator*(double Scalar) const { return { X * Scalar, Y * Scalar, Z * Scalar }; }
+        double Dot(const FVectorD& Other) const { return X * Other.X + Y * Other.Y + Z * Other.Z; }
+    };
+
+    /** Ericson, Real-Time Collision Detection 5.1.5 */
+    double SquaredDistanceToTriangle(const FVectorD& P, const FVectorD& A, const FVectorD& B, const FVectorD& C)
+    {
+        const auto SquaredDistance = [&P](const FVectorD& Closest) { const FVectorD Delta = P - Closest; return Delta.Dot(Delta); };
+
+        const FVectorD AB = B - A;
+        const FVectorD AC = C - A;
+        const FVectorD AP = P - A;
+        const double D1 = AB.Dot(AP);
+        const double D2 = AC.Dot(AP);
+        if (D1 <= 0.0 && D2 <= 0.0) return SquaredDistance(A);
+
+        const FVectorD BP = P - B;
+        const double D3 = AB.Dot(BP);
+        const double D4 = AC.Dot(BP);
+        if (D3 >= 0.0 && D4 <= D3) return SquaredDistance(B);
+
+        const double VC = D1 * D4 - D3 * D2;
+        if (VC <= 0.0 && D1 >= 0.0 && D3 <= 0.0) return SquaredDistance(A + AB * (D1 / (D1 - D3)));
+
+        const FVectorD CP = P - C;
+        const double D5 = AB.Dot(CP);
+        const double D6 = AC.Dot(CP);
+        if (D6 >= 0.0 && D5 <= D6) return SquaredDistance(C);
+
+        const double VB = D5 * D2 - D1 * D6;
+        if (VB <= 0.0 && D2 >= 0.0 && D6 <= 0.0) return SquaredDistance(A + AC * (D2 / (D2 - D6)));
+
+        const double VA = D3 * D6 - D5 * D4;
+        if (VA <= 0.0 && (D4 - D3) >= 0.0 && (D5 - D6) >= 0.0) return SquaredDistance(B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6))));
+
+        const double Denominator = 1.0 / (VA + VB + VC);
+        return SquaredDistance(A + AB * (VB * Denominator) + AC * (VC * Denominator));
+    }
+
+    const FVector& GetPosition(const float* Positions, uint32 PositionStride, uint32 Vertex)
+    {
+        return *reinterpret_cast<const FVector*>(reinterpret_cast<const uint8*>(Positions) + static_cast<size_t>(Vertex) * PositionStride);
+    }
+
+    /** From 삼각형들 위의 표본점에서 To 삼각형들까지 가장 먼 거리 */
+    float MeasureOneSided(const uint32* From, int32 NumFrom, const uint32* To, int32 NumTo, const float* Positions, uint32 PositionStride)
+    {
+        double MaxDistanceSquared = 0.0;
+        for (int32 Index = 0; Index < NumFrom; Index += 3)
+        {
+            const FVectorD A = GetPosition(Positions, PositionStride, From[Index + 0]);
+            const FVectorD B = GetPosition(Positions, PositionStride, From[Index + 1]);
+            const FVectorD C = GetPosition(Positions, PositionStride, From[Index + 2]);
+            const FVectorD Samples[7] = { A, B, C, (A + B) * 0.5, (B + C) * 0.5, (C + A) * 0.5, (A + B + C) * (1.0 / 3.0) };
+
+            for (const FVectorD& Sample : Samples)
+            {
+                double BestDistanceSquared = DBL_MAX;
+                for (int32 Other = 0; Other < NumTo && BestDistanceSquared > 0.0; Other += 3)
+                {
+                    BestDistanceSquared = FMath::Min(BestDistanceSquared, SquaredDistanceToTriangle(
+                        Sample,
+                        GetPosition(Positions, PositionStride, To[Other + 0]),
+                        GetPosition(Positions, PositionStride, To[Other + 1]),
+                        GetPosition(Positions, PositionStride, To[Other + 2])
+                    ));
+                }
+                MaxDistanceSquared = FMath::Max(MaxDistanceSquared, BestDistanceSquared);
+            }
+        }
+        return static_cast<float>(std::sqrt(MaxDistanceSquared));
+    }
+
+    /** 인덱스 범위, 퇴화 삼각형, 원래 면 방향(Facing)과 반대로 뒤집힌 삼각형을 확인 */
+    void ValidateTopology(const FTestMesh& Mesh, const TArray<uint32>& Indices, const FString& Name, bool bSphere, TArray<FString>& OutFailures)
+    {
+        for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+        {
+            if (Indices[Index] >= static_cast<uint32>(Mesh.Vertices.Num())
+                || Indices[Index + 1] >= static_cast<uint32>(Mesh.Vertices.Num())
+                || Indices[Index + 2] >= static_cast<uint32>(Mesh.Vertices.Num()))
+            {
+                OutFailures.Add(Name + TEXT(": index out of range"));
+                return;
+            }
+
+            const FVector& A = Mesh.Vertices[Indices[Index + 0]].Position;
+            const FVector& B = Mesh.Vertices[Indices[Index + 1]].Position;
+            const FVector& C = Mesh.Vertices[Indices[Index + 2]].Position;
+            if (A == B || B == C || C == A)
+            {
+                OutFailures.Add(Name + TEXT(": degenerate triangle"));
+                return;
+            }
+
+            const FVector Normal = (B - A) ^ (C - A);
+            const FVector Facing = bSphere ? (A + B + C) : FVector(0.0f, 0.0f, 1.0f);
+            if ((Normal | Facing) <= 0.0f)
+            {
+                OutFailures.Add(Name + TEXT(": flipped triangle"));
+                return;
+            }
+        }
+    }
+
+    FMeshSimplifierTestResult RunCase(
+        const FString& Name, const FTestMesh& Mesh, float TargetRatio, float TargetError, bool bLockBorders, TArray<uint32>& OutIndices
+    )
+    {
+        FMeshSimplifierTestResult Result;
+        Result.Name = Name;
+        Result.NumTrianglesBefore = Mesh.Indices.Num() / 3;
+        Result.TargetError = TargetError;
+
+        OutIndices = Mesh.Indices;
+        const int32 TargetIndexCount = static_cast<int32>(Mesh.Indices.Num() / 3 * TargetRatio) * 3;
+
+        const auto StartTime = std::chrono::steady_clock::now();
+        const int32 NumIndices = FMeshSimplifier::Simplify(
+            OutIndices.GetData(), OutIndices.Num(), &Mesh.Vertices[0].Position.X, Mesh.Vertices.Num(), sizeof(FTestVertex),
+            GetAttributes(Mesh), TargetIndexCount, TargetError, bLockBorders, &Result.ReportedError
+        );
+        Result.SimplifyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+        OutIndices.SetNum(NumIndices);
+        Result.NumTrianglesAfter = NumIndices / 3;
+
+        const float* Positions = &Mesh.Vertices[0].Position.X;
+        const float Scale = FMeshSimplifier::ComputeScale(Mesh.Indices.GetData(), Mesh.Indices.Num(), Positions, sizeof(FTestVertex));
+        Result.MeasuredError = FMeshSimplifierTest::MeasureDeviation(
+            Mesh.Indices.GetData(), Mesh.Indices.Num(), OutIndices.GetData(), OutIndices.Num(), Positions, sizeof(FTestVertex)
+        ) / Scale;
+        return Result;
+    }
+
+    void CheckErrorBound(const FMeshSimplifierTestResult& Result, TArray<FString>& OutFailures)
+    {
+        if (Result.ReportedError > Result.TargetError)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: reported error %g exceeds target %g"), *Result.Name, Result.ReportedError, Result.TargetError));
+        }
+
+        // 오차가 0인 붕괴만 했다면 실제 오차도 부동소수점 오차 수준이어야 함
+        const float Bound = FMath::Max(Result.ReportedError * FMeshSimplifierTest::MeasuredErrorTolerance, 1e-4f);
+        if (Result.MeasuredError > Bound)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: measured error %g exceeds bound %g"), *Result.Name, Result.MeasuredError, Bound));
+        }
+    }
+}
+
+bool FMeshSimplifierTest::Run(TArray<FMeshSimplifierTestResult>& OutResults, TArray<FString>& OutFailures)
+{
+    const int32 NumFailuresBefore = OutFailures.Num();
+    TArray<uint32> Indices;
+
+    // 평평한 면은 오차 없이 경계만 남을 때까지 줄어야 함
+    {
+        const FTestMesh Plane = MakePlane(32);
+        const FMeshSimplifierTestResult Result = RunCase(TEXT("Plane"), Plane, 0.0f, 1e-3f, false, Indices);
+        ValidateTopology(Plane, Indices, Result.Name, false, OutFailures);
+        CheckErrorBound(Result, OutFailures);
+        if (Result.NumTrianglesAfter * 20 > Result.NumTrianglesBefore)
+        {
+            OutFailures.Add(FString::Printf(TEXT("Plane: only reduced to %d / %d triangles"), Result.NumTrianglesAfter, Result.NumTrianglesBefore));
+        }
+        OutResults.Add(Result);
+    }
+
+    // 경계를 고정하면 원래 경계 정점이 모두 남아야 함
+    {
+        const int32 Size = 32;
+        const FTestMesh Plane = MakePlane(Size);
+        const FMeshSimplifierTestResult Result = RunCase(TEXT("Plane (locked border)"), Plane, 0.0f, 1e-3f, true, Indices);
+        ValidateTopology(Plane, Indices, Result.Name, false, OutFailures);
+        CheckErrorBound(Result, OutFailures);
+
+        TArray<uint8> bReferenced;
+        bReferenced.Init(0, Plane.Vertices.Num());
+        for (const uint32 Index : Indices)
+        {
+            bReferenced[Index] = 1;
+        }
+        for (int32 Vertex = 0; Vertex < Plane.Vertices.Num(); ++Vertex)
+        {
+            const FVector& Position = Plane.Vertices[Vertex].Position;
+            const bool bBorder = Position.X == 0.0f || Position.Y == 0.0f || Position.X == Size || Position.Y == Size;
+            if (bBorder && !bReferenced[Vertex])
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s: border vertex %d was removed"), *Result.Name, Vertex));
+                break;
+            }
+        }
+        OutResults.Add(Result);
+    }
+
+    // UV seam 양쪽의 정점이 섞이지 않아야 함
+    {
+        const FTestMesh Plane = MakePlane(32, 16);
+        const FMeshSimplifierTestResult Result = RunCase(TEXT("Plane (UV seam)"), Plane, 0.0f, 1e-3f, false, Indices);
+        ValidateTopology(Plane, Indices, Result.Name, false, OutFailures);
+        CheckErrorBound(Result, OutFailures);
+        for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+        {
+            const int32 Chart = Plane.Vertices[Indices[Index]].Chart;
+            if (Plane.Vertices[Indices[Index + 1]].Chart != Chart || Plane.Vertices[Indices[Index + 2]].Chart != Chart)
+            {
+                OutFailures.Add(Result.Name + TEXT(": triangle mixes vertices from both sides of the seam"));
+                break;
+            }
+        }
+        if (Result.NumTrianglesAfter * 10 > Result.NumTrianglesBefore)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: only reduced to %d / %d triangles"), *Result.Name, Result.NumTrianglesAfter, Result.NumTrianglesBefore));
+        }
+        OutResults.Add(Result);
+    }
+
+    const FTestMesh Sphere = MakeSphere(48, 24);
+
+    // 오차 한계만 주면 한계 안에서 최대한 줄임
+    for (const float TargetError : { 0.005f, 0.02f })
+    {
+        const FMeshSimplifierTestResult Result = RunCase(FString::Printf(TEXT("Sphere (error %g)"), TargetError), Sphere, 0.0f, TargetError, true, Indices);
+        ValidateTopology(Sphere, Indices, Result.Name, true, OutFailures);
+        CheckErrorBound(Result, OutFailures);
+        if (Result.NumTrianglesAfter >= Result.NumTrianglesBefore)
+        {
+            OutFailures.Add(Result.Name + TEXT(": no triangles were removed"));
+        }
+        OutResults.Add(Result);
+    }
+
+    // 삼각형 수 목표는 오차가 허용하는 한 지켜야 함
+    {
+        const FMeshSimplifierTestResult Result = RunCase(TEXT("Sphere (25%)"), Sphere, 0.25f, 1.0f, true, Indices);
+        ValidateTopology(Sphere, Indices, Result.Name, true, OutFailures);
+        CheckErrorBound(Result, OutFailures);
+        if (Result.NumTrianglesAfter > Result.NumTrianglesBefore / 4)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: %d triangles left, target %d"), *Result.Name, Result.NumTrianglesAfter, Result.NumTrianglesBefore / 4));
+        }
+        OutResults.Add(Result);
+    }
+
+    // 곡면은 오차 0으로 줄일 수 없음
+    {
+        const FMeshSimplifierTestResult Result = RunCase(TEXT("Sphere (error 0)"), Sphere, 0.0f, 0.0f, true, Indices);
+        ValidateTopology(Sphere, Indices, Result.Name, true, OutFailures);
+        if (Result.NumTrianglesAfter != Result.NumTrianglesBefore || Result.ReportedError != 0.0f)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: %d / %d triangles left, error %g"), *Result.Name, Result.NumTrianglesAfter, Result.NumTrianglesBefore, Result.ReportedError));
+        }
+        OutResults.Add(Result);
+    }
+
+    return OutFailures.Num() == NumFailuresBefore;
+}
+
+float FMeshSimplifierTest::MeasureDeviation(
+    const uint32* IndicesA, int32 NumIndicesA, const uint32* IndicesB, int32 NumIndicesB, const float* Positions, uint32 PositionStride
+)
+{
+    if (NumIndicesA == 0 || NumIndicesB == 0)
+    {
+        return NumIndicesA == NumIndicesB ? 0.0f : FLT_MAX;
+    }
+
+    return FMath::Max(
+        MeasureOneSided(IndicesA, NumIndicesA, IndicesB, NumIndicesB, Positions, PositionStride),
+        MeasureOneSided(IndicesB, NumIndicesB, IndicesA, NumIndicesA, Positions, PositionStride)
+    );
+}
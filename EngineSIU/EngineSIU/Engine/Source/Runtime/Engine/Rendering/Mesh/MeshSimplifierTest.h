@@ -0,0 +1,36 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FMeshSimplifierTestResult
+{
+    FString Name;
+    int32 NumTrianglesBefore = 0;
+    int32 NumTrianglesAfter = 0;
+
+    float TargetError = 0.0f;
+    float ReportedError = 0.0f;     // FMeshSimplifier::Simplify가 돌려준 오차
+    float MeasuredError = 0.0f;     // 원래 표면과 단순화한 표면 사이의 최대 거리 (메시 크기 대비, 양방향)
+    double SimplifyMs = 0.0;
+};
+
+/**
+ * FMeshSimplifier 검증. 콘솔의 "meshlod test"와 엔진 초기화 전의 -meshopt에서 호출합니다.
+ * 절차적으로 만든 평면 / 구 / seam이 있는 평면을 단순화하고 오차 한계, 목표 삼각형 수, 인덱스 유효성, 뒤집힌 면, seam 보존을 확인합니다.
+ */
+struct FMeshSimplifierTest
+{
+    /** 실제 오차가 보고된 오차의 이 배수 안이어야 함. QEM은 평균에 가까운 값을 주므로 최대 거리와는 차이가 있음 */
+    static constexpr float MeasuredErrorTolerance = 3.0f;
+
+    static bool Run(TArray<FMeshSimplifierTestResult>& OutResults, TArray<FString>& OutFailures);
+
+    /**
+     * 두 삼각형 집합 사이의 최대 거리. 각 집합의 정점, 모서리 중점, 중심에서 다른 집합의 가장 가까운 삼각형까지 잽니다.
+     * 전수 비교이므로 테스트 크기의 메시에만 씁니다.
+     */
+    static float MeasureDeviation(
+        const uint32* IndicesA, int32 NumIndicesA, const uint32* IndicesB, int32 NumIndicesB, const float* Positions, uint32 PositionStride
+    );
+};
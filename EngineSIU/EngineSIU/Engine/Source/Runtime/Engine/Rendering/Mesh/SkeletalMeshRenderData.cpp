@@ -1,6 +1,7 @@
 #include "SkeletalMeshRenderData.h"
 
 #include "UObject/Object.h"
+#include "Math/MathBatch.h"
 void FSkeletalMeshRenderData::UpdateReferencePoseFromLocal()
 {
     const int32 BoneCount = LocalBindPose.Num();
@@ -31,7 +32,8 @@ void FSkeletalMeshRenderData::UpdateVerticesFromNewBindPose()
     TArray<FMatrix> Delta; Delta.SetNum(BoneCount);
     for (int32 i = 0; i < BoneCount; ++i)
     {
-        Delta[i] = FMatrix::Inverse(OrigineReferencePose[i]) * ReferencePose[i]  ;
+        FMathBatch::InverseAffine(OrigineReferencePose[i], Delta[i]);
+        Delta[i] = Delta[i] * ReferencePose[i];
     }
     
     for (int32 vi = 0; vi < VCount; ++vi)
@@ -1,4 +1,5 @@
 #include "StaticMesh.h"
+#include "StaticMeshVertexPacking.h"
 #include "Engine/ObjLoader.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
@@ -17,6 +18,15 @@ UStaticMesh::~UStaticMesh()
         staticMeshRenderData->IndexBuffer->Release();
         staticMeshRenderData->IndexBuffer = nullptr;
     }
+
+    for (FStaticMeshLODResource& LOD : staticMeshRenderData->LODs)
+    {
+        if (LOD.IndexBuffer)
+        {
+            LOD.IndexBuffer->Release();
+            LOD.IndexBuffer = nullptr;
+        }
+    }
 }
 
 UObject* UStaticMesh::Duplicate(UObject* InOuter)
@@ -50,12 +60,32 @@ void UStaticMesh::SetData(FStaticMeshRenderData* renderData)
 
     uint32 verticeNum = staticMeshRenderData->Vertices.Num();
     if (verticeNum <= 0) return;
-    staticMeshRenderData->VertexBuffer = FEngineLoop::Renderer.CreateImmutableVertexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Vertices);
+    if (staticMeshRenderData->VertexFormat == EStaticMeshVertexFormat::Packed)
+    {
+        TArray<FPackedStaticMeshVertex> PackedVertices;
+        FStaticMeshVertexPacking::PackVertices(*staticMeshRenderData, PackedVertices);
+        staticMeshRenderData->VertexBuffer = FEngineLoop::Renderer.CreateImmutableVertexBuffer(staticMeshRenderData->DisplayName, PackedVertices);
+    }
+    else
+    {
+        staticMeshRenderData->VertexBuffer = FEngineLoop::Renderer.CreateImmutableVertexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Vertices);
+    }
 
     uint32 indexNum = staticMeshRenderData->Indices.Num();
     if (indexNum > 0)
         staticMeshRenderData->IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Indices);
 
+    // LOD는 정점 버퍼를 같이 쓰고 인덱스 버퍼만 따로 만듦
+    for (int32 LODIndex = 0; LODIndex < staticMeshRenderData->LODs.Num(); ++LODIndex)
+    {
+        FStaticMeshLODResource& LOD = staticMeshRenderData->LODs[LODIndex];
+        if (LOD.Indices.Num() > 0)
+        {
+            const FString BufferName = staticMeshRenderData->DisplayName + FString::Printf(TEXT("_LOD%d"), LODIndex + 1);
+            LOD.IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(BufferName, LOD.Indices);
+        }
+    }
+
     for (int materialIndex = 0; materialIndex < staticMeshRenderData->Materials.Num(); materialIndex++) {
         FMaterialSlot* newMaterialSlot = new FMaterialSlot();
         UMaterial* newMaterial = UMaterial::CreateMaterial(staticMeshRenderData->Materials[materialIndex]);
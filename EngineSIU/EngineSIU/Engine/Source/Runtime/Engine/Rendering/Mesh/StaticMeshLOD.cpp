@@ -0,0 +1,190 @@
+#include "StaticMeshLOD.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Math/MathUtility.h"
+
+int32 FStaticMeshLOD::ForcedLOD = INDEX_NONE;
+float FStaticMeshLOD::Hysteresis = FStaticMeshLOD::DefaultHysteresis;
+
+namespace
+{
+    // FStaticMeshVertex의 NormalX ~ V. 탄젠트는 노멀과 UV에서 나오므로 가중치 0
+    constexpr int32 NumLODAttributes = 8;
+    constexpr float LODAttributeWeights[NumLODAttributes] = { 0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f };
+
+    bool IsValidSubsetRange(const FMaterialSubset& Subset, int32 NumIndices)
+    {
+        return Subset.IndexCount % 3 == 0 && static_cast<uint64>(Subset.IndexStart) + Subset.IndexCount <= static_cast<uint64>(NumIndices);
+    }
+}
+
+void FStaticMeshLOD::BuildLODs(FStaticMeshRenderData& RenderData, const FStaticMeshLODSettings& Settings)
+{
+    RenderData.LODs.Empty();
+
+    const int32 NumVertices = RenderData.Vertices.Num();
+    const int32 NumIndices = RenderData.Indices.Num();
+    if (NumVertices == 0 || NumIndices == 0 || NumIndices % 3 != 0)
+    {
+        return;
+    }
+
+    // 서브셋이 없으면 전체를 하나로 보고, 결과도 서브셋 없이 둠
+    const bool bHasSubsets = RenderData.MaterialSubsets.Num() > 0;
+    TArray<FMaterialSubset> Subsets = RenderData.MaterialSubsets;
+    if (!bHasSubsets)
+    {
+        FMaterialSubset Subset;
+        Subset.IndexStart = 0;
+        Subset.IndexCount = NumIndices;
+        Subset.MaterialIndex = 0;
+        Subsets.Add(Subset);
+    }
+
+    for (const FMaterialSubset& Subset : Subsets)
+    {
+        if (!IsValidSubsetRange(Subset, NumIndices))
+        {
+            return;
+        }
+    }
+
+    const float* Positions = &RenderData.Vertices[0].X;
+    const uint32 Stride = sizeof(FStaticMeshVertex);
+
+    FMeshSimplifierAttributes Attributes;
+    Attributes.Data = &RenderData.Vertices[0].NormalX;
+    Attributes.Stride = Stride;
+    Attributes.Num = NumLODAttributes;
+    Attributes.Weights = LODAttributeWeights;
+
+    const float MeshScale = FMeshSimplifier::ComputeScale(RenderData.Indices.GetData(), NumIndices, Positions, Stride);
+    const float Radius = (RenderData.BoundingBoxMax - RenderData.BoundingBoxMin).Length() * 0.5f;
+    if (MeshScale <= 0.0f)
+    {
+        return;
+    }
+
+    // Simplify의 오차는 넘긴 인덱스의 크기 기준이므로 서브셋마다 메시 크기 기준으로 환산
+    TArray<float> SubsetScales;
+    for (const FMaterialSubset& Subset : Subsets)
+    {
+        SubsetScales.Add(FMeshSimplifier::ComputeScale(&RenderData.Indices[Subset.IndexStart], Subset.IndexCount, Positions, Stride));
+    }
+
+    TArray<uint32> Scratch;
+    int32 PreviousNumIndices = NumIndices;
+    float PreviousScreenSize = FLT_MAX;
+
+    const int32 NumLODs = FMath::Min(Settings.MaxLODs, MaxLODCount);
+    for (int32 LODIndex = 1; LODIndex < NumLODs; ++LODIndex)
+    {
+        const float TriangleRatio = std::pow(Settings.TriangleRatio, static_cast<float>(LODIndex));
+
+        FStaticMeshLODResource LOD;
+        LOD.Indices.Reserve(static_cast<int32>(NumIndices * TriangleRatio) + 3 * Subsets.Num());
+
+        // 매번 LOD0에서 시작해야 보고된 오차가 LOD0 기준이 됨
+        for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+        {
+            const FMaterialSubset& Subset = Subsets[SubsetIndex];
+            const float SubsetScale = SubsetScales[SubsetIndex];
+
+            Scratch.SetNum(Subset.IndexCount);
+            std::copy_n(&RenderData.Indices[Subset.IndexStart], Subset.IndexCount, Scratch.GetData());
+
+            int32 NumSubsetIndices = Scratch.Num();
+            if (SubsetScale > 0.0f && NumSubsetIndices > 0)
+            {
+                float SubsetError = 0.0f;
+                NumSubsetIndices = FMeshSimplifier::Simplify(
+                    Scratch.GetData(), Scratch.Num(), Positions, NumVertices, Stride, Attributes,
+                    static_cast<int32>(Scratch.Num() / 3 * TriangleRatio) * 3, Settings.MaxError * MeshScale / SubsetScale, true, &SubsetError
+                );
+                LOD.Error = FMath::Max(LOD.Error, SubsetError * SubsetScale / MeshScale);
+            }
+
+            FMaterialSubset LODSubset = Subset;
+            LODSubset.IndexStart = LOD.Indices.Num();
+            LODSubset.IndexCount = NumSubsetIndices;
+            LOD.MaterialSubsets.Add(LODSubset);
+
+            for (int32 Index = 0; Index < NumSubsetIndices; ++Index)
+            {
+                LOD.Indices.Add(Scratch[Index]);
+            }
+        }
+
+        if (LOD.Indices.Num() > static_cast<int32>(PreviousNumIndices * (1.0f - Settings.MinReduction)))
+        {
+            break;
+        }
+
+        // 정점 버퍼를 같이 쓰므로 정점 순서는 그대로 두고 삼각형 순서만 정렬
+        FMeshOptimizer::OptimizeTriangleOrder(LOD.Indices.GetData(), LOD.Indices.Num(), LOD.MaterialSubsets, Positions, NumVertices, Stride);
+
+        // 화면에서 오차 = Error * MeshScale / 거리 * cot(FOV / 2) * 높이 / 2, ScreenSize = Radius / 거리 * cot(FOV / 2)
+        const float WorldError = LOD.Error * MeshScale;
+        LOD.ScreenSize = WorldError > 0.0f ? 2.0f * Settings.PixelError * Radius / (WorldError * Settings.ReferenceHeight) : FLT_MAX;
+        LOD.ScreenSize = FMath::Min(LOD.ScreenSize, PreviousScreenSize);
+
+        if (!bHasSubsets)
+        {
+            LOD.MaterialSubsets.Empty();
+        }
+
+        PreviousNumIndices = LOD.Indices.Num();
+        PreviousScreenSize = LOD.ScreenSize;
+        RenderData.LODs.Add(std::move(LOD));
+    }
+}
+
+float FStaticMeshLOD::ComputeScreenSize(const FVector& Center, float Radius, const FVector& ViewLocation, const FMatrix& Projection, bool bPerspective)
+{
+    const float ProjectionScale = Projection.M[1][1];
+    if (!bPerspective)
+    {
+        return Radius * ProjectionScale;
+    }
+
+    // 카메라가 구 안에 있으면 가장 자세한 LOD
+    const float Distance = (Center - ViewLocation).Length();
+    if (Distance <= Radius)
+    {
+        return FLT_MAX;
+    }
+    return Radius * ProjectionScale / Distance;
+}
+
+int32 FStaticMeshLOD::SelectLOD(const FStaticMeshRenderData& RenderData, float ScreenSize, int32 CurrentLOD)
+{
+    const int32 NumLODs = RenderData.GetNumLODs();
+    if (ForcedLOD >= 0)
+    {
+        return FMath::Min(ForcedLOD, NumLODs - 1);
+    }
+
+    // ScreenSize는 LOD가 내려갈수록 작아짐
+    // MinLOD: 경계보다 확실히 작아서 적어도 이만큼은 내려가야 하는 LOD, MaxLOD: 히스테리시스 구간까지 포함해 내려갈 수 있는 LOD
+    int32 MinLOD = 0;
+    int32 MaxLOD = 0;
+    for (int32 LODIndex = 1; LODIndex < NumLODs; ++LODIndex)
+    {
+        const float Threshold = RenderData.LODs[LODIndex - 1].ScreenSize;
+        if (ScreenSize < Threshold * (1.0f + Hysteresis))
+        {
+            MaxLOD = LODIndex;
+        }
+        if (ScreenSize < Threshold * (1.0f - Hysteresis))
+        {
+            MinLOD = LODIndex;
+        }
+    }
+
+    return FMath::Clamp(CurrentLOD, MinLOD, MaxLOD);
+}
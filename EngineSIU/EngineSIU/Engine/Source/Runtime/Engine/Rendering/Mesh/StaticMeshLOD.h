@@ -0,0 +1,47 @@
+#pragma once
+#include "Define.h"
+
+struct FStaticMeshLODSettings
+{
+    int32 MaxLODs = 4;                  // LOD0 포함
+    float TriangleRatio = 0.5f;         // LOD가 하나 내려갈 때마다 목표 삼각형 비율
+    float MaxError = 0.05f;             // 메시 크기(바운드의 가장 긴 변) 대비 허용 오차
+    float MinReduction = 0.1f;          // 이전 LOD보다 이 비율만큼도 줄지 않으면 더 만들지 않음
+
+    // ScreenSize 계산 기준. ReferenceHeight 픽셀 높이의 화면에서 오차가 PixelError 픽셀 이하가 되는 크기부터 씀
+    float PixelError = 1.0f;
+    float ReferenceHeight = 1080.0f;
+};
+
+/**
+ * StaticMesh LOD 생성과 선택
+ *
+ * 임포트할 때 FMeshSimplifier로 LOD0의 서브셋마다 단순화해 FStaticMeshRenderData::LODs를 채웁니다.
+ * 서브셋의 경계는 고정하므로 머티리얼 사이에 틈이 생기지 않고, LOD는 LOD0의 정점 버퍼를 같이 씁니다.
+ * 그릴 때는 바운딩 구의 화면 크기로 LOD를 고르고, 경계에서 깜빡이지 않도록 히스테리시스를 둡니다.
+ */
+struct FStaticMeshLOD
+{
+    static constexpr float DefaultHysteresis = 0.1f;
+
+    /** LOD0를 포함한 LOD 수의 상한. FStaticMeshLODSettings::MaxLODs가 더 커도 여기까지만 만들고, .bin 캐시를 읽을 때도 이 값으로 검사 */
+    static constexpr int32 MaxLODCount = 8;
+
+    /** 0 이상이면 모든 컴포넌트가 이 LOD(메시의 LOD 수를 넘으면 마지막 LOD)를 씀. 콘솔의 "meshlod force" */
+    static int32 ForcedLOD;
+
+    /** ScreenSize 경계의 위아래로 이 비율만큼은 이전 LOD를 유지. 콘솔의 "meshlod hysteresis" */
+    static float Hysteresis;
+
+    /** LODs를 새로 만듭니다. 정점 / 인덱스 / 서브셋과 바운드가 채워져 있어야 합니다. */
+    static void BuildLODs(FStaticMeshRenderData& RenderData, const FStaticMeshLODSettings& Settings = FStaticMeshLODSettings());
+
+    /**
+     * 바운딩 구의 화면 크기. 반지름이 화면 높이의 절반에서 차지하는 비율입니다.
+     * @param Projection M[1][1]이 원근 투영에서는 cot(FOV / 2), 직교 투영에서는 2 / 높이인 투영 행렬
+     */
+    static float ComputeScreenSize(const FVector& Center, float Radius, const FVector& ViewLocation, const FMatrix& Projection, bool bPerspective);
+
+    /** 화면 크기에 맞는 LOD. 히스테리시스 구간 안에서는 CurrentLOD를 유지합니다. */
+    static int32 SelectLOD(const FStaticMeshRenderData& RenderData, float ScreenSize, int32 CurrentLOD);
+};
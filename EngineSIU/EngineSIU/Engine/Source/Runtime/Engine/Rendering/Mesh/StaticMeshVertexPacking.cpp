@@ -0,0 +1,312 @@
+#include "StaticMeshVertexPacking.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "Math/MathUtility.h"
+
+namespace
+{
+    constexpr float UNormMax = 65535.0f;
+    constexpr float SNormMax = 32767.0f;
+
+    // FObjLoader::ConvertToStaticMesh의 기본 색
+    constexpr float DefaultVertexColor = 0.7f;
+
+    uint16 QuantizeUNorm(float Value, float Min, float Extent)
+    {
+        if (Extent <= 0.0f)
+        {
+            return 0;
+        }
+        const float Normalized = FMath::Clamp((Value - Min) / Extent, 0.0f, 1.0f);
+        return static_cast<uint16>(std::lround(Normalized * UNormMax));
+    }
+
+    float DequantizeUNorm(uint16 Value, float Min, float Extent)
+    {
+        return Min + Extent * (static_cast<float>(Value) / UNormMax);
+    }
+
+    int16 QuantizeSNorm(float Value)
+    {
+        return static_cast<int16>(std::lround(FMath::Clamp(Value, -1.0f, 1.0f) * SNormMax));
+    }
+
+    // D3D의 SNORM 변환과 같음: -32768과 -32767은 모두 -1
+    float DequantizeSNorm(int16 Value)
+    {
+        return FMath::Max(static_cast<float>(Value) / SNormMax, -1.0f);
+    }
+
+    float AngleDegrees(const FVector& A, const FVector& B)
+    {
+        const FVector NormalA = A.GetSafeNormal();
+        const FVector NormalB = B.GetSafeNormal();
+        const float Cosine = FMath::Clamp(NormalA | NormalB, -1.0f, 1.0f);
+        return FMath::RadiansToDegrees(std::acos(Cosine));
+    }
+}
+
+void FStaticMeshVertexPackingStats::Accumulate(const FStaticMeshVertexPackingStats& Other)
+{
+    NumVertices += Other.NumVertices;
+    FloatBytes += Other.FloatBytes;
+    PackedBytes += Other.PackedBytes;
+    MaxPositionError = FMath::Max(MaxPositionError, Other.MaxPositionError);
+    MaxNormalErrorDegrees = FMath::Max(MaxNormalErrorDegrees, Other.MaxNormalErrorDegrees);
+    MaxTangentErrorDegrees = FMath::Max(MaxTangentErrorDegrees, Other.MaxTangentErrorDegrees);
+    MaxUVError = FMath::Max(MaxUVError, Other.MaxUVError);
+    NumMaterialIndexMismatches += Other.NumMaterialIndexMismatches;
+}
+
+FPackedStaticMeshVertex FStaticMeshVertexPacking::Pack(const FStaticMeshVertex& Vertex, const FVector& BoundsMin, const FVector& BoundsMax)
+{
+    const FVector Extent = BoundsMax - BoundsMin;
+
+    FPackedStaticMeshVertex Packed = {};
+    Packed.X = QuantizeUNorm(Vertex.X, BoundsMin.X, Extent.X);
+    Packed.Y = QuantizeUNorm(Vertex.Y, BoundsMin.Y, Extent.Y);
+    Packed.Z = QuantizeUNorm(Vertex.Z, BoundsMin.Z, Extent.Z);
+    EncodeOctahedral(FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ), Packed.NormalX, Packed.NormalY);
+    EncodeOctahedral(FVector(Vertex.TangentX, Vertex.TangentY, Vertex.TangentZ), Packed.TangentX, Packed.TangentY);
+    Packed.U = FloatToHalf(Vertex.U);
+    Packed.V = FloatToHalf(Vertex.V);
+    return Packed;
+}
+
+FStaticMeshVertex FStaticMeshVertexPacking::Unpack(const FPackedStaticMeshVertex& Vertex, const FVector& BoundsMin, const FVector& BoundsMax)
+{
+    const FVector Extent = BoundsMax - BoundsMin;
+    const FVector Normal = DecodeOctahedral(Vertex.NormalX, Vertex.NormalY);
+    const FVector Tangent = DecodeOctahedral(Vertex.TangentX, Vertex.TangentY);
+
+    FStaticMeshVertex Unpacked = {};
+    Unpacked.X = DequantizeUNorm(Vertex.X, BoundsMin.X, Extent.X);
+    Unpacked.Y = DequantizeUNorm(Vertex.Y, BoundsMin.Y, Extent.Y);
+    Unpacked.Z = DequantizeUNorm(Vertex.Z, BoundsMin.Z, Extent.Z);
+    Unpacked.R = DefaultVertexColor;
+    Unpacked.G = DefaultVertexColor;
+    Unpacked.B = DefaultVertexColor;
+    Unpacked.A = 1.0f;
+    Unpacked.NormalX = Normal.X;
+    Unpacked.NormalY = Normal.Y;
+    Unpacked.NormalZ = Normal.Z;
+    Unpacked.TangentX = Tangent.X;
+    Unpacked.TangentY = Tangent.Y;
+    Unpacked.TangentZ = Tangent.Z;
+    Unpacked.U = HalfToFloat(Vertex.U);
+    Unpacked.V = HalfToFloat(Vertex.V);
+    Unpacked.MaterialIndex = 0;
+    return Unpacked;
+}
+
+void FStaticMeshVertexPacking::PackVertices(const FStaticMeshRenderData& RenderData, TArray<FPackedStaticMeshVertex>& OutVertices)
+{
+    OutVertices.SetNum(RenderData.Vertices.Num());
+    for (int32 Index = 0; Index < RenderData.Vertices.Num(); ++Index)
+    {
+        OutVertices[Index] = Pack(RenderData.Vertices[Index], RenderData.BoundingBoxMin, RenderData.BoundingBoxMax);
+    }
+}
+
+void FStaticMeshVertexPacking::UnpackVertices(const TArray<FPackedStaticMeshVertex>& Vertices, FStaticMeshRenderData& OutRenderData)
+{
+    OutRenderData.Vertices.SetNum(Vertices.Num());
+    for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+    {
+        OutRenderData.Vertices[Index] = Unpack(Vertices[Index], OutRenderData.BoundingBoxMin, OutRenderData.BoundingBoxMax);
+    }
+
+    // 로더처럼 인덱스마다 그 인덱스를 포함하는 첫 서브셋을 찾음. 뒤 서브셋부터 채워서 앞 서브셋이 남게 함
+    const int32 NumIndices = OutRenderData.Indices.Num();
+    TArray<uint32> IndexMaterials;
+    IndexMaterials.SetNum(NumIndices);
+    std::memset(IndexMaterials.GetData(), 0, sizeof(uint32) * NumIndices);
+    for (int32 SubsetIndex = OutRenderData.MaterialSubsets.Num() - 1; SubsetIndex >= 0; --SubsetIndex)
+    {
+        const FMaterialSubset& Subset = OutRenderData.MaterialSubsets[SubsetIndex];
+        const uint32 End = FMath::Min(Subset.IndexStart + Subset.IndexCount, static_cast<uint32>(NumIndices));
+        for (uint32 Index = Subset.IndexStart; Index < End; ++Index)
+        {
+            IndexMaterials[Index] = Subset.MaterialIndex;
+        }
+    }
+
+    // 정점은 처음 나온 면의 MaterialIndex를 가짐
+    TArray<uint8> bAssigned;
+    bAssigned.SetNum(Vertices.Num());
+    std::memset(bAssigned.GetData(), 0, bAssigned.Num());
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        const uint32 VertexIndex = OutRenderData.Indices[Index];
+        if (VertexIndex < static_cast<uint32>(Vertices.Num()) && !bAssigned[VertexIndex])
+        {
+            OutRenderData.Vertices[VertexIndex].MaterialIndex = IndexMaterials[Index];
+            bAssigned[VertexIndex] = 1;
+        }
+    }
+}
+
+FMatrix FStaticMeshVertexPacking::GetPositionMatrix(const FStaticMeshRenderData& RenderData)
+{
+    if (RenderData.VertexFormat != EStaticMeshVertexFormat::Packed)
+    {
+        return FMatrix::Identity;
+    }
+
+    const FVector Extent = RenderData.BoundingBoxMax - RenderData.BoundingBoxMin;
+    FMatrix Result = FMatrix::CreateScaleMatrix(Extent.X, Extent.Y, Extent.Z);
+    Result.M[3][0] = RenderData.BoundingBoxMin.X;
+    Result.M[3][1] = RenderData.BoundingBoxMin.Y;
+    Result.M[3][2] = RenderData.BoundingBoxMin.Z;
+    return Result;
+}
+
+uint32 FStaticMeshVertexPacking::GetStride(EStaticMeshVertexFormat Format)
+{
+    return Format == EStaticMeshVertexFormat::Packed ? sizeof(FPackedStaticMeshVertex) : sizeof(FStaticMeshVertex);
+}
+
+FStaticMeshVertexPackingStats FStaticMeshVertexPacking::Measure(const FStaticMeshRenderData& RenderData)
+{
+    FStaticMeshVertexPackingStats Stats;
+    Stats.NumVertices = RenderData.Vertices.Num();
+    Stats.FloatBytes = static_cast<uint64>(Stats.NumVertices) * sizeof(FStaticMeshVertex);
+    Stats.PackedBytes = static_cast<uint64>(Stats.NumVertices) * sizeof(FPackedStaticMeshVertex);
+
+    TArray<FPackedStaticMeshVertex> Packed;
+    PackVertices(RenderData, Packed);
+
+    FStaticMeshRenderData RoundTrip;
+    RoundTrip.Indices = RenderData.Indices;
+    RoundTrip.MaterialSubsets = RenderData.MaterialSubsets;
+    RoundTrip.BoundingBoxMin = RenderData.BoundingBoxMin;
+    RoundTrip.BoundingBoxMax = RenderData.BoundingBoxMax;
+    UnpackVertices(Packed, RoundTrip);
+
+    for (int32 Index = 0; Index < Stats.NumVertices; ++Index)
+    {
+        const FStaticMeshVertex& Original = RenderData.Vertices[Index];
+        const FStaticMeshVertex& Result = RoundTrip.Vertices[Index];
+
+        const float PositionError = FVector::Distance(FVector(Original.X, Original.Y, Original.Z), FVector(Result.X, Result.Y, Result.Z));
+        Stats.MaxPositionError = FMath::Max(Stats.MaxPositionError, PositionError);
+
+        // 노멀이 없는 OBJ는 0 벡터이므로 비교하지 않음
+        const FVector OriginalNormal(Original.NormalX, Original.NormalY, Original.NormalZ);
+        if (OriginalNormal.SquaredLength() > SMALL_NUMBER)
+        {
+            Stats.MaxNormalErrorDegrees = FMath::Max(Stats.MaxNormalErrorDegrees, AngleDegrees(OriginalNormal, FVector(Result.NormalX, Result.NormalY, Result.NormalZ)));
+        }
+        const FVector OriginalTangent(Original.TangentX, Original.TangentY, Original.TangentZ);
+        if (OriginalTangent.SquaredLength() > SMALL_NUMBER)
+        {
+            Stats.MaxTangentErrorDegrees = FMath::Max(Stats.MaxTangentErrorDegrees, AngleDegrees(OriginalTangent, FVector(Result.TangentX, Result.TangentY, Result.TangentZ)));
+        }
+
+        Stats.MaxUVError = FMath::Max(Stats.MaxUVError, FMath::Max(std::abs(Original.U - Result.U), std::abs(Original.V - Result.V)));
+
+        if (Original.MaterialIndex != Result.MaterialIndex)
+        {
+            ++Stats.NumMaterialIndexMismatches;
+        }
+    }
+    return Stats;
+}
+
+void FStaticMeshVertexPacking::EncodeOctahedral(const FVector& Direction, int16& OutX, int16& OutY)
+{
+    const float L1Norm = std::abs(Direction.X) + std::abs(Direction.Y) + std::abs(Direction.Z);
+    if (L1Norm <= 0.0f)
+    {
+        OutX = 0;
+        OutY = 0;
+        return;
+    }
+
+    float X = Direction.X / L1Norm;
+    float Y = Direction.Y / L1Norm;
+
+    // 아래 반구는 대각선으로 접어서 바깥 삼각형에 둠
+    if (Direction.Z < 0.0f)
+    {
+        const float FoldedX = (1.0f - std::abs(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+        const float FoldedY = (1.0f - std::abs(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+        X = FoldedX;
+        Y = FoldedY;
+    }
+
+    OutX = QuantizeSNorm(X);
+    OutY = QuantizeSNorm(Y);
+}
+
+FVector FStaticMeshVertexPacking::DecodeOctahedral(int16 X, int16 Y)
+{
+    FVector Direction(DequantizeSNorm(X), DequantizeSNorm(Y), 0.0f);
+    Direction.Z = 1.0f - std::abs(Direction.X) - std::abs(Direction.Y);
+
+    const float Fold = FMath::Max(-Direction.Z, 0.0f);
+    Direction.X += Direction.X >= 0.0f ? -Fold : Fold;
+    Direction.Y += Direction.Y >= 0.0f ? -Fold : Fold;
+    return Direction.GetSafeNormal();
+}
+
+uint16 FStaticMeshVertexPacking::FloatToHalf(float Value)
+{
+    uint32 Bits;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+
+    const uint32 Sign = (Bits >> 16) & 0x8000;
+    Bits &= 0x7fffffff;
+
+    uint32 Result;
+    if (Bits >= 0x47800000)
+    {
+        // half로 표현할 수 없는 값은 Inf, NaN은 NaN
+        Result = Bits > 0x7f800000 ? 0x7e00 : 0x7c00;
+    }
+    else if (Bits < 0x38800000)
+    {
+        // 비정규 수: 0.5를 더해 가수 위치를 맞춘 뒤 빼서 반올림
+        float Denormal;
+        std::memcpy(&Denormal, &Bits, sizeof(Denormal));
+        Denormal += 0.5f;
+        std::memcpy(&Result, &Denormal, sizeof(Result));
+        Result -= 0x3f000000;
+    }
+    else
+    {
+        // 지수를 옮기고 가장 가까운 짝수로 반올림
+        const uint32 MantissaOdd = (Bits >> 13) & 1;
+        Bits += (static_cast<uint32>(15 - 127) << 23) + 0xfff + MantissaOdd;
+        Result = Bits >> 13;
+    }
+    return static_cast<uint16>(Result | Sign);
+}
+
+float FStaticMeshVertexPacking::HalfToFloat(uint16 Value)
+{
+    const uint32 Sign = static_cast<uint32>(Value & 0x8000) << 16;
+    const uint32 Exponent = (Value >> 10) & 0x1f;
+    const uint32 Mantissa = Value & 0x3ff;
+
+    uint32 Bits;
+    if (Exponent == 0)
+    {
+        const float Magnitude = std::ldexp(static_cast<float>(Mantissa), -24);
+        return Sign ? -Magnitude : Magnitude;
+    }
+    if (Exponent == 0x1f)
+    {
+        Bits = Sign | 0x7f800000 | (Mantissa << 13);
+    }
+    else
+    {
+        Bits = Sign | ((Exponent + 112) << 23) | (Mantissa << 13);
+    }
+
+    float Result;
+    std::memcpy(&Result, &Bits, sizeof(Result));
+    return Result;
+}
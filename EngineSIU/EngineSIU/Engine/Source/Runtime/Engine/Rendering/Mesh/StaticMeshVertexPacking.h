@@ -0,0 +1,55 @@
+#pragma once
+#include "Define.h"
+
+/** 압축했다가 다시 푼 정점과 원래 정점의 차이 */
+struct FStaticMeshVertexPackingStats
+{
+    int32 NumVertices = 0;
+    uint64 FloatBytes = 0;
+    uint64 PackedBytes = 0;
+
+    float MaxPositionError = 0.0f;          // 로컬 공간 거리
+    float MaxNormalErrorDegrees = 0.0f;
+    float MaxTangentErrorDegrees = 0.0f;
+    float MaxUVError = 0.0f;
+    int32 NumMaterialIndexMismatches = 0;   // MaterialSubsets로 복원한 MaterialIndex가 다른 정점 수
+
+    void Accumulate(const FStaticMeshVertexPackingStats& Other);
+};
+
+/**
+ * FStaticMeshVertex ↔ FPackedStaticMeshVertex 변환
+ *
+ * 위치는 메시 바운드 안의 [0, 1]로 저장하고, 셰이더에서는 GetPositionMatrix를 월드 행렬 앞에 곱해 복원합니다.
+ * 노멀과 탄젠트는 8면체 인코딩(ShaderRegisters.hlsl의 DecodeOctahedral과 같아야 함)을 사용합니다.
+ */
+struct FStaticMeshVertexPacking
+{
+    static FPackedStaticMeshVertex Pack(const FStaticMeshVertex& Vertex, const FVector& BoundsMin, const FVector& BoundsMax);
+
+    /** 색은 로더의 기본값, MaterialIndex는 0으로 채웁니다. */
+    static FStaticMeshVertex Unpack(const FPackedStaticMeshVertex& Vertex, const FVector& BoundsMin, const FVector& BoundsMax);
+
+    /** RenderData의 바운드를 기준으로 Vertices를 압축합니다. */
+    static void PackVertices(const FStaticMeshRenderData& RenderData, TArray<FPackedStaticMeshVertex>& OutVertices);
+
+    /**
+     * 압축된 정점을 풀어 OutRenderData.Vertices에 넣습니다.
+     * 바운드, Indices와 MaterialSubsets가 먼저 채워져 있어야 하며, MaterialIndex는 정점을 처음 쓰는 서브셋에서 가져옵니다.
+     */
+    static void UnpackVertices(const TArray<FPackedStaticMeshVertex>& Vertices, FStaticMeshRenderData& OutRenderData);
+
+    /** 정점 버퍼의 위치를 로컬 공간으로 옮기는 행렬. Float 형식이면 Identity */
+    static FMatrix GetPositionMatrix(const FStaticMeshRenderData& RenderData);
+
+    static uint32 GetStride(EStaticMeshVertexFormat Format);
+
+    /** 모든 정점을 압축했다가 풀어 보고 오차를 잽니다. */
+    static FStaticMeshVertexPackingStats Measure(const FStaticMeshRenderData& RenderData);
+
+    static void EncodeOctahedral(const FVector& Direction, int16& OutX, int16& OutY);
+    static FVector DecodeOctahedral(int16 X, int16 Y);
+
+    static uint16 FloatToHalf(float Value);
+    static float HalfToFloat(uint16 Value);
+};
@@ -0,0 +1,93 @@
+#include "TestMeshFixture.h"
+
+#include <cfloat>
+#include <cmath>
+
+#include "Math/MathUtility.h"
+
+void FTestMeshFixture::AddVertex(FStaticMeshRenderData& RenderData, const FVector& Position, const FVector& Normal)
+{
+    FStaticMeshVertex Vertex = {};
+    Vertex.X = Position.X;
+    Vertex.Y = Position.Y;
+    Vertex.Z = Position.Z;
+    Vertex.NormalX = Normal.X;
+    Vertex.NormalY = Normal.Y;
+    Vertex.NormalZ = Normal.Z;
+    RenderData.Vertices.Add(Vertex);
+}
+
+void FTestMeshFixture::ComputeBounds(FStaticMeshRenderData& RenderData)
+{
+    RenderData.BoundingBoxMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+    RenderData.BoundingBoxMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const FStaticMeshVertex& Vertex : RenderData.Vertices)
+    {
+        RenderData.BoundingBoxMin = FVector(FMath::Min(RenderData.BoundingBoxMin.X, Vertex.X), FMath::Min(RenderData.BoundingBoxMin.Y, Vertex.Y), FMath::Min(RenderData.BoundingBoxMin.Z, Vertex.Z));
+        RenderData.BoundingBoxMax = FVector(FMath::Max(RenderData.BoundingBoxMax.X, Vertex.X), FMath::Max(RenderData.BoundingBoxMax.Y, Vertex.Y), FMath::Max(RenderData.BoundingBoxMax.Z, Vertex.Z));
+    }
+}
+
+void FTestMeshFixture::AppendGrid(FStaticMeshRenderData& RenderData, const FVector& Corner, const FVector& U, const FVector& V, int32 Segments)
+{
+    const uint32 Base = RenderData.Vertices.Num();
+    for (int32 Row = 0; Row <= Segments; ++Row)
+    {
+        for (int32 Column = 0; Column <= Segments; ++Column)
+        {
+            AddVertex(RenderData, Corner + U * (static_cast<float>(Row) / Segments) + V * (static_cast<float>(Column) / Segments));
+        }
+    }
+
+    for (int32 Row = 0; Row < Segments; ++Row)
+    {
+        for (int32 Column = 0; Column < Segments; ++Column)
+        {
+            const uint32 V00 = Base + Row * (Segments + 1) + Column;
+            const uint32 V10 = V00 + Segments + 1;
+            RenderData.Indices.Add(V00); RenderData.Indices.Add(V10); RenderData.Indices.Add(V00 + 1);
+            RenderData.Indices.Add(V10); RenderData.Indices.Add(V10 + 1); RenderData.Indices.Add(V00 + 1);
+        }
+    }
+}
+
+FStaticMeshRenderData FTestMeshFixture::MakeSphere(int32 Slices, int32 Stacks)
+{
+    FStaticMeshRenderData RenderData;
+    for (int32 Stack = 0; Stack <= Stacks; ++Stack)
+    {
+        const float Theta = PI * Stack / Stacks;
+        for (int32 Slice = 0; Slice <= Slices; ++Slice)
+        {
+            const float Phi = 2.0f * PI * (Slice % Slices) / Slices;
+            const FVector Normal(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+            AddVertex(RenderData, Normal, Normal);
+
+            FStaticMeshVertex& Vertex = RenderData.Vertices[RenderData.Vertices.Num() - 1];
+            Vertex.U = static_cast<float>(Slice) / Slices;
+            Vertex.V = static_cast<float>(Stack) / Stacks;
+        }
+    }
+
+    for (int32 Stack = 0; Stack < Stacks; ++Stack)
+    {
+        for (int32 Slice = 0; Slice < Slices; ++Slice)
+        {
+            const uint32 V00 = Stack * (Slices + 1) + Slice;
+            const uint32 V01 = V00 + 1;
+            const uint32 V10 = V00 + Slices + 1;
+            const uint32 V11 = V10 + 1;
+            if (Stack != 0)
+            {
+                RenderData.Indices.Add(V00); RenderData.Indices.Add(V11); RenderData.Indices.Add(V01);
+            }
+            if (Stack != Stacks - 1)
+            {
+                RenderData.Indices.Add(V00); RenderData.Indices.Add(V10); RenderData.Indices.Add(V11);
+            }
+        }
+    }
+
+    ComputeBounds(RenderData);
+    return RenderData;
+}
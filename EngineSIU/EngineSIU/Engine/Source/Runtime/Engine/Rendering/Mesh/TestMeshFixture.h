@@ -0,0 +1,23 @@
+#pragma once
+#include "Define.h"
+
+/**
+ * 메시 테스트(FMeshSimplifierTest, FMeshClusterTest, FSoftwareOcclusionTest)가 같이 쓰는 절차적 메시
+ * 앞면은 cross(B - A, C - A)가 향하는 쪽입니다. 래스터라이저에서는 시계 방향입니다.
+ */
+struct FTestMeshFixture
+{
+    static void AddVertex(FStaticMeshRenderData& RenderData, const FVector& Position, const FVector& Normal = FVector::ZeroVector);
+
+    /** 정점으로 BoundingBoxMin / Max를 다시 구합니다. */
+    static void ComputeBounds(FStaticMeshRenderData& RenderData);
+
+    /** Corner에서 U, V로 펼친 Segments x Segments 격자. 앞면 노멀은 U ^ V */
+    static void AppendGrid(FStaticMeshRenderData& RenderData, const FVector& Corner, const FVector& U, const FVector& V, int32 Segments);
+
+    /**
+     * 반지름 1인 UV 구. 앞면이 바깥을 향하고, 노멀은 위치와 같으며 UV는 (경도, 위도)입니다.
+     * 경도 0에 UV seam이 있고 극점은 정점이 여러 개입니다.
+     */
+    static FStaticMeshRenderData MakeSphere(int32 Slices, int32 Stacks);
+};
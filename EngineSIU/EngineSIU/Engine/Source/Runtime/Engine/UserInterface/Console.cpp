@@ -1,9 +1,25 @@
 #include "Console.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
 #include "UnrealEd/EditorViewportClient.h"
+#include "Async/JobSystem.h"
+#include "Async/JobSystemBenchmark.h"
+#include "Delegates/DelegateBenchmark.h"
+#include "HAL/FramePacerTest.h"
+#include "Logging/LogBenchmark.h"
+#include "Math/MathBatchBenchmark.h"
+#include "Engine/Lua/LuaScriptBenchmark.h"
+#include "WindowsPlatformTime.h"
 #include "Engine/Engine.h"
+#include "Launch/EngineLoop.h"
 #include "Renderer/UpdateLightBufferPass.h"
+#include "Renderer/TileLightCullingPass.h"
+#include "Renderer/WorldBillboardRenderPass.h"
+#include "Renderer/ClusteredLightAssignment.h"
+#include "Renderer/DebugPrimitiveStream.h"
+#include "Renderer/SoftwareOcclusion.h"
+#include "Renderer/SoftwareOcclusionTest.h"
 #include "UObject/Casts.h"
 #include "UObject/UObjectIterator.h"
 #include "Components/Light/LightComponent.h"
@@ -13,7 +29,23 @@
 #include "Components/Light/AmbientLightComponent.h"
 #include "ImGUI/imgui.h"
 #include "Stats/ProfilerStatsManager.h"
+#include "Stats/CpuProfiler.h"
 #include "Stats/GPUTimingManager.h"
+#include "World/World.h"
+#include "UnrealEd/SceneAutoSave.h"
+#include "D3D11RHI/DXDShaderManager.h"
+#include "UnrealEd/SceneManager.h"
+#include "Engine/EditorEngine.h"
+#include "Engine/ObjLoader.h"
+#include "Launch/EngineTests.h"
+#include "Launch/MeshOptimizationTool.h"
+#include "Rendering/Mesh/MeshSimplifierTest.h"
+#include "Rendering/Mesh/StaticMesh.h"
+#include "Rendering/Mesh/StaticMeshLOD.h"
+#include "Rendering/Mesh/StaticMeshVertexPacking.h"
+#include "Rendering/Mesh/MeshClusterTest.h"
+#include "Components/StaticMeshComponent.h"
+#include "LevelEditor/SLevelEditor.h"
 
 void StatOverlay::RenderStatWidgets() const 
 {
@@ -37,6 +69,7 @@ void StatOverlay::RenderStatWidgets() const
     {
         ImGui::Text("Obj Cnt: %llu, Mem: %llu B", FPlatformMemory::GetAllocationCount<EAT_Object>(), FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Cont Cnt: %llu, Mem: %llu B", FPlatformMemory::GetAllocationCount<EAT_Container>(), FPlatformMemory::GetAllocationBytes<EAT_Container>());
+        ImGui::Text("New Cnt: %llu, Mem: %llu B", FPlatformMemory::GetAllocationCount<EAT_Global>(), FPlatformMemory::GetAllocationBytes<EAT_Global>());
     }
 
     if (ShowLight)
@@ -137,6 +170,8 @@ void StatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Allocated Object Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+        ImGui::Text("Allocated New Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Global>());
+        ImGui::Text("Allocated New memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Global>());
     }
 
     if (ShowLight)
@@ -209,7 +244,13 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
             const double CPUTimeMs = FProfilerStatsManager::GetCpuStatMs(CPUStatName);
             double GPUTimeMs = GPUTimingManager->GetElapsedTimeMs(TStatId(GPUStatName));
 
+            const uint32 CPUCallCount = FProfilerStatsManager::GetCpuStatCallCount(CPUStatName);
+
             FString CPUText = (CPUTimeMs >= 0.0) ? FString::Printf(TEXT("%.3f"), CPUTimeMs) : TEXT("---");
+            if (CPUCallCount > 1)
+            {
+                CPUText += FString::Printf(TEXT(" (x%u)"), CPUCallCount);
+            }
             FString GPUText;
 
             if (GPUTimeMs == -1.0) GPUText = TEXT("Disjoint");
@@ -239,7 +280,14 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
         ImGui::EndTable();
     }
 
-
+    // 스레드 버퍼가 가득 차서 버린 Scope는 위 합계에서 빠지므로 함께 표시
+    if (const uint64 TotalDropped = FProfilerStatsManager::GetTotalDroppedEventCount())
+    {
+        ImGui::TextColored(
+            ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Dropped events: %llu last frame, %llu total",
+            FProfilerStatsManager::GetFrameDroppedEventCount(), TotalDropped
+        );
+    }
 
     ImGui::End();
 }
@@ -249,6 +297,8 @@ void FEngineProfiler::RegisterStatScope(const FString& DisplayName, const FName&
     TrackedScopes.Add({ DisplayName, CPUStatName, GPUStatName });
 }
 
+DEFINE_LOG_CATEGORY(LogConsole, Display)
+
 // 싱글톤 인스턴스 반환
 Console& Console::GetInstance() {
     static Console Instance;
@@ -257,19 +307,34 @@ Console& Console::GetInstance() {
 
 // 로그 초기화
 void Console::Clear() {
-    Items.Empty();
+    FLogger::Get().ClearConsole();
 }
 
 // 로그 추가
 void Console::AddLog(const LogLevel Level, const char* Format, ...) {
+    if (!LogConsole.IsActive(Level))
+    {
+        return;
+    }
+
     char Buf[1024];
     va_list args;
     va_start(args, Format);
-    vsnprintf(Buf, sizeof(Buf), Format, args);
+    const int Length = vsnprintf(Buf, sizeof(Buf), Format, args);
     va_end(args);
 
-    Items.Add({ Level, std::string(Buf) });
-    ScrollToBottom = true;
+    if (Length >= static_cast<int>(sizeof(Buf)))
+    {
+        std::string LongMessage(Length + 1, '\0');
+        va_start(args, Format);
+        vsnprintf(LongMessage.data(), LongMessage.size(), Format, args);
+        va_end(args);
+        UE_LOG_CATEGORY(LogConsole, Level, "%s", LongMessage.c_str());
+    }
+    else
+    {
+        UE_LOG_CATEGORY(LogConsole, Level, "%s", Buf);
+    }
 }
 
 // 콘솔 창 렌더링
@@ -302,17 +367,26 @@ void Console::Draw() {
     ImGui::Separator();
 
     ImGui::BeginChild("ScrollingRegion", ImVec2(0, -ImGui::GetTextLineHeightWithSpacing()), false, ImGuiWindowFlags_HorizontalScrollbar);
-    for (const auto& [Level, Message] : Items)
+    FLogger::Get().ForEachConsoleLine([this](const FLogLine& Line)
     {
-        if (!Filter.PassFilter(*Message)) continue;
+        const LogLevel Level = Line.Level;
+        if (!Filter.PassFilter(*Line.Message)) return;
         if ((Level == LogLevel::Display && !ShowLogTemp) ||
             (Level == LogLevel::Warning && !ShowWarning) ||
-            (Level == LogLevel::Error && !ShowError)) continue;
+            (Level == LogLevel::Error && !ShowError)) return;
 
         ImVec4 Color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
         if (Level == LogLevel::Warning) Color = ImVec4(1.0f, 1.0f, 0.0f, 1.0f);
         else if (Level == LogLevel::Error) Color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
-        ImGui::TextColored(Color, "%s", *Message);
+        ImGui::TextColored(Color, "%s", *Line.Message);
+    });
+
+    // 로그 스레드가 새 줄을 넣었으면 맨 아래로
+    const uint64 LogVersion = FLogger::Get().GetConsoleVersion();
+    if (LogVersion != LastLogVersion)
+    {
+        LastLogVersion = LogVersion;
+        ScrollToBottom = true;
     }
 
     if (ScrollToBottom)
@@ -360,11 +434,777 @@ void Console::ExecuteCommand(const std::string& Command)
         AddLog(LogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(LogLevel::Display, " - stat memory: Toggle Memory display");
         AddLog(LogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(LogLevel::Display, " - reloadtexture <path>: Reload a loaded texture in place");
+        AddLog(LogLevel::Display, " - lightcull cpu|gpu: Switch tile light assignment between CPU clusters and compute shader");
+        AddLog(LogLevel::Display, " - lightcull bench [R]: Benchmark CPU cluster assignment on a (2R+1)^3 light grid");
+        AddLog(LogLevel::Display, " - profile dump: Print per-scope CPU stats over the recorded frames");
+        AddLog(LogLevel::Display, " - profile export [path]: Save recorded frames as Chrome trace JSON");
+        AddLog(LogLevel::Display, " - profile frames <N>: Set the number of recorded frames");
+        AddLog(LogLevel::Display, " - profile on|off: Start / stop recording frames (the profiler window keeps updating)");
+        AddLog(LogLevel::Display, " - memreport: Print live / peak heap usage per memory tag");
+        AddLog(LogLevel::Display, " - memreport sites [N]: Print the top N sampled allocation sites");
+        AddLog(LogLevel::Display, " - memsample <N>|reset: Sample every Nth allocation's call stack (0 = off), or clear sampled sites");
+        AddLog(LogLevel::Display, " - tickstats: Print registered / ticked functions per tick group of the active world");
+        AddLog(LogLevel::Display, " - piestats: Print the time spent entering the last PIE session");
+        AddLog(LogLevel::Display, " - test all: Run the job system, frame pacer, mesh simplifier, mesh cluster and software occlusion tests (same as -test)");
+        AddLog(LogLevel::Display, " - jobs stress [N]: Run N rounds of job system correctness checks");
+        AddLog(LogLevel::Display, " - jobs bench [K]: Time ParallelFor over K*1024 elements with 1..N threads");
+        AddLog(LogLevel::Display, " - jobs workers <N>: Limit the number of worker threads taking jobs");
+        AddLog(LogLevel::Display, " - delegate bench [N]: Time N multicast delegate broadcasts with 1, 4 and 32 bindings");
+        AddLog(LogLevel::Display, " - lua bench [N]: Compare per-frame Lua tick cost (lookup / cached / batched) over N script instances");
+        AddLog(LogLevel::Display, " - scene convert <in> <out>: Convert a scene file between Json (.scene) and binary (.bscene)");
+        AddLog(LogLevel::Display, " - autosave [now|restore]: Show incremental autosave stats, start a pass now, or restore the level from the journal");
+        AddLog(LogLevel::Display, " - framepace [fps <N>|fixed <Hz>|reset|test]: Show frame time jitter, set the frame rate cap (0 = uncapped), set the fixed simulation rate (0 = variable), or test the pacer with a fake clock");
+        AddLog(LogLevel::Display, " - shadercache: Show shader binary cache hits / compiles and pending hot reload jobs");
+        AddLog(LogLevel::Display, " - textstats: Show world text batch size and static text buffer cache hits / evictions");
+        AddLog(LogLevel::Display, " - log [<Category> <display|warning|error|off>]: List log categories and logger stats, or set a category's minimum level");
+        AddLog(LogLevel::Display, " - log bench [N]: Time N log calls on 1, 2 and 4 threads, synchronous formatting vs. the async queue");
+        AddLog(LogLevel::Display, " - linebatch: Show debug line primitive counts and the primitive buffer capacity");
+        AddLog(LogLevel::Display, " - linebatch bench [N]: Fill the line batch with up to N primitives over 600 frames and count buffer recreations");
+        AddLog(LogLevel::Display, " - mathbench [N]: Time FMathBatch kernels on N elements and compare them with a double-precision reference");
+        AddLog(LogLevel::Display, " - meshpack: Compare the float and packed vertex sizes of loaded static meshes and report the round-trip error");
+        AddLog(LogLevel::Display, " - meshpack on|off: Use the packed vertex format for static meshes loaded from now on");
+        AddLog(LogLevel::Display, " - meshopt [dir]: Report ACMR before/after mesh optimization for every .obj under dir (default Contents)");
+        AddLog(LogLevel::Display, " - meshlod: Show LOD triangle counts / screen sizes of loaded static meshes and components per LOD in the active viewport");
+        AddLog(LogLevel::Display, " - meshlod test: Run mesh simplifier error bound checks on procedural meshes");
+        AddLog(LogLevel::Display, " - meshlod force <N>|auto: Draw every static mesh at LOD N, or select by screen size");
+        AddLog(LogLevel::Display, " - meshlod hysteresis <H>: Keep the current LOD while the screen size is within H of a threshold (default 0.1)");
+        AddLog(LogLevel::Display, " - meshlet: Show cluster culling results of the camera / shadow views since the last call");
+        AddLog(LogLevel::Display, " - meshlet on|off: Toggle per-view frustum / backface culling of static mesh clusters");
+        AddLog(LogLevel::Display, " - meshlet test: Run cluster build / culling checks on procedural meshes");
+        AddLog(LogLevel::Display, " - occlusion: Show CPU occlusion culling results of the camera views since the last call");
+        AddLog(LogLevel::Display, " - occlusion on|off: Toggle CPU hierarchical-Z occlusion culling of static meshes");
+        AddLog(LogLevel::Display, " - occlusion test: Run occlusion buffer / HiZ checks on procedural scenes");
+        AddLog(LogLevel::Display, " - occlusion bench [N]: Benchmark occlusion culling of an N x N box grid behind a wall (default 32)");
     }
     else if (Command.starts_with("stat "))
     {
         Overlay.ToggleStat(Command);
     }
+    else if (Command.starts_with("reloadtexture "))
+    {
+        const FWString TexturePath = FString(Command.substr(14)).ToWideString();
+        if (FAILED(FEngineLoop::ResourceManager.ReloadTexture(FEngineLoop::GraphicDevice.Device, FEngineLoop::GraphicDevice.DeviceContext, TexturePath)))
+        {
+            AddLog(LogLevel::Error, "Failed to reload texture: %s", Command.substr(14).c_str());
+        }
+    }
+    else if (Command == "lightcull cpu" || Command == "lightcull gpu")
+    {
+        if (FTileLightCullingPass* TileLightCullingPass = FEngineLoop::Renderer.TileLightCullingPass)
+        {
+            TileLightCullingPass->SetUseCPUClusteredAssignment(Command == "lightcull cpu");
+        }
+    }
+    else if (Command.starts_with("lightcull bench"))
+    {
+        const int32 HalfCount = Command.size() > 16 ? std::atoi(Command.c_str() + 16) : 5;
+        const FClusterBenchmarkResult Result = FClusteredLightAssignment::RunBenchmark(HalfCount, 100);
+        AddLog(
+            LogLevel::Display, "Cluster light assignment: %u point / %u spot lights, %u clusters, avg %.3f ms (min %.3f, max %.3f), indices %u / %u",
+            Result.NumPointLights, Result.NumSpotLights, Result.NumClusters, Result.AverageMs, Result.MinMs, Result.MaxMs,
+            Result.NumPointLightIndices, Result.NumSpotLightIndices
+        );
+    }
+    else if (Command == "profile dump")
+    {
+        TArray<FCpuScopeAggregate> Aggregates;
+        FCpuProfiler::Get().GatherScopeAggregates(Aggregates);
+        AddLog(LogLevel::Display, "%-32s %8s %10s %9s %9s %9s %9s", "Scope", "Count", "Total", "Min", "Max", "P50", "P99");
+        for (const FCpuScopeAggregate& Aggregate : Aggregates)
+        {
+            AddLog(
+                LogLevel::Display, "%-32s %8u %10.3f %9.3f %9.3f %9.3f %9.3f",
+                *Aggregate.StatName.ToString(), Aggregate.Count, Aggregate.TotalMs, Aggregate.MinMs, Aggregate.MaxMs, Aggregate.P50Ms, Aggregate.P99Ms
+            );
+        }
+        if (const uint64 Dropped = FCpuProfiler::Get().GetDroppedEventCount())
+        {
+            AddLog(LogLevel::Warning, "%llu profiler events were dropped (thread buffer full)", Dropped);
+        }
+    }
+    else if (Command.starts_with("profile export"))
+    {
+        const FString TracePath = Command.size() > 15 ? FString(Command.substr(15)) : FString(TEXT("Saved/Profiling/CpuTrace.json"));
+        if (FCpuProfiler::Get().ExportChromeTrace(TracePath))
+        {
+            AddLog(LogLevel::Display, "Saved CPU trace: %s", *TracePath);
+        }
+        else
+        {
+            AddLog(LogLevel::Error, "Failed to save CPU trace: %s", *TracePath);
+        }
+    }
+    else if (Command == "profile on" || Command == "profile off")
+    {
+        FCpuProfiler::Get().SetEnabled(Command == "profile on");
+    }
+    else if (Command.starts_with("profile frames "))
+    {
+        FCpuProfiler::Get().SetFrameHistoryCount(static_cast<uint32>(FMath::Max(std::atoi(Command.c_str() + 15), 1)));
+    }
+    else if (Command == "memreport")
+    {
+        TArray<EMemoryTag> Tags;
+        for (uint8 TagIndex = 0; TagIndex < static_cast<uint8>(EMemoryTag::Count); ++TagIndex)
+        {
+            Tags.Add(static_cast<EMemoryTag>(TagIndex));
+        }
+        Tags.Sort([](EMemoryTag A, EMemoryTag B)
+        {
+            return FPlatformMemory::GetTagStats(A).Bytes > FPlatformMemory::GetTagStats(B).Bytes;
+        });
+
+        AddLog(LogLevel::Display, "%-14s %14s %10s %14s %12s", "Tag", "Live (B)", "Count", "Peak (B)", "Total Allocs");
+        for (const EMemoryTag Tag : Tags)
+        {
+            const FMemoryTagStats Stats = FPlatformMemory::GetTagStats(Tag);
+            AddLog(
+                LogLevel::Display, "%-14s %14lld %10lld %14lld %12llu",
+                FPlatformMemory::GetTagName(Tag), Stats.Bytes, Stats.Count, Stats.PeakBytes, Stats.TotalAllocations
+            );
+        }
+        AddLog(
+            LogLevel::Display, "Object %llu B / Container %llu B / New %llu B",
+            FPlatformMemory::GetAllocationBytes<EAT_Object>(), FPlatformMemory::GetAllocationBytes<EAT_Container>(), FPlatformMemory::GetAllocationBytes<EAT_Global>()
+        );
+    }
+    else if (Command.starts_with("memreport sites"))
+    {
+        const uint32 SampleInterval = FPlatformMemory::GetSampleInterval();
+        if (SampleInterval == 0)
+        {
+            AddLog(LogLevel::Warning, "Allocation sampling is off. Enable it with 'memsample <N>'");
+        }
+
+        const int32 MaxSites = Command.size() > 16 ? FMath::Max(std::atoi(Command.c_str() + 16), 1) : 10;
+        TArray<FAllocationSiteInfo> Sites;
+        FPlatformMemory::GatherAllocationSites(Sites);
+
+        // 샘플링된 할당만 집계하므로, 대략적인 실제 크기는 간격을 곱한 값
+        char Description[512];
+        for (int32 SiteIndex = 0; SiteIndex < FMath::Min(MaxSites, Sites.Num()); ++SiteIndex)
+        {
+            const FAllocationSiteInfo& Site = Sites[SiteIndex];
+            AddLog(
+                LogLevel::Display, "#%d [%s] live %lld B in %lld allocs (~%lld B estimated), %llu sampled total",
+                SiteIndex, FPlatformMemory::GetTagName(Site.Tag), Site.Bytes, Site.Count,
+                Site.Bytes * FMath::Max<int64>(SampleInterval, 1), Site.TotalSampled
+            );
+            for (uint32 FrameIndex = 0; FrameIndex < Site.NumFrames; ++FrameIndex)
+            {
+                FPlatformMemory::DescribeAddress(Site.Frames[FrameIndex], Description, sizeof(Description));
+                AddLog(LogLevel::Display, "    %s", Description);
+            }
+        }
+    }
+    else if (Command == "memsample reset")
+    {
+        FPlatformMemory::ResetAllocationSites();
+    }
+    else if (Command.starts_with("memsample "))
+    {
+        FPlatformMemory::SetSampleInterval(static_cast<uint32>(FMath::Max(std::atoi(Command.c_str() + 10), 0)));
+    }
+    else if (Command == "tickstats")
+    {
+        if (GEngine && GEngine->ActiveWorld)
+        {
+            static const char* GroupNames[TG_MAX] = { "PrePhysics", "DuringPhysics", "PostPhysics", "PostUpdateWork" };
+
+            const FTickTaskManager& TickTaskManager = GEngine->ActiveWorld->GetTickTaskManager();
+            AddLog(LogLevel::Display, "%-16s %10s %8s %9s %7s", "Group", "Registered", "Ticked", "Parallel", "Levels");
+            for (int32 Group = 0; Group < TG_MAX; ++Group)
+            {
+                const FTickGroupStats& Stats = TickTaskManager.GetStats(static_cast<ETickingGroup>(Group));
+                AddLog(
+                    LogLevel::Display, "%-16s %10d %8d %9d %7d",
+                    GroupNames[Group], Stats.NumRegistered, Stats.NumTicked, Stats.NumTickedInParallel, Stats.NumLevels
+                );
+            }
+        }
+    }
+    else if (Command == "piestats")
+    {
+        const UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine);
+        if (EditorEngine == nullptr || EditorEngine->GetLastPIEStartStats().TotalMs <= 0.0)
+        {
+            AddLog(LogLevel::Warning, "PIE has not been started yet");
+        }
+        else
+        {
+            const FPIEStartStats& Stats = EditorEngine->GetLastPIEStartStats();
+            const FLevelDuplicationStats& Duplication = Stats.Duplication;
+            AddLog(LogLevel::Display, "PIE start        %8.2fms", Stats.TotalMs);
+            AddLog(
+                LogLevel::Display, "  Duplicate      %8.2fms (%d actors, %d components, %d reused, %lld bytes)",
+                Stats.DuplicateMs, Duplication.NumActors, Duplication.NumComponents, Duplication.NumReusedComponents, Duplication.ArchiveBytes
+            );
+            AddLog(LogLevel::Display, "    Serialize    %8.2fms", Duplication.SerializeMs);
+            AddLog(LogLevel::Display, "    Construct    %8.2fms", Duplication.ConstructMs);
+            AddLog(LogLevel::Display, "    Load         %8.2fms", Duplication.LoadMs);
+            AddLog(LogLevel::Display, "  BeginPlay      %8.2fms", Stats.BeginPlayMs);
+        }
+    }
+    else if (Command == "test all")
+    {
+        TArray<FEngineTestResult> Results;
+        TArray<FString> Failures;
+        const bool bPassed = FEngineTests::RunAll(Results, Failures);
+
+        for (const FString& Failure : Failures)
+        {
+            AddLog(LogLevel::Error, "%s", *Failure);
+        }
+        for (const FEngineTestResult& Result : Results)
+        {
+            AddLog(
+                Result.bPassed ? LogLevel::Display : LogLevel::Error, "%-20s %s, %d failures (%.1fms)",
+                *Result.Name, Result.bPassed ? "passed" : "FAILED", Result.NumFailures, Result.ElapsedMs
+            );
+        }
+        AddLog(bPassed ? LogLevel::Display : LogLevel::Error, "Engine tests %s: %d suites", bPassed ? "passed" : "FAILED", Results.Num());
+    }
+    else if (Command == "jobs stress" || Command.starts_with("jobs stress "))
+    {
+        const int32 NumIterations = Command.size() > 12 ? FMath::Max(std::atoi(Command.c_str() + 12), 1) : 10;
+
+        TArray<FString> Failures;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const bool bPassed = FJobSystemBenchmark::RunStressTest(NumIterations, Failures);
+        const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        for (const FString& Failure : Failures)
+        {
+            AddLog(LogLevel::Error, "%s", *Failure);
+        }
+        AddLog(
+            bPassed ? LogLevel::Display : LogLevel::Error, "Job stress test %s: %d rounds, %d workers, %.1fms",
+            bPassed ? "passed" : "FAILED", NumIterations, FJobSystem::Get().GetNumWorkers(), ElapsedMs
+        );
+    }
+    else if (Command == "jobs bench" || Command.starts_with("jobs bench "))
+    {
+        const int32 NumElements = (Command.size() > 11 ? FMath::Max(std::atoi(Command.c_str() + 11), 1) : 256) * 1024;
+
+        TArray<FJobScalingResult> Results;
+        FJobSystemBenchmark::RunScalingBenchmark(NumElements, 5, Results);
+
+        AddLog(LogLevel::Display, "%8s %12s %8s %14s %8s", "Threads", "Balanced", "Speedup", "Unbalanced", "Speedup");
+        for (const FJobScalingResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%8d %10.2fms %7.2fx %12.2fms %7.2fx",
+                Result.NumThreads,
+                Result.BalancedMs, Results[0].BalancedMs / FMath::Max(Result.BalancedMs, 0.001),
+                Result.UnbalancedMs, Results[0].UnbalancedMs / FMath::Max(Result.UnbalancedMs, 0.001)
+            );
+        }
+    }
+    else if (Command.starts_with("jobs workers "))
+    {
+        FJobSystem::Get().SetNumActiveWorkers(std::atoi(Command.c_str() + 13));
+        AddLog(LogLevel::Display, "Active workers: %d / %d", FJobSystem::Get().GetNumActiveWorkers(), FJobSystem::Get().GetNumWorkers());
+    }
+    else if (Command == "delegate bench" || Command.starts_with("delegate bench "))
+    {
+        const int32 NumBroadcasts = Command.size() > 15 ? FMath::Max(std::atoi(Command.c_str() + 15), 1) : 100000;
+
+        TArray<FDelegateBroadcastResult> Results;
+        FDelegateBenchmark::RunBroadcastBenchmark(NumBroadcasts, Results);
+
+        AddLog(LogLevel::Display, "%8s %14s %14s %8s", "Bindings", "MapCopy", "Multicast", "Speedup");
+        for (const FDelegateBroadcastResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%8d %12.1fns %12.1fns %7.2fx",
+                Result.NumBindings, Result.MapCopyNs, Result.MulticastNs, Result.MapCopyNs / FMath::Max(Result.MulticastNs, 0.001)
+            );
+        }
+    }
+    else if (Command == "lua bench" || Command.starts_with("lua bench "))
+    {
+        const int32 NumInstances = Command.size() > 10 ? FMath::Max(std::atoi(Command.c_str() + 10), 1) : 1000;
+        const FLuaTickBenchmarkResult Result = FLuaScriptBenchmark::RunTickBenchmark(NumInstances, 120);
+
+        AddLog(LogLevel::Display, "Lua tick, %d instances (median per frame):", Result.NumInstances);
+        AddLog(LogLevel::Display, "  Lookup  %8.3fms", Result.LookupMs);
+        AddLog(LogLevel::Display, "  Cached  %8.3fms (%.2fx)", Result.CachedMs, Result.LookupMs / FMath::Max(Result.CachedMs, 0.001));
+        AddLog(LogLevel::Display, "  Batched %8.3fms (%.2fx)", Result.BatchedMs, Result.LookupMs / FMath::Max(Result.BatchedMs, 0.001));
+    }
+    else if (Command.starts_with("scene convert "))
+    {
+        const std::string Args = Command.substr(14);
+        const size_t Separator = Args.find(' ');
+        if (Separator == std::string::npos)
+        {
+            AddLog(LogLevel::Error, "Usage: scene convert <in> <out>");
+        }
+        else
+        {
+            const std::string InPath = Args.substr(0, Separator);
+            const std::string OutPath = Args.substr(Separator + 1);
+            if (SceneManager::ConvertSceneFile(InPath, OutPath))
+            {
+                AddLog(LogLevel::Display, "Converted %s -> %s", InPath.c_str(), OutPath.c_str());
+            }
+            else
+            {
+                AddLog(LogLevel::Error, "Failed to convert %s", InPath.c_str());
+            }
+        }
+    }
+    else if (Command == "autosave" || Command.starts_with("autosave "))
+    {
+        UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine);
+        FSceneAutoSave* AutoSave = EditorEngine ? EditorEngine->GetAutoSave() : nullptr;
+        if (AutoSave == nullptr)
+        {
+            AddLog(LogLevel::Error, "AutoSave is not running");
+        }
+        else if (Command == "autosave now")
+        {
+            AutoSave->RequestPass();
+            AddLog(LogLevel::Display, "AutoSave pass requested");
+        }
+        else if (Command == "autosave restore")
+        {
+            if (!EditorEngine->RestoreAutoSave())
+            {
+                AddLog(LogLevel::Error, "AutoSave restore failed (no journal, or PIE is running)");
+            }
+        }
+        else
+        {
+            const FSceneAutoSaveStats& Stats = AutoSave->GetStats();
+            AddLog(
+                LogLevel::Display, "AutoSave: %d passes, %d upserts, %d removes, journal %lld bytes",
+                Stats.NumPasses, Stats.NumUpserts, Stats.NumRemoves, Stats.JournalBytes
+            );
+            AddLog(
+                LogLevel::Display, "  Last pass   %8.2fms over %d frame(s), max %.2fms per frame",
+                Stats.LastPassCaptureMs, Stats.LastPassFrames, Stats.MaxFrameCaptureMs
+            );
+            AddLog(LogLevel::Display, "  Compaction  %8.2fms (worker), %d total", Stats.LastCompactionMs, Stats.NumCompactions);
+        }
+    }
+    else if (Command == "framepace" || Command.starts_with("framepace "))
+    {
+        FFramePacer& FramePacer = GEngineLoop.GetFramePacer();
+        FFramePacerSettings Settings = FramePacer.GetSettings();
+        if (Command.starts_with("framepace fps "))
+        {
+            Settings.TargetFPS = std::atof(Command.c_str() + 14);
+            FramePacer.SetSettings(Settings);
+            FramePacer.ResetStats();
+            AddLog(LogLevel::Display, "Frame rate cap: %.1f FPS (0 = uncapped)", Settings.TargetFPS);
+        }
+        else if (Command.starts_with("framepace fixed "))
+        {
+            const double Hz = std::atof(Command.c_str() + 16);
+            Settings.FixedStepSeconds = Hz > 0.0 ? 1.0 / Hz : 0.0;
+            FramePacer.SetSettings(Settings);
+            AddLog(LogLevel::Display, "Fixed simulation rate: %.1f Hz (0 = variable step)", Hz > 0.0 ? Hz : 0.0);
+        }
+        else if (Command == "framepace reset")
+        {
+            FramePacer.ResetStats();
+        }
+        else if (Command == "framepace test")
+        {
+            TArray<FString> Failures;
+            const bool bPassed = FFramePacerTest::Run(Failures);
+            for (const FString& Failure : Failures)
+            {
+                AddLog(LogLevel::Error, "%s", *Failure);
+            }
+            AddLog(bPassed ? LogLevel::Display : LogLevel::Error, "Frame pacer test %s", bPassed ? "passed" : "FAILED");
+        }
+        else
+        {
+            const FFramePacerStats Stats = FramePacer.GetStats();
+            AddLog(
+                LogLevel::Display, "FramePace: cap %.1f FPS, fixed step %.2fms, last %d frames",
+                Settings.TargetFPS, Settings.FixedStepSeconds * 1000.0, Stats.NumFrames
+            );
+            AddLog(
+                LogLevel::Display, "  Frame   avg %.3fms  min %.3fms  max %.3fms  p99 %.3fms  jitter %.3fms",
+                Stats.AverageFrameMs, Stats.MinFrameMs, Stats.MaxFrameMs, Stats.P99FrameMs, Stats.JitterMs
+            );
+            AddLog(
+                LogLevel::Display, "  Wait    sleep %.1f%%  spin %.1f%%  wake error %.3fms",
+                Stats.SleepFraction * 100.0, Stats.SpinFraction * 100.0, Stats.AverageWakeErrorMs
+            );
+        }
+    }
+    else if (Command == "shadercache")
+    {
+        const FDXDShaderManager* ShaderManager = FEngineLoop::Renderer.ShaderManager;
+        if (ShaderManager == nullptr)
+        {
+            AddLog(LogLevel::Error, "ShaderManager is not initialized");
+        }
+        else
+        {
+            const FShaderCacheStats& Stats = ShaderManager->GetCacheStats();
+            AddLog(
+                LogLevel::Display, "ShaderCache: %d cache hits, %d compiles, %d failed, %.1fms loading on game thread",
+                Stats.NumCacheHits, Stats.NumCompiles, Stats.NumFailed, Stats.TotalLoadMs
+            );
+            AddLog(LogLevel::Display, "  Hot reload  %d swapped, %d pending", Stats.NumHotReloads, ShaderManager->GetNumPendingRecompiles());
+        }
+    }
+    else if (Command == "textstats")
+    {
+        if (const FWorldBillboardRenderPass* BillboardPass = FEngineLoop::Renderer.WorldBillboardRenderPass)
+        {
+            const FTextRenderBatchStats& BatchStats = BillboardPass->GetTextBatchStats();
+            AddLog(
+                LogLevel::Display, "Text batch: %d texts, %d vertices, buffer %u vertices (%d resizes)",
+                BatchStats.NumTexts, BatchStats.NumVertices, BatchStats.BufferCapacity, BatchStats.NumBufferResizes
+            );
+        }
+        if (const FDXDBufferManager* BufferManager = FEngineLoop::Renderer.BufferManager)
+        {
+            const FTextBufferCacheStats& CacheStats = BufferManager->GetTextBufferCacheStats();
+            AddLog(
+                LogLevel::Display, "Static text cache: %d buffers, %llu B, %llu hits, %llu misses, %llu evictions",
+                CacheStats.NumEntries, CacheStats.NumBytes, CacheStats.NumHits, CacheStats.NumMisses, CacheStats.NumEvictions
+            );
+        }
+    }
+    else if (Command.starts_with("log bench"))
+    {
+        const int32 NumLogs = Command.size() > 10 ? FMath::Max(std::atoi(Command.c_str() + 10), 1) : 100000;
+
+        TArray<FLogBenchmarkResult> Results;
+        FLogBenchmark::Run(NumLogs, Results);
+
+        AddLog(LogLevel::Display, "%8s %12s %12s %8s %10s", "Threads", "Sync", "Async", "Speedup", "Drain");
+        for (const FLogBenchmarkResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%8d %10.1fns %10.1fns %7.2fx %8.2fms",
+                Result.NumThreads, Result.SyncNs, Result.AsyncNs, Result.SyncNs / FMath::Max(Result.AsyncNs, 0.001), Result.DrainMs
+            );
+        }
+        AddLog(LogLevel::Display, "Disabled category: %.2fns", FLogBenchmark::MeasureDisabledNs(NumLogs));
+    }
+    else if (Command == "log")
+    {
+        static const char* LevelNames[] = { "Display", "Warning", "Error", "Off" };
+        for (const FLogCategory* Category = FLogCategory::GetFirst(); Category; Category = Category->GetNext())
+        {
+            AddLog(LogLevel::Display, "%-24s %s", Category->GetName(), LevelNames[FMath::Min<uint8>(Category->GetMinLevel(), FLogCategory::Off)]);
+        }
+
+        const FLoggerStats Stats = FLogger::Get().GetStats();
+        AddLog(
+            LogLevel::Display, "Logger: %llu queued, %llu heap payloads, %llu full-queue waits, %d rotations, %lld B in %s",
+            Stats.NumLogged, Stats.NumHeapPayloads, Stats.NumQueueFullWaits, Stats.NumFileRotations, Stats.FileBytes, *Stats.FilePath
+        );
+    }
+    else if (Command.starts_with("log "))
+    {
+        // log <Category> <display|warning|error|off>
+        const size_t Separator = Command.find(' ', 4);
+        const std::string CategoryName = Command.substr(4, Separator == std::string::npos ? std::string::npos : Separator - 4);
+        const std::string LevelName = Separator == std::string::npos ? "" : Command.substr(Separator + 1);
+
+        FLogCategory* Category = FLogCategory::Find(CategoryName.c_str());
+        uint8 MinLevel = FLogCategory::Off + 1;
+        if (LevelName == "display") MinLevel = static_cast<uint8>(LogLevel::Display);
+        else if (LevelName == "warning") MinLevel = static_cast<uint8>(LogLevel::Warning);
+        else if (LevelName == "error") MinLevel = static_cast<uint8>(LogLevel::Error);
+        else if (LevelName == "off") MinLevel = FLogCategory::Off;
+
+        if (Category == nullptr)
+        {
+            AddLog(LogLevel::Error, "Unknown log category: %s", CategoryName.c_str());
+        }
+        else if (MinLevel > FLogCategory::Off)
+        {
+            AddLog(LogLevel::Error, "Usage: log <Category> <display|warning|error|off>");
+        }
+        else
+        {
+            Category->SetMinLevel(MinLevel);
+            AddLog(LogLevel::Display, "%s: %s", Category->GetName(), LevelName.c_str());
+        }
+    }
+    else if (Command == "linebatch")
+    {
+        const FPrimitiveDrawBatchStats& BatchStats = FEngineLoop::PrimitiveDrawBatch.GetStats();
+        const FDebugPrimitiveLayout& Layout = BatchStats.Layout;
+        AddLog(
+            LogLevel::Display, "Line batch: %u AABB, %u cones, %u OBB, %u bones",
+            Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::AABB)], Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Cone)],
+            Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::OBB)], Layout.Counts[static_cast<uint32>(EDebugPrimitiveType::Bone)]
+        );
+        AddLog(
+            LogLevel::Display, "Primitive buffer: %u / %u words (%d creations)",
+            Layout.NumWords, BatchStats.BufferCapacityWords, BatchStats.NumBufferCreations
+        );
+    }
+    else if (Command.starts_with("linebatch bench"))
+    {
+        const int32 MaxPrimitives = Command.size() > 16 ? FMath::Max(std::atoi(Command.c_str() + 16), 1) : 20000;
+
+        const FDebugPrimitiveBenchmarkResult Result = FDebugPrimitiveBenchmark::Run(600, MaxPrimitives);
+        AddLog(
+            LogLevel::Display, "%d frames up to %d primitives: buffer created %d times (exact fit) vs %d times (grown)",
+            Result.NumFrames, Result.MaxPrimitives, Result.NumExactFitCreations, Result.NumGrownCreations
+        );
+        AddLog(LogLevel::Display, "Per frame: reserve + write %.3fms, pack %.3fms", Result.ReserveMs, Result.PackMs);
+    }
+    else if (Command.starts_with("mathbench"))
+    {
+        const int32 NumElements = Command.size() > 10 ? FMath::Max(std::atoi(Command.c_str() + 10), 1) : 100000;
+
+        AddLog(LogLevel::Display, "Active kernel: %s", FMathBatch::GetKernelName(FMathBatch::GetKernel()));
+
+        std::vector<FMathBatchBenchmarkResult> Results;
+        FMathBatchBenchmark::Run(NumElements, Results);
+        for (const FMathBatchBenchmarkResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%-6s x%d: positions %.3fms, directions %.3fms, AABBs %.3fms, inverse %.3fms, multiply %.3fms",
+                FMathBatch::GetKernelName(Result.Kernel), Result.NumElements,
+                Result.PositionsMs, Result.DirectionsMs, Result.AABBsMs, Result.InverseMs, Result.MultiplyMs
+            );
+            AddLog(
+                LogLevel::Display, "       max error: positions %g, directions %g, AABBs %g, inverse %g, multiply %g",
+                Result.MaxPositionError, Result.MaxDirectionError, Result.MaxAABBError, Result.MaxInverseError, Result.MaxMultiplyError
+            );
+        }
+    }
+    else if (Command == "meshpack on" || Command == "meshpack off")
+    {
+        const bool bPacked = Command == "meshpack on";
+        FObjManager::SetContentVertexFormat(bPacked ? EStaticMeshVertexFormat::Packed : EStaticMeshVertexFormat::Float);
+        AddLog(LogLevel::Display, "Static meshes loaded from now on use the %s vertex format", bPacked ? "packed" : "float");
+    }
+    else if (Command == "meshpack")
+    {
+        FStaticMeshVertexPackingStats Total;
+        int32 NumPackedMeshes = 0;
+        for (const auto& [Name, StaticMesh] : FObjManager::GetStaticMeshes())
+        {
+            const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+            if (RenderData == nullptr)
+            {
+                continue;
+            }
+            if (RenderData->VertexFormat == EStaticMeshVertexFormat::Packed)
+            {
+                ++NumPackedMeshes;
+            }
+            Total.Accumulate(FStaticMeshVertexPacking::Measure(*RenderData));
+        }
+
+        AddLog(
+            LogLevel::Display, "%d meshes (%d packed), %d vertices: float %.2f KB, packed %.2f KB",
+            FObjManager::GetStaticMeshNum(), NumPackedMeshes, Total.NumVertices, Total.FloatBytes / 1024.0, Total.PackedBytes / 1024.0
+        );
+        AddLog(
+            LogLevel::Display, "Max error: position %g, normal %.4f deg, tangent %.4f deg, UV %g, material index mismatches %d",
+            Total.MaxPositionError, Total.MaxNormalErrorDegrees, Total.MaxTangentErrorDegrees, Total.MaxUVError, Total.NumMaterialIndexMismatches
+        );
+    }
+    else if (Command == "meshopt" || Command.starts_with("meshopt "))
+    {
+        FMeshOptimizationToolSettings Settings;
+        if (Command.size() > 8)
+        {
+            Settings.Directory = FString(Command.substr(8));
+        }
+
+        TArray<FMeshOptimizationResult> Results;
+        int32 NumFailed = 0;
+        FMeshOptimizationTool::OptimizeDirectory(Settings.Directory, Settings.CacheSize, Results, NumFailed);
+        FMeshOptimizationTool::WriteReport(Settings.ReportPath, Results);
+        AddLog(LogLevel::Display, "%d meshes optimized, %d failed. Report: %s", Results.Num(), NumFailed, *Settings.ReportPath);
+    }
+    else if (Command == "meshlod test")
+    {
+        TArray<FMeshSimplifierTestResult> Results;
+        TArray<FString> Failures;
+        const bool bPassed = FMeshSimplifierTest::Run(Results, Failures);
+
+        for (const FMeshSimplifierTestResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%-22s %5d -> %5d tris, error target %g reported %.5f measured %.5f (%.2fms)",
+                *Result.Name, Result.NumTrianglesBefore, Result.NumTrianglesAfter, Result.TargetError, Result.ReportedError, Result.MeasuredError, Result.SimplifyMs
+            );
+        }
+        for (const FString& Failure : Failures)
+        {
+            AddLog(LogLevel::Error, "%s", *Failure);
+        }
+        AddLog(bPassed ? LogLevel::Display : LogLevel::Error, "Mesh simplifier test %s: %d cases", bPassed ? "passed" : "FAILED", Results.Num());
+    }
+    else if (Command == "meshlod force auto")
+    {
+        FStaticMeshLOD::ForcedLOD = INDEX_NONE;
+        AddLog(LogLevel::Display, "Static mesh LOD selected by screen size");
+    }
+    else if (Command.starts_with("meshlod force "))
+    {
+        FStaticMeshLOD::ForcedLOD = FMath::Max(std::atoi(Command.c_str() + 14), 0);
+        AddLog(LogLevel::Display, "Static mesh LOD forced to %d", FStaticMeshLOD::ForcedLOD);
+    }
+    else if (Command.starts_with("meshlod hysteresis "))
+    {
+        FStaticMeshLOD::Hysteresis = FMath::Clamp(static_cast<float>(std::atof(Command.c_str() + 19)), 0.0f, 0.9f);
+        AddLog(LogLevel::Display, "Static mesh LOD hysteresis: %.2f", FStaticMeshLOD::Hysteresis);
+    }
+    else if (Command == "meshlod")
+    {
+        for (const auto& [Name, StaticMesh] : FObjManager::GetStaticMeshes())
+        {
+            const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+            if (RenderData == nullptr || RenderData->LODs.Num() == 0)
+            {
+                continue;
+            }
+
+            FString LODText = FString::Printf(TEXT("LOD0 %d"), RenderData->Indices.Num() / 3);
+            for (int32 LODIndex = 0; LODIndex < RenderData->LODs.Num(); ++LODIndex)
+            {
+                const FStaticMeshLODResource& LOD = RenderData->LODs[LODIndex];
+                LODText += FString::Printf(TEXT(", LOD%d %d (error %.4f, below %.3f)"), LODIndex + 1, LOD.Indices.Num() / 3, LOD.Error, LOD.ScreenSize);
+            }
+            AddLog(LogLevel::Display, "%s: %s", *RenderData->DisplayName, *LODText);
+        }
+
+        // 활성 뷰포트에서 마지막으로 고른 LOD별 컴포넌트 / 삼각형 수
+        const std::shared_ptr<FEditorViewportClient> ActiveViewport = GEngineLoop.GetLevelEditor()->GetActiveViewportClient();
+        const uint32 ViewportIndex = ActiveViewport ? ActiveViewport->GetViewportIndex() : 0;
+
+        constexpr int32 MaxReportedLODs = 8;
+        int32 NumComponents[MaxReportedLODs] = {};
+        int64 NumTriangles = 0;
+        int64 NumFullTriangles = 0;
+        for (UStaticMeshComponent* Component : TObjectRange<UStaticMeshComponent>())
+        {
+            const FStaticMeshRenderData* RenderData = Component->GetStaticMesh() ? Component->GetStaticMesh()->GetRenderData() : nullptr;
+            if (RenderData == nullptr || Component->GetWorld() != GEngine->ActiveWorld)
+            {
+                continue;
+            }
+
+            const int32 LODIndex = FMath::Min(Component->GetLODIndex(ViewportIndex), RenderData->GetNumLODs() - 1);
+            ++NumComponents[FMath::Min(LODIndex, MaxReportedLODs - 1)];
+            NumTriangles += RenderData->GetNumIndices(LODIndex) / 3;
+            NumFullTriangles += RenderData->Indices.Num() / 3;
+        }
+
+        FString CountText;
+        for (int32 LODIndex = 0; LODIndex < MaxReportedLODs; ++LODIndex)
+        {
+            if (NumComponents[LODIndex] > 0)
+            {
+                CountText += FString::Printf(TEXT(" LOD%d x%d"), LODIndex, NumComponents[LODIndex]);
+            }
+        }
+        AddLog(
+            LogLevel::Display, "Viewport %u:%s, %lld / %lld triangles, %s, hysteresis %.2f",
+            ViewportIndex, *CountText, NumTriangles, NumFullTriangles,
+            FStaticMeshLOD::ForcedLOD >= 0 ? *FString::Printf(TEXT("forced LOD%d"), FStaticMeshLOD::ForcedLOD) : TEXT("auto"), FStaticMeshLOD::Hysteresis
+        );
+    }
+    else if (Command == "meshlet test")
+    {
+        TArray<FMeshClusterTestResult> Results;
+        TArray<FString> Failures;
+        const bool bPassed = FMeshClusterTest::Run(Results, Failures);
+
+        for (const FMeshClusterTestResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%-22s %5d tris, %4d clusters (%.1f tris, %.1f verts), culled %.1f%% (frustum %lld, backface %lld) (%.2fms)",
+                *Result.Name, Result.NumTriangles, Result.NumClusters, Result.AverageTriangles, Result.AverageVertices,
+                Result.CullStats.GetCulledTriangleRatio() * 100.0f, Result.CullStats.NumFrustumCulledTriangles, Result.CullStats.NumBackfaceCulledTriangles,
+                Result.BuildMs
+            );
+        }
+        for (const FString& Failure : Failures)
+        {
+            AddLog(LogLevel::Error, "%s", *Failure);
+        }
+        AddLog(bPassed ? LogLevel::Display : LogLevel::Error, "Mesh cluster test %s: %d cases", bPassed ? "passed" : "FAILED", Results.Num());
+    }
+    else if (Command == "meshlet on" || Command == "meshlet off")
+    {
+        FMeshCluster::bCullingEnabled = Command == "meshlet on";
+        AddLog(LogLevel::Display, "Static mesh cluster culling %s", FMeshCluster::bCullingEnabled ? "enabled" : "disabled");
+    }
+    else if (Command == "meshlet")
+    {
+        const auto LogStats = [this](const char* ViewName, const FClusterCullStats& Stats)
+        {
+            AddLog(
+                LogLevel::Display, "%s: %lld / %lld clusters visible, %lld / %lld triangles culled (%.1f%%, frustum %lld, backface %lld, occlusion %lld), %lld draw ranges",
+                ViewName, Stats.NumVisibleClusters, Stats.NumClusters, Stats.GetNumCulledTriangles(), Stats.NumTriangles,
+                Stats.GetCulledTriangleRatio() * 100.0f, Stats.NumFrustumCulledTriangles, Stats.NumBackfaceCulledTriangles, Stats.NumOcclusionCulledTriangles,
+                Stats.NumDrawRanges
+            );
+        };
+        LogStats("Camera", FMeshCluster::MainViewStats);
+        LogStats("Shadow", FMeshCluster::ShadowViewStats);
+        AddLog(LogLevel::Display, "Cluster culling %s", FMeshCluster::bCullingEnabled ? "enabled" : "disabled");
+
+        FMeshCluster::MainViewStats = FClusterCullStats();
+        FMeshCluster::ShadowViewStats = FClusterCullStats();
+    }
+    else if (Command == "occlusion test")
+    {
+        TArray<FSoftwareOcclusionTestResult> Results;
+        TArray<FString> Failures;
+        const bool bPassed = FSoftwareOcclusionTest::Run(Results, Failures);
+
+        for (const FSoftwareOcclusionTestResult& Result : Results)
+        {
+            AddLog(
+                LogLevel::Display, "%-36s %4d objects, occluded %4d, outside %4d, %5d occluder triangles (%.2fms)",
+                *Result.Name, Result.NumObjects, Result.NumOccluded, Result.NumOutsideView, Result.NumOccluderTriangles, Result.CullMs
+            );
+        }
+        for (const FString& Failure : Failures)
+        {
+            AddLog(LogLevel::Error, "%s", *Failure);
+        }
+        AddLog(bPassed ? LogLevel::Display : LogLevel::Error, "Software occlusion test %s: %d cases", bPassed ? "passed" : "FAILED", Results.Num());
+    }
+    else if (Command.starts_with("occlusion bench"))
+    {
+        const int32 GridSize = Command.size() > 16 ? std::atoi(Command.c_str() + 16) : 32;
+        const FOcclusionBenchmarkResult Result = FSoftwareOcclusionTest::RunBenchmark(GridSize, 100);
+        AddLog(
+            LogLevel::Display, "Occlusion culling: %d objects, %d occluders (%d triangles), occluded %d, outside %d, avg %.3f ms (min %.3f, max %.3f, raster %.3f, test %.3f)",
+            Result.NumObjects, Result.NumOccluders, Result.NumOccluderTriangles, Result.NumOccluded, Result.NumOutsideView,
+            Result.AverageMs, Result.MinMs, Result.MaxMs, Result.RasterizeMs, Result.TestMs
+        );
+    }
+    else if (Command == "occlusion on" || Command == "occlusion off")
+    {
+        FSoftwareOcclusionCulling::bEnabled = Command == "occlusion on";
+        AddLog(LogLevel::Display, "Software occlusion culling %s", FSoftwareOcclusionCulling::bEnabled ? "enabled" : "disabled");
+    }
+    else if (Command == "occlusion")
+    {
+        const FOcclusionCullStats& Stats = FSoftwareOcclusionCulling::TotalStats;
+        const double NumViews = FMath::Max<double>(static_cast<double>(Stats.NumViews), 1.0);
+        AddLog(
+            LogLevel::Display, "%lld views: %lld / %lld objects culled (%.1f%%, occluded %lld, outside %lld), %.1f occluders (%.0f triangles), raster %.3f ms, test %.3f ms per view",
+            Stats.NumViews, Stats.GetNumCulled(), Stats.NumObjects, Stats.GetCulledRatio() * 100.0f, Stats.NumOccluded, Stats.NumOutsideView,
+            Stats.NumOccluders / NumViews, Stats.NumOccluderTriangles / NumViews, Stats.RasterizeMs / NumViews, Stats.TestMs / NumViews
+        );
+        AddLog(LogLevel::Display, "Software occlusion culling %s", FSoftwareOcclusionCulling::bEnabled ? "enabled" : "disabled");
+
+        FSoftwareOcclusionCulling::TotalStats = FOcclusionCullStats();
+    }
     else
     {
         AddLog(LogLevel::Error, "Unknown command: %s", Command.c_str());
@@ -3,15 +3,9 @@
 #include "D3D11RHI/GraphicDevice.h"
 #include "HAL/PlatformType.h"
 #include "UObject/NameTypes.h"
+#include "Logging/LogMacros.h"
 
-#define UE_LOG Console::GetInstance().AddLog
-
-enum class LogLevel : uint8
-{
-    Display,
-    Warning,
-    Error
-};
+DECLARE_LOG_CATEGORY_EXTERN(LogConsole)
 
 class StatOverlay
 {
@@ -71,18 +65,13 @@ public:
     static Console& GetInstance(); // 참조 반환으로 변경
 
     void Clear();
+
+    /** 콘솔 명령의 출력. 바로 문자열로 만든 뒤 LogConsole 카테고리로 남깁니다. */
     void AddLog(LogLevel Level, const char* Format, ...);
     void Draw();
     void ExecuteCommand(const std::string& Command);
     void OnResize(HWND hWnd);
 public:
-    struct LogEntry
-    {
-        LogLevel Level;
-        FString Message;
-    };
-
-    TArray<LogEntry> Items;
     TArray<FString> History;
     int32 HistoryPos = -1;
     char InputBuf[256] = "";
@@ -98,6 +87,7 @@ public:
 
 private:
     bool bExpand = true;
+    uint64 LastLogVersion = 0;
     UINT Width;
     UINT Height;
 };
@@ -0,0 +1,174 @@
+#include "LevelDuplicator.h"
+
+#include "Level.h"
+#include "WindowsPlatformTime.h"
+#include "Components/SceneComponent.h"
+#include "Container/Map.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/DuplicateDataArchive.h"
+#include "Serialization/FieldArchive.h"
+#include "UObject/Casts.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "World/World.h"
+
+
+namespace
+{
+    struct FActorDuplicate
+    {
+        AActor* Source = nullptr;
+        AActor* Duplicate = nullptr;
+
+        // 같은 Index끼리 원본 / 복제본
+        TArray<UActorComponent*> SourceComponents;
+        TArray<UActorComponent*> Components;
+    };
+
+    /** 생성자가 만든 기본 컴포넌트 중 원본과 이름, 클래스가 같은 것을 찾아 목록에서 꺼냅니다. */
+    UActorComponent* ClaimDefaultComponent(TArray<UActorComponent*>& DefaultComponents, const UActorComponent* SourceComponent)
+    {
+        for (int32 Index = 0; Index < DefaultComponents.Num(); ++Index)
+        {
+            UActorComponent* Candidate = DefaultComponents[Index];
+            if (Candidate->GetFName() == SourceComponent->GetFName() && Candidate->GetClass() == SourceComponent->GetClass())
+            {
+                DefaultComponents.RemoveAt(Index);
+                return Candidate;
+            }
+        }
+        return nullptr;
+    }
+
+    UObject* FindDuplicate(const TMap<UObject*, UObject*>& DuplicatedObjects, UObject* Source)
+    {
+        UObject* const* Found = Source ? DuplicatedObjects.Find(Source) : nullptr;
+        return Found ? *Found : nullptr;
+    }
+}
+
+void FLevelDuplicator::DuplicateActors(const ULevel& SourceLevel, ULevel& DestLevel, UWorld* DestWorld)
+{
+    LastStats = FLevelDuplicationStats();
+
+    TArray<FActorDuplicate> Actors;
+    Actors.SetNum(SourceLevel.Actors.Num());
+
+    int32 NumObjects = 0;
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        FActorDuplicate& Actor = Actors[Index];
+        Actor.Source = SourceLevel.Actors[Index];
+        Actor.SourceComponents = Actor.Source->GetComponents().Array();
+        NumObjects += 1 + Actor.SourceComponents.Num();
+    }
+    LastStats.NumActors = Actors.Num();
+    LastStats.NumComponents = NumObjects - Actors.Num();
+
+    // 1. 원본 필드를 버퍼 하나에 순서대로 씀
+    uint64 PhaseStartCycles = FPlatformTime::Cycles64();
+
+    TArray<uint8> Data;
+    {
+        FDuplicateDataWriter Writer(Data);
+        FFieldArchive Ar = FFieldArchive::ForDuplication(Writer);
+        for (const FActorDuplicate& Actor : Actors)
+        {
+            Actor.Source->SerializeFields(Ar);
+            for (UActorComponent* SourceComponent : Actor.SourceComponents)
+            {
+                SourceComponent->SerializeFields(Ar);
+            }
+        }
+    }
+    LastStats.ArchiveBytes = Data.Num();
+    LastStats.SerializeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStartCycles);
+
+    // 2. 복제본을 만들고 Root / 부착 관계 연결
+    PhaseStartCycles = FPlatformTime::Cycles64();
+
+    TMap<UObject*, UObject*> DuplicatedObjects;
+    DuplicatedObjects.Reserve(NumObjects);
+    GUObjectArray.Reserve(NumObjects);
+    DestLevel.Actors.Reserve(DestLevel.Actors.Num() + Actors.Num());
+    {
+        FObjectFactory::FScopedSilentConstruction SilentConstruction;
+
+        for (FActorDuplicate& Actor : Actors)
+        {
+            Actor.Duplicate = Cast<AActor>(FObjectFactory::ConstructObject(Actor.Source->GetClass(), DestWorld));
+            DuplicatedObjects.Add(Actor.Source, Actor.Duplicate);
+            DestLevel.Actors.Add(Actor.Duplicate);
+
+            TArray<UActorComponent*> DefaultComponents = Actor.Duplicate->GetComponents().Array();
+            Actor.Components.Reserve(Actor.SourceComponents.Num());
+            for (UActorComponent* SourceComponent : Actor.SourceComponents)
+            {
+                UActorComponent* Component = ClaimDefaultComponent(DefaultComponents, SourceComponent);
+                if (Component)
+                {
+                    ++LastStats.NumReusedComponents;
+                }
+                else
+                {
+                    Component = Actor.Duplicate->AddComponent(SourceComponent->GetClass(), SourceComponent->GetFName(), false);
+                }
+                Actor.Components.Add(Component);
+                DuplicatedObjects.Add(SourceComponent, Component);
+            }
+
+            // 원본에서 지워진 기본 컴포넌트
+            for (UActorComponent* UnusedComponent : DefaultComponents)
+            {
+                UnusedComponent->DestroyComponent();
+            }
+
+            if (USceneComponent* SourceRoot = Actor.Source->GetRootComponent())
+            {
+                Actor.Duplicate->SetRootComponent(Cast<USceneComponent>(FindDuplicate(DuplicatedObjects, SourceRoot)));
+            }
+
+            for (int32 Index = 0; Index < Actor.Components.Num(); ++Index)
+            {
+                USceneComponent* SourceSceneComponent = Cast<USceneComponent>(Actor.SourceComponents[Index]);
+                if (SourceSceneComponent == nullptr)
+                {
+                    continue;
+                }
+
+                // 기본 컴포넌트는 생성자에서 이미 같은 부모에 붙어 있는 경우가 대부분
+                USceneComponent* SceneComponent = static_cast<USceneComponent*>(Actor.Components[Index]);
+                USceneComponent* Parent = Cast<USceneComponent>(FindDuplicate(DuplicatedObjects, SourceSceneComponent->GetAttachParent()));
+                if (SceneComponent->GetAttachParent() != Parent)
+                {
+                    SceneComponent->AttachToComponent(Parent);
+                }
+            }
+        }
+    }
+    LastStats.ConstructMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStartCycles);
+
+    // 3. 같은 순서로 필드를 읽음. 객체 참조는 DuplicatedObjects로 바뀜
+    PhaseStartCycles = FPlatformTime::Cycles64();
+    {
+        FDuplicateDataReader Reader(Data, DuplicatedObjects);
+        FFieldArchive Ar = FFieldArchive::ForDuplication(Reader);
+        for (const FActorDuplicate& Actor : Actors)
+        {
+            Actor.Duplicate->SerializeFields(Ar);
+            for (UActorComponent* Component : Actor.Components)
+            {
+                Component->SerializeFields(Ar);
+            }
+        }
+
+        // 저장과 로드에서 다른 필드를 호출하는 SerializeFields가 있으면 여기서 드러남
+        if (static_cast<FArchive&>(Reader).Tell() != Data.Num())
+        {
+            UE_LOG(LogLevel::Error, "Level duplication read %lld of %d bytes. A SerializeFields saves and loads different fields.",
+                static_cast<FArchive&>(Reader).Tell(), Data.Num()
+            );
+        }
+    }
+    LastStats.LoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStartCycles);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+class ULevel;
+class UWorld;
+
+
+struct FLevelDuplicationStats
+{
+    int32 NumActors = 0;
+    int32 NumComponents = 0;
+    int32 NumReusedComponents = 0;      // 생성자가 만든 기본 컴포넌트를 그대로 사용한 수
+    int64 ArchiveBytes = 0;
+
+    double SerializeMs = 0.0;
+    double ConstructMs = 0.0;
+    double LoadMs = 0.0;
+};
+
+/**
+ * Level의 액터를 메모리 Archive 한 번 왕복으로 복제합니다. PIE 진입 시 UWorld::Duplicate에서 사용합니다.
+ *
+ *   1. 원본 액터 / 컴포넌트의 SerializeFields를 복제 모드로 버퍼 하나에 씁니다.
+ *   2. 객체 수만큼 GUObjectArray를 미리 늘려 두고 복제본을 만듭니다.
+ *      생성자가 만든 기본 컴포넌트는 이름과 클래스가 같으면 지우지 않고 그대로 사용합니다.
+ *   3. 버퍼를 같은 순서로 읽어 필드를 채웁니다. 객체 참조와 부착 관계는 원본 -> 복제본 표로 바꿉니다.
+ */
+struct FLevelDuplicator
+{
+    /** SourceLevel의 액터를 복제해서 DestLevel에 추가합니다. 복제된 액터의 Outer는 DestWorld입니다. */
+    static void DuplicateActors(const ULevel& SourceLevel, ULevel& DestLevel, UWorld* DestWorld);
+
+    /** 마지막 DuplicateActors의 통계 */
+    static const FLevelDuplicationStats& GetLastStats() { return LastStats; }
+
+private:
+    static inline FLevelDuplicationStats LastStats;
+};
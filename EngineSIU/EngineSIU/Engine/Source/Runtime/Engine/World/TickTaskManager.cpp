@@ -0,0 +1,409 @@
+#include "TickTaskManager.h"
+
+#include <algorithm>
+
+#include "Async/ParallelFor.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UserInterface/Console.h"
+
+//------------------------------------------------------------------------------
+// FTickFunction
+//------------------------------------------------------------------------------
+FTickFunction::~FTickFunction()
+{
+    UnRegisterTickFunction();
+
+    for (FTickFunction* Prerequisite : Prerequisites)
+    {
+        Prerequisite->Dependents.Remove(this);
+    }
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->Prerequisites.Remove(this);
+        if (Dependent->TickTaskManager)
+        {
+            Dependent->TickTaskManager->MarkOrderDirty(Dependent->TickGroup);
+        }
+    }
+}
+
+void FTickFunction::RegisterTickFunction(FTickTaskManager& InTickTaskManager)
+{
+    if (!bCanEverTick || IsTickFunctionRegistered())
+    {
+        return;
+    }
+
+    bTickEnabled = bStartWithTickEnabled;
+    TimeSinceLastTick = 0.0f;
+    InTickTaskManager.AddTickFunction(this);
+}
+
+void FTickFunction::UnRegisterTickFunction()
+{
+    if (TickTaskManager)
+    {
+        TickTaskManager->RemoveTickFunction(this);
+    }
+}
+
+void FTickFunction::SetTickFunctionEnable(bool bInEnabled)
+{
+    if (IsTickFunctionRegistered())
+    {
+        bTickEnabled = bInEnabled;
+    }
+    else
+    {
+        bStartWithTickEnabled = bInEnabled;
+    }
+}
+
+void FTickFunction::SetTickGroup(ETickingGroup InTickGroup)
+{
+    if (TickGroup == InTickGroup)
+    {
+        return;
+    }
+
+    FTickTaskManager* RegisteredManager = TickTaskManager;
+    if (RegisteredManager)
+    {
+        const bool bWasEnabled = bTickEnabled;
+        RegisteredManager->RemoveTickFunction(this);
+        TickGroup = InTickGroup;
+        RegisteredManager->AddTickFunction(this);
+        bTickEnabled = bWasEnabled;
+    }
+    else
+    {
+        TickGroup = InTickGroup;
+    }
+
+    // 다른 Group에 있는 의존 관계도 순서를 다시 계산
+    for (const FTickFunction* Dependent : Dependents)
+    {
+        if (Dependent->TickTaskManager)
+        {
+            Dependent->TickTaskManager->MarkOrderDirty(Dependent->TickGroup);
+        }
+    }
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction& Prerequisite)
+{
+    if (&Prerequisite == this)
+    {
+        return;
+    }
+
+    Prerequisites.AddUnique(&Prerequisite);
+    Prerequisite.Dependents.AddUnique(this);
+
+    if (TickTaskManager)
+    {
+        TickTaskManager->MarkOrderDirty(TickGroup);
+    }
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction& Prerequisite)
+{
+    Prerequisites.Remove(&Prerequisite);
+    Prerequisite.Dependents.Remove(this);
+
+    if (TickTaskManager)
+    {
+        TickTaskManager->MarkOrderDirty(TickGroup);
+    }
+}
+
+void FActorTickFunction::ExecuteTick(float DeltaTime)
+{
+    if (Target && !Target->IsActorBeingDestroyed())
+    {
+        Target->Tick(DeltaTime);
+    }
+}
+
+bool FActorTickFunction::CanTickInEditor() const
+{
+    return Target && Target->IsActorTickInEditor();
+}
+
+void FActorComponentTickFunction::ExecuteTick(float DeltaTime)
+{
+    if (Target && Target->IsActive())
+    {
+        Target->TickComponent(DeltaTime);
+    }
+}
+
+bool FActorComponentTickFunction::CanTickInEditor() const
+{
+    const AActor* Owner = Target ? Target->GetOwner() : nullptr;
+    return Owner && Owner->IsActorTickInEditor();
+}
+
+//------------------------------------------------------------------------------
+// FTickTaskManager
+//------------------------------------------------------------------------------
+FTickTaskManager::~FTickTaskManager()
+{
+    // 아직 등록된 Tick 함수는 이 Manager를 가리키지 않게 함
+    for (FTickGroup& Group : Groups)
+    {
+        for (FTickFunction* TickFunction : Group.TickFunctions)
+        {
+            if (TickFunction)
+            {
+                TickFunction->TickTaskManager = nullptr;
+                TickFunction->RegisteredIndex = -1;
+            }
+        }
+    }
+}
+
+void FTickTaskManager::AddTickFunction(FTickFunction* TickFunction)
+{
+    FTickGroup& Group = Groups[TickFunction->TickGroup];
+    TickFunction->TickTaskManager = this;
+    TickFunction->RegisteredIndex = Group.TickFunctions.Add(TickFunction);
+    Group.bOrderDirty = true;
+}
+
+void FTickTaskManager::RemoveTickFunction(FTickFunction* TickFunction)
+{
+    FTickGroup& Group = Groups[TickFunction->TickGroup];
+
+    // 실행 중에 해제될 수 있으므로 자리만 비우고, 압축은 다음 정렬 때 함
+    Group.TickFunctions[TickFunction->RegisteredIndex] = nullptr;
+    Group.bOrderDirty = true;
+
+    TickFunction->TickTaskManager = nullptr;
+    TickFunction->RegisteredIndex = -1;
+}
+
+void FTickTaskManager::RebuildOrder(ETickingGroup GroupIndex)
+{
+    FTickGroup& Group = Groups[GroupIndex];
+    Group.bOrderDirty = false;
+
+    // 빈 자리 압축
+    int32 NumFunctions = 0;
+    for (FTickFunction* TickFunction : Group.TickFunctions)
+    {
+        if (TickFunction)
+        {
+            TickFunction->RegisteredIndex = NumFunctions;
+            Group.TickFunctions[NumFunctions++] = TickFunction;
+        }
+    }
+    Group.TickFunctions.SetNum(NumFunctions);
+
+    auto IsInThisGroup = [this, GroupIndex](const FTickFunction* TickFunction)
+    {
+        return TickFunction->TickTaskManager == this && TickFunction->TickGroup == GroupIndex;
+    };
+
+    // 같은 Group 안의 Prerequisite만 간선으로 보고 위상 정렬 (Kahn)
+    TArray<int32> InDegree;
+    InDegree.SetNum(NumFunctions);
+    for (int32 Index = 0; Index < NumFunctions; ++Index)
+    {
+        FTickFunction* TickFunction = Group.TickFunctions[Index];
+        TickFunction->SortIndex = Index;
+        TickFunction->SortLevel = 0;
+        InDegree[Index] = 0;
+    }
+    for (int32 Index = 0; Index < NumFunctions; ++Index)
+    {
+        for (const FTickFunction* Prerequisite : Group.TickFunctions[Index]->Prerequisites)
+        {
+            if (IsInThisGroup(Prerequisite))
+            {
+                ++InDegree[Index];
+            }
+        }
+    }
+
+    TArray<FTickFunction*>& Sorted = Group.SortedFunctions;
+    Sorted.Reset();
+    Sorted.Reserve(NumFunctions);
+    for (int32 Index = 0; Index < NumFunctions; ++Index)
+    {
+        if (InDegree[Index] == 0)
+        {
+            Sorted.Add(Group.TickFunctions[Index]);
+        }
+    }
+
+    int32 MaxLevel = 0;
+    for (int32 Cursor = 0; Cursor < Sorted.Num(); ++Cursor)
+    {
+        const FTickFunction* TickFunction = Sorted[Cursor];
+        MaxLevel = std::max(MaxLevel, TickFunction->SortLevel);
+        for (FTickFunction* Dependent : TickFunction->Dependents)
+        {
+            if (!IsInThisGroup(Dependent))
+            {
+                continue;
+            }
+
+            Dependent->SortLevel = std::max(Dependent->SortLevel, TickFunction->SortLevel + 1);
+            if (--InDegree[Dependent->SortIndex] == 0)
+            {
+                Sorted.Add(Dependent);
+            }
+        }
+    }
+
+    // 순환 의존이 남아 있으면 의존을 무시하고 마지막 Level에서 실행
+    if (Sorted.Num() < NumFunctions)
+    {
+        UE_LOG(LogLevel::Warning, "Tick prerequisite cycle detected in tick group %d (%d functions)", GroupIndex, NumFunctions - Sorted.Num());
+        ++MaxLevel;
+        for (int32 Index = 0; Index < NumFunctions; ++Index)
+        {
+            if (InDegree[Index] > 0)
+            {
+                Group.TickFunctions[Index]->SortLevel = MaxLevel;
+                Sorted.Add(Group.TickFunctions[Index]);
+            }
+        }
+    }
+
+    std::stable_sort(Sorted.begin(), Sorted.end(), [](const FTickFunction* A, const FTickFunction* B)
+    {
+        return A->SortLevel < B->SortLevel;
+    });
+
+    Group.LevelStarts.Reset();
+    for (int32 Index = 0; Index < Sorted.Num(); ++Index)
+    {
+        if (Index == 0 || Sorted[Index]->SortLevel != Sorted[Index - 1]->SortLevel)
+        {
+            Group.LevelStarts.Add(Index);
+        }
+    }
+    Group.LevelStarts.Add(Sorted.Num());
+}
+
+void FTickTaskManager::RunTickGroup(ETickingGroup GroupIndex, float DeltaTime, bool bEditorWorld)
+{
+    FTickGroup& Group = Groups[GroupIndex];
+    if (Group.bOrderDirty)
+    {
+        RebuildOrder(GroupIndex);
+    }
+
+    Group.Stats = {};
+    Group.Stats.NumRegistered = Group.TickFunctions.Num();
+    Group.Stats.NumLevels = std::max(Group.LevelStarts.Num() - 1, 0);
+
+    for (int32 Level = 0; Level + 1 < Group.LevelStarts.Num(); ++Level)
+    {
+        PendingTicks.Reset();
+
+        // 실행할 함수와 그 DeltaTime을 게임 스레드에서 먼저 확정
+        for (int32 Index = Group.LevelStarts[Level]; Index < Group.LevelStarts[Level + 1]; ++Index)
+        {
+            FTickFunction* TickFunction = Group.SortedFunctions[Index];
+
+            // 이번 프레임에 해제되었거나 다른 Group으로 옮겨진 함수
+            if (TickFunction->TickTaskManager != this || TickFunction->TickGroup != GroupIndex || !TickFunction->bTickEnabled)
+            {
+                continue;
+            }
+            if (bEditorWorld && !TickFunction->CanTickInEditor())
+            {
+                continue;
+            }
+
+            float TickDeltaTime = DeltaTime;
+            if (TickFunction->TickInterval > 0.0f)
+            {
+                TickFunction->TimeSinceLastTick += DeltaTime;
+                if (TickFunction->TimeSinceLastTick < TickFunction->TickInterval)
+                {
+                    continue;
+                }
+                TickDeltaTime = TickFunction->TimeSinceLastTick;
+                TickFunction->TimeSinceLastTick = 0.0f;
+            }
+
+            PendingTicks.Add({TickFunction, TickDeltaTime, static_cast<bool>(TickFunction->bRunOnAnyThread)});
+        }
+
+        // 순서를 바꾸지 않도록, 연달아 있는 bRunOnAnyThread Tick 구간만 병렬로 실행
+        int32 RunStart = 0;
+        while (RunStart < PendingTicks.Num())
+        {
+            const bool bParallelRun = PendingTicks[RunStart].bRunOnAnyThread;
+            int32 RunEnd = RunStart + 1;
+            while (RunEnd < PendingTicks.Num() && PendingTicks[RunEnd].bRunOnAnyThread == bParallelRun)
+            {
+                ++RunEnd;
+            }
+
+            if (bParallelRun && RunEnd - RunStart >= MinParallelTickCount)
+            {
+                // 병렬 실행 중에는 해제가 게임 스레드 작업으로 미뤄지므로 TickTaskManager를 읽어도 안전
+                ParallelFor(RunEnd - RunStart, [this, RunStart](int32 Index)
+                {
+                    const FPendingTick& PendingTick = PendingTicks[RunStart + Index];
+                    if (PendingTick.TickFunction->TickTaskManager == this)
+                    {
+                        PendingTick.TickFunction->ExecuteTick(PendingTick.DeltaTime);
+                    }
+                });
+                Group.Stats.NumTickedInParallel += RunEnd - RunStart;
+            }
+            else
+            {
+                for (int32 Index = RunStart; Index < RunEnd; ++Index)
+                {
+                    // 앞선 Tick이 Actor를 제거했을 수 있음
+                    const FPendingTick& PendingTick = PendingTicks[Index];
+                    if (PendingTick.TickFunction->TickTaskManager == this)
+                    {
+                        PendingTick.TickFunction->ExecuteTick(PendingTick.DeltaTime);
+                    }
+                }
+            }
+            FlushGameThreadTasks();
+
+            RunStart = RunEnd;
+        }
+
+        Group.Stats.NumTicked += PendingTicks.Num();
+    }
+}
+
+void FTickTaskManager::EnqueueGameThreadTask(std::function<void()> Task)
+{
+    std::scoped_lock Lock(GameThreadTaskMutex);
+    GameThreadTasks.Add(std::move(Task));
+}
+
+void FTickTaskManager::FlushGameThreadTasks()
+{
+    // 실행 중에 새 작업이 예약될 수 있으므로 빌 때까지 반복
+    while (true)
+    {
+        {
+            std::scoped_lock Lock(GameThreadTaskMutex);
+            if (GameThreadTasks.IsEmpty())
+            {
+                return;
+            }
+            std::swap(GameThreadTasks, ExecutingGameThreadTasks);
+        }
+
+        for (const std::function<void()>& Task : ExecutingGameThreadTasks)
+        {
+            Task();
+        }
+        ExecutingGameThreadTasks.Reset();
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <functional>
+#include <mutex>
+
+#include "Container/Array.h"
+#include "Engine/EngineBaseTypes.h"
+
+struct FTickGroupStats
+{
+    int32 NumRegistered = 0;
+    int32 NumTicked = 0;            // 직전 실행에서 실제로 Tick한 수
+    int32 NumTickedInParallel = 0;
+    int32 NumLevels = 0;            // Prerequisite 깊이 (= 순차 실행 단계 수)
+};
+
+/**
+ * World 하나의 Tick 함수를 관리하고 실행합니다.
+ *
+ * Tick 함수는 TickGroup별 평탄한 배열에 보관되고, 등록 / 해제 / Prerequisite 변경이 있을 때만 실행 순서를 다시 계산합니다.
+ * 실행 순서는 Prerequisite 깊이(Level)별로 나뉘며, 한 Level 안에서는 등록 순서를 그대로 지킵니다.
+ * 순서상 연달아 있는 bRunOnAnyThread Tick끼리만 Worker 스레드에서 병렬로 실행하고,
+ * 그 사이에 EnqueueGameThreadTask로 예약된 작업을 처리한 뒤 다음 Tick으로 넘어갑니다.
+ */
+class FTickTaskManager
+{
+public:
+    /** 병렬 Tick이 이 수보다 적으면 게임 스레드에서 바로 실행 */
+    static constexpr int32 MinParallelTickCount = 16;
+
+    FTickTaskManager() = default;
+    ~FTickTaskManager();
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+    /**
+     * TickGroup 하나를 실행합니다. 게임 스레드에서만 호출해야 합니다.
+     * @param bEditorWorld true면 CanTickInEditor()인 Tick 함수만 실행
+     */
+    void RunTickGroup(ETickingGroup Group, float DeltaTime, bool bEditorWorld);
+
+    /** 병렬 Tick 안에서 게임 스레드가 해야 할 작업을 예약합니다. 현재 Level의 병렬 실행이 끝나면 실행됩니다. */
+    void EnqueueGameThreadTask(std::function<void()> Task);
+
+    const FTickGroupStats& GetStats(ETickingGroup Group) const { return Groups[Group].Stats; }
+
+private:
+    friend struct FTickFunction;
+
+    void AddTickFunction(FTickFunction* TickFunction);
+    void RemoveTickFunction(FTickFunction* TickFunction);
+    void MarkOrderDirty(ETickingGroup Group) { Groups[Group].bOrderDirty = true; }
+
+    struct FTickGroup
+    {
+        TArray<FTickFunction*> TickFunctions;   // 등록 순서. 해제된 자리는 다음 정렬 때까지 nullptr
+        TArray<FTickFunction*> SortedFunctions; // Prerequisite Level 순
+        TArray<int32> LevelStarts;              // SortedFunctions에서 각 Level이 시작하는 위치 (+ 끝)
+        bool bOrderDirty = false;
+        FTickGroupStats Stats;
+    };
+
+    struct FPendingTick
+    {
+        FTickFunction* TickFunction;
+        float DeltaTime;
+        bool bRunOnAnyThread;
+    };
+
+    void RebuildOrder(ETickingGroup GroupIndex);
+    void FlushGameThreadTasks();
+
+private:
+    FTickGroup Groups[TG_MAX];
+
+    // Level마다 재사용하는 작업 목록 (실행 순서)
+    TArray<FPendingTick> PendingTicks;
+
+    std::mutex GameThreadTaskMutex;
+    TArray<std::function<void()>> GameThreadTasks;
+    TArray<std::function<void()>> ExecutingGameThreadTasks;
+};
@@ -9,6 +9,7 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
+#include "Stats/Stats.h"
 
 UWorld* UWorld::CreateWorld(UObject* InOuter, const EWorldType InWorldType, const FString& InWorldName)
 {
@@ -31,6 +32,10 @@ UObject* UWorld::Duplicate(UObject* InOuter)
     UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
     NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
     NewWorld->ActiveLevel->InitLevel(NewWorld);
+    for (AActor* Actor : NewWorld->ActiveLevel->Actors)
+    {
+        Actor->RegisterAllActorTickFunctions(true);
+    }
     return NewWorld;
 }
 
@@ -72,6 +77,13 @@ void UWorld::Tick(float DeltaTime)
         }
         GetFirstPlayerController()->UpdateCameraManager(DeltaTime);
     }
+
+    const bool bEditorWorld = WorldType == EWorldType::Editor;
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TickGroup_PrePhysics);
+        TickTaskManager.RunTickGroup(TG_PrePhysics, DeltaTime, bEditorWorld);
+    }
+
     TArray<AActor*> ActorsCopy = GetActiveLevel()->Actors;
 
     for (AActor* Actor : ActorsCopy)
@@ -82,6 +94,11 @@ void UWorld::Tick(float DeltaTime)
         Actor->UpdateOverlaps();
     }
 
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TickGroup_DuringPhysics);
+        TickTaskManager.RunTickGroup(TG_DuringPhysics, DeltaTime, bEditorWorld);
+    }
+
     for (AActor* Actor : ActorsCopy)
     {
         if (!Actor || Actor->IsActorBeingDestroyed())
@@ -100,6 +117,11 @@ void UWorld::Tick(float DeltaTime)
         PendingDestroyActors.Empty();
     }
 
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TickGroup_PostPhysics);
+        TickTaskManager.RunTickGroup(TG_PostPhysics, DeltaTime, bEditorWorld);
+    }
+
     for (APlayerController* PlayerController : PlayerControllers)
     {
         if (PlayerController)
@@ -108,6 +130,11 @@ void UWorld::Tick(float DeltaTime)
         }
     }
 
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TickGroup_PostUpdateWork);
+        TickTaskManager.RunTickGroup(TG_PostUpdateWork, DeltaTime, bEditorWorld);
+    }
+
 }
 
 void UWorld::Release()
@@ -124,6 +151,8 @@ void UWorld::Release()
 
 AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
 {
+    MEMORY_TAG_SCOPE(World);
+
     if (!InClass)
     {
         UE_LOG(LogLevel::Error, TEXT("SpawnActor failed: ActorClass is null."));
@@ -137,6 +166,7 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         PendingBeginPlayActors.Add(NewActor);
 
         NewActor->PostSpawnInitialize();
+        NewActor->RegisterAllActorTickFunctions(true);
         return NewActor;
     }
 
@@ -5,6 +5,7 @@
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
 #include "Level.h"
+#include "TickTaskManager.h"
 
 class FObjectFactory;
 class AActor;
@@ -60,6 +61,8 @@ public:
 
     APlayerController* GetFirstPlayerController();
 
+    FTickTaskManager& GetTickTaskManager() { return TickTaskManager; }
+
 private:
     /** World에 존재하는 Actor를 제거합니다. */
     bool DestroyActor(AActor* ThisActor);
@@ -67,7 +70,7 @@ private:
 private:
     FString WorldName = "DefaultWorld";
 
-    ULevel* ActiveLevel;
+    ULevel* ActiveLevel = nullptr;
 
     /** Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들 */
     TArray<AActor*> PendingBeginPlayActors;
@@ -76,6 +79,9 @@ private:
 
     TArray<APlayerController*> PlayerControllers;
 
+    /** 이 World에 속한 Actor / Component의 Tick 함수 */
+    FTickTaskManager TickTaskManager;
+
 public:
 
     float TimeSeconds;
@@ -98,6 +104,7 @@ T* UWorld::DuplicateActor(T* InActor)
         T* NewActor = static_cast<T*>(InActor->Duplicate(this));
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        NewActor->RegisterAllActorTickFunctions(true);
         return NewActor;
     }
     return nullptr;
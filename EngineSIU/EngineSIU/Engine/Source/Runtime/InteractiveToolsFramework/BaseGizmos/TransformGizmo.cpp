@@ -85,6 +85,12 @@ void ATransformGizmo::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    // Gizmo는 Level에 속하지 않아 World의 Tick Manager에 등록되지 않으므로, 컴포넌트도 여기서 직접 Tick 합니다.
+    for (UActorComponent* Component : GetComponents())
+    {
+        Component->TickComponent(DeltaTime);
+    }
+
     // Editor 모드에서만 Tick.
     if (GEngine->ActiveWorld->WorldType != EWorldType::Editor)
     {
@@ -1,6 +1,7 @@
 #pragma once
 #include <cmath>
 #include <algorithm>
+#include "Core/CoreMiscDefines.h"
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "UObject/NameTypes.h"
@@ -10,8 +11,7 @@
 #include "Math/Vector4.h"
 #include "Math/Matrix.h"
 
-
-#define UE_LOG Console::GetInstance().AddLog
+#include "Logging/LogMacros.h"
 
 #define _TCHAR_DEFINED
 #include <d3d11.h>
@@ -23,6 +23,7 @@
 #define GOURAUD "LIGHTING_MODEL_GOURAUD"
 #define LAMBERT "LIGHTING_MODEL_LAMBERT"
 #define PHONG "LIGHTING_MODEL_BLINN_PHONG"
+#define PACKED_VERTEX "PACKED_VERTEX"
 
 struct FStaticMeshVertex
 {
@@ -34,6 +35,26 @@ struct FStaticMeshVertex
     uint32 MaterialIndex;
 };
 
+/**
+ * FStaticMeshVertex를 압축한 정점 (20바이트)
+ * 위치는 메시 바운드 기준 UNORM16, 노멀 / 탄젠트는 8면체 인코딩 SNORM16, UV는 half입니다.
+ * 색과 MaterialIndex는 없습니다. 변환은 FStaticMeshVertexPacking을 사용합니다.
+ */
+struct FPackedStaticMeshVertex
+{
+    uint16 X, Y, Z, Pad;
+    int16 NormalX, NormalY;
+    int16 TangentX, TangentY;
+    uint16 U, V;
+};
+
+/** GPU 정점 버퍼와 .bin 캐시에 쓰는 정점 형식 */
+enum class EStaticMeshVertexFormat : uint8
+{
+    Float,      // FStaticMeshVertex
+    Packed,     // FPackedStaticMeshVertex
+};
+
 // Material Subset
 struct FMaterialSubset
 {
@@ -78,6 +99,15 @@ struct FObjInfo
     TArray<FMaterialSubset> MaterialSubsets;
 };
 
+// FResourceMgr의 텍스처 테이블 슬롯 인덱스. 로드 시점에 한 번 해석해두고 Draw에서는 인덱스로 바로 접근
+struct FTextureHandle
+{
+    uint32 Index = static_cast<uint32>(INDEX_NONE);
+
+    bool IsValid() const { return Index != static_cast<uint32>(INDEX_NONE); }
+    bool operator==(const FTextureHandle& Other) const { return Index == Other.Index; }
+};
+
 struct FObjMaterialInfo
 {
     FString MaterialName;  // newmtl : Material Name.
@@ -112,6 +142,39 @@ struct FObjMaterialInfo
 
     FString AlphaTextureName;    // map_d : Alpha texture
     FWString AlphaTexturePath;
+
+    /* Runtime Texture Handle (직렬화하지 않음, UMaterial::ResolveTextureHandles에서 설정) */
+    FTextureHandle DiffuseTextureHandle;
+    FTextureHandle BumpTextureHandle;
+};
+
+// LOD1 이상. 정점 버퍼는 LOD0와 같이 쓰고 인덱스만 따로 가짐
+struct FStaticMeshLODResource
+{
+    TArray<UINT> Indices;
+    TArray<FMaterialSubset> MaterialSubsets;
+
+    float ScreenSize = 0.0f;    // 화면 크기(바운딩 구 반지름 / 화면 높이의 절반)가 이보다 작아지면 이 LOD를 씀
+    float Error = 0.0f;         // 메시 크기 대비 단순화 오차
+
+    ID3D11Buffer* IndexBuffer = nullptr;
+};
+
+// LOD0 인덱스를 잘게 나눈 클러스터(meshlet). 그릴 때 화면 밖이거나 모두 뒷면인 클러스터를 건너뜀
+struct FStaticMeshCluster
+{
+    uint32 IndexStart = 0;      // Indices 안의 위치. 클러스터의 삼각형은 이어져 있음
+    uint32 IndexCount = 0;
+    uint32 SubsetIndex = 0;     // MaterialSubsets 번호. 서브셋이 없으면 0
+    uint32 NumVertices = 0;     // 고유 정점 수
+
+    // 로컬 공간 바운딩 구
+    FVector Center;
+    float Radius = 0.0f;
+
+    // 면 노멀(cross(B - A, C - A))이 모두 들어가는 원뿔. ConeCutoff = sin(반각), 1이면 뒷면 판정 안 함
+    FVector ConeAxis;
+    float ConeCutoff = 1.0f;
 };
 
 struct FStaticMeshRenderData
@@ -130,6 +193,32 @@ struct FStaticMeshRenderData
 
     FVector BoundingBoxMin;
     FVector BoundingBoxMax;
+
+    // VertexBuffer의 형식. Vertices는 항상 FStaticMeshVertex로 유지합니다.
+    EStaticMeshVertexFormat VertexFormat = EStaticMeshVertexFormat::Float;
+
+    // LOD1부터. LOD0는 위의 Indices / MaterialSubsets / IndexBuffer
+    TArray<FStaticMeshLODResource> LODs;
+
+    // LOD0의 클러스터. 서브셋 순서대로 있고 서브셋 범위를 빈틈없이 나눔. 작은 메시는 비어 있음
+    TArray<FStaticMeshCluster> Clusters;
+
+    int32 GetNumLODs() const { return LODs.Num() + 1; }
+
+    ID3D11Buffer* GetIndexBuffer(int32 LODIndex) const
+    {
+        return LODIndex > 0 ? LODs[LODIndex - 1].IndexBuffer : IndexBuffer;
+    }
+
+    const TArray<FMaterialSubset>& GetMaterialSubsets(int32 LODIndex) const
+    {
+        return LODIndex > 0 ? LODs[LODIndex - 1].MaterialSubsets : MaterialSubsets;
+    }
+
+    int32 GetNumIndices(int32 LODIndex) const
+    {
+        return LODIndex > 0 ? LODs[LODIndex - 1].Indices.Num() : Indices.Num();
+    }
 };
 
 struct FVertexTexture
@@ -282,12 +371,21 @@ struct FBoneGizmo
     FVector4 Color;
 };
 
+/** 디버그 라인 스트림의 종류별 개수와 시작 위치 (float4 단위). ShaderLine.hlsl의 PrimitiveCounts와 같아야 함 */
 struct FPrimitiveCounts
 {
     int BoundingBoxCount;
     int ConeCount;
+    int OBBCount;
     int BoneCount;
-    int pad;
+
+    uint32 BoundingBoxOffset;
+    uint32 ConeOffset;
+    uint32 OBBOffset;
+    uint32 BoneOffset;
+
+    int ConeSegmentCount;
+    int pad[3];
 };
 
 #define MAX_LIGHTS 16
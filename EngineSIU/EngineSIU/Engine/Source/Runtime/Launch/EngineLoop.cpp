@@ -1,7 +1,15 @@
 #include "EngineLoop.h"
+#include <filesystem>
 #include "ImGuiManager.h"
 #include "UnrealClient.h"
 #include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "HAL/PlatformMemory.h"
+#include "Logging/Logger.h"
+#include "Stats/CpuProfiler.h"
+#include "Stats/Stats.h"
+#include "UObject/Casts.h"
+#include "FrameBenchmark.h"
 #include "Audio/AudioManager.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "Engine/EditorEngine.h"
@@ -11,6 +19,7 @@
 #include "UnrealEd/UnrealEd.h"
 #include "World/World.h"
 #include "Renderer/TileLightCullingPass.h"
+#include "Renderer/SoftwareOcclusion.h"
 #include "Engine/Lua/LuaScriptManager.h" 
 #include "Engine/Resource/FBXManager.h"
 #include "UnrealEd/EditorConfigManager.h"
@@ -35,7 +44,11 @@ FEngineLoop::FEngineLoop()
     , LevelEditor(nullptr)
     , UnrealEditor(nullptr)
     , BufferManager(nullptr)
+    , FramePacer(FrameClock)
 {
+    FFramePacerSettings PacerSettings;
+    PacerSettings.TargetFPS = TargetFPS;
+    FramePacer.SetSettings(PacerSettings);
 }
 
 int32 FEngineLoop::PreInit()
@@ -46,6 +59,9 @@ int32 FEngineLoop::PreInit()
 int32 FEngineLoop::Init(HINSTANCE hInstance)
 {
     FPlatformTime::InitTiming();
+    FCpuProfiler::Get().SetCurrentThreadName(TEXT("GameThread"));
+    FLogger::Get().Start(L"Saved/Logs/EngineSIU.log");
+    FJobSystem::Get().Initialize();
 
     /* must be initialized before window. */
     WindowInit(hInstance);
@@ -144,23 +160,15 @@ void FEngineLoop::Render() const
 
 void FEngineLoop::Tick()
 {
-    LARGE_INTEGER Frequency;
-    const double TargetFrameTime = 1000.0 / TargetFPS; // 한 프레임의 목표 시간 (밀리초 단위)
-
-    QueryPerformanceFrequency(&Frequency);
-
-    LARGE_INTEGER StartTime, EndTime;
-    double ElapsedTime = 0.0;
-
     while (bIsExit == false)
     {
-        FProfilerStatsManager::BeginFrame();    // Clear previous frame stats
+        FProfilerStatsManager::BeginFrame();
         if (GPUTimingManager.IsInitialized())
         {
             GPUTimingManager.BeginFrame();      // Start GPU frame timing
         }
 
-        QueryPerformanceCounter(&StartTime);
+        const FFrameTiming FrameTiming = FramePacer.BeginFrame();
 
         MSG Msg;
         while (PeekMessage(&Msg, nullptr, 0, 0, PM_REMOVE))
@@ -175,11 +183,17 @@ void FEngineLoop::Tick()
             }
         }
 
-        const float DeltaTime = static_cast<float>(ElapsedTime / 1000.f);
+        const float DeltaTime = static_cast<float>(FrameTiming.DeltaSeconds);
 
         AudioManager::Get().Tick();
+        // 스트리밍, 자동 저장은 프레임마다 진행하고, World는 고정 스텝이면 밀린 스텝 수만큼 나눠 진행 (0번일 수도 있음)
         GEngine->Tick(DeltaTime);
+        for (int32 Step = 0; Step < FrameTiming.NumSimulationSteps; ++Step)
+        {
+            GEngine->TickWorlds(static_cast<float>(FrameTiming.SimulationDeltaSeconds));
+        }
         LevelEditor->Tick(DeltaTime);
+        FJobSystem::Get().ProcessGameThreadJobs();
 
         UIMgr->BeginFrame();
 
@@ -253,13 +267,107 @@ void FEngineLoop::Tick()
         }
 
         GraphicDevice.SwapBuffer();
-        do
+
+        // 프레임이 끝난 직후에 통계를 내보내야 다음 프레임의 프로파일러 창이 이 프레임을 보여줌
+        FProfilerStatsManager::EndFrame();
+        FPlatformMemory::UpdatePeakStats();
+        FramePacer.WaitForNextFrame();
+    }
+}
+
+int32 FEngineLoop::RunBenchmark(const FFrameBenchmarkSettings& Settings)
+{
+    UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine);
+    if (EditorEngine == nullptr)
+    {
+        return 2;
+    }
+
+    // LoadSceneFromJsonFile은 실패 시 MessageBox를 띄우므로 미리 확인
+    if (!std::filesystem::exists(std::filesystem::path(Settings.ScenePath.ToWideString())))
+    {
+        UE_LOG(LogLevel::Error, "[Benchmark] Scene not found: %s", *Settings.ScenePath);
+        return 2;
+    }
+
+    EditorEngine->NewLevel();
+    EditorEngine->LoadLevel(Settings.ScenePath);
+    if (Settings.bStartPIE)
+    {
+        EditorEngine->StartPIE();
+    }
+
+    FSoftwareOcclusionCulling::bEnabled = Settings.bOcclusionCulling;
+
+    FFrameBenchmark Benchmark(Settings);
+
+    auto RunFrame = [this, &Settings]()
+    {
+        MSG Msg;
+        while (PeekMessage(&Msg, nullptr, 0, 0, PM_REMOVE))
+        {
+            TranslateMessage(&Msg);
+            DispatchMessage(&Msg);
+        }
+
         {
-            Sleep(0);
-            QueryPerformanceCounter(&EndTime);
-            ElapsedTime = (static_cast<double>(EndTime.QuadPart - StartTime.QuadPart) * 1000.f / static_cast<double>(Frequency.QuadPart));
-        } while (ElapsedTime < TargetFrameTime);
+            QUICK_SCOPE_CYCLE_COUNTER(Benchmark_EngineTick)
+            GEngine->Tick(Settings.DeltaTime);
+            GEngine->TickWorlds(Settings.DeltaTime);
+        }
+        FJobSystem::Get().ProcessGameThreadJobs();
+
+        if (!Settings.bNullRenderer)
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(Benchmark_Render)
+            Render();
+            GraphicDevice.SwapBuffer();
+        }
+        else
+        {
+            // 렌더링은 건너뛰어도 오클루전 컬링(CPU, SoftwareOcclusion_CPU)은 측정
+            Renderer.CullOcclusionWithoutRendering(GetLevelEditor()->GetActiveViewportClient());
+        }
+
+        GUObjectArray.ProcessPendingDestroyObjects();
+    };
+
+    for (uint32 Frame = 0; Frame < Settings.NumWarmupFrames; ++Frame)
+    {
+        FProfilerStatsManager::BeginFrame();
+        RunFrame();
+        FProfilerStatsManager::EndFrame();
     }
+
+    Benchmark.Begin();
+    for (uint32 Frame = 0; Frame < Settings.NumFrames; ++Frame)
+    {
+        FProfilerStatsManager::BeginFrame();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        RunFrame();
+        Benchmark.AddFrameTime(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+        FProfilerStatsManager::EndFrame();
+    }
+    Benchmark.End();
+
+    if (Settings.bStartPIE)
+    {
+        EditorEngine->EndPIE();
+    }
+
+    if (!Benchmark.WriteReport())
+    {
+        return 2;
+    }
+
+    const int32 NumRegressions = Benchmark.CompareWithBaseline();
+    if (NumRegressions == INDEX_NONE)
+    {
+        return 2;
+    }
+    return NumRegressions > 0 ? 1 : 0;
 }
 
 void FEngineLoop::GetClientSize(uint32& OutWidth, uint32& OutHeight) const
@@ -282,6 +390,12 @@ void FEngineLoop::Exit()
     LastWarGameUI->Release();
     FFBXManager::Get().Release();
     GEngine->Release();
+    FJobSystem::Get().Shutdown();
+    if (LuaScriptManager)
+    {
+        LuaScriptManager->Release();
+    }
+    FLogger::Get().Shutdown();
 
     delete UnrealEditor;
     delete BufferManager;
@@ -1,4 +1,5 @@
 #pragma once
+#include "Core/HAL/FramePacer.h"
 #include "Core/HAL/PlatformType.h"
 #include "Engine/ResourceMgr.h"
 #include "LevelEditor/SlateAppMessageHandler.h"
@@ -6,6 +7,7 @@
 #include "UnrealEd/PrimitiveDrawBatch.h"
 #include "Stats/ProfilerStatsManager.h"
 #include "Stats/GPUTimingManager.h"
+#include "Windows/WindowsFrameClock.h"
 
 
 class FSlateAppMessageHandler;
@@ -20,6 +22,7 @@ class SLevelEditor;
 class FDXDBufferManager;
 class FLuaScriptManager;
 class LastWarUI;
+struct FFrameBenchmarkSettings;
 
 class FEngineLoop
 {
@@ -32,6 +35,12 @@ public:
     void Tick();
     void Exit();
 
+    /**
+     * 저장된 Scene을 불러와 고정 DeltaTime으로 정해진 프레임 수만큼 돌리고 리포트를 남깁니다.
+     * @return 0: 정상, 1: Baseline 대비 Regression, 2: 실행 실패
+     */
+    int32 RunBenchmark(const FFrameBenchmarkSettings& Settings);
+
     void GetClientSize(uint32& OutWidth, uint32& OutHeight) const;
 
 private:
@@ -63,8 +72,12 @@ private:
     FDXDBufferManager* BufferManager; //TODO: UEngine으로 옮겨야함.
 
     bool bIsExit = false;
-    // @todo Option으로 선택 가능하도록
-    int32 TargetFPS = 999;
+
+    // @todo Option으로 선택 가능하도록. 콘솔의 "framepace fps"로 바꿀 수 있음
+    double TargetFPS = 999.0;
+
+    FWindowsFrameClock FrameClock;
+    FFramePacer FramePacer;
 
 private:
     FLuaScriptManager* LuaScriptManager = nullptr;
@@ -75,4 +88,7 @@ public:
     UnrealEd* GetUnrealEditor() const { return UnrealEditor; }
 
     FSlateAppMessageHandler* GetAppMessageHandler() const { return AppMessageHandler.get(); }
+
+    /** 프레임 레이트 제한, 고정 스텝 설정과 지터 통계 */
+    FFramePacer& GetFramePacer() { return FramePacer; }
 };
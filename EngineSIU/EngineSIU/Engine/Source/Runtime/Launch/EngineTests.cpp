@@ -0,0 +1,116 @@
+#include "EngineTests.h"
+
+#include <string>
+
+#include "FrameBenchmark.h"
+#include "Async/JobSystem.h"
+#include "Async/JobSystemBenchmark.h"
+#include "HAL/FramePacerTest.h"
+#include "Logging/LogMacros.h"
+#include "Renderer/SoftwareOcclusionTest.h"
+#include "Rendering/Mesh/MeshClusterTest.h"
+#include "Rendering/Mesh/MeshSimplifierTest.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    /** Function(TArray<FString>& OutFailures)를 돌리고 실패 항목에 Name을 붙여 옮깁니다. */
+    template <typename FunctionType>
+    void RunTest(const FString& Name, FunctionType&& Function, TArray<FEngineTestResult>& OutResults, TArray<FString>& OutFailures)
+    {
+        TArray<FString> Failures;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const bool bPassed = Function(Failures);
+
+        FEngineTestResult Result;
+        Result.Name = Name;
+        Result.bPassed = bPassed;
+        Result.NumFailures = Failures.Num();
+        Result.ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        OutResults.Add(Result);
+
+        for (const FString& Failure : Failures)
+        {
+            OutFailures.Add(Name + TEXT(": ") + Failure);
+        }
+    }
+}
+
+bool FEngineTests::ParseCommandLine(const FString& CommandLine)
+{
+    TArray<std::string> Tokens;
+    TokenizeCommandLine(CommandLine.GetContainerPrivate().c_str(), Tokens);
+
+    for (const std::string& Token : Tokens)
+    {
+        if (Token == "-test")
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FEngineTests::RunAll(TArray<FEngineTestResult>& OutResults, TArray<FString>& OutFailures)
+{
+    const int32 NumResultsBefore = OutResults.Num();
+
+    RunTest(TEXT("Job system"), [](TArray<FString>& Failures)
+    {
+        return FJobSystemBenchmark::RunStressTest(NumJobStressIterations, Failures);
+    }, OutResults, OutFailures);
+
+    RunTest(TEXT("Frame pacer"), [](TArray<FString>& Failures)
+    {
+        return FFramePacerTest::Run(Failures);
+    }, OutResults, OutFailures);
+
+    RunTest(TEXT("Mesh simplifier"), [](TArray<FString>& Failures)
+    {
+        TArray<FMeshSimplifierTestResult> Results;
+        return FMeshSimplifierTest::Run(Results, Failures);
+    }, OutResults, OutFailures);
+
+    RunTest(TEXT("Mesh cluster"), [](TArray<FString>& Failures)
+    {
+        TArray<FMeshClusterTestResult> Results;
+        return FMeshClusterTest::Run(Results, Failures);
+    }, OutResults, OutFailures);
+
+    RunTest(TEXT("Software occlusion"), [](TArray<FString>& Failures)
+    {
+        TArray<FSoftwareOcclusionTestResult> Results;
+        return FSoftwareOcclusionTest::Run(Results, Failures);
+    }, OutResults, OutFailures);
+
+    bool bPassed = true;
+    for (int32 Index = NumResultsBefore; Index < OutResults.Num(); ++Index)
+    {
+        bPassed &= OutResults[Index].bPassed;
+    }
+    return bPassed;
+}
+
+int32 FEngineTests::RunHeadless()
+{
+    FJobSystem::Get().Initialize();
+
+    TArray<FEngineTestResult> Results;
+    TArray<FString> Failures;
+    const bool bPassed = RunAll(Results, Failures);
+
+    for (const FString& Failure : Failures)
+    {
+        UE_LOG(LogLevel::Error, "[Test] %s", *Failure);
+    }
+    for (const FEngineTestResult& Result : Results)
+    {
+        UE_LOG(
+            Result.bPassed ? LogLevel::Display : LogLevel::Error, "[Test] %-20s %s (%.1fms)",
+            *Result.Name, Result.bPassed ? "passed" : "FAILED", Result.ElapsedMs
+        );
+    }
+
+    FJobSystem::Get().Shutdown();
+    return bPassed ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FEngineTestResult
+{
+    FString Name;
+    bool bPassed = true;
+    int32 NumFailures = 0;
+    double ElapsedMs = 0.0;
+};
+
+/**
+ * 엔진 자체 테스트를 한 번에 돌립니다. 콘솔의 "test all"과 엔진 초기화 전의 -test에서 호출합니다.
+ * Job System 스트레스 / 프레임 페이서 / 메시 단순화 / 메시 클러스터 / 소프트웨어 오클루전 테스트를 차례로 돌리며, 모두 렌더링 디바이스가 필요 없습니다.
+ *
+ * 커맨드 라인 예:
+ *   EngineSIU.exe -test
+ */
+struct FEngineTests
+{
+    /** Job System 스트레스 테스트의 반복 횟수 */
+    static constexpr int32 NumJobStressIterations = 10;
+
+    /** @return -test 가 있으면 true */
+    static bool ParseCommandLine(const FString& CommandLine);
+
+    /**
+     * 테스트를 모두 돌립니다. 실패한 항목은 앞에 테스트 이름을 붙여 OutFailures에 모읍니다.
+     * 게임 스레드에서 호출해야 합니다.
+     */
+    static bool RunAll(TArray<FEngineTestResult>& OutResults, TArray<FString>& OutFailures);
+
+    /**
+     * Job System만 띄워 RunAll을 돌리고 결과를 로그로 남깁니다.
+     * @return 프로세스 종료 코드. 실패한 테스트가 있으면 1
+     */
+    static int32 RunHeadless();
+};
@@ -0,0 +1,299 @@
+#include "FrameBenchmark.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "Core/CoreMiscDefines.h"
+#include "JSON/json.hpp"
+#include "Math/MathUtility.h"
+#include "Renderer/SoftwareOcclusion.h"
+#include "Stats/CpuProfiler.h"
+#include "UserInterface/Console.h"
+
+using json = nlohmann::json;
+
+namespace
+{
+    double GetSortedPercentile(const TArray<double>& Sorted, double Percentile)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0;
+        }
+        const int32 Rank = static_cast<int32>(Percentile / 100.0 * Sorted.Num() + 0.5);
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+
+    // 평균이 Baseline보다 Threshold 비율 이상 늘었는지 검사하고 로그를 남김
+    bool CheckRegression(const std::string& Name, double Baseline, double Current, float Threshold)
+    {
+        if (Baseline <= 0.0)
+        {
+            return false;
+        }
+
+        const double Ratio = (Current - Baseline) / Baseline;
+        const bool bRegressed = Ratio > Threshold;
+        UE_LOG(
+            bRegressed ? LogLevel::Error : LogLevel::Display, "[Benchmark] %-32s base %8.3f ms -> %8.3f ms (%+.1f%%)%s",
+            Name.c_str(), Baseline, Current, Ratio * 100.0, bRegressed ? " REGRESSION" : ""
+        );
+        return bRegressed;
+    }
+}
+
+void TokenizeCommandLine(const std::string& CommandLine, TArray<std::string>& OutTokens)
+{
+    std::string Current;
+    bool bInQuotes = false;
+    for (const char Char : CommandLine)
+    {
+        if (Char == '"')
+        {
+            bInQuotes = !bInQuotes;
+        }
+        else if (Char == ' ' && !bInQuotes)
+        {
+            if (!Current.empty())
+            {
+                OutTokens.Add(Current);
+                Current.clear();
+            }
+        }
+        else
+        {
+            Current += Char;
+        }
+    }
+    if (!Current.empty())
+    {
+        OutTokens.Add(Current);
+    }
+}
+
+bool FFrameBenchmarkSettings::ParseCommandLine(const FString& CommandLine, FFrameBenchmarkSettings& OutSettings)
+{
+    TArray<std::string> Tokens;
+    TokenizeCommandLine(CommandLine.GetContainerPrivate().c_str(), Tokens);
+
+    bool bBenchmark = false;
+    for (const std::string& Token : Tokens)
+    {
+        const size_t EqualPos = Token.find('=');
+        const std::string Key = Token.substr(0, EqualPos);
+        const std::string Value = EqualPos != std::string::npos ? Token.substr(EqualPos + 1) : std::string();
+
+        if (Key == "-benchmark" && !Value.empty())
+        {
+            OutSettings.ScenePath = Value;
+            bBenchmark = true;
+        }
+        else if (Key == "-frames")
+        {
+            OutSettings.NumFrames = FMath::Max(std::atoi(Value.c_str()), 1);
+        }
+        else if (Key == "-warmup")
+        {
+            OutSettings.NumWarmupFrames = FMath::Max(std::atoi(Value.c_str()), 0);
+        }
+        else if (Key == "-dt")
+        {
+            OutSettings.DeltaTime = FMath::Max(static_cast<float>(std::atof(Value.c_str())), 0.0f);
+        }
+        else if (Key == "-report" && !Value.empty())
+        {
+            OutSettings.ReportPath = Value;
+        }
+        else if (Key == "-baseline")
+        {
+            OutSettings.BaselinePath = Value;
+        }
+        else if (Key == "-threshold")
+        {
+            OutSettings.RegressionThreshold = static_cast<float>(std::atof(Value.c_str()));
+        }
+        else if (Key == "-nullrhi")
+        {
+            OutSettings.bNullRenderer = true;
+        }
+        else if (Key == "-pie")
+        {
+            OutSettings.bStartPIE = true;
+        }
+        else if (Key == "-occlusion")
+        {
+            OutSettings.bOcclusionCulling = Value.empty() || std::atoi(Value.c_str()) != 0;
+        }
+    }
+    return bBenchmark;
+}
+
+FFrameBenchmark::FFrameBenchmark(const FFrameBenchmarkSettings& InSettings)
+    : Settings(InSettings)
+    , OcclusionStats(std::make_unique<FOcclusionCullStats>())
+{
+}
+
+FFrameBenchmark::~FFrameBenchmark() = default;
+
+void FFrameBenchmark::Begin()
+{
+    FrameTimesMs.Empty();
+    FrameTimesMs.Reserve(Settings.NumFrames);
+    Stats.Empty();
+
+    // 링을 비우고 측정 프레임 수만큼만 보관. 워밍업 프레임은 이미 EndFrame에서 닫혔으므로 집계에 섞이지 않음
+    FCpuProfiler::Get().SetFrameHistoryCount(Settings.NumFrames);
+
+    FSoftwareOcclusionCulling::TotalStats = FOcclusionCullStats();
+}
+
+void FFrameBenchmark::AddFrameTime(double FrameMs)
+{
+    FrameTimesMs.Add(FrameMs);
+}
+
+void FFrameBenchmark::End()
+{
+    TotalSeconds = 0.0;
+    for (const double FrameMs : FrameTimesMs)
+    {
+        TotalSeconds += FrameMs / 1000.0;
+    }
+
+    TArray<FCpuScopeAggregate> Aggregates;
+    FCpuProfiler::Get().GatherScopeAggregates(Aggregates);
+
+    const double NumFrames = FMath::Max<double>(FrameTimesMs.Num(), 1.0);
+    for (const FCpuScopeAggregate& Aggregate : Aggregates)
+    {
+        FFrameBenchmarkStat Stat;
+        Stat.Name = Aggregate.StatName.ToString();
+        Stat.Count = Aggregate.Count;
+        Stat.AvgMs = Aggregate.TotalMs / NumFrames;
+        Stat.P50Ms = Aggregate.P50Ms;
+        Stat.P95Ms = Aggregate.P95Ms;
+        Stat.MaxMs = Aggregate.MaxMs;
+        Stats.Add(Stat);
+    }
+
+    *OcclusionStats = FSoftwareOcclusionCulling::TotalStats;
+}
+
+bool FFrameBenchmark::WriteReport() const
+{
+    TArray<double> Sorted = FrameTimesMs;
+    Sorted.Sort();
+
+    json Report;
+    Report["scene"] = Settings.ScenePath.GetContainerPrivate().c_str();
+    Report["frames"] = FrameTimesMs.Num();
+    Report["warmupFrames"] = Settings.NumWarmupFrames;
+    Report["deltaTime"] = Settings.DeltaTime;
+    Report["nullRenderer"] = Settings.bNullRenderer;
+    Report["pie"] = Settings.bStartPIE;
+
+    json& FrameTime = Report["frameTime"];
+    FrameTime["avgMs"] = Sorted.Num() > 0 ? TotalSeconds * 1000.0 / Sorted.Num() : 0.0;
+    FrameTime["minMs"] = Sorted.Num() > 0 ? Sorted[0] : 0.0;
+    FrameTime["maxMs"] = Sorted.Num() > 0 ? Sorted[Sorted.Num() - 1] : 0.0;
+    FrameTime["p50Ms"] = GetSortedPercentile(Sorted, 50.0);
+    FrameTime["p95Ms"] = GetSortedPercentile(Sorted, 95.0);
+    FrameTime["p99Ms"] = GetSortedPercentile(Sorted, 99.0);
+
+    // 뷰 하나(뷰포트 하나의 한 프레임)당 평균
+    const double NumOcclusionViews = FMath::Max<double>(static_cast<double>(OcclusionStats->NumViews), 1.0);
+    json& Occlusion = Report["occlusion"];
+    Occlusion["enabled"] = Settings.bOcclusionCulling;
+    Occlusion["views"] = OcclusionStats->NumViews;
+    Occlusion["objects"] = OcclusionStats->NumObjects;
+    Occlusion["occluded"] = OcclusionStats->NumOccluded;
+    Occlusion["outsideView"] = OcclusionStats->NumOutsideView;
+    Occlusion["culledRatio"] = OcclusionStats->GetCulledRatio();
+    Occlusion["occluders"] = OcclusionStats->NumOccluders / NumOcclusionViews;
+    Occlusion["occluderTriangles"] = OcclusionStats->NumOccluderTriangles / NumOcclusionViews;
+    Occlusion["rasterizeMs"] = OcclusionStats->RasterizeMs / NumOcclusionViews;
+    Occlusion["testMs"] = OcclusionStats->TestMs / NumOcclusionViews;
+
+    UE_LOG(
+        LogLevel::Display, "[Benchmark] Occlusion: %lld / %lld objects culled (%.1f%%, occluded %lld), raster %.3f ms, test %.3f ms per view",
+        OcclusionStats->GetNumCulled(), OcclusionStats->NumObjects, OcclusionStats->GetCulledRatio() * 100.0f, OcclusionStats->NumOccluded,
+        OcclusionStats->RasterizeMs / NumOcclusionViews, OcclusionStats->TestMs / NumOcclusionViews
+    );
+
+    json& StatsJson = Report["stats"];
+    StatsJson = json::object();
+    for (const FFrameBenchmarkStat& Stat : Stats)
+    {
+        json& Entry = StatsJson[Stat.Name.GetContainerPrivate().c_str()];
+        Entry["count"] = Stat.Count;
+        Entry["avgMs"] = Stat.AvgMs;
+        Entry["p50Ms"] = Stat.P50Ms;
+        Entry["p95Ms"] = Stat.P95Ms;
+        Entry["maxMs"] = Stat.MaxMs;
+    }
+
+    const std::filesystem::path Path(Settings.ReportPath.ToWideString());
+    if (Path.has_parent_path() && !std::filesystem::exists(Path.parent_path()))
+    {
+        std::filesystem::create_directories(Path.parent_path());
+    }
+
+    std::ofstream OutFile(Path);
+    if (!OutFile)
+    {
+        UE_LOG(LogLevel::Error, "[Benchmark] Failed to write report: %s", *Settings.ReportPath);
+        return false;
+    }
+    OutFile << Report.dump(4);
+
+    UE_LOG(LogLevel::Display, "[Benchmark] Report saved: %s", *Settings.ReportPath);
+    return true;
+}
+
+int32 FFrameBenchmark::CompareWithBaseline() const
+{
+    if (Settings.BaselinePath.IsEmpty())
+    {
+        return 0;
+    }
+
+    std::ifstream BaselineFile(std::filesystem::path(Settings.BaselinePath.ToWideString()));
+    if (!BaselineFile)
+    {
+        UE_LOG(LogLevel::Error, "[Benchmark] Failed to open baseline: %s", *Settings.BaselinePath);
+        return INDEX_NONE;
+    }
+
+    const json Baseline = json::parse(BaselineFile, nullptr, false);
+    if (Baseline.is_discarded() || !Baseline.contains("frameTime"))
+    {
+        UE_LOG(LogLevel::Error, "[Benchmark] Invalid baseline: %s", *Settings.BaselinePath);
+        return INDEX_NONE;
+    }
+
+    int32 NumRegressions = 0;
+
+    const double CurrentAvg = FrameTimesMs.Num() > 0 ? TotalSeconds * 1000.0 / FrameTimesMs.Num() : 0.0;
+    if (CheckRegression("FrameTime", Baseline["frameTime"].value("avgMs", 0.0), CurrentAvg, Settings.RegressionThreshold))
+    {
+        ++NumRegressions;
+    }
+
+    if (Baseline.contains("stats"))
+    {
+        const json& BaselineStats = Baseline["stats"];
+        for (const FFrameBenchmarkStat& Stat : Stats)
+        {
+            const std::string Name = Stat.Name.GetContainerPrivate().c_str();
+            if (BaselineStats.contains(Name)
+                && CheckRegression(Name, BaselineStats[Name].value("avgMs", 0.0), Stat.AvgMs, Settings.RegressionThreshold))
+            {
+                ++NumRegressions;
+            }
+        }
+    }
+
+    return NumRegressions;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <memory>
+
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FOcclusionCullStats;
+
+/** 커맨드 라인을 "-Key=Value" 또는 "-Key" 토큰으로 나눕니다. 값에 공백이 있으면 따옴표로 감쌀 수 있습니다. */
+void TokenizeCommandLine(const std::string& CommandLine, TArray<std::string>& OutTokens);
+
+/**
+ * 저장된 Scene을 고정 DeltaTime으로 N 프레임 돌려 프레임 시간과 Stat별 CPU 시간을 JSON으로 기록하는 벤치마크 설정.
+ *
+ * 커맨드 라인 예:
+ *   EngineSIU.exe -benchmark=Saved/Sponza.scene -frames=600 -dt=0.016667 -report=Saved/Benchmark/Sponza.json
+ *                 -baseline=Saved/Benchmark/Sponza_Base.json -threshold=0.1 -nullrhi -pie
+ *   EngineSIU.exe -benchmark=Saved/Sponza.scene -nullrhi -occlusion=0     (오클루전 컬링을 끈 비교용)
+ */
+struct FFrameBenchmarkSettings
+{
+    FString ScenePath;
+    uint32 NumFrames = 300;
+    uint32 NumWarmupFrames = 30;
+    float DeltaTime = 1.0f / 60.0f;
+
+    FString ReportPath = TEXT("Saved/Benchmark/Report.json");
+    FString BaselinePath;                   // 비어 있으면 비교하지 않음
+    float RegressionThreshold = 0.1f;       // Baseline 대비 평균이 이 비율 이상 늘면 Regression
+
+    bool bNullRenderer = false;             // Viewport 렌더링 / Present 생략 (Tick 비용만 측정)
+    bool bStartPIE = false;                 // Editor World 대신 PIE World를 Tick
+    bool bOcclusionCulling = true;          // FSoftwareOcclusionCulling. -nullrhi에서도 활성 뷰포트로 컬링만 실행
+
+    /**
+     * 커맨드 라인에서 벤치마크 옵션을 읽습니다.
+     * @return -benchmark=<scene> 이 있으면 true
+     */
+    static bool ParseCommandLine(const FString& CommandLine, FFrameBenchmarkSettings& OutSettings);
+};
+
+struct FFrameBenchmarkStat
+{
+    FString Name;
+    uint32 Count = 0;
+    double AvgMs = 0.0;     // 프레임당 평균
+    double P50Ms = 0.0;     // 호출 1회 기준
+    double P95Ms = 0.0;
+    double MaxMs = 0.0;
+};
+
+/** 벤치마크 측정값 수집과 리포트 / Baseline 비교를 담당합니다. 엔진 루프는 FEngineLoop::RunBenchmark가 돌립니다. */
+class FFrameBenchmark
+{
+public:
+    explicit FFrameBenchmark(const FFrameBenchmarkSettings& InSettings);
+    ~FFrameBenchmark();
+
+    /** 측정 구간 시작. 프로파일러의 프레임 링을 측정 프레임 수에 맞춥니다. */
+    void Begin();
+
+    void AddFrameTime(double FrameMs);
+
+    /** 측정 구간 종료. 프로파일러에서 Stat 통계를 가져옵니다. */
+    void End();
+
+    bool WriteReport() const;
+
+    /**
+     * Baseline 리포트와 평균 프레임 시간 / Stat별 평균을 비교해 로그로 출력합니다.
+     * @return Threshold를 넘은 항목 수. Baseline을 읽지 못하면 INDEX_NONE
+     */
+    int32 CompareWithBaseline() const;
+
+    const FFrameBenchmarkSettings& GetSettings() const { return Settings; }
+
+private:
+    FFrameBenchmarkSettings Settings;
+
+    TArray<double> FrameTimesMs;
+    TArray<FFrameBenchmarkStat> Stats;
+    double TotalSeconds = 0.0;
+
+    // 측정 구간의 FSoftwareOcclusionCulling::TotalStats. 렌더러 헤더를 포함하지 않도록 선언만 사용
+    std::unique_ptr<FOcclusionCullStats> OcclusionStats;
+};
@@ -1,5 +1,8 @@
 #include "Core/HAL/PlatformType.h"
 #include "EngineLoop.h"
+#include "EngineTests.h"
+#include "FrameBenchmark.h"
+#include "MeshOptimizationTool.h"
 
 FEngineLoop GEngineLoop;
 
@@ -8,9 +11,31 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 {
     // 사용 안하는 파라미터들
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
+    // -test 가 있으면 엔진 초기화 없이 자체 테스트만 돌리고 결과 코드로 종료
+    if (FEngineTests::ParseCommandLine(FString(lpCmdLine)))
+    {
+        return FEngineTests::RunHeadless();
+    }
+
+    // -meshopt[=<dir>] 이 있으면 엔진 초기화 없이 메시 단순화 테스트와 최적화 리포트만 돌리고 종료
+    FMeshOptimizationToolSettings MeshOptimizationSettings;
+    if (FMeshOptimizationToolSettings::ParseCommandLine(FString(lpCmdLine), MeshOptimizationSettings))
+    {
+        return FMeshOptimizationTool::Run(MeshOptimizationSettings);
+    }
+
+    // -benchmark=<scene> 이 있으면 에디터 루프 대신 벤치마크를 돌리고 결과 코드로 종료
+    FFrameBenchmarkSettings BenchmarkSettings;
+    if (FFrameBenchmarkSettings::ParseCommandLine(FString(lpCmdLine), BenchmarkSettings))
+    {
+        GEngineLoop.Init(hInstance);
+        const int32 ExitCode = GEngineLoop.RunBenchmark(BenchmarkSettings);
+        GEngineLoop.Exit();
+        return ExitCode;
+    }
+
     GEngineLoop.Init(hInstance);
     GEngineLoop.Tick();
     GEngineLoop.Exit();
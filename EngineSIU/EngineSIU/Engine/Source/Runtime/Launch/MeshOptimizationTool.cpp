@@ -0,0 +1,239 @@
+#include "MeshOptimizationTool.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "Define.h"
+#include "FrameBenchmark.h"
+#include "Engine/ObjLoader.h"
+#include "JSON/json.hpp"
+#include "Math/MathUtility.h"
+#include "Rendering/Mesh/MeshClusterTest.h"
+#include "Rendering/Mesh/MeshSimplifierTest.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+using json = nlohmann::json;
+
+bool FMeshOptimizationToolSettings::ParseCommandLine(const FString& CommandLine, FMeshOptimizationToolSettings& OutSettings)
+{
+    TArray<std::string> Tokens;
+    TokenizeCommandLine(CommandLine.GetContainerPrivate().c_str(), Tokens);
+
+    bool bMeshOptimization = false;
+    for (const std::string& Token : Tokens)
+    {
+        const size_t EqualPos = Token.find('=');
+        const std::string Key = Token.substr(0, EqualPos);
+        const std::string Value = EqualPos != std::string::npos ? Token.substr(EqualPos + 1) : std::string();
+
+        if (Key == "-meshopt")
+        {
+            if (!Value.empty())
+            {
+                OutSettings.Directory = Value;
+            }
+            bMeshOptimization = true;
+        }
+        else if (Key == "-cachesize")
+        {
+            OutSettings.CacheSize = FMath::Max(std::atoi(Value.c_str()), 3);
+        }
+        else if (Key == "-report" && !Value.empty())
+        {
+            OutSettings.ReportPath = Value;
+        }
+    }
+
+    return bMeshOptimization;
+}
+
+int32 FMeshOptimizationTool::Run(const FMeshOptimizationToolSettings& Settings)
+{
+    const bool bSimplifierPassed = RunSimplifierTest();
+
+    TArray<FMeshOptimizationResult> Results;
+    int32 NumFailed = 0;
+    OptimizeDirectory(Settings.Directory, Settings.CacheSize, Results, NumFailed);
+
+    if (!WriteReport(Settings.ReportPath, Results))
+    {
+        return 1;
+    }
+    return NumFailed > 0 || !bSimplifierPassed ? 1 : 0;
+}
+
+bool FMeshOptimizationTool::RunSimplifierTest()
+{
+    TArray<FMeshSimplifierTestResult> Results;
+    TArray<FString> Failures;
+    const bool bPassed = FMeshSimplifierTest::Run(Results, Failures);
+
+    for (const FMeshSimplifierTestResult& Result : Results)
+    {
+        UE_LOG(
+            LogLevel::Display, "[MeshOpt] Simplifier %s: %d -> %d tris, error target %g reported %.5f measured %.5f",
+            *Result.Name, Result.NumTrianglesBefore, Result.NumTrianglesAfter, Result.TargetError, Result.ReportedError, Result.MeasuredError
+        );
+    }
+    for (const FString& Failure : Failures)
+    {
+        UE_LOG(LogLevel::Error, "[MeshOpt] Simplifier: %s", *Failure);
+    }
+    return bPassed;
+}
+
+void FMeshOptimizationTool::OptimizeDirectory(const FString& Directory, int32 CacheSize, TArray<FMeshOptimizationResult>& OutResults, int32& OutNumFailed)
+{
+    OutNumFailed = 0;
+
+    const std::filesystem::path Root(Directory.ToWideString());
+    std::error_code ErrorCode;
+    if (!std::filesystem::is_directory(Root, ErrorCode))
+    {
+        UE_LOG(LogLevel::Error, "[MeshOpt] Directory not found: %s", *Directory);
+        ++OutNumFailed;
+        return;
+    }
+
+    TArray<std::filesystem::path> ObjPaths;
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(Root, ErrorCode))
+    {
+        if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+        {
+            ObjPaths.Add(Entry.path());
+        }
+    }
+    ObjPaths.Sort();
+
+    for (const std::filesystem::path& ObjPath : ObjPaths)
+    {
+        FMeshOptimizationResult Result;
+        if (OptimizeFile(FString(ObjPath.generic_wstring()), CacheSize, Result))
+        {
+            LogResult(Result);
+            OutResults.Add(Result);
+            if (!Result.bClustersValid)
+            {
+                ++OutNumFailed;
+            }
+        }
+        else
+        {
+            UE_LOG(LogLevel::Error, "[MeshOpt] Failed to load: %s", *FString(ObjPath.generic_wstring()));
+            ++OutNumFailed;
+        }
+    }
+}
+
+bool FMeshOptimizationTool::OptimizeFile(const FString& ObjPath, int32 CacheSize, FMeshOptimizationResult& OutResult)
+{
+    FObjInfo ObjInfo;
+    if (!FObjLoader::ParseOBJ(ObjPath, ObjInfo))
+    {
+        return false;
+    }
+
+    // ParseMaterial은 텍스처를 GPU에 올리므로 서브셋만 직접 옮김
+    FStaticMeshRenderData RenderData;
+    RenderData.MaterialSubsets = ObjInfo.MaterialSubsets;
+    if (!FObjLoader::ConvertToStaticMesh(ObjInfo, RenderData, false))
+    {
+        return false;
+    }
+
+    OutResult.Path = ObjPath;
+    OutResult.NumVertices = RenderData.Vertices.Num();
+    OutResult.NumSubsets = RenderData.MaterialSubsets.Num();
+    OutResult.Before = FMeshOptimizer::AnalyzeVertexCache(RenderData.Indices.GetData(), RenderData.Indices.Num(), RenderData.Vertices.Num(), CacheSize);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FMeshOptimizer::OptimizeMesh(RenderData.Vertices, RenderData.Indices, RenderData.MaterialSubsets);
+    OutResult.OptimizeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    OutResult.After = FMeshOptimizer::AnalyzeVertexCache(RenderData.Indices.GetData(), RenderData.Indices.Num(), RenderData.Vertices.Num(), CacheSize);
+
+    // 임포트와 같은 순서로 클러스터를 나누고 검증 / 컬링 비율 측정
+    const TArray<UINT> OptimizedIndices = RenderData.Indices;
+    const FMeshClusterSettings ClusterSettings;
+    FMeshCluster::BuildClusters(RenderData, ClusterSettings);
+    OutResult.NumClusters = RenderData.Clusters.Num();
+
+    TArray<FString> Failures;
+    OutResult.bClustersValid = FMeshClusterTest::Validate(RenderData, OptimizedIndices, ClusterSettings, Failures);
+    OutResult.bClustersValid &= FMeshClusterTest::MeasureCulling(RenderData, OutResult.ClusterCullStats, Failures);
+    for (const FString& Failure : Failures)
+    {
+        UE_LOG(LogLevel::Error, "[MeshOpt] %s: %s", *ObjPath, *Failure);
+    }
+    return true;
+}
+
+bool FMeshOptimizationTool::WriteReport(const FString& ReportPath, const TArray<FMeshOptimizationResult>& Results)
+{
+    json Report;
+    json& Meshes = Report["meshes"];
+    Meshes = json::array();
+
+    int64 TotalTriangles = 0;
+    int64 TotalMissesBefore = 0;
+    int64 TotalMissesAfter = 0;
+    FClusterCullStats TotalClusterStats;
+    for (const FMeshOptimizationResult& Result : Results)
+    {
+        json Entry;
+        Entry["path"] = Result.Path.GetContainerPrivate().c_str();
+        Entry["vertices"] = Result.NumVertices;
+        Entry["triangles"] = Result.Before.NumTriangles;
+        Entry["subsets"] = Result.NumSubsets;
+        Entry["acmrBefore"] = Result.Before.ACMR;
+        Entry["acmrAfter"] = Result.After.ACMR;
+        Entry["atvrBefore"] = Result.Before.ATVR;
+        Entry["atvrAfter"] = Result.After.ATVR;
+        Entry["optimizeMs"] = Result.OptimizeMs;
+        Entry["clusters"] = Result.NumClusters;
+        Entry["clusterAverageTriangles"] = Result.NumClusters > 0 ? static_cast<double>(Result.Before.NumTriangles) / Result.NumClusters : 0.0;
+        Entry["clusterCulledRatio"] = Result.ClusterCullStats.GetCulledTriangleRatio();
+        Entry["clusterFrustumCulled"] = Result.ClusterCullStats.NumFrustumCulledTriangles;
+        Entry["clusterBackfaceCulled"] = Result.ClusterCullStats.NumBackfaceCulledTriangles;
+        Entry["clustersValid"] = Result.bClustersValid;
+        Meshes.push_back(Entry);
+
+        TotalTriangles += Result.Before.NumTriangles;
+        TotalMissesBefore += Result.Before.NumCacheMisses;
+        TotalMissesAfter += Result.After.NumCacheMisses;
+        TotalClusterStats.Accumulate(Result.ClusterCullStats);
+    }
+
+    // 삼각형 수로 가중한 전체 ACMR
+    json& Total = Report["total"];
+    Total["meshes"] = Results.Num();
+    Total["triangles"] = TotalTriangles;
+    Total["acmrBefore"] = TotalTriangles > 0 ? static_cast<double>(TotalMissesBefore) / TotalTriangles : 0.0;
+    Total["acmrAfter"] = TotalTriangles > 0 ? static_cast<double>(TotalMissesAfter) / TotalTriangles : 0.0;
+    Total["clusterCulledRatio"] = TotalClusterStats.GetCulledTriangleRatio();
+
+    const std::filesystem::path Path(ReportPath.ToWideString());
+    if (Path.has_parent_path() && !std::filesystem::exists(Path.parent_path()))
+    {
+        std::filesystem::create_directories(Path.parent_path());
+    }
+
+    std::ofstream OutFile(Path);
+    if (!OutFile)
+    {
+        UE_LOG(LogLevel::Error, "[MeshOpt] Failed to write report: %s", *ReportPath);
+        return false;
+    }
+    OutFile << Report.dump(4);
+    return true;
+}
+
+void FMeshOptimizationTool::LogResult(const FMeshOptimizationResult& Result)
+{
+    UE_LOG(
+        LogLevel::Display, "[MeshOpt] %s: %d tris, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (%.2f ms), %d clusters, %.1f%% culled%s",
+        *Result.Path, Result.Before.NumTriangles, Result.Before.ACMR, Result.After.ACMR, Result.Before.ATVR, Result.After.ATVR, Result.OptimizeMs,
+        Result.NumClusters, Result.ClusterCullStats.GetCulledTriangleRatio() * 100.0f, Result.bClustersValid ? "" : " (INVALID)"
+    );
+}
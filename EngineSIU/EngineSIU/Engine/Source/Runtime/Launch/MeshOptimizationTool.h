@@ -0,0 +1,63 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Rendering/Mesh/MeshCluster.h"
+#include "Rendering/Mesh/MeshOptimizer.h"
+
+/**
+ * 디렉터리 아래의 .obj를 모두 읽어 FMeshOptimizer 적용 전후의 정점 캐시 효율과 FMeshCluster의 컬링 비율을 측정하는 설정.
+ * GPU 없이 돌기 때문에 엔진을 초기화하지 않습니다.
+ *
+ * 커맨드 라인 예:
+ *   EngineSIU.exe -meshopt=Contents -cachesize=16 -report=Saved/MeshOptimization/Report.json
+ */
+struct FMeshOptimizationToolSettings
+{
+    FString Directory = TEXT("Contents");
+    FString ReportPath = TEXT("Saved/MeshOptimization/Report.json");
+    int32 CacheSize = FMeshOptimizer::DefaultCacheSize;
+
+    /**
+     * 커맨드 라인에서 옵션을 읽습니다.
+     * @return -meshopt 가 있으면 true
+     */
+    static bool ParseCommandLine(const FString& CommandLine, FMeshOptimizationToolSettings& OutSettings);
+};
+
+struct FMeshOptimizationResult
+{
+    FString Path;
+    int32 NumVertices = 0;
+    int32 NumSubsets = 0;
+
+    FVertexCacheStats Before;
+    FVertexCacheStats After;
+    double OptimizeMs = 0.0;
+
+    // FMeshClusterTest::MeasureCulling의 뷰를 모두 더한 값
+    int32 NumClusters = 0;
+    FClusterCullStats ClusterCullStats;
+    bool bClustersValid = true;
+};
+
+struct FMeshOptimizationTool
+{
+    /**
+     * 리포트를 쓰기 전에 FMeshSimplifierTest도 돌립니다. D3D 초기화 전이라 CI에서 그대로 쓸 수 있습니다.
+     * @return 프로세스 종료 코드. 읽지 못했거나 클러스터 검증에 실패한 메시가 있거나 단순화 테스트가 실패하면 1
+     */
+    static int32 Run(const FMeshOptimizationToolSettings& Settings);
+
+    /** FMeshSimplifierTest를 돌리고 결과를 로그로 남깁니다. */
+    static bool RunSimplifierTest();
+
+    /** Directory 아래의 .obj를 모두 측정합니다. 콘솔 명령에서도 씁니다. */
+    static void OptimizeDirectory(const FString& Directory, int32 CacheSize, TArray<FMeshOptimizationResult>& OutResults, int32& OutNumFailed);
+
+    static bool OptimizeFile(const FString& ObjPath, int32 CacheSize, FMeshOptimizationResult& OutResult);
+
+    static bool WriteReport(const FString& ReportPath, const TArray<FMeshOptimizationResult>& Results);
+
+    static void LogResult(const FMeshOptimizationResult& Result);
+};
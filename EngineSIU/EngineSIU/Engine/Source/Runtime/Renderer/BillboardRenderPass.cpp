@@ -3,6 +3,7 @@
 #include "D3D11RHI/DXDBufferManager.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "D3D11RHI/DXDShaderManager.h"
+#include "Math/MathBatch.h"
 
 #include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
@@ -39,6 +40,7 @@ void FBillboardRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraph
     BufferManager = InBufferManager;
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
+    TextBatch.Initialize(Graphics->Device, Graphics->DeviceContext);
     CreateShader();
 }
 
@@ -81,7 +83,9 @@ void FBillboardRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, cons
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
@@ -98,13 +102,13 @@ void FBillboardRenderPass::RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, U
     Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
 }
 
-void FBillboardRenderPass::RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
+void FBillboardRenderPass::RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT StartVertex, UINT numVertices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
 {
     SetupVertexBuffer(pVertexBuffer, numVertices);
 
     Graphics->DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
     Graphics->DeviceContext->PSSetSamplers(0, 1, &SamplerState);
-    Graphics->DeviceContext->Draw(numVertices, 0);
+    Graphics->DeviceContext->Draw(numVertices, StartVertex);
 }
 
 void FBillboardRenderPass::CreateShader()
@@ -163,6 +167,22 @@ void FBillboardRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewpo
 
     BufferManager->GetQuadBuffer(VertexInfo, IndexInfo);
 
+    // 텍스트는 먼저 전부 한 버퍼에 올려 두고, 아래에서 그리는 순서대로 범위만 사용
+    TextBatch.Reset();
+    TextDraws.Empty();
+    for (UBillboardComponent* BillboardComp : BillboardComps)
+    {
+        if (UTextComponent* TextComp = Cast<UTextComponent>(BillboardComp))
+        {
+            if (TextComp->GetText().length() > 0)
+            {
+                TextDraws.Add(TextBatch.AddText(TextComp->GetText(), TextComp->GetColumnCount(), TextComp->GetRowCount()));
+            }
+        }
+    }
+    const bool bTextUploaded = TextBatch.Upload();
+    int32 TextDrawIndex = 0;
+
     // 각 Billboard에 대해 렌더링 처리
     for (auto BillboardComp : BillboardComps)
     {
@@ -192,16 +212,18 @@ void FBillboardRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewpo
             {
                 continue;
             }
-            FBufferInfo Buffers;
-            float Height = TextComp->Texture->Height;
-            float Width = TextComp->Texture->Width;
-            BufferManager->CreateUnicodeTextBuffer(TextComp->GetText(), Buffers, Width, Height, TextComp->GetColumnCount(), TextComp->GetRowCount());
+            const FTextDraw& TextDraw = TextDraws[TextDrawIndex++];
+            if (!bTextUploaded)
+            {
+                continue;
+            }
 
             UpdateSubUVConstant(FVector2D(), FVector2D(1, 1));
 
             RenderTextPrimitive(
-                Buffers.VertexInfo.VertexBuffer,
-                Buffers.VertexInfo.NumVertices,
+                TextBatch.GetVertexBuffer(),
+                TextDraw.StartVertex,
+                TextDraw.NumVertices,
                 TextComp->Texture->TextureSRV,
                 TextComp->Texture->SamplerState
             );
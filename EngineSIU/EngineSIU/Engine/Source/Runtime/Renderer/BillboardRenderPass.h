@@ -4,6 +4,7 @@
 #include "Container/Set.h"
 
 #include "Define.h"
+#include "TextRenderBatch.h"
 
 enum class EResourceType : uint8;
 class UBillboardComponent;
@@ -41,13 +42,15 @@ public:
         ID3D11Buffer* pIndexBuffer, UINT numIndices,
         ID3D11ShaderResourceView* _TextureSRV, ID3D11SamplerState* _SamplerState) const;
 
-    void RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices,
+    void RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT StartVertex, UINT numVertices,
         ID3D11ShaderResourceView* _TextureSRV, ID3D11SamplerState* _SamplerState) const;
 
     void CreateShader();
     void UpdateShader();
     void ReleaseShader();
 
+    const FTextRenderBatchStats& GetTextBatchStats() const { return TextBatch.GetStats(); }
+
 protected:
     TArray<UBillboardComponent*> BillboardComps;
 
@@ -66,4 +69,7 @@ private:
     
     FDXDShaderManager* ShaderManager;
 
+    // 텍스트 컴포넌트의 글자 쿼드는 뷰포트마다 한 버퍼에 모아서 올림
+    FTextRenderBatch TextBatch;
+    TArray<FTextDraw> TextDraws;
 };
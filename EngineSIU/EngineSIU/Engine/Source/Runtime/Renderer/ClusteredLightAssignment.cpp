@@ -0,0 +1,563 @@
+#include "ClusteredLightAssignment.h"
+
+#include <bit>
+#include <cfloat>
+#include <cstring>
+#include <immintrin.h>
+
+#include "Async/ParallelFor.h"
+#include "Math/JungleMath.h"
+#include "Math/MathUtility.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    constexpr uint32 SIMD_WIDTH = 4;
+
+    // 패딩용 더미 라이트 위치. 제곱해도 float 범위를 넘지 않으면서 어떤 클러스터와도 겹치지 않음
+    constexpr float PaddingPosition = 3.0e18f;
+
+    // 지수 분포 깊이 슬라이스 경계: Near * (Far / Near)^(Slice / Count)
+    float GetSliceDepth(const FClusterGridSettings& Settings, uint32 Slice)
+    {
+        const float Ratio = Settings.FarZ / Settings.NearZ;
+        return Settings.NearZ * FMath::Pow(Ratio, static_cast<float>(Slice) / static_cast<float>(Settings.ClusterCountZ));
+    }
+
+    // NDC (Nx, Ny)가 View 공간 깊이 Z에서 가지는 View 공간 위치. Perspective / Orthographic 모두 처리
+    FVector UnprojectAtDepth(const FMatrix& Projection, float Nx, float Ny, float Z)
+    {
+        const float W = Z * Projection.M[2][3] + Projection.M[3][3];
+        const float X = (Nx * W - Z * Projection.M[2][0] - Projection.M[3][0]) / Projection.M[0][0];
+        const float Y = (Ny * W - Z * Projection.M[2][1] - Projection.M[3][1]) / Projection.M[1][1];
+        return { X, Y, Z };
+    }
+
+    bool SphereIntersectsAABB(const FVector& Center, float Radius, const FVector& Min, const FVector& Max)
+    {
+        const float Dx = FMath::Max(FMath::Max(Min.X - Center.X, 0.0f), Center.X - Max.X);
+        const float Dy = FMath::Max(FMath::Max(Min.Y - Center.Y, 0.0f), Center.Y - Max.Y);
+        const float Dz = FMath::Max(FMath::Max(Min.Z - Center.Z, 0.0f), Center.Z - Max.Z);
+        return Dx * Dx + Dy * Dy + Dz * Dz <= Radius * Radius;
+    }
+
+    // SoA 배열을 SIMD 폭의 배수가 되도록 더미 라이트로 채움
+    void PadToSimdWidth(TArray<float>& X, TArray<float>& Y, TArray<float>& Z, TArray<uint32>& Ids)
+    {
+        while (Ids.Num() % SIMD_WIDTH != 0)
+        {
+            X.Add(PaddingPosition);
+            Y.Add(PaddingPosition);
+            Z.Add(PaddingPosition);
+            Ids.Add(0);
+        }
+    }
+
+    // 4개 라이트 Sphere vs 1개 클러스터 AABB. 통과한 레인의 비트 마스크 반환
+    FORCEINLINE int32 SphereAABBMask4(
+        __m128 Px, __m128 Py, __m128 Pz, __m128 RadiusSq,
+        __m128 MinX, __m128 MinY, __m128 MinZ, __m128 MaxX, __m128 MaxY, __m128 MaxZ
+    )
+    {
+        const __m128 Zero = _mm_setzero_ps();
+        const __m128 Dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinX, Px), Zero), _mm_sub_ps(Px, MaxX));
+        const __m128 Dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinY, Py), Zero), _mm_sub_ps(Py, MaxY));
+        const __m128 Dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinZ, Pz), Zero), _mm_sub_ps(Pz, MaxZ));
+        const __m128 DistSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Dx, Dx), _mm_mul_ps(Dy, Dy)), _mm_mul_ps(Dz, Dz));
+        return _mm_movemask_ps(_mm_cmple_ps(DistSq, RadiusSq));
+    }
+}
+
+bool FClusterGridSettings::operator==(const FClusterGridSettings& Other) const
+{
+    return ScreenWidth == Other.ScreenWidth
+        && ScreenHeight == Other.ScreenHeight
+        && TileSize == Other.TileSize
+        && ClusterCountZ == Other.ClusterCountZ
+        && NearZ == Other.NearZ
+        && FarZ == Other.FarZ
+        && std::memcmp(&ProjectionMatrix, &Other.ProjectionMatrix, sizeof(FMatrix)) == 0;
+}
+
+void FClusteredLightAssignment::SetGrid(const FClusterGridSettings& InSettings)
+{
+    if (bGridValid && Settings == InSettings)
+    {
+        return;
+    }
+
+    Settings = InSettings;
+    Settings.TileSize = FMath::Max<uint32>(Settings.TileSize, 1);
+    Settings.ClusterCountZ = FMath::Max<uint32>(Settings.ClusterCountZ, 1);
+    Settings.NearZ = FMath::Max(Settings.NearZ, KINDA_SMALL_NUMBER);
+    Settings.FarZ = FMath::Max(Settings.FarZ, Settings.NearZ + KINDA_SMALL_NUMBER);
+
+    ClusterCountX = (FMath::Max<uint32>(Settings.ScreenWidth, 1) + Settings.TileSize - 1) / Settings.TileSize;
+    ClusterCountY = (FMath::Max<uint32>(Settings.ScreenHeight, 1) + Settings.TileSize - 1) / Settings.TileSize;
+
+    BuildClusterBounds();
+    bGridValid = true;
+}
+
+void FClusteredLightAssignment::BuildClusterBounds()
+{
+    const uint32 NumClusters = GetNumClusters();
+    const uint32 NumSlices = Settings.ClusterCountZ;
+
+    for (TArray<float>* Array : { &ClusterMinX, &ClusterMinY, &ClusterMinZ, &ClusterMaxX, &ClusterMaxY, &ClusterMaxZ,
+                                  &ClusterCenterX, &ClusterCenterY, &ClusterCenterZ, &ClusterSphereRadius })
+    {
+        Array->SetNum(NumClusters);
+    }
+    for (TArray<float>* Array : { &SliceMinX, &SliceMinY, &SliceMinZ, &SliceMaxX, &SliceMaxY, &SliceMaxZ })
+    {
+        Array->SetNum(NumSlices);
+    }
+
+    SliceScratches.SetNum(NumSlices);
+
+    const float Width = static_cast<float>(FMath::Max<uint32>(Settings.ScreenWidth, 1));
+    const float Height = static_cast<float>(FMath::Max<uint32>(Settings.ScreenHeight, 1));
+
+    for (uint32 Z = 0; Z < NumSlices; ++Z)
+    {
+        const float NearDepth = GetSliceDepth(Settings, Z);
+        const float FarDepth = GetSliceDepth(Settings, Z + 1);
+
+        FVector SliceMin(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector SliceMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+        for (uint32 Y = 0; Y < ClusterCountY; ++Y)
+        {
+            // 픽셀 좌표는 위에서 아래로, NDC Y는 아래에서 위로 증가
+            const float PixelTop = static_cast<float>(Y * Settings.TileSize);
+            const float PixelBottom = FMath::Min(static_cast<float>((Y + 1) * Settings.TileSize), Height);
+            const float NdcTop = 1.0f - PixelTop / Height * 2.0f;
+            const float NdcBottom = 1.0f - PixelBottom / Height * 2.0f;
+
+            for (uint32 X = 0; X < ClusterCountX; ++X)
+            {
+                const float PixelLeft = static_cast<float>(X * Settings.TileSize);
+                const float PixelRight = FMath::Min(static_cast<float>((X + 1) * Settings.TileSize), Width);
+                const float NdcLeft = PixelLeft / Width * 2.0f - 1.0f;
+                const float NdcRight = PixelRight / Width * 2.0f - 1.0f;
+
+                FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+                FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (const float Depth : { NearDepth, FarDepth })
+                {
+                    for (const float Nx : { NdcLeft, NdcRight })
+                    {
+                        for (const float Ny : { NdcTop, NdcBottom })
+                        {
+                            const FVector Corner = UnprojectAtDepth(Settings.ProjectionMatrix, Nx, Ny, Depth);
+                            Min = FVector(FMath::Min(Min.X, Corner.X), FMath::Min(Min.Y, Corner.Y), FMath::Min(Min.Z, Corner.Z));
+                            Max = FVector(FMath::Max(Max.X, Corner.X), FMath::Max(Max.Y, Corner.Y), FMath::Max(Max.Z, Corner.Z));
+                        }
+                    }
+                }
+
+                const uint32 ClusterIndex = GetClusterIndex(X, Y, Z);
+                ClusterMinX[ClusterIndex] = Min.X;
+                ClusterMinY[ClusterIndex] = Min.Y;
+                ClusterMinZ[ClusterIndex] = Min.Z;
+                ClusterMaxX[ClusterIndex] = Max.X;
+                ClusterMaxY[ClusterIndex] = Max.Y;
+                ClusterMaxZ[ClusterIndex] = Max.Z;
+
+                const FVector Center = (Min + Max) * 0.5f;
+                ClusterCenterX[ClusterIndex] = Center.X;
+                ClusterCenterY[ClusterIndex] = Center.Y;
+                ClusterCenterZ[ClusterIndex] = Center.Z;
+                ClusterSphereRadius[ClusterIndex] = (Max - Min).Length() * 0.5f;
+
+                SliceMin = FVector(FMath::Min(SliceMin.X, Min.X), FMath::Min(SliceMin.Y, Min.Y), FMath::Min(SliceMin.Z, Min.Z));
+                SliceMax = FVector(FMath::Max(SliceMax.X, Max.X), FMath::Max(SliceMax.Y, Max.Y), FMath::Max(SliceMax.Z, Max.Z));
+            }
+        }
+
+        SliceMinX[Z] = SliceMin.X;
+        SliceMinY[Z] = SliceMin.Y;
+        SliceMinZ[Z] = SliceMin.Z;
+        SliceMaxX[Z] = SliceMax.X;
+        SliceMaxY[Z] = SliceMax.Y;
+        SliceMaxZ[Z] = SliceMax.Z;
+    }
+}
+
+void FClusteredLightAssignment::Assign(
+    const FMatrix& ViewMatrix, const TArray<FClusterPointLight>& InPointLights, const TArray<FClusterSpotLight>& InSpotLights
+)
+{
+    if (!bGridValid)
+    {
+        return;
+    }
+
+    ViewPointLights.SetNum(InPointLights.Num());
+    for (int32 Index = 0; Index < InPointLights.Num(); ++Index)
+    {
+        ViewPointLights[Index].Position = ViewMatrix.TransformPosition(InPointLights[Index].Position);
+        ViewPointLights[Index].Radius = InPointLights[Index].Radius;
+    }
+
+    ViewSpotLights.SetNum(InSpotLights.Num());
+    for (int32 Index = 0; Index < InSpotLights.Num(); ++Index)
+    {
+        const FClusterSpotLight& Light = InSpotLights[Index];
+        ViewSpotLights[Index].Position = ViewMatrix.TransformPosition(Light.Position);
+        ViewSpotLights[Index].Radius = Light.Radius;
+        ViewSpotLights[Index].Direction = FMatrix::TransformVector(Light.Direction, ViewMatrix).GetSafeNormal();
+        ViewSpotLights[Index].OuterAngle = FMath::Clamp(Light.OuterAngle, 0.0f, PI);
+    }
+
+    const uint32 NumClusters = GetNumClusters();
+    PointLightOffsets.SetNum(NumClusters + 1);
+    SpotLightOffsets.SetNum(NumClusters + 1);
+
+    // 슬라이스끼리는 서로 다른 클러스터 범위와 작업 공간만 건드리므로 병렬로 처리 가능
+    ParallelFor(static_cast<int32>(Settings.ClusterCountZ), [this](int32 SliceIndex)
+    {
+        AssignSlice(static_cast<uint32>(SliceIndex));
+    });
+
+    CompactSlices();
+}
+
+void FClusteredLightAssignment::GatherSliceLights(uint32 SliceIndex, FSliceScratch& Scratch) const
+{
+    const FVector SliceMin(SliceMinX[SliceIndex], SliceMinY[SliceIndex], SliceMinZ[SliceIndex]);
+    const FVector SliceMax(SliceMaxX[SliceIndex], SliceMaxY[SliceIndex], SliceMaxZ[SliceIndex]);
+
+    Scratch.PointX.Reset();
+    Scratch.PointY.Reset();
+    Scratch.PointZ.Reset();
+    Scratch.PointRadiusSq.Reset();
+    Scratch.PointIds.Reset();
+
+    for (int32 Index = 0; Index < ViewPointLights.Num(); ++Index)
+    {
+        const FClusterPointLight& Light = ViewPointLights[Index];
+        if (!SphereIntersectsAABB(Light.Position, Light.Radius, SliceMin, SliceMax))
+        {
+            continue;
+        }
+        Scratch.PointX.Add(Light.Position.X);
+        Scratch.PointY.Add(Light.Position.Y);
+        Scratch.PointZ.Add(Light.Position.Z);
+        Scratch.PointRadiusSq.Add(Light.Radius * Light.Radius);
+        Scratch.PointIds.Add(static_cast<uint32>(Index));
+    }
+    while (Scratch.PointRadiusSq.Num() % SIMD_WIDTH != 0)
+    {
+        Scratch.PointRadiusSq.Add(0.0f);
+    }
+    PadToSimdWidth(Scratch.PointX, Scratch.PointY, Scratch.PointZ, Scratch.PointIds);
+
+    Scratch.SpotX.Reset();
+    Scratch.SpotY.Reset();
+    Scratch.SpotZ.Reset();
+    Scratch.SpotDirX.Reset();
+    Scratch.SpotDirY.Reset();
+    Scratch.SpotDirZ.Reset();
+    Scratch.SpotRadius.Reset();
+    Scratch.SpotCos.Reset();
+    Scratch.SpotSin.Reset();
+    Scratch.SpotIds.Reset();
+
+    for (int32 Index = 0; Index < ViewSpotLights.Num(); ++Index)
+    {
+        const FClusterSpotLight& Light = ViewSpotLights[Index];
+        if (!SphereIntersectsAABB(Light.Position, Light.Radius, SliceMin, SliceMax))
+        {
+            continue;
+        }
+        Scratch.SpotX.Add(Light.Position.X);
+        Scratch.SpotY.Add(Light.Position.Y);
+        Scratch.SpotZ.Add(Light.Position.Z);
+        Scratch.SpotDirX.Add(Light.Direction.X);
+        Scratch.SpotDirY.Add(Light.Direction.Y);
+        Scratch.SpotDirZ.Add(Light.Direction.Z);
+        Scratch.SpotRadius.Add(Light.Radius);
+        Scratch.SpotCos.Add(FMath::Cos(Light.OuterAngle));
+        Scratch.SpotSin.Add(FMath::Sin(Light.OuterAngle));
+        Scratch.SpotIds.Add(static_cast<uint32>(Index));
+    }
+    while (Scratch.SpotRadius.Num() % SIMD_WIDTH != 0)
+    {
+        Scratch.SpotDirX.Add(0.0f);
+        Scratch.SpotDirY.Add(0.0f);
+        Scratch.SpotDirZ.Add(1.0f);
+        Scratch.SpotRadius.Add(0.0f);
+        Scratch.SpotCos.Add(1.0f);
+        Scratch.SpotSin.Add(0.0f);
+    }
+    PadToSimdWidth(Scratch.SpotX, Scratch.SpotY, Scratch.SpotZ, Scratch.SpotIds);
+}
+
+void FClusteredLightAssignment::AssignSlice(uint32 SliceIndex)
+{
+    FSliceScratch& Scratch = SliceScratches[SliceIndex];
+    GatherSliceLights(SliceIndex, Scratch);
+
+    Scratch.PointIndices.Reset();
+    Scratch.SpotIndices.Reset();
+
+    const uint32 ClustersPerSlice = ClusterCountX * ClusterCountY;
+    const uint32 FirstCluster = SliceIndex * ClustersPerSlice;
+    const uint32 NumPointLanes = Scratch.PointIds.Num();
+    const uint32 NumSpotLanes = Scratch.SpotIds.Num();
+
+    for (uint32 ClusterIndex = FirstCluster; ClusterIndex < FirstCluster + ClustersPerSlice; ++ClusterIndex)
+    {
+        const __m128 MinX = _mm_set1_ps(ClusterMinX[ClusterIndex]);
+        const __m128 MinY = _mm_set1_ps(ClusterMinY[ClusterIndex]);
+        const __m128 MinZ = _mm_set1_ps(ClusterMinZ[ClusterIndex]);
+        const __m128 MaxX = _mm_set1_ps(ClusterMaxX[ClusterIndex]);
+        const __m128 MaxY = _mm_set1_ps(ClusterMaxY[ClusterIndex]);
+        const __m128 MaxZ = _mm_set1_ps(ClusterMaxZ[ClusterIndex]);
+
+        // 슬라이스 내부 오프셋. CompactSlices에서 슬라이스 시작 위치를 더해 전역 오프셋으로 바꿈
+        PointLightOffsets[ClusterIndex] = Scratch.PointIndices.Num();
+
+        for (uint32 Lane = 0; Lane < NumPointLanes; Lane += SIMD_WIDTH)
+        {
+            int32 Mask = SphereAABBMask4(
+                _mm_loadu_ps(&Scratch.PointX[Lane]), _mm_loadu_ps(&Scratch.PointY[Lane]), _mm_loadu_ps(&Scratch.PointZ[Lane]),
+                _mm_loadu_ps(&Scratch.PointRadiusSq[Lane]),
+                MinX, MinY, MinZ, MaxX, MaxY, MaxZ
+            );
+            while (Mask != 0)
+            {
+                Scratch.PointIndices.Add(Scratch.PointIds[Lane + std::countr_zero(static_cast<uint32>(Mask))]);
+                Mask &= Mask - 1;
+            }
+        }
+
+        SpotLightOffsets[ClusterIndex] = Scratch.SpotIndices.Num();
+
+        if (NumSpotLanes == 0)
+        {
+            continue;
+        }
+
+        const __m128 CenterX = _mm_set1_ps(ClusterCenterX[ClusterIndex]);
+        const __m128 CenterY = _mm_set1_ps(ClusterCenterY[ClusterIndex]);
+        const __m128 CenterZ = _mm_set1_ps(ClusterCenterZ[ClusterIndex]);
+        const __m128 SphereRadius = _mm_set1_ps(ClusterSphereRadius[ClusterIndex]);
+        const __m128 NegSphereRadius = _mm_sub_ps(_mm_setzero_ps(), SphereRadius);
+
+        for (uint32 Lane = 0; Lane < NumSpotLanes; Lane += SIMD_WIDTH)
+        {
+            const __m128 Px = _mm_loadu_ps(&Scratch.SpotX[Lane]);
+            const __m128 Py = _mm_loadu_ps(&Scratch.SpotY[Lane]);
+            const __m128 Pz = _mm_loadu_ps(&Scratch.SpotZ[Lane]);
+            const __m128 Range = _mm_loadu_ps(&Scratch.SpotRadius[Lane]);
+
+            // 1) 감쇠 반경 Sphere vs 클러스터 AABB
+            int32 Mask = SphereAABBMask4(Px, Py, Pz, _mm_mul_ps(Range, Range), MinX, MinY, MinZ, MaxX, MaxY, MaxZ);
+            if (Mask == 0)
+            {
+                continue;
+            }
+
+            // 2) Cone vs 클러스터 Bounding Sphere
+            const __m128 Vx = _mm_sub_ps(CenterX, Px);
+            const __m128 Vy = _mm_sub_ps(CenterY, Py);
+            const __m128 Vz = _mm_sub_ps(CenterZ, Pz);
+            const __m128 LenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Vx, Vx), _mm_mul_ps(Vy, Vy)), _mm_mul_ps(Vz, Vz));
+            const __m128 AxisLen = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(Vx, _mm_loadu_ps(&Scratch.SpotDirX[Lane])), _mm_mul_ps(Vy, _mm_loadu_ps(&Scratch.SpotDirY[Lane]))),
+                _mm_mul_ps(Vz, _mm_loadu_ps(&Scratch.SpotDirZ[Lane]))
+            );
+            const __m128 PerpLen = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(LenSq, _mm_mul_ps(AxisLen, AxisLen)), _mm_setzero_ps()));
+            const __m128 ClosestDist = _mm_sub_ps(
+                _mm_mul_ps(_mm_loadu_ps(&Scratch.SpotCos[Lane]), PerpLen),
+                _mm_mul_ps(AxisLen, _mm_loadu_ps(&Scratch.SpotSin[Lane]))
+            );
+
+            const __m128 AngleOk = _mm_cmple_ps(ClosestDist, SphereRadius);
+            const __m128 FrontOk = _mm_cmple_ps(AxisLen, _mm_add_ps(SphereRadius, Range));
+            const __m128 BackOk = _mm_cmpge_ps(AxisLen, NegSphereRadius);
+            Mask &= _mm_movemask_ps(_mm_and_ps(AngleOk, _mm_and_ps(FrontOk, BackOk)));
+
+            while (Mask != 0)
+            {
+                Scratch.SpotIndices.Add(Scratch.SpotIds[Lane + std::countr_zero(static_cast<uint32>(Mask))]);
+                Mask &= Mask - 1;
+            }
+        }
+    }
+}
+
+void FClusteredLightAssignment::CompactSlices()
+{
+    const uint32 ClustersPerSlice = ClusterCountX * ClusterCountY;
+
+    uint32 TotalPoint = 0;
+    uint32 TotalSpot = 0;
+    for (const FSliceScratch& Scratch : SliceScratches)
+    {
+        TotalPoint += Scratch.PointIndices.Num();
+        TotalSpot += Scratch.SpotIndices.Num();
+    }
+
+    PointLightIndices.SetNum(TotalPoint);
+    SpotLightIndices.SetNum(TotalSpot);
+
+    uint32 PointBase = 0;
+    uint32 SpotBase = 0;
+    for (uint32 SliceIndex = 0; SliceIndex < static_cast<uint32>(SliceScratches.Num()); ++SliceIndex)
+    {
+        const FSliceScratch& Scratch = SliceScratches[SliceIndex];
+        const uint32 FirstCluster = SliceIndex * ClustersPerSlice;
+        for (uint32 ClusterIndex = FirstCluster; ClusterIndex < FirstCluster + ClustersPerSlice; ++ClusterIndex)
+        {
+            PointLightOffsets[ClusterIndex] += PointBase;
+            SpotLightOffsets[ClusterIndex] += SpotBase;
+        }
+
+        if (Scratch.PointIndices.Num() > 0)
+        {
+            std::memcpy(PointLightIndices.GetData() + PointBase, Scratch.PointIndices.GetData(), Scratch.PointIndices.Num() * sizeof(uint32));
+        }
+        if (Scratch.SpotIndices.Num() > 0)
+        {
+            std::memcpy(SpotLightIndices.GetData() + SpotBase, Scratch.SpotIndices.GetData(), Scratch.SpotIndices.Num() * sizeof(uint32));
+        }
+        PointBase += Scratch.PointIndices.Num();
+        SpotBase += Scratch.SpotIndices.Num();
+    }
+
+    PointLightOffsets[GetNumClusters()] = PointBase;
+    SpotLightOffsets[GetNumClusters()] = SpotBase;
+}
+
+void FClusteredLightAssignment::BuildTileMasks(
+    TArray<uint32>& OutPointMask, TArray<uint32>& OutSpotMask, uint32 TileStrideX, uint32 NumTiles, uint32 BucketsPerTile
+) const
+{
+    OutPointMask.SetNum(NumTiles * BucketsPerTile);
+    OutSpotMask.SetNum(NumTiles * BucketsPerTile);
+    if (NumTiles == 0 || BucketsPerTile == 0)
+    {
+        return;
+    }
+    std::memset(OutPointMask.GetData(), 0, OutPointMask.Num() * sizeof(uint32));
+    std::memset(OutSpotMask.GetData(), 0, OutSpotMask.Num() * sizeof(uint32));
+
+    if (!bGridValid || PointLightOffsets.Num() != static_cast<int32>(GetNumClusters()) + 1)
+    {
+        return;
+    }
+
+    const uint32 MaxLightIndex = BucketsPerTile * 32;
+
+    auto WriteMask = [MaxLightIndex, BucketsPerTile](uint32* TileMask, const TArray<uint32>& Offsets, const TArray<uint32>& Indices, uint32 ClusterIndex)
+    {
+        for (uint32 Cursor = Offsets[ClusterIndex]; Cursor < Offsets[ClusterIndex + 1]; ++Cursor)
+        {
+            const uint32 LightIndex = Indices[Cursor];
+            if (LightIndex < MaxLightIndex)
+            {
+                TileMask[LightIndex / 32] |= 1u << (LightIndex % 32);
+            }
+        }
+    };
+
+    for (uint32 Z = 0; Z < Settings.ClusterCountZ; ++Z)
+    {
+        for (uint32 Y = 0; Y < ClusterCountY; ++Y)
+        {
+            for (uint32 X = 0; X < FMath::Min(ClusterCountX, TileStrideX); ++X)
+            {
+                const uint32 TileIndex = Y * TileStrideX + X;
+                if (TileIndex >= NumTiles)
+                {
+                    continue;
+                }
+
+                const uint32 ClusterIndex = GetClusterIndex(X, Y, Z);
+                WriteMask(&OutPointMask[TileIndex * BucketsPerTile], PointLightOffsets, PointLightIndices, ClusterIndex);
+                WriteMask(&OutSpotMask[TileIndex * BucketsPerTile], SpotLightOffsets, SpotLightIndices, ClusterIndex);
+            }
+        }
+    }
+}
+
+FClusterBenchmarkResult FClusteredLightAssignment::RunBenchmark(int32 HalfCountPerAxis, uint32 Iterations)
+{
+    // FLightGridGenerator와 같은 간격/기본 반경
+    constexpr float Spacing = 10.0f;
+    constexpr float DefaultRadius = 30.0f;
+    constexpr float DefaultOuterAngle = 0.5236f;
+
+    const int32 R = FMath::Max(HalfCountPerAxis, 0);
+    Iterations = FMath::Max<uint32>(Iterations, 1);
+
+    TArray<FClusterPointLight> PointLights;
+    TArray<FClusterSpotLight> SpotLights;
+
+    int32 LightCount = 0;
+    for (int32 X = -R; X <= R; ++X)
+    {
+        for (int32 Y = -R; Y <= R; ++Y)
+        {
+            for (int32 Z = -R; Z <= R; ++Z)
+            {
+                const FVector Position(X * Spacing, Y * Spacing, Z * Spacing);
+                if ((LightCount % 2) == 0)
+                {
+                    PointLights.Add({ Position, DefaultRadius });
+                }
+                else
+                {
+                    SpotLights.Add({ Position, DefaultRadius, FVector(0.0f, 0.0f, -1.0f), DefaultOuterAngle });
+                }
+                ++LightCount;
+            }
+        }
+    }
+
+    // 격자 바깥에서 격자 중심을 바라보는 카메라
+    const FVector Eye(-(R * Spacing + 20.0f), 0.0f, 0.0f);
+    const FMatrix View = JungleMath::CreateViewMatrix(Eye, FVector::ZeroVector, FVector(0.0f, 0.0f, 1.0f));
+
+    FClusterGridSettings GridSettings;
+    GridSettings.NearZ = 0.1f;
+    GridSettings.FarZ = 1000.0f;
+    GridSettings.ProjectionMatrix = JungleMath::CreateProjectionMatrix(
+        FMath::DegreesToRadians(90.0f), static_cast<float>(GridSettings.ScreenWidth) / static_cast<float>(GridSettings.ScreenHeight),
+        GridSettings.NearZ, GridSettings.FarZ
+    );
+
+    FClusteredLightAssignment Assignment;
+    Assignment.SetGrid(GridSettings);
+
+    // 작업 공간 할당을 측정에서 제외하기 위한 워밍업
+    Assignment.Assign(View, PointLights, SpotLights);
+
+    FClusterBenchmarkResult Result;
+    Result.NumPointLights = PointLights.Num();
+    Result.NumSpotLights = SpotLights.Num();
+    Result.NumClusters = Assignment.GetNumClusters();
+    Result.Iterations = Iterations;
+    Result.MinMs = DBL_MAX;
+
+    double TotalMs = 0.0;
+    for (uint32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Assignment.Assign(View, PointLights, SpotLights);
+        const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        TotalMs += ElapsedMs;
+        Result.MinMs = FMath::Min(Result.MinMs, ElapsedMs);
+        Result.MaxMs = FMath::Max(Result.MaxMs, ElapsedMs);
+    }
+
+    Result.AverageMs = TotalMs / Iterations;
+    Result.NumPointLightIndices = Assignment.GetPointLightIndices().Num();
+    Result.NumSpotLightIndices = Assignment.GetSpotLightIndices().Num();
+    return Result;
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+/**
+ * CPU Clustered Light Assignment
+ *
+ * 화면을 (X, Y) 타일과 지수 분포 깊이 슬라이스(Z)로 나눈 클러스터마다 영향을 주는 라이트 인덱스를 계산합니다.
+ * TileLightCulling Compute Shader의 CPU 대체 경로이며, D3D 디바이스 없이도 동작합니다.
+ *
+ * 결과는 CSR 형태의 평탄한 배열입니다.
+ *   ClusterIndex의 라이트 목록 = Indices[Offsets[ClusterIndex] .. Offsets[ClusterIndex + 1])
+ */
+
+struct FClusterGridSettings
+{
+    uint32 ScreenWidth = 1920;
+    uint32 ScreenHeight = 1080;
+    uint32 TileSize = 16;           // 클러스터 한 칸의 픽셀 크기
+    uint32 ClusterCountZ = 24;      // 깊이 슬라이스 수
+
+    float NearZ = 0.1f;
+    float FarZ = 1000.0f;
+
+    FMatrix ProjectionMatrix = FMatrix::Identity;
+
+    bool operator==(const FClusterGridSettings& Other) const;
+};
+
+// 월드 공간 라이트 입력
+struct FClusterPointLight
+{
+    FVector Position;
+    float Radius;
+};
+
+struct FClusterSpotLight
+{
+    FVector Position;
+    float Radius;
+    FVector Direction;
+    float OuterAngle;   // Cone의 반각 (Radian)
+};
+
+struct FClusterBenchmarkResult
+{
+    uint32 NumPointLights = 0;
+    uint32 NumSpotLights = 0;
+    uint32 NumClusters = 0;
+    uint32 Iterations = 0;
+
+    double AverageMs = 0.0;
+    double MinMs = 0.0;
+    double MaxMs = 0.0;
+
+    uint32 NumPointLightIndices = 0;
+    uint32 NumSpotLightIndices = 0;
+};
+
+class FClusteredLightAssignment
+{
+public:
+    FClusteredLightAssignment() = default;
+    ~FClusteredLightAssignment() = default;
+
+    FClusteredLightAssignment(const FClusteredLightAssignment&) = delete;
+    FClusteredLightAssignment& operator=(const FClusteredLightAssignment&) = delete;
+
+    /** 그리드 설정이 바뀐 경우에만 클러스터 AABB를 다시 계산합니다. */
+    void SetGrid(const FClusterGridSettings& InSettings);
+
+    /** 라이트를 View 공간으로 옮긴 뒤, 깊이 슬라이스 단위로 병렬 할당합니다. */
+    void Assign(const FMatrix& ViewMatrix, const TArray<FClusterPointLight>& InPointLights, const TArray<FClusterSpotLight>& InSpotLights);
+
+    /**
+     * 깊이 슬라이스를 합쳐서 기존 Tile Light Culling 셰이더가 읽는 2D 타일 비트마스크 형식으로 변환합니다.
+     * @param TileStrideX 셰이더에서 사용하는 한 행의 타일 수
+     * @param BucketsPerTile 타일 하나가 가지는 uint32 마스크 수 (MAX_LIGHTS_PER_TILE / 32)
+     */
+    void BuildTileMasks(TArray<uint32>& OutPointMask, TArray<uint32>& OutSpotMask, uint32 TileStrideX, uint32 NumTiles, uint32 BucketsPerTile) const;
+
+    uint32 GetClusterCountX() const { return ClusterCountX; }
+    uint32 GetClusterCountY() const { return ClusterCountY; }
+    uint32 GetClusterCountZ() const { return Settings.ClusterCountZ; }
+    uint32 GetNumClusters() const { return ClusterCountX * ClusterCountY * Settings.ClusterCountZ; }
+
+    uint32 GetClusterIndex(uint32 X, uint32 Y, uint32 Z) const { return X + (Y + Z * ClusterCountY) * ClusterCountX; }
+
+    const TArray<uint32>& GetPointLightOffsets() const { return PointLightOffsets; }
+    const TArray<uint32>& GetPointLightIndices() const { return PointLightIndices; }
+    const TArray<uint32>& GetSpotLightOffsets() const { return SpotLightOffsets; }
+    const TArray<uint32>& GetSpotLightIndices() const { return SpotLightIndices; }
+
+    /**
+     * FLightGridGenerator와 같은 배치(한 변 2R+1개의 격자, Point/Spot 교대)로 라이트를 만들어 할당 시간을 측정합니다.
+     * 렌더링 디바이스가 필요 없습니다.
+     */
+    static FClusterBenchmarkResult RunBenchmark(int32 HalfCountPerAxis, uint32 Iterations);
+
+private:
+    // 슬라이스 하나를 처리하는 동안 사용하는 작업 공간. 프레임 간에 재사용하므로 정상 상태에서는 할당이 없음
+    struct FSliceScratch
+    {
+        // 슬라이스와 겹치는 라이트만 추린 SoA (SIMD 폭에 맞춰 패딩)
+        TArray<float> PointX, PointY, PointZ, PointRadiusSq;
+        TArray<uint32> PointIds;
+
+        TArray<float> SpotX, SpotY, SpotZ, SpotDirX, SpotDirY, SpotDirZ, SpotRadius, SpotCos, SpotSin;
+        TArray<uint32> SpotIds;
+
+        // 슬라이스 내부 클러스터 순서대로 기록된 결과
+        TArray<uint32> PointIndices;
+        TArray<uint32> SpotIndices;
+    };
+
+    void BuildClusterBounds();
+    void AssignSlice(uint32 SliceIndex);
+    void GatherSliceLights(uint32 SliceIndex, FSliceScratch& Scratch) const;
+    void CompactSlices();
+
+private:
+    FClusterGridSettings Settings;
+    bool bGridValid = false;
+
+    uint32 ClusterCountX = 0;
+    uint32 ClusterCountY = 0;
+
+    // 클러스터별 View 공간 AABB / Bounding Sphere (SoA)
+    TArray<float> ClusterMinX, ClusterMinY, ClusterMinZ;
+    TArray<float> ClusterMaxX, ClusterMaxY, ClusterMaxZ;
+    TArray<float> ClusterCenterX, ClusterCenterY, ClusterCenterZ, ClusterSphereRadius;
+
+    // 슬라이스 전체를 감싸는 AABB (슬라이스 단위 라이트 사전 필터용)
+    TArray<float> SliceMinX, SliceMinY, SliceMinZ;
+    TArray<float> SliceMaxX, SliceMaxY, SliceMaxZ;
+
+    // 이번 프레임의 View 공간 라이트
+    TArray<FClusterPointLight> ViewPointLights;
+    TArray<FClusterSpotLight> ViewSpotLights;
+
+    TArray<FSliceScratch> SliceScratches;
+
+    TArray<uint32> PointLightOffsets;
+    TArray<uint32> PointLightIndices;
+    TArray<uint32> SpotLightOffsets;
+    TArray<uint32> SpotLightIndices;
+};
@@ -0,0 +1,141 @@
+#include "DebugPrimitiveStream.h"
+
+#include <cstring>
+
+#include "Math/MathUtility.h"
+#include "WindowsPlatformTime.h"
+
+
+uint32 FDebugPrimitiveStream::ComputeGrownCapacity(uint32 Current, uint32 Required)
+{
+    if (Required <= Current)
+    {
+        return Current;
+    }
+
+    uint32 Capacity = FMath::Max(Current, MinCapacityWords);
+    while (Capacity < Required)
+    {
+        Capacity *= 2;
+    }
+    return Capacity;
+}
+
+void FDebugPrimitiveStream::Reset()
+{
+    for (TArray<uint8>& Section : Sections)
+    {
+        Section.SetNum(0);
+    }
+}
+
+bool FDebugPrimitiveStream::IsEmpty() const
+{
+    for (const TArray<uint8>& Section : Sections)
+    {
+        if (Section.Num() > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FDebugPrimitiveLayout FDebugPrimitiveStream::ComputeLayout() const
+{
+    static constexpr uint32 RecordWords[] = {
+        sizeof(FDebugAABBRecord) / WordSize,
+        sizeof(FDebugConeRecord) / WordSize,
+        sizeof(FDebugOBBRecord) / WordSize,
+        sizeof(FDebugBoneRecord) / WordSize,
+    };
+
+    FDebugPrimitiveLayout Layout;
+    for (uint32 TypeIndex = 0; TypeIndex < static_cast<uint32>(EDebugPrimitiveType::Num); ++TypeIndex)
+    {
+        const uint32 NumWords = static_cast<uint32>(Sections[TypeIndex].Num()) / WordSize;
+        Layout.Offsets[TypeIndex] = Layout.NumWords;
+        Layout.Counts[TypeIndex] = NumWords / RecordWords[TypeIndex];
+        Layout.NumWords += NumWords;
+    }
+    return Layout;
+}
+
+void FDebugPrimitiveStream::Pack(void* Dest, const FDebugPrimitiveLayout& Layout) const
+{
+    uint8* DestBytes = static_cast<uint8*>(Dest);
+    for (uint32 TypeIndex = 0; TypeIndex < static_cast<uint32>(EDebugPrimitiveType::Num); ++TypeIndex)
+    {
+        const TArray<uint8>& Section = Sections[TypeIndex];
+        if (Section.Num() > 0)
+        {
+            std::memcpy(DestBytes + Layout.Offsets[TypeIndex] * WordSize, Section.GetData(), Section.Num());
+        }
+    }
+}
+
+
+FDebugPrimitiveBenchmarkResult FDebugPrimitiveBenchmark::Run(int32 NumFrames, int32 MaxPrimitives)
+{
+    FDebugPrimitiveBenchmarkResult Result;
+    Result.NumFrames = NumFrames;
+    Result.MaxPrimitives = MaxPrimitives;
+
+    FDebugPrimitiveStream Stream;
+    TArray<uint8> GpuMemory;        // Map한 버퍼 대신
+
+    uint32 ExactFitCapacity = 0;
+    uint32 GrownCapacity = 0;
+    uint64 ReserveCycles = 0;
+    uint64 PackCycles = 0;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // 선택한 액터 수가 늘어나는 상황처럼 개수를 조금씩 늘림
+        const int32 NumPrimitives = static_cast<int32>(static_cast<int64>(MaxPrimitives) * (Frame + 1) / NumFrames);
+        const int32 NumBones = NumPrimitives / 2;
+        const int32 NumBoxes = NumPrimitives - NumBones;
+
+        const uint64 ReserveStart = FPlatformTime::Cycles64();
+        Stream.Reset();
+
+        FDebugAABBRecord* Boxes = Stream.Reserve<FDebugAABBRecord>(NumBoxes);
+        for (int32 Index = 0; Index < NumBoxes; ++Index)
+        {
+            const float Offset = static_cast<float>(Index);
+            Boxes[Index].Box.min = FVector(Offset, 0.0f, 0.0f);
+            Boxes[Index].Box.max = FVector(Offset + 1.0f, 1.0f, 1.0f);
+        }
+
+        FDebugBoneRecord* Bones = Stream.Reserve<FDebugBoneRecord>(NumBones);
+        for (int32 Index = 0; Index < NumBones; ++Index)
+        {
+            Bones[Index].Bone.Center = FVector(static_cast<float>(Index), 0.0f, 0.0f);
+            Bones[Index].Bone.Color = FVector4(0.8f, 0.8f, 0.0f, 1.0f);
+        }
+        ReserveCycles += FPlatformTime::Cycles64() - ReserveStart;
+
+        const FDebugPrimitiveLayout Layout = Stream.ComputeLayout();
+        if (Layout.NumWords > ExactFitCapacity)
+        {
+            ExactFitCapacity = Layout.NumWords;
+            ++Result.NumExactFitCreations;
+        }
+
+        const uint32 NewCapacity = FDebugPrimitiveStream::ComputeGrownCapacity(GrownCapacity, Layout.NumWords);
+        if (NewCapacity != GrownCapacity)
+        {
+            GrownCapacity = NewCapacity;
+            GpuMemory.SetNum(static_cast<int32>(GrownCapacity * FDebugPrimitiveStream::WordSize));
+            ++Result.NumGrownCreations;
+        }
+
+        const uint64 PackStart = FPlatformTime::Cycles64();
+        Stream.Pack(GpuMemory.GetData(), Layout);
+        PackCycles += FPlatformTime::Cycles64() - PackStart;
+    }
+
+    Result.ReserveMs = FPlatformTime::ToMilliseconds(ReserveCycles) / FMath::Max(NumFrames, 1);
+    Result.PackMs = FPlatformTime::ToMilliseconds(PackCycles) / FMath::Max(NumFrames, 1);
+    return Result;
+}
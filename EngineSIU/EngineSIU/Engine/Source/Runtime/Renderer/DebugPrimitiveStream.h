@@ -0,0 +1,157 @@
+#pragma once
+#include <type_traits>
+
+#include "Define.h"
+#include "Container/Array.h"
+
+/** 셰이더(ShaderLine.hlsl)의 PRIMITIVE_TYPE_* 값과 같아야 함 */
+enum class EDebugPrimitiveType : uint32
+{
+    AABB,
+    Cone,
+    OBB,
+    Bone,
+
+    Num,
+};
+
+/**
+ * 스트림에 들어가는 프리미티브 하나의 머리말 (float4 하나)
+ * 셰이더는 Type을 보고 잘못된 위치를 읽었는지 확인합니다.
+ */
+struct FDebugPrimitiveHeader
+{
+    uint32 Type;
+    uint32 NumWords;    // 머리말을 포함한 레코드 크기 (float4 단위)
+    uint32 Pad[2];
+};
+
+struct FDebugAABBRecord
+{
+    static constexpr EDebugPrimitiveType Type = EDebugPrimitiveType::AABB;
+    FDebugPrimitiveHeader Header;
+    FBoundingBox Box;
+};
+
+struct FDebugConeRecord
+{
+    static constexpr EDebugPrimitiveType Type = EDebugPrimitiveType::Cone;
+    FDebugPrimitiveHeader Header;
+    FCone Cone;
+};
+
+struct FDebugOBBRecord
+{
+    static constexpr EDebugPrimitiveType Type = EDebugPrimitiveType::OBB;
+    FDebugPrimitiveHeader Header;
+    FOBB OBB;
+};
+
+struct FDebugBoneRecord
+{
+    static constexpr EDebugPrimitiveType Type = EDebugPrimitiveType::Bone;
+    FDebugPrimitiveHeader Header;
+    FBoneGizmo Bone;
+};
+
+static_assert(sizeof(FDebugAABBRecord) == 3 * 16);
+static_assert(sizeof(FDebugConeRecord) == 5 * 16);
+static_assert(sizeof(FDebugOBBRecord) == 9 * 16);
+static_assert(sizeof(FDebugBoneRecord) == 3 * 16);
+
+/** GPU 버퍼 안에서 종류별 레코드가 놓인 위치 (float4 단위) */
+struct FDebugPrimitiveLayout
+{
+    uint32 Offsets[static_cast<uint32>(EDebugPrimitiveType::Num)] = {};
+    uint32 Counts[static_cast<uint32>(EDebugPrimitiveType::Num)] = {};
+    uint32 NumWords = 0;
+};
+
+/**
+ * 디버그 라인(AABB, Cone, OBB, Bone)을 한 프레임 동안 모으는 CPU 쪽 스트림
+ *
+ * 생산자는 Reserve로 자리를 받아 레코드를 직접 채웁니다. 머리말은 Reserve가 미리 써 둡니다.
+ * 레코드는 종류별로 이어 붙여 두고, Pack이 종류 순서대로 하나의 버퍼에 복사합니다.
+ * 그래서 셰이더는 구조적 버퍼 하나에서 (종류별 시작 위치 + 인덱스 * 레코드 크기)로 바로 찾아갈 수 있습니다.
+ *
+ * 디바이스를 쓰지 않으므로 GPU 없이 배치와 용량 정책을 확인할 수 있습니다.
+ */
+class FDebugPrimitiveStream
+{
+public:
+    static constexpr uint32 WordSize = 16;
+    static constexpr uint32 MinCapacityWords = 1024;
+
+    /**
+     * Required를 담을 수 있도록 Current를 2배씩 키운 용량. 충분하면 Current를 그대로 돌려줍니다.
+     * 매 프레임 개수가 조금씩 늘어도 버퍼는 log2 번만 다시 만들어집니다.
+     */
+    static uint32 ComputeGrownCapacity(uint32 Current, uint32 Required);
+
+    /**
+     * Count개의 레코드 자리를 만들고 첫 레코드의 포인터를 돌려줍니다. 머리말은 채워져 있습니다.
+     * 포인터는 같은 종류를 다시 Reserve하거나 Reset하기 전까지 유효합니다.
+     */
+    template <typename RecordType>
+    RecordType* Reserve(int32 Count);
+
+    /** 용량은 남겨 두고 레코드만 비웁니다. */
+    void Reset();
+
+    template <typename RecordType>
+    int32 Num() const { return GetSection(RecordType::Type).Num() / static_cast<int32>(sizeof(RecordType)); }
+
+    bool IsEmpty() const;
+
+    FDebugPrimitiveLayout ComputeLayout() const;
+
+    /** 레코드를 Layout 순서대로 Dest에 씁니다. Dest는 Layout.NumWords * WordSize 바이트 이상이어야 합니다. */
+    void Pack(void* Dest, const FDebugPrimitiveLayout& Layout) const;
+
+private:
+    TArray<uint8>& GetSection(EDebugPrimitiveType Type) { return Sections[static_cast<uint32>(Type)]; }
+    const TArray<uint8>& GetSection(EDebugPrimitiveType Type) const { return Sections[static_cast<uint32>(Type)]; }
+
+private:
+    TArray<uint8> Sections[static_cast<uint32>(EDebugPrimitiveType::Num)];
+};
+
+template <typename RecordType>
+RecordType* FDebugPrimitiveStream::Reserve(int32 Count)
+{
+    static_assert(std::is_trivially_copyable_v<RecordType> && sizeof(RecordType) % WordSize == 0);
+
+    TArray<uint8>& Section = GetSection(RecordType::Type);
+    const int32 StartByte = Section.Num();
+    Section.SetNum(StartByte + Count * static_cast<int32>(sizeof(RecordType)));
+
+    RecordType* Records = reinterpret_cast<RecordType*>(Section.GetData() + StartByte);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Records[Index].Header = { static_cast<uint32>(RecordType::Type), sizeof(RecordType) / WordSize, { 0, 0 } };
+    }
+    return Records;
+}
+
+
+struct FDebugPrimitiveBenchmarkResult
+{
+    int32 NumFrames = 0;
+    int32 MaxPrimitives = 0;
+
+    // 버퍼를 다시 만든 횟수: 정확히 맞춤(이전 방식) / 2배씩 키움
+    int32 NumExactFitCreations = 0;
+    int32 NumGrownCreations = 0;
+
+    double ReserveMs = 0.0;         // 프레임당 Reserve + 직접 쓰기
+    double PackMs = 0.0;            // 프레임당 Pack
+};
+
+struct FDebugPrimitiveBenchmark
+{
+    /**
+     * 프리미티브 개수를 프레임마다 늘려 가며 스트림을 채우고 Pack합니다.
+     * 이전처럼 개수에 딱 맞춰 버퍼를 만들 때와 2배씩 키울 때의 버퍼 생성 횟수를 셉니다.
+     */
+    static FDebugPrimitiveBenchmarkResult Run(int32 NumFrames, int32 MaxPrimitives);
+};
@@ -61,6 +61,8 @@ void FDepthPrePass::PrepareRenderState(const std::shared_ptr<FViewportClient>& V
     // !TODO : Skeletal메시 쉐이더 생기면 두 번 해줘야 함
     StaticMesh_VertexShader = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShader");
     StaticMesh_InputLayout = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    StaticMesh_PackedVertexShader = ShaderManager->GetVertexShaderByKey(L"PACKED_StaticMeshVertexShader");
+    StaticMesh_PackedInputLayout = ShaderManager->GetInputLayoutByKey(L"PACKED_StaticMeshVertexShader");
     
     Graphics->DeviceContext->VSSetShader(StaticMesh_VertexShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(StaticMesh_InputLayout);
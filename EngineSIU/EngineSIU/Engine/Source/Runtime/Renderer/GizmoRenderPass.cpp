@@ -12,6 +12,7 @@
 
 #include "RendererHelpers.h"
 #include "Math/JungleMath.h"
+#include "Math/MathBatch.h"
 
 #include "World/World.h"
 
@@ -183,7 +184,9 @@ void FGizmoRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FV
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
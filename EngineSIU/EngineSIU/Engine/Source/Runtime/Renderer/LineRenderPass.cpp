@@ -9,6 +9,7 @@
 #include "RendererHelpers.h"
 
 #include "Math/JungleMath.h"
+#include "Math/MathBatch.h"
 
 #include "EngineLoop.h"
 #include "UnrealClient.h"
@@ -95,7 +96,9 @@ void FLineRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVe
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
@@ -10,6 +10,7 @@
 #include "Engine/EditorEngine.h"
 #include "ShowFlag.h"
 #include "Rendering/Mesh/SkeletalMeshRenderData.h"
+#include "Math/MathBatch.h"
 
 #include "D3D11RHI/DXDBufferManager.h"
 #include "D3D11RHI/GraphicDevice.h"
@@ -19,6 +20,8 @@
 #include "Components/StaticMeshComponent.h"
 #include "Rendering/Mesh/SkeletalMesh.h"
 #include "Rendering/Mesh/StaticMesh.h"
+#include "Rendering/Mesh/StaticMeshVertexPacking.h"
+#include "SoftwareOcclusion.h"
 #include "BaseGizmos/GizmoBaseComponent.h"
 
 
@@ -47,6 +50,8 @@ void FMeshRenderPass::PrepareRenderArr(const std::shared_ptr<FViewportClient>& V
         {
             if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == Viewport->GetWorld())
             {
+                // 그림자 패스도 여기서 고른 LOD를 씀
+                iter->UpdateLOD(Viewport->GetViewportIndex(), Viewport->GetCameraLocation(), Viewport->GetProjectionMatrix(), Viewport->IsPerspective());
                 StaticMeshComponents.Add(iter);
             }
         }
@@ -150,6 +155,8 @@ void FMeshRenderPass::CreateShader()
 
     StaticMesh_VertexShader = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShader");
     StaticMesh_InputLayout = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    StaticMesh_PackedVertexShader = ShaderManager->GetVertexShaderByKey(L"PACKED_StaticMeshVertexShader");
+    StaticMesh_PackedInputLayout = ShaderManager->GetInputLayoutByKey(L"PACKED_StaticMeshVertexShader");
 
     StaticMesh_PixelShader = ShaderManager->GetPixelShaderByKey(L"PHONG_StaticMeshPixelShader");
     StaticMesh_DebugDepthShader = ShaderManager->GetPixelShaderByKey(L"StaticMeshPixelShaderDepth");
@@ -225,13 +232,20 @@ void FMeshRenderPass::ChangeViewMode(EViewModeIndex ViewModeIndex)
         UpdateLitUnlitConstant(1);
         break;
     }
+
+    const bool bGouraud = ViewModeIndex == EViewModeIndex::VMI_Lit_Gouraud;
+    StaticMesh_PackedVertexShader = ShaderManager->GetVertexShaderByKey(bGouraud ? L"PACKED_GOURAUD_StaticMeshVertexShader" : L"PACKED_StaticMeshVertexShader");
+    StaticMesh_PackedInputLayout = ShaderManager->GetInputLayoutByKey(bGouraud ? L"PACKED_GOURAUD_StaticMeshVertexShader" : L"PACKED_StaticMeshVertexShader");
 }
 
-void FMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
+void FMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected, const FMatrix& PositionMatrix) const
 {
     FObjectConstantBuffer ObjectData = {};
-    ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    // 노멀은 압축과 무관하므로 InverseTransposedWorld는 원래 월드 행렬로 계산
+    ObjectData.WorldMatrix = PositionMatrix * WorldMatrix;
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
 
@@ -245,8 +259,29 @@ void FMeshRenderPass::UpdateLitUnlitConstant(int32 isLit) const
     BufferManager->UpdateConstantBuffer(TEXT("FLitUnlitConstants"), Data);
 }
 
+void FMeshRenderPass::BindStaticMeshVertexShader(EStaticMeshVertexFormat VertexFormat) const
+{
+    if (VertexFormat == EStaticMeshVertexFormat::Packed)
+    {
+        Graphics->DeviceContext->VSSetShader(StaticMesh_PackedVertexShader, nullptr, 0);
+        Graphics->DeviceContext->IASetInputLayout(StaticMesh_PackedInputLayout);
+    }
+    else
+    {
+        Graphics->DeviceContext->VSSetShader(StaticMesh_VertexShader, nullptr, 0);
+        Graphics->DeviceContext->IASetInputLayout(StaticMesh_InputLayout);
+    }
+}
+
 void FMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FViewportClient>& Viewport)
 {
+    // PrepareRenderState에서 Float 형식 셰이더가 바인딩되어 있음
+    EStaticMeshVertexFormat BoundVertexFormat = EStaticMeshVertexFormat::Float;
+
+    FClusterCullView ClusterCullView;
+    ClusterCullView.ViewProjections.Add(Viewport->GetViewMatrix() * Viewport->GetProjectionMatrix());
+    ClusterCullView.OcclusionTester = OcclusionCulling ? OcclusionCulling->GetOcclusionBuffer() : nullptr;
+
     for (UStaticMeshComponent* Comp : StaticMeshComponents)
     {
         if (!Comp || !Comp->GetStaticMesh())
@@ -254,6 +289,11 @@ void FMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FViewportClien
             continue;
         }
 
+        if (OcclusionCulling && OcclusionCulling->IsOccluded(Comp))
+        {
+            continue;
+        }
+
         FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
         if (RenderData == nullptr)
         {
@@ -283,15 +323,38 @@ void FMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FViewportClien
         FMatrix WorldMatrix = Comp->GetWorldMatrix();
         FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
 
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+        // 클러스터는 LOD0에만 있음
+        const int32 LODIndex = FMath::Clamp(Comp->GetLODIndex(Viewport->GetViewportIndex()), 0, RenderData->GetNumLODs() - 1);
+        const bool bClusterCulled = LODIndex == 0 && FMeshCluster::bCullingEnabled
+            && FMeshCluster::CullClusters(*RenderData, WorldMatrix, ClusterCullView, ClusterDrawRanges, &FMeshCluster::MainViewStats);
+
+        if (!bClusterCulled || ClusterDrawRanges.Num() > 0)
+        {
+            if (RenderData->VertexFormat != BoundVertexFormat)
+            {
+                BoundVertexFormat = RenderData->VertexFormat;
+                BindStaticMeshVertexShader(BoundVertexFormat);
+            }
 
-        RenderStaticMesh(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+            UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected, FStaticMeshVertexPacking::GetPositionMatrix(*RenderData));
+
+            RenderStaticMesh(
+                RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex(), LODIndex,
+                bClusterCulled ? &ClusterDrawRanges : nullptr
+            );
+        }
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
         {
             FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), WorldMatrix);
         }
     }
+
+    // 뒤이어 그리는 SkeletalMesh는 Float 형식
+    if (BoundVertexFormat != EStaticMeshVertexFormat::Float)
+    {
+        BindStaticMeshVertexShader(EStaticMeshVertexFormat::Float);
+    }
 }
 
 void FMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FViewportClient>& Viewport)
@@ -343,50 +406,73 @@ void FMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FViewportCli
         // Begin Test
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Bone))
         {
-            const float BoneSphereRadius = 10.0f;
             const FVector4 BoneDebugColor = FVector4(0.8f, 0.8f, 0.0f, 1.0f);
 
             const int32 BoneCount = RenderData->BoneNames.Num();
 
+            // 본 전체의 자리를 한 번에 받아서 바로 채움
+            FDebugBoneRecord* BoneRecords = FEngineLoop::PrimitiveDrawBatch.ReservePrimitives<FDebugBoneRecord>(BoneCount);
             for (int32 BoneIdx = 0; BoneIdx < BoneCount; ++BoneIdx)
             {
                 const FMatrix& BoneMeshSpaceTransform = RenderData->ReferencePose[BoneIdx];
                 FVector BoneJointPos_LocalSpace = BoneMeshSpaceTransform.GetTranslationVector();
-                FVector BoneJointPos_WorldSpace = WorldMatrix.TransformPosition(BoneJointPos_LocalSpace);
-
-                FEngineLoop::PrimitiveDrawBatch.AddJointSphereToBatch(
-                    BoneJointPos_WorldSpace,
-                    BoneSphereRadius,
-                    BoneDebugColor,
-                    WorldMatrix
-                );
+                BoneRecords[BoneIdx].Bone.Center = WorldMatrix.TransformPosition(BoneJointPos_LocalSpace);
+                BoneRecords[BoneIdx].Bone.Color = BoneDebugColor;
             }
         }
         // End Test
     }
 }
 
-void FMeshRenderPass::RenderStaticMesh(FStaticMeshRenderData* RenderData, TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
+void FMeshRenderPass::RenderStaticMesh(
+    FStaticMeshRenderData* RenderData, TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex, int32 LODIndex,
+    const TArray<FClusterDrawRange>* ClusterRanges
+) const
 {
-    UINT Stride = sizeof(FStaticMeshVertex);
+    UINT Stride = FStaticMeshVertexPacking::GetStride(RenderData->VertexFormat);
     UINT Offset = 0;
 
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &Offset);
 
-    if (RenderData->IndexBuffer)
+    LODIndex = FMath::Clamp(LODIndex, 0, RenderData->GetNumLODs() - 1);
+    if (ID3D11Buffer* IndexBuffer = RenderData->GetIndexBuffer(LODIndex))
     {
-        Graphics->DeviceContext->IASetIndexBuffer(RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
     }
 
-    if (RenderData->MaterialSubsets.Num() == 0)
+    const TArray<FMaterialSubset>& MaterialSubsets = RenderData->GetMaterialSubsets(LODIndex);
+    if (MaterialSubsets.Num() == 0)
     {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        if (ClusterRanges)
+        {
+            for (const FClusterDrawRange& Range : *ClusterRanges)
+            {
+                Graphics->DeviceContext->DrawIndexed(Range.IndexCount, Range.IndexStart, 0);
+            }
+            return;
+        }
+        Graphics->DeviceContext->DrawIndexed(RenderData->GetNumIndices(LODIndex), 0, 0);
         return;
     }
 
-    for (int SubMeshIndex = 0; SubMeshIndex < RenderData->MaterialSubsets.Num(); SubMeshIndex++)
+    // 범위는 서브셋 순서이므로 앞에서부터 한 번만 훑음
+    int32 RangeIndex = 0;
+    for (int SubMeshIndex = 0; SubMeshIndex < MaterialSubsets.Num(); SubMeshIndex++)
     {
-        uint32 MaterialIndex = RenderData->MaterialSubsets[SubMeshIndex].MaterialIndex;
+        if (ClusterRanges)
+        {
+            while (RangeIndex < ClusterRanges->Num() && (*ClusterRanges)[RangeIndex].SubsetIndex < static_cast<uint32>(SubMeshIndex))
+            {
+                ++RangeIndex;
+            }
+            // 남은 클러스터가 없는 서브셋은 머티리얼도 바꾸지 않음
+            if (RangeIndex == ClusterRanges->Num() || (*ClusterRanges)[RangeIndex].SubsetIndex != static_cast<uint32>(SubMeshIndex))
+            {
+                continue;
+            }
+        }
+
+        uint32 MaterialIndex = MaterialSubsets[SubMeshIndex].MaterialIndex;
 
         FSubMeshConstants SubMeshData = (SubMeshIndex == SelectedSubMeshIndex) ? FSubMeshConstants(true) : FSubMeshConstants(false);
 
@@ -401,8 +487,17 @@ void FMeshRenderPass::RenderStaticMesh(FStaticMeshRenderData* RenderData, TArray
             MaterialUtils::UpdateMaterial(BufferManager, Graphics, Materials[MaterialIndex]->Material->GetMaterialInfo());
         }
 
-        uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
-        uint32 IndexCount = RenderData->MaterialSubsets[SubMeshIndex].IndexCount;
+        if (ClusterRanges)
+        {
+            for (; RangeIndex < ClusterRanges->Num() && (*ClusterRanges)[RangeIndex].SubsetIndex == static_cast<uint32>(SubMeshIndex); ++RangeIndex)
+            {
+                Graphics->DeviceContext->DrawIndexed((*ClusterRanges)[RangeIndex].IndexCount, (*ClusterRanges)[RangeIndex].IndexStart, 0);
+            }
+            continue;
+        }
+
+        uint32 StartIndex = MaterialSubsets[SubMeshIndex].IndexStart;
+        uint32 IndexCount = MaterialSubsets[SubMeshIndex].IndexCount;
         Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
     }
 }
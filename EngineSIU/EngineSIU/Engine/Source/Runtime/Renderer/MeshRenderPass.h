@@ -4,6 +4,7 @@
 #include "EngineBaseTypes.h"
 
 #include "Define.h"
+#include "Rendering/Mesh/MeshCluster.h"
 
 class USkeletalMeshComponent;
 class FShadowManager;
@@ -14,6 +15,7 @@ class UStaticMeshComponent;
 struct FMaterialSlot;
 class FShadowRenderPass;
 struct FSkeletalMeshRenderData;
+class FSoftwareOcclusionCulling;
 
 class FMeshRenderPass : public IRenderPass
 {
@@ -33,23 +35,48 @@ public:
     void CreateShader();
     void ReleaseShader();
     void ChangeViewMode(EViewModeIndex ViewModeIndex);
-    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
+    /** PositionMatrix는 정점 버퍼의 위치를 로컬 공간으로 옮기는 행렬 (FStaticMeshVertexPacking::GetPositionMatrix) */
+    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected, const FMatrix& PositionMatrix = FMatrix::Identity) const;
     void UpdateLitUnlitConstant(int32 isLit) const;
 
     void RenderAllStaticMeshes(const std::shared_ptr<FViewportClient>& Viewport);
     void RenderAllSkeletalMeshes(const std::shared_ptr<FViewportClient>& Viewport);
 
-    void RenderStaticMesh(FStaticMeshRenderData* RenderData, TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
+    /** 정점 형식에 맞는 StaticMesh 정점 셰이더와 입력 레이아웃을 바인딩합니다. */
+    void BindStaticMeshVertexShader(EStaticMeshVertexFormat VertexFormat) const;
+
+    /**
+     * LODIndex는 FStaticMeshRenderData::LODs를 포함한 번호. 0이 원본
+     * ClusterRanges가 있으면 LOD0에서 FMeshCluster::CullClusters가 남긴 범위만 그립니다.
+     */
+    void RenderStaticMesh(
+        FStaticMeshRenderData* RenderData, TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex, int32 LODIndex = 0,
+        const TArray<FClusterDrawRange>* ClusterRanges = nullptr
+    ) const;
     void RenderSkeletalMesh(FSkeletalMeshRenderData* RenderData, TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
 
+    /** 있으면 RenderAllStaticMeshes에서 가려진 컴포넌트와 클러스터를 건너뜁니다. FRenderer가 뷰포트마다 Cull한 결과 */
+    void SetOcclusionCulling(const FSoftwareOcclusionCulling* InOcclusionCulling) { OcclusionCulling = InOcclusionCulling; }
+
+    const TArray<UStaticMeshComponent*>& GetStaticMeshComponents() const { return StaticMeshComponents; }
+
 protected:
     TArray<UStaticMeshComponent*> StaticMeshComponents;
     TArray<USkeletalMeshComponent*> SkeletalMeshComponents;
 
+    // RenderAllStaticMeshes에서 컴포넌트마다 다시 채움
+    TArray<FClusterDrawRange> ClusterDrawRanges;
+
+    const FSoftwareOcclusionCulling* OcclusionCulling = nullptr;
+
     // StaticMesh
     ID3D11VertexShader* StaticMesh_VertexShader;
     ID3D11InputLayout* StaticMesh_InputLayout;
 
+    // FPackedStaticMeshVertex용
+    ID3D11VertexShader* StaticMesh_PackedVertexShader;
+    ID3D11InputLayout* StaticMesh_PackedInputLayout;
+
     ID3D11PixelShader* StaticMesh_PixelShader;
     ID3D11PixelShader* StaticMesh_DebugDepthShader;
     ID3D11PixelShader* StaticMesh_DebugWorldNormalShader;
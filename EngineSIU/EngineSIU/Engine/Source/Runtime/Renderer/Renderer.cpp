@@ -20,6 +20,7 @@
 #include "FadeRenderpass.h"
 #include "TileLightCullingPass.h"
 #include "MeshRenderPass.h"
+#include "SoftwareOcclusion.h"
 #include <UObject/UObjectIterator.h>
 #include <UObject/Casts.h>
 
@@ -46,6 +47,8 @@
 //------------------------------------------------------------------------------
 void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBufferManager, FGPUTimingManager* InGPUTimingManager)
 {
+    MEMORY_TAG_SCOPE(RenderData);
+
     Graphics = InGraphics;
     BufferManager = InBufferManager;
     GPUTimingManager = InGPUTimingManager;
@@ -61,6 +64,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
 //    SkeletalMeshRenderPass = new FSkeletalRenderPass();
 
     MeshRenderPass = new FMeshRenderPass();
+    SoftwareOcclusion = new FSoftwareOcclusionCulling();
     WorldBillboardRenderPass = new FWorldBillboardRenderPass();
     EditorBillboardRenderPass = new FEditorBillboardRenderPass();
     GizmoRenderPass = new FGizmoRenderPass();
@@ -92,6 +96,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
 
     MeshRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     MeshRenderPass->InitializeShadowManager(ShadowManager);
+    MeshRenderPass->SetOcclusionCulling(SoftwareOcclusion);
 
     WorldBillboardRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     EditorBillboardRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
@@ -102,6 +107,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     EditorRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     
     DepthPrePass->Initialize(BufferManager, Graphics, ShaderManager);
+    DepthPrePass->SetOcclusionCulling(SoftwareOcclusion);
     TileLightCullingPass->Initialize(BufferManager, Graphics, ShaderManager);
     LightHeatMapRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
 
@@ -125,6 +131,7 @@ void FRenderer::Release()
 //#pragma endregion
 
     delete MeshRenderPass;
+    delete SoftwareOcclusion;
     delete WorldBillboardRenderPass;
     delete EditorBillboardRenderPass;
     delete GizmoRenderPass;
@@ -238,6 +245,37 @@ void FRenderer::CreateCommonShader() const
         return;
     }
 #pragma endregion UberShader
+
+    // FPackedStaticMeshVertex
+    D3D11_INPUT_ELEMENT_DESC PackedStaticMeshLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+    };
+
+    D3D_SHADER_MACRO DefinesPacked[] =
+    {
+        { PACKED_VERTEX, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"PACKED_StaticMeshVertexShader", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", PackedStaticMeshLayoutDesc, ARRAYSIZE(PackedStaticMeshLayoutDesc), DefinesPacked);
+    if (FAILED(hr))
+    {
+        return;
+    }
+
+    D3D_SHADER_MACRO DefinesPackedGouraud[] =
+    {
+        { PACKED_VERTEX, "1" },
+        { GOURAUD, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"PACKED_GOURAUD_StaticMeshVertexShader", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", PackedStaticMeshLayoutDesc, ARRAYSIZE(PackedStaticMeshLayoutDesc), DefinesPackedGouraud);
+    if (FAILED(hr))
+    {
+        return;
+    }
 }
 
 void FRenderer::PrepareRender(FViewportResource* ViewportResource) const
@@ -354,6 +392,23 @@ void FRenderer::BeginRender(const std::shared_ptr<FViewportClient>& Viewport)
     PrepareRender(ViewportResource);
 
     PrepareRenderPass(Viewport);
+
+    CullOcclusion(Viewport);
+}
+
+void FRenderer::CullOcclusion(const std::shared_ptr<FViewportClient>& Viewport) const
+{
+    QUICK_SCOPE_CYCLE_COUNTER(SoftwareOcclusion_CPU)
+
+    // 두 메시 패스가 같은 컴포넌트 목록을 모으므로 MeshRenderPass의 것을 씀
+    SoftwareOcclusion->Cull(Viewport, MeshRenderPass->GetStaticMeshComponents());
+}
+
+void FRenderer::CullOcclusionWithoutRendering(const std::shared_ptr<FViewportClient>& Viewport) const
+{
+    MeshRenderPass->PrepareRenderArr(Viewport);
+    CullOcclusion(Viewport);
+    MeshRenderPass->ClearRenderArr();
 }
 
 
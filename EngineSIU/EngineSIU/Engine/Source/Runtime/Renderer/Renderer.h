@@ -45,6 +45,7 @@ class FTileLightCullingPass;
 class FGPUTimingManager;
 
 class FMeshRenderPass;
+class FSoftwareOcclusionCulling;
 
 class FFadeRenderPass;
 
@@ -65,11 +66,15 @@ public:
     void Render(const std::shared_ptr<FViewportClient>& Viewport);
     void RenderViewport(const std::shared_ptr<FViewportClient>& Viewport) const; // TODO: 추후 RenderSlate로 변경해야함
 
+    /** 렌더링 없이 뷰포트의 오클루전 컬링만 실행합니다. 벤치마크의 -nullrhi에서 컬링 비용과 결과를 측정할 때 씁니다. */
+    void CullOcclusionWithoutRendering(const std::shared_ptr<FViewportClient>& Viewport) const;
+
 protected:
     void BeginRender(const std::shared_ptr<FViewportClient>& Viewport);
     void UpdateCommonBuffer(const std::shared_ptr<FViewportClient>& Viewport) const;
     void PrepareRender(FViewportResource* ViewportResource) const;
     void PrepareRenderPass(const std::shared_ptr<FViewportClient>& Viewport) const;
+    void CullOcclusion(const std::shared_ptr<FViewportClient>& Viewport) const;
     void RenderWorldScene(const std::shared_ptr<FViewportClient>& Viewport) const;
     void RenderPostProcess(const std::shared_ptr<FViewportClient>& Viewport) const;
     void RenderEditorOverlay(const std::shared_ptr<FViewportClient>& Viewport) const;
@@ -106,6 +111,9 @@ public:
 
     FMeshRenderPass* MeshRenderPass = nullptr;
 
+    // MeshRenderPass / DepthPrePass가 함께 쓰는 뷰포트별 오클루전 결과
+    FSoftwareOcclusionCulling* SoftwareOcclusion = nullptr;
+
     FWorldBillboardRenderPass* WorldBillboardRenderPass = nullptr;
     FEditorBillboardRenderPass* EditorBillboardRenderPass = nullptr;
     FGizmoRenderPass* GizmoRenderPass = nullptr;
@@ -39,7 +39,7 @@ namespace MaterialUtils
         
         // Update Textures
         if (MaterialInfo.TextureFlag & (1 << 1)) {
-            std::shared_ptr<FTexture> texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.DiffuseTexturePath);
+            const FTexture* texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.DiffuseTextureHandle);
             if (texture)
             {
                 Graphics->DeviceContext->PSSetShaderResources(0, 1, &texture->TextureSRV);
@@ -57,7 +57,7 @@ namespace MaterialUtils
         
         if (MaterialInfo.TextureFlag & (1 << 2))
         {
-            std::shared_ptr<FTexture> texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.BumpTexturePath);
+            const FTexture* texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.BumpTextureHandle);
             if (texture)
             {
                 Graphics->DeviceContext->PSSetShaderResources(1, 1, &texture->TextureSRV);
@@ -0,0 +1,335 @@
+#include "ShaderCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cwctype>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+#include "CoreMiscDefines.h"
+
+
+namespace
+{
+    constexpr uint64 FnvOffsetBasis = 14695981039346656037ull;
+    constexpr uint64 FnvPrime = 1099511628211ull;
+
+    // FNV-1a
+    void HashBytes(uint64& Hash, const void* Data, size_t Size)
+    {
+        const uint8* Bytes = static_cast<const uint8*>(Data);
+        for (size_t Index = 0; Index < Size; ++Index)
+        {
+            Hash = (Hash ^ Bytes[Index]) * FnvPrime;
+        }
+    }
+
+    // 길이를 먼저 넣어서 ("ab", "c")와 ("a", "bc")가 같은 키가 되지 않도록 함
+    void HashString(uint64& Hash, const std::string& String)
+    {
+        const uint64 Length = String.size();
+        HashBytes(Hash, &Length, sizeof(Length));
+        HashBytes(Hash, String.data(), String.size());
+    }
+
+    bool ReadTextFile(const std::filesystem::path& FilePath, std::string& OutText)
+    {
+        std::ifstream File(FilePath, std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        std::ostringstream Stream;
+        Stream << File.rdbuf();
+        OutText = Stream.str();
+        return true;
+    }
+
+    /**
+     * #include "X" / #include <X>를 찾습니다.
+     * 줄 맨 앞(공백 제외)이 #인 경우만 보므로 // 주석 처리된 include는 무시합니다.
+     */
+    void ParseIncludes(const std::string& Text, TArray<std::string>& OutNames)
+    {
+        std::istringstream Stream(Text);
+        std::string Line;
+        while (std::getline(Stream, Line))
+        {
+            size_t Pos = Line.find_first_not_of(" \t");
+            if (Pos == std::string::npos || Line[Pos] != '#')
+            {
+                continue;
+            }
+            Pos = Line.find_first_not_of(" \t", Pos + 1);
+            if (Pos == std::string::npos || Line.compare(Pos, 7, "include") != 0)
+            {
+                continue;
+            }
+
+            const size_t Open = Line.find_first_of("\"<", Pos + 7);
+            if (Open == std::string::npos)
+            {
+                continue;
+            }
+            const size_t Close = Line.find(Line[Open] == '"' ? '"' : '>', Open + 1);
+            if (Close == std::string::npos)
+            {
+                continue;
+            }
+            OutNames.Add(Line.substr(Open + 1, Close - Open - 1));
+        }
+    }
+}
+
+
+FShaderBinaryCache::FShaderBinaryCache(std::filesystem::path InDirectory)
+    : Directory(std::move(InDirectory))
+{
+    std::error_code Error;
+    std::filesystem::create_directories(Directory, Error);
+}
+
+std::filesystem::path FShaderBinaryCache::GetFilePath(uint64 Key) const
+{
+    char Name[32];
+    std::snprintf(Name, sizeof(Name), "%016llx.cso", static_cast<unsigned long long>(Key));
+    return Directory / Name;
+}
+
+bool FShaderBinaryCache::Load(uint64 Key, TArray<uint8>& OutBytecode) const
+{
+    std::ifstream File(GetFilePath(Key), std::ios::binary | std::ios::ate);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    const std::streamoff Size = File.tellg();
+    if (Size <= 0)
+    {
+        return false;
+    }
+
+    OutBytecode.SetNum(static_cast<int32>(Size));
+    File.seekg(0);
+    File.read(reinterpret_cast<char*>(OutBytecode.GetData()), Size);
+    return static_cast<bool>(File);
+}
+
+bool FShaderBinaryCache::Store(uint64 Key, const TArray<uint8>& Bytecode)
+{
+    const std::filesystem::path FilePath = GetFilePath(Key);
+
+    // 같은 키를 동시에 저장해도 서로의 임시 파일을 덮어쓰지 않도록 번호를 붙임
+    std::filesystem::path TempPath = FilePath;
+    TempPath += ".tmp" + std::to_string(NextTempIndex.fetch_add(1));
+    {
+        std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        File.write(reinterpret_cast<const char*>(Bytecode.GetData()), Bytecode.Num());
+        if (!File)
+        {
+            return false;
+        }
+    }
+
+    std::error_code Error;
+    std::filesystem::rename(TempPath, FilePath, Error);
+    if (Error)
+    {
+        std::filesystem::remove(TempPath, Error);
+        return false;
+    }
+    return true;
+}
+
+
+bool ShaderCache::CollectSources(const std::filesystem::path& MainFile, const std::filesystem::path& ShaderRoot, TArray<FShaderSourceFile>& OutSources)
+{
+    OutSources.Empty();
+
+    FShaderSourceFile Main;
+    Main.Path = MainFile.lexically_normal();
+    if (!ReadTextFile(Main.Path, Main.Text))
+    {
+        return false;
+    }
+    OutSources.Add(std::move(Main));
+
+    TMap<std::wstring, int32> SourceIndices;
+    SourceIndices.Add(FShaderDependencyGraph::MakeFileKey(OutSources[0].Path), 0);
+
+    // OutSources 자체를 큐로 사용 (너비 우선)
+    for (int32 SourceIndex = 0; SourceIndex < OutSources.Num(); ++SourceIndex)
+    {
+        TArray<std::string> IncludeNames;
+        ParseIncludes(OutSources[SourceIndex].Text, IncludeNames);
+
+        const std::filesystem::path ParentDirectory = OutSources[SourceIndex].Path.parent_path();
+        for (const std::string& IncludeName : IncludeNames)
+        {
+            int32 IncludeIndex = INDEX_NONE;
+
+            const std::filesystem::path Candidates[] = {
+                (ParentDirectory / IncludeName).lexically_normal(),
+                (ShaderRoot / IncludeName).lexically_normal(),
+            };
+            for (const std::filesystem::path& Candidate : Candidates)
+            {
+                const std::wstring FileKey = FShaderDependencyGraph::MakeFileKey(Candidate);
+                if (const int32* Found = SourceIndices.Find(FileKey))
+                {
+                    IncludeIndex = *Found;
+                    break;
+                }
+
+                FShaderSourceFile Include;
+                Include.Path = Candidate;
+                if (ReadTextFile(Candidate, Include.Text))
+                {
+                    IncludeIndex = OutSources.Num();
+                    SourceIndices.Add(FileKey, IncludeIndex);
+                    OutSources.Add(std::move(Include));
+                    break;
+                }
+            }
+
+            OutSources[SourceIndex].Includes.Add({ IncludeName, IncludeIndex });
+        }
+    }
+    return true;
+}
+
+uint64 ShaderCache::ComputeKey(const FShaderCompileRequest& Request, const TArray<FShaderSourceFile>& Sources, const char* CompilerName)
+{
+    uint64 Hash = FnvOffsetBasis;
+
+    const uint32 CacheVersion = Version;
+    HashBytes(Hash, &CacheVersion, sizeof(CacheVersion));
+    HashString(Hash, CompilerName);
+    HashString(Hash, Request.EntryPoint);
+    HashString(Hash, Request.Profile);
+    HashBytes(Hash, &Request.Flags, sizeof(Request.Flags));
+
+    const uint64 NumDefines = Request.Defines.size();
+    HashBytes(Hash, &NumDefines, sizeof(NumDefines));
+    for (const auto& [Name, Definition] : Request.Defines)
+    {
+        HashString(Hash, Name);
+        HashString(Hash, Definition);
+    }
+
+    // 파일을 찾은 위치가 달라지면 다른 키가 되도록 include 해석 결과도 넣음
+    for (const FShaderSourceFile& Source : Sources)
+    {
+        HashString(Hash, Source.Path.generic_string());
+        HashString(Hash, Source.Text);
+        for (const auto& [IncludeName, IncludeIndex] : Source.Includes)
+        {
+            HashString(Hash, IncludeName);
+            HashBytes(Hash, &IncludeIndex, sizeof(IncludeIndex));
+        }
+    }
+    return Hash;
+}
+
+bool ShaderCache::CompileWithCache(
+    const FShaderCompileRequest& Request, const std::filesystem::path& ShaderRoot,
+    FShaderBinaryCache& Cache, IShaderCompilerBackend& Compiler, FShaderCompileResult& OutResult
+)
+{
+    const auto StartTime = std::chrono::steady_clock::now();
+
+    OutResult = FShaderCompileResult();
+
+    TArray<FShaderSourceFile> Sources;
+    if (!CollectSources(Request.FilePath, ShaderRoot, Sources))
+    {
+        OutResult.Error = "Cannot read " + Request.FilePath.generic_string();
+        return false;
+    }
+
+    OutResult.SourceFiles.Reserve(Sources.Num());
+    for (const FShaderSourceFile& Source : Sources)
+    {
+        OutResult.SourceFiles.Add(Source.Path);
+    }
+
+    OutResult.Key = ComputeKey(Request, Sources, Compiler.GetName());
+    OutResult.bCacheHit = Cache.Load(OutResult.Key, OutResult.Bytecode);
+
+    bool bSucceeded = true;
+    if (!OutResult.bCacheHit)
+    {
+        bSucceeded = Compiler.Compile(Request, Sources, OutResult.Bytecode, OutResult.Error);
+        if (bSucceeded)
+        {
+            // 저장에 실패해도 이번 결과는 쓸 수 있으므로 무시
+            Cache.Store(OutResult.Key, OutResult.Bytecode);
+        }
+    }
+
+    OutResult.ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+    return bSucceeded;
+}
+
+
+std::wstring FShaderDependencyGraph::MakeFileKey(const std::filesystem::path& FilePath)
+{
+    std::wstring Key = FilePath.lexically_normal().generic_wstring();
+    for (wchar_t& Char : Key)
+    {
+        Char = static_cast<wchar_t>(std::towlower(Char));
+    }
+    return Key;
+}
+
+void FShaderDependencyGraph::SetDependencies(const std::wstring& ShaderKey, const TArray<std::filesystem::path>& Files)
+{
+    RemoveShader(ShaderKey);
+
+    TArray<std::wstring>& ShaderFiles = ShaderToFiles[ShaderKey];
+    for (const std::filesystem::path& File : Files)
+    {
+        const std::wstring FileKey = MakeFileKey(File);
+        FileToShaders[FileKey].Add(ShaderKey);
+        ShaderFiles.Add(FileKey);
+    }
+}
+
+void FShaderDependencyGraph::RemoveShader(const std::wstring& ShaderKey)
+{
+    const TArray<std::wstring>* OldFiles = ShaderToFiles.Find(ShaderKey);
+    if (OldFiles == nullptr)
+    {
+        return;
+    }
+
+    for (const std::wstring& FileKey : *OldFiles)
+    {
+        if (TSet<std::wstring>* Shaders = FileToShaders.Find(FileKey))
+        {
+            Shaders->Remove(ShaderKey);
+            if (Shaders->IsEmpty())
+            {
+                FileToShaders.Remove(FileKey);
+            }
+        }
+    }
+    ShaderToFiles.Remove(ShaderKey);
+}
+
+void FShaderDependencyGraph::GetDependents(const std::filesystem::path& FilePath, TArray<std::wstring>& OutShaderKeys) const
+{
+    if (const TSet<std::wstring>* Shaders = FileToShaders.Find(MakeFileKey(FilePath)))
+    {
+        for (const std::wstring& ShaderKey : *Shaders)
+        {
+            OutShaderKeys.Add(ShaderKey);
+        }
+    }
+}
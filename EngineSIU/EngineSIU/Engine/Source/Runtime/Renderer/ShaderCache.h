@@ -0,0 +1,132 @@
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "HAL/PlatformType.h"
+
+
+/** 셰이더 하나를 컴파일하는 데 필요한 입력. 캐시 키에 모두 들어갑니다. */
+struct FShaderCompileRequest
+{
+    std::filesystem::path FilePath;
+    std::string EntryPoint;
+    std::string Profile;        // "vs_5_0", "ps_5_0", ...
+    std::vector<std::pair<std::string, std::string>> Defines;
+    uint32 Flags = 0;           // D3DCOMPILE_* 플래그
+};
+
+/** 컴파일에 사용된 소스 파일 하나. 첫 번째는 항상 메인 파일 */
+struct FShaderSourceFile
+{
+    std::filesystem::path Path;
+    std::string Text;
+
+    // 이 파일의 #include 이름 → Sources 배열의 인덱스. 찾지 못한 파일은 INDEX_NONE
+    TArray<std::pair<std::string, int32>> Includes;
+};
+
+/**
+ * 실제 셰이더 컴파일러
+ *
+ * Sources에 읽어 둔 내용으로만 컴파일해야 합니다. (파일을 다시 읽으면 캐시 키와 결과가 어긋날 수 있음)
+ * 여러 Worker 스레드에서 동시에 호출됩니다.
+ */
+class IShaderCompilerBackend
+{
+public:
+    virtual ~IShaderCompilerBackend() = default;
+
+    /** 컴파일러가 바뀌면 캐시를 버리도록 키에 들어가는 이름 */
+    virtual const char* GetName() const = 0;
+
+    virtual bool Compile(const FShaderCompileRequest& Request, const TArray<FShaderSourceFile>& Sources, TArray<uint8>& OutBytecode, std::string& OutError) = 0;
+};
+
+/**
+ * 컴파일된 셰이더 바이트코드를 키(소스 내용의 해시)별 파일로 저장합니다.
+ *
+ * 파일 하나에 바이트코드 하나이고, 임시 파일에 쓴 뒤 이름을 바꾸므로 여러 스레드에서 동시에 읽고 써도 됩니다.
+ */
+class FShaderBinaryCache
+{
+public:
+    explicit FShaderBinaryCache(std::filesystem::path InDirectory);
+
+    bool Load(uint64 Key, TArray<uint8>& OutBytecode) const;
+    bool Store(uint64 Key, const TArray<uint8>& Bytecode);
+
+    std::filesystem::path GetFilePath(uint64 Key) const;
+    const std::filesystem::path& GetDirectory() const { return Directory; }
+
+private:
+    std::filesystem::path Directory;
+    std::atomic<uint32> NextTempIndex = 0;
+};
+
+struct FShaderCompileResult
+{
+    uint64 Key = 0;
+    bool bCacheHit = false;
+    double ElapsedMs = 0.0;
+
+    TArray<uint8> Bytecode;
+    std::string Error;
+
+    // 메인 파일과 include된 모든 파일. 변경 감시에 사용
+    TArray<std::filesystem::path> SourceFiles;
+};
+
+namespace ShaderCache
+{
+    /** 캐시 파일 형식이나 키 계산이 바뀌면 올려서 이전 캐시를 무효화 */
+    constexpr uint32 Version = 1;
+
+    /**
+     * 메인 파일부터 #include를 따라가며 모든 소스를 읽습니다.
+     * include는 그 파일의 디렉터리, ShaderRoot 순서로 찾습니다. 같은 파일은 한 번만 읽습니다.
+     * @return 메인 파일을 읽지 못하면 false
+     */
+    bool CollectSources(const std::filesystem::path& MainFile, const std::filesystem::path& ShaderRoot, TArray<FShaderSourceFile>& OutSources);
+
+    /** 소스 내용, include 경로, Define, 진입점, 프로필, 플래그, 컴파일러 이름으로 캐시 키를 만듭니다. */
+    uint64 ComputeKey(const FShaderCompileRequest& Request, const TArray<FShaderSourceFile>& Sources, const char* CompilerName);
+
+    /**
+     * 소스를 읽어 키를 만들고, 캐시에 있으면 불러오고 없으면 컴파일해서 캐시에 저장합니다.
+     * Worker 스레드에서 호출해도 됩니다.
+     */
+    bool CompileWithCache(
+        const FShaderCompileRequest& Request, const std::filesystem::path& ShaderRoot,
+        FShaderBinaryCache& Cache, IShaderCompilerBackend& Compiler, FShaderCompileResult& OutResult
+    );
+}
+
+/**
+ * 소스 파일 → 그 파일을 사용하는 셰이더 키
+ *
+ * 파일 경로는 lexically_normal한 generic 문자열로 비교합니다.
+ */
+class FShaderDependencyGraph
+{
+public:
+    static std::wstring MakeFileKey(const std::filesystem::path& FilePath);
+
+    /** ShaderKey가 사용하는 파일 목록을 바꿉니다. 이전 목록에서 빠진 파일의 연결은 지웁니다. */
+    void SetDependencies(const std::wstring& ShaderKey, const TArray<std::filesystem::path>& Files);
+    void RemoveShader(const std::wstring& ShaderKey);
+
+    /** FilePath가 바뀌었을 때 다시 컴파일해야 하는 셰이더 키 */
+    void GetDependents(const std::filesystem::path& FilePath, TArray<std::wstring>& OutShaderKeys) const;
+
+    int32 NumFiles() const { return FileToShaders.Num(); }
+
+private:
+    TMap<std::wstring, TSet<std::wstring>> FileToShaders;
+    TMap<std::wstring, TArray<std::wstring>> ShaderToFiles;
+};
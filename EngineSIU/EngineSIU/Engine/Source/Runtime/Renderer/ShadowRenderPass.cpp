@@ -18,6 +18,8 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Rendering/Mesh/SkeletalMesh.h"
 #include "Rendering/Mesh/SkeletalMeshRenderData.h"
+#include "Math/MathBatch.h"
+#include "Rendering/Mesh/StaticMeshVertexPacking.h"
 
 class UEditorEngine;
 class UStaticMeshComponent;
@@ -52,6 +54,7 @@ void FShadowRenderPass::PrepareRenderState()
 {
     // Shader Hot Reload 대응 
     StaticMeshIL = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    PackedStaticMeshIL = ShaderManager->GetInputLayoutByKey(L"PACKED_StaticMeshVertexShader");
     DepthOnlyVS = ShaderManager->GetVertexShaderByKey(L"DepthOnlyVS");
     DepthOnlyPS = ShaderManager->GetPixelShaderByKey(L"DepthOnlyPS");
     
@@ -70,6 +73,7 @@ void FShadowRenderPass::PrepareRenderState()
 void FShadowRenderPass::PrepareCSMRenderState()
 {
     StaticMeshIL = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    PackedStaticMeshIL = ShaderManager->GetInputLayoutByKey(L"PACKED_StaticMeshVertexShader");
     CascadedShadowMapVS = ShaderManager->GetVertexShaderByKey(L"CascadedShadowMapVS");
     CascadedShadowMapPS = ShaderManager->GetPixelShaderByKey(L"CascadedShadowMapPS");
 
@@ -92,6 +96,8 @@ void FShadowRenderPass::PrepareRenderArr(const std::shared_ptr<FViewportClient>&
     if (Viewport == nullptr || Viewport->GetWorld() == nullptr)
         return;
 
+    LODViewportIndex = Viewport->GetViewportIndex();
+
     for (const auto iter : TObjectRange<UStaticMeshComponent>())
     {
         if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == Viewport->GetWorld())
@@ -153,6 +159,13 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
             CascadeData.ViewProj[i] = ShadowManager->GetCascadeViewProjMatrix(i);
         }
 
+        // 캐스케이드를 지오메트리 셰이더로 한 번에 그리므로 어느 캐스케이드에든 걸치면 그림
+        ClusterCullView.ViewProjections.Empty();
+        for (uint32 i = 0; i < NumCascades; i++)
+        {
+            ClusterCullView.ViewProjections.Add(CascadeData.ViewProj[i]);
+        }
+
         ShadowManager->BeginDirectionalShadowCascadePass(0);
         //RenderAllStaticMeshes(Viewport);
 
@@ -174,6 +187,9 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
 
         BufferManager->UpdateConstantBuffer(TEXT("FShadowConstantBuffer"), ShadowData);
 
+        ClusterCullView.ViewProjections.Empty();
+        ClusterCullView.ViewProjections.Add(ShadowData.ShadowViewProj);
+
         ShadowManager->BeginSpotShadowPass(i);
         RenderAllStaticMeshes();
         RenderAllSkeletalMeshes();
@@ -186,6 +202,13 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
     for (int i = 0 ; i < PointLights.Num(); i++)
     {
         
+        // 큐브맵의 여섯 면
+        ClusterCullView.ViewProjections.Empty();
+        for (uint32 Face = 0; Face < 6; ++Face)
+        {
+            ClusterCullView.ViewProjections.Add(PointLights[i]->GetViewMatrix(Face) * PointLights[i]->GetProjectionMatrix());
+        }
+
         ShadowManager->BeginPointShadowPass(i);
         RenderAllStaticMeshesForPointLight(PointLights[i]);
         RenderAllSkeletalMeshesForPointLight(PointLights[i]);
@@ -210,27 +233,51 @@ void FShadowRenderPass::SetLightData(const TArray<class UPointLightComponent*>&
 }
 
 void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FMaterialSlot*> Materials, TArray<UMaterial*> OverrideMaterials,
-                                        int SelectedSubMeshIndex)
+                                        int SelectedSubMeshIndex, int32 LODIndex, const TArray<FClusterDrawRange>* ClusterRanges)
 {
-    UINT Stride = sizeof(FStaticMeshVertex);
+    UINT Stride = FStaticMeshVertexPacking::GetStride(RenderData->VertexFormat);
     UINT Offset = 0;
-    
+
+    Graphics->DeviceContext->IASetInputLayout(RenderData->VertexFormat == EStaticMeshVertexFormat::Packed ? PackedStaticMeshIL : StaticMeshIL);
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &Offset);
 
-    if (RenderData->IndexBuffer)
+    LODIndex = FMath::Clamp(LODIndex, 0, RenderData->GetNumLODs() - 1);
+    if (ID3D11Buffer* IndexBuffer = RenderData->GetIndexBuffer(LODIndex))
     {
-        Graphics->DeviceContext->IASetIndexBuffer(RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
     }
 
-    if (RenderData->MaterialSubsets.Num() == 0)
+    const TArray<FMaterialSubset>& MaterialSubsets = RenderData->GetMaterialSubsets(LODIndex);
+    if (MaterialSubsets.Num() == 0)
     {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        if (ClusterRanges)
+        {
+            for (const FClusterDrawRange& Range : *ClusterRanges)
+            {
+                Graphics->DeviceContext->DrawIndexed(Range.IndexCount, Range.IndexStart, 0);
+            }
+            return;
+        }
+        Graphics->DeviceContext->DrawIndexed(RenderData->GetNumIndices(LODIndex), 0, 0);
         return;
     }
 
-    for (int SubMeshIndex = 0; SubMeshIndex < RenderData->MaterialSubsets.Num(); SubMeshIndex++)
+    int32 RangeIndex = 0;
+    for (int SubMeshIndex = 0; SubMeshIndex < MaterialSubsets.Num(); SubMeshIndex++)
     {
-        uint32 MaterialIndex = RenderData->MaterialSubsets[SubMeshIndex].MaterialIndex;
+        if (ClusterRanges)
+        {
+            while (RangeIndex < ClusterRanges->Num() && (*ClusterRanges)[RangeIndex].SubsetIndex < static_cast<uint32>(SubMeshIndex))
+            {
+                ++RangeIndex;
+            }
+            if (RangeIndex == ClusterRanges->Num() || (*ClusterRanges)[RangeIndex].SubsetIndex != static_cast<uint32>(SubMeshIndex))
+            {
+                continue;
+            }
+        }
+
+        uint32 MaterialIndex = MaterialSubsets[SubMeshIndex].MaterialIndex;
 
         FSubMeshConstants SubMeshData = (SubMeshIndex == SelectedSubMeshIndex) ? FSubMeshConstants(true) : FSubMeshConstants(false);
 
@@ -245,8 +292,17 @@ void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const
             MaterialUtils::UpdateMaterial(BufferManager, Graphics, Materials[MaterialIndex]->Material->GetMaterialInfo());
         }
 
-        uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
-        uint32 IndexCount = RenderData->MaterialSubsets[SubMeshIndex].IndexCount;
+        if (ClusterRanges)
+        {
+            for (; RangeIndex < ClusterRanges->Num() && (*ClusterRanges)[RangeIndex].SubsetIndex == static_cast<uint32>(SubMeshIndex); ++RangeIndex)
+            {
+                Graphics->DeviceContext->DrawIndexed((*ClusterRanges)[RangeIndex].IndexCount, (*ClusterRanges)[RangeIndex].IndexStart, 0);
+            }
+            continue;
+        }
+
+        uint32 StartIndex = MaterialSubsets[SubMeshIndex].IndexStart;
+        uint32 IndexCount = MaterialSubsets[SubMeshIndex].IndexCount;
         Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
     }
 }
@@ -257,6 +313,7 @@ void FShadowRenderPass::RenderPrimitive(FSkeletalMeshRenderData* RenderData, con
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
 
+    Graphics->DeviceContext->IASetInputLayout(StaticMeshIL);
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &Offset);
 
     if (RenderData->IndexBuffer)
@@ -314,9 +371,16 @@ void FShadowRenderPass::RenderAllStaticMeshes()
         FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
         const bool bIsSelected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
 
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+        const int32 LODIndex = FMath::Clamp(Comp->GetLODIndex(LODViewportIndex), 0, RenderData->GetNumLODs() - 1);
+        const TArray<FClusterDrawRange>* ClusterRanges = CullClusters(*RenderData, WorldMatrix, LODIndex);
+        if (ClusterRanges && ClusterRanges->Num() == 0)
+        {
+            continue;
+        }
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected, FStaticMeshVertexPacking::GetPositionMatrix(*RenderData));
+
+        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex(), LODIndex, ClusterRanges);
         
     }
 }
@@ -337,13 +401,35 @@ void FShadowRenderPass::RenderAllStaticMeshesForCSM(FCascadeConstantBuffer FCasC
         }
 
         FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FCasCadeData.World = WorldMatrix;
+
+        const int32 LODIndex = FMath::Clamp(Comp->GetLODIndex(LODViewportIndex), 0, RenderData->GetNumLODs() - 1);
+        const TArray<FClusterDrawRange>* ClusterRanges = CullClusters(*RenderData, WorldMatrix, LODIndex);
+        if (ClusterRanges && ClusterRanges->Num() == 0)
+        {
+            continue;
+        }
+
+        FCasCadeData.World = FStaticMeshVertexPacking::GetPositionMatrix(*RenderData) * WorldMatrix;
         BufferManager->UpdateConstantBuffer(TEXT("FCascadeConstantBuffer"), FCasCadeData);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex(), LODIndex, ClusterRanges);
     }
 }
 
+const TArray<FClusterDrawRange>* FShadowRenderPass::CullClusters(const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, int32 LODIndex)
+{
+    if (LODIndex != 0 || !FMeshCluster::bCullingEnabled)
+    {
+        return nullptr;
+    }
+
+    if (!FMeshCluster::CullClusters(RenderData, WorldMatrix, ClusterCullView, ClusterDrawRanges, &FMeshCluster::ShadowViewStats))
+    {
+        return nullptr;
+    }
+    return &ClusterDrawRanges;
+}
+
 void FShadowRenderPass::BindResourcesForSampling()
 {
     ShadowManager->BindResourcesForSampling(static_cast<UINT>(EShaderSRVSlot::SRV_SpotLight),
@@ -351,11 +437,13 @@ void FShadowRenderPass::BindResourcesForSampling()
     10);
 }
 
-void FShadowRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
+void FShadowRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected, const FMatrix& PositionMatrix) const
 {
     FObjectConstantBuffer ObjectData = {};
-    ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.WorldMatrix = PositionMatrix * WorldMatrix;
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
@@ -378,9 +466,16 @@ void FShadowRenderPass::RenderAllStaticMeshesForPointLight(UPointLightComponent*
 
         FMatrix WorldMatrix = Comp->GetWorldMatrix();
 
-        UpdateCubeMapConstantBuffer(PointLight, WorldMatrix);
+        const int32 LODIndex = FMath::Clamp(Comp->GetLODIndex(LODViewportIndex), 0, RenderData->GetNumLODs() - 1);
+        const TArray<FClusterDrawRange>* ClusterRanges = CullClusters(*RenderData, WorldMatrix, LODIndex);
+        if (ClusterRanges && ClusterRanges->Num() == 0)
+        {
+            continue;
+        }
+
+        UpdateCubeMapConstantBuffer(PointLight, FStaticMeshVertexPacking::GetPositionMatrix(*RenderData) * WorldMatrix);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex(), LODIndex, ClusterRanges);
     }
 }
 
@@ -499,6 +594,7 @@ void FShadowRenderPass::CreateShader()
 
 
     StaticMeshIL = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    PackedStaticMeshIL = ShaderManager->GetInputLayoutByKey(L"PACKED_StaticMeshVertexShader");
     DepthOnlyVS = ShaderManager->GetVertexShaderByKey(L"DepthOnlyVS");
     DepthOnlyPS = ShaderManager->GetPixelShaderByKey(L"DepthOnlyPS");
 
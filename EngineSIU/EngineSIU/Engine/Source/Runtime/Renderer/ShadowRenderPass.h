@@ -3,6 +3,8 @@
 #include "Define.h"
 #include <d3d11.h>
 
+#include "Rendering/Mesh/MeshCluster.h"
+
 #include "Components/Light/PointLightComponent.h"
 
 
@@ -38,7 +40,10 @@ public:
     virtual void Render(const std::shared_ptr<FViewportClient>& Viewport) override;    
     virtual void ClearRenderArr() override;
 
-    void RenderPrimitive(FStaticMeshRenderData* render_data, const TArray<FMaterialSlot*> array, TArray<UMaterial*> materials, int getselected_sub_mesh_index);
+    void RenderPrimitive(
+        FStaticMeshRenderData* render_data, const TArray<FMaterialSlot*> array, TArray<UMaterial*> materials, int getselected_sub_mesh_index, int32 LODIndex = 0,
+        const TArray<FClusterDrawRange>* ClusterRanges = nullptr
+    );
     void RenderPrimitive(struct FSkeletalMeshRenderData* render_data, const TArray<FMaterialSlot*> array, TArray<UMaterial*> materials, int getselected_sub_mesh_index);
 
 
@@ -52,7 +57,7 @@ public:
 
     void BindResourcesForSampling();
 
-    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
+    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected, const FMatrix& PositionMatrix = FMatrix::Identity) const;
 
 
 
@@ -61,6 +66,17 @@ private:
     
     TArray<class UStaticMeshComponent*> StaticMeshComponents;
     TArray<class USkeletalMeshComponent*> SkeletalMeshComponents;
+
+    // 카메라 기준으로 고른 LOD를 그림자에도 씀 (UStaticMeshComponent::GetLODIndex)
+    uint32 LODViewportIndex = 0;
+
+    /** 지금 그리는 라이트의 ClusterCullView로 LOD0 클러스터를 컬링합니다. 클러스터를 쓰지 않으면 nullptr */
+    const TArray<FClusterDrawRange>* CullClusters(const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, int32 LODIndex);
+
+    // Render에서 라이트마다 채움. CSM은 캐스케이드, 점광원은 큐브맵 면마다 행렬 하나
+    FClusterCullView ClusterCullView;
+    TArray<FClusterDrawRange> ClusterDrawRanges;
+
     TArray<UPointLightComponent*> PointLights;
     TArray<USpotLightComponent*> SpotLights;
     
@@ -70,6 +86,7 @@ private:
     FShadowManager* ShadowManager;
 
     ID3D11InputLayout* StaticMeshIL;
+    ID3D11InputLayout* PackedStaticMeshIL;     // 깊이 셰이더는 위치만 읽으므로 입력 레이아웃만 바꿈
     ID3D11VertexShader* DepthOnlyVS;
     ID3D11PixelShader* DepthOnlyPS;
     ID3D11SamplerState* Sampler;
@@ -11,6 +11,7 @@
 #include "Engine/EditorEngine.h"
 #include "ShowFlag.h"
 #include "Rendering/Mesh/SkeletalMeshRenderData.h"
+#include "Math/MathBatch.h"
 #include "Editor/LevelEditor/SLevelEditor.h"
 #include "Editor/UnrealEd/EditorViewportClient.h"
 
@@ -84,23 +85,18 @@ void FSkeletalRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FViewpor
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Bone))
         {
-            const float BoneSphereRadius = 10.0f;
             const FVector4 BoneDebugColor = FVector4(0.8f, 0.8f, 0.0f, 1.0f);
 
             const int32 BoneCount = RenderData->BoneNames.Num();
 
+            // 본 전체의 자리를 한 번에 받아서 바로 채움
+            FDebugBoneRecord* BoneRecords = FEngineLoop::PrimitiveDrawBatch.ReservePrimitives<FDebugBoneRecord>(BoneCount);
             for (int32 BoneIdx = 0; BoneIdx < BoneCount; ++BoneIdx)
             {
                 const FMatrix& BoneMeshSpaceTransform = RenderData->ReferencePose[BoneIdx];
-                FVector BoneJointPos_LocalSpace = BoneMeshSpaceTransform.GetTranslationVector(); 
-                FVector BoneJointPos_WorldSpace = WorldMatrix.TransformPosition(BoneJointPos_LocalSpace);
-
-                FEngineLoop::PrimitiveDrawBatch.AddJointSphereToBatch(
-                    BoneJointPos_WorldSpace,
-                    BoneSphereRadius,
-                    BoneDebugColor,
-                    WorldMatrix
-                );
+                FVector BoneJointPos_LocalSpace = BoneMeshSpaceTransform.GetTranslationVector();
+                BoneRecords[BoneIdx].Bone.Center = WorldMatrix.TransformPosition(BoneJointPos_LocalSpace);
+                BoneRecords[BoneIdx].Bone.Color = BoneDebugColor;
             }
         }
     }
@@ -244,7 +240,9 @@ void FSkeletalRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
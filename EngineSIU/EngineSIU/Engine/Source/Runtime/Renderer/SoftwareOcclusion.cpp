@@ -0,0 +1,674 @@
+#include "SoftwareOcclusion.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <immintrin.h>
+
+#include "ViewportClient.h"
+#include "Async/ParallelFor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Math/MathUtility.h"
+#include "Rendering/Mesh/StaticMesh.h"
+#include "Rendering/Mesh/StaticMeshLOD.h"
+#include "WindowsPlatformTime.h"
+
+bool FSoftwareOcclusionCulling::bEnabled = true;
+FOcclusionCullStats FSoftwareOcclusionCulling::TotalStats;
+
+void FOcclusionCullStats::Accumulate(const FOcclusionCullStats& Other)
+{
+    NumViews += Other.NumViews;
+    NumObjects += Other.NumObjects;
+    NumOccluded += Other.NumOccluded;
+    NumOutsideView += Other.NumOutsideView;
+    NumOccluders += Other.NumOccluders;
+    NumOccluderTriangles += Other.NumOccluderTriangles;
+    RasterizeMs += Other.RasterizeMs;
+    TestMs += Other.TestMs;
+}
+
+namespace
+{
+    // 가림막이 덮지 않은 픽셀. 어떤 깊이보다도 멀어서 그 픽셀에 걸친 물체는 가려지지 않음
+    constexpr float EmptyDepth = FLT_MAX;
+
+    // 상자 검사에서 한 축으로 읽는 HiZ 텍셀 수의 상한
+    constexpr int32 MaxTestTexels = 4;
+
+    FORCEINLINE void TransformToClip(const FMatrix& M, const FStaticMeshVertex& Vertex, float (&OutClip)[4])
+    {
+        __m128 Result = _mm_mul_ps(_mm_set1_ps(Vertex.X), _mm_loadu_ps(M.M[0]));
+        Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Vertex.Y), _mm_loadu_ps(M.M[1])));
+        Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Vertex.Z), _mm_loadu_ps(M.M[2])));
+        Result = _mm_add_ps(Result, _mm_loadu_ps(M.M[3]));
+        _mm_storeu_ps(OutClip, Result);
+    }
+
+    // 클립 공간 z >= 0 (D3D의 근평면) 쪽만 남김. 삼각형을 평면 하나로 자르면 꼭짓점은 최대 4개
+    int32 ClipNearPlane(const float (&In)[3][4], float (&Out)[4][4])
+    {
+        int32 NumOut = 0;
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            const float* A = In[Index];
+            const float* B = In[(Index + 1) % 3];
+            const bool bAInside = A[2] >= 0.0f;
+            const bool bBInside = B[2] >= 0.0f;
+
+            if (bAInside)
+            {
+                std::copy_n(A, 4, Out[NumOut++]);
+            }
+            if (bAInside != bBInside)
+            {
+                const float T = A[2] / (A[2] - B[2]);
+                for (int32 Component = 0; Component < 4; ++Component)
+                {
+                    Out[NumOut][Component] = A[Component] + (B[Component] - A[Component]) * T;
+                }
+                Out[NumOut][2] = 0.0f;
+                ++NumOut;
+            }
+        }
+        return NumOut;
+    }
+
+    FORCEINLINE float HorizontalMin(__m128 Value)
+    {
+        Value = _mm_min_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 3, 0, 1)));
+        Value = _mm_min_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_cvtss_f32(Value);
+    }
+
+    FORCEINLINE float HorizontalMax(__m128 Value)
+    {
+        Value = _mm_max_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 3, 0, 1)));
+        Value = _mm_max_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_cvtss_f32(Value);
+    }
+}
+
+void FOcclusionBuffer::Begin(const FMatrix& InViewProjection, int32 InWidth, int32 InHeight)
+{
+    ViewProjection = InViewProjection;
+    Width = FMath::Max((InWidth + 3) & ~3, 4);
+    Height = FMath::Max((InHeight + 3) & ~3, 4);
+
+    LocalToClipMatrices.Empty();
+    Ranges.Empty();
+    NumTriangles = 0;
+    NumRasterizedTriangles = 0;
+}
+
+int32 FOcclusionBuffer::AddOccluder(const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, const TArray<FClusterDrawRange>* InRanges, int32 MaxTriangles)
+{
+    if (MaxTriangles <= 0 || RenderData.Vertices.Num() == 0)
+    {
+        return 0;
+    }
+
+    const int32 MatrixIndex = LocalToClipMatrices.Num();
+    LocalToClipMatrices.Add(WorldMatrix * ViewProjection);
+
+    int32 NumAdded = 0;
+    auto AddRange = [&](uint32 IndexStart, uint32 IndexCount)
+    {
+        const int32 Count = FMath::Min(static_cast<int32>(IndexCount / 3), MaxTriangles - NumAdded);
+        if (Count <= 0 || IndexStart + IndexCount > static_cast<uint32>(RenderData.Indices.Num()))
+        {
+            return;
+        }
+
+        FOccluderRange Range;
+        Range.RenderData = &RenderData;
+        Range.MatrixIndex = MatrixIndex;
+        Range.IndexStart = IndexStart;
+        Range.FirstTriangle = NumTriangles;
+        Range.NumTriangles = Count;
+        Ranges.Add(Range);
+
+        NumTriangles += Count;
+        NumAdded += Count;
+    };
+
+    if (InRanges)
+    {
+        for (const FClusterDrawRange& Range : *InRanges)
+        {
+            AddRange(Range.IndexStart, Range.IndexCount);
+        }
+    }
+    else
+    {
+        AddRange(0, RenderData.Indices.Num());
+    }
+    return NumAdded;
+}
+
+void FOcclusionBuffer::Finish()
+{
+    // 깊이 버퍼와 밉 크기. 올림으로 줄여 마지막 행 / 열도 위 레벨에 들어가게 함
+    int32 NumLevels = 1;
+    while (GetLevelWidth(NumLevels - 1) > 1 || GetLevelHeight(NumLevels - 1) > 1)
+    {
+        ++NumLevels;
+    }
+    HiZ.SetNum(NumLevels);
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        HiZ[Level].SetNum(GetLevelWidth(Level) * GetLevelHeight(Level));
+    }
+    std::fill(HiZ[0].begin(), HiZ[0].end(), EmptyDepth);
+
+    // 변환과 삼각형 설정. 범위 안의 삼각형 번호로 슬롯이 정해지므로 스레드끼리 겹치지 않음
+    ScreenTriangles.SetNum(NumTriangles * 2);
+    ParallelForRange(
+        NumTriangles,
+        [this](int32 Begin, int32 End)
+        {
+            int32 RangeIndex = static_cast<int32>(std::upper_bound(
+                Ranges.begin(), Ranges.end(), Begin, [](int32 Triangle, const FOccluderRange& Range) { return Triangle < Range.FirstTriangle; }
+            ) - Ranges.begin()) - 1;
+
+            for (int32 Triangle = Begin; Triangle < End; ++Triangle)
+            {
+                while (Triangle >= Ranges[RangeIndex].FirstTriangle + Ranges[RangeIndex].NumTriangles)
+                {
+                    ++RangeIndex;
+                }
+
+                const FOccluderRange& Range = Ranges[RangeIndex];
+                const FMatrix& LocalToClip = LocalToClipMatrices[Range.MatrixIndex];
+                const TArray<FStaticMeshVertex>& Vertices = Range.RenderData->Vertices;
+                const UINT* Indices = Range.RenderData->Indices.GetData() + Range.IndexStart + (Triangle - Range.FirstTriangle) * 3;
+
+                FScreenTriangle* Slots = &ScreenTriangles[Triangle * 2];
+                Slots[0].MinX = Slots[1].MinX = 0;
+                Slots[0].MaxX = Slots[1].MaxX = -1;
+
+                if (Indices[0] >= static_cast<UINT>(Vertices.Num()) || Indices[1] >= static_cast<UINT>(Vertices.Num()) || Indices[2] >= static_cast<UINT>(Vertices.Num()))
+                {
+                    continue;
+                }
+
+                float Clip[3][4];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    TransformToClip(LocalToClip, Vertices[Indices[Corner]], Clip[Corner]);
+                }
+                SetupTriangle(Clip, Slots);
+            }
+        },
+        256
+    );
+
+    // 밴드별로 겹치는 화면 삼각형을 모음. 한 밴드 안에서는 원래 순서
+    const int32 NumBands = (Height + BandHeight - 1) / BandHeight;
+    BandOffsets.Init(0, NumBands + 1);
+    NumRasterizedTriangles = 0;
+    for (const FScreenTriangle& Triangle : ScreenTriangles)
+    {
+        if (Triangle.MaxX < Triangle.MinX)
+        {
+            continue;
+        }
+        ++NumRasterizedTriangles;
+        for (int32 Band = Triangle.MinY / BandHeight; Band <= Triangle.MaxY / BandHeight; ++Band)
+        {
+            ++BandOffsets[Band + 1];
+        }
+    }
+    for (int32 Band = 0; Band < NumBands; ++Band)
+    {
+        BandOffsets[Band + 1] += BandOffsets[Band];
+    }
+
+    BandTriangles.SetNum(BandOffsets[NumBands]);
+    TArray<int32> BandCursors;
+    BandCursors.Init(0, NumBands);
+    for (int32 Slot = 0; Slot < ScreenTriangles.Num(); ++Slot)
+    {
+        const FScreenTriangle& Triangle = ScreenTriangles[Slot];
+        if (Triangle.MaxX < Triangle.MinX)
+        {
+            continue;
+        }
+        for (int32 Band = Triangle.MinY / BandHeight; Band <= Triangle.MaxY / BandHeight; ++Band)
+        {
+            BandTriangles[BandOffsets[Band] + BandCursors[Band]++] = Slot;
+        }
+    }
+
+    ParallelFor(NumBands, [this](int32 BandIndex) { RasterizeBand(BandIndex); });
+
+    BuildHiZ();
+}
+
+void FOcclusionBuffer::SetupTriangle(const float (&Clip)[3][4], FScreenTriangle* OutTriangles) const
+{
+    // 한 절두체 평면의 바깥에 모두 있으면 버림
+    const auto AllOutside = [&Clip](auto&& IsOutside)
+    {
+        return IsOutside(Clip[0]) && IsOutside(Clip[1]) && IsOutside(Clip[2]);
+    };
+    if (AllOutside([](const float* V) { return V[0] > V[3]; }) || AllOutside([](const float* V) { return V[0] < -V[3]; })
+        || AllOutside([](const float* V) { return V[1] > V[3]; }) || AllOutside([](const float* V) { return V[1] < -V[3]; })
+        || AllOutside([](const float* V) { return V[2] < 0.0f; }))
+    {
+        return;
+    }
+
+    // 깊이 클리핑을 끈 래스터라이저는 원평면 너머를 깊이 1로 고정해 그리므로, 원평면에 걸친 삼각형은 가림막으로 쓰지 않음
+    if (Clip[0][2] > Clip[0][3] || Clip[1][2] > Clip[1][3] || Clip[2][2] > Clip[2][3])
+    {
+        return;
+    }
+
+    float Polygon[4][4];
+    const int32 NumVertices = ClipNearPlane(Clip, Polygon);
+    if (NumVertices < 3)
+    {
+        return;
+    }
+
+    double ScreenX[4];
+    double ScreenY[4];
+    double Depth[4];
+    for (int32 Index = 0; Index < NumVertices; ++Index)
+    {
+        const double W = Polygon[Index][3];
+        if (W <= 1e-6)
+        {
+            return;
+        }
+        ScreenX[Index] = (Polygon[Index][0] / W * 0.5 + 0.5) * Width;
+        ScreenY[Index] = (0.5 - Polygon[Index][1] / W * 0.5) * Height;
+        Depth[Index] = Polygon[Index][2] / W;
+    }
+
+    // 잘린 다각형을 부채꼴로 나눔
+    for (int32 Fan = 1; Fan + 1 < NumVertices; ++Fan)
+    {
+        const int32 I0 = 0;
+        const int32 I1 = Fan;
+        const int32 I2 = Fan + 1;
+
+        // 화면(y 아래)에서 시계 방향이 앞면이고 이때 Area > 0
+        const double Area = (ScreenX[I1] - ScreenX[I0]) * (ScreenY[I2] - ScreenY[I0]) - (ScreenX[I2] - ScreenX[I0]) * (ScreenY[I1] - ScreenY[I0]);
+        if (!(Area > 0.0))
+        {
+            continue;
+        }
+
+        // 중심이 삼각형의 바운드 안에 있는 픽셀
+        const double BoundMinX = std::min({ ScreenX[I0], ScreenX[I1], ScreenX[I2] });
+        const double BoundMaxX = std::max({ ScreenX[I0], ScreenX[I1], ScreenX[I2] });
+        const double BoundMinY = std::min({ ScreenY[I0], ScreenY[I1], ScreenY[I2] });
+        const double BoundMaxY = std::max({ ScreenY[I0], ScreenY[I1], ScreenY[I2] });
+
+        FScreenTriangle& Triangle = OutTriangles[Fan - 1];
+        Triangle.MinX = static_cast<int32>(std::ceil(std::clamp(BoundMinX - 0.5, -1.0, static_cast<double>(Width))));
+        Triangle.MaxX = static_cast<int32>(std::floor(std::clamp(BoundMaxX - 0.5, -1.0, static_cast<double>(Width))));
+        Triangle.MinY = static_cast<int32>(std::ceil(std::clamp(BoundMinY - 0.5, -1.0, static_cast<double>(Height))));
+        Triangle.MaxY = static_cast<int32>(std::floor(std::clamp(BoundMaxY - 0.5, -1.0, static_cast<double>(Height))));
+        Triangle.MinX = FMath::Max(Triangle.MinX, 0);
+        Triangle.MinY = FMath::Max(Triangle.MinY, 0);
+        Triangle.MaxX = FMath::Min(Triangle.MaxX, Width - 1);
+        Triangle.MaxY = FMath::Min(Triangle.MaxY, Height - 1);
+        if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+        {
+            Triangle.MinX = 0;
+            Triangle.MaxX = -1;
+            continue;
+        }
+
+        // 시작 픽셀 중심에서의 edge 함수. 큰 좌표에서도 정확하도록 double로 구한 뒤 float로 저장
+        const double StartX = Triangle.MinX + 0.5;
+        const double StartY = Triangle.MinY + 0.5;
+        const int32 EdgeIndices[3][2] = { { I0, I1 }, { I1, I2 }, { I2, I0 } };
+        for (int32 Edge = 0; Edge < 3; ++Edge)
+        {
+            const int32 From = EdgeIndices[Edge][0];
+            const int32 To = EdgeIndices[Edge][1];
+            const double A = -(ScreenY[To] - ScreenY[From]);
+            const double B = ScreenX[To] - ScreenX[From];
+            Triangle.EdgeA[Edge] = static_cast<float>(A);
+            Triangle.EdgeB[Edge] = static_cast<float>(B);
+            Triangle.Edge0[Edge] = static_cast<float>(A * (StartX - ScreenX[From]) + B * (StartY - ScreenY[From]));
+        }
+
+        // 깊이는 화면 공간에서 선형. 픽셀 안에서 가질 수 있는 가장 먼 깊이를 쓰도록 기울기의 반 픽셀만큼 더함
+        const double DepthDx = ((Depth[I1] - Depth[I0]) * (ScreenY[I2] - ScreenY[I0]) - (Depth[I2] - Depth[I0]) * (ScreenY[I1] - ScreenY[I0])) / Area;
+        const double DepthDy = ((ScreenX[I1] - ScreenX[I0]) * (Depth[I2] - Depth[I0]) - (ScreenX[I2] - ScreenX[I0]) * (Depth[I1] - Depth[I0])) / Area;
+        Triangle.DepthDx = static_cast<float>(DepthDx);
+        Triangle.DepthDy = static_cast<float>(DepthDy);
+        Triangle.Depth0 = static_cast<float>(
+            Depth[I0] + DepthDx * (StartX - ScreenX[I0]) + DepthDy * (StartY - ScreenY[I0]) + 0.5 * (std::abs(DepthDx) + std::abs(DepthDy))
+        );
+    }
+}
+
+void FOcclusionBuffer::RasterizeBand(int32 BandIndex)
+{
+    const int32 BandMinY = BandIndex * BandHeight;
+    const int32 BandMaxY = FMath::Min(BandMinY + BandHeight, Height) - 1;
+    float* DepthBuffer = HiZ[0].GetData();
+
+    const __m128 PixelOffsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 Zero = _mm_setzero_ps();
+
+    for (int32 Slot = BandOffsets[BandIndex]; Slot < BandOffsets[BandIndex + 1]; ++Slot)
+    {
+        const FScreenTriangle& Triangle = ScreenTriangles[BandTriangles[Slot]];
+        const int32 MinY = FMath::Max(Triangle.MinY, BandMinY);
+        const int32 MaxY = FMath::Min(Triangle.MaxY, BandMaxY);
+
+        // 행은 4의 배수 폭이므로 4픽셀 정렬로 시작하면 끝까지 넘치지 않음. 바운드 밖 픽셀은 edge 함수가 걸러냄
+        const int32 StartX = Triangle.MinX & ~3;
+        const float OffsetX = static_cast<float>(StartX - Triangle.MinX);
+
+        const __m128 StepE0 = _mm_set1_ps(Triangle.EdgeA[0] * 4.0f);
+        const __m128 StepE1 = _mm_set1_ps(Triangle.EdgeA[1] * 4.0f);
+        const __m128 StepE2 = _mm_set1_ps(Triangle.EdgeA[2] * 4.0f);
+        const __m128 StepDepth = _mm_set1_ps(Triangle.DepthDx * 4.0f);
+        const __m128 OffsetE0 = _mm_mul_ps(_mm_set1_ps(Triangle.EdgeA[0]), PixelOffsets);
+        const __m128 OffsetE1 = _mm_mul_ps(_mm_set1_ps(Triangle.EdgeA[1]), PixelOffsets);
+        const __m128 OffsetE2 = _mm_mul_ps(_mm_set1_ps(Triangle.EdgeA[2]), PixelOffsets);
+        const __m128 OffsetDepth = _mm_mul_ps(_mm_set1_ps(Triangle.DepthDx), PixelOffsets);
+
+        for (int32 Y = MinY; Y <= MaxY; ++Y)
+        {
+            const float OffsetY = static_cast<float>(Y - Triangle.MinY);
+            __m128 E0 = _mm_add_ps(_mm_set1_ps(Triangle.Edge0[0] + Triangle.EdgeB[0] * OffsetY + Triangle.EdgeA[0] * OffsetX), OffsetE0);
+            __m128 E1 = _mm_add_ps(_mm_set1_ps(Triangle.Edge0[1] + Triangle.EdgeB[1] * OffsetY + Triangle.EdgeA[1] * OffsetX), OffsetE1);
+            __m128 E2 = _mm_add_ps(_mm_set1_ps(Triangle.Edge0[2] + Triangle.EdgeB[2] * OffsetY + Triangle.EdgeA[2] * OffsetX), OffsetE2);
+            __m128 Depth = _mm_add_ps(_mm_set1_ps(Triangle.Depth0 + Triangle.DepthDy * OffsetY + Triangle.DepthDx * OffsetX), OffsetDepth);
+
+            float* Row = DepthBuffer + Y * Width;
+            for (int32 X = StartX; X <= Triangle.MaxX; X += 4)
+            {
+                const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero)), _mm_cmpge_ps(E2, Zero));
+                if (_mm_movemask_ps(Inside) != 0)
+                {
+                    const __m128 Old = _mm_loadu_ps(Row + X);
+                    const __m128 New = _mm_min_ps(Old, Depth);
+                    _mm_storeu_ps(Row + X, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+                }
+
+                E0 = _mm_add_ps(E0, StepE0);
+                E1 = _mm_add_ps(E1, StepE1);
+                E2 = _mm_add_ps(E2, StepE2);
+                Depth = _mm_add_ps(Depth, StepDepth);
+            }
+        }
+    }
+}
+
+void FOcclusionBuffer::BuildHiZ()
+{
+    for (int32 Level = 1; Level < HiZ.Num(); ++Level)
+    {
+        const TArray<float>& Source = HiZ[Level - 1];
+        TArray<float>& Target = HiZ[Level];
+        const int32 SourceWidth = GetLevelWidth(Level - 1);
+        const int32 SourceHeight = GetLevelHeight(Level - 1);
+        const int32 TargetWidth = GetLevelWidth(Level);
+        const int32 TargetHeight = GetLevelHeight(Level);
+
+        for (int32 Y = 0; Y < TargetHeight; ++Y)
+        {
+            const int32 Y0 = Y * 2;
+            const int32 Y1 = FMath::Min(Y0 + 1, SourceHeight - 1);
+            for (int32 X = 0; X < TargetWidth; ++X)
+            {
+                const int32 X0 = X * 2;
+                const int32 X1 = FMath::Min(X0 + 1, SourceWidth - 1);
+                Target[Y * TargetWidth + X] = FMath::Max(
+                    FMath::Max(Source[Y0 * SourceWidth + X0], Source[Y0 * SourceWidth + X1]),
+                    FMath::Max(Source[Y1 * SourceWidth + X0], Source[Y1 * SourceWidth + X1])
+                );
+            }
+        }
+    }
+}
+
+float FOcclusionBuffer::GetDepth(int32 Level, int32 X, int32 Y) const
+{
+    return HiZ[Level][Y * GetLevelWidth(Level) + X];
+}
+
+EOcclusionResult FOcclusionBuffer::TestBox(const FMatrix& WorldMatrix, const FVector& LocalMin, const FVector& LocalMax) const
+{
+    return TestBoxClip(WorldMatrix * ViewProjection, LocalMin, LocalMax);
+}
+
+EOcclusionResult FOcclusionBuffer::TestBoxClip(const FMatrix& LocalToClip, const FVector& LocalMin, const FVector& LocalMax) const
+{
+    if (HiZ.Num() == 0)
+    {
+        return EOcclusionResult::Visible;
+    }
+
+    // 꼭짓점 8개를 z가 Min / Max인 4개씩 SoA로 변환
+    const __m128 CornerX = _mm_setr_ps(LocalMin.X, LocalMax.X, LocalMin.X, LocalMax.X);
+    const __m128 CornerY = _mm_setr_ps(LocalMin.Y, LocalMin.Y, LocalMax.Y, LocalMax.Y);
+    const __m128 CornerZMin = _mm_set1_ps(LocalMin.Z);
+    const __m128 CornerZMax = _mm_set1_ps(LocalMax.Z);
+
+    __m128 ClipMin[4];
+    __m128 ClipMax[4];
+    for (int32 Component = 0; Component < 4; ++Component)
+    {
+        const __m128 Base = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(CornerX, _mm_set1_ps(LocalToClip.M[0][Component])), _mm_mul_ps(CornerY, _mm_set1_ps(LocalToClip.M[1][Component]))),
+            _mm_set1_ps(LocalToClip.M[3][Component])
+        );
+        const __m128 ZRow = _mm_set1_ps(LocalToClip.M[2][Component]);
+        ClipMin[Component] = _mm_add_ps(Base, _mm_mul_ps(CornerZMin, ZRow));
+        ClipMax[Component] = _mm_add_ps(Base, _mm_mul_ps(CornerZMax, ZRow));
+    }
+
+    // 모든 꼭짓점이 한 평면(좌우상하, 카메라 뒤)의 바깥이면 화면 밖. 동차 좌표로 비교하므로 근평면에 걸친 상자에도 맞음
+    const auto AllOutside = [](__m128 OutsideMin, __m128 OutsideMax)
+    {
+        return _mm_movemask_ps(_mm_and_ps(OutsideMin, OutsideMax)) == 0xF;
+    };
+    const __m128 Zero = _mm_setzero_ps();
+    const __m128 NegWMin = _mm_sub_ps(Zero, ClipMin[3]);
+    const __m128 NegWMax = _mm_sub_ps(Zero, ClipMax[3]);
+    if (AllOutside(_mm_cmpgt_ps(ClipMin[0], ClipMin[3]), _mm_cmpgt_ps(ClipMax[0], ClipMax[3]))
+        || AllOutside(_mm_cmplt_ps(ClipMin[0], NegWMin), _mm_cmplt_ps(ClipMax[0], NegWMax))
+        || AllOutside(_mm_cmpgt_ps(ClipMin[1], ClipMin[3]), _mm_cmpgt_ps(ClipMax[1], ClipMax[3]))
+        || AllOutside(_mm_cmplt_ps(ClipMin[1], NegWMin), _mm_cmplt_ps(ClipMax[1], NegWMax))
+        || AllOutside(_mm_cmple_ps(ClipMin[3], Zero), _mm_cmple_ps(ClipMax[3], Zero)))
+    {
+        return EOcclusionResult::OutsideView;
+    }
+
+    // 근평면 앞에 꼭짓점이 있으면 화면 사각형을 구할 수 없으므로 보이는 것으로 봄
+    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(ClipMin[2], Zero), _mm_cmplt_ps(ClipMax[2], Zero))) != 0)
+    {
+        return EOcclusionResult::Visible;
+    }
+
+    const __m128 InvWMin = _mm_div_ps(_mm_set1_ps(1.0f), ClipMin[3]);
+    const __m128 InvWMax = _mm_div_ps(_mm_set1_ps(1.0f), ClipMax[3]);
+    const __m128 NdcXMin = _mm_mul_ps(ClipMin[0], InvWMin);
+    const __m128 NdcXMax = _mm_mul_ps(ClipMax[0], InvWMax);
+    const __m128 NdcYMin = _mm_mul_ps(ClipMin[1], InvWMin);
+    const __m128 NdcYMax = _mm_mul_ps(ClipMax[1], InvWMax);
+    const __m128 DepthMin = _mm_mul_ps(ClipMin[2], InvWMin);
+    const __m128 DepthMax = _mm_mul_ps(ClipMax[2], InvWMax);
+
+    const float MinNdcX = HorizontalMin(_mm_min_ps(NdcXMin, NdcXMax));
+    const float MaxNdcX = HorizontalMax(_mm_max_ps(NdcXMin, NdcXMax));
+    const float MinNdcY = HorizontalMin(_mm_min_ps(NdcYMin, NdcYMax));
+    const float MaxNdcY = HorizontalMax(_mm_max_ps(NdcYMin, NdcYMax));
+
+    // 원평면 너머는 GPU에서 1로 고정되므로 1보다 멀게 보지 않음
+    const float NearestDepth = FMath::Min(HorizontalMin(_mm_min_ps(DepthMin, DepthMax)), 1.0f);
+
+    // 상자가 걸친 픽셀 (y는 아래로)
+    const float MaxPixelX = static_cast<float>(Width - 1);
+    const float MaxPixelY = static_cast<float>(Height - 1);
+    const int32 PixelMinX = static_cast<int32>(std::clamp((MinNdcX * 0.5f + 0.5f) * Width, 0.0f, MaxPixelX));
+    const int32 PixelMaxX = static_cast<int32>(std::clamp((MaxNdcX * 0.5f + 0.5f) * Width, 0.0f, MaxPixelX));
+    const int32 PixelMinY = static_cast<int32>(std::clamp((0.5f - MaxNdcY * 0.5f) * Height, 0.0f, MaxPixelY));
+    const int32 PixelMaxY = static_cast<int32>(std::clamp((0.5f - MinNdcY * 0.5f) * Height, 0.0f, MaxPixelY));
+
+    // 한 축으로 MaxTestTexels개 이하의 텍셀을 읽는 레벨
+    int32 Level = 0;
+    while (Level + 1 < HiZ.Num()
+        && ((PixelMaxX >> Level) - (PixelMinX >> Level) >= MaxTestTexels || (PixelMaxY >> Level) - (PixelMinY >> Level) >= MaxTestTexels))
+    {
+        ++Level;
+    }
+
+    const TArray<float>& LevelDepth = HiZ[Level];
+    const int32 LevelWidth = GetLevelWidth(Level);
+    for (int32 Y = PixelMinY >> Level; Y <= PixelMaxY >> Level; ++Y)
+    {
+        for (int32 X = PixelMinX >> Level; X <= PixelMaxX >> Level; ++X)
+        {
+            if (LevelDepth[Y * LevelWidth + X] >= NearestDepth)
+            {
+                return EOcclusionResult::Visible;
+            }
+        }
+    }
+    return EOcclusionResult::Occluded;
+}
+
+void FSoftwareOcclusionCulling::Cull(const std::shared_ptr<FViewportClient>& Viewport, const TArray<UStaticMeshComponent*>& Components)
+{
+    HiddenComponents.Empty();
+    bBufferValid = false;
+    if (!bEnabled || Viewport == nullptr)
+    {
+        return;
+    }
+
+    Objects.SetNum(Components.Num());
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        const UStaticMeshComponent* Component = Components[Index];
+        FOcclusionObject& Object = Objects[Index];
+        Object.RenderData = Component && Component->GetStaticMesh() ? Component->GetStaticMesh()->GetRenderData() : nullptr;
+        Object.WorldMatrix = Object.RenderData ? Component->GetWorldMatrix() : FMatrix::Identity;
+
+        // 메시 패스는 모든 머티리얼을 불투명하게 그리고 알파 테스트도 없으므로 모두 가림막 후보
+        Object.bOccluder = true;
+    }
+
+    FOcclusionView View;
+    View.ViewMatrix = Viewport->GetViewMatrix();
+    View.ProjectionMatrix = Viewport->GetProjectionMatrix();
+    View.ViewLocation = Viewport->GetCameraLocation();
+    View.bPerspective = Viewport->IsPerspective();
+    const D3D11_VIEWPORT& D3DViewport = Viewport->GetD3DViewport();
+    View.AspectRatio = D3DViewport.Height > 0.0f ? D3DViewport.Width / D3DViewport.Height : 1.0f;
+
+    CullObjects(View, Objects);
+
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        if (Results[Index] != EOcclusionResult::Visible)
+        {
+            HiddenComponents.Insert(Components[Index]);
+        }
+    }
+}
+
+void FSoftwareOcclusionCulling::CullObjects(const FOcclusionView& View, const TArray<FOcclusionObject>& InObjects)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FOcclusionCullStats Stats;
+    Stats.NumViews = 1;
+    Stats.NumObjects = InObjects.Num();
+    Results.Init(EOcclusionResult::Visible, InObjects.Num());
+
+    const FMatrix ViewProjection = View.ViewMatrix * View.ProjectionMatrix;
+
+    // 화면에서 큰 순서로 가림막 후보를 고름
+    OccluderCandidates.Empty();
+    for (int32 Index = 0; Index < InObjects.Num(); ++Index)
+    {
+        const FOcclusionObject& Object = InObjects[Index];
+        if (Object.RenderData == nullptr || !Object.bOccluder)
+        {
+            continue;
+        }
+
+        const FVector Scale = Object.WorldMatrix.GetScaleVector();
+        const float MaxScale = FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z)));
+        const FVector Center = Object.WorldMatrix.TransformPosition((Object.RenderData->BoundingBoxMin + Object.RenderData->BoundingBoxMax) * 0.5f);
+        const float Radius = (Object.RenderData->BoundingBoxMax - Object.RenderData->BoundingBoxMin).Length() * 0.5f * MaxScale;
+
+        const float ScreenSize = FStaticMeshLOD::ComputeScreenSize(Center, Radius, View.ViewLocation, View.ProjectionMatrix, View.bPerspective);
+        if (ScreenSize >= Settings.MinOccluderScreenSize)
+        {
+            OccluderCandidates.Add({ ScreenSize, Index });
+        }
+    }
+    std::sort(
+        OccluderCandidates.begin(), OccluderCandidates.end(),
+        [](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; }
+    );
+
+    const int32 BufferWidth = FMath::Max(Settings.Width, 4);
+    const int32 BufferHeight = FMath::Clamp(
+        static_cast<int32>(static_cast<float>(BufferWidth) / FMath::Max(View.AspectRatio, 0.01f)), 4, FMath::Max(Settings.MaxHeight, 4)
+    );
+    Buffer.Begin(ViewProjection, BufferWidth, BufferHeight);
+
+    // 클러스터가 있는 가림막은 화면 밖이거나 뒷면인 클러스터를 빼고 그림
+    FClusterCullView OccluderCullView;
+    OccluderCullView.ViewProjections.Add(ViewProjection);
+
+    int32 RemainingTriangles = Settings.MaxOccluderTriangles;
+    const int32 NumCandidates = FMath::Min(OccluderCandidates.Num(), Settings.MaxOccluders);
+    for (int32 Candidate = 0; Candidate < NumCandidates && RemainingTriangles > 0; ++Candidate)
+    {
+        const FOcclusionObject& Occluder = InObjects[OccluderCandidates[Candidate].second];
+        const bool bClustered = FMeshCluster::CullClusters(*Occluder.RenderData, Occluder.WorldMatrix, OccluderCullView, OccluderRanges);
+        const int32 NumAdded = Buffer.AddOccluder(*Occluder.RenderData, Occluder.WorldMatrix, bClustered ? &OccluderRanges : nullptr, RemainingTriangles);
+        if (NumAdded > 0)
+        {
+            ++Stats.NumOccluders;
+            RemainingTriangles -= NumAdded;
+        }
+    }
+
+    // 가림막이 없어도 화면 밖 판정은 쓸 수 있으므로 빈 버퍼로 검사
+    Buffer.Finish();
+    bBufferValid = Stats.NumOccluders > 0;
+    Stats.NumOccluderTriangles = Buffer.GetNumRasterizedTriangles();
+
+    const uint64 RasterizedCycles = FPlatformTime::Cycles64();
+    Stats.RasterizeMs = FPlatformTime::ToMilliseconds(RasterizedCycles - StartCycles);
+
+    ParallelFor(
+        InObjects.Num(),
+        [this, &InObjects](int32 Index)
+        {
+            const FOcclusionObject& Object = InObjects[Index];
+            if (Object.RenderData)
+            {
+                Results[Index] = Buffer.TestBox(Object.WorldMatrix, Object.RenderData->BoundingBoxMin, Object.RenderData->BoundingBoxMax);
+            }
+        },
+        32
+    );
+
+    for (const EOcclusionResult Result : Results)
+    {
+        Stats.NumOccluded += Result == EOcclusionResult::Occluded ? 1 : 0;
+        Stats.NumOutsideView += Result == EOcclusionResult::OutsideView ? 1 : 0;
+    }
+    Stats.TestMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RasterizedCycles);
+
+    LastStats = Stats;
+    TotalStats.Accumulate(Stats);
+}
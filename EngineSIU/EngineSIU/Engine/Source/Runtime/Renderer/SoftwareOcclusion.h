@@ -0,0 +1,222 @@
+#pragma once
+#include <memory>
+#include <utility>
+
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Set.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+#include "Rendering/Mesh/MeshCluster.h"
+
+class FViewportClient;
+class UStaticMeshComponent;
+
+/**
+ * CPU 소프트웨어 오클루전 컬링
+ *
+ * 화면에서 크게 보이는 메시(가림막)를 저해상도 깊이 버퍼에 SSE로 래스터화하고, 그 위에 최대 깊이의 밉(Hierarchical Z)을 만든 뒤
+ * 컴포넌트의 AABB가 가림막 뒤에 완전히 숨는지 Worker 스레드에서 검사합니다. 결과는 같은 프레임의 메시 패스(DepthPrePass 포함)가 씁니다.
+ * 가림막을 그 프레임의 뷰로 직접 그리므로 이전 프레임 깊이를 재투영할 때 생기는 지연이나 구멍이 없고, 렌더링 디바이스 없이 동작합니다.
+ */
+
+struct FSoftwareOcclusionSettings
+{
+    // 깊이 버퍼 폭. 높이는 뷰의 종횡비로 정하며, 둘 다 4의 배수로 맞춤
+    int32 Width = 256;
+    int32 MaxHeight = 256;
+
+    // 바운딩 구의 화면 크기(FStaticMeshLOD::ComputeScreenSize)가 이 이상인 메시만 화면 크기 순으로 가림막이 됨
+    float MinOccluderScreenSize = 0.15f;
+    int32 MaxOccluders = 32;
+
+    // 가림막 삼각형 예산. 넘으면 나머지 가림막은 그리지 않음 (일부만 그려도 결과는 보수적)
+    int32 MaxOccluderTriangles = 1 << 16;
+};
+
+enum class EOcclusionResult : uint8
+{
+    Visible,
+    Occluded,
+    OutsideView,    // 화면 밖 (좌우상하, 카메라 뒤). 원평면은 깊이 클리핑을 끄므로 보지 않음
+};
+
+struct FOcclusionCullStats
+{
+    int64 NumViews = 0;
+    int64 NumObjects = 0;
+    int64 NumOccluded = 0;
+    int64 NumOutsideView = 0;
+    int64 NumOccluders = 0;
+    int64 NumOccluderTriangles = 0;     // 래스터화한 화면 삼각형 (근평면에서 잘려 둘이 된 것 포함)
+
+    double RasterizeMs = 0.0;
+    double TestMs = 0.0;
+
+    int64 GetNumCulled() const { return NumOccluded + NumOutsideView; }
+    float GetCulledRatio() const { return NumObjects > 0 ? static_cast<float>(GetNumCulled()) / static_cast<float>(NumObjects) : 0.0f; }
+
+    void Accumulate(const FOcclusionCullStats& Other);
+};
+
+/**
+ * 가림막 깊이 버퍼와 HiZ
+ *
+ * 깊이는 클립 공간의 z / w(가까울수록 작음)이고, 픽셀 중심이 덮인 픽셀에 그 픽셀 안에서 삼각형이 가질 수 있는 가장 먼 깊이를 씁니다.
+ * 덮이지 않은 픽셀은 FLT_MAX라서 그 픽셀이 걸친 물체는 가려졌다고 판정하지 않습니다.
+ * 앞면만 그리므로(래스터라이저가 CULL_BACK) 닫히지 않은 메시를 뒤에서 볼 때 잘못 가리지 않습니다.
+ */
+class FOcclusionBuffer : public IClusterOcclusionTester
+{
+public:
+    // 래스터화 Job 하나가 맡는 행 수
+    static constexpr int32 BandHeight = 8;
+
+    /** 버퍼 크기와 뷰를 정하고 가림막 목록을 비웁니다. */
+    void Begin(const FMatrix& InViewProjection, int32 InWidth, int32 InHeight);
+
+    /**
+     * LOD0 삼각형을 가림막으로 추가합니다. 실제 변환과 래스터화는 Finish에서 합니다.
+     * @param Ranges 있으면 이 인덱스 범위만 (FMeshCluster::CullClusters 결과)
+     * @return 추가한 삼각형 수. MaxTriangles를 넘지 않음
+     */
+    int32 AddOccluder(const FStaticMeshRenderData& RenderData, const FMatrix& WorldMatrix, const TArray<FClusterDrawRange>* Ranges, int32 MaxTriangles);
+
+    /** 가림막을 병렬로 변환 / 래스터화하고 HiZ를 만듭니다. */
+    void Finish();
+
+    /**
+     * 로컬 공간 상자를 검사합니다. Finish 뒤에 여러 스레드에서 동시에 불러도 됩니다.
+     * 상자가 근평면에 걸치면 Visible
+     */
+    EOcclusionResult TestBox(const FMatrix& WorldMatrix, const FVector& LocalMin, const FVector& LocalMax) const;
+    EOcclusionResult TestBoxClip(const FMatrix& LocalToClip, const FVector& LocalMin, const FVector& LocalMax) const;
+
+    //~ Begin IClusterOcclusionTester Interface
+    virtual const FMatrix& GetViewProjection() const override { return ViewProjection; }
+    virtual bool IsBoxOccluded(const FMatrix& LocalToClip, const FVector& LocalMin, const FVector& LocalMax) const override
+    {
+        return TestBoxClip(LocalToClip, LocalMin, LocalMax) == EOcclusionResult::Occluded;
+    }
+    //~ End IClusterOcclusionTester Interface
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetNumLevels() const { return HiZ.Num(); }
+    int32 GetNumTriangles() const { return NumTriangles; }
+    int32 GetNumRasterizedTriangles() const { return NumRasterizedTriangles; }
+
+    /** 밉 Level의 (X, Y) 깊이. Level 0이 래스터화한 깊이 버퍼 */
+    float GetDepth(int32 Level, int32 X, int32 Y) const;
+    int32 GetLevelWidth(int32 Level) const { return ((Width - 1) >> Level) + 1; }
+    int32 GetLevelHeight(int32 Level) const { return ((Height - 1) >> Level) + 1; }
+
+private:
+    struct FOccluderRange
+    {
+        const FStaticMeshRenderData* RenderData = nullptr;
+        int32 MatrixIndex = 0;
+        uint32 IndexStart = 0;
+        int32 FirstTriangle = 0;    // 모든 범위를 이은 삼각형 번호
+        int32 NumTriangles = 0;
+    };
+
+    // 픽셀 (MinX, MinY) 중심 기준의 edge 함수와 깊이 평면. MaxX < MinX면 빈 슬롯
+    struct FScreenTriangle
+    {
+        float EdgeA[3];
+        float EdgeB[3];
+        float Edge0[3];
+        float Depth0;
+        float DepthDx;
+        float DepthDy;
+        int32 MinX, MinY, MaxX, MaxY;
+    };
+
+    /** 클립 공간 삼각형을 근평면에서 자르고 화면 삼각형 두 슬롯에 씁니다. */
+    void SetupTriangle(const float (&Clip)[3][4], FScreenTriangle* OutTriangles) const;
+    void RasterizeBand(int32 BandIndex);
+    void BuildHiZ();
+
+private:
+    FMatrix ViewProjection;
+    int32 Width = 0;
+    int32 Height = 0;
+
+    TArray<FMatrix> LocalToClipMatrices;
+    TArray<FOccluderRange> Ranges;
+    int32 NumTriangles = 0;
+    int32 NumRasterizedTriangles = 0;
+
+    // 삼각형마다 두 슬롯 (근평면에서 잘리면 사각형이 됨)
+    TArray<FScreenTriangle> ScreenTriangles;
+
+    // 밴드별 화면 삼각형 목록 (CSR)
+    TArray<int32> BandOffsets;
+    TArray<int32> BandTriangles;
+
+    // HiZ[0]이 깊이 버퍼, 위로 갈수록 2x2의 최대값. 크기는 올림으로 줄여 1x1까지
+    TArray<TArray<float>> HiZ;
+};
+
+// FSoftwareOcclusionCulling::CullObjects의 입력
+struct FOcclusionObject
+{
+    const FStaticMeshRenderData* RenderData = nullptr;
+    FMatrix WorldMatrix;
+    bool bOccluder = true;      // 가림막 후보로 쓸 수 있는지
+};
+
+struct FOcclusionView
+{
+    FMatrix ViewMatrix;
+    FMatrix ProjectionMatrix;
+    FVector ViewLocation;
+    bool bPerspective = true;
+    float AspectRatio = 16.0f / 9.0f;
+};
+
+/**
+ * 뷰 하나의 오클루전 컬링. FRenderer가 뷰포트마다 메시 패스 전에 Cull을 부르고, 메시 패스는 IsOccluded로 컴포넌트를 건너뜁니다.
+ * LOD0 클러스터가 있는 메시는 클러스터 단위로도 GetOcclusionBuffer를 써서 가려진 클러스터를 뺍니다 (FClusterCullView::OcclusionTester).
+ */
+class FSoftwareOcclusionCulling
+{
+public:
+    /** 콘솔의 "occlusion on / off", 벤치마크의 -occlusion=0 */
+    static bool bEnabled;
+
+    /** 마지막으로 "occlusion"을 실행하거나 벤치마크 측정을 시작한 뒤로 쌓인 뷰별 결과 */
+    static FOcclusionCullStats TotalStats;
+
+    FSoftwareOcclusionSettings Settings;
+
+    /** 뷰포트의 카메라로 컴포넌트를 검사합니다. 꺼져 있으면 모두 보이는 것으로 둡니다. */
+    void Cull(const std::shared_ptr<FViewportClient>& Viewport, const TArray<UStaticMeshComponent*>& Components);
+
+    /** 가림막을 고르고 래스터화한 뒤 Objects를 병렬로 검사합니다. 결과는 GetResults에 InObjects와 같은 순서로 들어갑니다. */
+    void CullObjects(const FOcclusionView& View, const TArray<FOcclusionObject>& InObjects);
+
+    bool IsOccluded(const UStaticMeshComponent* Component) const { return HiddenComponents.Contains(Component); }
+
+    /** 마지막 Cull의 버퍼. 꺼져 있거나 가림막이 없었으면 nullptr */
+    const FOcclusionBuffer* GetOcclusionBuffer() const { return bBufferValid ? &Buffer : nullptr; }
+
+    const TArray<EOcclusionResult>& GetResults() const { return Results; }
+    const FOcclusionCullStats& GetLastStats() const { return LastStats; }
+
+private:
+    FOcclusionBuffer Buffer;
+    bool bBufferValid = false;
+
+    TArray<FOcclusionObject> Objects;
+    TArray<EOcclusionResult> Results;
+    TSet<const UStaticMeshComponent*> HiddenComponents;
+
+    // 가림막 후보 (화면 크기, Objects 번호)
+    TArray<std::pair<float, int32>> OccluderCandidates;
+    TArray<FClusterDrawRange> OccluderRanges;
+
+    FOcclusionCullStats LastStats;
+};
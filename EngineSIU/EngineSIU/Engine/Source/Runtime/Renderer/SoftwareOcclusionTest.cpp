@@ -0,0 +1,506 @@
+#include "SoftwareOcclusionTest.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "SoftwareOcclusion.h"
+#include "Math/JungleMath.h"
+#include "Math/MathUtility.h"
+#include "Rendering/Mesh/MeshCluster.h"
+#include "Rendering/Mesh/TestMeshFixture.h"
+#include "WindowsPlatformTime.h"
+
+namespace
+{
+    const TCHAR* GetResultName(EOcclusionResult Result)
+    {
+        switch (Result)
+        {
+        case EOcclusionResult::Visible:     return TEXT("Visible");
+        case EOcclusionResult::Occluded:    return TEXT("Occluded");
+        case EOcclusionResult::OutsideView: return TEXT("OutsideView");
+        }
+        return TEXT("?");
+    }
+
+    /** X = 20에서 -X(원점의 카메라)를 보는 48 x 28 벽 */
+    FStaticMeshRenderData MakeWall()
+    {
+        FStaticMeshRenderData Wall;
+        FTestMeshFixture::AppendGrid(Wall, FVector(20.0f, -24.0f, -14.0f), FVector(0.0f, 0.0f, 28.0f), FVector(0.0f, 48.0f, 0.0f), 4);
+        FTestMeshFixture::ComputeBounds(Wall);
+        return Wall;
+    }
+
+    /** 원점 중심, 한 변 1인 상자 */
+    FStaticMeshRenderData MakeUnitBox()
+    {
+        FStaticMeshRenderData Box;
+        FTestMeshFixture::AppendGrid(Box, FVector(-0.5f, -0.5f, -0.5f), FVector(0.0f, 0.0f, 1.0f), FVector(0.0f, 1.0f, 0.0f), 1);
+        FTestMeshFixture::AppendGrid(Box, FVector(0.5f, -0.5f, -0.5f), FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), 1);
+        FTestMeshFixture::AppendGrid(Box, FVector(-0.5f, -0.5f, -0.5f), FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), 1);
+        FTestMeshFixture::AppendGrid(Box, FVector(-0.5f, 0.5f, -0.5f), FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f), 1);
+        FTestMeshFixture::AppendGrid(Box, FVector(-0.5f, -0.5f, -0.5f), FVector(0.0f, 1.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f), 1);
+        FTestMeshFixture::AppendGrid(Box, FVector(-0.5f, -0.5f, 0.5f), FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f), 1);
+        FTestMeshFixture::ComputeBounds(Box);
+        return Box;
+    }
+
+    FOcclusionView MakeView(const FVector& Location, const FVector& Target, bool bPerspective)
+    {
+        FOcclusionView View;
+        View.ViewLocation = Location;
+        View.bPerspective = bPerspective;
+        View.ViewMatrix = JungleMath::CreateViewMatrix(Location, Target, FVector(0.0f, 0.0f, 1.0f));
+        View.ProjectionMatrix = bPerspective
+            ? JungleMath::CreateProjectionMatrix(FMath::DegreesToRadians(90.0f), View.AspectRatio, 0.1f, 1000.0f)
+            : JungleMath::CreateOrthoProjectionMatrix(100.0f, 100.0f / View.AspectRatio, 0.1f, 1000.0f);
+        return View;
+    }
+
+    struct FExpectedBox
+    {
+        const TCHAR* Name;
+        FVector Location;
+        EOcclusionResult Expected;
+    };
+
+    // 기준 래스터라이저의 화면 삼각형 (SetupTriangle과 같은 화면 좌표, double)
+    struct FReferenceTriangle
+    {
+        double X[3];
+        double Y[3];
+        double Depth[3];
+        double Area;
+    };
+
+    FVector4 TransformToClip(const FMatrix& M, const FVector& P)
+    {
+        return FVector4(
+            P.X * M.M[0][0] + P.Y * M.M[1][0] + P.Z * M.M[2][0] + M.M[3][0],
+            P.X * M.M[0][1] + P.Y * M.M[1][1] + P.Z * M.M[2][1] + M.M[3][1],
+            P.X * M.M[0][2] + P.Y * M.M[1][2] + P.Z * M.M[2][2] + M.M[3][2],
+            P.X * M.M[0][3] + P.Y * M.M[1][3] + P.Z * M.M[2][3] + M.M[3][3]
+        );
+    }
+
+    /**
+     * 버퍼의 깊이를 삼각형별 스칼라 래스터화와 비교하고, HiZ 밉이 아래 레벨의 최대값인지 확인합니다.
+     * 모든 꼭짓점이 근평면과 원평면 사이에 있는 장면만 받습니다.
+     */
+    bool ValidateDepth(const FOcclusionBuffer& Buffer, const FStaticMeshRenderData& Mesh, const FString& Name, TArray<FString>& OutFailures)
+    {
+        const int32 Width = Buffer.GetWidth();
+        const int32 Height = Buffer.GetHeight();
+
+        TArray<FReferenceTriangle> Triangles;
+        for (int32 Index = 0; Index + 2 < Mesh.Indices.Num(); Index += 3)
+        {
+            FReferenceTriangle Triangle;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const FStaticMeshVertex& Vertex = Mesh.Vertices[Mesh.Indices[Index + Corner]];
+                const FVector4 Clip = TransformToClip(Buffer.GetViewProjection(), FVector(Vertex.X, Vertex.Y, Vertex.Z));
+                Triangle.X[Corner] = (Clip.X / Clip.W * 0.5 + 0.5) * Width;
+                Triangle.Y[Corner] = (0.5 - Clip.Y / Clip.W * 0.5) * Height;
+                Triangle.Depth[Corner] = Clip.Z / Clip.W;
+            }
+            Triangle.Area = (Triangle.X[1] - Triangle.X[0]) * (Triangle.Y[2] - Triangle.Y[0]) - (Triangle.X[2] - Triangle.X[0]) * (Triangle.Y[1] - Triangle.Y[0]);
+            if (Triangle.Area > 0.0)
+            {
+                Triangles.Add(Triangle);
+            }
+        }
+
+        int32 NumErrors = 0;
+        for (int32 Y = 0; Y < Height && NumErrors < 8; ++Y)
+        {
+            for (int32 X = 0; X < Width && NumErrors < 8; ++X)
+            {
+                const double CenterX = X + 0.5;
+                const double CenterY = Y + 0.5;
+
+                // 가장자리 근처까지 넣은 가장 가까운 깊이와, 확실히 안쪽인 삼각형이 있는지
+                double NearestDepth = DBL_MAX;
+                bool bCoveredInside = false;
+                for (const FReferenceTriangle& Triangle : Triangles)
+                {
+                    double Edges[3];
+                    double MinDistance = DBL_MAX;
+                    for (int32 Edge = 0; Edge < 3; ++Edge)
+                    {
+                        const int32 From = Edge;
+                        const int32 To = (Edge + 1) % 3;
+                        const double A = -(Triangle.Y[To] - Triangle.Y[From]);
+                        const double B = Triangle.X[To] - Triangle.X[From];
+                        Edges[Edge] = A * (CenterX - Triangle.X[From]) + B * (CenterY - Triangle.Y[From]);
+                        MinDistance = FMath::Min(MinDistance, Edges[Edge] / std::sqrt(A * A + B * B));
+                    }
+                    if (MinDistance < -FSoftwareOcclusionTest::EdgeTolerance)
+                    {
+                        continue;
+                    }
+
+                    // 모서리 (i, i + 1)의 edge 함수는 맞은편 꼭짓점 i + 2의 무게
+                    const double Depth = (Edges[1] * Triangle.Depth[0] + Edges[2] * Triangle.Depth[1] + Edges[0] * Triangle.Depth[2]) / Triangle.Area;
+                    NearestDepth = FMath::Min(NearestDepth, Depth);
+                    bCoveredInside |= MinDistance > FSoftwareOcclusionTest::EdgeTolerance;
+                }
+
+                const float Stored = Buffer.GetDepth(0, X, Y);
+                if (Stored < FLT_MAX && (NearestDepth == DBL_MAX || NearestDepth > Stored + 1e-5))
+                {
+                    OutFailures.Add(FString::Printf(TEXT("%s: pixel (%d, %d) depth %f is nearer than the reference %f"), *Name, X, Y, Stored, NearestDepth));
+                    ++NumErrors;
+                }
+                else if (Stored == FLT_MAX && bCoveredInside)
+                {
+                    OutFailures.Add(FString::Printf(TEXT("%s: pixel (%d, %d) is not covered"), *Name, X, Y));
+                    ++NumErrors;
+                }
+            }
+        }
+
+        for (int32 Level = 1; Level < Buffer.GetNumLevels() && NumErrors == 0; ++Level)
+        {
+            const int32 SourceWidth = Buffer.GetLevelWidth(Level - 1);
+            const int32 SourceHeight = Buffer.GetLevelHeight(Level - 1);
+            for (int32 Y = 0; Y < Buffer.GetLevelHeight(Level); ++Y)
+            {
+                for (int32 X = 0; X < Buffer.GetLevelWidth(Level); ++X)
+                {
+                    float Expected = -FLT_MAX;
+                    for (int32 ChildY = Y * 2; ChildY <= FMath::Min(Y * 2 + 1, SourceHeight - 1); ++ChildY)
+                    {
+                        for (int32 ChildX = X * 2; ChildX <= FMath::Min(X * 2 + 1, SourceWidth - 1); ++ChildX)
+                        {
+                            Expected = FMath::Max(Expected, Buffer.GetDepth(Level - 1, ChildX, ChildY));
+                        }
+                    }
+                    if (Buffer.GetDepth(Level, X, Y) != Expected)
+                    {
+                        OutFailures.Add(FString::Printf(TEXT("%s: HiZ level %d (%d, %d) is not the max of its children"), *Name, Level, X, Y));
+                        return false;
+                    }
+                }
+            }
+        }
+        return NumErrors == 0;
+    }
+
+    /** Occluded로 판정된 상자가 걸친 모든 레벨 0 픽셀이 상자의 가장 가까운 깊이보다 앞인지 전수 확인 */
+    bool IsOccludedAtFullResolution(const FOcclusionBuffer& Buffer, const FMatrix& WorldMatrix, const FVector& LocalMin, const FVector& LocalMax)
+    {
+        const FMatrix LocalToClip = WorldMatrix * Buffer.GetViewProjection();
+        double MinX = DBL_MAX, MaxX = -DBL_MAX, MinY = DBL_MAX, MaxY = -DBL_MAX, NearestDepth = DBL_MAX;
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector Local((Corner & 1) ? LocalMax.X : LocalMin.X, (Corner & 2) ? LocalMax.Y : LocalMin.Y, (Corner & 4) ? LocalMax.Z : LocalMin.Z);
+            const FVector4 Clip = TransformToClip(LocalToClip, Local);
+            if (Clip.Z < 0.0f || Clip.W <= 0.0f)
+            {
+                return false;
+            }
+            MinX = FMath::Min(MinX, static_cast<double>(Clip.X / Clip.W));
+            MaxX = FMath::Max(MaxX, static_cast<double>(Clip.X / Clip.W));
+            MinY = FMath::Min(MinY, static_cast<double>(Clip.Y / Clip.W));
+            MaxY = FMath::Max(MaxY, static_cast<double>(Clip.Y / Clip.W));
+            NearestDepth = FMath::Min(NearestDepth, static_cast<double>(Clip.Z / Clip.W));
+        }
+
+        // 상자의 화면 범위가 걸친 모든 픽셀
+        const int32 Width = Buffer.GetWidth();
+        const int32 Height = Buffer.GetHeight();
+        const int32 PixelMinX = FMath::Clamp(static_cast<int32>(std::floor((MinX * 0.5 + 0.5) * Width)), 0, Width - 1);
+        const int32 PixelMaxX = FMath::Clamp(static_cast<int32>(std::floor((MaxX * 0.5 + 0.5) * Width)), 0, Width - 1);
+        const int32 PixelMinY = FMath::Clamp(static_cast<int32>(std::floor((0.5 - MaxY * 0.5) * Height)), 0, Height - 1);
+        const int32 PixelMaxY = FMath::Clamp(static_cast<int32>(std::floor((0.5 - MinY * 0.5) * Height)), 0, Height - 1);
+
+        const double Depth = FMath::Min(NearestDepth, 1.0);
+        for (int32 Y = PixelMinY; Y <= PixelMaxY; ++Y)
+        {
+            for (int32 X = PixelMinX; X <= PixelMaxX; ++X)
+            {
+                if (Buffer.GetDepth(0, X, Y) >= Depth)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+bool FSoftwareOcclusionTest::Run(TArray<FSoftwareOcclusionTestResult>& OutResults, TArray<FString>& OutFailures)
+{
+    const int32 NumFailuresBefore = OutFailures.Num();
+
+    // 테스트의 컬링이 콘솔 / 벤치마크 통계에 섞이지 않게 함
+    const FOcclusionCullStats SavedTotalStats = FSoftwareOcclusionCulling::TotalStats;
+
+    FSoftwareOcclusionCulling Culling;
+    const FStaticMeshRenderData Wall = MakeWall();
+    const FStaticMeshRenderData Box = MakeUnitBox();
+
+    auto RunCase = [&](const FString& Name, const FOcclusionView& View, const TArray<FOcclusionObject>& Objects) -> FSoftwareOcclusionTestResult&
+    {
+        FSoftwareOcclusionTestResult& Result = OutResults[OutResults.Add(FSoftwareOcclusionTestResult())];
+        Result.Name = Name;
+        Result.NumObjects = Objects.Num();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Culling.CullObjects(View, Objects);
+        Result.CullMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        Result.NumOccluded = static_cast<int32>(Culling.GetLastStats().NumOccluded);
+        Result.NumOutsideView = static_cast<int32>(Culling.GetLastStats().NumOutsideView);
+        Result.NumOccluderTriangles = static_cast<int32>(Culling.GetLastStats().NumOccluderTriangles);
+        return Result;
+    };
+
+    auto RunWallCase = [&](const FString& Name, const FOcclusionView& View, const TArray<FExpectedBox>& Boxes)
+    {
+        TArray<FOcclusionObject> Objects;
+        FOcclusionObject WallObject;
+        WallObject.RenderData = &Wall;
+        WallObject.WorldMatrix = FMatrix::Identity;
+        Objects.Add(WallObject);
+        for (const FExpectedBox& Expected : Boxes)
+        {
+            FOcclusionObject BoxObject;
+            BoxObject.RenderData = &Box;
+            BoxObject.WorldMatrix = FMatrix::CreateTranslationMatrix(Expected.Location);
+            BoxObject.bOccluder = false;
+            Objects.Add(BoxObject);
+        }
+
+        RunCase(Name, View, Objects);
+        for (int32 Index = 0; Index < Boxes.Num(); ++Index)
+        {
+            const EOcclusionResult Result = Culling.GetResults()[Index + 1];
+            if (Result != Boxes[Index].Expected)
+            {
+                OutFailures.Add(FString::Printf(
+                    TEXT("%s: %s is %s, expected %s"), *Name, Boxes[Index].Name, GetResultName(Result), GetResultName(Boxes[Index].Expected)
+                ));
+            }
+        }
+    };
+
+    // 벽 뒤 / 앞 / 가장자리 / 화면 밖 / 근평면
+    {
+        TArray<FExpectedBox> Boxes;
+        Boxes.Add({ TEXT("box behind the wall"), FVector(40.0f, 0.0f, 0.0f), EOcclusionResult::Occluded });
+        Boxes.Add({ TEXT("box far behind the wall"), FVector(500.0f, 100.0f, 50.0f), EOcclusionResult::Occluded });
+        Boxes.Add({ TEXT("box in front of the wall"), FVector(10.0f, 0.0f, 0.0f), EOcclusionResult::Visible });
+        Boxes.Add({ TEXT("box past the wall edge"), FVector(40.0f, 48.0f, 0.0f), EOcclusionResult::Visible });
+        Boxes.Add({ TEXT("box beside the wall"), FVector(40.0f, 60.0f, 0.0f), EOcclusionResult::Visible });
+        Boxes.Add({ TEXT("box above the view"), FVector(40.0f, 0.0f, 200.0f), EOcclusionResult::OutsideView });
+        Boxes.Add({ TEXT("box behind the camera"), FVector(-40.0f, 0.0f, 0.0f), EOcclusionResult::OutsideView });
+        Boxes.Add({ TEXT("box on the near plane"), FVector(0.2f, 0.0f, 0.0f), EOcclusionResult::Visible });
+        RunWallCase(TEXT("Wall (perspective)"), MakeView(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), true), Boxes);
+    }
+    {
+        TArray<FExpectedBox> Boxes;
+        Boxes.Add({ TEXT("box behind the wall"), FVector(40.0f, 0.0f, 0.0f), EOcclusionResult::Occluded });
+        Boxes.Add({ TEXT("box in front of the wall"), FVector(10.0f, 0.0f, 0.0f), EOcclusionResult::Visible });
+        Boxes.Add({ TEXT("box past the wall edge"), FVector(40.0f, 24.0f, 0.0f), EOcclusionResult::Visible });
+        Boxes.Add({ TEXT("box above the view"), FVector(40.0f, 0.0f, 100.0f), EOcclusionResult::OutsideView });
+        Boxes.Add({ TEXT("box on the near plane"), FVector(0.0f, 0.0f, 0.0f), EOcclusionResult::Visible });
+        RunWallCase(TEXT("Wall (orthographic)"), MakeView(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), false), Boxes);
+    }
+
+    // 벽을 뒤에서 보면 그리지 않으므로(CULL_BACK) 가리지 않음
+    {
+        TArray<FExpectedBox> Boxes;
+        Boxes.Add({ TEXT("box behind the back of the wall"), FVector(10.0f, 0.0f, 0.0f), EOcclusionResult::Visible });
+        RunWallCase(TEXT("Wall (back side)"), MakeView(FVector(40.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 0.0f), true), Boxes);
+    }
+
+    // 클러스터 단위: 화면에서 벽보다 넓은 판의 가운데 클러스터만 가려짐
+    {
+        FStaticMeshRenderData Plane;
+        FTestMeshFixture::AppendGrid(Plane, FVector(300.0f, -450.0f, -120.0f), FVector(0.0f, 0.0f, 240.0f), FVector(0.0f, 900.0f, 0.0f), 96);
+        FTestMeshFixture::ComputeBounds(Plane);
+        FMeshCluster::BuildClusters(Plane);
+
+        TArray<FOcclusionObject> Objects;
+        FOcclusionObject WallObject;
+        WallObject.RenderData = &Wall;
+        WallObject.WorldMatrix = FMatrix::Identity;
+        Objects.Add(WallObject);
+
+        const FOcclusionView View = MakeView(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), true);
+        RunCase(TEXT("Clusters behind the wall"), View, Objects);
+
+        FClusterCullView ClusterView;
+        ClusterView.ViewProjections.Add(View.ViewMatrix * View.ProjectionMatrix);
+        ClusterView.OcclusionTester = Culling.GetOcclusionBuffer();
+
+        TArray<FClusterDrawRange> Ranges;
+        FClusterCullStats Stats;
+        if (ClusterView.OcclusionTester == nullptr)
+        {
+            OutFailures.Add(TEXT("Clusters behind the wall: no occlusion buffer"));
+        }
+        else if (FMeshCluster::CullClusters(Plane, FMatrix::Identity, ClusterView, Ranges, &Stats))
+        {
+            const int64 NumRemaining = Stats.NumTriangles - Stats.NumFrustumCulledTriangles - Stats.NumBackfaceCulledTriangles;
+            if (Stats.NumOcclusionCulledTriangles == 0 || Stats.NumOcclusionCulledTriangles >= NumRemaining)
+            {
+                OutFailures.Add(FString::Printf(
+                    TEXT("Clusters behind the wall: %lld of %lld triangles occlusion culled"), Stats.NumOcclusionCulledTriangles, NumRemaining
+                ));
+            }
+        }
+        else
+        {
+            OutFailures.Add(TEXT("Clusters behind the wall: plane has no clusters"));
+        }
+    }
+
+    // 무작위 삼각형: 기준 래스터라이저와 비교하고, Occluded면 전체 해상도에서도 가려지는지
+    uint32 Seed = 12345;
+    auto Random = [&Seed]()
+    {
+        Seed = Seed * 1664525u + 1013904223u;
+        return static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+    };
+
+    for (int32 SceneIndex = 0; SceneIndex < 4; ++SceneIndex)
+    {
+        const bool bPerspective = SceneIndex % 2 == 0;
+        const FString Name = FString::Printf(TEXT("Random triangles %d (%s)"), SceneIndex, bPerspective ? TEXT("perspective") : TEXT("orthographic"));
+
+        // 모든 꼭짓점이 근평면(0.1) 앞, 화면 약간 밖까지. 감김은 무작위라 절반은 뒷면
+        FStaticMeshRenderData Occluders;
+        for (int32 Triangle = 0; Triangle < 48; ++Triangle)
+        {
+            const FVector Center(5.0f + Random() * 40.0f, (Random() * 2.0f - 1.0f) * 40.0f, (Random() * 2.0f - 1.0f) * 24.0f);
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                FTestMeshFixture::AddVertex(Occluders, Center + FVector((Random() * 2.0f - 1.0f) * 3.0f, (Random() * 2.0f - 1.0f) * 16.0f, (Random() * 2.0f - 1.0f) * 16.0f));
+                Occluders.Indices.Add(Occluders.Vertices.Num() - 1);
+            }
+        }
+        FTestMeshFixture::ComputeBounds(Occluders);
+
+        TArray<FOcclusionObject> Objects;
+        FOcclusionObject OccluderObject;
+        OccluderObject.RenderData = &Occluders;
+        OccluderObject.WorldMatrix = FMatrix::Identity;
+        Objects.Add(OccluderObject);
+
+        for (int32 BoxIndex = 0; BoxIndex < 256; ++BoxIndex)
+        {
+            const FVector Location(3.0f + Random() * 80.0f, (Random() * 2.0f - 1.0f) * 60.0f, (Random() * 2.0f - 1.0f) * 36.0f);
+            const FVector Scale(0.2f + Random() * 3.0f, 0.2f + Random() * 3.0f, 0.2f + Random() * 3.0f);
+            FOcclusionObject BoxObject;
+            BoxObject.RenderData = &Box;
+            BoxObject.WorldMatrix = FMatrix::GetScaleMatrix(Scale) * FMatrix::CreateTranslationMatrix(Location);
+            BoxObject.bOccluder = false;
+            Objects.Add(BoxObject);
+        }
+
+        const FOcclusionView View = MakeView(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), bPerspective);
+        RunCase(Name, View, Objects);
+
+        const FOcclusionBuffer* Buffer = Culling.GetOcclusionBuffer();
+        if (Buffer == nullptr)
+        {
+            OutFailures.Add(FString::Printf(TEXT("%s: no occlusion buffer"), *Name));
+            continue;
+        }
+        if (!ValidateDepth(*Buffer, Occluders, Name, OutFailures))
+        {
+            continue;
+        }
+
+        for (int32 Index = 1; Index < Objects.Num(); ++Index)
+        {
+            if (Culling.GetResults()[Index] == EOcclusionResult::Occluded
+                && !IsOccludedAtFullResolution(*Buffer, Objects[Index].WorldMatrix, Box.BoundingBoxMin, Box.BoundingBoxMax))
+            {
+                OutFailures.Add(FString::Printf(TEXT("%s: box %d is occluded in HiZ but not at full resolution"), *Name, Index));
+            }
+        }
+    }
+
+    FSoftwareOcclusionCulling::TotalStats = SavedTotalStats;
+    return OutFailures.Num() == NumFailuresBefore;
+}
+
+FOcclusionBenchmarkResult FSoftwareOcclusionTest::RunBenchmark(int32 GridSize, uint32 Iterations)
+{
+    GridSize = FMath::Max(GridSize, 1);
+    Iterations = FMath::Max<uint32>(Iterations, 1);
+
+    // 카메라 앞(+X) 20에 -X를 보는 벽, 그 뒤 30 ~ 60에 상자 격자. 화면 가장자리 상자는 벽 옆으로 보임
+    FStaticMeshRenderData Wall;
+    FTestMeshFixture::AppendGrid(Wall, FVector(20.0f, -24.0f, -14.0f), FVector(0.0f, 0.0f, 28.0f), FVector(0.0f, 48.0f, 0.0f), 16);
+    FTestMeshFixture::ComputeBounds(Wall);
+
+    const FStaticMeshRenderData Box = MakeUnitBox();
+
+    TArray<FOcclusionObject> BenchmarkObjects;
+    FOcclusionObject WallObject;
+    WallObject.RenderData = &Wall;
+    WallObject.WorldMatrix = FMatrix::Identity;
+    BenchmarkObjects.Add(WallObject);
+
+    for (int32 Row = 0; Row < GridSize; ++Row)
+    {
+        for (int32 Column = 0; Column < GridSize; ++Column)
+        {
+            const float Y = (static_cast<float>(Column) / FMath::Max(GridSize - 1, 1) - 0.5f) * 100.0f;
+            const float Z = (static_cast<float>(Row) / FMath::Max(GridSize - 1, 1) - 0.5f) * 56.0f;
+            const float X = 30.0f + static_cast<float>((Row * 7 + Column * 3) % 31);
+
+            FOcclusionObject BoxObject;
+            BoxObject.RenderData = &Box;
+            BoxObject.WorldMatrix = FMatrix::CreateTranslationMatrix(FVector(X, Y, Z));
+            BoxObject.bOccluder = false;
+            BenchmarkObjects.Add(BoxObject);
+        }
+    }
+
+    FOcclusionView View;
+    View.ViewLocation = FVector::ZeroVector;
+    View.ViewMatrix = JungleMath::CreateViewMatrix(View.ViewLocation, FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+    View.ProjectionMatrix = JungleMath::CreateProjectionMatrix(FMath::DegreesToRadians(90.0f), View.AspectRatio, 0.1f, 1000.0f);
+
+    FSoftwareOcclusionCulling Culling;
+
+    // 작업 공간 할당을 측정에서 제외하기 위한 워밍업. 통계도 벤치마크 밖이므로 되돌림
+    const FOcclusionCullStats SavedTotalStats = FSoftwareOcclusionCulling::TotalStats;
+    Culling.CullObjects(View, BenchmarkObjects);
+
+    FOcclusionBenchmarkResult Result;
+    Result.NumObjects = BenchmarkObjects.Num();
+    Result.Iterations = Iterations;
+    Result.MinMs = DBL_MAX;
+
+    double TotalMs = 0.0;
+    for (uint32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Culling.CullObjects(View, BenchmarkObjects);
+        const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        TotalMs += ElapsedMs;
+        Result.MinMs = FMath::Min(Result.MinMs, ElapsedMs);
+        Result.MaxMs = FMath::Max(Result.MaxMs, ElapsedMs);
+        Result.RasterizeMs += Culling.GetLastStats().RasterizeMs / Iterations;
+        Result.TestMs += Culling.GetLastStats().TestMs / Iterations;
+    }
+    FSoftwareOcclusionCulling::TotalStats = SavedTotalStats;
+
+    const FOcclusionCullStats& LastStats = Culling.GetLastStats();
+    Result.AverageMs = TotalMs / Iterations;
+    Result.NumOccluders = static_cast<int32>(LastStats.NumOccluders);
+    Result.NumOccluderTriangles = static_cast<int32>(LastStats.NumOccluderTriangles);
+    Result.NumOccluded = static_cast<int32>(LastStats.NumOccluded);
+    Result.NumOutsideView = static_cast<int32>(LastStats.NumOutsideView);
+    return Result;
+}
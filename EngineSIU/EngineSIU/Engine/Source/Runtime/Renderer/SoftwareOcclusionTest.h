@@ -0,0 +1,49 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FSoftwareOcclusionTestResult
+{
+    FString Name;
+    int32 NumObjects = 0;
+    int32 NumOccluded = 0;
+    int32 NumOutsideView = 0;
+    int32 NumOccluderTriangles = 0;
+    double CullMs = 0.0;
+};
+
+struct FOcclusionBenchmarkResult
+{
+    int32 NumObjects = 0;
+    int32 NumOccluders = 0;
+    int32 NumOccluderTriangles = 0;
+    int32 NumOccluded = 0;
+    int32 NumOutsideView = 0;
+    uint32 Iterations = 0;
+
+    double AverageMs = 0.0;
+    double MinMs = 0.0;
+    double MaxMs = 0.0;
+    double RasterizeMs = 0.0;   // 평균
+    double TestMs = 0.0;
+};
+
+/**
+ * FSoftwareOcclusionCulling 검증. 콘솔의 "occlusion test"에서 호출합니다.
+ * 벽 하나로 만든 원근 / 직교 장면에서 벽 뒤 / 앞 / 가장자리 / 화면 밖 / 근평면에 걸친 상자의 판정과 뒷면 벽, 클러스터 단위 컬링을 확인하고,
+ * 무작위 삼각형 장면에서 SIMD 깊이 버퍼를 스칼라 기준 래스터라이저와 비교해 HiZ 판정이 보수적인지 확인합니다.
+ */
+struct FSoftwareOcclusionTest
+{
+    /** 기준 래스터라이저와 비교할 때 삼각형 가장자리로 보는 거리 (픽셀) */
+    static constexpr double EdgeTolerance = 0.01;
+
+    static bool Run(TArray<FSoftwareOcclusionTestResult>& OutResults, TArray<FString>& OutFailures);
+
+    /**
+     * 카메라 앞에 벽을 두고 그 뒤에 한 변 GridSize개의 상자 격자를 둔 장면으로 CullObjects 시간을 측정합니다.
+     * 렌더링 디바이스가 필요 없습니다. 콘솔의 "occlusion bench"에서 호출합니다.
+     */
+    static FOcclusionBenchmarkResult RunBenchmark(int32 GridSize, uint32 Iterations);
+};
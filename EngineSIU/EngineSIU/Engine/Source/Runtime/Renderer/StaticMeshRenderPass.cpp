@@ -11,6 +11,7 @@
 #include "ShowFlag.h"
 #include "UnrealClient.h"
 #include "Math/JungleMath.h"
+#include "Math/MathBatch.h"
 
 #include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
@@ -244,7 +245,9 @@ void FStaticMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, con
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    FMatrix InverseWorld;
+    FMathBatch::InverseAffine(WorldMatrix, InverseWorld);
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(InverseWorld);
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
@@ -0,0 +1,90 @@
+#include "TextGlyphTable.h"
+
+#include <array>
+
+#include "Define.h"
+
+
+namespace
+{
+    constexpr std::array<uint8, 128> MakeAsciiCells()
+    {
+        std::array<uint8, 128> Cells = {};
+        for (int32 Char = 0; Char < 128; ++Char)
+        {
+            int32 Cell = FTextGlyphTable::SpaceCell;
+            if (Char >= '0' && Char <= '9')
+            {
+                Cell = FTextGlyphTable::DigitStartCell + (Char - '0');
+            }
+            else if (Char >= 'A' && Char <= 'Z')
+            {
+                Cell = FTextGlyphTable::UpperStartCell + (Char - 'A');
+            }
+            else if (Char >= 'a' && Char <= 'z')
+            {
+                Cell = FTextGlyphTable::LowerStartCell + (Char - 'a');
+            }
+            Cells[Char] = static_cast<uint8>(Cell);
+        }
+        return Cells;
+    }
+
+    constexpr std::array<uint8, 128> AsciiCells = MakeAsciiCells();
+}
+
+int32 FTextGlyphTable::GetCellIndex(wchar_t Char)
+{
+    const uint32 Code = static_cast<uint32>(Char);
+    if (Code < AsciiCells.size())
+    {
+        return AsciiCells[Code];
+    }
+
+    const uint32 HangulOffset = Code - static_cast<uint32>(HangulFirst);
+    if (HangulOffset <= static_cast<uint32>(HangulLast - HangulFirst))
+    {
+        return HangulStartCell + static_cast<int32>(HangulOffset);
+    }
+    return SpaceCell;
+}
+
+void FTextGlyphTable::AppendGlyphQuads(const FWString& Text, float ColumnCount, float RowCount, TArray<FVertexTexture>& OutVertices)
+{
+    const int32 NumChars = static_cast<int32>(Text.size());
+    const int32 FirstVertex = OutVertices.Num();
+    OutVertices.SetNum(FirstVertex + NumChars * 6);
+    FVertexTexture* Vertex = OutVertices.GetData() + FirstVertex;
+
+    // 칸 하나의 UV 크기
+    const float CellU = 1.0f / ColumnCount;
+    const float CellV = 1.0f / RowCount;
+
+    // 글자 쿼드는 [-1, 1] 크기. 텍스트 전체의 가운데가 원점
+    constexpr float QuadWidth = 2.0f;
+    const float CenterOffset = QuadWidth * NumChars * 0.5f;
+
+    for (int32 CharIndex = 0; CharIndex < NumChars; ++CharIndex)
+    {
+        const int32 Cell = GetCellIndex(Text[CharIndex]);
+        const float U0 = static_cast<float>(Cell % AtlasColumns) * CellU;
+        const float V0 = static_cast<float>(Cell / AtlasColumns) * CellV;
+        const float U1 = U0 + CellU;
+        const float V1 = V0 + CellV;
+
+        const float X0 = QuadWidth * CharIndex - CenterOffset - 1.0f;
+        const float X1 = X0 + QuadWidth;
+
+        const FVertexTexture LeftUp = { X0, 1.0f, 0.0f, U0, V0 };
+        const FVertexTexture RightUp = { X1, 1.0f, 0.0f, U1, V0 };
+        const FVertexTexture LeftDown = { X0, -1.0f, 0.0f, U0, V1 };
+        const FVertexTexture RightDown = { X1, -1.0f, 0.0f, U1, V1 };
+
+        *Vertex++ = LeftUp;
+        *Vertex++ = RightUp;
+        *Vertex++ = LeftDown;
+        *Vertex++ = RightUp;
+        *Vertex++ = RightDown;
+        *Vertex++ = LeftDown;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FVertexTexture;
+
+/**
+ * 텍스트 아틀라스(Assets/Texture/font.png)에서 글자가 있는 칸을 찾습니다.
+ *
+ * 아틀라스는 한 줄에 AtlasColumns칸이고, 공백 / 숫자 / 대문자 / 소문자 / 한글 음절(가~힣) 순으로 놓여 있습니다.
+ * ASCII는 미리 만든 표에서, 한글은 음절 순서 그대로 칸 번호를 구하므로 글자마다 범위를 비교하지 않습니다.
+ */
+struct FTextGlyphTable
+{
+    static constexpr int32 AtlasColumns = 106;
+
+    static constexpr int32 SpaceCell = 0;
+    static constexpr int32 DigitStartCell = 1;
+    static constexpr int32 UpperStartCell = 11;
+    static constexpr int32 LowerStartCell = 37;
+    static constexpr int32 HangulStartCell = 63;
+
+    static constexpr wchar_t HangulFirst = L'가';
+    static constexpr wchar_t HangulLast = L'힣';
+
+    /** 아틀라스에 없는 글자는 공백 칸을 사용 */
+    static int32 GetCellIndex(wchar_t Char);
+
+    /** Text의 글자마다 삼각형 2개(6 정점)를 OutVertices 뒤에 붙입니다. 쿼드는 가로 2 단위이고, 텍스트 전체가 원점 중앙에 오도록 놓습니다. */
+    static void AppendGlyphQuads(const FWString& Text, float ColumnCount, float RowCount, TArray<FVertexTexture>& OutVertices);
+};
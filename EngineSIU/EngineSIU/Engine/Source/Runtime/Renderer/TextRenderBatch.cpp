@@ -0,0 +1,91 @@
+#include "TextRenderBatch.h"
+
+#include <cstring>
+
+#include "TextGlyphTable.h"
+
+
+FTextRenderBatch::~FTextRenderBatch()
+{
+    Release();
+}
+
+void FTextRenderBatch::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext)
+{
+    Device = InDevice;
+    DeviceContext = InDeviceContext;
+}
+
+void FTextRenderBatch::Release()
+{
+    if (VertexBuffer)
+    {
+        VertexBuffer->Release();
+        VertexBuffer = nullptr;
+    }
+    BufferCapacity = 0;
+}
+
+void FTextRenderBatch::Reset()
+{
+    // 용량은 유지해서 프레임마다 다시 할당하지 않음
+    Vertices.SetNum(0);
+    Stats.NumTexts = 0;
+    Stats.NumVertices = 0;
+}
+
+FTextDraw FTextRenderBatch::AddText(const FWString& Text, float ColumnCount, float RowCount)
+{
+    FTextDraw Draw;
+    Draw.StartVertex = static_cast<uint32>(Vertices.Num());
+    FTextGlyphTable::AppendGlyphQuads(Text, ColumnCount, RowCount, Vertices);
+    Draw.NumVertices = static_cast<uint32>(Vertices.Num()) - Draw.StartVertex;
+
+    ++Stats.NumTexts;
+    Stats.NumVertices = Vertices.Num();
+    return Draw;
+}
+
+bool FTextRenderBatch::Upload()
+{
+    const uint32 NumVertices = static_cast<uint32>(Vertices.Num());
+    if (NumVertices == 0)
+    {
+        return true;
+    }
+
+    if (NumVertices > BufferCapacity)
+    {
+        uint32 NewCapacity = FMath::Max(BufferCapacity, 1024u);
+        while (NewCapacity < NumVertices)
+        {
+            NewCapacity *= 2;
+        }
+
+        Release();
+
+        D3D11_BUFFER_DESC BufferDesc = {};
+        BufferDesc.ByteWidth = NewCapacity * sizeof(FVertexTexture);
+        BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+        BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        if (FAILED(Device->CreateBuffer(&BufferDesc, nullptr, &VertexBuffer)))
+        {
+            UE_LOG(LogLevel::Error, "Failed to create text batch vertex buffer (%u vertices)", NewCapacity);
+            return false;
+        }
+        BufferCapacity = NewCapacity;
+        ++Stats.NumBufferResizes;
+    }
+    Stats.BufferCapacity = BufferCapacity;
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(DeviceContext->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return false;
+    }
+    std::memcpy(Mapped.pData, Vertices.GetData(), NumVertices * sizeof(FVertexTexture));
+    DeviceContext->Unmap(VertexBuffer, 0);
+    return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#define _TCHAR_DEFINED
+#include <d3d11.h>
+
+#include "Define.h"
+#include "Container/Array.h"
+
+/** Billboard 패스가 한 프레임에 그리는 텍스트 하나 */
+struct FTextDraw
+{
+    uint32 StartVertex = 0;
+    uint32 NumVertices = 0;
+};
+
+struct FTextRenderBatchStats
+{
+    int32 NumTexts = 0;
+    int32 NumVertices = 0;
+    uint32 BufferCapacity = 0;      // 정점 수
+    int32 NumBufferResizes = 0;
+};
+
+/**
+ * 한 프레임(뷰포트)에 그릴 텍스트의 글자 쿼드를 모아서 동적 정점 버퍼 하나에 올립니다.
+ *
+ * 문자열마다 정점 버퍼를 만들지 않으므로, 점수나 UUID처럼 매 프레임 바뀌는 텍스트도 GPU 버퍼가 늘어나지 않습니다.
+ * Reset → AddText ... → Upload 순서로 호출하고, 각 텍스트는 AddText가 돌려준 범위로 Draw합니다.
+ */
+class FTextRenderBatch
+{
+public:
+    FTextRenderBatch() = default;
+    ~FTextRenderBatch();
+
+    FTextRenderBatch(const FTextRenderBatch&) = delete;
+    FTextRenderBatch& operator=(const FTextRenderBatch&) = delete;
+
+    void Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext);
+    void Release();
+
+    void Reset();
+
+    /** Text의 글자 쿼드를 만들어 배치에 넣습니다. ColumnCount / RowCount는 아틀라스의 칸 수 */
+    FTextDraw AddText(const FWString& Text, float ColumnCount, float RowCount);
+
+    /** 모은 정점을 정점 버퍼에 씁니다. 버퍼가 작으면 2배씩 키웁니다. */
+    bool Upload();
+
+    ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
+    const FTextRenderBatchStats& GetStats() const { return Stats; }
+
+private:
+    ID3D11Device* Device = nullptr;
+    ID3D11DeviceContext* DeviceContext = nullptr;
+
+    ID3D11Buffer* VertexBuffer = nullptr;
+    uint32 BufferCapacity = 0;
+
+    TArray<FVertexTexture> Vertices;
+
+    FTextRenderBatchStats Stats;
+};
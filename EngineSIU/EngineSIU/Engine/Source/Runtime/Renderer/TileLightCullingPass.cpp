@@ -82,6 +82,13 @@ void FTileLightCullingPass::Render(const std::shared_ptr<FViewportClient>& Viewp
     )->SRV;
     ComputeShader = ShaderManager->GetComputeShaderByKey(L"TileLightCullingComputeShader");
     UpdateTileLightConstantBuffer(Viewport);
+
+    if (bUseCPUClusteredAssignment)
+    {
+        AssignLightsOnCPU(Viewport);
+        return;
+    }
+
     Dispatch(Viewport);
 
     //ParseCulledLightMaskData();
@@ -138,6 +145,43 @@ void FTileLightCullingPass::Dispatch(const std::shared_ptr<FViewportClient>& Vie
     Graphics->DeviceContext->CSSetConstantBuffers(0, 1, NullBuffer);
 }
 
+void FTileLightCullingPass::AssignLightsOnCPU(const std::shared_ptr<FViewportClient>& Viewport)
+{
+    const uint32 ViewportWidth = static_cast<uint32>(Viewport->GetD3DViewport().Width);
+    const uint32 ViewportHeight = static_cast<uint32>(Viewport->GetD3DViewport().Height);
+
+    FClusterGridSettings GridSettings;
+    GridSettings.ScreenWidth = ViewportWidth;
+    GridSettings.ScreenHeight = ViewportHeight;
+    GridSettings.TileSize = TILE_SIZE;
+    GridSettings.NearZ = Viewport->GetNearClip();
+    GridSettings.FarZ = Viewport->GetFarClip();
+    GridSettings.ProjectionMatrix = Viewport->GetProjectionMatrix();
+    ClusteredLightAssignment.SetGrid(GridSettings);
+
+    ClusterPointLights.Reset();
+    for (UPointLightComponent* LightComp : PointLights)
+    {
+        ClusterPointLights.Add({ LightComp->GetWorldLocation(), LightComp->GetRadius() });
+    }
+
+    ClusterSpotLights.Reset();
+    for (USpotLightComponent* LightComp : SpotLights)
+    {
+        ClusterSpotLights.Add({ LightComp->GetWorldLocation(), LightComp->GetRadius(), LightComp->GetDirection(), LightComp->GetOuterRad() });
+    }
+
+    ClusteredLightAssignment.Assign(Viewport->GetViewMatrix(), ClusterPointLights, ClusterSpotLights);
+
+    // 셰이더와 같은 방식(ScreenSize.x / TileSize.x)으로 행 길이를 맞춰야 타일 인덱스가 일치함
+    const uint32 TileStrideX = FMath::Max<uint32>(ViewportWidth / TILE_SIZE, 1);
+    const uint32 NumTiles = TILE_COUNT;
+    ClusteredLightAssignment.BuildTileMasks(CPUPointLightMask, CPUSpotLightMask, TileStrideX, NumTiles, SHADER_ENTITY_TILE_BUCKET_COUNT);
+
+    Graphics->DeviceContext->UpdateSubresource(PerTilePointLightIndexMaskBuffer, 0, nullptr, CPUPointLightMask.GetData(), 0, 0);
+    Graphics->DeviceContext->UpdateSubresource(PerTileSpotLightIndexMaskBuffer, 0, nullptr, CPUSpotLightMask.GetData(), 0, 0);
+}
+
 void FTileLightCullingPass::ClearRenderArr()
 {
     ClearUAVs();
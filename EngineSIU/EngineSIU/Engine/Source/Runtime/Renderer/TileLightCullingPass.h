@@ -3,6 +3,7 @@
 #include "Container/Set.h"
 
 #include "Define.h"
+#include "ClusteredLightAssignment.h"
 #include <d3d11.h>
 
 class FDXDShaderManager;
@@ -64,6 +65,9 @@ public:
     void ClearUAVs() const;
     void UpdateTileLightConstantBuffer(const std::shared_ptr<FViewportClient>& Viewport) const;
 
+    // Compute Shader 대신 CPU Clustered Light Assignment 결과로 타일 마스크 버퍼를 채움
+    void AssignLightsOnCPU(const std::shared_ptr<FViewportClient>& Viewport);
+
     void ResizeViewBuffers(uint32 InWidth, uint32 InHeight);
 
     // UAV 결과를 파싱하여 타일별 영향을 주는 전역 조명 인덱스로 바꾸는 함수
@@ -85,6 +89,11 @@ public:
 
     ID3D11Buffer* GetTileConstantBuffer() const { return TileLightConstantBuffer; }
 
+    void SetUseCPUClusteredAssignment(bool bInUseCPU) { bUseCPUClusteredAssignment = bInUseCPU; }
+    bool IsUsingCPUClusteredAssignment() const { return bUseCPUClusteredAssignment; }
+
+    const FClusteredLightAssignment& GetClusteredLightAssignment() const { return ClusteredLightAssignment; }
+
 private:
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
@@ -120,6 +129,15 @@ private:
     TArray<uint32> CulledPointLightMaskData;
     TArray<uint32> CulledSpotLightMaskData;
 
+    bool bUseCPUClusteredAssignment = false;    // Compute Shader를 쓸 수 없는 환경용 CPU 대체 경로
+    FClusteredLightAssignment ClusteredLightAssignment;
+
+    // CPU 경로에서 프레임마다 재사용하는 입력 / 출력 배열
+    TArray<FClusterPointLight> ClusterPointLights;
+    TArray<FClusterSpotLight> ClusterSpotLights;
+    TArray<uint32> CPUPointLightMask;
+    TArray<uint32> CPUSpotLightMask;
+
     ID3D11Texture2D*            DebugHeatmapTexture;    // 디버그용 히트맵 텍스처
     ID3D11UnorderedAccessView*  DebugHeatmapUAV;        // 디버그용 히트맵 UAV
     ID3D11ShaderResourceView*   DebugHeatmapSRV;        // 디버그용 히트맵 SRV
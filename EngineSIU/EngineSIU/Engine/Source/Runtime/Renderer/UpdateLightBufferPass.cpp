@@ -161,63 +161,6 @@ void FUpdateLightBufferPass::UpdateLightBuffer() const
     
 }
 
-void FUpdateLightBufferPass::SetPointLightData(
-    const TArray<UPointLightComponent*>& InPointLights, TArray<TArray<uint32>> InPointLightPerTiles)
-{
-    PointLights = InPointLights; 
-    PointLightPerTiles = InPointLightPerTiles;
-
-    uint32 TotalTiles = PointLightPerTiles.Num();
-    GPointLightPerTiles.Empty();
-    GPointLightPerTiles.SetNum(TotalTiles);
-
-    for (uint32 TileIndex = 0; TileIndex < TotalTiles; ++TileIndex)
-    {
-        const TArray<uint32>& TileLightList = InPointLightPerTiles[TileIndex];
-        PointLightPerTile TileData = {};
-        TileData.NumLights = TileLightList.Num();
-        TileData.NumLights = FMath::Min<uint32>(TileData.NumLights, MAX_POINTLIGHT_PER_TILE);
-
-        // 각 조명 인덱스를 TileData.Indice 배열에 복사합니다.
-        for (uint32 i = 0; i < TileData.NumLights; ++i)
-        {
-            TileData.Indices[i] = TileLightList[i];
-        }
-        GPointLightPerTiles[TileIndex] = TileData;
-    }
-
-    UpdatePointLightBuffer();
-    UpdatePointLightPerTilesBuffer();
-}
-
-void FUpdateLightBufferPass::SetSpotLightData(const TArray<USpotLightComponent*>& InSpotLights, TArray<TArray<uint32>> InSpotLightPerTiles)
-{
-    SpotLights = InSpotLights;
-    SpotLightPerTiles = InSpotLightPerTiles;
-
-    uint32 TotalTiles = SpotLightPerTiles.Num();
-    GSpotLightPerTiles.Empty();
-    GSpotLightPerTiles.SetNum(TotalTiles);
-
-    for (uint32 TileIndex = 0; TileIndex < TotalTiles; ++TileIndex)
-    {
-        const TArray<uint32>& TileLightList = InSpotLightPerTiles[TileIndex];
-        SpotLightPerTile TileData = {};
-        TileData.NumLights = TileLightList.Num();
-        TileData.NumLights = FMath::Min<uint32>(TileData.NumLights, MAX_SPOTLIGHT_PER_TILE);
-
-        // 각 조명 인덱스를 TileData.Indice 배열에 복사합니다.
-        for (uint32 i = 0; i < TileData.NumLights; ++i)
-        {
-            TileData.Indices[i] = TileLightList[i];
-        }
-        GSpotLightPerTiles[TileIndex] = TileData;
-    }
-
-    UpdateSpotLightBuffer();
-    UpdateSpotLightPerTilesBuffer();
-}
-
 void FUpdateLightBufferPass::SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights,
     ID3D11ShaderResourceView* InPointLightIndexBufferSRV, ID3D11ShaderResourceView* InSpotLightIndexBufferSRV)
 {
@@ -391,34 +334,3 @@ void FUpdateLightBufferPass::UpdateSpotLightBuffer()
     Graphics->DeviceContext->UpdateSubresource(SpotLightBuffer, 0, nullptr,
         TempBuffer.GetData(), 0, 0);
 }
-
-void FUpdateLightBufferPass::UpdatePointLightPerTilesBuffer()
-{
-    if (GPointLightPerTiles.Num() == 0 || !PointLightPerTilesBuffer)
-        return;
-
-    TArray<PointLightPerTile> TempBuffer;
-    TempBuffer.SetNum(MAX_TILE);
-    for (uint32 i = 0; i < GPointLightPerTiles.Num(); ++i)
-    {
-        TempBuffer[i] = GPointLightPerTiles[i];
-    }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(PointLightPerTilesBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
-}
-
-void FUpdateLightBufferPass::UpdateSpotLightPerTilesBuffer()
-{
-    if (GSpotLightPerTiles.Num() == 0 || !SpotLightPerTilesBuffer)
-        return;
-    TArray<SpotLightPerTile> TempBuffer;
-    TempBuffer.SetNum(MAX_TILE);
-    for (uint32 i = 0; i < GSpotLightPerTiles.Num(); ++i)
-    {
-        TempBuffer[i] = GSpotLightPerTiles[i];
-    }
-    // 이제 TempBuffer에 대해 업데이트
-    Graphics->DeviceContext->UpdateSubresource(SpotLightPerTilesBuffer, 0, nullptr,
-        TempBuffer.GetData(), 0, 0);
-}
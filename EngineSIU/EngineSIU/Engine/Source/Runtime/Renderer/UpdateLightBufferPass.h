@@ -38,8 +38,6 @@ public:
     virtual void ClearRenderArr() override;
     void UpdateLightBuffer() const;
 
-    void SetPointLightData(const TArray<UPointLightComponent*>& InPointLights, TArray<TArray<uint32>> InPointLightPerTiles);
-    void SetSpotLightData(const TArray<USpotLightComponent*>& InSpotLights, TArray<TArray<uint32>> InSpotLightPerTiles);
     void SetLightData(const TArray<UPointLightComponent*>& InPointLights, const TArray<USpotLightComponent*>& InSpotLights, ID3D11ShaderResourceView* InPointLightIndexBufferSRV, ID3D11ShaderResourceView* InSpotLightIndexBufferSRV);
 
     void SetTileConstantBuffer(ID3D11Buffer* InTileConstantBuffer);
@@ -53,9 +51,6 @@ public:
     void UpdatePointLightBuffer();
     void UpdateSpotLightBuffer();
 
-    void UpdatePointLightPerTilesBuffer();
-    void UpdateSpotLightPerTilesBuffer();
-
 private:
     TArray<USpotLightComponent*> SpotLights;
     TArray<UPointLightComponent*> PointLights;
@@ -66,12 +61,6 @@ private:
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
 
-    TArray<TArray<uint32>> PointLightPerTiles;
-    TArray<PointLightPerTile> GPointLightPerTiles;
-
-    TArray<TArray<uint32>> SpotLightPerTiles;
-    TArray<SpotLightPerTile> GSpotLightPerTiles;
-
     ID3D11Buffer* PointLightBuffer;
     ID3D11ShaderResourceView* PointLightSRV;
 
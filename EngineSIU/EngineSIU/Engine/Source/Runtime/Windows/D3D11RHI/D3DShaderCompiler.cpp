@@ -0,0 +1,95 @@
+#include "D3DShaderCompiler.h"
+
+#include <cstring>
+
+#include "CoreMiscDefines.h"
+
+
+namespace
+{
+    /** CollectSources가 해석해 둔 include 결과를 D3DCompile에 넘겨주는 ID3DInclude */
+    class FSourceFileInclude : public ID3DInclude
+    {
+    public:
+        explicit FSourceFileInclude(const TArray<FShaderSourceFile>& InSources)
+            : Sources(InSources)
+        {
+        }
+
+        HRESULT __stdcall Open(D3D_INCLUDE_TYPE IncludeType, LPCSTR FileName, LPCVOID ParentData, LPCVOID* OutData, UINT* OutBytes) override
+        {
+            // ParentData는 메인 파일이면 nullptr, include된 파일이면 이전에 Open이 돌려준 버퍼
+            int32 ParentIndex = 0;
+            for (int32 Index = 0; Index < Sources.Num(); ++Index)
+            {
+                if (Sources[Index].Text.data() == ParentData)
+                {
+                    ParentIndex = Index;
+                    break;
+                }
+            }
+
+            for (const auto& [IncludeName, IncludeIndex] : Sources[ParentIndex].Includes)
+            {
+                if (IncludeIndex != INDEX_NONE && IncludeName == FileName)
+                {
+                    const std::string& Text = Sources[IncludeIndex].Text;
+                    *OutData = Text.data();
+                    *OutBytes = static_cast<UINT>(Text.size());
+                    return S_OK;
+                }
+            }
+            return E_FAIL;
+        }
+
+        HRESULT __stdcall Close(LPCVOID Data) override
+        {
+            return S_OK;
+        }
+
+    private:
+        const TArray<FShaderSourceFile>& Sources;
+    };
+}
+
+bool FD3DShaderCompiler::Compile(const FShaderCompileRequest& Request, const TArray<FShaderSourceFile>& Sources, TArray<uint8>& OutBytecode, std::string& OutError)
+{
+    std::vector<D3D_SHADER_MACRO> Macros;
+    Macros.reserve(Request.Defines.size() + 1);
+    for (const auto& [Name, Definition] : Request.Defines)
+    {
+        Macros.push_back({ Name.c_str(), Definition.c_str() });
+    }
+    Macros.push_back({ nullptr, nullptr });
+
+    FSourceFileInclude Include(Sources);
+    const std::string SourceName = Sources[0].Path.string();
+
+    ID3DBlob* CodeBlob = nullptr;
+    ID3DBlob* ErrorBlob = nullptr;
+    const HRESULT hr = D3DCompile(
+        Sources[0].Text.data(), Sources[0].Text.size(), SourceName.c_str(),
+        Macros.data(), &Include, Request.EntryPoint.c_str(), Request.Profile.c_str(),
+        Request.Flags, 0, &CodeBlob, &ErrorBlob
+    );
+
+    if (ErrorBlob)
+    {
+        OutError.assign(static_cast<const char*>(ErrorBlob->GetBufferPointer()), ErrorBlob->GetBufferSize());
+        ErrorBlob->Release();
+    }
+
+    if (FAILED(hr) || CodeBlob == nullptr)
+    {
+        if (CodeBlob)
+        {
+            CodeBlob->Release();
+        }
+        return false;
+    }
+
+    OutBytecode.SetNum(static_cast<int32>(CodeBlob->GetBufferSize()));
+    std::memcpy(OutBytecode.GetData(), CodeBlob->GetBufferPointer(), CodeBlob->GetBufferSize());
+    CodeBlob->Release();
+    return true;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#define _TCHAR_DEFINED
+#include <d3dcompiler.h>
+
+#include "Renderer/ShaderCache.h"
+
+
+/**
+ * D3DCompile을 사용하는 IShaderCompilerBackend
+ *
+ * include는 디스크에서 다시 읽지 않고 ShaderCache::CollectSources가 읽어 둔 내용을 그대로 넘깁니다.
+ */
+class FD3DShaderCompiler : public IShaderCompilerBackend
+{
+public:
+    virtual const char* GetName() const override { return "D3DCompiler_47"; }
+
+    virtual bool Compile(const FShaderCompileRequest& Request, const TArray<FShaderSourceFile>& Sources, TArray<uint8>& OutBytecode, std::string& OutError) override;
+};
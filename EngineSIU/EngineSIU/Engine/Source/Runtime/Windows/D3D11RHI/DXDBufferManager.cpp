@@ -3,6 +3,8 @@
 #include <codecvt>
 #include <locale>
 
+#include "Renderer/TextGlyphTable.h"
+
 void FDXDBufferManager::Initialize(ID3D11Device* InDXDevice, ID3D11DeviceContext* InDXDeviceContext)
 {
     DXDevice = InDXDevice;
@@ -31,6 +33,8 @@ void FDXDBufferManager::ReleaseBuffers()
         }
     }
     IndexBufferPool.Empty();
+
+    TextBufferCache.Empty();
 }
 
 void FDXDBufferManager::ReleaseConstantBuffer()
@@ -166,120 +170,39 @@ void FDXDBufferManager::GetTextBuffer(const FWString& Text, FVertexInfo& OutVert
 HRESULT FDXDBufferManager::CreateUnicodeTextBuffer(const FWString& Text, FBufferInfo& OutBufferInfo,
     float BitmapWidth, float BitmapHeight, float ColCount, float RowCount)
 {
-    if (TextAtlasBufferPool.Contains(Text))
+    if (const FVertexInfo* CachedVertexInfo = TextBufferCache.Find(Text))
     {
-        OutBufferInfo = TextAtlasBufferPool[Text];
+        OutBufferInfo.VertexInfo = *CachedVertexInfo;
         return S_OK;
     }
 
     TArray<FVertexTexture> Vertices;
-
-    // 각 글자에 대한 기본 쿼드 크기 (폭과 높이)
-    const float quadWidth = 2.0f;
-    const float quadHeight = 2.0f;
-
-    // 전체 텍스트의 너비
-    float totalTextWidth = quadWidth * Text.size();
-    // 텍스트의 중앙으로 정렬하기 위한 오프셋
-    float centerOffset = totalTextWidth / 2.0f;
-
-    float CellWidth = float(BitmapWidth) / ColCount; // 컬럼별 셀 폭
-    float CellHeight = float(BitmapHeight) / RowCount; // 행별 셀 높이
-
-    float nTexelUOffset = CellWidth / BitmapWidth;
-    float nTexelVOffset = CellHeight / BitmapHeight;
-
-    for (int i = 0; i < Text.size(); i++)
+    FTextGlyphTable::AppendGlyphQuads(Text, ColCount, RowCount, Vertices);
+    if (Vertices.IsEmpty())
     {
-        // 각 글자에 대해 기본적인 사각형 좌표 설정 (원점은 -1.0f부터 시작)
-        FVertexTexture leftUP = { -1.0f,  1.0f, 0.0f, 0.0f, 0.0f };
-        FVertexTexture rightUP = { 1.0f,  1.0f, 0.0f, 1.0f, 0.0f };
-        FVertexTexture leftDown = { -1.0f, -1.0f, 0.0f, 0.0f, 1.0f };
-        FVertexTexture rightDown = { 1.0f, -1.0f, 0.0f, 1.0f, 1.0f };
-
-        // UV 좌표 관련 보정 (nTexel 오프셋 적용)
-        rightUP.u *= nTexelUOffset;
-        leftDown.v *= nTexelVOffset;
-        rightDown.u *= nTexelUOffset;
-        rightDown.v *= nTexelVOffset;
-
-        // 각 글자의 x 좌표에 대해 오프셋 적용 (중앙 정렬을 위해 centerOffset 만큼 빼줌)
-        float xOffset = quadWidth * i - centerOffset;
-        leftUP.x += xOffset;
-        rightUP.x += xOffset;
-        leftDown.x += xOffset;
-        rightDown.x += xOffset;
-
-        FVector2D UVOffset;
-        SetStartUV(Text[i], UVOffset);
-
-        leftUP.u += (nTexelUOffset * UVOffset.X);
-        leftUP.v += (nTexelVOffset * UVOffset.Y);
-        rightUP.u += (nTexelUOffset * UVOffset.X);
-        rightUP.v += (nTexelVOffset * UVOffset.Y);
-        leftDown.u += (nTexelUOffset * UVOffset.X);
-        leftDown.v += (nTexelVOffset * UVOffset.Y);
-        rightDown.u += (nTexelUOffset * UVOffset.X);
-        rightDown.v += (nTexelVOffset * UVOffset.Y);
-
-        // 각 글자의 쿼드를 두 개의 삼각형으로 생성
-        Vertices.Add(leftUP);
-        Vertices.Add(rightUP);
-        Vertices.Add(leftDown);
-        Vertices.Add(rightUP);
-        Vertices.Add(rightDown);
-        Vertices.Add(leftDown);
+        OutBufferInfo.VertexInfo = {};
+        return S_OK;
     }
 
-    CreateVertexBuffer(Text, Vertices, OutBufferInfo.VertexInfo);
-    TextAtlasBufferPool[Text] = OutBufferInfo;
+    D3D11_BUFFER_DESC BufferDesc = {};
+    BufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    BufferDesc.ByteWidth = sizeof(FVertexTexture) * Vertices.Num();
+    BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 
-    return S_OK;
-}
+    D3D11_SUBRESOURCE_DATA InitData = {};
+    InitData.pSysMem = Vertices.GetData();
 
-void FDXDBufferManager::SetStartUV(wchar_t hangul, FVector2D& UVOffset)
-{
-    //대문자만 받는중
-    int StartU = 0;
-    int StartV = 0;
-    int offset = -1;
-
-    if (hangul == L' ') {
-        UVOffset = FVector2D(0, 0);  // Space는 특별히 UV 좌표를 (0,0)으로 설정
-        offset = 0;
-        return;
-    }
-    else if (hangul >= L'A' && hangul <= L'Z') {
-
-        StartU = 11;
-        StartV = 0;
-        offset = hangul - L'A'; // 대문자 위치
-    }
-    else if (hangul >= L'a' && hangul <= L'z') {
-        StartU = 37;
-        StartV = 0;
-        offset = (hangul - L'a'); // 소문자는 대문자 다음 위치
-    }
-    else if (hangul >= L'0' && hangul <= L'9') {
-        StartU = 1;
-        StartV = 0;
-        offset = (hangul - L'0'); // 숫자는 소문자 다음 위치
-    }
-    else if (hangul >= L'가' && hangul <= L'힣')
+    ID3D11Buffer* NewBuffer = nullptr;
+    const HRESULT hr = DXDevice->CreateBuffer(&BufferDesc, &InitData, &NewBuffer);
+    if (FAILED(hr))
     {
-        StartU = 63;
-        StartV = 0;
-        offset = hangul - L'가'; // 대문자 위치
+        return hr;
     }
 
-    if (offset == -1)
-    {
-        UE_LOG(LogLevel::Warning, "Text Error");
-    }
-
-    int offsetV = (offset + StartU) / 106;
-    int offsetU = (offset + StartU) % 106;
-
-    UVOffset = FVector2D(offsetU, StartV + offsetV);
+    OutBufferInfo.VertexInfo.NumVertices = static_cast<uint32>(Vertices.Num());
+    OutBufferInfo.VertexInfo.Stride = sizeof(FVertexTexture);
+    OutBufferInfo.VertexInfo.VertexBuffer = NewBuffer;
+    TextBufferCache.Add(Text, OutBufferInfo.VertexInfo);
 
+    return S_OK;
 }
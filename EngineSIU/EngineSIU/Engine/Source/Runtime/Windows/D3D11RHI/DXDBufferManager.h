@@ -8,6 +8,7 @@
 #include "Container/Map.h"
 #include "Engine/Texture.h"
 #include "GraphicDevice.h"
+#include "TextBufferCache.h"
 #include "UserInterface/Console.h"
 
 #include "Rendering/Types/Buffers.h"
@@ -57,9 +58,13 @@ public:
     HRESULT CreateVertexBufferInternal(const FWString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
         D3D11_USAGE usage, UINT cpuAccessFlags);
 
+    /**
+     * 바뀌지 않는 문자열의 정점 버퍼를 만들어 LRU 캐시에 보관합니다. 오래 쓰지 않은 문자열의 버퍼는 Release되므로 OutBufferInfo는 그 프레임에만 사용합니다.
+     * 매 프레임 그리는 월드 텍스트는 FTextRenderBatch를 사용합니다.
+     */
     HRESULT CreateUnicodeTextBuffer(const FWString& Text, FBufferInfo& OutBufferInfo, float BitmapWidth, float BitmapHeight, float ColCount, float RowCount);
 
-    void SetStartUV(wchar_t hangul, FVector2D& UVOffset);
+    const FTextBufferCacheStats& GetTextBufferCacheStats() const { return TextBufferCache.GetStats(); }
     
     void ReleaseBuffers();
     void ReleaseConstantBuffer();
@@ -103,7 +108,7 @@ private:
     TMap<FString, FIndexInfo> IndexBufferPool;
     TMap<FString, ID3D11Buffer*> ConstantBufferPool;
 
-    TMap<FWString, FBufferInfo> TextAtlasBufferPool;
+    FTextBufferCache TextBufferCache;
     TMap<FWString, FVertexInfo> TextAtlasVertexBufferPool;
     TMap<FWString, FIndexInfo> TextAtlasIndexBufferPool;
 };
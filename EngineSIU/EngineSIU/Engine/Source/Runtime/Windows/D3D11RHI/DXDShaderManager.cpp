@@ -1,10 +1,20 @@
 #include "DXDShaderManager.h"
 #include "Define.h"
-#include <filesystem>
-#include <fstream>
-#include <sstream>
-#include <unordered_set>
-#include <functional>
+#include "Stats/Stats.h"
+
+namespace
+{
+    const std::filesystem::path ShaderRoot = L"Shaders";
+
+    UINT GetDefaultCompileFlags()
+    {
+        UINT ShaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
+#ifdef _DEBUG
+        ShaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#endif
+        return ShaderFlags;
+    }
+}
 
 FDXDShaderManager::FDXDShaderManager(ID3D11Device* Device)
     : DXDDevice(Device)
@@ -17,6 +27,15 @@ FDXDShaderManager::FDXDShaderManager(ID3D11Device* Device)
 
 FDXDShaderManager::~FDXDShaderManager()
 {
+    // Job이 Compiler와 BinaryCache를 사용하므로 먼저 끝나기를 기다림
+    for (FPendingRecompile* Pending : PendingRecompiles)
+    {
+        FJobSystem::Get().Wait(Pending->Counter);
+        delete Pending;
+    }
+    PendingRecompiles.Empty();
+
+    ShaderWatcher.Shutdown();
     ReleaseAllShader();
 }
 
@@ -32,6 +51,16 @@ void FDXDShaderManager::ReleaseAllShader()
     }
     VertexShaders.Empty();
 
+    for (auto& [Key, Layout] : InputLayouts)
+    {
+        if (Layout)
+        {
+            Layout->Release();
+            Layout = nullptr;
+        }
+    }
+    InputLayouts.Empty();
+
     for (auto& [Key, Shader] : PixelShaders)
     {
         if (Shader)
@@ -64,727 +93,294 @@ void FDXDShaderManager::ReleaseAllShader()
 
 }
 
-// VS & IL / PS Outdated 여부 확인 후 업데이트 
-void FDXDShaderManager::UpdateShaderIfOutdated(const std::wstring Key, const std::wstring FilePath, const std::string EntryPoint, bool IsVertexShader, const D3D_SHADER_MACRO* Defines, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32 LayoutSize)
+std::wstring FDXDShaderManager::MakeReloadKey(const std::wstring& Key, const std::string& Profile)
 {
-    if (!std::filesystem::exists(FilePath)) { return; }
-
-    auto currentTime = std::filesystem::last_write_time(FilePath);
-    auto* FoundTime = ShaderTimeStamps.Find(Key);
-    if (!FoundTime) { // Key 값에 대한 value 없을 시 새로 만들어 줌
-        ShaderTimeStamps.Add(Key, currentTime);
-        return;
-    }
-    //if (*FoundTime == currentTime) // Map에 저장된 마지막 수정 타임이 현재와 똑같을 경우
-    //    return;
-
-    if (IsVertexShader)
-    {
-        ShaderTimeStamps[Key] = currentTime;
-        (Defines)
-            ? AddVertexShaderAndInputLayout(Key, FilePath, EntryPoint, Layout, LayoutSize, Defines)
-            : AddVertexShaderAndInputLayout(Key, FilePath, EntryPoint, Layout, LayoutSize);
-    }
-    else
-    {
-        // Pixel Shader Map에 존재한다면 해당 PS 제거
-        if (PixelShaders.Contains(Key)) {
-            (Defines)
-                ? AddPixelShader(Key, FilePath, EntryPoint, Defines)
-                : AddPixelShader(Key, FilePath, EntryPoint);
-        }
-        // Pixel Shader가 아니라면 Compute Shader로 간주
-        else if (ComputeShaders.Contains(Key))
-        {
-            AddComputeShader(Key, FilePath, EntryPoint);
-        }
-        else
-        {
-            AddGeometryShader(Key, FilePath, EntryPoint);
-        }
-        ShaderTimeStamps[Key] = currentTime;
-    }
-    
+    return std::wstring(Profile.begin(), Profile.end()) + L":" + Key;
 }
 
-// 리로드 대상이 될 모든 Shader 등록 함수 
-void FDXDShaderManager::RegisterShaderForReload(std::wstring Key, std::wstring FilePath, std::string EntryPoint, bool IsVertexShader, D3D_SHADER_MACRO* Defines, D3D11_INPUT_ELEMENT_DESC* Layout, uint32 LayoutSize)
+void FDXDShaderManager::ReloadAllShaders()
 {
-    FShaderReloadInfo Info{ Key, FilePath, EntryPoint, IsVertexShader };
+    QUICK_SCOPE_CYCLE_COUNTER(ShaderHotReload_CPU)
 
-    if (Defines)
+    // 1. 바뀐 파일을 사용하는 셰이더의 컴파일 Job을 띄움
+    TArray<FString> ChangedFiles;
+    ShaderWatcher.DrainChanges(ChangedFiles);
+
+    TSet<std::wstring> ShadersToRecompile;
+    for (const FString& ChangedFile : ChangedFiles)
     {
-        while (Defines->Name)
+        TArray<std::wstring> Dependents;
+        DependencyGraph.GetDependents(std::filesystem::path(ChangedFile.ToWideString()), Dependents);
+        for (const std::wstring& ReloadKey : Dependents)
         {
-            D3D_SHADER_MACRO CopyMacro;
-            CopyMacro.Name = _strdup(Defines->Name); // LPCSTR = char* 버전
-            CopyMacro.Definition = _strdup(Defines->Definition);
-            Info.Defines.emplace_back(CopyMacro);
-            ++Defines;
+            ShadersToRecompile.Add(ReloadKey);
         }
-        Info.Defines.emplace_back(D3D_SHADER_MACRO{ nullptr, nullptr });
-    }
-
-    if (Layout && LayoutSize > 0)
-    {
-        Info.Layout.assign(Layout, Layout + LayoutSize);
     }
 
-    RegisteredShaders.push_back(Info);
-
-    // 메인 셰이더 파일의 타임스탬프를
-    if (std::filesystem::exists(FilePath))
+    for (const std::wstring& ReloadKey : ShadersToRecompile)
     {
-        ShaderTimeStamps.Add(Key, std::filesystem::last_write_time(FilePath));
+        DispatchRecompile(ReloadKey);
     }
-    
-    BuildDependency(Info); // 해당 셰이더 파일이 포함하는 셰이더(헤더) 파일을 모두 찾아 graph, date 기록
-}
-
-// 모든 리로드 대상 Shader에 대해 업데이트 시도
-void FDXDShaderManager::ReloadAllShaders()  
-{  
-   auto Copied = RegisteredShaders;
-   bool bAnyUpdated = false;
-   for (const auto& Shader : Copied)
-   {  
-       if (!IsOutdatedWithDependency(Shader)) { continue; } // 갱신 필요없으면 skip
-
-       const D3D_SHADER_MACRO* definesPtr = Shader.Defines.empty() ? nullptr : Shader.Defines.data();
-       const D3D11_INPUT_ELEMENT_DESC* layoutPtr = Shader.Layout.empty() ? nullptr : Shader.Layout.data();
-       UpdateShaderIfOutdated(
-           Shader.Key,
-           Shader.FilePath,
-           Shader.EntryPoint,
-           Shader.IsVertexShader,
-           definesPtr,
-           layoutPtr,
-           static_cast<uint32>(Shader.Layout.size())
-       );
-       UE_LOG(LogLevel::Display, TEXT("%ls Updated"), Shader.Key.c_str());
-
-       // 업데이트 후, 해당 셰이더 자신과 인클루드하는 모든 파일 타임스탬프 갱신
-       if (std::filesystem::exists(Shader.FilePath))
-       {
-           ShaderTimeStamps[Shader.Key] = std::filesystem::last_write_time(Shader.FilePath);
-       }
-       bAnyUpdated = true;
-   }
-
-   // 하나라도 업데이트 된 경우, 의존성 그래프에 있는 모든 include 파일들의 타임스탬프를 갱신
-   if (bAnyUpdated) { UpdateDependencyTimestamps(); }
-}
-
-
-
-#ifdef Multi_Shader_Include
-void FDXDShaderManager::BuildDependency(const FShaderReloadInfo& Info)
-{
-    std::wifstream wfile(Info.FilePath);
-    if (!wfile.is_open()) return;
-
-    std::wstring line;
-    const std::wstring includeToken = L"#include";
-    std::unordered_set<std::wstring> uniqueIncludes;
 
-    while (std::getline(wfile, line))
+    // 2. 끝난 Job의 셰이더를 교체
+    for (int32 Index = 0; Index < PendingRecompiles.Num();)
     {
-        size_t pos = line.find(includeToken);
-        if (pos != std::wstring::npos)
+        FPendingRecompile* Pending = PendingRecompiles[Index];
+        if (!Pending->Counter.IsDone())
         {
-            size_t start = line.find(L"\"", pos);
-            size_t end = line.find(L"\"", start + 1);
-            if (start != std::wstring::npos && end != std::wstring::npos)
-            {
-                std::wstring includeFile = line.substr(start + 1, end - start - 1);
-
-                // 중복 방지
-                if (!uniqueIncludes.insert(includeFile).second) continue;
-
-                ShaderDependencyGraph[includeFile].Add(Info.Key);
-
-                std::wstring fullPath = L"Shaders/" + includeFile;
-                if (std::filesystem::exists(fullPath))
-                {
-                    auto currentTime = std::filesystem::last_write_time(fullPath);
-                    ShaderTimeStamps.Add(includeFile, currentTime);
-
-                    // 중첩 include 탐색 재귀 호출
-                    FShaderReloadInfo DummyInfo;
-                    DummyInfo.FilePath = fullPath;
-                    DummyInfo.Key = Info.Key;
-                    BuildDependency(DummyInfo);
-                }
-            }
+            ++Index;
+            continue;
         }
-    }
-}
-
-bool FDXDShaderManager::IsOutdatedWithDependency(const FShaderReloadInfo& Info)
-{
-    std::unordered_set<std::wstring> Visited;
-    std::function<bool(const std::wstring&)> CheckDependency = [&](const std::wstring& includeFile) -> bool
-        {
-            if (Visited.contains(includeFile)) return false;
-            Visited.insert(includeFile);
-
-            std::wstring fullPath = L"Shaders/" + includeFile;
-            if (std::filesystem::exists(fullPath))
-            {
-                auto depTime = std::filesystem::last_write_time(fullPath);
-                auto* storedDepTime = ShaderTimeStamps.Find(includeFile);
-                if (!storedDepTime || *storedDepTime != depTime)
-                {
-                    return true;
-                }
-            }
-
-            // 중첩 의존성 확인
-            if (ShaderDependencyGraph.Contains(includeFile))
-            {
-                for (const auto& key : ShaderDependencyGraph[includeFile])
-                {
-                    if (key == Info.Key && CheckDependency(includeFile))
-                    {
-                        return true;
-                    }
-                }
-            }
-
-            return false;
-        };
 
-    for (const auto& [includeFile, shaderKeys] : ShaderDependencyGraph)
-    {
-        if (shaderKeys.Contains(Info.Key))
+        const FShaderCompileResult& Result = Pending->Result;
+        if (!Pending->bSucceeded)
         {
-            if (CheckDependency(includeFile))
-            {
-                return true;
-            }
+            ++CacheStats.NumFailed;
+            UE_LOG(LogLevel::Error, TEXT("%ls Reload Failed: %s"), Pending->ReloadKey.c_str(), Result.Error.c_str());
         }
-    }
-
-    // 메인 셰이더 파일 검사
-    if (!std::filesystem::exists(Info.FilePath)) { return false; }
-    auto currentTime = std::filesystem::last_write_time(Info.FilePath);
-    auto* FoundTime = ShaderTimeStamps.Find(Info.Key);
-    if (!FoundTime || (*FoundTime != currentTime)) { return true; }
-
-    return false;
-}
-
-void FDXDShaderManager::UpdateDependencyTimestamps()
-{
-    std::unordered_set<std::wstring> Visited;
-
-    std::function<void(const std::wstring&)> UpdateRecursive = [&](const std::wstring& includeFile)
-        {
-            if (Visited.contains(includeFile)) return;
-            Visited.insert(includeFile);
-
-            std::wstring fullPath = L"Shaders/" + includeFile;
-            if (std::filesystem::exists(fullPath))
-            {
-                ShaderTimeStamps[includeFile] = std::filesystem::last_write_time(fullPath);
-            }
-
-            // 중첩 include도 재귀적으로 갱신
-            if (ShaderDependencyGraph.Contains(includeFile))
-            {
-                for (const auto& nestedKey : ShaderDependencyGraph[includeFile])
-                {
-                    UpdateRecursive(includeFile);
-                }
-            }
-        };
-
-    for (const auto& [includeFile, shaderKeys] : ShaderDependencyGraph)
-    {
-        UpdateRecursive(includeFile);
-    }
-}
-#else
-void FDXDShaderManager::BuildDependency(const FShaderReloadInfo& Info)
-{
-    std::wifstream wfile(Info.FilePath);
-    if (!wfile.is_open())
-        return;
-
-    std::wstring line;
-    const std::wstring includeToken = L"#include";
-    while (std::getline(wfile, line))
-    {
-        size_t pos = line.find(includeToken);
-        if (pos != std::wstring::npos)
+        else if (SUCCEEDED(CreateShader(Pending->Info, Result.Bytecode)))
         {
-            // 예를 들어, #include "Common.hlsl" 형태를 찾음
-            size_t start = line.find(L"\"", pos);
-            size_t end = line.find(L"\"", start + 1);
-            if (start != std::wstring::npos && end != std::wstring::npos)
-            {
-                std::wstring includeFile = line.substr(start + 1, end - start - 1);
-                // include 파일 경로가 상대경로라면 처리하는 코드 추가 가능
-                // 1. 의존성 그래프에 추가
-                // 2. Shader 타임 스탬프에 수정시각 추가
-                ShaderDependencyGraph[includeFile].Add(Info.Key);
-                if (std::filesystem::exists(L"Shaders/"+includeFile))
-                {
-                    auto currentTime = std::filesystem::last_write_time(L"Shaders/"+includeFile);
-                    ShaderTimeStamps.Add(includeFile, currentTime);
-                }
-            }
+            ++(Result.bCacheHit ? CacheStats.NumCacheHits : CacheStats.NumCompiles);
+            ++CacheStats.NumHotReloads;
+            UE_LOG(LogLevel::Display, TEXT("%ls Updated (%.1fms on worker%s)"), Pending->ReloadKey.c_str(), Result.ElapsedMs, Result.bCacheHit ? ", cached" : "");
         }
-    }
-}
-bool FDXDShaderManager::IsOutdatedWithDependency(const FShaderReloadInfo& Info)
-{
-    // 의존성 include 파일들의 수정 시각 검사
-    for (const auto& [includeFile, shaderKeys] : ShaderDependencyGraph)
-    {
-        // 이 셰이더가 include하는 파일이라면 검사
-        if (shaderKeys.Contains(Info.Key))
+
+        // 실패했어도 include 목록은 바뀌었을 수 있으므로 새로 감시
+        if (!Result.SourceFiles.IsEmpty())
         {
-            if (std::filesystem::exists(L"Shaders/"+includeFile))
-            {
-                auto depTime = std::filesystem::last_write_time(L"Shaders/" + includeFile);
-                auto* storedDepTime = ShaderTimeStamps.Find(includeFile);
-                // 저장된 타임스탬프가 없거나, 현재 수정 시각과 다르면 => 변경됨
-                if (!storedDepTime || *storedDepTime != depTime)
-                {
-                    return true;
-                }
-            }
+            TrackSourceFiles(Pending->ReloadKey, Result.SourceFiles);
         }
-    } 
 
-    // 2. 그 후, 메인 셰이더 파일의 수정 시각 검사
-    if (!std::filesystem::exists(Info.FilePath)) { return false; }
-    auto currentTime = std::filesystem::last_write_time(Info.FilePath);
-    auto* FoundTime = ShaderTimeStamps.Find(Info.Key);
-    // 만약 메인 파일의 저장된 타임스탬프가 없거나 현재와 다르면 변경된 것으로 처리
-    if (!FoundTime || (*FoundTime != currentTime)) { return true; }
+        const std::wstring ReloadKey = Pending->ReloadKey;
+        const bool bChangedAgain = Pending->bChangedAgain;
 
-    return false;
-}
+        PendingRecompiles.RemoveAt(Index);
+        delete Pending;
 
-void FDXDShaderManager::UpdateDependencyTimestamps()
-{
-    // 모든 의존(Include) 파일의 타임스탬프를 갱신
-    for (const auto& [includeFile, shaderKeys] : ShaderDependencyGraph)
-    {
-        std::wstring fullPath = L"Shaders/" + includeFile;
-        if (std::filesystem::exists(fullPath))
+        if (bChangedAgain)
         {
-            ShaderTimeStamps[includeFile] = std::filesystem::last_write_time(fullPath);
+            DispatchRecompile(ReloadKey);
         }
     }
 }
-#endif
 
-HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+void FDXDShaderManager::DispatchRecompile(const std::wstring& ReloadKey)
 {
-    UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-    shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-    HRESULT hr = S_OK;
-
-    if (DXDDevice == nullptr)
-        return S_FALSE;
-
-    ID3DBlob* PsBlob = nullptr;
-    ID3DBlob* ErrorBlob = nullptr;
-    hr = D3DCompileFromFile(FileName.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "ps_5_0", shaderFlags, 0, &PsBlob, &ErrorBlob);
-    if (FAILED(hr))
-    {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Pixel Shader Compile Error", MB_OK | MB_ICONERROR);
-        std::string error = (char*)ErrorBlob->GetBufferPointer();
-        return hr;
-    }
-
-    ID3D11PixelShader* NewPixelShader;
-    hr = DXDDevice->CreatePixelShader(PsBlob->GetBufferPointer(), PsBlob->GetBufferSize(), nullptr, &NewPixelShader);
-    if (PsBlob)
+    const FShaderReloadInfo* Info = RegisteredShaders.Find(ReloadKey);
+    if (Info == nullptr)
     {
-        PsBlob->Release();
-    }
-    if (FAILED(hr))
-    {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Pixel Shader Create Error", MB_OK | MB_ICONERROR);
-        return hr;
+        return;
     }
 
-    if (SUCCEEDED(hr) && !PixelShaders.Contains(Key))
+    for (FPendingRecompile* Pending : PendingRecompiles)
     {
-        RegisterShaderForReload(Key, FileName, EntryPoint, false, nullptr, nullptr, 0);
+        if (Pending->ReloadKey == ReloadKey)
+        {
+            Pending->bChangedAgain = true;
+            return;
+        }
     }
 
-    // Pixel Shader Map에 존재한다면 해당 PS 제거
-    if (PixelShaders.Contains(Key)) { PixelShaders[Key]->Release();PixelShaders[Key] = nullptr; }
+    FPendingRecompile* Pending = new FPendingRecompile();
+    Pending->ReloadKey = ReloadKey;
+    Pending->Info = *Info;
+    PendingRecompiles.Add(Pending);
 
-    PixelShaders[Key] = NewPixelShader;
-    
-    return S_OK;
+    static TStatId StatId(TEXT("ShaderRecompile"));
+    FJobSystem::Get().Dispatch(StatId, [this, Pending]()
+    {
+        Pending->bSucceeded = ShaderCache::CompileWithCache(Pending->Info.Request, ShaderRoot, BinaryCache, Compiler, Pending->Result);
+    }, &Pending->Counter);
 }
 
-HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines)
+void FDXDShaderManager::TrackSourceFiles(const std::wstring& ReloadKey, const TArray<std::filesystem::path>& SourceFiles)
 {
-	UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-	shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-	HRESULT hr = S_OK;
-
-	if (DXDDevice == nullptr)
-		return S_FALSE;
-
-	ID3DBlob* PsBlob = nullptr;
-
-    ID3DBlob* errorBlob = nullptr;
-	//hr = D3DCompileFromFile(FileName.c_str(), defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "ps_5_0", shaderFlags, 0, &PsBlob, nullptr);
-	//if (FAILED(hr))
-	//	return hr;
-    hr = D3DCompileFromFile(FileName.c_str(), defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "ps_5_0", shaderFlags, 0, &PsBlob, &errorBlob);
-
-    if (FAILED(hr)) {
-        if (errorBlob) {
-            // 에러 메시지를 문자열로 변환하여 출력
-            const char* errorMsg = static_cast<const char*>(errorBlob->GetBufferPointer());
-            OutputDebugStringA(errorMsg); // 디버그 창에 출력
-            MessageBoxA(NULL, errorMsg, "Shader Compilation Error", MB_OK); // 팝업 창으로 표시
-            errorBlob->Release();
-        }
-        return hr;
-    }
-
-	ID3D11PixelShader* NewPixelShader;
-	hr = DXDDevice->CreatePixelShader(PsBlob->GetBufferPointer(), PsBlob->GetBufferSize(), nullptr, &NewPixelShader);
-	if (PsBlob)
-	{
-		PsBlob->Release();
-	}
-	if (FAILED(hr))
-		return hr;
+    DependencyGraph.SetDependencies(ReloadKey, SourceFiles);
 
-    if (SUCCEEDED(hr) && !PixelShaders.Contains(Key))
+    // 이미 감시 중인 파일은 무시됨
+    for (const std::filesystem::path& SourceFile : SourceFiles)
     {
-        RegisterShaderForReload(Key, FileName, EntryPoint, false, const_cast<D3D_SHADER_MACRO*>(defines), nullptr, 0);
+        ShaderWatcher.AddFile(FString(SourceFile.generic_wstring()));
     }
-
-    // Pixel Shader Map에 존재한다면 해당 PS 제거
-    if (PixelShaders.Contains(Key)) { PixelShaders[Key]->Release();PixelShaders[Key] = nullptr; }
-
-	PixelShaders[Key] = NewPixelShader;
-	return S_OK;
 }
 
-HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName)
-{
-    return E_NOTIMPL;
-}
-
-HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+HRESULT FDXDShaderManager::AddShader(
+    const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const char* Profile, UINT Flags,
+    const D3D_SHADER_MACRO* Defines, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32 LayoutSize
+)
 {
     if (DXDDevice == nullptr)
         return S_FALSE;
 
-    HRESULT hr = S_OK;
-
-    ID3DBlob* VertexShaderCSO = nullptr;
-    ID3DBlob* ErrorBlob = nullptr;
-
-    hr = D3DCompileFromFile(FileName.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "vs_5_0", 0, 0, &VertexShaderCSO, &ErrorBlob);
-    if (FAILED(hr))
+    FShaderReloadInfo Info;
+    Info.Key = Key;
+    Info.Request.FilePath = FileName;
+    Info.Request.EntryPoint = EntryPoint;
+    Info.Request.Profile = Profile;
+    Info.Request.Flags = Flags;
+    if (Defines)
     {
-        if (ErrorBlob) {
-            MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader Compile Error", MB_OK | MB_ICONERROR);
-            OutputDebugStringA((char*)ErrorBlob->GetBufferPointer());
-            ErrorBlob->Release();
+        for (const D3D_SHADER_MACRO* Define = Defines; Define->Name; ++Define)
+        {
+            Info.Request.Defines.emplace_back(Define->Name, Define->Definition ? Define->Definition : "");
         }
-        return hr;
     }
-
-    ID3D11VertexShader* NewVertexShader;
-    hr = DXDDevice->CreateVertexShader(VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), nullptr, &NewVertexShader);
-    if (FAILED(hr))
+    if (Layout && LayoutSize > 0)
     {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader Create Error", MB_OK | MB_ICONERROR);
-        VertexShaderCSO->Release();
-        return hr;
+        Info.Layout.assign(Layout, Layout + LayoutSize);
     }
 
-    VertexShaders[Key] = NewVertexShader;
+    FShaderCompileResult Result;
+    const bool bSucceeded = ShaderCache::CompileWithCache(Info.Request, ShaderRoot, BinaryCache, Compiler, Result);
+    CacheStats.TotalLoadMs += Result.ElapsedMs;
 
-    VertexShaderCSO->Release();
-    if (SUCCEEDED(hr) && !VertexShaders.Contains(Key))
+    // 컴파일에 실패해도 등록해 두어야 파일을 고쳤을 때 다시 컴파일됨
+    const std::wstring ReloadKey = MakeReloadKey(Key, Info.Request.Profile);
+    RegisteredShaders.Add(ReloadKey, Info);
+    if (!Result.SourceFiles.IsEmpty())
     {
-        RegisterShaderForReload(Key, FileName, EntryPoint, true, nullptr);
+        TrackSourceFiles(ReloadKey, Result.SourceFiles);
     }
 
-    return S_OK;
-}
-
-HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines)
-{
-    if (DXDDevice == nullptr)
-        return S_FALSE;
-
-    HRESULT hr = S_OK;
-
-    ID3DBlob* VertexShaderCSO = nullptr;
-    ID3DBlob* ErrorBlob = nullptr;
-
-    hr = D3DCompileFromFile(FileName.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "vs_5_0", 0, 0, &VertexShaderCSO, &ErrorBlob);
-    if (FAILED(hr))
+    if (!bSucceeded)
     {
-        if (ErrorBlob) {
-            MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader Compile Error", MB_OK | MB_ICONERROR);
-            OutputDebugStringA((char*)ErrorBlob->GetBufferPointer());
-            ErrorBlob->Release();
-        }
-        return hr;
+        ++CacheStats.NumFailed;
+        UE_LOG(LogLevel::Error, TEXT("Shader Compile Error (%ls, %s): %s"), FileName.c_str(), Profile, Result.Error.c_str());
+        OutputDebugStringA(Result.Error.c_str());
+        MessageBox(nullptr, (FileName + L"\n" + FString(Result.Error).ToWideString()).c_str(), L"Shader Compile Error", MB_OK | MB_ICONERROR);
+        return E_FAIL;
     }
+    ++(Result.bCacheHit ? CacheStats.NumCacheHits : CacheStats.NumCompiles);
 
-    ID3D11VertexShader* NewVertexShader;
-    hr = DXDDevice->CreateVertexShader(VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), nullptr, &NewVertexShader);
+    const HRESULT hr = CreateShader(Info, Result.Bytecode);
     if (FAILED(hr))
     {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader Create Error", MB_OK | MB_ICONERROR);
-        VertexShaderCSO->Release();
+        MessageBox(nullptr, FileName.c_str(), L"Shader Create Error", MB_OK | MB_ICONERROR);
         return hr;
     }
-
-    VertexShaders[Key] = NewVertexShader;
-
-    VertexShaderCSO->Release();
-    if (SUCCEEDED(hr) && !VertexShaders.Contains(Key))
-    {
-        RegisterShaderForReload(Key, FileName, EntryPoint, true, const_cast<D3D_SHADER_MACRO*>(defines));
-    }
-
     return S_OK;
 }
 
-HRESULT FDXDShaderManager::AddComputeShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+HRESULT FDXDShaderManager::CreateShader(const FShaderReloadInfo& Info, const TArray<uint8>& Bytecode)
 {
-    if (DXDDevice == nullptr)
-        return S_FALSE;
-
-    HRESULT hr = S_OK;
-    ID3DBlob* csBlob = nullptr;
-    ID3DBlob* errorBlob = nullptr;
+    const std::wstring& Key = Info.Key;
+    const std::string& Profile = Info.Request.Profile;
+    const void* Code = Bytecode.GetData();
+    const SIZE_T CodeSize = Bytecode.Num();
 
-    // --- 컴파일 플래그 설정 ---
-    DWORD shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-    shaderFlags |= D3DCOMPILE_DEBUG;
-    shaderFlags |= D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-
-    hr = D3DCompileFromFile( 
-        FileName.c_str(),
-        nullptr,
-        D3D_COMPILE_STANDARD_FILE_INCLUDE,
-        EntryPoint.c_str(),
-        "cs_5_0",
-        shaderFlags,
-        0,
-        &csBlob,
-        &errorBlob
-    );
-
-    if (FAILED(hr))
+    HRESULT hr = E_INVALIDARG;
+    if (Profile.starts_with("vs"))
     {
-        if (errorBlob)
+        ID3D11VertexShader* NewVertexShader = nullptr;
+        hr = DXDDevice->CreateVertexShader(Code, CodeSize, nullptr, &NewVertexShader);
+        if (FAILED(hr))
         {
-            OutputDebugStringA((char*)errorBlob->GetBufferPointer());
-            UE_LOG(LogLevel::Error, "%s", (char*)errorBlob->GetBufferPointer());
-            errorBlob->Release();
+            return hr;
         }
-        return hr;
-    }
 
-    ID3D11ComputeShader* NewComputeShader = nullptr;
-    hr = DXDDevice->CreateComputeShader(csBlob->GetBufferPointer(), csBlob->GetBufferSize(), nullptr, &NewComputeShader);
-    if (FAILED(hr))
-    {
-        csBlob->Release();
-        return hr;
-    }
-
-    if (SUCCEEDED(hr) && !ComputeShaders.Contains(Key))
-    {
-        RegisterShaderForReload(Key, FileName, EntryPoint, false, nullptr, nullptr, 0);
-    }
-    ComputeShaders[Key] = NewComputeShader;
-    
-    csBlob->Release();
-
-    return S_OK;
-}
+        ID3D11InputLayout* NewInputLayout = nullptr;
+        if (!Info.Layout.empty())
+        {
+            hr = DXDDevice->CreateInputLayout(Info.Layout.data(), static_cast<UINT>(Info.Layout.size()), Code, CodeSize, &NewInputLayout);
+            if (FAILED(hr))
+            {
+                NewVertexShader->Release();
+                return hr;
+            }
+        }
 
-HRESULT FDXDShaderManager::AddGeometryShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
-{
-    if (DXDDevice == nullptr)
-        return S_FALSE;
-    HRESULT hr = S_OK;
-    ID3DBlob* csBlob = nullptr;
-    ID3DBlob* errorBlob = nullptr;
+        // Vertex Shader Map에 존재한다면 해당 VS, Input Layout 제거
+        if (VertexShaders.Contains(Key) && VertexShaders[Key]) { VertexShaders[Key]->Release(); }
+        VertexShaders[Key] = NewVertexShader;
 
-    DWORD shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-    shaderFlags |= D3DCOMPILE_DEBUG;
-    shaderFlags |= D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-    hr = D3DCompileFromFile(
-        FileName.c_str(),
-        nullptr,
-        D3D_COMPILE_STANDARD_FILE_INCLUDE,
-        EntryPoint.c_str(),
-        "gs_5_0",
-        shaderFlags,
-        0,
-        &csBlob,
-        &errorBlob
-    );
-    if (FAILED(hr))
-    {
-        if (errorBlob)
+        if (NewInputLayout)
         {
-            OutputDebugStringA((char*)errorBlob->GetBufferPointer());
-            UE_LOG(LogLevel::Error, "%s", (char*)errorBlob->GetBufferPointer());
-            errorBlob->Release();
+            if (InputLayouts.Contains(Key) && InputLayouts[Key]) { InputLayouts[Key]->Release(); }
+            InputLayouts[Key] = NewInputLayout;
         }
-        return hr;
     }
-    ID3D11GeometryShader* NewComputeShader = nullptr;
-    hr = DXDDevice->CreateGeometryShader(csBlob->GetBufferPointer(), csBlob->GetBufferSize(), nullptr, &NewComputeShader);
-    if (FAILED(hr))
+    else if (Profile.starts_with("ps"))
     {
-        csBlob->Release();
-        return hr;
-    }
-    if (SUCCEEDED(hr) && !GeometryShaders.Contains(Key))
-    {
-        RegisterShaderForReload(Key, FileName, EntryPoint, false, nullptr, nullptr, 0);
-    }
-    GeometryShaders[Key] = NewComputeShader;
-    csBlob->Release();
-    return S_OK;
-}
-
-HRESULT FDXDShaderManager::AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize)
-{
-    UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-    shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-    if (DXDDevice == nullptr)
-        return S_FALSE;
-
-    HRESULT hr = S_OK;
-
-    ID3DBlob* VertexShaderCSO = nullptr;
-    ID3DBlob* ErrorBlob = nullptr;
+        ID3D11PixelShader* NewPixelShader = nullptr;
+        hr = DXDDevice->CreatePixelShader(Code, CodeSize, nullptr, &NewPixelShader);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
 
-    hr = D3DCompileFromFile(FileName.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "vs_5_0", shaderFlags, 0, &VertexShaderCSO, &ErrorBlob);
-    if (FAILED(hr))
+        if (PixelShaders.Contains(Key) && PixelShaders[Key]) { PixelShaders[Key]->Release(); }
+        PixelShaders[Key] = NewPixelShader;
+    }
+    else if (Profile.starts_with("cs"))
     {
-        if (ErrorBlob) {
-            MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader & InputLayout Compile Error", MB_OK | MB_ICONERROR);
-            OutputDebugStringA((char*)ErrorBlob->GetBufferPointer());
-            ErrorBlob->Release();
+        ID3D11ComputeShader* NewComputeShader = nullptr;
+        hr = DXDDevice->CreateComputeShader(Code, CodeSize, nullptr, &NewComputeShader);
+        if (FAILED(hr))
+        {
+            return hr;
         }
-        return hr;
-    }
 
-    ID3D11VertexShader* NewVertexShader;
-    hr = DXDDevice->CreateVertexShader(VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), nullptr, &NewVertexShader);
-    if (FAILED(hr))
-    {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Vertex Shader Create Error", MB_OK | MB_ICONERROR);
-        return hr;
+        if (ComputeShaders.Contains(Key) && ComputeShaders[Key]) { ComputeShaders[Key]->Release(); }
+        ComputeShaders[Key] = NewComputeShader;
     }
-
-    ID3D11InputLayout* NewInputLayout;
-    hr = DXDDevice->CreateInputLayout(Layout, LayoutSize, VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), &NewInputLayout);
-    if (FAILED(hr))
+    else if (Profile.starts_with("gs"))
     {
-        MessageBox(nullptr, (FileName + FString((char*)(ErrorBlob->GetBufferPointer())).ToWideString()).c_str(), L"Input Layout Create Error", MB_OK | MB_ICONERROR);
-        VertexShaderCSO->Release();
-        return hr;
-    }
+        ID3D11GeometryShader* NewGeometryShader = nullptr;
+        hr = DXDDevice->CreateGeometryShader(Code, CodeSize, nullptr, &NewGeometryShader);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
 
-    VertexShaderCSO->Release();
-    if (SUCCEEDED(hr) && !VertexShaders.Contains(Key))
-    {
-        RegisterShaderForReload(Key, FileName, EntryPoint, true, nullptr, const_cast<D3D11_INPUT_ELEMENT_DESC*>(Layout), LayoutSize);
+        if (GeometryShaders.Contains(Key) && GeometryShaders[Key]) { GeometryShaders[Key]->Release(); }
+        GeometryShaders[Key] = NewGeometryShader;
     }
-
-    // Vertex Shader Map에 존재한다면 해당 VS, Input Layout 제거
-    if (VertexShaders.Contains(Key)) { VertexShaders[Key]->Release(); VertexShaders[Key] = nullptr; }
-    if (InputLayouts.Contains(Key)) { InputLayouts[Key]->Release();    InputLayouts[Key] = nullptr; }
-
-    VertexShaders[Key] = NewVertexShader;
-    InputLayouts[Key] = NewInputLayout;
-
-
-    return S_OK;
+    return hr;
 }
 
-HRESULT FDXDShaderManager::AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize, const D3D_SHADER_MACRO* defines)
+HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
 {
-    UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
-#ifdef _DEBUG
-    shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-    if (DXDDevice == nullptr)
-        return S_FALSE;
+    return AddShader(Key, FileName, EntryPoint, "ps_5_0", GetDefaultCompileFlags(), nullptr);
+}
 
-    HRESULT hr = S_OK;
+HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines)
+{
+    return AddShader(Key, FileName, EntryPoint, "ps_5_0", GetDefaultCompileFlags(), defines);
+}
 
-    ID3DBlob* VertexShaderCSO = nullptr;
-    ID3DBlob* ErrorBlob = nullptr;
+HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName)
+{
+    return E_NOTIMPL;
+}
 
-    hr = D3DCompileFromFile(FileName.c_str(), defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, EntryPoint.c_str(), "vs_5_0", shaderFlags, 0, &VertexShaderCSO, &ErrorBlob);
-    if (FAILED(hr))
-    {
-        if (ErrorBlob) {
-            OutputDebugStringA((char*)ErrorBlob->GetBufferPointer());
-            ErrorBlob->Release();
-        }
-        return hr;
-    }
+HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+{
+    return AddShader(Key, FileName, EntryPoint, "vs_5_0", 0, nullptr);
+}
 
-    ID3D11VertexShader* NewVertexShader;
-    hr = DXDDevice->CreateVertexShader(VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), nullptr, &NewVertexShader);
-    if (FAILED(hr))
-    {
-        return hr;
-    }
+HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines)
+{
+    return AddShader(Key, FileName, EntryPoint, "vs_5_0", 0, defines);
+}
 
-    ID3D11InputLayout* NewInputLayout;
-    hr = DXDDevice->CreateInputLayout(Layout, LayoutSize, VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), &NewInputLayout);
-    if (FAILED(hr))
-    {
-        VertexShaderCSO->Release();
-        return hr;
-    }
+HRESULT FDXDShaderManager::AddComputeShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+{
+    return AddShader(Key, FileName, EntryPoint, "cs_5_0", GetDefaultCompileFlags(), nullptr);
+}
 
-    VertexShaderCSO->Release();
-    if (SUCCEEDED(hr) && !VertexShaders.Contains(Key))
-    {
-        RegisterShaderForReload(Key, FileName, EntryPoint, true, const_cast<D3D_SHADER_MACRO*>(defines), const_cast<D3D11_INPUT_ELEMENT_DESC*>(Layout), LayoutSize);
-    }
+HRESULT FDXDShaderManager::AddGeometryShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint)
+{
+    return AddShader(Key, FileName, EntryPoint, "gs_5_0", GetDefaultCompileFlags(), nullptr);
+}
 
-    // Vertex Shader Map에 존재한다면 해당 VS, Input Layout 제거
-    if (VertexShaders.Contains(Key)) { VertexShaders[Key]->Release(); VertexShaders[Key] = nullptr; }
-    if (InputLayouts.Contains(Key)) { InputLayouts[Key]->Release();    InputLayouts[Key] = nullptr; }
+HRESULT FDXDShaderManager::AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize)
+{
+    return AddShader(Key, FileName, EntryPoint, "vs_5_0", GetDefaultCompileFlags(), nullptr, Layout, LayoutSize);
+}
 
-    VertexShaders[Key] = NewVertexShader;
-    InputLayouts[Key] = NewInputLayout;
-    return S_OK;
+HRESULT FDXDShaderManager::AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize, const D3D_SHADER_MACRO* defines)
+{
+    return AddShader(Key, FileName, EntryPoint, "vs_5_0", GetDefaultCompileFlags(), defines, Layout, LayoutSize);
 }
 
 ID3D11InputLayout* FDXDShaderManager::GetInputLayoutByKey(const std::wstring& Key) const
@@ -3,34 +3,48 @@
 #include <d3d11.h>
 #include <d3dcompiler.h>
 #include <filesystem>
-#include <chrono>
 #include "Container/Map.h"
 #include "Container/Array.h"
 #include "Container/Set.h"
 #include <vector>
 
-//#define Multi_Shader_Include // 중첩 헤더 파일 지원 플래그 (주석 해제시 재귀적으로 include 검사/갱신)
+#include "Async/JobSystem.h"
+#include "D3DShaderCompiler.h"
+#include "Renderer/ShaderCache.h"
+#include "Windows/WindowsFileWatcher.h"
+
 struct FVertexShaderData
 {
 	ID3DBlob* VertexShaderCSO;
 	ID3D11VertexShader* VertexShader;
 };
 
-struct FShaderReloadInfo {
+/** 핫 리로드 때 같은 셰이더를 다시 만들기 위해 보관하는 정보 */
+struct FShaderReloadInfo
+{
     std::wstring Key;
-    std::wstring FilePath;
-    std::string EntryPoint;
-    bool IsVertexShader;
-    std::vector<D3D_SHADER_MACRO> Defines;
-    std::vector<D3D11_INPUT_ELEMENT_DESC> Layout;
-
-    FShaderReloadInfo() = default;
-    FShaderReloadInfo(const std::wstring& InKey, const std::wstring& InFilePath,
-        const std::string& InEntryPoint, bool bIsVS)
-        : Key(InKey), FilePath(InFilePath), EntryPoint(InEntryPoint), IsVertexShader(bIsVS) {
-    }
+    FShaderCompileRequest Request;
+    std::vector<D3D11_INPUT_ELEMENT_DESC> Layout;   // Vertex Shader의 Input Layout. 비어 있으면 만들지 않음
+};
+
+struct FShaderCacheStats
+{
+    int32 NumCacheHits = 0;
+    int32 NumCompiles = 0;
+    int32 NumFailed = 0;
+    int32 NumHotReloads = 0;
+
+    /** 게임 스레드에서 셰이더를 불러오는 데 쓴 시간 (캐시 읽기 + 컴파일) */
+    double TotalLoadMs = 0.0;
 };
 
+/**
+ * 셰이더를 컴파일해서 Key로 보관합니다.
+ *
+ * 컴파일 결과는 소스와 include, Define, 진입점, 프로필의 해시를 키로 Saved/ShaderCache에 저장해 두고, 다음 실행부터는 컴파일 없이 불러옵니다.
+ * 셰이더가 사용하는 파일은 FFileWatcher로 감시하며, 바뀐 파일을 사용하는 셰이더만 Worker 스레드에서 다시 컴파일합니다.
+ * 컴파일이 끝난 셰이더는 ReloadAllShaders에서 교체하므로, 렌더 패스는 프레임 중간에 셰이더가 바뀌는 것을 보지 않습니다.
+ */
 class FDXDShaderManager
 {
 public:
@@ -39,18 +53,16 @@ public:
 
     ~FDXDShaderManager();
 
-    // Hot Reload 관련 함수
 	void ReleaseAllShader();
-    void UpdateShaderIfOutdated(const std::wstring Key, const std::wstring FilePath, const std::string EntryPoint, bool IsVertexShader, const D3D_SHADER_MACRO * Defines = nullptr, const D3D11_INPUT_ELEMENT_DESC * Layout = nullptr, uint32 LayoutSize = 0);
-    void RegisterShaderForReload(std::wstring Key, std::wstring FilePath, std::string EntryPoint, bool IsVertexShader, D3D_SHADER_MACRO* Defines = nullptr, D3D11_INPUT_ELEMENT_DESC* Layout = nullptr, uint32 LayoutSize = 0);
+
+    /** 파일 변경으로 다시 컴파일할 셰이더의 Job을 띄우고, 끝난 Job의 셰이더를 교체합니다. 프레임 끝에 호출합니다. */
     void ReloadAllShaders();
 
-    // Dependency Graph 관련 함수
-    void BuildDependency(const FShaderReloadInfo& Info);
-    bool IsOutdatedWithDependency(const FShaderReloadInfo& Info);
-    void UpdateDependencyTimestamps();
+    const FShaderCacheStats& GetCacheStats() const { return CacheStats; }
+    int32 GetNumPendingRecompiles() const { return PendingRecompiles.Num(); }
+
 private:
-	ID3D11Device* DXDDevice;
+	ID3D11Device* DXDDevice = nullptr;
 
 public:
 	HRESULT AddVertexShader(const std::wstring& Key, const std::wstring& FileName);
@@ -58,7 +70,7 @@ public:
     HRESULT AddVertexShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines);
     HRESULT AddComputeShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint);
     HRESULT AddGeometryShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint);
-	
+
 	HRESULT AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize);
     HRESULT AddVertexShaderAndInputLayout(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D11_INPUT_ELEMENT_DESC* Layout, uint32_t LayoutSize, const D3D_SHADER_MACRO* defines);
 	HRESULT AddPixelShader(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint);
@@ -69,6 +81,37 @@ public:
     ID3D11ComputeShader* GetComputeShaderByKey(const std::wstring& Key);
     ID3D11GeometryShader* GetGeometryShaderByKey(const std::wstring& Key);
 
+private:
+    struct FPendingRecompile
+    {
+        std::wstring ReloadKey;
+        FShaderReloadInfo Info;
+        FShaderCompileResult Result;
+        bool bSucceeded = false;
+
+        // Job이 도는 동안 파일이 또 바뀌면 끝난 뒤 한 번 더 컴파일
+        bool bChangedAgain = false;
+
+        FJobCounter Counter;
+    };
+
+    /** 같은 Key를 Vertex / Pixel Shader가 함께 쓰는 경우가 있어 프로필을 붙여 구분 */
+    static std::wstring MakeReloadKey(const std::wstring& Key, const std::string& Profile);
+
+    /** 캐시에서 불러오거나 컴파일해서 셰이더를 만들고, 핫 리로드 대상으로 등록합니다. */
+    HRESULT AddShader(
+        const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const char* Profile, UINT Flags,
+        const D3D_SHADER_MACRO* Defines, const D3D11_INPUT_ELEMENT_DESC* Layout = nullptr, uint32 LayoutSize = 0
+    );
+
+    /** 바이트코드로 D3D 셰이더(와 Input Layout)를 만들어 Key의 이전 셰이더와 바꿉니다. */
+    HRESULT CreateShader(const FShaderReloadInfo& Info, const TArray<uint8>& Bytecode);
+
+    /** 사용하는 파일을 의존성 그래프와 파일 감시에 등록합니다. */
+    void TrackSourceFiles(const std::wstring& ReloadKey, const TArray<std::filesystem::path>& SourceFiles);
+
+    void DispatchRecompile(const std::wstring& ReloadKey);
+
 private:
 	TMap<std::wstring, ID3D11InputLayout*> InputLayouts;
 	TMap<std::wstring, ID3D11VertexShader*> VertexShaders;
@@ -76,8 +119,15 @@ private:
     TMap<std::wstring, ID3D11ComputeShader*> ComputeShaders;
     TMap<std::wstring, ID3D11GeometryShader*> GeometryShaders;
 
-    TMap<std::wstring, std::filesystem::file_time_type> ShaderTimeStamps;
-    TMap<std::wstring, TSet<std::wstring>> ShaderDependencyGraph;
-    std::vector<FShaderReloadInfo> RegisteredShaders;
-};
+    // MakeReloadKey → 다시 만들 때 필요한 정보
+    TMap<std::wstring, FShaderReloadInfo> RegisteredShaders;
+
+    FD3DShaderCompiler Compiler;
+    FShaderBinaryCache BinaryCache{ L"Saved/ShaderCache" };
+    FShaderDependencyGraph DependencyGraph;
+    FFileWatcher ShaderWatcher;
 
+    TArray<FPendingRecompile*> PendingRecompiles;
+
+    FShaderCacheStats CacheStats;
+};
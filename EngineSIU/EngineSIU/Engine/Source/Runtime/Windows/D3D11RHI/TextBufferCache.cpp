@@ -0,0 +1,125 @@
+#include "TextBufferCache.h"
+
+#include <d3d11.h>
+
+
+FTextBufferCache::~FTextBufferCache()
+{
+    Empty();
+}
+
+const FVertexInfo* FTextBufferCache::Find(const FWString& Text)
+{
+    const int32* EntryIndex = EntryIndices.Find(Text);
+    if (EntryIndex == nullptr)
+    {
+        ++Stats.NumMisses;
+        return nullptr;
+    }
+
+    ++Stats.NumHits;
+    if (*EntryIndex != Head)
+    {
+        Unlink(*EntryIndex);
+        LinkFront(*EntryIndex);
+    }
+    return &Entries[*EntryIndex].VertexInfo;
+}
+
+void FTextBufferCache::Add(const FWString& Text, const FVertexInfo& VertexInfo)
+{
+    if (const int32* ExistingIndex = EntryIndices.Find(Text))
+    {
+        Evict(*ExistingIndex);
+        --Stats.NumEvictions;   // 교체는 축출로 세지 않음
+    }
+
+    // 새 항목이 들어갈 자리를 먼저 비움
+    const uint64 NewBytes = GetBufferBytes(VertexInfo);
+    while (Tail != INDEX_NONE && (Stats.NumEntries + 1 > MaxEntries || Stats.NumBytes + NewBytes > MaxBytes))
+    {
+        Evict(Tail);
+    }
+
+    int32 EntryIndex;
+    if (FreeEntries.Num() > 0)
+    {
+        EntryIndex = FreeEntries[FreeEntries.Num() - 1];
+        FreeEntries.RemoveAt(FreeEntries.Num() - 1);
+    }
+    else
+    {
+        EntryIndex = Entries.Emplace();
+    }
+
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.Text = Text;
+    Entry.VertexInfo = VertexInfo;
+    LinkFront(EntryIndex);
+    EntryIndices.Add(Text, EntryIndex);
+
+    ++Stats.NumEntries;
+    Stats.NumBytes += NewBytes;
+}
+
+void FTextBufferCache::Empty()
+{
+    for (const auto& [Text, EntryIndex] : EntryIndices)
+    {
+        if (ID3D11Buffer* Buffer = Entries[EntryIndex].VertexInfo.VertexBuffer)
+        {
+            Buffer->Release();
+        }
+    }
+    Entries.Empty();
+    FreeEntries.Empty();
+    EntryIndices.Empty();
+    Head = INDEX_NONE;
+    Tail = INDEX_NONE;
+    Stats.NumEntries = 0;
+    Stats.NumBytes = 0;
+}
+
+void FTextBufferCache::Unlink(int32 EntryIndex)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    (Entry.Prev != INDEX_NONE ? Entries[Entry.Prev].Next : Head) = Entry.Next;
+    (Entry.Next != INDEX_NONE ? Entries[Entry.Next].Prev : Tail) = Entry.Prev;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = INDEX_NONE;
+}
+
+void FTextBufferCache::LinkFront(int32 EntryIndex)
+{
+    FEntry& Entry = Entries[EntryIndex];
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = Head;
+    if (Head != INDEX_NONE)
+    {
+        Entries[Head].Prev = EntryIndex;
+    }
+    Head = EntryIndex;
+    if (Tail == INDEX_NONE)
+    {
+        Tail = EntryIndex;
+    }
+}
+
+void FTextBufferCache::Evict(int32 EntryIndex)
+{
+    Unlink(EntryIndex);
+
+    FEntry& Entry = Entries[EntryIndex];
+    if (Entry.VertexInfo.VertexBuffer)
+    {
+        Entry.VertexInfo.VertexBuffer->Release();
+    }
+    Stats.NumBytes -= GetBufferBytes(Entry.VertexInfo);
+    --Stats.NumEntries;
+    ++Stats.NumEvictions;
+
+    EntryIndices.Remove(Entry.Text);
+    Entry.Text.clear();
+    Entry.VertexInfo = {};
+    FreeEntries.Add(EntryIndex);
+}
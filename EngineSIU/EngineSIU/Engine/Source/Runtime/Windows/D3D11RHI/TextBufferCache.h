@@ -0,0 +1,67 @@
+#pragma once
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "Rendering/Types/Buffers.h"
+
+struct FTextBufferCacheStats
+{
+    int32 NumEntries = 0;
+    uint64 NumBytes = 0;
+    uint64 NumHits = 0;
+    uint64 NumMisses = 0;
+    uint64 NumEvictions = 0;
+};
+
+/**
+ * 문자열별 텍스트 정점 버퍼를 최근에 쓴 순서로 보관합니다.
+ *
+ * MaxEntries개 또는 MaxBytes를 넘으면 가장 오래 쓰지 않은 버퍼부터 Release합니다.
+ * Find로 받은 버퍼는 다음 Add 전까지만 유효합니다.
+ */
+class FTextBufferCache
+{
+public:
+    FTextBufferCache() = default;
+    ~FTextBufferCache();
+
+    FTextBufferCache(const FTextBufferCache&) = delete;
+    FTextBufferCache& operator=(const FTextBufferCache&) = delete;
+
+    /** 찾으면 가장 최근에 쓴 것으로 옮깁니다. */
+    const FVertexInfo* Find(const FWString& Text);
+
+    /** 버퍼의 소유권을 가져갑니다. 같은 문자열이 이미 있으면 이전 버퍼를 Release합니다. */
+    void Add(const FWString& Text, const FVertexInfo& VertexInfo);
+
+    void Empty();
+
+    const FTextBufferCacheStats& GetStats() const { return Stats; }
+
+    int32 MaxEntries = 256;
+    uint64 MaxBytes = 4ull << 20;
+
+private:
+    struct FEntry
+    {
+        FWString Text;
+        FVertexInfo VertexInfo;
+        int32 Prev = INDEX_NONE;   // 더 최근
+        int32 Next = INDEX_NONE;   // 더 오래됨
+    };
+
+    static uint64 GetBufferBytes(const FVertexInfo& VertexInfo) { return static_cast<uint64>(VertexInfo.NumVertices) * VertexInfo.Stride; }
+
+    void Unlink(int32 EntryIndex);
+    void LinkFront(int32 EntryIndex);
+    void Evict(int32 EntryIndex);
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeEntries;
+    TMap<FWString, int32> EntryIndices;
+    int32 Head = INDEX_NONE;        // 가장 최근
+    int32 Tail = INDEX_NONE;        // 가장 오래됨
+
+    FTextBufferCacheStats Stats;
+};
@@ -0,0 +1,348 @@
+﻿#include "WindowsFileWatcher.h"
+
+#include <cwctype>
+
+
+struct FFileWatcher::FDirectoryWatch
+{
+    std::filesystem::path Directory;
+    HANDLE DirectoryHandle = INVALID_HANDLE_VALUE;
+    OVERLAPPED Overlapped = {};
+
+    // ReadDirectoryChangesW 결과 버퍼. DWORD 정렬이 필요함
+    alignas(DWORD) uint8 Buffer[16 * 1024];
+
+    bool IssueRead()
+    {
+        ResetEvent(Overlapped.hEvent);
+        return ReadDirectoryChangesW(
+            DirectoryHandle, Buffer, sizeof(Buffer), FALSE,
+            FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE,
+            nullptr, &Overlapped, nullptr
+        ) != FALSE;
+    }
+
+    void Close()
+    {
+        if (DirectoryHandle != INVALID_HANDLE_VALUE)
+        {
+            CancelIoEx(DirectoryHandle, &Overlapped);
+            DWORD Ignored = 0;
+            GetOverlappedResult(DirectoryHandle, &Overlapped, &Ignored, TRUE);
+            CloseHandle(DirectoryHandle);
+            DirectoryHandle = INVALID_HANDLE_VALUE;
+        }
+        if (Overlapped.hEvent)
+        {
+            CloseHandle(Overlapped.hEvent);
+            Overlapped.hEvent = nullptr;
+        }
+    }
+};
+
+FFileWatcher::~FFileWatcher()
+{
+    Shutdown();
+}
+
+std::wstring FFileWatcher::MakeKey(const std::filesystem::path& Path)
+{
+    std::error_code ErrorCode;
+    std::filesystem::path Absolute = std::filesystem::absolute(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        Absolute = Path;
+    }
+
+    // Windows 경로는 대소문자를 구분하지 않음
+    std::wstring Key = Absolute.lexically_normal().generic_wstring();
+    for (wchar_t& Char : Key)
+    {
+        Char = static_cast<wchar_t>(std::towlower(Char));
+    }
+    return Key;
+}
+
+void FFileWatcher::AddFile(const FString& FilePath)
+{
+    const std::filesystem::path Path(FilePath.ToWideString());
+    const std::wstring FileKey = MakeKey(Path);
+
+    std::error_code ErrorCode;
+    FWatchedFile WatchedFile;
+    WatchedFile.FilePath = FilePath;
+    WatchedFile.DirectoryKey = std::filesystem::path(FileKey).parent_path();
+    WatchedFile.LastWriteTime = std::filesystem::last_write_time(Path, ErrorCode);
+
+    {
+        std::scoped_lock Lock(Mutex);
+        if (WatchedFiles.Contains(FileKey))
+        {
+            return;
+        }
+
+        bool bDirectoryKnown = false;
+        for (const TMap<std::wstring, FWatchedFile>::PairType& Pair : WatchedFiles)
+        {
+            if (Pair.Value.DirectoryKey == WatchedFile.DirectoryKey)
+            {
+                bDirectoryKnown = true;
+                break;
+            }
+        }
+        if (!bDirectoryKnown)
+        {
+            PendingDirectories.Add(WatchedFile.DirectoryKey);
+        }
+
+        WatchedFiles.Add(FileKey, WatchedFile);
+    }
+
+    if (!WatchThread.joinable())
+    {
+        WakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        bStopRequested.store(false);
+        WatchThread = std::thread(&FFileWatcher::ThreadMain, this);
+    }
+    else if (WakeEvent)
+    {
+        SetEvent(WakeEvent);
+    }
+}
+
+void FFileWatcher::RemoveFile(const FString& FilePath)
+{
+    const std::wstring FileKey = MakeKey(std::filesystem::path(FilePath.ToWideString()));
+
+    // 디렉터리 감시는 그대로 두고, 알림이 와도 목록에 없으므로 무시됨
+    std::scoped_lock Lock(Mutex);
+    WatchedFiles.Remove(FileKey);
+    PendingChanges.Remove(FileKey);
+}
+
+void FFileWatcher::Shutdown()
+{
+    if (WatchThread.joinable())
+    {
+        bStopRequested.store(true);
+        SetEvent(WakeEvent);
+        WatchThread.join();
+    }
+
+    if (WakeEvent)
+    {
+        CloseHandle(WakeEvent);
+        WakeEvent = nullptr;
+    }
+
+    std::scoped_lock Lock(Mutex);
+    WatchedFiles.Empty();
+    PendingDirectories.Empty();
+    PendingChanges.Empty();
+}
+
+void FFileWatcher::DrainChanges(TArray<FString>& OutChangedFiles)
+{
+    const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+
+    std::scoped_lock Lock(Mutex);
+    if (PendingChanges.IsEmpty())
+    {
+        return;
+    }
+
+    TArray<std::wstring> SettledKeys;
+    for (const TMap<std::wstring, std::chrono::steady_clock::time_point>::PairType& Pair : PendingChanges)
+    {
+        if (Now - Pair.Value >= SettleTime)
+        {
+            SettledKeys.Add(Pair.Key);
+        }
+    }
+
+    for (const std::wstring& FileKey : SettledKeys)
+    {
+        PendingChanges.Remove(FileKey);
+        if (const FWatchedFile* WatchedFile = WatchedFiles.Find(FileKey))
+        {
+            OutChangedFiles.AddUnique(WatchedFile->FilePath);
+        }
+    }
+}
+
+int32 FFileWatcher::GetNumPolledFiles() const
+{
+    std::scoped_lock Lock(Mutex);
+
+    int32 NumPolledFiles = 0;
+    for (const TMap<std::wstring, FWatchedFile>::PairType& Pair : WatchedFiles)
+    {
+        if (PolledDirectories.Contains(Pair.Value.DirectoryKey))
+        {
+            ++NumPolledFiles;
+        }
+    }
+    return NumPolledFiles;
+}
+
+void FFileWatcher::PushChange(const std::wstring& FileKey)
+{
+    // Mutex는 호출하는 쪽에서 잡음
+    if (WatchedFiles.Contains(FileKey))
+    {
+        PendingChanges.FindOrAdd(FileKey) = std::chrono::steady_clock::now();
+    }
+}
+
+void FFileWatcher::ThreadMain()
+{
+    LastPollTime = std::chrono::steady_clock::now();
+
+    TArray<HANDLE> WaitHandles;
+    while (!bStopRequested.load())
+    {
+        OpenPendingDirectories();
+
+        // 마지막은 항상 WakeEvent. WaitForMultipleObjects는 최대 64개까지 기다릴 수 있음
+        WaitHandles.Reset();
+        for (const FDirectoryWatch* Watch : DirectoryWatches)
+        {
+            WaitHandles.Add(Watch->Overlapped.hEvent);
+        }
+        WaitHandles.Add(WakeEvent);
+
+        const DWORD Timeout = PolledDirectories.IsEmpty() ? INFINITE : static_cast<DWORD>(PollInterval.count());
+        const DWORD Result = WaitForMultipleObjects(static_cast<DWORD>(WaitHandles.Num()), WaitHandles.GetData(), FALSE, Timeout);
+
+        if (Result >= WAIT_OBJECT_0 && Result < WAIT_OBJECT_0 + static_cast<DWORD>(DirectoryWatches.Num()))
+        {
+            FDirectoryWatch& Watch = *DirectoryWatches[Result - WAIT_OBJECT_0];
+
+            DWORD NumBytes = 0;
+            if (GetOverlappedResult(Watch.DirectoryHandle, &Watch.Overlapped, &NumBytes, FALSE))
+            {
+                OnDirectoryNotification(Watch, NumBytes);
+            }
+
+            if (!Watch.IssueRead())
+            {
+                // 디렉터리가 지워졌거나 접근할 수 없게 됨. 폴링으로 전환
+                PolledDirectories.AddUnique(Watch.Directory);
+                Watch.Close();
+                delete &Watch;
+                DirectoryWatches.RemoveAt(Result - WAIT_OBJECT_0);
+            }
+        }
+
+        if (!PolledDirectories.IsEmpty() && std::chrono::steady_clock::now() - LastPollTime >= PollInterval)
+        {
+            PollFiles();
+            LastPollTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    for (FDirectoryWatch* Watch : DirectoryWatches)
+    {
+        Watch->Close();
+        delete Watch;
+    }
+    DirectoryWatches.Empty();
+    PolledDirectories.Empty();
+}
+
+void FFileWatcher::OpenPendingDirectories()
+{
+    TArray<std::filesystem::path> Directories;
+    {
+        std::scoped_lock Lock(Mutex);
+        std::swap(Directories, PendingDirectories);
+    }
+
+    for (const std::filesystem::path& Directory : Directories)
+    {
+        // WakeEvent 자리 하나를 남겨야 함
+        const bool bHasSlot = DirectoryWatches.Num() < MAXIMUM_WAIT_OBJECTS - 1;
+
+        HANDLE DirectoryHandle = bHasSlot
+            ? CreateFileW(
+                Directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr
+            )
+            : INVALID_HANDLE_VALUE;
+
+        if (DirectoryHandle == INVALID_HANDLE_VALUE)
+        {
+            PolledDirectories.AddUnique(Directory);
+            continue;
+        }
+
+        FDirectoryWatch* Watch = new FDirectoryWatch;
+        Watch->Directory = Directory;
+        Watch->DirectoryHandle = DirectoryHandle;
+        Watch->Overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        if (!Watch->IssueRead())
+        {
+            Watch->Close();
+            delete Watch;
+            PolledDirectories.AddUnique(Directory);
+            continue;
+        }
+        DirectoryWatches.Add(Watch);
+    }
+}
+
+void FFileWatcher::OnDirectoryNotification(FDirectoryWatch& Watch, uint32 NumBytes)
+{
+    std::scoped_lock Lock(Mutex);
+
+    if (NumBytes == 0)
+    {
+        // 버퍼가 넘쳐서 개별 알림을 잃음. 이 디렉터리의 파일을 모두 바뀐 것으로 처리
+        for (const TMap<std::wstring, FWatchedFile>::PairType& Pair : WatchedFiles)
+        {
+            if (Pair.Value.DirectoryKey == Watch.Directory)
+            {
+                PushChange(Pair.Key);
+            }
+        }
+        return;
+    }
+
+    const uint8* Cursor = Watch.Buffer;
+    while (true)
+    {
+        const FILE_NOTIFY_INFORMATION* Info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(Cursor);
+        if (Info->Action == FILE_ACTION_MODIFIED || Info->Action == FILE_ACTION_ADDED || Info->Action == FILE_ACTION_RENAMED_NEW_NAME)
+        {
+            const std::wstring FileName(Info->FileName, Info->FileNameLength / sizeof(WCHAR));
+            PushChange(MakeKey(Watch.Directory / FileName));
+        }
+
+        if (Info->NextEntryOffset == 0)
+        {
+            break;
+        }
+        Cursor += Info->NextEntryOffset;
+    }
+}
+
+void FFileWatcher::PollFiles()
+{
+    std::scoped_lock Lock(Mutex);
+    for (TMap<std::wstring, FWatchedFile>::PairType& Pair : WatchedFiles)
+    {
+        if (!PolledDirectories.Contains(Pair.Value.DirectoryKey))
+        {
+            continue;
+        }
+
+        std::error_code ErrorCode;
+        const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(std::filesystem::path(Pair.Key), ErrorCode);
+        if (!ErrorCode && WriteTime != Pair.Value.LastWriteTime)
+        {
+            Pair.Value.LastWriteTime = WriteTime;
+            PushChange(Pair.Key);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+﻿#pragma once
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 등록된 파일의 변경을 감지해서 메인 스레드에 알려주는 클래스
+ *
+ * 파일이 들어 있는 디렉터리마다 ReadDirectoryChangesW를 걸어두고, 전용 스레드가 알림을 받아 변경 큐에 넣습니다.
+ * 디렉터리 감시를 열 수 없으면 그 디렉터리의 파일만 PollInterval마다 수정 시각을 비교하는 방식으로 대신합니다.
+ * 메인 스레드는 DrainChanges로 큐를 비우기만 하므로, 프레임마다 드는 비용은 변경된 파일 수에 비례합니다.
+ */
+class FFileWatcher
+{
+public:
+    /** 에디터가 저장하면서 여러 번 쓰는 경우를 하나로 묶기 위해, 마지막 변경 후 이만큼 지나야 전달합니다. */
+    static constexpr std::chrono::milliseconds SettleTime{100};
+
+    /** 디렉터리 감시가 안 될 때 수정 시각을 확인하는 간격 */
+    static constexpr std::chrono::milliseconds PollInterval{1000};
+
+    FFileWatcher() = default;
+    ~FFileWatcher();
+
+    FFileWatcher(const FFileWatcher&) = delete;
+    FFileWatcher& operator=(const FFileWatcher&) = delete;
+
+    /**
+     * 파일을 감시 목록에 추가합니다. 처음 호출될 때 감시 스레드를 시작합니다.
+     * @param FilePath 변경 알림에 그대로 돌려줄 경로 (상대 경로 가능)
+     */
+    void AddFile(const FString& FilePath);
+    void RemoveFile(const FString& FilePath);
+
+    /** 감시 스레드를 멈추고 모든 감시를 해제합니다. */
+    void Shutdown();
+
+    /** 안정된(SettleTime이 지난) 변경 파일을 AddFile 때의 경로로 꺼냅니다. 같은 파일은 한 번만 들어갑니다. */
+    void DrainChanges(TArray<FString>& OutChangedFiles);
+
+    /** 디렉터리 감시 대신 폴링으로 감시 중인 파일 수 */
+    int32 GetNumPolledFiles() const;
+
+private:
+    struct FWatchedFile
+    {
+        FString FilePath;                                   // AddFile에 넘어온 경로
+        std::filesystem::path DirectoryKey;                 // 정규화된 디렉터리
+        std::filesystem::file_time_type LastWriteTime;      // 폴링용
+    };
+
+    struct FDirectoryWatch;
+
+    static std::wstring MakeKey(const std::filesystem::path& Path);
+
+    void ThreadMain();
+    void OpenPendingDirectories();
+    void OnDirectoryNotification(FDirectoryWatch& Watch, uint32 NumBytes);
+    void PollFiles();
+    void PushChange(const std::wstring& FileKey);
+
+private:
+    mutable std::mutex Mutex;
+
+    // 정규화된 전체 경로(소문자) → 파일 정보
+    TMap<std::wstring, FWatchedFile> WatchedFiles;
+
+    // 감시 스레드가 아직 열지 않은 디렉터리
+    TArray<std::filesystem::path> PendingDirectories;
+
+    // 변경된 파일 → 마지막 변경 알림 시각
+    TMap<std::wstring, std::chrono::steady_clock::time_point> PendingChanges;
+
+    // 이하 감시 스레드만 접근
+    TArray<FDirectoryWatch*> DirectoryWatches;
+    TArray<std::filesystem::path> PolledDirectories;
+    std::chrono::steady_clock::time_point LastPollTime;
+
+    std::thread WatchThread;
+    std::atomic<bool> bStopRequested = false;
+    void* WakeEvent = nullptr;
+};
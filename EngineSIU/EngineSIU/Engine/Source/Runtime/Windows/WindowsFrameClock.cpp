@@ -0,0 +1,62 @@
+﻿#include "WindowsFrameClock.h"
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+
+FWindowsFrameClock::FWindowsFrameClock()
+{
+    LARGE_INTEGER Frequency;
+    QueryPerformanceFrequency(&Frequency);
+    SecondsPerCounter = 1.0 / static_cast<double>(Frequency.QuadPart);
+
+    LARGE_INTEGER Counter;
+    QueryPerformanceCounter(&Counter);
+    StartCounter = Counter.QuadPart;
+
+    Timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+}
+
+FWindowsFrameClock::~FWindowsFrameClock()
+{
+    if (Timer)
+    {
+        CloseHandle(Timer);
+        Timer = nullptr;
+    }
+}
+
+double FWindowsFrameClock::NowSeconds()
+{
+    LARGE_INTEGER Counter;
+    QueryPerformanceCounter(&Counter);
+    return static_cast<double>(Counter.QuadPart - StartCounter) * SecondsPerCounter;
+}
+
+void FWindowsFrameClock::SleepSeconds(double Seconds)
+{
+    if (Seconds <= 0.0)
+    {
+        return;
+    }
+
+    if (Timer)
+    {
+        // 음수는 상대 시간, 100ns 단위
+        LARGE_INTEGER DueTime;
+        DueTime.QuadPart = -static_cast<LONGLONG>(Seconds * 10'000'000.0);
+        if (SetWaitableTimerEx(Timer, &DueTime, 0, nullptr, nullptr, nullptr, 0))
+        {
+            WaitForSingleObject(Timer, INFINITE);
+            return;
+        }
+    }
+
+    Sleep(static_cast<DWORD>(Seconds * 1000.0));
+}
+
+void FWindowsFrameClock::SpinPause()
+{
+    YieldProcessor();
+}
@@ -0,0 +1,33 @@
+﻿#pragma once
+#include "HAL/FramePacer.h"
+#include "HAL/PlatformType.h"
+
+
+/**
+ * Windows용 FFramePacer 시계
+ *
+ * 고해상도 Waitable Timer(Windows 10 1803 이상)로 재워 Sleep(1)의 ~1ms 단위보다 정밀하게 깨어납니다.
+ * 지원하지 않는 OS에서는 Sleep으로 대신하고, 늦게 깨어나는 만큼은 FFramePacer가 Spin 구간을 늘려 맞춥니다.
+ */
+class FWindowsFrameClock : public IFrameClock
+{
+public:
+    FWindowsFrameClock();
+    virtual ~FWindowsFrameClock() override;
+
+    FWindowsFrameClock(const FWindowsFrameClock&) = delete;
+    FWindowsFrameClock& operator=(const FWindowsFrameClock&) = delete;
+
+    virtual double NowSeconds() override;
+    virtual void SleepSeconds(double Seconds) override;
+    virtual void SpinPause() override;
+
+    bool IsHighResolutionTimer() const { return Timer != nullptr; }
+
+private:
+    HANDLE Timer = nullptr;
+
+    // 큰 Counter 값을 double로 바꿀 때 정밀도를 잃지 않도록 생성 시점을 기준으로 잼
+    int64 StartCounter = 0;
+    double SecondsPerCounter = 0.0;
+};
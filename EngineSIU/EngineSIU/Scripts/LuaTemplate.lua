@@ -27,6 +27,15 @@ function ReturnTable:Tick(DeltaTime)
 
 end
 
+-- TickBatch: 정의하면 Tick 대신, 이 스크립트를 쓰는 모든 Actor를 한 번에 Tick (self 없이 호출됨)
+-- Instances는 각 Actor의 self Table 배열. Actor가 많을 때 Lua 호출 횟수를 줄이기 위해 사용.
+-- function ReturnTable.TickBatch(Instances, DeltaTime)
+--     for i = 1, #Instances do
+--         local this = Instances[i].this
+--         this.ActorLocation = this.ActorLocation + FVector(1.0, 0.0, 0.0) * DeltaTime
+--     end
+-- end
+
 -- EndPlay: Actor가 파괴되거나 레벨이 전환될 때 호출
 function ReturnTable:EndPlay(EndPlayReason)
     -- print("[Lua] EndPlay called. Reason:", EndPlayReason) -- EndPlayReason Type 등록된 이후 사용 가능.
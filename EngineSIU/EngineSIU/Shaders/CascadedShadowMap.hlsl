@@ -1,14 +1,10 @@
 #define MAX_CASCADE_NUM 5 // TO DO : TO FIX!!!!
 #define NUM_CASCADES 3
 
-struct VS_INPUT_StaticMesh
+// 위치만 읽으므로 Float / Packed 정점 모두에 쓸 수 있음
+struct VS_INPUT_PositionOnly
 {
     float3 Position : POSITION;
-    float4 Color : COLOR;
-    float3 Normal : NORMAL;
-    float3 Tangent : TANGENT;
-    float2 UV : TEXCOORD;
-    uint MaterialIndex : MATERIAL_INDEX;
 };
 
 cbuffer CascadeConstantBuffer : register(b0)
@@ -28,7 +24,7 @@ struct GS_OUTPUT
     uint RTIndex : SV_RenderTargetArrayIndex;
 };
 
-GS_INPUT mainVS(VS_INPUT_StaticMesh Input)
+GS_INPUT mainVS(VS_INPUT_PositionOnly Input)
 {
     GS_INPUT output;
     float4 pos = mul(float4(Input.Position, 1.0f), World);
@@ -16,54 +16,50 @@ cbuffer GridParametersData : register(b1)
     float Padding;
 };
 
+// FDebugPrimitiveStream의 레코드 종류 (EDebugPrimitiveType과 같아야 함)
+static const uint PRIMITIVE_TYPE_AABB = 0;
+static const uint PRIMITIVE_TYPE_CONE = 1;
+static const uint PRIMITIVE_TYPE_OBB = 2;
+static const uint PRIMITIVE_TYPE_BONE = 3;
+
+// 레코드 크기 (float4 단위, 머리말 포함)
+static const uint AABB_RECORD_WORDS = 3;
+static const uint CONE_RECORD_WORDS = 5;
+static const uint OBB_RECORD_WORDS = 9;
+static const uint BONE_RECORD_WORDS = 3;
+
 cbuffer PrimitiveCounts : register(b3)
 {
     int BoundingBoxCount; // 렌더링할 AABB의 개수
     int ConeCount; // 렌더링할 cone의 개수
-    int BoneCount; // Begin Test
-    int pad;
-};
+    int OBBCount;
+    int BoneCount;
 
-struct FBoundingBoxData
-{
-    float3 bbMin;
-    float padding0;
-    float3 bbMax;
-    float padding1;
-};
-struct FConeData
-{
-    float3 ConeApex; // 원뿔의 꼭짓점
-    float ConeRadius; // 원뿔 밑면 반지름
-    
-    float3 ConeBaseCenter; // 원뿔 밑면 중심
-    float ConeHeight; // 원뿔 높이 (Apex와 BaseCenter 간 차이)
-    float4 Color;
-    
-    int ConeSegmentCount; // 원뿔 밑면 분할 수
-    float pad[3];
-};
+    // 종류별 첫 레코드의 위치 (float4 단위)
+    uint BoundingBoxOffset;
+    uint ConeOffset;
+    uint OBBOffset;
+    uint BoneOffset;
 
-struct FOrientedBoxCornerData
-{
-    float4 corners[8]; // 회전/이동 된 월드 공간상의 8꼭짓점
+    int ConeSegmentCount; // 원뿔 밑면 분할 수 (모든 cone이 같음)
+    int3 PrimitiveCountsPad;
 };
 
-struct FBoneData
-{
-    float3 Center;
-    float PadBoneGizmo01;
+/**
+ * 모든 디버그 프리미티브 레코드
+ * 레코드 = 머리말 float4 (x: 종류, y: 레코드 크기) + 종류별 데이터
+ *   AABB: Min, Max
+ *   Cone: (Apex, Radius), (BaseCenter, Height), Color, SegmentCount
+ *   OBB: 꼭짓점 8개
+ *   Bone: Center, Color
+ */
+StructuredBuffer<float4> g_PrimitiveStream : register(t2);
 
-    //float3 Apex;
-    //float PadBoneGizmo02;
+bool IsPrimitiveType(uint RecordIndex, uint Type)
+{
+    return asuint(g_PrimitiveStream[RecordIndex].x) == Type;
+}
 
-    float4 Color;
-};
-    
-StructuredBuffer<FBoundingBoxData> g_BoundingBoxes : register(t2);
-StructuredBuffer<FConeData> g_ConeData : register(t3);
-StructuredBuffer<FOrientedBoxCornerData> g_OrientedBoxes : register(t4);
-StructuredBuffer<FBoneData> g_BoneData : register(t5);
 static const int BB_EdgeIndices[12][2] =
 {
     { 0, 1 },
@@ -177,7 +173,9 @@ float3 ComputeAxisPosition(uint axisInstanceID, uint vertexID)
 /////////////////////////////////////////////////////////////////////////
 float3 ComputeBoundingBoxPosition(uint bbInstanceID, uint edgeIndex, uint vertexID)
 {
-    FBoundingBoxData box = g_BoundingBoxes[bbInstanceID];
+    uint record = BoundingBoxOffset + bbInstanceID * AABB_RECORD_WORDS;
+    float3 bbMin = g_PrimitiveStream[record + 1].xyz;
+    float3 bbMax = g_PrimitiveStream[record + 2].xyz;
   
 //    0: (bbMin.x, bbMin.y, bbMin.z)
 //    1: (bbMax.x, bbMin.y, bbMin.z)
@@ -188,9 +186,9 @@ float3 ComputeBoundingBoxPosition(uint bbInstanceID, uint edgeIndex, uint vertex
 //    6: (bbMin.x, bbMax.y, bbMax.z)
 //    7: (bbMax.x, bbMax.y, bbMax.z)
     int vertIndex = BB_EdgeIndices[edgeIndex][vertexID];
-    float x = ((vertIndex & 1) == 0) ? box.bbMin.x : box.bbMax.x;
-    float y = ((vertIndex & 2) == 0) ? box.bbMin.y : box.bbMax.y;
-    float z = ((vertIndex & 4) == 0) ? box.bbMin.z : box.bbMax.z;
+    float x = ((vertIndex & 1) == 0) ? bbMin.x : bbMax.x;
+    float y = ((vertIndex & 2) == 0) ? bbMin.y : bbMax.y;
+    float z = ((vertIndex & 4) == 0) ? bbMin.z : bbMax.z;
     return float3(x, y, z);
 }
 
@@ -206,16 +204,19 @@ float3 ComputeBoundingBoxPosition(uint bbInstanceID, uint edgeIndex, uint vertex
 float3 ComputeConePosition(uint globalInstanceID, uint vertexID)
 {
     // 모든 cone이 동일한 세그먼트 수를 가짐
-    int N = g_ConeData[0].ConeSegmentCount;
+    int N = ConeSegmentCount;
     
     uint coneIndex = globalInstanceID / (2 * N);
     uint lineIndex = globalInstanceID % (2 * N);
     
     // cone 데이터 읽기
-    FConeData cone = g_ConeData[coneIndex];
+    uint record = ConeOffset + coneIndex * CONE_RECORD_WORDS;
+    float3 ConeApex = g_PrimitiveStream[record + 1].xyz;
+    float ConeRadius = g_PrimitiveStream[record + 1].w;
+    float3 ConeBaseCenter = g_PrimitiveStream[record + 2].xyz;
     
     // cone의 축 계산
-    float3 axis = normalize(cone.ConeApex - cone.ConeBaseCenter);
+    float3 axis = normalize(ConeApex - ConeBaseCenter);
     
     // axis에 수직인 두 벡터(u, v)를 생성
     float3 arbitrary = abs(dot(axis, float3(0, 0, 1))) < 0.99 ? float3(0, 0, 1) : float3(0, 1, 0);
@@ -226,8 +227,8 @@ float3 ComputeConePosition(uint globalInstanceID, uint vertexID)
     {
         // 측면 선분: cone의 꼭짓점과 밑면의 한 점을 잇는다.
         float angle = lineIndex * 6.28318530718 / N;
-        float3 baseVertex = cone.ConeBaseCenter + (cos(angle) * u + sin(angle) * v) * cone.ConeRadius;
-        return (vertexID == 0) ? cone.ConeApex : baseVertex;
+        float3 baseVertex = ConeBaseCenter + (cos(angle) * u + sin(angle) * v) * ConeRadius;
+        return (vertexID == 0) ? ConeApex : baseVertex;
     }
     else
     {
@@ -235,8 +236,8 @@ float3 ComputeConePosition(uint globalInstanceID, uint vertexID)
         uint idx = lineIndex - N;
         float angle0 = idx * 6.28318530718 / N;
         float angle1 = ((idx + 1) % N) * 6.28318530718 / N;
-        float3 v0 = cone.ConeBaseCenter + (cos(angle0) * u + sin(angle0) * v) * cone.ConeRadius;
-        float3 v1 = cone.ConeBaseCenter + (cos(angle1) * u + sin(angle1) * v) * cone.ConeRadius;
+        float3 v0 = ConeBaseCenter + (cos(angle0) * u + sin(angle0) * v) * ConeRadius;
+        float3 v1 = ConeBaseCenter + (cos(angle1) * u + sin(angle1) * v) * ConeRadius;
         return (vertexID == 0) ? v0 : v1;
     }
 }
@@ -245,9 +246,9 @@ float3 ComputeConePosition(uint globalInstanceID, uint vertexID)
 /////////////////////////////////////////////////////////////////////////
 float3 ComputeOrientedBoxPosition(uint obIndex, uint edgeIndex, uint vertexID)
 {
-    FOrientedBoxCornerData ob = g_OrientedBoxes[obIndex];
+    uint record = OBBOffset + obIndex * OBB_RECORD_WORDS;
     int cornerID = BB_EdgeIndices[edgeIndex][vertexID];
-    return ob.corners[cornerID].xyz;
+    return g_PrimitiveStream[record + 1 + cornerID].xyz;
 }
 
 /////////////////////////////////////////////////////////////////////////
@@ -255,7 +256,8 @@ float3 ComputeOrientedBoxPosition(uint obIndex, uint edgeIndex, uint vertexID)
 /////////////////////////////////////////////////////////////////////////
 float3 ComputeBonePosition(uint boneIndex, uint localInstanceID, uint vertexID)
 {
-    FBoneData bone = g_BoneData[boneIndex];
+    uint record = BoneOffset + boneIndex * BONE_RECORD_WORDS;
+    float3 boneCenter = g_PrimitiveStream[record + 1].xyz;
     
     static const float BONE_GIZMO_SPHERE_RADIUS = 2.0f; 
     
@@ -271,25 +273,25 @@ float3 ComputeBonePosition(uint boneIndex, uint localInstanceID, uint vertexID)
     
     if (circleId == 0) // XY plane circle
     {
-        pointOnCircle.x = bone.Center.x + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
-        pointOnCircle.y = bone.Center.y + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
-        pointOnCircle.z = bone.Center.z;
+        pointOnCircle.x = boneCenter.x + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
+        pointOnCircle.y = boneCenter.y + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
+        pointOnCircle.z = boneCenter.z;
     }
     else if (circleId == 1) // XZ plane circle
     {
-        pointOnCircle.x = bone.Center.x + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
-        pointOnCircle.y = bone.Center.y; // Y is constant for XZ plane
-        pointOnCircle.z = bone.Center.z + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
+        pointOnCircle.x = boneCenter.x + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
+        pointOnCircle.y = boneCenter.y; // Y is constant for XZ plane
+        pointOnCircle.z = boneCenter.z + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
     }
     else if (circleId == 2) // YZ plane circle
     {
-        pointOnCircle.x = bone.Center.x; // X is constant for YZ plane
-        pointOnCircle.y = bone.Center.y + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
-        pointOnCircle.z = bone.Center.z + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
+        pointOnCircle.x = boneCenter.x; // X is constant for YZ plane
+        pointOnCircle.y = boneCenter.y + BONE_GIZMO_SPHERE_RADIUS * cos(currentAngle);
+        pointOnCircle.z = boneCenter.z + BONE_GIZMO_SPHERE_RADIUS * sin(currentAngle);
     }
     else
     {
-        pointOnCircle = bone.Center;
+        pointOnCircle = boneCenter;
     }
     return pointOnCircle;
 }
@@ -306,20 +308,20 @@ PS_INPUT mainVS(VS_INPUT input)
     uint gridLineCount = GridCount; // 그리드 라인
     uint axisCount = 3; // X, Y, Z 축 (월드 좌표축)
     uint aabbInstanceCount = BoundingBoxCount * 12; // AABB 하나당 12개 엣지
-    uint coneInstanceCount = ConeCount * 2 * g_ConeData[0].ConeSegmentCount;
+    uint coneInstanceCount = ConeCount * 2 * ConeSegmentCount;
+    uint obbInstanceCount = OBBCount * 12;
     uint boneInstanceCount = BoneCount * BONE_GIZMO_TOTAL_LINES_PER_BONE; // Use the new global constant
-    //uint obbInstanceCount = OBBCount * 12; // Using the count from CBuffer
-    //uint instancesPerSphere = (NumSphereLatitudeLines * NumSphereSegmentsPerLine) + (NumSphereLongitudeLines * NumSphereSegmentsPerLine);
     
     // --- Calculate Start Indices ---
     uint gridEnd = gridLineCount;
     uint axisEnd = gridEnd + axisCount;
     uint aabbEnd = axisEnd + aabbInstanceCount;
     uint coneEnd = aabbEnd + coneInstanceCount;
-    uint boneEnd = coneEnd + boneInstanceCount;
-    //uint obbEnd = coneEnd + obbInstanceCount;
-    //uint sphereEnd = obbEnd + sphereInstanceCount; // End of sphere instances
-    //uint boxEnd = sphereEnd + boxInstanceCount;
+    uint obbEnd = coneEnd + obbInstanceCount;
+    uint boneEnd = obbEnd + boneInstanceCount;
+
+    // 스트림에서 다른 종류의 레코드를 읽으면 Magenta로 표시
+    const float4 ErrorColor = float4(1.0, 0.0, 1.0, 1.0);
     
     // --- Instance ID Branching ---
     if (input.instanceID < gridEnd)
@@ -348,65 +350,36 @@ PS_INPUT mainVS(VS_INPUT input)
         uint bbInstanceID = index / 12;
         uint bbEdgeIndex = index % 12;
         pos = ComputeBoundingBoxPosition(bbInstanceID, bbEdgeIndex, input.vertexID);
-        color = float4(1.0, 1.0, 0.0, 1.0); // Yellow
+        color = IsPrimitiveType(BoundingBoxOffset + bbInstanceID * AABB_RECORD_WORDS, PRIMITIVE_TYPE_AABB) ? float4(1.0, 1.0, 0.0, 1.0) : ErrorColor; // Yellow
     }
     else if (input.instanceID < coneEnd)
     {
         // Cone
         uint coneInstanceID = input.instanceID - aabbEnd;
         pos = ComputeConePosition(coneInstanceID, input.vertexID);
-        if (ConeCount > 0 && g_ConeData[0].ConeSegmentCount > 0)
-        {
-            int N = g_ConeData[0].ConeSegmentCount;
-            uint coneIndex = coneInstanceID / (2 * N);
-            if (coneIndex < ConeCount)
-            {
-                color = g_ConeData[coneIndex].Color;
-            }
-            else
-            {
-                color = float4(1, 0, 1, 1);
-            }
-        }
-        else
-        {
-            color = float4(1, 0, 1, 1);
-        }
+
+        uint coneRecord = ConeOffset + (coneInstanceID / (2 * ConeSegmentCount)) * CONE_RECORD_WORDS;
+        color = IsPrimitiveType(coneRecord, PRIMITIVE_TYPE_CONE) ? g_PrimitiveStream[coneRecord + 3] : ErrorColor;
+    }
+    else if (input.instanceID < obbEnd)
+    {
+        // Oriented Box (OBB)
+        uint obbLocalID = input.instanceID - coneEnd;
+        uint obbIndex = obbLocalID / 12;
+        uint edgeIndex = obbLocalID % 12;
+        pos = ComputeOrientedBoxPosition(obbIndex, edgeIndex, input.vertexID);
+        color = IsPrimitiveType(OBBOffset + obbIndex * OBB_RECORD_WORDS, PRIMITIVE_TYPE_OBB) ? float4(0.4, 1.0, 0.4, 1.0) : ErrorColor; // Light Green
     }
     else if (input.instanceID < boneEnd)
     {
-        uint globalBoneLineID = input.instanceID - coneEnd;
+        uint globalBoneLineID = input.instanceID - obbEnd;
         uint currentBoneDataIndex = globalBoneLineID / BONE_GIZMO_TOTAL_LINES_PER_BONE;
         uint localLineIDForBone = globalBoneLineID % BONE_GIZMO_TOTAL_LINES_PER_BONE;
         pos = ComputeBonePosition(currentBoneDataIndex, localLineIDForBone, input.vertexID);
-        
-        color = g_BoneData[currentBoneDataIndex].Color;
-        //if (currentBoneDataIndex < BoneCount)
-        //{
-        //    color = g_BoneData[currentBoneDataIndex].Color;
-        //}
-        //else
-        //{
-        //    color = float4(1.0, 0.0, 1.0, 1.0);
-        //}
+
+        uint boneRecord = BoneOffset + currentBoneDataIndex * BONE_RECORD_WORDS;
+        color = IsPrimitiveType(boneRecord, PRIMITIVE_TYPE_BONE) ? g_PrimitiveStream[boneRecord + 2] : ErrorColor;
     }
-    //else if (input.instanceID < obbEnd)
-    //{
-    //    // Oriented Box (OBB)
-    //    uint obbLocalID = input.instanceID - coneEnd;
-    //    uint obbIndex = obbLocalID / 12;
-    //    uint edgeIndex = obbLocalID % 12;
-    //    // Ensure obbIndex is within bounds of g_OrientedBoxes if OrientedBoxCount > 0
-    //    if (obbIndex < obbInstanceCount)
-    //    {
-    //        pos = ComputeOrientedBoxPosition(obbIndex, edgeIndex, input.vertexID);
-    //    }
-    //    else
-    //    {
-    //        pos = float3(0, 0, 0); // Error case
-    //    }
-    //    color = float4(0.4, 1.0, 0.4, 1.0); // Light Green
-    //}
     else
     {
         // Fallback / Error case
@@ -62,6 +62,42 @@ struct VS_INPUT_StaticMesh
     uint MaterialIndex : MATERIAL_INDEX;
 };
 
+// FPackedStaticMeshVertex. 위치는 메시 바운드 기준 [0, 1]이므로 WorldMatrix에 바운드 변환이 곱해져 있어야 함
+struct VS_INPUT_PackedStaticMesh
+{
+    float3 Position : POSITION;     // R16G16B16A16_UNORM
+    float2 Normal : NORMAL;         // R16G16_SNORM, 8면체 인코딩
+    float2 Tangent : TANGENT;       // R16G16_SNORM, 8면체 인코딩
+    float2 UV : TEXCOORD;           // R16G16_FLOAT
+};
+
+// 깊이만 그리는 셰이더용. Float / Packed 입력 레이아웃 모두에 맞음
+struct VS_INPUT_PositionOnly
+{
+    float3 Position : POSITION;
+};
+
+// FStaticMeshVertexPacking::DecodeOctahedral과 같아야 함
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 Direction = float3(Encoded.x, Encoded.y, 1.0 - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = saturate(-Direction.z);
+    Direction.xy += (Direction.xy >= 0.0) ? -Fold : Fold;
+    return normalize(Direction);
+}
+
+VS_INPUT_StaticMesh UnpackStaticMeshVertex(VS_INPUT_PackedStaticMesh Packed)
+{
+    VS_INPUT_StaticMesh Unpacked;
+    Unpacked.Position = Packed.Position;
+    Unpacked.Color = float4(0.7, 0.7, 0.7, 1.0);
+    Unpacked.Normal = DecodeOctahedral(Packed.Normal);
+    Unpacked.Tangent = DecodeOctahedral(Packed.Tangent);
+    Unpacked.UV = Packed.UV;
+    Unpacked.MaterialIndex = 0;
+    return Unpacked;
+}
+
 struct PS_INPUT_StaticMesh
 {
     float4 Position : SV_POSITION;
@@ -15,8 +15,14 @@ cbuffer MaterialConstants : register(b1)
 #endif
 
 
+#ifdef PACKED_VERTEX
+PS_INPUT_StaticMesh mainVS(VS_INPUT_PackedStaticMesh PackedInput)
+{
+    VS_INPUT_StaticMesh Input = UnpackStaticMeshVertex(PackedInput);
+#else
 PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input)
 {
+#endif
     PS_INPUT_StaticMesh Output;
 
     Output.Position = float4(Input.Position, 1.0);